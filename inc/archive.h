@@ -0,0 +1,105 @@
+/**
+ * Reads content from zip archives and gzip files.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#pragma once
+
+#include <SDL.h>
+
+/**
+ * Archives are mapped into memory, and the central directory of zip archives
+ * is read without reading the entries themselves. Entries are decompressed
+ * directly into memory given by the caller with the streaming decoder of
+ * tinf, and are verified with their CRC-32 one step at a time, whilst each
+ * step remains in the cache.
+ *
+ * A gzip file is treated as an archive with a single entry. Only stored and
+ * deflate compressed entries are supported.
+ */
+typedef struct archive_s archive_ctx;
+
+/* Extensions of files that are read as archives. */
+#define ARCHIVE_EXTS	"zip|gz"
+
+/**
+ * Open a zip archive or gzip file.
+ *
+ * \param filename	File to open.
+ * \return		Archive context, or NULL on error. Use SDL_GetError().
+ */
+archive_ctx *archive_open(const char *filename);
+
+/**
+ * Obtain the number of entries in the archive. Directories are not counted.
+ */
+unsigned archive_count(const archive_ctx *ctx);
+
+/**
+ * Obtain the name of an entry, including its path within the archive.
+ */
+const char *archive_name(const archive_ctx *ctx, unsigned entry);
+
+/**
+ * Obtain the uncompressed size of an entry in bytes.
+ */
+size_t archive_size(const archive_ctx *ctx, unsigned entry);
+
+/**
+ * Obtain the CRC-32 of an entry, as given by the archive. Once the entry is
+ * extracted by archive_extract(), this is the verified CRC-32 of its data.
+ */
+Uint32 archive_crc(const archive_ctx *ctx, unsigned entry);
+
+/**
+ * Find the first entry with one of the given extensions.
+ *
+ * \param ctx		Archive context.
+ * \param exts		Extensions separated by '|'. If NULL, the first entry
+ *			is returned.
+ * \return		Index of entry, or -1 if not found.
+ */
+int archive_find(const archive_ctx *ctx, const char *exts);
+
+/**
+ * Called as entries are decompressed, by each thread decompressing them.
+ *
+ * \param priv		Private data given to archive_extract().
+ * \param percent	Percentage of the data of all entries decompressed.
+ * \return		0 to continue, or non-zero to cancel the extraction.
+ */
+typedef int (*archive_progress_fn)(void *priv, unsigned percent);
+
+/**
+ * Decompress entries of the archive. When more than one entry is given, the
+ * entries are decompressed in parallel by the job pool and the calling thread.
+ * The calling thread only waits for entries that workers have started, so
+ * this may be called by a worker.
+ *
+ * \param ctx		Archive context.
+ * \param n		Number of entries to decompress.
+ * \param entries	Indexes of entries to decompress.
+ * \param dst		Memory to decompress each entry to, each of at least
+ *			archive_size() bytes.
+ * \param progress	Called after each step of 1 MiB is decompressed. May
+ *			be NULL.
+ * \param priv		Private data given to progress.
+ * \return		0 on success, else failure. Use SDL_GetError().
+ */
+int archive_extract(archive_ctx *ctx, unsigned n, const unsigned *entries,
+		    void *const *dst, archive_progress_fn progress,
+		    void *priv);
+
+/**
+ * Close the archive. Does nothing if ctx is NULL.
+ */
+void archive_close(archive_ctx *ctx);
@@ -0,0 +1,156 @@
+/**
+ * Audio output for libretro cores.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#pragma once
+
+#include <SDL.h>
+#include <resample.h>
+
+/**
+ * Audio frames from the core are written to a lock-free single-producer
+ * single-consumer ring buffer, which is drained by the callback of the audio
+ * device. No lock is taken when writing audio.
+ *
+ * The number of frames held in the ring buffer is limited to the target
+ * latency. Frames that do not fit are dropped, which is counted as an
+ * overrun. When the ring buffer does not hold enough frames for the device,
+ * silence is played instead, which is counted as an underrun.
+ *
+ * Audio is played at the native sample rate of the device. If this differs
+ * from the sample rate of the core, audio is converted before it is written to
+ * the ring buffer. Frame counts other than those given to audio_write() are at
+ * the sample rate of the device.
+ *
+ * Except for audio_get_stats() and audio_write(), functions in this file must
+ * only be called by a single thread per context. audio_write() may also be
+ * called by the producer function; see audio_start_producer().
+ */
+typedef struct audio_s audio_ctx;
+
+/* Default target latency in milliseconds. */
+#define AUDIO_DEFAULT_LATENCY_MS	64
+
+/* Maximum latency that may be requested with audio_set_min_latency(). */
+#define AUDIO_MAX_LATENCY_MS		512
+
+struct audio_stats_s {
+	/* Number of device callbacks that received fewer frames than
+	 * requested, and the number of frames of silence played as a
+	 * result. */
+	Uint32 underruns;
+	Uint64 frames_silence;
+
+	/* Number of writes that did not fit within the target latency, and the
+	 * number of frames dropped as a result. */
+	Uint32 overruns;
+	Uint64 frames_dropped;
+
+	/* Number of frames played by the device. */
+	Uint64 frames_played;
+};
+
+/**
+ * Open the default audio device for stereo signed 16-bit audio.
+ *
+ * \param sample_rate	Sample rate of audio in Hz.
+ * \param latency_ms	Target latency in milliseconds. Set to 0 to use
+ *			AUDIO_DEFAULT_LATENCY_MS.
+ * \param quality	Quality of sample rate conversion, if required.
+ * \return		Audio context, or NULL on error. Use SDL_GetError().
+ */
+audio_ctx *audio_init(double sample_rate, Uint32 latency_ms,
+		      resample_quality_e quality);
+
+/**
+ * Queue interleaved stereo frames for playback. Playback begins once half of
+ * the target latency has been queued. Frames that do not fit within the target
+ * latency are dropped.
+ *
+ * \param ctx		Audio context.
+ * \param data		Interleaved stereo frames at the sample rate of the core.
+ * \param frames	Number of frames.
+ */
+void audio_write(audio_ctx *ctx, const Sint16 *data, Uint32 frames);
+
+typedef void (*audio_produce_fn)(void *priv);
+typedef void (*audio_state_fn)(void *priv, SDL_bool enabled);
+
+/**
+ * Start a thread that calls the given function whenever there is space within
+ * the target latency. The function is expected to write audio with
+ * audio_write(). This is used by cores that generate audio asynchronously to
+ * video.
+ *
+ * \param ctx		Audio context.
+ * \param produce	Function to call to write audio.
+ * \param state		Function to call with SDL_TRUE once the thread has
+ *			started, and SDL_FALSE before it stops. May be NULL.
+ * \param priv		Private pointer given to functions.
+ * \return		0 on success, else failure. Use SDL_GetError().
+ */
+int audio_start_producer(audio_ctx *ctx, audio_produce_fn produce,
+			 audio_state_fn state, void *priv);
+
+/**
+ * Stop the producer thread, if running. Does nothing if ctx is NULL.
+ */
+void audio_stop_producer(audio_ctx *ctx);
+
+/**
+ * Wait for the producer function to return, and prevent it from being called
+ * again until audio_unlock_producer(). Used to modify state that the producer
+ * function depends on, such as recording outputs. Does nothing if ctx is NULL
+ * or the producer thread is not running. The lock is recursive, so it may
+ * also be taken from within the producer function.
+ */
+void audio_lock_producer(audio_ctx *ctx);
+void audio_unlock_producer(audio_ctx *ctx);
+
+/**
+ * Obtain the number of frames waiting to be played.
+ */
+Uint32 audio_queued(audio_ctx *ctx);
+
+/**
+ * Obtain the target latency in frames. This is the maximum number of frames
+ * that may be waiting to be played.
+ */
+Uint32 audio_target(audio_ctx *ctx);
+
+/**
+ * Obtain the sample rate of the device in Hz.
+ */
+Uint32 audio_rate(const audio_ctx *ctx);
+
+/**
+ * Raise the target latency, such as for a core that skips frames when audio is
+ * about to underrun. The target latency is never lowered below that given to
+ * audio_init(), and is limited to AUDIO_MAX_LATENCY_MS. May be called whilst
+ * the producer thread is running.
+ *
+ * \param ctx		Audio context.
+ * \param latency_ms	Minimum latency in milliseconds. Set to 0 to restore
+ *			the latency given to audio_init().
+ */
+void audio_set_min_latency(audio_ctx *ctx, Uint32 latency_ms);
+
+/**
+ * Obtain the number of underruns and overruns.
+ */
+void audio_get_stats(audio_ctx *ctx, struct audio_stats_s *stats);
+
+/**
+ * Close the audio device and free the context. Does nothing if ctx is NULL.
+ */
+void audio_exit(audio_ctx *ctx);
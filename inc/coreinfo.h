@@ -0,0 +1,116 @@
+/**
+ * Cache of information obtained from libretro cores.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#pragma once
+
+#include <SDL.h>
+#include <libretro.h>
+
+/**
+ * The system information of each core is stored in a file, so that content
+ * may be read and the window laid out before the core is loaded, and so that
+ * a core may be selected for given content.
+ *
+ * Cores are identified by their path, and information is only used whilst the
+ * size and modification time of the core are unchanged.
+ */
+typedef struct coreinfo_s coreinfo_ctx;
+
+struct coreinfo_entry_s
+{
+	char *path;
+	Uint64 size;
+	Sint64 mtime;
+
+	/* From retro_get_system_info(). */
+	char *library_name;
+	char *library_version;
+	char *valid_extensions;
+	SDL_bool need_fullpath;
+
+	/* SPDX identifier from re_core_get_license_info(). Empty if the core
+	 * does not specify its license. */
+	char *license;
+
+	/* From retro_get_system_av_info() when the core last played content.
+	 * Zero if the core has not played content. */
+	struct retro_system_av_info av_info;
+};
+
+/**
+ * Open a cache file. A file that does not exist is created once the cache is
+ * saved.
+ *
+ * \param filename	Cache file.
+ * \return		Cache context, or NULL on error. Use SDL_GetError().
+ */
+coreinfo_ctx *coreinfo_open(const char *filename);
+
+/**
+ * Find the information of a core.
+ *
+ * \param ctx		Cache context.
+ * \param core_path	Path of core.
+ * \return		Information of core, or NULL if the core is not cached or
+ *			has changed since. Invalidated by coreinfo_set().
+ */
+const struct coreinfo_entry_s *coreinfo_find(const coreinfo_ctx *ctx,
+		const char *core_path);
+
+/**
+ * Find a core that supports the extension of the given content. Where more
+ * than one core supports it, the core with the first path in sort order is
+ * used.
+ *
+ * \param ctx		Cache context.
+ * \param content	Path of content.
+ * \return		Information of core, or NULL if no cached core supports
+ *			the content. Invalidated by coreinfo_set().
+ */
+const struct coreinfo_entry_s *coreinfo_find_ext(coreinfo_ctx *ctx,
+		const char *content);
+
+/**
+ * Add or replace the information of a core.
+ *
+ * \param ctx		Cache context.
+ * \param core_path	Path of core.
+ * \param sys		System information of core.
+ * \param av		Audio and video information of core, or NULL to keep
+ *			the previously cached information.
+ * \param license	SPDX identifier of the license of the core, or NULL.
+ * \return		0 on success, else failure. Use SDL_GetError().
+ */
+int coreinfo_set(coreinfo_ctx *ctx, const char *core_path,
+		 const struct retro_system_info *sys,
+		 const struct retro_system_av_info *av, const char *license);
+
+/**
+ * Remove the information of cores that no longer exist.
+ *
+ * \return	Number of cores removed.
+ */
+unsigned coreinfo_prune(coreinfo_ctx *ctx);
+
+/**
+ * Write the cache to its file if it has changed.
+ *
+ * \return	0 on success, else failure. Use SDL_GetError().
+ */
+int coreinfo_save(coreinfo_ctx *ctx);
+
+/**
+ * Free the cache without saving it. Does nothing if ctx is NULL.
+ */
+void coreinfo_close(coreinfo_ctx *ctx);
@@ -0,0 +1,96 @@
+/**
+ * Disk control of libretro cores that play content spanning multiple images.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#pragma once
+
+#include <SDL.h>
+
+struct core_ctx_s;
+
+/* Extensions of playlists of disk images. */
+#define DISK_PLAYLIST_EXTS	"m3u"
+
+/**
+ * A list of the disk images that make up content, read from an M3U playlist.
+ */
+typedef struct disk_s disk_ctx;
+
+/**
+ * Read an M3U playlist. Lines starting with '#' are ignored, and a label
+ * following '|' is removed. Relative paths are relative to the directory of
+ * the playlist.
+ *
+ * \param filename	Playlist file.
+ * \return		List of disk images, or NULL on error. Use
+ *			SDL_GetError().
+ */
+disk_ctx *disk_open_m3u(const char *filename);
+
+/**
+ * Obtain the number of disk images within the playlist.
+ */
+unsigned disk_count(const disk_ctx *ctx);
+
+/**
+ * Obtain the path of a disk image within the playlist.
+ *
+ * \return	Path of image, or NULL if index is out of range.
+ */
+const char *disk_path(const disk_ctx *ctx, unsigned index);
+
+/**
+ * Free the playlist. Does nothing if ctx is NULL.
+ */
+void disk_close(disk_ctx *ctx);
+
+/**
+ * Give the remaining images of the playlist to the core once content is
+ * loaded, and start reading the image that follows the inserted image into
+ * the page cache.
+ *
+ * \param ctx	Libretro core context.
+ */
+void disk_load(struct core_ctx_s *ctx);
+
+/**
+ * Open or close the virtual disk tray.
+ *
+ * \param ctx	Libretro core context.
+ * \return	1 if the tray is now open, 0 if closed, or -1 on error. Use
+ *		SDL_GetError().
+ */
+int disk_toggle_eject(struct core_ctx_s *ctx);
+
+/**
+ * Insert the image that follows the current image, returning to the first
+ * image after the last. If the tray is open, it is left open.
+ *
+ * \param ctx	Libretro core context.
+ * \return	Index of the inserted image, or -1 on error. Use
+ *		SDL_GetError().
+ */
+int disk_next(struct core_ctx_s *ctx);
+
+/**
+ * Obtain the number of images known to the core.
+ */
+unsigned disk_num_images(const struct core_ctx_s *ctx);
+
+/**
+ * Read a file into the page cache on a worker thread, so that a core opening
+ * it later does not wait for the disk.
+ *
+ * \param path	File to read.
+ */
+void disk_prefetch(const char *path);
@@ -0,0 +1,90 @@
+/**
+ * Read-only mapping of files into memory.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#pragma once
+
+#include <SDL.h>
+
+/**
+ * Files are mapped with mmap() where supported, so that only the parts of the
+ * file that are accessed are read, and are backed by the page cache rather
+ * than the heap. On other platforms, the whole file is read into memory.
+ */
+typedef struct fmap_s fmap_ctx;
+
+/* Flags other than FMAP_FLAG_WRITE and FMAP_FLAG_MAP_ONLY are hints, and are
+ * ignored on unsupported platforms. */
+enum fmap_flags_e {
+	FMAP_FLAG_NONE = 0,
+
+	/* Allow the mapping to be written to. Written pages are private to the
+	 * mapping, and are not written to the file. This protects against
+	 * libretro cores that modify content they were given as const. */
+	FMAP_FLAG_WRITE = (1 << 0),
+
+	/* Read the whole file whilst mapping it, so that accessing it later
+	 * never waits on the disk. */
+	FMAP_FLAG_POPULATE = (1 << 1),
+
+	/* Start reading the whole file in the background. */
+	FMAP_FLAG_WILLNEED = (1 << 2),
+
+	/* The file will be read in order, so read ahead aggressively and
+	 * drop pages once read. */
+	FMAP_FLAG_SEQUENTIAL = (1 << 3),
+
+	/* Use transparent huge pages where supported by the filesystem, to
+	 * reduce TLB misses on large content. */
+	FMAP_FLAG_HUGEPAGE = (1 << 4),
+
+	/* Fail instead of reading the whole file into memory on platforms
+	 * that do not support mapping files. */
+	FMAP_FLAG_MAP_ONLY = (1 << 5)
+};
+
+/**
+ * Map a file into memory. The file must not be truncated whilst it is mapped.
+ * Where files are mapped with mmap(), only regular files may be mapped.
+ *
+ * \param filename	File to map.
+ * \param flags		Flags from fmap_flags_e.
+ * \return		Mapping of file, or NULL on error. Use SDL_GetError().
+ */
+fmap_ctx *fmap_open(const char *filename, unsigned flags);
+
+/**
+ * Obtain the contents of the file. The returned memory must not be written to
+ * unless FMAP_FLAG_WRITE was given. This is NULL for empty files.
+ */
+const Uint8 *fmap_data(const fmap_ctx *ctx);
+
+/**
+ * Obtain the size of the file in bytes.
+ */
+size_t fmap_size(const fmap_ctx *ctx);
+
+/**
+ * Unmap the file. Does nothing if ctx is NULL.
+ */
+void fmap_close(fmap_ctx *ctx);
+
+/**
+ * Read a file into the page cache without mapping it, so that opening or
+ * mapping it later does not wait on the disk. Where reading ahead cannot be
+ * requested, the whole file is read and discarded, so this may block.
+ *
+ * \param filename	File to read.
+ * \return		0 on success, else failure. Use SDL_GetError().
+ */
+int fmap_prefetch(const char *filename);
@@ -1,909 +1,1605 @@
-const unsigned char gcdb_bin[] = {
-  0x4c, 0x4c, 0x45, 0x76, 0x03, 0x31, 0x0c, 0xdd, 0xf7, 0x14, 0x3d, 0x80,
-  0x5e, 0xdf, 0x60, 0x40, 0xab, 0xd2, 0xb2, 0x97, 0x90, 0xc6, 0x18, 0x8e,
-  0x21, 0x70, 0xfb, 0x5a, 0x9e, 0x42, 0x8c, 0xfa, 0xd8, 0xf4, 0x4d, 0x5d,
-  0xa3, 0x6e, 0x06, 0xf9, 0x57, 0xba, 0xe9, 0xca, 0x27, 0x4f, 0x2b, 0x3f,
-  0xac, 0xde, 0x7d, 0xfa, 0x3c, 0x3e, 0xbf, 0x29, 0x3a, 0x25, 0x1d, 0x80,
-  0x90, 0x1b, 0x60, 0xe4, 0x16, 0x98, 0xa6, 0x2d, 0xf2, 0x02, 0xd4, 0x49,
-  0x1d, 0xaf, 0x07, 0x74, 0xcd, 0xcb, 0x50, 0xe6, 0x9d, 0x36, 0x49, 0xe6,
-  0x55, 0x99, 0x83, 0xb7, 0xae, 0x82, 0xae, 0x80, 0x7c, 0x92, 0xa9, 0x05,
-  0x9b, 0xbd, 0xd2, 0xc8, 0x2b, 0x10, 0x67, 0x74, 0xc7, 0xbc, 0x53, 0x3a,
-  0x20, 0x0f, 0x33, 0x4e, 0x5e, 0x4a, 0xd7, 0x15, 0xa4, 0x92, 0xb7, 0x45,
-  0xa3, 0xae, 0xc2, 0x1b, 0x52, 0x53, 0x87, 0x3b, 0x52, 0x0b, 0xd2, 0xfd,
-  0x10, 0x1f, 0x2b, 0xf1, 0x9b, 0x6f, 0x9b, 0x19, 0xfe, 0x35, 0xcc, 0xb2,
-  0x54, 0xf4, 0x75, 0x92, 0x8e, 0x01, 0x62, 0xa2, 0x90, 0x90, 0x97, 0x70,
-  0x43, 0xee, 0xe0, 0x8e, 0xdc, 0xc3, 0x69, 0x47, 0xc9, 0x1c, 0xc3, 0x1e,
-  0xbf, 0xfc, 0x21, 0xdf, 0xe0, 0xe9, 0xbb, 0xbd, 0xb3, 0xe9, 0x6e, 0x5b,
-  0x37, 0x1e, 0xfe, 0x57, 0xe1, 0xb2, 0x3d, 0xb7, 0xe9, 0x19, 0xbc, 0x92,
-  0x5c, 0x3a, 0x8e, 0xe3, 0xa6, 0xbd, 0x49, 0xfc, 0x44, 0xbe, 0x89, 0xdb,
-  0x1d, 0x28, 0x42, 0x0e, 0x9f, 0x48, 0xa2, 0x0f, 0x25, 0x27, 0x71, 0x17,
-  0xf7, 0xb3, 0xff, 0x4d, 0x13, 0x30, 0xc5, 0x31, 0x28, 0x0a, 0xa6, 0x1c,
-  0x5b, 0x25, 0xb5, 0x21, 0xeb, 0xd3, 0x73, 0x83, 0xf9, 0x71, 0x30, 0x18,
-  0x00, 0xf3, 0x62, 0xf1, 0x4c, 0x23, 0x9a, 0x56, 0x6f, 0xec, 0x0e, 0x0b,
-  0x21, 0xbb, 0xe1, 0x21, 0xf0, 0x48, 0x3e, 0x14, 0xf1, 0x91, 0x9b, 0x7c,
-  0x08, 0x6b, 0x00, 0x4a, 0xa2, 0x6e, 0x40, 0x61, 0x13, 0x10, 0x6f, 0x02,
-  0x4a, 0xe2, 0x7b, 0x40, 0xf4, 0x1e, 0x10, 0xb3, 0x80, 0x08, 0x29, 0x09,
-  0xb1, 0x92, 0x10, 0xef, 0x26, 0x14, 0x0b, 0x72, 0xf7, 0x44, 0x0a, 0xf4,
-  0x26, 0xbf, 0x4c, 0xf2, 0xa5, 0x2e, 0x09, 0x91, 0x92, 0x10, 0x3c, 0x9a,
-  0x90, 0x53, 0xd6, 0xf6, 0xb1, 0xb7, 0x8e, 0x18, 0xa8, 0x1d, 0x68, 0x0c,
-  0xae, 0x6f, 0xfa, 0xf6, 0x98, 0x41, 0x70, 0x56, 0xe4, 0xfd, 0x87, 0xfc,
-  0xe2, 0xbe, 0x25, 0xef, 0xd6, 0xf6, 0x17, 0x47, 0x46, 0xf1, 0xbe, 0x64,
-  0x94, 0x78, 0x3c, 0x19, 0xd1, 0x24, 0x43, 0x80, 0x45, 0x2e, 0x2d, 0x1f,
-  0x75, 0x86, 0x50, 0xe1, 0xb4, 0x90, 0xbf, 0x67, 0x6b, 0x1d, 0xd0, 0xfe,
-  0x5c, 0xac, 0x81, 0x24, 0xd4, 0x47, 0x77, 0xc4, 0x4b, 0xd2, 0x1d, 0xea,
-  0xb2, 0x90, 0x87, 0x4f, 0x88, 0xef, 0x4f, 0x87, 0xc8, 0x16, 0x1d, 0x9a,
-  0x9c, 0xec, 0x13, 0xd1, 0xc1, 0x4c, 0x33, 0xe1, 0x46, 0x04, 0x30, 0x22,
-  0x6a, 0x5b, 0xbd, 0x5a, 0x10, 0xbd, 0x67, 0xd0, 0xdf, 0x4f, 0xeb, 0x96,
-  0x53, 0x22, 0xc1, 0xc2, 0xfd, 0xb9, 0x58, 0x52, 0xe0, 0x65, 0xd9, 0x5f,
-  0x30, 0x7f, 0x07, 0xd4, 0xff, 0x43, 0xe3, 0x2f, 0xdb, 0x29, 0xac, 0x43,
-  0xd1, 0x05, 0x01, 0xd9, 0xfd, 0x15, 0x7b, 0xad, 0xad, 0x51, 0x53, 0xb4,
-  0xf8, 0x31, 0xdf, 0xf6, 0x51, 0xdf, 0x91, 0xbb, 0x15, 0xf4, 0x03, 0x83,
-  0x17, 0xe1, 0x26, 0x23, 0x8b, 0x23, 0xdc, 0xce, 0xe0, 0x87, 0xca, 0xe3,
-  0xd9, 0xcb, 0xca, 0x75, 0xa0, 0xc6, 0x58, 0x0a, 0x1a, 0xb9, 0x3f, 0xe4,
-  0x88, 0x26, 0x6e, 0x41, 0x23, 0x39, 0x9a, 0xbe, 0x7b, 0x5b, 0x9a, 0x7a,
-  0xd9, 0xa8, 0xc7, 0xee, 0x25, 0xc1, 0x48, 0x49, 0x89, 0x7b, 0x92, 0x9c,
-  0x4c, 0x36, 0x26, 0x35, 0x35, 0x5a, 0x10, 0x59, 0xc1, 0x7f, 0x53, 0xc4,
-  0xca, 0xfd, 0x4a, 0xc1, 0xbd, 0xd8, 0xbf, 0x29, 0xa8, 0xa4, 0x7e, 0xa5,
-  0xb0, 0x02, 0xf0, 0xa6, 0xa8, 0x12, 0x0b, 0x26, 0xda, 0x2c, 0x54, 0x5c,
-  0x7e, 0x3c, 0xd8, 0x71, 0x05, 0x65, 0x1d, 0xd2, 0xf4, 0x5f, 0x43, 0x1b,
-  0xdf, 0x62, 0xbb, 0x48, 0x31, 0x12, 0x29, 0x7a, 0xd4, 0x7a, 0x12, 0x81,
-  0xb5, 0xb9, 0x87, 0x28, 0x13, 0x3e, 0xc1, 0xa0, 0xf8, 0x04, 0x03, 0xcb,
-  0x34, 0xf8, 0x23, 0x0c, 0xd2, 0x8d, 0x66, 0x60, 0x67, 0x18, 0xd4, 0x9e,
-  0x5d, 0xc4, 0x60, 0x7e, 0xa3, 0xd6, 0x20, 0x23, 0x61, 0x10, 0xf9, 0xa3,
-  0xf1, 0x5f, 0xc4, 0x0e, 0x76, 0x93, 0x0e, 0xa1, 0xdb, 0x7b, 0x3d, 0x7b,
-  0x02, 0x33, 0x2a, 0x9b, 0x18, 0xf6, 0xb8, 0xb0, 0xfb, 0x2f, 0x20, 0x10,
-  0x0d, 0x40, 0x6e, 0xe7, 0xae, 0xd3, 0x5c, 0x7d, 0x70, 0x24, 0xb7, 0x71,
-  0x70, 0x87, 0x7d, 0x2f, 0x24, 0x25, 0x5a, 0x66, 0x9a, 0x70, 0xc6, 0x23,
-  0x3d, 0x60, 0x23, 0x20, 0x6c, 0x56, 0x5c, 0x1a, 0x04, 0x30, 0x02, 0x6a,
-  0xb9, 0x8c, 0xa2, 0x50, 0xff, 0x10, 0xa0, 0x60, 0x96, 0x17, 0xc1, 0x45,
-  0x92, 0xff, 0x1c, 0x9c, 0x21, 0x92, 0x2d, 0x94, 0x24, 0x90, 0x91, 0x52,
-  0xfb, 0xae, 0xc0, 0x7d, 0x8d, 0xff, 0x49, 0x4f, 0x75, 0xf6, 0x5d, 0x17,
-  0xfb, 0x9b, 0x6f, 0x87, 0x7b, 0x7a, 0x4e, 0x47, 0x44, 0x5d, 0x88, 0xd8,
-  0x88, 0xa8, 0x0b, 0x11, 0x1f, 0x11, 0x75, 0x20, 0xa2, 0x91, 0x0c, 0x5d,
-  0x0b, 0xff, 0xe4, 0x45, 0x5d, 0x70, 0x6c, 0x15, 0x17, 0x7c, 0xb6, 0x4f,
-  0x20, 0xc1, 0x29, 0xee, 0xdb, 0xa1, 0x1f, 0x3a, 0x00, 0x48, 0xe2, 0x26,
-  0x33, 0xf8, 0x33, 0x07, 0x26, 0x08, 0xbd, 0xe3, 0x42, 0x55, 0x62, 0xf8,
-  0x20, 0x44, 0xc7, 0xd5, 0x6c, 0xa1, 0x0d, 0xa7, 0xa6, 0xcf, 0xf1, 0x3a,
-  0xf6, 0x4c, 0x6a, 0x37, 0xc3, 0xea, 0x3a, 0x74, 0x0e, 0x97, 0x92, 0x8e,
-  0xe1, 0xee, 0x5f, 0xd1, 0x3b, 0x3e, 0x94, 0xbf, 0x85, 0xea, 0x21, 0x86,
-  0x3f, 0x76, 0xf9, 0xc8, 0x01, 0x0b, 0x3b, 0x6d, 0x28, 0x3a, 0xd9, 0x7c,
-  0xe1, 0x03, 0xb6, 0x84, 0x19, 0xd0, 0xe8, 0xa0, 0x06, 0x0c, 0x4c, 0xb8,
-  0x6d, 0xd5, 0x87, 0x67, 0x52, 0xec, 0x3d, 0x5e, 0x18, 0x48, 0xb0, 0x3f,
-  0x24, 0xd9, 0x01, 0xaf, 0x4f, 0x68, 0xcf, 0xd4, 0x8b, 0x0c, 0x21, 0xf8,
-  0x9b, 0x8f, 0x97, 0x4c, 0x92, 0x8c, 0x3a, 0xe3, 0x8e, 0x06, 0x45, 0xd7,
-  0x6f, 0xc3, 0x25, 0x23, 0xda, 0x74, 0xc6, 0x4d, 0x66, 0x88, 0x3b, 0x23,
-  0x84, 0x48, 0xd2, 0x96, 0x55, 0x71, 0x34, 0x38, 0x74, 0xbb, 0x29, 0x0e,
-  0xce, 0xe6, 0xd7, 0xab, 0x31, 0x4c, 0xb6, 0x04, 0xb5, 0x75, 0x96, 0x8d,
-  0xa0, 0x68, 0x97, 0xcb, 0x5c, 0x47, 0x2e, 0xb9, 0x09, 0x25, 0x84, 0x52,
-  0x4b, 0x28, 0x21, 0x24, 0xbe, 0x27, 0x94, 0x10, 0x0a, 0x15, 0xa1, 0x84,
-  0x90, 0xf0, 0x69, 0xdc, 0x50, 0x42, 0x99, 0x73, 0xd4, 0x7f, 0xcc, 0xd7,
-  0xd9, 0x42, 0xad, 0x35, 0x3e, 0xe7, 0x3e, 0xfc, 0x7b, 0x13, 0xff, 0x7b,
-  0x5b, 0x22, 0xd0, 0xcd, 0x1b, 0x62, 0x14, 0x1c, 0x8f, 0x94, 0x00, 0x88,
-  0xdc, 0x81, 0xd2, 0x48, 0x29, 0xdc, 0x81, 0xd2, 0x48, 0x89, 0x74, 0x50,
-  0xfa, 0x92, 0x15, 0x3a, 0x7d, 0x49, 0xa4, 0x16, 0xd9, 0x6a, 0x4a, 0x6e,
-  0x3d, 0x45, 0xf9, 0xb7, 0x2b, 0x95, 0xa6, 0x73, 0x5d, 0xbe, 0x73, 0xf3,
-  0x4e, 0x6f, 0xdf, 0xc5, 0xb3, 0xb1, 0x84, 0x50, 0x76, 0xb3, 0x9c, 0xeb,
-  0xd5, 0x1e, 0x16, 0xf1, 0x83, 0x0d, 0xad, 0xa0, 0x6c, 0x67, 0x44, 0xe3,
-  0xdc, 0x64, 0x07, 0x07, 0xcb, 0x3d, 0x3d, 0x59, 0x3d, 0x3d, 0x49, 0xfc,
-  0x7c, 0xd3, 0x93, 0x50, 0xe2, 0xc2, 0x59, 0x06, 0x19, 0x04, 0x1f, 0x97,
-  0xba, 0xde, 0xab, 0x0d, 0x51, 0xf7, 0x84, 0x1b, 0x16, 0xc0, 0x08, 0xab,
-  0x15, 0x96, 0x82, 0xea, 0x8d, 0x51, 0x46, 0x6b, 0x54, 0x35, 0xac, 0xff,
-  0x68, 0xcc, 0x67, 0xff, 0x27, 0xe2, 0xbd, 0xc6, 0x1b, 0x01, 0x79, 0x91,
-  0xe3, 0xc5, 0x86, 0x30, 0xaa, 0x4f, 0xe6, 0xf0, 0x78, 0x03, 0xfa, 0x92,
-  0xee, 0x1c, 0x6c, 0x69, 0x12, 0x6d, 0x62, 0x9b, 0x18, 0x90, 0x96, 0x11,
-  0xc3, 0xaf, 0xb9, 0xfd, 0xa3, 0xbb, 0x5e, 0xea, 0x18, 0x8d, 0x00, 0x37,
-  0xe1, 0x83, 0xbc, 0x25, 0x31, 0xec, 0x81, 0x09, 0xd1, 0xd0, 0x9e, 0xa3,
-  0x69, 0x71, 0xfd, 0x33, 0x38, 0x55, 0x0b, 0x7d, 0xa5, 0x52, 0x67, 0xa2,
-  0x53, 0x7f, 0xf3, 0x85, 0xe3, 0xcb, 0x08, 0xa0, 0xec, 0x1a, 0xef, 0x00,
-  0x33, 0xe2, 0x11, 0xe6, 0xb0, 0x53, 0xe6, 0x94, 0x9c, 0x81, 0x2e, 0x9f,
-  0x51, 0x04, 0xa4, 0xc9, 0x67, 0xb6, 0xd6, 0xc5, 0xe5, 0x3c, 0xff, 0x11,
-  0xbc, 0xd1, 0xf3, 0xeb, 0x9f, 0x3a, 0xf8, 0x90, 0x2d, 0xd7, 0x7a, 0x99,
-  0xe6, 0xc1, 0xe4, 0x47, 0xb6, 0x9e, 0x7e, 0x0d, 0x8e, 0xf3, 0xe5, 0xba,
-  0xc8, 0xe7, 0x73, 0x5d, 0x3c, 0x3f, 0x3d, 0xec, 0x78, 0x10, 0xf6, 0x5c,
-  0x1c, 0x59, 0x6c, 0xed, 0x3f, 0x67, 0x88, 0xe3, 0x59, 0x91, 0xad, 0x16,
-  0xea, 0x76, 0x00, 0x08, 0xdd, 0x10, 0xe3, 0x1a, 0x31, 0x2e, 0xc2, 0x80,
-  0xee, 0x80, 0x2b, 0x00, 0x1e, 0xbd, 0x02, 0x08, 0x5f, 0x7d, 0x38, 0x1a,
-  0x3a, 0x39, 0x4b, 0x0c, 0x00, 0x4f, 0xd8, 0xca, 0x3d, 0x63, 0x12, 0x46,
-  0x3d, 0xc3, 0x7a, 0x56, 0x22, 0x93, 0x98, 0x96, 0x75, 0x66, 0x47, 0x5a,
-  0xd6, 0xd9, 0x8f, 0x28, 0x40, 0x73, 0x31, 0xf8, 0x96, 0xdd, 0x8e, 0xe2,
-  0x2a, 0x38, 0xbe, 0x5e, 0xad, 0xf3, 0xc5, 0x2a, 0x38, 0x9b, 0x30, 0xf9,
-  0x30, 0x3b, 0x98, 0xd0, 0xfe, 0x98, 0x9e, 0x3e, 0x57, 0x38, 0x9c, 0x12,
-  0x7b, 0x49, 0x27, 0x8d, 0xd0, 0x46, 0xc8, 0x79, 0xa6, 0x97, 0x3f, 0x54,
-  0xa1, 0x83, 0x37, 0xd7, 0x6a, 0x1e, 0x1c, 0xe7, 0x8b, 0x2b, 0xb5, 0xce,
-  0x92, 0xb9, 0xbe, 0xf3, 0x12, 0x82, 0xb3, 0xb9, 0xba, 0x99, 0xac, 0xd5,
-  0x3a, 0xcb, 0x97, 0xfb, 0x5c, 0xfb, 0x9e, 0xc1, 0x5f, 0x40, 0x2a, 0x42,
-  0xbb, 0xe9, 0xd5, 0xbe, 0x22, 0x8f, 0x4d, 0x7e, 0x2a, 0x05, 0x6e, 0xd3,
-  0xc7, 0x2b, 0x7a, 0x0b, 0xf5, 0xdf, 0x5b, 0x32, 0x6f, 0xb3, 0x02, 0xcf,
-  0xa4, 0x3d, 0x6d, 0x0c, 0xc3, 0x3d, 0x1d, 0x4a, 0x10, 0xfa, 0xcb, 0x0f,
-  0x1f, 0x2c, 0x34, 0x12, 0x03, 0xaf, 0xe7, 0x55, 0x0d, 0xed, 0xf7, 0xeb,
-  0xa5, 0xfa, 0xe5, 0xe6, 0x07, 0x29, 0x97, 0x62, 0xed, 0xc8, 0xe2, 0x4e,
-  0x2d, 0xeb, 0x26, 0xe6, 0xb5, 0x23, 0x09, 0x0d, 0x20, 0x0b, 0x0c, 0xc0,
-  0x0f, 0x58, 0xfc, 0x58, 0x25, 0x83, 0x6d, 0xc4, 0xc2, 0xdd, 0x75, 0xac,
-  0x63, 0x5e, 0x46, 0x3e, 0x2a, 0x26, 0x77, 0xb0, 0xdc, 0x61, 0x5c, 0x3d,
-  0x19, 0x90, 0xa8, 0xa9, 0x61, 0xc5, 0x54, 0xa5, 0x3a, 0x78, 0x7b, 0xff,
-  0x8f, 0x07, 0x6f, 0x19, 0xc0, 0x13, 0x7a, 0xec, 0x3e, 0x16, 0xab, 0xbf,
-  0x31, 0x57, 0x0c, 0xa6, 0xe5, 0x93, 0x86, 0x78, 0xc5, 0x5a, 0xad, 0x8b,
-  0x3c, 0x38, 0xce, 0xd6, 0x37, 0xc1, 0xfb, 0x6c, 0x99, 0xa1, 0x50, 0x5b,
-  0xbf, 0x4a, 0x16, 0x78, 0xc4, 0xf8, 0x52, 0x5b, 0xd4, 0x23, 0xae, 0x43,
-  0x6d, 0x3b, 0x47, 0x1c, 0xf9, 0x8e, 0x18, 0xa3, 0xec, 0x39, 0x30, 0x3c,
-  0xe7, 0x40, 0x40, 0x62, 0xcc, 0x55, 0x75, 0x3e, 0x74, 0x6f, 0xd9, 0x27,
-  0x7f, 0x4c, 0xec, 0x46, 0x79, 0x6f, 0x33, 0x4d, 0xf6, 0x9a, 0x68, 0xfb,
-  0x9c, 0x5e, 0x04, 0x1c, 0xf3, 0xab, 0x0b, 0x0e, 0x07, 0x18, 0xe1, 0x00,
-  0x43, 0x70, 0x44, 0x18, 0x5b, 0x95, 0xae, 0xe1, 0x7c, 0xfa, 0x78, 0x1a,
-  0xfc, 0xeb, 0x7a, 0xa9, 0xb2, 0x80, 0xbd, 0xc0, 0x2b, 0x0a, 0xb6, 0x71,
-  0x45, 0x21, 0x68, 0x7d, 0x45, 0x21, 0xd8, 0x2f, 0x3c, 0x48, 0x46, 0x18,
-  0xa5, 0xb5, 0xe6, 0x87, 0x83, 0x91, 0x92, 0x1a, 0x23, 0xdd, 0xc0, 0x48,
-  0x7f, 0x21, 0x46, 0x66, 0x29, 0x32, 0x6a, 0x2d, 0xab, 0xfd, 0x55, 0x18,
-  0xd7, 0xaa, 0xc8, 0x82, 0xe3, 0xb9, 0x5a, 0xad, 0xb6, 0x9f, 0xc1, 0xd0,
-  0x47, 0xd2, 0xe4, 0x76, 0x9c, 0x6c, 0xa7, 0xc1, 0x99, 0x07, 0x79, 0xfe,
-  0xc1, 0x09, 0x7f, 0x72, 0xcf, 0x3e, 0x38, 0xce, 0x5f, 0x30, 0x39, 0x2e,
-  0x81, 0xbc, 0x3c, 0x9d, 0xa3, 0xee, 0xcf, 0xfa, 0xab, 0xdd, 0x68, 0xd9,
-  0x73, 0x01, 0x0b, 0x7d, 0x4c, 0x46, 0xd4, 0xb9, 0x7e, 0x61, 0x40, 0x78,
-  0x52, 0x0e, 0xe0, 0x5c, 0xa8, 0x32, 0xa9, 0xd4, 0xad, 0xde, 0xfe, 0x1a,
-  0x34, 0x02, 0xe2, 0x62, 0xbb, 0x06, 0x8d, 0x80, 0xe4, 0x08, 0x68, 0x3b,
-  0xa0, 0xb0, 0x01, 0xe8, 0xf3, 0xf1, 0x24, 0x78, 0x9f, 0xa7, 0xba, 0x58,
-  0x3e, 0xb7, 0xbd, 0xfe, 0xad, 0xb7, 0xc1, 0x7e, 0xd5, 0xdf, 0x62, 0x4f,
-  0x25, 0xad, 0x0e, 0xd2, 0x92, 0xa8, 0xb9, 0xe3, 0x78, 0xfd, 0xe6, 0x28,
-  0x78, 0xff, 0xf1, 0xf4, 0x28, 0xb8, 0x38, 0x13, 0x17, 0x26, 0x56, 0x7e,
-  0xb8, 0x31, 0x64, 0xa9, 0x34, 0x3a, 0xa5, 0xc2, 0x87, 0x98, 0xce, 0x26,
-  0xbc, 0x3a, 0x16, 0x7a, 0xae, 0xfb, 0x6f, 0xf7, 0x91, 0xe3, 0x1e, 0x4e,
-  0x1a, 0xbd, 0x2a, 0x87, 0x52, 0x42, 0xcc, 0x09, 0x1a, 0x69, 0x22, 0xd2,
-  0x24, 0x38, 0x3d, 0x26, 0x40, 0x36, 0xaf, 0x1f, 0xc9, 0xdf, 0x81, 0xa1,
-  0x83, 0x99, 0xc3, 0x38, 0xf1, 0x47, 0x5a, 0xe4, 0x73, 0x60, 0x35, 0x65,
-  0xfe, 0x84, 0x86, 0x3b, 0xe5, 0x70, 0x5b, 0x22, 0x60, 0xc0, 0x10, 0x2d,
-  0x7b, 0x3d, 0x3b, 0xd4, 0x5b, 0xc6, 0x64, 0x5a, 0x91, 0xe1, 0xa9, 0x80,
-  0xa6, 0x42, 0x9d, 0xbc, 0x3b, 0xff, 0xf8, 0xe1, 0x34, 0x38, 0x22, 0xe7,
-  0x34, 0x78, 0xfd, 0xf6, 0xfd, 0x1e, 0xf5, 0xe8, 0x70, 0xba, 0x13, 0x89,
-  0x26, 0x24, 0x00, 0x61, 0x28, 0x01, 0x18, 0x48, 0xe7, 0x1f, 0xcf, 0x82,
-  0xa3, 0x0b, 0x32, 0x58, 0x42, 0x48, 0x8d, 0x24, 0x27, 0x14, 0xd9, 0xa5,
-  0x75, 0x7e, 0x85, 0xdc, 0xa4, 0x7e, 0x06, 0xdb, 0x30, 0x62, 0x70, 0x60,
-  0xa6, 0x5b, 0x26, 0x84, 0x9b, 0xcb, 0x5a, 0xb4, 0xfe, 0x67, 0x97, 0x89,
-  0x5e, 0xf6, 0x5e, 0xf5, 0x0f, 0x2c, 0xd6, 0x8d, 0x50, 0x73, 0xf5, 0x02,
-  0xa0, 0x9b, 0x38, 0x8a, 0x3c, 0xff, 0x16, 0xbc, 0x57, 0x45, 0x19, 0xd9,
-  0xc0, 0x91, 0xea, 0x0c, 0xcc, 0x2f, 0xc2, 0xac, 0xc8, 0xf3, 0xb3, 0x3a,
-  0x14, 0xbd, 0x9a, 0x85, 0x4e, 0x56, 0x7f, 0x2c, 0xcb, 0xc2, 0x61, 0x2b,
-  0x35, 0xaf, 0xdc, 0xed, 0x6c, 0x79, 0x19, 0xbc, 0xce, 0x55, 0x91, 0x3e,
-  0x17, 0x30, 0x5f, 0x3c, 0x3e, 0x28, 0x74, 0x64, 0x8c, 0x32, 0x88, 0xa8,
-  0x62, 0x63, 0x50, 0x1c, 0x67, 0xa9, 0xfe, 0x96, 0x07, 0x47, 0xff, 0x82,
-  0x28, 0x19, 0x9a, 0x07, 0x0d, 0x49, 0xe5, 0x13, 0x32, 0x26, 0x45, 0xe3,
-  0x62, 0xa7, 0x0c, 0x31, 0xd2, 0xeb, 0xac, 0x0c, 0x29, 0x72, 0x66, 0x51,
-  0xb8, 0x9c, 0xb5, 0xce, 0xe3, 0x5e, 0x2a, 0x2b, 0x63, 0x1f, 0xdd, 0xfe,
-  0x9a, 0xff, 0xda, 0x4d, 0xa2, 0x8b, 0xe0, 0x54, 0xa5, 0x97, 0x7a, 0x7d,
-  0x77, 0x65, 0x79, 0x7c, 0x9d, 0xb8, 0x63, 0x75, 0x3c, 0x3f, 0x87, 0x77,
-  0xc5, 0x78, 0xb9, 0x4b, 0x89, 0xf8, 0x3f, 0x7d, 0x7c, 0x4a, 0xc5, 0xaa,
-  0x60, 0x2e, 0x4a, 0x67, 0xd2, 0x4e, 0x41, 0x2b, 0x74, 0x5e, 0x5c, 0x06,
-  0x9f, 0x59, 0xf0, 0xe9, 0x7a, 0x91, 0xcc, 0xf5, 0xf3, 0x4c, 0xba, 0xdf,
-  0xfa, 0x9b, 0xf4, 0x57, 0x8a, 0x39, 0x28, 0x71, 0xaf, 0xc8, 0xb7, 0x98,
-  0xa4, 0x46, 0x1f, 0x58, 0x23, 0xf2, 0xed, 0x2e, 0xde, 0xed, 0x75, 0xfe,
-  0x33, 0xf8, 0x92, 0xd5, 0x97, 0x15, 0xa6, 0x43, 0xe8, 0xde, 0xbc, 0x27,
-  0x02, 0xdb, 0x9b, 0x9f, 0x70, 0xff, 0x5a, 0xe1, 0xa2, 0xe7, 0xcc, 0xac,
-  0xc3, 0x43, 0x01, 0x48, 0xc3, 0x5c, 0x9d, 0x1c, 0x05, 0x93, 0xab, 0xbc,
-  0x58, 0xdf, 0x85, 0x3a, 0x8e, 0x8b, 0x1c, 0x00, 0x4c, 0x09, 0x31, 0x88,
-  0xd0, 0x31, 0xc0, 0x89, 0x5a, 0xdd, 0x4c, 0xde, 0x5f, 0x0c, 0xcd, 0xa8,
-  0x53, 0x4e, 0x67, 0xe5, 0x33, 0x26, 0x60, 0x7e, 0x4d, 0x1e, 0xc1, 0xc9,
-  0xe4, 0xfd, 0xab, 0x98, 0x00, 0x19, 0x6c, 0xe8, 0xb5, 0x36, 0x7b, 0xd9,
-  0x3a, 0x2d, 0xce, 0x00, 0x9a, 0xeb, 0x69, 0xbe, 0x08, 0xfe, 0x60, 0x92,
-  0xb0, 0xf7, 0xf7, 0x6a, 0xc3, 0xf6, 0xbb, 0x83, 0xc5, 0x7c, 0xa2, 0x9e,
-  0x0a, 0x14, 0xfb, 0x36, 0xc7, 0x33, 0x13, 0x8a, 0x74, 0xf3, 0x09, 0xdd,
-  0x7c, 0xbe, 0x00, 0xf9, 0x03, 0xd3, 0xe9, 0x3d, 0xa9, 0xfc, 0x29, 0x78,
-  0xcf, 0x9b, 0x0e, 0xb1, 0xc3, 0x14, 0xb8, 0xd9, 0xb7, 0x63, 0xb1, 0xb3,
-  0x45, 0xb6, 0x54, 0xeb, 0xbc, 0x08, 0xee, 0x82, 0xf3, 0x27, 0x5f, 0xf3,
-  0xe9, 0xb7, 0x07, 0xf6, 0x36, 0xae, 0xe3, 0xf6, 0x58, 0x1d, 0xb7, 0x27,
-  0x36, 0xe2, 0xf6, 0x84, 0x8d, 0xdb, 0x63, 0x4f, 0x28, 0x3c, 0x7f, 0x18,
-  0x3d, 0x1d, 0xed, 0x60, 0x44, 0x39, 0x33, 0x21, 0x3e, 0x0c, 0x1b, 0x8d,
-  0xf7, 0x93, 0xd2, 0x03, 0x4c, 0xaf, 0xa7, 0x95, 0x33, 0x38, 0xa1, 0xdd,
-  0xeb, 0x6f, 0x42, 0x78, 0x5d, 0xc7, 0xa6, 0x26, 0x90, 0x10, 0x56, 0x11,
-  0xe8, 0x3a, 0xd3, 0x01, 0xff, 0xf5, 0xb7, 0xd5, 0xa6, 0xa2, 0xe5, 0x58,
-  0x60, 0x3c, 0x7e, 0xcb, 0x71, 0xc4, 0x51, 0x32, 0xda, 0x5b, 0x35, 0xd5,
-  0xf9, 0x6c, 0x36, 0xa6, 0xa2, 0x79, 0xa5, 0xf4, 0x91, 0xad, 0x14, 0x4b,
-  0x7d, 0x1b, 0x49, 0xee, 0x46, 0x12, 0xdc, 0x24, 0x47, 0x84, 0x5b, 0x11,
-  0x0a, 0x60, 0x32, 0x12, 0xe6, 0x42, 0x9b, 0x1a, 0x84, 0x60, 0x11, 0x66,
-  0xcb, 0xf2, 0x44, 0x44, 0x2d, 0xd7, 0x6a, 0x75, 0x13, 0x5c, 0xbc, 0xfb,
-  0x1c, 0x7c, 0x5c, 0xce, 0x33, 0x9c, 0x86, 0x35, 0xa8, 0xf3, 0xc9, 0x84,
-  0xdb, 0xf4, 0x10, 0xca, 0x9b, 0xea, 0x36, 0xbf, 0x49, 0xb3, 0xcb, 0x2c,
-  0xf8, 0xac, 0x52, 0x5d, 0xe0, 0xcc, 0xf1, 0xbd, 0x57, 0x8e, 0xa1, 0xbb,
-  0xa7, 0x39, 0xf0, 0x3a, 0xea, 0x73, 0x33, 0x76, 0xd6, 0xbc, 0xb2, 0xdb,
-  0xff, 0x87, 0x34, 0xef, 0xfc, 0xf6, 0x3d, 0xec, 0x58, 0x4f, 0xd8, 0x1e,
-  0x6f, 0xe3, 0x10, 0x51, 0x7a, 0x20, 0x44, 0x69, 0x0d, 0x94, 0xc8, 0x9a,
-  0x28, 0x09, 0x37, 0x90, 0xf2, 0x0d, 0xa4, 0xe2, 0xe9, 0x91, 0xe2, 0x92,
-  0xd5, 0xa2, 0xca, 0x65, 0xe2, 0x0d, 0x07, 0x66, 0xbf, 0x48, 0x51, 0x39,
-  0xd0, 0xc1, 0xa8, 0x6b, 0xa8, 0x2b, 0xca, 0x2c, 0xb4, 0x7f, 0x31, 0x6c,
-  0xed, 0x69, 0x5d, 0xed, 0x14, 0xe2, 0xa3, 0xba, 0x24, 0xae, 0x7d, 0x41,
-  0xd8, 0xf0, 0x05, 0x89, 0xf1, 0x05, 0x23, 0xef, 0xfd, 0xa1, 0xdc, 0x57,
-  0x88, 0x13, 0xb1, 0xd1, 0xec, 0x0c, 0x3d, 0x29, 0xb0, 0x7b, 0xe9, 0xde,
-  0xe6, 0xc5, 0xd4, 0x69, 0xfb, 0xe1, 0xa1, 0xdb, 0x4b, 0x6a, 0x51, 0xa9,
-  0xcb, 0xed, 0x85, 0xfb, 0x75, 0x53, 0x6e, 0x5d, 0x01, 0xda, 0x36, 0x04,
-  0xc4, 0x32, 0x81, 0x8e, 0x15, 0x40, 0x78, 0x66, 0x57, 0x76, 0x1f, 0x63,
-  0x4e, 0x2b, 0x05, 0x10, 0x09, 0x88, 0x7a, 0xb5, 0x34, 0x88, 0x26, 0x59,
-  0x11, 0x9c, 0xb2, 0x1f, 0xfb, 0x3b, 0x90, 0xa3, 0x07, 0x76, 0xe4, 0x82,
-  0xef, 0xc4, 0x09, 0x71, 0xd3, 0xe9, 0x6f, 0xc9, 0x0f, 0x2a, 0xe2, 0x44,
-  0x44, 0x15, 0x8d, 0x04, 0xa4, 0x5b, 0x67, 0xf8, 0x9e, 0x4a, 0x34, 0x1d,
-  0x58, 0x08, 0x85, 0x9d, 0x4c, 0x34, 0x05, 0x6a, 0x00, 0x61, 0x30, 0x7b,
-  0x8c, 0x0e, 0x64, 0xec, 0xd0, 0x14, 0xc7, 0xf2, 0x09, 0x15, 0xb4, 0x4c,
-  0x27, 0x71, 0x38, 0xf1, 0x25, 0xf2, 0xc9, 0xe2, 0x4b, 0x84, 0x14, 0xd2,
-  0x89, 0xe7, 0x9c, 0xff, 0x18, 0xee, 0x75, 0x80, 0x55, 0x1e, 0xa2, 0xc0,
-  0x49, 0xe7, 0xd5, 0x39, 0x0b, 0xe8, 0xdf, 0x81, 0xee, 0x51, 0x83, 0xc4,
-  0xa1, 0x55, 0x86, 0xe3, 0xa1, 0x60, 0x14, 0x78, 0x28, 0x89, 0x4c, 0xa5,
-  0x08, 0x41, 0x12, 0xc9, 0x6b, 0x46, 0xeb, 0xfc, 0xca, 0x9d, 0x38, 0x7a,
-  0xe0, 0x1b, 0x5d, 0x8f, 0xaa, 0x2c, 0x40, 0x50, 0x7a, 0x7f, 0xc9, 0x63,
-  0x55, 0x82, 0xf9, 0x3d, 0xbf, 0xcc, 0xa6, 0x6c, 0x2c, 0xc9, 0x02, 0x91,
-  0x45, 0x15, 0x01, 0xa0, 0xd5, 0x7d, 0x95, 0xa9, 0x46, 0x51, 0x12, 0xa3,
-  0x4c, 0x43, 0xbb, 0x88, 0xe3, 0x82, 0x98, 0x37, 0x82, 0x08, 0xe9, 0x65,
-  0x76, 0xbd, 0x0a, 0xde, 0xab, 0x9f, 0xb3, 0xb2, 0x28, 0xc9, 0x69, 0xa1,
-  0x96, 0x69, 0xa6, 0x56, 0x01, 0xa1, 0x43, 0x99, 0x6f, 0x24, 0x36, 0x88,
-  0x12, 0x5e, 0xab, 0x4f, 0x63, 0xbe, 0x7d, 0x7c, 0x75, 0x94, 0x7e, 0x57,
-  0xcb, 0xf6, 0xad, 0x17, 0xaa, 0x9d, 0x1f, 0x5a, 0x38, 0x49, 0x8d, 0x26,
-  0x89, 0xcd, 0xc6, 0x4b, 0x6e, 0xbf, 0x70, 0x21, 0xd4, 0xff, 0xc6, 0x85,
-  0xd4, 0x16, 0x57, 0x3c, 0x46, 0x50, 0xe2, 0x27, 0x28, 0xf5, 0xd9, 0x4e,
-  0xb7, 0x6b, 0x00, 0x43, 0x82, 0x73, 0x6f, 0x15, 0x90, 0x98, 0x83, 0xb8,
-  0xe7, 0x10, 0xfa, 0x71, 0x20, 0xf8, 0x83, 0x4f, 0xae, 0xaf, 0x74, 0xb1,
-  0x27, 0x0a, 0xbd, 0x36, 0xda, 0x1e, 0x38, 0xbc, 0x6e, 0x21, 0x09, 0xdb,
-  0xc1, 0xae, 0xce, 0x80, 0x8a, 0x2a, 0xac, 0x21, 0x62, 0x4d, 0xab, 0x91,
-  0xe7, 0x69, 0xa2, 0xd7, 0x6b, 0x5d, 0x24, 0x7a, 0xb5, 0x1e, 0x43, 0x3f,
-  0x36, 0x8a, 0xcb, 0xa4, 0x9c, 0x44, 0x4d, 0x6d, 0x3a, 0x7b, 0x13, 0x7c,
-  0xc9, 0x96, 0x01, 0x1d, 0x17, 0xea, 0xfa, 0x5e, 0x5b, 0x70, 0x64, 0x63,
-  0x0b, 0xf5, 0x3d, 0x5b, 0x05, 0xf5, 0xf5, 0x76, 0xa3, 0x13, 0x10, 0x7d,
-  0x4c, 0x3d, 0x9a, 0x5f, 0x58, 0x2d, 0x8d, 0x46, 0x46, 0x2c, 0xe2, 0x16,
-  0xab, 0x74, 0x3a, 0xce, 0x54, 0x7a, 0x18, 0x32, 0x61, 0x9f, 0x4a, 0x12,
-  0x2c, 0x93, 0xd6, 0xcb, 0xa3, 0xd2, 0xaf, 0x2a, 0x63, 0x30, 0xd6, 0x45,
-  0xbe, 0xcc, 0xa6, 0xab, 0x5e, 0x99, 0x04, 0x1e, 0x47, 0x28, 0x71, 0xdf,
-  0xeb, 0x78, 0x40, 0x4c, 0x5c, 0x2a, 0x4d, 0x1d, 0x1b, 0x18, 0xe8, 0x04,
-  0x45, 0xe8, 0x3d, 0x25, 0x0c, 0xea, 0x9f, 0xf9, 0xcd, 0xdd, 0xbf, 0xff,
-  0x4b, 0x5d, 0x2a, 0xd1, 0xcd, 0x46, 0x22, 0x9b, 0xb8, 0xa7, 0x93, 0x5a,
-  0xb4, 0xb7, 0x93, 0x8e, 0xbd, 0xdd, 0x24, 0xb8, 0xc4, 0xbb, 0xba, 0x7e,
-  0x16, 0xf0, 0x00, 0xb6, 0x75, 0x68, 0x4d, 0x65, 0x78, 0x4d, 0x3d, 0x0f,
-  0x3e, 0x5f, 0xd0, 0xc1, 0x6c, 0x4c, 0x64, 0x85, 0x43, 0xa5, 0xa9, 0x2e,
-  0x9f, 0x7a, 0x96, 0x54, 0xe6, 0x86, 0x1a, 0x1c, 0xff, 0xc8, 0xd2, 0x22,
-  0x5f, 0x94, 0xce, 0x68, 0x31, 0x2e, 0x9c, 0x90, 0x46, 0x66, 0x69, 0x89,
-  0xa4, 0xcd, 0xe3, 0xb2, 0x98, 0xd6, 0x65, 0x4c, 0x72, 0x19, 0x80, 0x7b,
-  0x76, 0x1c, 0x1c, 0x2d, 0xd5, 0x3c, 0xbf, 0xbc, 0x4b, 0x82, 0xef, 0xb7,
-  0xd0, 0x18, 0x4a, 0xf1, 0xbe, 0x56, 0x1c, 0x42, 0x77, 0x89, 0x9e, 0x8d,
-  0x09, 0xa9, 0xa6, 0x88, 0x10, 0x4d, 0x21, 0xff, 0x79, 0x3c, 0xd8, 0x53,
-  0x20, 0x56, 0x99, 0x0b, 0x2a, 0xeb, 0xcb, 0x2e, 0xc3, 0xe4, 0xcd, 0xc5,
-  0x73, 0xe5, 0x10, 0xf3, 0xde, 0xe7, 0x86, 0xa2, 0xf7, 0xc9, 0x33, 0xa4,
-  0x30, 0x33, 0x4f, 0xf3, 0xb3, 0x60, 0xf2, 0x22, 0xbb, 0x07, 0x23, 0xf7,
-  0x1d, 0x8f, 0xcf, 0x90, 0xa0, 0xc8, 0xa9, 0x22, 0xf8, 0x76, 0xd7, 0x3d,
-  0x68, 0x69, 0x06, 0x4d, 0x37, 0x07, 0x1d, 0x9c, 0xbc, 0x39, 0x3d, 0x09,
-  0xd8, 0xf3, 0x04, 0x43, 0xff, 0xd6, 0xdf, 0xca, 0xfd, 0xd6, 0xdf, 0xcc,
-  0x59, 0x3e, 0x11, 0x47, 0x75, 0x1f, 0x4b, 0x3e, 0x75, 0x66, 0xd8, 0x71,
-  0xbe, 0x58, 0xa8, 0x65, 0x3a, 0xe4, 0xd4, 0x43, 0x4b, 0x4a, 0xcc, 0x76,
-  0x23, 0x15, 0xf0, 0x72, 0x8d, 0xd8, 0x3f, 0xaf, 0xa7, 0x0f, 0x9a, 0xf6,
-  0x47, 0xa2, 0x3d, 0x90, 0xf0, 0xa7, 0x47, 0xe2, 0xad, 0x34, 0x4f, 0xa0,
-  0x25, 0xf6, 0xac, 0x2f, 0x06, 0xbe, 0x15, 0xc9, 0xc7, 0xe3, 0xf3, 0xa3,
-  0xfb, 0x62, 0xef, 0x83, 0x73, 0xb6, 0xb0, 0x15, 0x12, 0x68, 0x47, 0xd7,
-  0x46, 0xcd, 0xcc, 0xac, 0xa1, 0x1d, 0x7c, 0x21, 0x5a, 0xd2, 0x46, 0x2c,
-  0x75, 0xd0, 0x72, 0x97, 0xf6, 0xd8, 0xe3, 0x22, 0x8d, 0x90, 0x91, 0xbe,
-  0xc8, 0xa8, 0x17, 0x32, 0x0f, 0x05, 0x63, 0xa1, 0x6d, 0xec, 0xe1, 0x44,
-  0x36, 0x29, 0xff, 0x7d, 0x5b, 0xe7, 0xd8, 0x1c, 0x3f, 0xef, 0x7d, 0x26,
-  0xa2, 0xc9, 0xd7, 0x61, 0x91, 0x44, 0x47, 0x2c, 0x9b, 0x5b, 0x33, 0x50,
-  0x15, 0x67, 0xa7, 0x98, 0x8b, 0x5b, 0x31, 0x03, 0x1e, 0xfc, 0xe5, 0x6c,
-  0xc2, 0xfe, 0x7a, 0xd8, 0x49, 0xdf, 0x1d, 0x30, 0x42, 0x2f, 0x18, 0xfc,
-  0x99, 0x60, 0x28, 0xe6, 0xeb, 0xd1, 0x3c, 0x06, 0x06, 0x01, 0x27, 0x8c,
-  0xba, 0x0e, 0xfb, 0xaf, 0xf4, 0x58, 0xf6, 0x5a, 0x72, 0x3d, 0x25, 0x26,
-  0x87, 0x69, 0x26, 0xee, 0x1e, 0x0c, 0x84, 0x53, 0xc0, 0xcf, 0x17, 0x7f,
-  0xfb, 0xad, 0xb2, 0x47, 0xe5, 0xb0, 0xab, 0xf7, 0x9b, 0x4a, 0xb6, 0x57,
-  0xf7, 0x7f, 0x8f, 0xca, 0x77, 0xf3, 0x77, 0xe2, 0x30, 0x9b, 0xd8, 0x0e,
-  0xf6, 0x10, 0xd1, 0xdf, 0x88, 0xf1, 0xd4, 0xf5, 0x0d, 0x4f, 0xf5, 0x22,
-  0x28, 0x8f, 0xbc, 0x07, 0xb9, 0x30, 0x22, 0x1d, 0x20, 0x2e, 0x1d, 0x28,
-  0xe1, 0x9c, 0x5c, 0x04, 0xe7, 0xd7, 0x45, 0x92, 0x07, 0x74, 0xe8, 0xae,
-  0x16, 0x43, 0x9d, 0xd5, 0x0c, 0xa3, 0xe3, 0xe0, 0x64, 0x79, 0x99, 0x2d,
-  0xf5, 0xdd, 0x22, 0xb8, 0xd7, 0x6b, 0x46, 0xfb, 0x1d, 0x3b, 0x47, 0x16,
-  0x53, 0x97, 0x7a, 0x9f, 0xe5, 0xdf, 0xbe, 0xe9, 0x65, 0x70, 0x9e, 0x5f,
-  0x17, 0x4b, 0xb5, 0xd0, 0xcb, 0x75, 0xf0, 0xe6, 0xc2, 0x5c, 0xef, 0xf4,
-  0x1c, 0x58, 0xff, 0x19, 0xec, 0x6f, 0x85, 0x89, 0x4b, 0xc4, 0x4f, 0x5a,
-  0xcd, 0x03, 0xd3, 0x19, 0xa3, 0x4c, 0xe1, 0x1a, 0x5d, 0x5c, 0xa0, 0xf4,
-  0xf9, 0x41, 0x3d, 0xbd, 0x3a, 0x48, 0xb5, 0x8b, 0x94, 0x7c, 0x3c, 0x7b,
-  0x91, 0xc9, 0x4e, 0xa0, 0xc6, 0x79, 0x43, 0x24, 0x98, 0xdf, 0x36, 0x50,
-  0x27, 0x17, 0x93, 0x93, 0xde, 0x7b, 0xc2, 0xe7, 0xf5, 0x85, 0xd4, 0x4e,
-  0x53, 0x67, 0x96, 0x17, 0x38, 0x21, 0x76, 0x90, 0xf9, 0x2a, 0xe8, 0xb0,
-  0xa5, 0x42, 0x46, 0xc4, 0x06, 0x3a, 0x43, 0x27, 0x98, 0x5c, 0xcd, 0xb3,
-  0x75, 0x60, 0x42, 0x28, 0x86, 0xee, 0x2b, 0x49, 0xd7, 0xf9, 0xe6, 0x95,
-  0x4a, 0xab, 0x23, 0xde, 0xd1, 0xda, 0x48, 0xb9, 0x85, 0xcf, 0xb8, 0x6c,
-  0x81, 0x6e, 0xd3, 0x9f, 0xd2, 0xc9, 0x3e, 0xfc, 0xe5, 0xaa, 0x3f, 0xa0,
-  0x29, 0x71, 0x03, 0x1a, 0xab, 0x18, 0xec, 0x36, 0xff, 0x42, 0xa8, 0x7e,
-  0x08, 0xdf, 0x20, 0xaf, 0x14, 0x44, 0x93, 0xcd, 0x4c, 0xa2, 0x84, 0x70,
-  0xc3, 0xc6, 0x68, 0x54, 0xb9, 0xbc, 0xb9, 0xa3, 0x5d, 0x0e, 0x7f, 0x2a,
-  0x7a, 0x9d, 0x90, 0x33, 0x4e, 0x14, 0x54, 0xf7, 0x9b, 0x61, 0xf3, 0x0a,
-  0xe6, 0x3a, 0xfb, 0x67, 0xa6, 0x5c, 0x95, 0x19, 0xeb, 0xb4, 0x6f, 0x3b,
-  0x15, 0x3d, 0x6a, 0x00, 0x79, 0x1b, 0xeb, 0xf6, 0xfe, 0x3a, 0xe2, 0x71,
-  0x3d, 0x63, 0x29, 0xa7, 0x95, 0x5d, 0x4e, 0x28, 0xd2, 0x90, 0x9b, 0x2b,
-  0x5d, 0x7c, 0xcb, 0x96, 0xb7, 0xf2, 0x2d, 0xb2, 0x42, 0xcd, 0x83, 0x0f,
-  0xb2, 0x51, 0x51, 0xf6, 0x37, 0xf3, 0x0f, 0x27, 0x84, 0x98, 0xf7, 0x9b,
-  0x3b, 0xd1, 0x5e, 0xd9, 0xbf, 0x47, 0xe6, 0xb5, 0xfc, 0x33, 0xbd, 0xa7,
-  0x03, 0xfd, 0x0f, 0x26, 0x7c, 0xa3, 0xf7, 0xbb, 0x0f, 0x5d, 0x2c, 0x84,
-  0xd9, 0x0c, 0x92, 0xa6, 0x05, 0x36, 0x10, 0x4a, 0xe1, 0xdd, 0x1f, 0xfa,
-  0x19, 0xea, 0x7d, 0xb9, 0xd5, 0xbb, 0x5b, 0x3a, 0xa9, 0x58, 0x64, 0xbe,
-  0x30, 0x92, 0xee, 0xbc, 0xc8, 0xf3, 0x2b, 0x67, 0x61, 0x08, 0x8e, 0x06,
-  0xbd, 0x83, 0x4d, 0xbb, 0x1f, 0x91, 0xe8, 0x1c, 0x51, 0x14, 0x99, 0x2d,
-  0xda, 0x03, 0xde, 0x17, 0xf1, 0x60, 0x6b, 0xf3, 0xcd, 0xa0, 0x7a, 0x8b,
-  0x52, 0x60, 0x0f, 0x95, 0xf1, 0x22, 0x38, 0x9e, 0x5f, 0x9b, 0x9d, 0xdb,
-  0x50, 0xfb, 0x38, 0x44, 0xe6, 0x44, 0x5b, 0x02, 0xaa, 0xce, 0x97, 0xbd,
-  0xbe, 0x9e, 0xcd, 0xd4, 0x3c, 0x0f, 0xaa, 0x3c, 0x9a, 0xb7, 0x6a, 0x91,
-  0x4d, 0xf3, 0xc5, 0xb6, 0x7c, 0x1a, 0xd9, 0x27, 0x0c, 0x1e, 0x2b, 0x86,
-  0x4f, 0x4f, 0x21, 0x19, 0x4b, 0x1e, 0x52, 0x39, 0x2b, 0x9f, 0x4c, 0x49,
-  0x76, 0xfb, 0xa6, 0x2b, 0x19, 0xd2, 0x22, 0xcf, 0xd2, 0x69, 0xbe, 0x1c,
-  0x72, 0xb1, 0x25, 0x01, 0xd5, 0xf2, 0x2b, 0x50, 0x31, 0xdc, 0x77, 0x8b,
-  0x2b, 0x35, 0x5d, 0xe3, 0xca, 0x8b, 0x07, 0x1f, 0xcf, 0xde, 0x51, 0x96,
-  0x31, 0x35, 0x79, 0x1e, 0x11, 0xad, 0x8b, 0xb4, 0x54, 0x38, 0xca, 0xca,
-  0x84, 0xc7, 0x7f, 0xc0, 0x03, 0xb5, 0xe6, 0x3e, 0x6a, 0x6d, 0xcd, 0x75,
-  0xad, 0xb5, 0x9d, 0xd5, 0xd4, 0x01, 0x87, 0xa8, 0xbc, 0x5b, 0xae, 0x75,
-  0x71, 0x34, 0x5d, 0x07, 0x47, 0x3f, 0xb3, 0xd5, 0x99, 0x4a, 0xfb, 0x97,
-  0x0e, 0x7d, 0x8e, 0x82, 0xa1, 0xe8, 0x0b, 0x79, 0x14, 0x0c, 0xd5, 0x33,
-  0x10, 0x8e, 0xe2, 0x91, 0x23, 0x98, 0x59, 0x6a, 0x75, 0x85, 0xb5, 0x80,
-  0x39, 0xcd, 0x0d, 0x16, 0x56, 0x62, 0xe1, 0xdb, 0x0b, 0x51, 0x87, 0xdd,
-  0x12, 0x51, 0x24, 0x83, 0xf0, 0x18, 0x25, 0x55, 0x54, 0xba, 0x47, 0xf9,
-  0x0f, 0xb5, 0x58, 0xe8, 0xe2, 0x1f, 0x5a, 0xa5, 0xc1, 0xdb, 0x8b, 0x7a,
-  0xb4, 0x4f, 0x51, 0xaf, 0x85, 0xf6, 0xac, 0xb7, 0x21, 0xfc, 0xcb, 0x6d,
-  0x60, 0x3c, 0x38, 0xa1, 0x26, 0x36, 0xc9, 0xab, 0x14, 0x4c, 0x6b, 0x37,
-  0x8b, 0xe7, 0x4a, 0x5f, 0xaa, 0xe0, 0xec, 0x34, 0x88, 0x41, 0xc6, 0x7b,
-  0x74, 0x49, 0xe4, 0xc1, 0x55, 0xfa, 0xb1, 0x01, 0xf3, 0xa1, 0xa8, 0x0b,
-  0xb6, 0x60, 0x44, 0x71, 0x3c, 0x98, 0x34, 0x1b, 0xac, 0x38, 0xac, 0x45,
-  0x71, 0x0c, 0x94, 0x81, 0x55, 0x3f, 0xc2, 0xf3, 0xc9, 0xfe, 0x6a, 0x2c,
-  0x84, 0x44, 0xc3, 0xab, 0x96, 0xc5, 0xc0, 0x86, 0x67, 0xa1, 0x7a, 0xa4,
-  0xff, 0xd4, 0xab, 0x55, 0x70, 0xae, 0xa7, 0x5f, 0x83, 0xb2, 0x1b, 0x82,
-  0x49, 0x37, 0x32, 0x4d, 0x23, 0x86, 0xe6, 0x0c, 0x5a, 0x48, 0x90, 0xb4,
-  0x42, 0x3a, 0x3d, 0x3d, 0x89, 0x21, 0x2e, 0xc3, 0x58, 0x3e, 0xe9, 0x69,
-  0x9e, 0xcd, 0x0f, 0xd6, 0xea, 0xb0, 0xc7, 0x95, 0xaa, 0x4e, 0x14, 0xa5,
-  0x75, 0x44, 0x70, 0xc9, 0x08, 0x23, 0x5a, 0xe6, 0xb7, 0x0a, 0x74, 0xd3,
-  0x91, 0x3d, 0xfc, 0x2c, 0x87, 0x3b, 0xfd, 0x29, 0xe0, 0x82, 0x95, 0x20,
-  0xd1, 0xc9, 0xde, 0x6d, 0x5a, 0xf0, 0xab, 0x5b, 0xc9, 0x83, 0xbf, 0xfc,
-  0xfe, 0xd7, 0xde, 0x41, 0x80, 0x84, 0x75, 0xe8, 0x06, 0x96, 0x72, 0xa7,
-  0x4e, 0xb2, 0xe2, 0xe0, 0x25, 0xc0, 0xdf, 0x20, 0x6c, 0x93, 0xe0, 0x53,
-  0x5f, 0x09, 0x3a, 0x4f, 0xd9, 0x1d, 0x9a, 0xe6, 0x91, 0x4b, 0x7d, 0xc0,
-  0x12, 0x58, 0x6b, 0x90, 0x9a, 0x14, 0x79, 0x36, 0xb5, 0x02, 0x10, 0x2b,
-  0x41, 0x79, 0x05, 0x72, 0x34, 0xbf, 0xfa, 0xaa, 0x02, 0xd3, 0xd1, 0x60,
-  0x58, 0xe7, 0x2c, 0xb6, 0x4f, 0x0a, 0xc5, 0xb1, 0xb4, 0xff, 0xfc, 0xf7,
-  0x64, 0xff, 0x3d, 0x86, 0xe8, 0x81, 0x76, 0x91, 0x89, 0xd4, 0x36, 0x3a,
-  0x46, 0x63, 0xf8, 0x2f, 0x2e, 0xc2, 0xb8, 0x7f, 0x9f, 0x15, 0x76, 0xae,
-  0x0b, 0x57, 0xd7, 0x08, 0x2e, 0x69, 0x8c, 0xe5, 0xe0, 0x2c, 0x21, 0x53,
-  0x65, 0x26, 0x25, 0x53, 0x05, 0xf6, 0x67, 0x09, 0xad, 0x75, 0x79, 0x71,
-  0xff, 0x35, 0x9b, 0xcf, 0x57, 0xeb, 0x42, 0xab, 0xc5, 0xb0, 0x4c, 0x0d,
-  0x82, 0x63, 0x26, 0xd3, 0x08, 0x07, 0xc1, 0x21, 0xf1, 0x94, 0x9a, 0x25,
-  0x0a, 0xc3, 0xc9, 0x8b, 0x74, 0xae, 0x57, 0x2b, 0xb3, 0xe9, 0x29, 0x43,
-  0xd2, 0xe8, 0x60, 0x29, 0x49, 0x37, 0x25, 0xbb, 0x3b, 0xbc, 0x6b, 0xd3,
-  0x33, 0x78, 0x38, 0xe4, 0x21, 0x9c, 0x11, 0x4e, 0x6a, 0xe0, 0x70, 0x8e,
-  0x2c, 0xf3, 0x5b, 0x46, 0x60, 0xe8, 0xeb, 0x16, 0xd1, 0x86, 0x4e, 0x4c,
-  0x31, 0x1d, 0x31, 0xd2, 0xb1, 0x74, 0x28, 0x8c, 0x74, 0xdc, 0x2b, 0x97,
-  0xdb, 0xec, 0xbc, 0x0d, 0x09, 0x0c, 0xd6, 0xde, 0xcc, 0x6c, 0x9d, 0x72,
-  0x60, 0x0f, 0xa8, 0x8c, 0x3a, 0x13, 0xb5, 0xad, 0xe3, 0xa3, 0x93, 0x03,
-  0x84, 0xb4, 0xc1, 0xf9, 0x92, 0x2d, 0x2f, 0xdf, 0xab, 0xa5, 0xc3, 0x25,
-  0x74, 0xf4, 0xa8, 0x7e, 0x9c, 0x42, 0x89, 0xed, 0x97, 0xb0, 0xb1, 0x7f,
-  0x37, 0x60, 0x02, 0xdb, 0xb4, 0x26, 0xea, 0xbc, 0x1c, 0xa8, 0xc1, 0x80,
-  0xea, 0x02, 0xe3, 0xe6, 0xd1, 0x5f, 0x77, 0x30, 0x86, 0xd0, 0xff, 0x50,
-  0x97, 0x3a, 0x29, 0x74, 0x5f, 0x18, 0xb1, 0x08, 0xc2, 0x3b, 0x08, 0x52,
-  0x54, 0x8b, 0x90, 0x30, 0xc2, 0xbf, 0x57, 0x69, 0x70, 0xac, 0xd6, 0xff,
-  0x0d, 0x8e, 0xcf, 0x3f, 0xfd, 0xfe, 0x69, 0xb8, 0x49, 0x18, 0x16, 0x50,
-  0x24, 0x98, 0xd1, 0x0e, 0x04, 0xa8, 0x4a, 0x7e, 0xbf, 0x52, 0xe9, 0x2f,
-  0xcb, 0x92, 0x14, 0x98, 0x81, 0xc4, 0x42, 0x3f, 0x46, 0x40, 0x01, 0x46,
-  0x40, 0xe2, 0x16, 0xb0, 0xca, 0x55, 0x1a, 0x6a, 0x46, 0x0e, 0x66, 0x15,
-  0xed, 0xc6, 0x6a, 0xc0, 0xd9, 0x39, 0xb6, 0x5a, 0x00, 0xd5, 0x33, 0x53,
-  0xa9, 0x09, 0x78, 0x0b, 0xab, 0xc9, 0xdb, 0x9f, 0xe7, 0xd8, 0xa4, 0xbe,
-  0x90, 0x8a, 0x30, 0x74, 0x47, 0xeb, 0x00, 0x8c, 0xb7, 0x2a, 0x84, 0x81,
-  0xfc, 0x3f, 0x5c, 0xaf, 0x0c, 0xc3, 0x88, 0x3a, 0x61, 0x1c, 0x6a, 0xa5,
-  0x32, 0x7f, 0x18, 0x9c, 0xb1, 0x4e, 0x18, 0xe7, 0x27, 0xc1, 0x64, 0xb4,
-  0xac, 0x15, 0xae, 0x68, 0x37, 0x5c, 0xc3, 0x36, 0xae, 0x16, 0x17, 0x89,
-  0xa2, 0xc8, 0xed, 0x95, 0xd8, 0x12, 0xdd, 0x83, 0xb0, 0x38, 0xec, 0x99,
-  0x31, 0x58, 0x55, 0x51, 0xf0, 0x72, 0x98, 0x10, 0xc9, 0xab, 0x27, 0x5e,
-  0x77, 0xef, 0xeb, 0xd5, 0x8d, 0x37, 0x6b, 0x1b, 0x0a, 0x54, 0xc1, 0x8a,
-  0xfd, 0x60, 0xf5, 0xd5, 0x25, 0x78, 0x86, 0x29, 0x45, 0x77, 0x73, 0xdb,
-  0x88, 0x44, 0x6e, 0xdb, 0xa8, 0x3e, 0xdd, 0x59, 0x0b, 0x50, 0xdb, 0x9f,
-  0xe5, 0x5a, 0xdd, 0x5d, 0x8c, 0xac, 0xca, 0xf0, 0x0f, 0x94, 0xff, 0x76,
-  0xe8, 0x91, 0x72, 0x1e, 0x1d, 0xcc, 0x08, 0x63, 0x80, 0x2c, 0xf3, 0xcd,
-  0x6c, 0xae, 0x56, 0x5f, 0xb7, 0x26, 0xba, 0x3a, 0x18, 0x45, 0x1b, 0x8c,
-  0xe8, 0x26, 0x23, 0x72, 0xcf, 0xa8, 0x23, 0xc2, 0x3f, 0xda, 0x4e, 0x05,
-  0x89, 0xfd, 0x27, 0x92, 0xdb, 0xb3, 0x6b, 0x0e, 0x67, 0x24, 0x72, 0xcb,
-  0x8d, 0xbb, 0x3a, 0xf7, 0x4b, 0x60, 0x7d, 0xda, 0x14, 0x5f, 0xba, 0xa3,
-  0xb0, 0xbc, 0x53, 0x58, 0x67, 0xa6, 0xdc, 0x8b, 0x4a, 0x67, 0xa6, 0xbb,
-  0x45, 0x34, 0x85, 0x76, 0xea, 0x13, 0x2c, 0xeb, 0x7b, 0x75, 0x99, 0x4d,
-  0x83, 0x0f, 0x93, 0x01, 0x44, 0xee, 0xe0, 0x16, 0x51, 0x94, 0x44, 0xdd,
-  0x4c, 0x86, 0xb9, 0xb1, 0x49, 0xa5, 0x4d, 0x25, 0x55, 0x61, 0x37, 0xa3,
-  0x21, 0xc6, 0x08, 0xce, 0x50, 0x79, 0x0d, 0x4c, 0x66, 0x32, 0xc8, 0x1a,
-  0x49, 0x78, 0x1d, 0x85, 0xb6, 0x75, 0x74, 0xa2, 0xd6, 0xd7, 0xc5, 0xb2,
-  0x5e, 0x4d, 0x2c, 0xa7, 0x7e, 0xca, 0x23, 0xd0, 0x8d, 0x44, 0xd7, 0x91,
-  0x73, 0xc3, 0x96, 0x76, 0xdd, 0xb8, 0x50, 0x01, 0x71, 0xf9, 0xd4, 0x11,
-  0x30, 0xf7, 0x97, 0xff, 0x92, 0x65, 0xc1, 0xf1, 0xed, 0xdb, 0x2a, 0x9b,
-  0x3a, 0xd6, 0xc9, 0xfd, 0x7a, 0xdd, 0xca, 0xdb, 0xeb, 0x56, 0xe2, 0x71,
-  0x11, 0xa1, 0xb4, 0xd3, 0x92, 0x82, 0x75, 0x1b, 0x9c, 0x44, 0xde, 0xe4,
-  0xf3, 0xab, 0xaf, 0xd9, 0xf2, 0xb5, 0xaa, 0x63, 0x67, 0x59, 0x5f, 0x18,
-  0xe4, 0xb9, 0x76, 0xf5, 0xa4, 0x1b, 0x06, 0x6c, 0x83, 0xf1, 0x47, 0x69,
-  0x16, 0x8c, 0x72, 0x0c, 0x37, 0x8f, 0x9d, 0x02, 0x6b, 0x9a, 0x85, 0x32,
-  0xcd, 0xeb, 0x4b, 0x5e, 0xcc, 0xd3, 0xaa, 0x9b, 0x72, 0x80, 0xe3, 0x67,
-  0x87, 0x94, 0xd1, 0x64, 0x29, 0xf1, 0x19, 0x98, 0xdf, 0xff, 0x20, 0xa5,
-  0xfe, 0xd3, 0x2d, 0x32, 0x6c, 0x24, 0xa0, 0x25, 0x26, 0x9b, 0x16, 0xb7,
-  0x54, 0xf4, 0xb7, 0xc6, 0x29, 0x1a, 0x0a, 0xd9, 0xdf, 0xba, 0xe5, 0xe2,
-  0xfe, 0xf7, 0xf9, 0xc2, 0x27, 0x90, 0x5e, 0xe8, 0xea, 0x70, 0x82, 0x5a,
-  0x11, 0x1a, 0x43, 0x5f, 0xe5, 0xb3, 0x75, 0x15, 0x9c, 0x38, 0x59, 0x17,
-  0xd9, 0x37, 0x6d, 0x92, 0xab, 0x6b, 0x23, 0xc1, 0xf7, 0x7a, 0x6b, 0x1f,
-  0xb5, 0xef, 0x26, 0xe1, 0xfe, 0xcb, 0x90, 0x3f, 0x1b, 0x55, 0x11, 0xc8,
-  0x6e, 0xf2, 0x01, 0x6b, 0x95, 0x6f, 0x92, 0xa5, 0xfa, 0x4b, 0xb6, 0x4c,
-  0x1d, 0x87, 0x30, 0xf1, 0xfe, 0xa3, 0x0c, 0x3c, 0xe2, 0x2a, 0xea, 0xc1,
-  0x87, 0x8f, 0x19, 0x7c, 0xf4, 0x74, 0x83, 0x8f, 0x7d, 0x06, 0xaf, 0x77,
-  0x18, 0x7c, 0xf0, 0xb6, 0xd0, 0x7a, 0xb5, 0xbe, 0x99, 0x6b, 0xa7, 0xab,
-  0x1a, 0xf7, 0x55, 0x33, 0xac, 0x57, 0x8f, 0xf9, 0x0a, 0x34, 0xdc, 0x45,
-  0x90, 0xb3, 0xf9, 0xf5, 0x65, 0xa0, 0x96, 0xe9, 0x5d, 0x8b, 0xf9, 0x5a,
-  0x10, 0x8f, 0xa2, 0x1f, 0xd8, 0x00, 0xe0, 0xd9, 0xdd, 0xed, 0xf2, 0xda,
-  0x11, 0x47, 0x02, 0x68, 0xcb, 0x88, 0xcb, 0x23, 0xc8, 0xbe, 0x3b, 0x02,
-  0x8c, 0x59, 0xa0, 0x72, 0x17, 0x9e, 0x1b, 0x01, 0x8a, 0xca, 0x5d, 0xf8,
-  0xec, 0x03, 0x3c, 0x3e, 0x63, 0x14, 0x57, 0x50, 0x28, 0x19, 0xa1, 0xd4,
-  0x50, 0x74, 0x5d, 0xaf, 0x09, 0x43, 0x31, 0x87, 0xd5, 0x5b, 0xc1, 0x90,
-  0xb6, 0xb3, 0xc5, 0x08, 0x9f, 0x2d, 0x1e, 0xc6, 0xb6, 0xd1, 0x41, 0x86,
-  0x03, 0xe9, 0x26, 0x33, 0xa8, 0x9d, 0x35, 0x46, 0x24, 0x24, 0x1d, 0x11,
-  0x6d, 0x47, 0x24, 0x29, 0x65, 0x23, 0x22, 0x27, 0xa2, 0x94, 0x58, 0x13,
-  0x84, 0x27, 0x1a, 0xee, 0x3e, 0x37, 0x22, 0x62, 0x40, 0x47, 0x44, 0x6e,
-  0x44, 0xe9, 0x88, 0xa8, 0x03, 0x91, 0x56, 0x06, 0x51, 0x64, 0xef, 0xa5,
-  0x47, 0x44, 0xb2, 0x89, 0x88, 0x50, 0x48, 0xcc, 0xdd, 0xbd, 0x78, 0xe9,
-  0x88, 0x6c, 0x71, 0xef, 0xe7, 0xd3, 0x27, 0xd6, 0x39, 0xe5, 0x82, 0x93,
-  0x79, 0xb6, 0x1e, 0xfc, 0xc4, 0x03, 0x30, 0x5a, 0x15, 0x02, 0xdf, 0x0a,
-  0xea, 0x05, 0x35, 0xff, 0xba, 0x52, 0x69, 0x3a, 0xd7, 0xa5, 0x7e, 0x51,
-  0xf3, 0x4e, 0x6f, 0xdf, 0xb9, 0x79, 0x67, 0xb7, 0xef, 0xcc, 0xbc, 0xf3,
-  0xdb, 0x77, 0xf1, 0xec, 0x68, 0xa3, 0x11, 0x6d, 0x5f, 0xb4, 0x02, 0xa1,
-  0x15, 0x06, 0x2d, 0x83, 0xd8, 0x17, 0x2d, 0x09, 0x7f, 0x49, 0xe1, 0x63,
-  0xf9, 0xec, 0xcd, 0xe7, 0x1d, 0x4b, 0x47, 0xe2, 0x5e, 0x3a, 0x26, 0xba,
-  0xc8, 0xf4, 0x6a, 0x8c, 0xfc, 0x82, 0x07, 0x4f, 0x0a, 0x60, 0x80, 0x15,
-  0x79, 0x3e, 0x73, 0x94, 0x83, 0xc6, 0xe2, 0x75, 0x8b, 0xe0, 0x53, 0xf5,
-  0x99, 0xa7, 0x7c, 0xc6, 0x99, 0x10, 0x82, 0x73, 0x41, 0x53, 0x06, 0x4c,
-  0x30, 0x26, 0xa2, 0x72, 0x3c, 0xf9, 0xf4, 0x7a, 0xad, 0x03, 0x10, 0xec,
-  0xe2, 0x60, 0x63, 0xd0, 0x7c, 0x43, 0x19, 0x0d, 0x13, 0x6d, 0xcc, 0xa9,
-  0xd4, 0xa8, 0x46, 0xe4, 0x06, 0x93, 0xe0, 0xbd, 0x18, 0x5a, 0x99, 0x48,
-  0xb7, 0xb6, 0x40, 0x53, 0x5b, 0xf8, 0xc5, 0x80, 0xaa, 0x44, 0x8a, 0x66,
-  0xa8, 0x8e, 0x16, 0x51, 0xdc, 0x3c, 0x4e, 0xcc, 0x2f, 0x95, 0x63, 0x7d,
-  0x88, 0xf7, 0x38, 0x7d, 0x42, 0x5f, 0x1c, 0x68, 0xf6, 0x44, 0x3e, 0x34,
-  0x64, 0xe7, 0xe4, 0xa9, 0x61, 0xa8, 0x14, 0xd2, 0x07, 0x30, 0xd0, 0x35,
-  0xc7, 0x00, 0x30, 0x84, 0x44, 0x52, 0x27, 0x86, 0xc1, 0xe8, 0x85, 0x59,
-  0xe8, 0xa6, 0x92, 0x56, 0xf7, 0x49, 0x49, 0x14, 0x37, 0x83, 0x33, 0x3e,
-  0x9e, 0x1e, 0x05, 0x17, 0x67, 0xe2, 0xa8, 0xbc, 0x44, 0x5a, 0x0d, 0xb2,
-  0x8b, 0x84, 0x40, 0x88, 0x94, 0xb1, 0x23, 0xf0, 0xc4, 0x88, 0xe8, 0xc1,
-  0x22, 0x22, 0x6d, 0x88, 0x2e, 0x86, 0xab, 0x45, 0x28, 0x48, 0x4e, 0xca,
-  0x28, 0x6a, 0x22, 0x3a, 0x8b, 0x22, 0x29, 0xab, 0x4e, 0x24, 0x55, 0x78,
-  0xc3, 0xeb, 0xea, 0xe2, 0x8f, 0xee, 0xcd, 0x08, 0x61, 0x3c, 0xe0, 0x1f,
-  0xd6, 0xb1, 0xdd, 0xb7, 0x13, 0x6e, 0x3c, 0xf8, 0x5a, 0x1b, 0x76, 0xbe,
-  0x9a, 0x20, 0x60, 0x8f, 0x6f, 0x26, 0xef, 0x82, 0xd3, 0x63, 0x0a, 0xc1,
-  0xe7, 0x2d, 0x7b, 0xe5, 0x84, 0xb0, 0x3a, 0xe2, 0x9c, 0x6f, 0x44, 0x9c,
-  0x8b, 0x3a, 0xe2, 0xfc, 0x40, 0x4b, 0xa0, 0x24, 0x84, 0x9b, 0xb3, 0x3f,
-  0x79, 0xc7, 0xc5, 0x5e, 0xfc, 0x7d, 0x50, 0x65, 0xe7, 0x97, 0xa3, 0xd5,
-  0xcd, 0x62, 0xa1, 0xd7, 0x45, 0x36, 0x0d, 0xbe, 0x64, 0x85, 0xbe, 0xab,
-  0xf2, 0x71, 0x36, 0xe1, 0xe3, 0x86, 0xae, 0x06, 0x47, 0x60, 0x5a, 0x3d,
-  0x1a, 0xe0, 0x4e, 0x8f, 0x03, 0x0e, 0x70, 0x32, 0x19, 0x6e, 0x07, 0x3b,
-  0x5b, 0x00, 0x03, 0x42, 0xa3, 0x59, 0x14, 0x01, 0x7a, 0x45, 0x00, 0x86,
-  0xde, 0xca, 0xb6, 0x34, 0xd9, 0x48, 0x7b, 0xd6, 0x7a, 0x1a, 0x9c, 0xea,
-  0xa5, 0x5e, 0x65, 0xb7, 0x53, 0x8d, 0x0f, 0xb8, 0x79, 0x36, 0x9f, 0x91,
-  0x8a, 0x51, 0x84, 0x32, 0x68, 0x3e, 0xe8, 0xfc, 0x54, 0xe7, 0x2f, 0xbe,
-  0x3c, 0x82, 0x8f, 0xac, 0x31, 0x25, 0xf4, 0x4e, 0xe6, 0x90, 0x9b, 0x00,
-  0xb2, 0xa6, 0xac, 0x17, 0xb6, 0x7d, 0xf6, 0xa4, 0xa4, 0xdd, 0xdb, 0xa8,
-  0x3c, 0x26, 0xd4, 0x9c, 0x0b, 0x12, 0x35, 0x55, 0x55, 0xff, 0xcc, 0xe6,
-  0xd7, 0x3f, 0x9d, 0xad, 0x28, 0x0f, 0x3f, 0x57, 0x8d, 0x58, 0xbd, 0x23,
-  0x5a, 0x34, 0xc5, 0x3e, 0xb9, 0x38, 0x0f, 0x26, 0x1f, 0x4e, 0x26, 0x1d,
-  0x45, 0xfb, 0xf7, 0xd7, 0xcd, 0x0d, 0x29, 0x96, 0xdc, 0x29, 0xe2, 0x55,
-  0x36, 0xab, 0xa6, 0xb3, 0x90, 0xb0, 0x46, 0x29, 0xe0, 0xfb, 0x56, 0xbe,
-  0xec, 0xcd, 0x96, 0x45, 0x2a, 0x21, 0xa4, 0x76, 0x7c, 0xa8, 0x2b, 0xd5,
-  0x0e, 0x1e, 0x71, 0x50, 0xd9, 0x37, 0xfb, 0x21, 0x4e, 0xaa, 0x00, 0xde,
-  0xa8, 0x3e, 0x4b, 0xa5, 0x4d, 0xa1, 0x4c, 0x2e, 0x08, 0xfa, 0x44, 0x8d,
-  0x2c, 0x3b, 0xea, 0xe1, 0xdc, 0xed, 0x1c, 0x61, 0xc9, 0xcc, 0x5c, 0x77,
-  0xf7, 0x9c, 0xc4, 0x9f, 0xc4, 0xfe, 0x05, 0x88, 0x8c, 0x36, 0x46, 0xdf,
-  0x96, 0x05, 0x09, 0xcd, 0xa6, 0xae, 0xf2, 0x7e, 0xd4, 0x1b, 0x83, 0x36,
-  0x63, 0xc6, 0xe7, 0x00, 0x8e, 0xaf, 0xf2, 0x27, 0x16, 0x22, 0xde, 0xe5,
-  0x96, 0xe0, 0xcf, 0x86, 0xd3, 0x4d, 0x76, 0xcc, 0xf7, 0x94, 0xd8, 0x74,
-  0x60, 0x49, 0xdd, 0xb6, 0xc3, 0x3f, 0xef, 0xb3, 0x7f, 0x38, 0x79, 0x6d,
-  0x37, 0x36, 0x32, 0x7a, 0xff, 0xdc, 0xc9, 0x72, 0x48, 0x23, 0xad, 0x96,
-  0xb1, 0xd4, 0x21, 0x97, 0x42, 0x6a, 0xc9, 0xe5, 0x8c, 0x82, 0x60, 0x61,
-  0x58, 0x49, 0x8d, 0xba, 0x67, 0x2f, 0x92, 0x6c, 0xa9, 0xd3, 0xc0, 0x74,
-  0x30, 0x58, 0xb5, 0x9e, 0x0c, 0x19, 0x79, 0x8d, 0xe8, 0x72, 0x43, 0xf4,
-  0xd0, 0x8a, 0xce, 0xdd, 0x19, 0x3a, 0x38, 0x26, 0x13, 0x23, 0x0a, 0xdb,
-  0xef, 0xd8, 0x79, 0x47, 0x62, 0x01, 0x43, 0xe8, 0xa2, 0xad, 0x5b, 0x58,
-  0xd8, 0x36, 0xaf, 0xa5, 0xb3, 0xcd, 0x86, 0xf9, 0x79, 0x90, 0x1b, 0xc9,
-  0x45, 0x88, 0xdc, 0x48, 0xae, 0xeb, 0x22, 0x6c, 0x2a, 0x63, 0xc9, 0x28,
-  0x08, 0x08, 0x69, 0x39, 0x57, 0xb9, 0x69, 0x80, 0x8a, 0xc9, 0xf9, 0xd7,
-  0xf3, 0x38, 0xe8, 0x5e, 0xf7, 0xfe, 0x1d, 0x71, 0x22, 0xb7, 0xc2, 0xfd,
-  0xae, 0x67, 0x6b, 0xab, 0x6c, 0x25, 0x38, 0x22, 0xef, 0xc8, 0x89, 0x96,
-  0xb6, 0xce, 0x12, 0x29, 0x8e, 0x11, 0x99, 0x58, 0x91, 0xe1, 0xc1, 0xb2,
-  0x15, 0x35, 0x86, 0x4d, 0x78, 0x39, 0x6e, 0x12, 0x76, 0x37, 0xc2, 0x89,
-  0xef, 0x67, 0x0a, 0x95, 0x11, 0x30, 0x3c, 0x70, 0xdc, 0x89, 0xbe, 0xb5,
-  0xb1, 0x69, 0x42, 0x68, 0x3d, 0x4d, 0xd8, 0xc6, 0x34, 0xe1, 0x76, 0x9a,
-  0xb4, 0x56, 0x33, 0x8d, 0xb7, 0x9c, 0xdc, 0xef, 0xb0, 0x76, 0x11, 0x40,
-  0x47, 0xf7, 0x1e, 0xb7, 0xfc, 0xd2, 0x35, 0x35, 0x3a, 0x50, 0x11, 0x12,
-  0x91, 0xf2, 0xd9, 0x81, 0xaa, 0xff, 0xfd, 0xc6, 0xe1, 0x5b, 0x15, 0x8c,
-  0x0e, 0x08, 0x80, 0x17, 0xba, 0xd1, 0xb2, 0xd4, 0xe8, 0x22, 0x4f, 0x74,
-  0xa3, 0xd6, 0x85, 0x1d, 0xe8, 0x3e, 0x95, 0xff, 0xf9, 0xda, 0x2a, 0xa3,
-  0x43, 0x94, 0xb8, 0x4b, 0x77, 0x8c, 0x4d, 0xfe, 0xd3, 0x8a, 0x0c, 0x0f,
-  0x24, 0x6d, 0xec, 0x12, 0x60, 0xfb, 0x07, 0x07, 0x82, 0x9e, 0x0c, 0xcf,
-  0x95, 0x32, 0x7d, 0xfb, 0x93, 0x5e, 0xe4, 0x6b, 0xfd, 0xc4, 0xa5, 0xb4,
-  0x6a, 0xad, 0xee, 0x7b, 0x1a, 0x46, 0x9f, 0x6a, 0x5a, 0x30, 0xcb, 0x87,
-  0xb8, 0x28, 0xfd, 0xd1, 0x6d, 0x50, 0xba, 0x36, 0x53, 0xd2, 0x2e, 0x5b,
-  0xec, 0xe5, 0xb2, 0xea, 0x58, 0xb8, 0x20, 0x35, 0xd4, 0x18, 0xa0, 0x7d,
-  0x67, 0xbe, 0xba, 0x05, 0xb3, 0xc8, 0x83, 0x25, 0x17, 0x9b, 0x1d, 0x3c,
-  0xf7, 0xa4, 0x56, 0x5d, 0x53, 0x87, 0xfe, 0xd2, 0x8c, 0x77, 0x02, 0x1e,
-  0x7d, 0x01, 0xc9, 0x83, 0x35, 0x7e, 0xf2, 0x31, 0xf8, 0x20, 0x1b, 0x37,
-  0x3d, 0xbf, 0x99, 0x7f, 0x2c, 0x21, 0x60, 0xde, 0x6f, 0x4a, 0x52, 0xaf,
-  0xec, 0x9f, 0xe3, 0xf2, 0xb5, 0xfa, 0x6b, 0x58, 0x13, 0xdd, 0x97, 0x19,
-  0x66, 0x4d, 0x78, 0xdb, 0x82, 0xc3, 0x29, 0xc6, 0xc8, 0xdb, 0x92, 0xc6,
-  0x65, 0xe7, 0x7c, 0x23, 0x78, 0x05, 0xdf, 0x06, 0x26, 0xaa, 0xb9, 0x84,
-  0x35, 0x17, 0x56, 0x73, 0xa1, 0xb5, 0x1f, 0xb9, 0xd7, 0x95, 0xbd, 0xc7,
-  0x5a, 0x8e, 0x8a, 0xe3, 0xdb, 0x69, 0xe6, 0x01, 0x26, 0x82, 0x61, 0x6b,
-  0x0c, 0x9e, 0x4a, 0xa1, 0x63, 0x2a, 0xa1, 0x03, 0xe3, 0xde, 0xc5, 0x69,
-  0x3a, 0x94, 0x60, 0xf7, 0xcb, 0x09, 0x0f, 0xb7, 0x82, 0xa0, 0xce, 0x9b,
-  0x58, 0xb0, 0xfe, 0x6e, 0x58, 0xff, 0xba, 0x42, 0x11, 0x72, 0x98, 0x7c,
-  0x25, 0x8b, 0xe0, 0xb0, 0x3f, 0x99, 0x0d, 0x77, 0x30, 0xc1, 0x20, 0x04,
-  0x42, 0xda, 0xbc, 0x3b, 0xfb, 0xfc, 0xee, 0xcd, 0xbb, 0x23, 0x24, 0x56,
-  0x8f, 0x69, 0xd7, 0xd5, 0xb6, 0x36, 0xea, 0x19, 0x8f, 0x16, 0x7b, 0xc4,
-  0xc9, 0x74, 0xdc, 0xbc, 0x22, 0x32, 0xbc, 0x8b, 0x4c, 0xf0, 0x1d, 0xc8,
-  0xdf, 0x81, 0x3f, 0x8c, 0x29, 0xe2, 0x8f, 0x25, 0x25, 0x3d, 0x22, 0xf7,
-  0xd8, 0x53, 0x44, 0xee, 0x09, 0x9f, 0x50, 0x46, 0x4c, 0xaa, 0xe4, 0x34,
-  0x92, 0x72, 0xde, 0x54, 0x0b, 0x52, 0xbd, 0x45, 0x0c, 0xdd, 0xe6, 0xff,
-  0xfb, 0x5f, 0x1f, 0x83, 0xe3, 0x8f, 0x9f, 0x4e, 0x0e, 0xff, 0x16, 0xdf,
-  0xb7, 0xf2, 0x38, 0x89, 0x5b, 0x76, 0x77, 0x76, 0xbe, 0x7d, 0x7c, 0xf3,
-  0xe9, 0xe3, 0xbb, 0x37, 0xc1, 0x69, 0x1e, 0x50, 0xc7, 0x55, 0x4f, 0x68,
-  0x99, 0x24, 0x35, 0x91, 0x24, 0x36, 0x5b, 0x13, 0x79, 0x4f, 0x03, 0x7c,
-  0xfc, 0x6d, 0x42, 0xbc, 0x71, 0x30, 0x84, 0x83, 0x70, 0x2b, 0x3b, 0x11,
-  0xb5, 0x62, 0x74, 0x0b, 0x6f, 0x97, 0x17, 0x02, 0xb0, 0x83, 0xf0, 0x71,
-  0xbd, 0x33, 0x83, 0x5a, 0x7a, 0x42, 0x8c, 0xf8, 0xd1, 0x8e, 0xca, 0xc0,
-  0x91, 0xf8, 0xcc, 0x5b, 0x7c, 0x81, 0xc5, 0x97, 0xf7, 0xe2, 0xef, 0x62,
-  0x6b, 0xa7, 0x40, 0x64, 0xf9, 0x4c, 0xa7, 0x34, 0x6c, 0x7e, 0xfb, 0xe5,
-  0xcd, 0xcf, 0x89, 0xad, 0xb6, 0x54, 0x9e, 0x43, 0xbc, 0xc9, 0xbe, 0x67,
-  0xab, 0x2c, 0x5f, 0xd6, 0x26, 0x64, 0x8f, 0x17, 0xe8, 0x5e, 0x56, 0x8f,
-  0x49, 0x1a, 0xa1, 0x4f, 0x67, 0xc6, 0xfc, 0xc7, 0xbf, 0x9d, 0xeb, 0x26,
-  0xf3, 0xff, 0x6c, 0x5b, 0x8b, 0x83, 0xc8, 0x9e, 0xc1, 0x4a, 0xe1, 0x4e,
-  0xb1, 0x4a, 0xf6, 0xf2, 0x96, 0xee, 0x0e, 0x82, 0x8d, 0x20, 0x8c, 0xb9,
-  0xef, 0x04, 0x81, 0x97, 0xbf, 0x6e, 0x22, 0x3b, 0x73, 0x48, 0x48, 0x5f,
-  0x10, 0x09, 0x61, 0xdb, 0xc2, 0xd7, 0x88, 0x44, 0x4c, 0x9c, 0xc1, 0x7d,
-  0xac, 0xa2, 0x23, 0x80, 0x36, 0x57, 0xbc, 0x33, 0x95, 0x66, 0x3f, 0x83,
-  0x4f, 0xf9, 0xf4, 0xdb, 0x2c, 0x2b, 0xf4, 0x5d, 0x59, 0xa8, 0xc9, 0x5a,
-  0x95, 0xad, 0x5e, 0x83, 0xd7, 0x45, 0x96, 0x5e, 0xea, 0xbd, 0xa7, 0x09,
-  0x61, 0x77, 0xb3, 0xd7, 0xfa, 0x17, 0xfb, 0x1c, 0x45, 0x11, 0xb2, 0x83,
-  0x0d, 0x9c, 0xcd, 0x2a, 0xa3, 0xcf, 0x08, 0x63, 0x4d, 0x52, 0xc7, 0xdd,
-  0x01, 0x44, 0xfe, 0x50, 0x0e, 0xa4, 0xa3, 0xbd, 0xed, 0xe1, 0x9e, 0x44,
-  0xa8, 0x0c, 0xca, 0xd9, 0x9b, 0xb3, 0xe0, 0x68, 0xb6, 0xd6, 0xc5, 0xe5,
-  0x3c, 0xff, 0x51, 0xa7, 0xdc, 0x8e, 0xf1, 0xc6, 0x98, 0x18, 0x61, 0x40,
-  0x47, 0x62, 0xbb, 0x10, 0x93, 0x1c, 0xc8, 0x03, 0x1d, 0x7b, 0xad, 0xd6,
-  0xeb, 0xdb, 0x81, 0x65, 0x7a, 0x9e, 0x96, 0xb8, 0x86, 0xce, 0x28, 0x0d,
-  0xcd, 0x3c, 0x94, 0x92, 0xd7, 0x8c, 0xe6, 0xb7, 0x28, 0x82, 0x63, 0xb5,
-  0xc8, 0xef, 0x82, 0xff, 0xd3, 0x46, 0x4a, 0xf7, 0x05, 0xd6, 0x30, 0xbf,
-  0xc4, 0x09, 0x56, 0xc7, 0x90, 0x1c, 0x24, 0x30, 0x46, 0x1a, 0x1b, 0x9b,
-  0x0a, 0xd8, 0xc9, 0x51, 0x30, 0xb9, 0xca, 0x8b, 0xf5, 0x98, 0xf0, 0x5e,
-  0x83, 0x8a, 0x44, 0x05, 0x88, 0x90, 0x1a, 0x54, 0xb3, 0xeb, 0x61, 0x19,
-  0x03, 0x38, 0x6d, 0xed, 0xf9, 0x30, 0xb0, 0xac, 0x09, 0x8b, 0x6d, 0x6a,
-  0xcd, 0x3c, 0xdd, 0xc0, 0xf6, 0xaf, 0x6c, 0x79, 0x99, 0xe6, 0x8b, 0xe0,
-  0x1f, 0x5a, 0x8d, 0x4a, 0xb6, 0x49, 0x8b, 0x46, 0x0e, 0x25, 0x3b, 0x9b,
-  0xb0, 0xd2, 0x11, 0x2d, 0x2d, 0xd8, 0x32, 0xbd, 0x41, 0xb4, 0x86, 0x54,
-  0xfc, 0xdb, 0x52, 0x82, 0xb8, 0x85, 0xd2, 0x67, 0x5d, 0xac, 0xae, 0x57,
-  0xd5, 0xac, 0xbc, 0x55, 0xb1, 0x3d, 0x1e, 0x56, 0xf5, 0x3f, 0xf3, 0xf6,
-  0x6f, 0x20, 0x0a, 0x7c, 0x16, 0x63, 0xd3, 0x5c, 0x37, 0xa1, 0xc2, 0xb2,
-  0x1e, 0x64, 0x1b, 0x51, 0xfb, 0x45, 0x95, 0xb1, 0x12, 0x74, 0xd3, 0x19,
-  0x74, 0xbb, 0x80, 0x43, 0x0b, 0x9b, 0xc0, 0xa4, 0xc2, 0x6d, 0xa4, 0x3e,
-  0xa9, 0xef, 0x7a, 0x59, 0xf9, 0x3b, 0x83, 0xf7, 0x04, 0x23, 0x87, 0x27,
-  0x38, 0xd6, 0xf2, 0x71, 0xa1, 0xd2, 0x33, 0x83, 0x2a, 0x74, 0xa3, 0x2a,
-  0xd7, 0x6b, 0xbd, 0x36, 0xa9, 0xb3, 0xe9, 0x08, 0x0e, 0xe4, 0xed, 0xef,
-  0xee, 0x19, 0x82, 0x6c, 0x58, 0xe8, 0xfa, 0x98, 0xa8, 0xd1, 0x98, 0x86,
-  0xfa, 0x45, 0x2e, 0xb1, 0xd6, 0x7c, 0x1d, 0x84, 0xa5, 0x5f, 0x6e, 0x3a,
-  0xf8, 0xe4, 0xa6, 0x13, 0xb2, 0xc3, 0x69, 0x08, 0x9f, 0x56, 0xa7, 0x69,
-  0xa9, 0x32, 0xb9, 0xc4, 0xc4, 0xc1, 0xa5, 0x56, 0x9f, 0x97, 0xd6, 0x55,
-  0x21, 0x8d, 0x4d, 0xbd, 0x24, 0x69, 0x92, 0x5a, 0x61, 0xeb, 0xf0, 0xdb,
-  0xbf, 0xf0, 0x41, 0x94, 0x20, 0x70, 0x77, 0x17, 0xf1, 0xf8, 0xca, 0x26,
-  0x15, 0xcf, 0xfd, 0x95, 0x3f, 0x67, 0x6b, 0xd5, 0xe2, 0x7f, 0xe1, 0xed,
-  0xb4, 0x70, 0xc5, 0x9a, 0xd3, 0x1e, 0xe9, 0x78, 0x68, 0x5a, 0x77, 0x3b,
-  0x5e, 0xa8, 0xc4, 0x0b, 0x80, 0x60, 0xcd, 0xef, 0x9f, 0xff, 0xd0, 0xc5,
-  0xd1, 0x50, 0xad, 0x9d, 0xc5, 0xc2, 0x94, 0xa8, 0xf0, 0x90, 0x06, 0x96,
-  0x80, 0x70, 0x1a, 0x11, 0xca, 0x5f, 0x01, 0x19, 0x1c, 0x21, 0xdc, 0xeb,
-  0x8e, 0x98, 0x5e, 0x77, 0x88, 0xd0, 0x71, 0x5e, 0xe8, 0xbb, 0xba, 0x2e,
-  0xe3, 0x19, 0x41, 0x03, 0x9b, 0xe1, 0x46, 0x84, 0x1b, 0xdb, 0xdb, 0xeb,
-  0x55, 0x69, 0x4a, 0x70, 0xd0, 0x37, 0xce, 0x20, 0x37, 0x26, 0xe6, 0xf0,
-  0x13, 0x0d, 0xfa, 0x76, 0x5a, 0xa4, 0x3e, 0x18, 0xab, 0x9d, 0x63, 0x70,
-  0xa6, 0xd2, 0x91, 0x61, 0xcd, 0x10, 0x08, 0x37, 0x4f, 0x17, 0xc3, 0xaa,
-  0xee, 0xd9, 0x5e, 0x1d, 0xe0, 0xc3, 0xb2, 0x73, 0x76, 0xc2, 0x4a, 0x15,
-  0x82, 0xfd, 0xb9, 0x29, 0x6d, 0xcb, 0x3a, 0x1c, 0xd5, 0xad, 0x2e, 0x03,
-  0xe6, 0xf4, 0x34, 0x82, 0xf7, 0xd9, 0x32, 0xbb, 0xc3, 0x78, 0xf2, 0x73,
-  0xf0, 0x6b, 0x2a, 0x73, 0x5b, 0xb5, 0x51, 0xc1, 0x76, 0xa1, 0x27, 0xd3,
-  0xa9, 0x72, 0xd1, 0x33, 0xba, 0x35, 0x76, 0x27, 0xe6, 0x6e, 0xed, 0x9a,
-  0x5c, 0xe9, 0xe9, 0xba, 0x50, 0xbb, 0x6a, 0xd9, 0x68, 0xc6, 0x22, 0xc7,
-  0xaa, 0x39, 0xe0, 0xde, 0x1d, 0xc8, 0xab, 0xa0, 0x14, 0xdc, 0x7c, 0xba,
-  0x4f, 0xb8, 0xc3, 0x83, 0xf5, 0x28, 0xa4, 0x1f, 0xa1, 0x76, 0x0d, 0x1a,
-  0xc3, 0x40, 0xd0, 0x64, 0xe3, 0xdb, 0x50, 0x55, 0xce, 0xc3, 0xc8, 0xab,
-  0x56, 0x2d, 0xbe, 0x7d, 0xf2, 0x59, 0x5b, 0xff, 0x6e, 0x39, 0xbb, 0x25,
-  0xb7, 0xbe, 0xe9, 0x0f, 0xec, 0x30, 0x39, 0xcd, 0xdc, 0x46, 0xea, 0x89,
-  0xef, 0x4c, 0xc2, 0xc3, 0xa2, 0x25, 0x53, 0xd3, 0xb1, 0x8a, 0x62, 0xc7,
-  0xaa, 0xd0, 0xd3, 0xbb, 0xd0, 0xef, 0x01, 0x5f, 0xd0, 0xdb, 0x18, 0x51,
-  0xfe, 0x20, 0x46, 0x74, 0x42, 0x5f, 0xf0, 0xb9, 0x3f, 0xe3, 0x44, 0xdd,
-  0x3d, 0x25, 0x44, 0xcd, 0x6f, 0x3a, 0x61, 0x68, 0xd8, 0xc3, 0xf4, 0x96,
-  0xed, 0x89, 0xbf, 0xb4, 0xc1, 0x3c, 0xd0, 0x0e, 0x88, 0x97, 0x84, 0x08,
-  0x33, 0x88, 0xc0, 0x51, 0xe5, 0x2d, 0x7c, 0x58, 0xe5, 0x8d, 0xb7, 0x26,
-  0x4c, 0x11, 0x68, 0xb0, 0xf1, 0x6e, 0x29, 0x41, 0x48, 0x83, 0x0d, 0xf5,
-  0x69, 0x29, 0xc1, 0x4a, 0x34, 0x44, 0x94, 0x6c, 0x08, 0xf5, 0x80, 0x13,
-  0xd5, 0x70, 0x9e, 0xa3, 0x82, 0x41, 0x0f, 0x73, 0x49, 0x7d, 0xcc, 0x65,
-  0x3d, 0xb5, 0x3c, 0xe0, 0x90, 0x51, 0x73, 0xb6, 0xc0, 0x19, 0x35, 0xe7,
-  0x1e, 0x8e, 0x98, 0x91, 0xea, 0xd6, 0x89, 0x38, 0x6c, 0xce, 0x98, 0x70,
-  0x40, 0xb8, 0x73, 0x42, 0x8d, 0x6b, 0x55, 0x64, 0x00, 0x55, 0xff, 0x7b,
-  0xd4, 0x1b, 0xe1, 0xb0, 0x35, 0xe6, 0x37, 0x1a, 0xe2, 0x76, 0x38, 0xe4,
-  0x05, 0xc0, 0x51, 0x84, 0xf6, 0xa5, 0xa3, 0x08, 0x7b, 0x0a, 0x3c, 0x11,
-  0x8c, 0xeb, 0x54, 0x3b, 0x1c, 0xab, 0x3b, 0x23, 0x1c, 0x01, 0x7c, 0xca,
-  0x89, 0x88, 0x05, 0x13, 0x9c, 0x13, 0xc1, 0x79, 0xcc, 0x67, 0x5c, 0x0f,
-  0xdd, 0xea, 0xc8, 0x9d, 0xad, 0xce, 0xe8, 0x1b, 0x2b, 0x80, 0x04, 0xf9,
-  0x39, 0xfc, 0xd9, 0xfd, 0x1c, 0xc5, 0xfa, 0x2e, 0xe8, 0x8a, 0xfb, 0xd7,
-  0xa3, 0xe8, 0x02, 0x14, 0x61, 0x40, 0xfb, 0x8f, 0x98, 0x3f, 0xc4, 0xad,
-  0xe7, 0x94, 0x83, 0x18, 0x35, 0xa8, 0x1b, 0xd0, 0xa8, 0x41, 0xad, 0x80,
-  0xa6, 0xb6, 0xbd, 0xcd, 0xa8, 0x41, 0xdb, 0x00, 0x75, 0x4f, 0xb1, 0x11,
-  0xd0, 0x38, 0xc5, 0x70, 0x65, 0x1d, 0x62, 0xe3, 0xee, 0x9e, 0x52, 0x83,
-  0x0e, 0xa4, 0xd8, 0x14, 0x08, 0xb7, 0x69, 0x1e, 0x2d, 0x4f, 0x27, 0xa0,
-  0x71, 0x62, 0x6d, 0x07, 0x44, 0x22, 0x18, 0x01, 0xb9, 0x00, 0x8d, 0x8b,
-  0x7b, 0x37, 0xa0, 0x71, 0x8a, 0x75, 0x01, 0x6a, 0x9f, 0x62, 0xa3, 0xff,
-  0xac, 0x25, 0x4e, 0x07, 0x9c, 0x88, 0x97, 0x39, 0xc5, 0x6c, 0x24, 0x25,
-  0xdf, 0xef, 0x64, 0x5b, 0xe7, 0xd7, 0xd3, 0xaf, 0x57, 0x2a, 0x2d, 0x8f,
-  0x70, 0xea, 0x99, 0xe7, 0xc1, 0x2d, 0x72, 0x71, 0x1b, 0x15, 0x6b, 0x46,
-  0x21, 0xdd, 0x41, 0xb1, 0x46, 0xc5, 0x12, 0x6e, 0xc5, 0x02, 0x78, 0xe1,
-  0xdc, 0x5e, 0x18, 0xad, 0x71, 0x1a, 0x22, 0x40, 0xf5, 0x34, 0x1c, 0xd5,
-  0xa9, 0xcb, 0xaa, 0x33, 0xa8, 0xb2, 0xca, 0x09, 0x25, 0xcd, 0xea, 0x35,
-  0xff, 0x4f, 0x2d, 0x13, 0x65, 0xb2, 0x1a, 0xcb, 0x1a, 0xb2, 0x2b, 0x9b,
-  0xd8, 0x48, 0x37, 0xb3, 0x42, 0x09, 0xec, 0x29, 0x6c, 0x57, 0xf4, 0x0e,
-  0xae, 0x93, 0x35, 0x83, 0xee, 0xde, 0x99, 0x94, 0xd2, 0xa9, 0x79, 0x11,
-  0x0e, 0xb1, 0xdf, 0x14, 0xea, 0x32, 0x5f, 0x62, 0xe9, 0x83, 0xbf, 0x9c,
-  0x4d, 0xd8, 0x5f, 0x07, 0x18, 0xc4, 0x80, 0xa1, 0x81, 0x27, 0x34, 0xfe,
-  0xd7, 0x41, 0x1e, 0xb6, 0x61, 0x68, 0xe0, 0x84, 0x96, 0x2f, 0xb5, 0x65,
-  0x76, 0x4b, 0xea, 0x9e, 0xdb, 0x33, 0x11, 0xeb, 0x68, 0x62, 0x82, 0x6c,
-  0xb1, 0x87, 0x75, 0x31, 0x86, 0xb8, 0x21, 0xbc, 0x95, 0xf5, 0x2e, 0x0b,
-  0x1d, 0xad, 0x58, 0x9d, 0x26, 0x22, 0xec, 0xfe, 0xb6, 0x7c, 0xab, 0x89,
-  0xa0, 0x3b, 0x9b, 0x08, 0xe6, 0xf8, 0x70, 0x1f, 0x93, 0x55, 0x96, 0x66,
-  0x6a, 0x34, 0x12, 0xed, 0xfa, 0xde, 0x8d, 0x6d, 0x34, 0x13, 0xb8, 0xe9,
-  0x36, 0x30, 0x54, 0xc8, 0xff, 0x93, 0xba, 0xfa, 0xba, 0xd4, 0xeb, 0x80,
-  0x2f, 0xf5, 0x8a, 0xaf, 0x96, 0xba, 0x9e, 0x27, 0xdc, 0x30, 0x42, 0xa2,
-  0x76, 0x29, 0x01, 0xee, 0xa8, 0x6d, 0xd6, 0x4a, 0xd1, 0x39, 0x34, 0x4e,
-  0x9d, 0x43, 0x33, 0x65, 0xe6, 0xcb, 0x76, 0x2e, 0xb6, 0xf4, 0x0c, 0x9e,
-  0xc9, 0xd4, 0xa7, 0xdc, 0xbc, 0x19, 0x59, 0x37, 0x2a, 0xd6, 0x36, 0x9e,
-  0xd3, 0xe3, 0x40, 0x2d, 0xd3, 0xbb, 0x6e, 0x49, 0x78, 0x44, 0xa1, 0x6f,
-  0xeb, 0x75, 0x1f, 0x8f, 0x84, 0xee, 0x50, 0xd3, 0x86, 0x3f, 0x24, 0x1f,
-  0x75, 0x4a, 0x2a, 0xe1, 0x7f, 0x5d, 0xd2, 0x28, 0x26, 0x95, 0x90, 0x64,
-  0x96, 0x9a, 0xec, 0x28, 0x2b, 0xe9, 0x7f, 0x75, 0x11, 0x7c, 0x5c, 0xfe,
-  0x57, 0xdd, 0x77, 0x9d, 0x3f, 0x49, 0xb3, 0xb2, 0x98, 0x4f, 0x5b, 0xae,
-  0x0f, 0x8a, 0x5d, 0x22, 0x1b, 0x12, 0x53, 0x2b, 0x31, 0x3b, 0xd0, 0xec,
-  0x31, 0x46, 0x89, 0x30, 0xbe, 0x04, 0xaf, 0x8c, 0x6b, 0x03, 0xd3, 0x99,
-  0x5a, 0xae, 0xbf, 0xea, 0x42, 0x95, 0x65, 0x27, 0x07, 0xb8, 0x02, 0x61,
-  0x48, 0xa4, 0x0b, 0x12, 0x1f, 0xe0, 0x7a, 0x83, 0x21, 0x45, 0x04, 0x3a,
-  0x20, 0x05, 0x27, 0xdf, 0xf3, 0x27, 0x2a, 0x6f, 0xc3, 0x0e, 0x95, 0x1a,
-  0x38, 0xa9, 0x7d, 0x52, 0xd9, 0xff, 0xbf, 0x1e, 0x75, 0x0a, 0x04, 0x84,
-  0x60, 0x30, 0x61, 0x3a, 0xc1, 0xfb, 0x3c, 0xc9, 0xe6, 0x3d, 0xfa, 0x54,
-  0x60, 0x4a, 0x74, 0x7b, 0xa1, 0x3a, 0xd6, 0xa4, 0x24, 0xbc, 0x0b, 0xd5,
-  0x71, 0x27, 0xa5, 0xee, 0x7a, 0x84, 0xdc, 0x71, 0x40, 0x85, 0x30, 0x29,
-  0x52, 0x43, 0xc2, 0x98, 0xce, 0xf3, 0xeb, 0x62, 0xa9, 0x16, 0x7a, 0xb9,
-  0xde, 0x58, 0xef, 0xc6, 0x59, 0x47, 0xdc, 0xb3, 0x2e, 0x5f, 0xde, 0x19,
-  0x2a, 0x5b, 0xf8, 0x7c, 0x88, 0x53, 0x10, 0xf9, 0x51, 0x30, 0xd3, 0x0e,
-  0x3f, 0x6a, 0xa2, 0x12, 0x5d, 0xac, 0xf3, 0x7c, 0xfd, 0x75, 0xe8, 0xf5,
-  0x0a, 0x80, 0x8b, 0x74, 0x04, 0xb4, 0x0b, 0x20, 0x31, 0x02, 0x6a, 0xb1,
-  0x46, 0x28, 0xbc, 0xd0, 0x00, 0xd2, 0xc5, 0x77, 0x35, 0x7f, 0x16, 0x38,
-  0xa2, 0x2f, 0x9c, 0x1e, 0xfd, 0x3f, 0x45, 0x0b, 0x1c, 0xc9, 0xd4, 0x08,
-  0x07, 0x6b, 0x0e, 0x03, 0x75, 0xf7, 0x6c, 0x6a, 0xce, 0x97, 0x6c, 0x9e,
-  0x4e, 0xd5, 0x7a, 0xf0, 0xf3, 0x2a, 0x71, 0xfa, 0xd6, 0x5f, 0xf2, 0xf9,
-  0x77, 0x5d, 0x64, 0x4b, 0x1d, 0x8c, 0xf7, 0x78, 0x0e, 0x7a, 0x61, 0xdc,
-  0xec, 0x81, 0x49, 0xc0, 0xd2, 0xd3, 0xb7, 0xa0, 0x76, 0xe2, 0xe5, 0xdf,
-  0x0b, 0x52, 0xa2, 0x13, 0xf9, 0xae, 0xf3, 0x77, 0xaf, 0xd6, 0xa6, 0x3c,
-  0xe1, 0x91, 0x11, 0xa9, 0x92, 0xa9, 0x21, 0xd1, 0xa9, 0x5a, 0xdc, 0x1d,
-  0x1e, 0x6f, 0x7a, 0x7b, 0xf0, 0x98, 0x24, 0xb6, 0xc3, 0x6a, 0xb8, 0x10,
-  0x11, 0x12, 0x96, 0xcf, 0x38, 0xc6, 0x26, 0xa4, 0x84, 0xb2, 0xcc, 0xa6,
-  0x8d, 0x73, 0x40, 0xc7, 0x78, 0xdb, 0xfe, 0xc3, 0x00, 0x33, 0xa8, 0xcf,
-  0x9f, 0x31, 0xed, 0xb3, 0x0d, 0xca, 0x62, 0x5f, 0xc7, 0xce, 0xd0, 0xb2,
-  0x4d, 0x32, 0x3f, 0x41, 0xa5, 0x08, 0x79, 0x48, 0xe5, 0x4c, 0xb0, 0x90,
-  0xcb, 0x99, 0xd4, 0x52, 0x30, 0x6a, 0x47, 0x34, 0x59, 0x97, 0xf7, 0x66,
-  0x14, 0x2b, 0xb6, 0xfb, 0x6e, 0x3a, 0x21, 0xa2, 0xd6, 0x03, 0xb9, 0xa1,
-  0x07, 0xa1, 0xd5, 0x03, 0xbe, 0x5d, 0xb3, 0xa3, 0xae, 0xcb, 0xe7, 0xb8,
-  0xb9, 0x03, 0xe4, 0x1d, 0xa6, 0x8e, 0x13, 0x5a, 0xe9, 0xb8, 0x0b, 0xf6,
-  0x1f, 0x93, 0xd7, 0x77, 0x27, 0xba, 0x15, 0xf9, 0xbc, 0x58, 0xd7, 0x8d,
-  0xfe, 0xa3, 0xba, 0xcf, 0x3f, 0x01, 0x67, 0xa3, 0x7f, 0x42, 0x4a, 0x0e,
-  0x61, 0xc9, 0xa1, 0x3e, 0x0f, 0xa5, 0xb5, 0xf4, 0xb5, 0xf0, 0x60, 0x64,
-  0xc7, 0x53, 0x80, 0xb0, 0xa6, 0xec, 0x3b, 0x2c, 0x9c, 0x84, 0x5a, 0xf1,
-  0x79, 0xab, 0xcc, 0x32, 0x21, 0xdc, 0x48, 0x9a, 0x36, 0xcd, 0xbb, 0xfe,
-  0x9e, 0xcf, 0xaf, 0xd7, 0xb6, 0x44, 0xeb, 0x98, 0xa0, 0x51, 0xb3, 0x22,
-  0x6c, 0x57, 0x56, 0x01, 0x1b, 0x30, 0x2d, 0x5b, 0x7c, 0x62, 0x86, 0x9a,
-  0xc6, 0xd5, 0xed, 0xa9, 0x06, 0xdf, 0x26, 0x2e, 0x44, 0xbd, 0xa9, 0x6a,
-  0x34, 0x63, 0x31, 0xd1, 0xdd, 0x94, 0x4b, 0xb7, 0x13, 0x1c, 0x8b, 0x9c,
-  0x34, 0x8f, 0x0e, 0x66, 0x7a, 0xa6, 0x5a, 0x26, 0x62, 0xdd, 0x29, 0xcc,
-  0x02, 0x1b, 0x1b, 0x1d, 0x71, 0x89, 0x3a, 0xa8, 0x22, 0x5c, 0xdd, 0x95,
-  0x46, 0x0f, 0x53, 0x7e, 0xc5, 0xaa, 0x8b, 0x6d, 0xca, 0x66, 0xb2, 0x31,
-  0xb5, 0x26, 0x2a, 0x5b, 0xeb, 0x5b, 0x02, 0x37, 0x49, 0x5e, 0x5c, 0x06,
-  0x9f, 0x49, 0xa3, 0xcf, 0xf5, 0xff, 0xe8, 0x44, 0xf3, 0x0a, 0xab, 0xb2,
-  0xe4, 0x08, 0xa0, 0x44, 0x3c, 0x43, 0xee, 0x8c, 0x08, 0xd8, 0x47, 0xaf,
-  0xff, 0x10, 0x49, 0xde, 0x1d, 0x06, 0x50, 0xdf, 0x7e, 0x74, 0x8d, 0x1d,
-  0x42, 0x20, 0xce, 0xb1, 0x53, 0x0a, 0xf7, 0x61, 0xa6, 0xec, 0x57, 0xee,
-  0x4d, 0x2d, 0x77, 0xd2, 0x3d, 0xf6, 0xe9, 0x6c, 0x66, 0x06, 0x8e, 0xc6,
-  0x2e, 0x00, 0x82, 0xb7, 0x79, 0x31, 0xd5, 0xc1, 0xa7, 0xeb, 0x45, 0x32,
-  0xd7, 0xb5, 0x24, 0x76, 0x53, 0x42, 0x0e, 0xa0, 0x1f, 0xbb, 0xb3, 0x09,
-  0x13, 0x01, 0x2f, 0x42, 0xf6, 0xee, 0x1d, 0x13, 0x8a, 0x01, 0xf6, 0x36,
-  0x71, 0xe3, 0x17, 0xd4, 0xa3, 0x8a, 0x50, 0x9f, 0x89, 0x1b, 0xcd, 0x84,
-  0x53, 0x81, 0x18, 0x05, 0x30, 0xaa, 0xf3, 0xf4, 0xd9, 0xc5, 0xbd, 0x96,
-  0x03, 0xd2, 0xa9, 0x3b, 0x8f, 0x8e, 0x15, 0x05, 0xe2, 0x66, 0x13, 0x01,
-  0x9e, 0x4e, 0xfb, 0x67, 0xe2, 0xb7, 0xf1, 0x95, 0xfe, 0x4c, 0x68, 0xcd,
-  0xc4, 0x63, 0x3a, 0xc5, 0x2d, 0xc6, 0x32, 0x6a, 0x30, 0x39, 0x34, 0xcb,
-  0xe2, 0x01, 0x20, 0x01, 0xee, 0x04, 0x10, 0xc7, 0x50, 0xc5, 0x1f, 0x1e,
-  0x2d, 0xd5, 0x3c, 0x7f, 0xd8, 0x5c, 0x37, 0x3e, 0x84, 0x94, 0x7c, 0xb7,
-  0x82, 0x44, 0x1e, 0x06, 0x85, 0x82, 0xdb, 0x87, 0x3a, 0x9b, 0xd0, 0x10,
-  0x59, 0x94, 0x41, 0x39, 0x4c, 0xc6, 0x3d, 0xd2, 0x91, 0x55, 0x1f, 0x73,
-  0x6a, 0x9a, 0xdc, 0x63, 0x5a, 0xac, 0xae, 0x97, 0x97, 0xc1, 0xc9, 0xbb,
-  0xd3, 0x33, 0x0a, 0xfb, 0x8b, 0x4a, 0x21, 0xe2, 0x31, 0xa7, 0xa3, 0xfe,
-  0x91, 0x25, 0xa8, 0x68, 0x7a, 0x44, 0xd2, 0x4a, 0x5e, 0x00, 0x64, 0x42,
-  0xbf, 0x67, 0xb9, 0x2b, 0x27, 0xac, 0x7b, 0xfd, 0xf4, 0x89, 0xb7, 0xa7,
-  0xdb, 0x3f, 0x63, 0x73, 0x33, 0xc9, 0xb7, 0x47, 0x1d, 0x2b, 0x06, 0x53,
-  0x9b, 0x6a, 0xd2, 0xd4, 0x6c, 0x7d, 0xa9, 0x82, 0x53, 0xbd, 0xd4, 0xab,
-  0x6c, 0x55, 0x75, 0x15, 0x60, 0xaf, 0x71, 0x09, 0x4d, 0xe4, 0xf7, 0xf2,
-  0xda, 0x77, 0x64, 0x1b, 0xbe, 0x23, 0xb3, 0xbe, 0x63, 0xfb, 0x3d, 0xc5,
-  0x8e, 0xf7, 0x2d, 0x78, 0x78, 0x13, 0xb5, 0xbe, 0x2e, 0x96, 0xbf, 0xf2,
-  0xaa, 0x45, 0x20, 0x11, 0xbc, 0x96, 0x5e, 0x2b, 0x0c, 0xa5, 0x40, 0xb6,
-  0x09, 0x03, 0x7b, 0x2f, 0x4d, 0x5a, 0x23, 0x6f, 0x59, 0x5a, 0x6b, 0x89,
-  0x7d, 0xae, 0x49, 0x12, 0x6e, 0xe6, 0xbb, 0x42, 0xeb, 0xa6, 0x53, 0xa0,
-  0x5f, 0xf7, 0x55, 0x1a, 0xb6, 0xbd, 0x6b, 0x36, 0x93, 0x19, 0x44, 0xd5,
-  0x8b, 0xe6, 0xcd, 0xd9, 0xfc, 0xf6, 0xd8, 0xad, 0xf0, 0xbd, 0xb5, 0xcc,
-  0x91, 0x08, 0xec, 0x53, 0x05, 0x98, 0x51, 0x61, 0x12, 0x3f, 0x90, 0x77,
-  0xfb, 0x55, 0x2d, 0xbf, 0xa8, 0xe5, 0x5d, 0x9f, 0xc9, 0x2b, 0x95, 0x0e,
-  0xad, 0x3a, 0xf2, 0x0c, 0x0c, 0x17, 0x32, 0x25, 0x0f, 0xb8, 0xfc, 0x28,
-  0xb9, 0x64, 0xf9, 0x5a, 0x4f, 0xbf, 0x05, 0x03, 0x2f, 0x22, 0x6d, 0xd4,
-  0x27, 0x14, 0x20, 0x9c, 0x98, 0x4a, 0x3c, 0x67, 0xc7, 0x18, 0xcb, 0x41,
-  0x7b, 0x31, 0x5e, 0x80, 0x92, 0x29, 0xb5, 0x77, 0xa3, 0xdb, 0x00, 0x05,
-  0xbd, 0xdd, 0x98, 0x83, 0x09, 0xa9, 0xc5, 0xbd, 0x32, 0x20, 0x86, 0xa8,
-  0x49, 0xe6, 0x77, 0x29, 0xa4, 0xc4, 0x40, 0x0e, 0x7e, 0x26, 0x51, 0xcf,
-  0x22, 0x39, 0x04, 0xa0, 0xc2, 0x91, 0x2f, 0x6f, 0xee, 0xb6, 0x4b, 0x93,
-  0xaf, 0xe5, 0x19, 0xf3, 0x80, 0xf3, 0x1f, 0x66, 0xb3, 0xea, 0x39, 0x4d,
-  0xd0, 0x69, 0x43, 0x89, 0xa8, 0x71, 0xe0, 0x5c, 0xde, 0xc0, 0xab, 0x64,
-  0xae, 0xf7, 0xdf, 0x80, 0xa9, 0x1b, 0x82, 0xcf, 0x71, 0x3a, 0x15, 0xe6,
-  0x63, 0xdb, 0x23, 0xe1, 0xa6, 0x44, 0x13, 0x1a, 0x5c, 0xa9, 0x34, 0xf8,
-  0x91, 0xad, 0xbf, 0x06, 0x93, 0x85, 0x2a, 0xd6, 0xb7, 0xc1, 0x33, 0xad,
-  0xbd, 0xe2, 0xe3, 0x03, 0xe9, 0x15, 0xef, 0x98, 0x1f, 0xd1, 0x0e, 0x86,
-  0x54, 0xe8, 0xca, 0x3d, 0x8c, 0x74, 0x95, 0x94, 0x1d, 0x32, 0x10, 0x15,
-  0xaa, 0x2b, 0xad, 0xd3, 0x79, 0xb6, 0xfc, 0x16, 0x9c, 0xe7, 0x45, 0x96,
-  0x0e, 0xf5, 0x66, 0x0a, 0xf3, 0xa1, 0xd5, 0xc3, 0xf0, 0xf9, 0xbd, 0xe4,
-  0x73, 0xa1, 0xf3, 0x9f, 0x65, 0x0c, 0x82, 0x39, 0x77, 0x19, 0x2a, 0xa9,
-  0x94, 0x90, 0xa8, 0x7a, 0x8b, 0xd1, 0x79, 0xf7, 0x5a, 0xa5, 0x99, 0x42,
-  0xde, 0xdc, 0x10, 0x23, 0x82, 0x31, 0x21, 0x80, 0x91, 0x10, 0xd2, 0x21,
-  0x4d, 0x6d, 0xa0, 0x23, 0x6d, 0xae, 0xd6, 0x6b, 0xad, 0x16, 0xdd, 0x80,
-  0xdc, 0x81, 0x8e, 0x28, 0xc7, 0x97, 0xee, 0x6b, 0x82, 0x5d, 0xa9, 0x34,
-  0x9d, 0xeb, 0x32, 0x16, 0xc3, 0xbe, 0x53, 0x0b, 0xa5, 0x7d, 0xe7, 0xdb,
-  0x83, 0x08, 0x9a, 0x55, 0x98, 0x08, 0xbe, 0x5e, 0x83, 0x7a, 0xf3, 0x2b,
-  0xea, 0xcd, 0x2f, 0xdf, 0xd8, 0xfc, 0x72, 0xbb, 0xf9, 0x15, 0xb5, 0xf3,
-  0xe2, 0xe3, 0xef, 0x86, 0x5b, 0xa1, 0x88, 0x0d, 0x28, 0xd2, 0xd3, 0x0f,
-  0x96, 0x9d, 0x7e, 0xb0, 0x39, 0x34, 0xeb, 0x06, 0x47, 0x09, 0x19, 0x55,
-  0x09, 0x13, 0x79, 0xac, 0x2a, 0x25, 0x24, 0xaa, 0x91, 0xc4, 0x35, 0x12,
-  0x0a, 0x16, 0x49, 0xf8, 0x28, 0x55, 0x4a, 0xa2, 0xad, 0x50, 0xe4, 0x06,
-  0x14, 0xd1, 0x19, 0x80, 0xba, 0x37, 0xdd, 0xe1, 0xa3, 0xee, 0x60, 0x22,
-  0x2f, 0x50, 0x77, 0x54, 0xd8, 0x5f, 0x77, 0xf6, 0x6f, 0x77, 0x66, 0x53,
-  0x7f, 0xdd, 0x39, 0x30, 0xc7, 0x4f, 0x60, 0xbb, 0x32, 0xf8, 0x45, 0x1b,
-  0x13, 0x11, 0x48, 0x07, 0x46, 0x22, 0x72, 0xb4, 0xa8, 0x0f, 0x74, 0xa4,
-  0x6e, 0x9f, 0x58, 0x13, 0x79, 0xa3, 0xab, 0xe2, 0x12, 0x6c, 0xb3, 0xbc,
-  0x11, 0x21, 0x35, 0x8c, 0xb0, 0x86, 0x11, 0x6d, 0xc0, 0x88, 0x2d, 0x0c,
-  0xd9, 0x9a, 0xe3, 0x1e, 0x36, 0x6c, 0x29, 0x6f, 0xe2, 0x88, 0xbb, 0xed,
-  0x49, 0xd4, 0xb4, 0x27, 0x98, 0x42, 0xb4, 0xd5, 0x84, 0xd2, 0x12, 0x8d,
-  0x28, 0xd1, 0xc8, 0x6e, 0x13, 0x3a, 0x73, 0x2a, 0xcb, 0xe7, 0xac, 0x58,
-  0x5f, 0xab, 0xb9, 0xbd, 0x42, 0x19, 0xdc, 0x7e, 0xdb, 0x9e, 0x6c, 0x6a,
-  0x19, 0xcb, 0x54, 0xd2, 0x50, 0x84, 0x8c, 0x26, 0xd5, 0xdf, 0x2c, 0x25,
-  0x3d, 0x37, 0xfd, 0xc0, 0x3f, 0x64, 0x8b, 0xe4, 0x7a, 0xe5, 0x2e, 0x2a,
-  0x47, 0xe0, 0x5e, 0x45, 0x9e, 0x29, 0x00, 0xc6, 0xad, 0x20, 0xdd, 0x73,
-  0x87, 0x45, 0xa4, 0x7a, 0x02, 0xe1, 0xe6, 0x9a, 0x84, 0x3c, 0x10, 0x7d,
-  0xb2, 0x2e, 0xd4, 0xfa, 0x56, 0xf6, 0x37, 0xd7, 0xf9, 0xe0, 0x54, 0x04,
-  0x73, 0x22, 0x23, 0x27, 0x27, 0x27, 0x14, 0x50, 0x61, 0x39, 0x91, 0xc4,
-  0x8b, 0x53, 0x8f, 0xe0, 0x18, 0x46, 0x0f, 0xe6, 0x7e, 0x09, 0xb1, 0x22,
-  0x71, 0xc5, 0x0a, 0xe2, 0x2d, 0xac, 0x2e, 0x7e, 0xaf, 0x51, 0xfd, 0x8f,
-  0xdf, 0xbb, 0xa9, 0x94, 0x24, 0xd5, 0x9c, 0x9b, 0x19, 0x2c, 0xc0, 0x0d,
-  0x97, 0x42, 0xeb, 0x75, 0x55, 0x90, 0x45, 0x17, 0xc1, 0xbb, 0xcf, 0xe5,
-  0xab, 0x19, 0x49, 0x70, 0x7e, 0xf2, 0x74, 0x73, 0xce, 0x7f, 0x9a, 0xed,
-  0xdd, 0xfe, 0x24, 0xa6, 0xfa, 0x11, 0x57, 0x28, 0xf6, 0xe4, 0x7a, 0x39,
-  0xcd, 0x17, 0xc1, 0xe4, 0xed, 0x45, 0x73, 0x69, 0xa2, 0x86, 0x41, 0xb8,
-  0xb7, 0x38, 0x14, 0x8e, 0x85, 0x8c, 0xdb, 0x02, 0x9c, 0xa2, 0x1d, 0x6a,
-  0x25, 0xcb, 0xdb, 0x5f, 0x25, 0x50, 0x14, 0x21, 0x81, 0xae, 0x74, 0x11,
-  0x94, 0xf7, 0x48, 0xaf, 0xf3, 0x9f, 0x81, 0x28, 0xaf, 0x03, 0x1c, 0x37,
-  0x49, 0x1e, 0x9e, 0xec, 0x61, 0xdd, 0x22, 0xd9, 0x94, 0xe9, 0xd9, 0x1d,
-  0x0d, 0xcc, 0xa5, 0x4e, 0xdf, 0x75, 0x64, 0x4e, 0xf7, 0xf8, 0xd0, 0x9e,
-  0x29, 0xd5, 0xee, 0x2e, 0xd4, 0x29, 0x43, 0x97, 0x9e, 0xff, 0x79, 0xff,
-  0xef, 0xe0, 0x2c, 0xff, 0xa1, 0x8b, 0x80, 0x05, 0xe7, 0xd7, 0x45, 0x92,
-  0x0f, 0x37, 0x8b, 0x8d, 0x8b, 0x50, 0x54, 0x2f, 0x38, 0x18, 0xae, 0x86,
-  0xf4, 0x66, 0xc2, 0x83, 0x2f, 0x59, 0xa1, 0xd3, 0x97, 0xdd, 0xd7, 0x81,
-  0xfd, 0xea, 0x5b, 0x75, 0xcb, 0x8e, 0x52, 0xd2, 0xaa, 0x60, 0x66, 0x07,
-  0x33, 0xdc, 0x30, 0x1e, 0x3b, 0x0b, 0x09, 0x6f, 0x9f, 0x85, 0x83, 0x2e,
-  0xe0, 0x99, 0x28, 0x4a, 0x1b, 0x29, 0x62, 0x76, 0x06, 0x9e, 0xeb, 0xe9,
-  0xd7, 0x65, 0x3e, 0xcf, 0x2f, 0x6f, 0x82, 0x77, 0xcb, 0x65, 0xfe, 0xdd,
-  0x04, 0x68, 0x4c, 0xa8, 0x0d, 0x64, 0x38, 0xd8, 0x40, 0x1f, 0x81, 0xc3,
-  0xff, 0xbb, 0x5a, 0xce, 0xa0, 0x28, 0xe4, 0x29, 0x89, 0x1a, 0xb6, 0xea,
-  0xfc, 0xf4, 0x3f, 0xc8, 0x34, 0xfd, 0xb2, 0x80, 0xb0, 0x24, 0xea, 0xeb,
-  0x98, 0x26, 0x71, 0x6f, 0xc7, 0x54, 0xc4, 0xa4, 0x8a, 0x1e, 0xe7, 0x28,
-  0x12, 0xfe, 0xfc, 0x1f, 0x27, 0xc7, 0xb2, 0x51, 0x65, 0x1f, 0x3b, 0xa2,
-  0x4f, 0x14, 0xa5, 0x83, 0x07, 0x26, 0x1f, 0x0e, 0x0c, 0x59, 0xc6, 0xfd,
-  0x8d, 0xa9, 0xc3, 0x20, 0xf1, 0x99, 0x49, 0xd6, 0x13, 0x09, 0x6b, 0xce,
-  0xb7, 0xaf, 0xc5, 0xf5, 0x6a, 0xbd, 0x50, 0xab, 0xb5, 0x2e, 0x36, 0xb3,
-  0x6c, 0x02, 0xf6, 0x77, 0x8a, 0xdc, 0xd7, 0x83, 0x49, 0xc5, 0x72, 0x1b,
-  0x25, 0xec, 0x05, 0x77, 0x43, 0x22, 0xd0, 0x05, 0x89, 0x0f, 0x15, 0x11,
-  0x85, 0x4e, 0x44, 0xe7, 0xd5, 0x3f, 0x3a, 0x58, 0x42, 0xcc, 0xcc, 0xb4,
-  0x4e, 0x42, 0x28, 0xf7, 0x7d, 0x70, 0xad, 0x67, 0x11, 0x38, 0xd0, 0x69,
-  0x45, 0xcd, 0x69, 0xa2, 0xf4, 0xe4, 0x87, 0xba, 0x1a, 0xab, 0x08, 0x59,
-  0x37, 0xca, 0x96, 0x61, 0x66, 0x71, 0xdc, 0xae, 0x6c, 0x6f, 0xb3, 0x42,
-  0xaf, 0xd6, 0x79, 0xb1, 0x08, 0xde, 0x64, 0x97, 0xd9, 0x5a, 0xcd, 0x03,
-  0x5a, 0x22, 0xa3, 0xe8, 0x0a, 0x66, 0xaf, 0x89, 0x62, 0xe8, 0x36, 0x05,
-  0xda, 0x8a, 0x69, 0xd5, 0x2b, 0xbd, 0xe8, 0xd6, 0x0c, 0x86, 0x8c, 0x8e,
-  0x5b, 0xca, 0x86, 0x85, 0xde, 0x58, 0xc4, 0x9e, 0x70, 0xfa, 0x44, 0x7d,
-  0xed, 0x8e, 0xdb, 0x1f, 0xf2, 0x30, 0x37, 0x00, 0xbb, 0xb3, 0x29, 0x37,
-  0x20, 0x0e, 0xc3, 0x1c, 0x3f, 0xc5, 0xa1, 0x38, 0x21, 0x7d, 0x2d, 0x34,
-  0xf5, 0xba, 0x66, 0x01, 0x1f, 0x66, 0xdc, 0x8f, 0xd9, 0x80, 0x17, 0x33,
-  0x99, 0xb0, 0xba, 0x29, 0x05, 0x26, 0x75, 0x7a, 0x16, 0x5c, 0xbc, 0x7b,
-  0x33, 0xf8, 0x6a, 0xca, 0x54, 0x24, 0x86, 0x11, 0x75, 0x31, 0xba, 0x18,
-  0x1c, 0x20, 0x3c, 0xdd, 0xa2, 0x14, 0xda, 0x17, 0xa9, 0x4f, 0xd7, 0xcb,
-  0xe0, 0x43, 0xf0, 0xa6, 0xc8, 0xbe, 0xeb, 0xd1, 0x21, 0x6a, 0x72, 0x8b,
-  0x1f, 0xc5, 0x6d, 0xac, 0x56, 0x56, 0x13, 0x0c, 0xb7, 0x11, 0x3c, 0xbf,
-  0x4b, 0x31, 0x1f, 0x29, 0x11, 0xba, 0x6d, 0x39, 0xfc, 0x9c, 0x25, 0x85,
-  0x5a, 0x67, 0xcb, 0x4b, 0x7b, 0xba, 0x3b, 0xb4, 0xb5, 0x50, 0x84, 0x24,
-  0xb5, 0x3d, 0x1e, 0x9b, 0x98, 0xf2, 0x85, 0xd6, 0xc1, 0x64, 0x5b, 0x77,
-  0x34, 0xb9, 0xcf, 0x7c, 0x6d, 0x1f, 0xdb, 0x9b, 0xa4, 0x26, 0x0a, 0x4b,
-  0xa4, 0xad, 0x83, 0x7e, 0x89, 0x79, 0xe6, 0x69, 0x44, 0xcc, 0xcc, 0x9d,
-  0xa6, 0xcd, 0xcd, 0x60, 0x9e, 0xa7, 0x73, 0xbd, 0x0a, 0x28, 0x40, 0x14,
-  0x1c, 0x7f, 0xcd, 0x16, 0x57, 0x65, 0x3a, 0xec, 0xd9, 0x84, 0x75, 0x56,
-  0xbe, 0xe0, 0xfe, 0x13, 0x0f, 0xab, 0x50, 0xf7, 0xb9, 0xed, 0x96, 0x04,
-  0x34, 0x30, 0x09, 0x68, 0x83, 0x4e, 0x3b, 0x9b, 0x02, 0x21, 0xf6, 0x90,
-  0x14, 0x7d, 0x57, 0x43, 0x65, 0x50, 0xe9, 0xf0, 0x11, 0x28, 0x5b, 0x18,
-  0xcb, 0x3e, 0x2b, 0x1a, 0x9f, 0x5e, 0xe7, 0x6b, 0x1b, 0x10, 0xb8, 0x59,
-  0x03, 0x9d, 0xdc, 0xd1, 0xb1, 0x16, 0x97, 0x08, 0xcb, 0x27, 0x91, 0x96,
-  0x4e, 0xc2, 0xea, 0x8b, 0x77, 0x6e, 0xee, 0xdd, 0x05, 0xe2, 0x42, 0x1a,
-  0xa1, 0x92, 0x94, 0x78, 0x47, 0x9d, 0x90, 0xa8, 0x41, 0x86, 0x52, 0xa4,
-  0x27, 0x74, 0x9b, 0x9e, 0x10, 0x59, 0xa2, 0x21, 0x77, 0x6c, 0x08, 0x6f,
-  0x85, 0x13, 0x46, 0xc0, 0x46, 0x38, 0x2d, 0x70, 0x34, 0x40, 0x3a, 0xc2,
-  0x69, 0x2d, 0xc6, 0x01, 0x72, 0x84, 0xd3, 0xb6, 0x2e, 0xcd, 0xaa, 0x95,
-  0x75, 0x2a, 0x50, 0x56, 0xfc, 0x79, 0xe9, 0xec, 0x0d, 0xf8, 0xea, 0x5e,
-  0x1a, 0xe5, 0x11, 0xa4, 0x7a, 0x89, 0x42, 0xab, 0x3c, 0x86, 0xcf, 0x75,
-  0xb1, 0x9e, 0xeb, 0xe0, 0xb5, 0x56, 0xd3, 0xaf, 0xc1, 0x27, 0x3d, 0xcd,
-  0x97, 0x43, 0x5d, 0xc4, 0x09, 0xd8, 0xaa, 0x45, 0xd8, 0x13, 0xfe, 0x91,
-  0xe1, 0xbb, 0xfa, 0x9e, 0x5a, 0xf4, 0xfc, 0xc5, 0x3f, 0x7d, 0xd6, 0x73,
-  0x22, 0xaa, 0xce, 0x26, 0x42, 0x86, 0x51, 0x03, 0xcc, 0x1f, 0xcb, 0xec,
-  0x6a, 0xae, 0x6e, 0x82, 0x3f, 0xe4, 0x90, 0x0a, 0xb7, 0x20, 0x6d, 0x61,
-  0x00, 0x4d, 0x28, 0x93, 0xd7, 0xd6, 0xdc, 0x0c, 0x4d, 0x51, 0x6c, 0x50,
-  0x07, 0x48, 0xf3, 0x0c, 0x37, 0x98, 0x5c, 0x1e, 0x78, 0x09, 0x2d, 0x6c,
-  0x55, 0x3c, 0x99, 0x10, 0x62, 0x98, 0x78, 0xe9, 0x89, 0x02, 0x4b, 0x44,
-  0x91, 0x7b, 0x1e, 0xaa, 0xa2, 0xd1, 0x18, 0x48, 0x57, 0xa9, 0x76, 0x60,
-  0xd0, 0x4c, 0x48, 0xff, 0x9c, 0x4d, 0x6f, 0x85, 0xac, 0x2a, 0x61, 0xd4,
-  0x11, 0xce, 0x4f, 0xdd, 0x5a, 0x18, 0x7d, 0x9d, 0xee, 0x9d, 0xa9, 0x7f,
-  0xbf, 0x03, 0x08, 0x9f, 0x5f, 0x52, 0xac, 0x95, 0x7b, 0x95, 0x1b, 0x45,
-  0xf8, 0xab, 0x69, 0xf5, 0xc6, 0x28, 0x6b, 0xe6, 0x73, 0x7e, 0xfe, 0x54,
-  0x46, 0x37, 0xe3, 0x60, 0xaa, 0x83, 0x37, 0x47, 0x1e, 0xc5, 0xa4, 0x18,
-  0x9f, 0xf1, 0x94, 0xa7, 0x9c, 0x70, 0xcd, 0xab, 0x73, 0x17, 0x43, 0xe6,
-  0xa2, 0x9c, 0x79, 0xe5, 0xa1, 0xdf, 0x71, 0xbe, 0x58, 0xa8, 0x65, 0x1a,
-  0x54, 0x89, 0x10, 0xbf, 0x32, 0x08, 0x4f, 0x89, 0x27, 0xb9, 0x67, 0x67,
-  0x3b, 0x01, 0x32, 0x3f, 0x11, 0x49, 0x2a, 0x67, 0x61, 0x44, 0x81, 0x31,
-  0x26, 0x19, 0x50, 0x10, 0xa1, 0x8c, 0x6f, 0x01, 0xed, 0xd2, 0xeb, 0x82,
-  0x70, 0x9f, 0x3e, 0xfd, 0x66, 0xa2, 0x84, 0xdb, 0x08, 0x45, 0x3d, 0x5d,
-  0xc2, 0xd8, 0xc7, 0x23, 0x94, 0x1e, 0xd5, 0x84, 0x48, 0x8c, 0xda, 0x42,
-  0x3b, 0xf8, 0x0c, 0xb1, 0xa9, 0x3f, 0x3e, 0x0c, 0x24, 0x9d, 0x7c, 0xc6,
-  0x8a, 0x54, 0x84, 0x8f, 0x8c, 0xda, 0x18, 0xc5, 0xa4, 0x62, 0x04, 0xe1,
-  0x38, 0xcf, 0x5c, 0x7c, 0x14, 0x01, 0x3a, 0xda, 0xa1, 0x4e, 0x3e, 0x1d,
-  0xfa, 0x33, 0xda, 0x21, 0xb7, 0x0e, 0x9d, 0xa8, 0xd5, 0xcd, 0xe4, 0xfd,
-  0xc5, 0xd0, 0x01, 0x29, 0xd2, 0x66, 0xa8, 0x3f, 0xe9, 0xa9, 0xce, 0xbe,
-  0x0f, 0x7b, 0x8a, 0x01, 0x75, 0xa9, 0xcf, 0x1e, 0xa7, 0x17, 0xc2, 0x22,
-  0xfa, 0x39, 0x88, 0xf4, 0x51, 0x0e, 0x22, 0xca, 0x3f, 0xe0, 0xdd, 0x3d,
-  0xf6, 0x18, 0xf0, 0x87, 0x54, 0x46, 0xa3, 0x33, 0xbb, 0xfd, 0xd9, 0xe7,
-  0xa8, 0x35, 0x0f, 0xb7, 0x5d, 0x3c, 0x94, 0x44, 0xa6, 0x52, 0x84, 0x20,
-  0x89, 0xa5, 0x62, 0xce, 0x84, 0x06, 0x57, 0x53, 0x12, 0x1b, 0x1a, 0x05,
-  0x49, 0xf5, 0x07, 0x13, 0x9b, 0xe9, 0x6e, 0x28, 0x88, 0xfb, 0x67, 0x7b,
-  0x32, 0x7a, 0x41, 0x3d, 0xb4, 0x3d, 0x82, 0x2f, 0x52, 0xeb, 0xe7, 0x50,
-  0x20, 0x6e, 0x36, 0xa3, 0x9f, 0xa3, 0x15, 0x50, 0x30, 0xbf, 0x0e, 0x46,
-  0x23, 0x23, 0x02, 0x6c, 0x64, 0x64, 0x18, 0x09, 0xc4, 0x08, 0x0c, 0x23,
-  0x06, 0xf1, 0x93, 0x33, 0x22, 0xf0, 0x0c, 0xe7, 0x63, 0xfd, 0x19, 0xcd,
-  0xd2, 0x47, 0x30, 0x22, 0xe2, 0xb1, 0x90, 0xe4, 0xa1, 0x15, 0xe1, 0xc1,
-  0x9c, 0x18, 0x90, 0x36, 0xbb, 0x3d, 0xce, 0x37, 0x66, 0xd7, 0x36, 0xac,
-  0x4b, 0x27, 0xf3, 0x6c, 0xad, 0x1f, 0xaa, 0x11, 0x93, 0x4f, 0x78, 0xd3,
-  0x2c, 0x7b, 0x6b, 0x8f, 0xd8, 0x9b, 0xf6, 0x50, 0x0a, 0x89, 0xd9, 0x6c,
-  0x08, 0x07, 0x99, 0x80, 0xee, 0x37, 0x6f, 0x1e, 0x5f, 0x6d, 0x1d, 0xdc,
-  0x6c, 0x03, 0x01, 0xc9, 0x16, 0x4d, 0x32, 0x77, 0x3e, 0x01, 0x1d, 0x92,
-  0x4a, 0xc9, 0x16, 0x07, 0x20, 0xc1, 0x2a, 0x35, 0x19, 0x9e, 0x49, 0xea,
-  0xa6, 0x94, 0x8e, 0x94, 0xb6, 0x5c, 0x92, 0x51, 0x33, 0xdd, 0xc8, 0x26,
-  0x25, 0x33, 0xc9, 0x46, 0x4c, 0x0f, 0x30, 0x89, 0x5d, 0x30, 0x8d, 0x98,
-  0xc2, 0xc3, 0xc0, 0x64, 0x0b, 0x57, 0x3d, 0x3f, 0xb0, 0x78, 0x17, 0x60,
-  0xa3, 0x5e, 0xa5, 0xa3, 0x5e, 0xf9, 0x01, 0x9b, 0x3d, 0x12, 0x58, 0x42,
-  0x58, 0x7d, 0x27, 0xc2, 0x37, 0xee, 0x44, 0x04, 0x2a, 0x9f, 0x78, 0x70,
-  0xaa, 0xc4, 0x76, 0xb4, 0xe4, 0xa3, 0x2b, 0x4e, 0x98, 0x9f, 0x6f, 0x30,
-  0xa2, 0x1a, 0xb5, 0xca, 0x03, 0x55, 0x78, 0x30, 0xa8, 0xac, 0x39, 0x17,
-  0xcf, 0x0f, 0x2d, 0x1e, 0xa1, 0x79, 0x43, 0x23, 0x64, 0x84, 0xe6, 0x0f,
-  0x8d, 0x8d, 0xd0, 0xfc, 0xa1, 0x6d, 0x31, 0xff, 0x23, 0x34, 0xe9, 0xb5,
-  0x59, 0x1c, 0xcf, 0xb1, 0x10, 0xa6, 0x64, 0x17, 0x4c, 0x23, 0xa6, 0xd9,
-  0xb8, 0x45, 0xdc, 0xe9, 0xca, 0x86, 0x82, 0xcb, 0xd0, 0x97, 0x55, 0xc6,
-  0xe7, 0x7a, 0x35, 0x60, 0xa7, 0x15, 0x15, 0x18, 0x87, 0x69, 0x05, 0x8b,
-  0xb3, 0x66, 0xac, 0xfc, 0xc9, 0xc7, 0x8b, 0xa0, 0xec, 0xf6, 0x2e, 0x64,
-  0xf0, 0xfa, 0x5f, 0x43, 0x6b, 0xf8, 0x4e, 0x42, 0x1a, 0xde, 0xe1, 0x31,
-  0x25, 0xc5, 0x69, 0x6c, 0xb1, 0x64, 0x2a, 0x7f, 0x9f, 0x3d, 0x89, 0xf2,
-  0x50, 0xe8, 0xdb, 0xae, 0xb0, 0x7f, 0x77, 0x54, 0xe1, 0xa5, 0x3c, 0x53,
-  0x20, 0xb2, 0x7c, 0x6a, 0x62, 0xb8, 0x91, 0x7b, 0x4a, 0xcb, 0xf7, 0xb9,
-  0xa9, 0x0c, 0x59, 0x4c, 0x55, 0xaa, 0x4b, 0x4a, 0xdc, 0x34, 0x74, 0xc4,
-  0xe7, 0x30, 0xb4, 0x3e, 0x87, 0x61, 0x1b, 0xe7, 0x30, 0xdc, 0x9e, 0xc3,
-  0xdc, 0x03, 0x8a, 0x11, 0x1f, 0xea, 0x5b, 0xb6, 0x99, 0xb8, 0x73, 0x22,
-  0x7f, 0x66, 0xcb, 0xab, 0xeb, 0xf5, 0xdf, 0x2e, 0xde, 0x95, 0x8f, 0xf1,
-  0x50, 0x12, 0x08, 0x85, 0xa9, 0xb1, 0x05, 0xba, 0x91, 0xb2, 0xf8, 0x1f,
-  0x5d, 0xe4, 0x57, 0xf3, 0xb2, 0x13, 0x18, 0x1f, 0x64, 0x15, 0x58, 0x44,
-  0x87, 0xdc, 0xd3, 0x19, 0xe9, 0xfc, 0x1f
+/* Generated by tools/gen_gcdb.sh. Do not edit. */
+#pragma once
+
+/* Separately compressed chunk of the game controller database. */
+struct gcdb_chunk_s
+{
+	char first_guid[33];
+	unsigned long offset;
+	unsigned long len;
+	unsigned long txt_len;
+};
+
+static const unsigned char gcdb_bin[] = {
+  0xed, 0x58, 0xc9, 0x6e, 0xdb, 0x30, 0x10, 0xbd, 0xf7, 0x2b, 0x78, 0x8f,
+  0x52, 0x70, 0x13, 0x25, 0xf9, 0x96, 0x3a, 0x8e, 0x0b, 0x74, 0x89, 0x11,
+  0xb7, 0x40, 0xaf, 0x54, 0x44, 0x3b, 0x42, 0x6d, 0xd1, 0x90, 0x65, 0x34,
+  0xfd, 0xfb, 0x52, 0x0b, 0x99, 0x68, 0xb5, 0x64, 0x3b, 0x0b, 0x50, 0xfb,
+  0xa2, 0xa1, 0xb5, 0xcd, 0x7b, 0x33, 0xf3, 0x66, 0x44, 0x08, 0xf3, 0x9f,
+  0x8d, 0x99, 0xed, 0x50, 0x07, 0xb3, 0x85, 0x4d, 0x1c, 0xca, 0x16, 0x4c,
+  0x30, 0x9b, 0x60, 0x08, 0xad, 0x3b, 0x91, 0xc4, 0x72, 0x9e, 0xc8, 0x48,
+  0x00, 0x0c, 0xc6, 0x32, 0x52, 0xab, 0xd5, 0x4a, 0xc4, 0x16, 0x1f, 0xf9,
+  0xc8, 0xf2, 0x47, 0x3e, 0xb4, 0x7c, 0x7e, 0xff, 0x5b, 0x2d, 0xa0, 0x15,
+  0x6c, 0x02, 0xf9, 0x27, 0x52, 0xa6, 0xad, 0xcc, 0x95, 0x58, 0x24, 0xca,
+  0x64, 0xca, 0x8c, 0xc3, 0xe5, 0x43, 0x6a, 0x3b, 0xca, 0xde, 0x6d, 0x94,
+  0x41, 0xad, 0xf4, 0xec, 0xf6, 0x41, 0xee, 0x56, 0x81, 0x88, 0x47, 0x3e,
+  0xcb, 0xd6, 0x89, 0xba, 0x6e, 0x99, 0x2e, 0x5d, 0x2b, 0xbb, 0xe3, 0xe9,
+  0xbc, 0x93, 0xff, 0x61, 0x2e, 0xf0, 0xac, 0x6d, 0xc2, 0xe3, 0xf4, 0x91,
+  0xc8, 0x7a, 0x1c, 0xf9, 0xd4, 0xfa, 0x3b, 0xf2, 0x89, 0xb5, 0x59, 0xf1,
+  0x64, 0x21, 0xe3, 0xf5, 0xe8, 0x6b, 0x18, 0xed, 0x1e, 0xad, 0x0f, 0x50,
+  0x43, 0x73, 0x99, 0x82, 0xe5, 0xb8, 0x18, 0x12, 0x42, 0x18, 0x81, 0x18,
+  0xda, 0x0e, 0xf3, 0x14, 0xb4, 0x5f, 0xbe, 0x7c, 0x04, 0x84, 0xc1, 0x0a,
+  0x2c, 0x98, 0xc2, 0x42, 0x1a, 0x16, 0x7d, 0x82, 0x85, 0x9e, 0x60, 0xe1,
+  0x67, 0xb0, 0x88, 0x86, 0x05, 0xad, 0xe5, 0x2e, 0x0c, 0x44, 0xea, 0x6f,
+  0x19, 0x5f, 0x81, 0x37, 0x09, 0xd3, 0x27, 0xba, 0x25, 0xb0, 0x1c, 0x67,
+  0xcb, 0xc7, 0x11, 0x87, 0x99, 0xf1, 0x77, 0xc4, 0x51, 0x15, 0xbe, 0x5d,
+  0xfc, 0x91, 0xdf, 0xef, 0x95, 0xc9, 0xe0, 0xc5, 0x59, 0xf5, 0x04, 0x92,
+  0x5b, 0xea, 0x11, 0x54, 0x13, 0xc4, 0x52, 0x7e, 0x70, 0x5f, 0x7e, 0xa8,
+  0xc3, 0x10, 0x0b, 0x54, 0x22, 0x40, 0x86, 0x34, 0x3f, 0x53, 0xbe, 0x16,
+  0x1b, 0x1e, 0xd4, 0x88, 0x61, 0x9a, 0x97, 0x07, 0xf8, 0x91, 0x6a, 0x62,
+  0x94, 0xed, 0x1a, 0x66, 0xd4, 0x02, 0xe7, 0xd4, 0x28, 0x0b, 0x69, 0x6e,
+  0xdc, 0x2e, 0x6e, 0xbc, 0x32, 0x37, 0xf6, 0x50, 0x6e, 0x54, 0x08, 0xca,
+  0xe4, 0x50, 0x43, 0x0e, 0x36, 0xe4, 0x10, 0x4d, 0x8e, 0xd3, 0x45, 0x0e,
+  0xd1, 0xf4, 0xb8, 0xf9, 0x01, 0xa3, 0xec, 0x80, 0x10, 0xcc, 0x0c, 0xcb,
+  0xfd, 0x14, 0x26, 0xd7, 0x12, 0x7c, 0x9f, 0xcc, 0x09, 0x34, 0xc5, 0x80,
+  0x0b, 0x72, 0x5c, 0x4d, 0xce, 0x05, 0x37, 0x49, 0x73, 0xc9, 0xa1, 0xa1,
+  0xe6, 0x22, 0xb3, 0x15, 0x33, 0x97, 0xea, 0x7c, 0x13, 0x1f, 0x26, 0xd5,
+  0x59, 0x0b, 0x60, 0x73, 0x81, 0xa3, 0xd1, 0x78, 0x29, 0x1a, 0xb8, 0x0f,
+  0xcd, 0x22, 0x3f, 0x98, 0x75, 0x81, 0x26, 0xab, 0xf2, 0x59, 0x1e, 0xe6,
+  0x0c, 0x89, 0x5d, 0x20, 0xc1, 0x8d, 0xa5, 0xda, 0x19, 0x12, 0xe3, 0x11,
+  0x31, 0x1e, 0xd1, 0xbd, 0x1e, 0x2d, 0x50, 0xc5, 0xa3, 0xf9, 0x6e, 0x23,
+  0x62, 0x90, 0xfb, 0x25, 0xe3, 0xa4, 0xc1, 0xb1, 0x83, 0x29, 0x66, 0xc7,
+  0x79, 0x8c, 0xb5, 0xab, 0x5e, 0x63, 0x46, 0xdc, 0x8c, 0x09, 0x04, 0xb3,
+  0x58, 0x76, 0x28, 0x64, 0xdf, 0x92, 0x69, 0xa2, 0x5e, 0x67, 0x3a, 0xa9,
+  0x6a, 0x66, 0x8f, 0xb8, 0x94, 0x4a, 0x85, 0xd6, 0x44, 0xb5, 0xa3, 0x54,
+  0xba, 0x85, 0xd6, 0x30, 0x83, 0x3b, 0x99, 0xc9, 0x6a, 0xe5, 0x3f, 0xa5,
+  0xa6, 0x7a, 0x2c, 0x98, 0xb2, 0xbe, 0x85, 0xb1, 0x94, 0x8b, 0x1a, 0x21,
+  0xac, 0x51, 0x15, 0xf6, 0x28, 0xe1, 0x73, 0x59, 0x23, 0xa9, 0x3f, 0xb8,
+  0xdd, 0x1f, 0x1b, 0xfa, 0xf9, 0xd1, 0xf1, 0x4a, 0xa1, 0xba, 0x9a, 0xff,
+  0x9c, 0x83, 0xbb, 0xdb, 0x29, 0xf8, 0xb2, 0x8b, 0x78, 0x08, 0x48, 0xbd,
+  0x21, 0xc2, 0x03, 0x85, 0x1f, 0xe1, 0x01, 0x41, 0x6b, 0x94, 0xfe, 0x75,
+  0xb8, 0xbd, 0x47, 0x0a, 0x1a, 0xb3, 0x54, 0x43, 0x0a, 0x56, 0x42, 0xd9,
+  0x36, 0x2e, 0x6c, 0xac, 0x6c, 0x32, 0x2c, 0xac, 0xdd, 0xcd, 0x21, 0x0f,
+  0x2b, 0xd9, 0xa3, 0x05, 0x3e, 0xa4, 0x59, 0x54, 0x09, 0xb3, 0x4b, 0xea,
+  0x35, 0x96, 0xeb, 0x8d, 0x48, 0xc2, 0x24, 0x94, 0x91, 0x4e, 0xf8, 0x12,
+  0x8b, 0x4d, 0x5d, 0xdf, 0x68, 0x50, 0xeb, 0xdb, 0x02, 0x68, 0x17, 0x49,
+  0xe4, 0x16, 0xaf, 0xca, 0xdf, 0xf6, 0x5d, 0x6e, 0x95, 0x4c, 0xae, 0x25,
+  0x88, 0xa8, 0x0d, 0xae, 0x77, 0x7c, 0x05, 0xae, 0x22, 0xbe, 0x92, 0xcb,
+  0xda, 0x6b, 0xdd, 0x03, 0x63, 0xe7, 0x75, 0x35, 0xed, 0x22, 0xb0, 0xa6,
+  0x5a, 0x7a, 0x74, 0x6d, 0x56, 0x0e, 0x0c, 0xaa, 0xf5, 0xb4, 0xfa, 0x48,
+  0x83, 0x4d, 0x60, 0x60, 0x9f, 0xb6, 0x1d, 0x14, 0x7d, 0xc5, 0x33, 0x51,
+  0x29, 0xa8, 0xe2, 0x89, 0xb8, 0x07, 0x53, 0x11, 0x89, 0x6d, 0xb8, 0x05,
+  0x33, 0x4a, 0xdb, 0x7b, 0xf7, 0xb1, 0xf9, 0x5d, 0x26, 0x09, 0x56, 0xfb,
+  0xfa, 0xd0, 0xd1, 0xa6, 0x9d, 0xa4, 0x86, 0xec, 0xed, 0x35, 0x0c, 0x68,
+  0x8e, 0x82, 0x4a, 0xeb, 0xfd, 0x2c, 0xe3, 0xd0, 0xa4, 0x0e, 0x3b, 0x96,
+  0x16, 0x58, 0xa1, 0x85, 0xb4, 0x76, 0xdf, 0xcc, 0x69, 0xb4, 0x47, 0xb8,
+  0x0a, 0xa7, 0x75, 0x0f, 0x36, 0xc2, 0x95, 0x3a, 0x0d, 0x6e, 0x0c, 0x61,
+  0xb9, 0x72, 0xbd, 0x64, 0x60, 0x5f, 0x6a, 0x44, 0xd3, 0x00, 0x51, 0x13,
+  0xc0, 0x3b, 0x91, 0x16, 0x77, 0x7c, 0xcf, 0x03, 0x91, 0xea, 0xca, 0xcb,
+  0xa3, 0x7c, 0xff, 0xe9, 0x8b, 0x58, 0x43, 0xfa, 0xd6, 0x88, 0x9a, 0xfc,
+  0x9a, 0x4f, 0x4e, 0x26, 0x87, 0xb5, 0x9c, 0x3e, 0x2e, 0x23, 0x7a, 0x6a,
+  0x99, 0x9e, 0xae, 0xde, 0x38, 0x23, 0x5e, 0x38, 0xef, 0x89, 0x93, 0xa3,
+  0x43, 0xa4, 0x56, 0xd8, 0x61, 0xb4, 0x04, 0xf3, 0xac, 0xb8, 0xbf, 0x85,
+  0x51, 0xd8, 0x30, 0x33, 0x9d, 0xf2, 0x8b, 0xf4, 0xd9, 0x07, 0x7a, 0x37,
+  0x4c, 0x3e, 0x6c, 0xf0, 0xd2, 0x30, 0xdd, 0x02, 0x66, 0x29, 0x98, 0xb3,
+  0x31, 0x98, 0x44, 0xcb, 0x30, 0x12, 0x19, 0xc2, 0xa6, 0xed, 0x96, 0x83,
+  0x83, 0x6a, 0x42, 0xb1, 0xcf, 0x33, 0x1a, 0x34, 0xa5, 0xd9, 0x54, 0xac,
+  0x81, 0xfa, 0x3e, 0x3c, 0x0b, 0x4e, 0x3a, 0x3a, 0x17, 0xdd, 0xc7, 0xcb,
+  0x87, 0xbf, 0x4a, 0x86, 0xaa, 0xd1, 0x6f, 0xcd, 0x23, 0xe5, 0x11, 0xb8,
+  0x1d, 0xff, 0xb8, 0x02, 0xd9, 0x26, 0xca, 0x6d, 0x24, 0xde, 0x64, 0x03,
+  0x05, 0x1f, 0xbd, 0x81, 0xd2, 0xb9, 0xbb, 0xe4, 0x0c, 0x50, 0x2f, 0x5b,
+  0xb4, 0x36, 0xec, 0x32, 0x6b, 0x14, 0xcc, 0xe6, 0xf4, 0xb5, 0x44, 0x8c,
+  0x93, 0xde, 0x0c, 0x75, 0x7e, 0x36, 0xd8, 0x07, 0x25, 0xd2, 0x62, 0x00,
+  0x25, 0xaf, 0xa9, 0xeb, 0x43, 0x29, 0x39, 0x5d, 0x6d, 0x31, 0xd6, 0x40,
+  0x89, 0xfa, 0xc2, 0x7b, 0x9d, 0xac, 0x68, 0xd6, 0x9e, 0x01, 0x39, 0xd2,
+  0xa2, 0x3d, 0xa7, 0x4b, 0x19, 0xe6, 0x98, 0x51, 0xa7, 0xcc, 0xcf, 0x59,
+  0x61, 0x20, 0xe3, 0x7d, 0xe6, 0xa3, 0x73, 0x12, 0x41, 0xe6, 0xbf, 0x63,
+  0xa2, 0xde, 0x53, 0xa7, 0x67, 0x81, 0xd9, 0xac, 0x7b, 0x46, 0xd4, 0xe4,
+  0x7a, 0x3a, 0x01, 0x6a, 0x3a, 0x7d, 0x8b, 0x7a, 0xbb, 0x38, 0xbe, 0xe0,
+  0x2e, 0x4e, 0x58, 0x71, 0xa2, 0x43, 0xad, 0xcf, 0x93, 0x22, 0x74, 0x69,
+  0xbf, 0x06, 0x7f, 0x96, 0x24, 0xd7, 0xae, 0xec, 0xd3, 0xb5, 0x8d, 0x42,
+  0xff, 0x65, 0x5e, 0xfd, 0x03,
+  0xed, 0x99, 0x4b, 0x73, 0xdb, 0x36, 0x10, 0xc7, 0xef, 0xfd, 0x14, 0x38,
+  0x36, 0x13, 0xa6, 0x03, 0x80, 0x0f, 0x51, 0xbc, 0xc9, 0x4e, 0xd2, 0x34,
+  0x53, 0xab, 0x6a, 0x68, 0xcf, 0xb8, 0xbd, 0x81, 0x0f, 0x49, 0x18, 0x51,
+  0x00, 0x87, 0xa4, 0x6a, 0xe9, 0xdb, 0x77, 0xf9, 0x8c, 0x48, 0x53, 0x0f,
+  0x8a, 0x6a, 0xe8, 0xc6, 0xd1, 0x85, 0x80, 0x25, 0xc2, 0xd8, 0x1f, 0x16,
+  0xbb, 0x7f, 0x2c, 0xb0, 0x8a, 0xf3, 0x8f, 0x87, 0xe7, 0xe9, 0xc3, 0xd4,
+  0x31, 0x49, 0x9f, 0xa4, 0x78, 0x2a, 0x9f, 0x64, 0xc4, 0x91, 0xfd, 0xc4,
+  0x13, 0x77, 0x89, 0xec, 0x30, 0xe0, 0x09, 0x9a, 0x31, 0x0f, 0xcd, 0x22,
+  0xa9, 0x30, 0xcb, 0xc1, 0x8a, 0x63, 0x39, 0x44, 0x71, 0x98, 0xbb, 0xb2,
+  0x1c, 0x43, 0xf1, 0x42, 0x4f, 0x3e, 0x09, 0x6b, 0x89, 0x7f, 0xd1, 0xa0,
+  0x1d, 0xf8, 0xf3, 0x24, 0x6d, 0x9b, 0xd0, 0x8e, 0xf8, 0x62, 0x99, 0x75,
+  0x28, 0x74, 0x36, 0x61, 0xda, 0x22, 0xca, 0x62, 0xc3, 0x3d, 0xdf, 0x72,
+  0x4c, 0x25, 0xfd, 0x65, 0xbc, 0x94, 0x9b, 0xc0, 0xf3, 0x23, 0xcb, 0xd1,
+  0xf2, 0x7e, 0xc2, 0xd3, 0x41, 0xc7, 0x59, 0x27, 0x81, 0xf7, 0x17, 0xf0,
+  0x1d, 0xa3, 0x59, 0x77, 0x6b, 0x31, 0x9c, 0x35, 0x76, 0x16, 0x23, 0x4a,
+  0x36, 0xf6, 0xd7, 0xd7, 0xf5, 0xe2, 0x0f, 0xf9, 0xfb, 0x04, 0xe7, 0xdd,
+  0x6a, 0x84, 0xe2, 0x6b, 0x18, 0x42, 0xcd, 0x5b, 0x30, 0x86, 0xa6, 0xc4,
+  0x09, 0x8b, 0x12, 0xcb, 0x19, 0x29, 0x5b, 0xcb, 0xa1, 0xca, 0xce, 0x72,
+  0x54, 0x25, 0x0c, 0x58, 0x32, 0x97, 0xd1, 0xda, 0xfa, 0x9d, 0x8b, 0xcd,
+  0x56, 0xf9, 0x09, 0x37, 0x49, 0x19, 0x45, 0x9f, 0xee, 0x93, 0xfa, 0x98,
+  0x0e, 0xc9, 0xc5, 0x02, 0xdd, 0xca, 0xf5, 0x9a, 0x09, 0x98, 0x11, 0x7a,
+  0x74, 0xe4, 0x16, 0xa9, 0x06, 0x7e, 0x06, 0xcc, 0xbc, 0x10, 0x18, 0xc1,
+  0xc7, 0x88, 0x11, 0x52, 0x43, 0x06, 0xcb, 0xd2, 0x15, 0x19, 0xad, 0x23,
+  0x03, 0x2a, 0x25, 0x32, 0x5a, 0x21, 0x53, 0x4b, 0x64, 0xe3, 0x2e, 0xc8,
+  0x46, 0x79, 0x97, 0x90, 0x56, 0x64, 0x76, 0xfa, 0xff, 0xd1, 0x9a, 0x0b,
+  0x8e, 0x34, 0xf4, 0xf3, 0xcc, 0xd6, 0xde, 0xa4, 0xc8, 0x48, 0x8a, 0x8c,
+  0xf6, 0x45, 0x46, 0x8f, 0x22, 0xc3, 0x75, 0x2f, 0x53, 0x4f, 0x00, 0x22,
+  0x0d, 0x9f, 0xd2, 0x6a, 0x30, 0xf0, 0x99, 0x30, 0xcc, 0x4e, 0x30, 0xd4,
+  0x81, 0x60, 0x80, 0xff, 0x74, 0x82, 0x01, 0xde, 0x72, 0x01, 0x8c, 0x31,
+  0x6d, 0x83, 0x31, 0x93, 0xab, 0x95, 0x2f, 0xd0, 0xbd, 0xdc, 0x44, 0x82,
+  0xad, 0x7d, 0x91, 0xa0, 0xf7, 0x8f, 0x65, 0xe8, 0xe9, 0x47, 0xa2, 0xcd,
+  0xfe, 0x93, 0x16, 0xf7, 0x33, 0x91, 0xb1, 0x36, 0x13, 0xbf, 0xf8, 0x2c,
+  0x40, 0x93, 0xc8, 0x65, 0x9e, 0x9f, 0x5a, 0x86, 0x60, 0x04, 0x34, 0xe5,
+  0x22, 0xf1, 0x85, 0x27, 0x8b, 0xb0, 0x9b, 0x5a, 0x4b, 0xaf, 0x12, 0x37,
+  0x3a, 0xae, 0x7b, 0xd7, 0xb8, 0x41, 0x3a, 0xc7, 0x0d, 0x35, 0x45, 0x87,
+  0x4f, 0xa2, 0x73, 0x49, 0x0b, 0xba, 0x10, 0xd2, 0x50, 0x83, 0x14, 0x04,
+  0x5d, 0x91, 0x44, 0x32, 0x08, 0xfc, 0x68, 0xb0, 0xcd, 0xf2, 0x1c, 0xda,
+  0x9a, 0xc7, 0x2e, 0x81, 0x9f, 0xaa, 0x57, 0xc7, 0x77, 0xa6, 0xe7, 0xf9,
+  0xfe, 0x01, 0x7c, 0x77, 0x59, 0x74, 0x79, 0x41, 0xa8, 0xfa, 0x03, 0xd2,
+  0xbb, 0x00, 0x2a, 0xdc, 0x0a, 0x9b, 0xcd, 0xe8, 0x33, 0x59, 0x71, 0x98,
+  0x45, 0x88, 0x6e, 0x37, 0x71, 0x22, 0xd7, 0x31, 0x82, 0xf0, 0x9b, 0xe7,
+  0xef, 0x1a, 0x27, 0x42, 0xaf, 0xaa, 0x78, 0xfe, 0xa3, 0xf8, 0x03, 0x16,
+  0x99, 0xfb, 0xd6, 0x92, 0xa2, 0xa5, 0xdc, 0x3f, 0x71, 0x01, 0x96, 0x51,
+  0x34, 0xf1, 0x58, 0x98, 0xe4, 0x5b, 0xa6, 0x5f, 0x9c, 0xa9, 0x5b, 0x65,
+  0x1c, 0x5b, 0x7d, 0xed, 0xf4, 0xea, 0x8f, 0x8e, 0xaf, 0x7e, 0x9b, 0x90,
+  0xa3, 0x5d, 0xa2, 0xcb, 0x57, 0x30, 0xbe, 0x5e, 0x03, 0x33, 0xfd, 0xf0,
+  0x78, 0x8f, 0xec, 0xe9, 0x07, 0xbb, 0x11, 0x4f, 0xda, 0xe1, 0xbc, 0x85,
+  0x99, 0x17, 0x6c, 0xde, 0x81, 0x35, 0x25, 0x9a, 0xb7, 0x59, 0x1b, 0xc8,
+  0xbc, 0x63, 0xcf, 0xd3, 0xcd, 0x89, 0xf5, 0x35, 0x2e, 0x32, 0x43, 0x6d,
+  0xac, 0xef, 0x83, 0x7d, 0x83, 0x7e, 0x85, 0xb4, 0x09, 0x3b, 0xfd, 0xd5,
+  0x2d, 0x2d, 0xc5, 0x6e, 0xd6, 0xd0, 0x71, 0xf9, 0xc9, 0x99, 0xdc, 0x31,
+  0x91, 0x30, 0xf4, 0x7e, 0xc3, 0x02, 0x98, 0x0c, 0xe8, 0x2b, 0xda, 0x5f,
+  0x94, 0x0f, 0x14, 0xf2, 0x0e, 0x91, 0x39, 0x21, 0xc5, 0x9b, 0x64, 0x2a,
+  0x6f, 0xf9, 0x0d, 0x32, 0x69, 0x34, 0x71, 0x13, 0x34, 0xd9, 0xf2, 0x78,
+  0xb6, 0xe7, 0x32, 0x6a, 0x19, 0xed, 0xf0, 0x15, 0xc9, 0x98, 0x3d, 0xc1,
+  0x8c, 0xbb, 0x70, 0x01, 0x8a, 0x65, 0x98, 0x24, 0x27, 0xc1, 0x00, 0x0d,
+  0xbf, 0x96, 0x0b, 0xfe, 0xf6, 0x23, 0x19, 0x06, 0x1b, 0x48, 0x02, 0xda,
+  0x60, 0xc7, 0x91, 0x9e, 0x6e, 0xc3, 0xb4, 0xde, 0x99, 0xb2, 0xa2, 0x43,
+  0x7e, 0xd0, 0x39, 0x48, 0x87, 0x36, 0x7d, 0xe7, 0x26, 0x92, 0x72, 0x85,
+  0xee, 0x58, 0x94, 0x4a, 0x08, 0x6d, 0x70, 0x79, 0xfa, 0xa2, 0x58, 0x91,
+  0x97, 0xcd, 0xea, 0x9b, 0x9c, 0x7f, 0xce, 0x64, 0x35, 0x1f, 0xb5, 0xb2,
+  0x7a, 0x10, 0xfc, 0x1f, 0x3f, 0x8a, 0xe1, 0x00, 0x59, 0x55, 0x0d, 0x6e,
+  0x24, 0x8b, 0xbc, 0xef, 0xb1, 0x50, 0x40, 0x74, 0x32, 0xce, 0xd2, 0x96,
+  0x31, 0x32, 0xeb, 0x2a, 0x47, 0x70, 0x78, 0x67, 0x87, 0x1e, 0x8c, 0x67,
+  0xa9, 0xbc, 0x6f, 0xc6, 0xaa, 0xab, 0x1c, 0xb5, 0xbe, 0x95, 0xf4, 0xce,
+  0x2a, 0x47, 0x3b, 0x63, 0x2b, 0xa9, 0xf5, 0x9c, 0x95, 0xc9, 0x1c, 0xed,
+  0x30, 0x94, 0x79, 0xa5, 0x60, 0xb5, 0x1a, 0x14, 0xfb, 0xe3, 0xed, 0xb7,
+  0xd3, 0xae, 0x1d, 0x74, 0x19, 0xa5, 0xd4, 0x2d, 0x8b, 0xa6, 0x35, 0x87,
+  0xfe, 0x93, 0x09, 0x07, 0x74, 0x59, 0x24, 0x85, 0x5f, 0x55, 0x43, 0x20,
+  0x08, 0x7c, 0x96, 0xbb, 0x8c, 0xde, 0x0b, 0xab, 0x03, 0x5e, 0x56, 0xf8,
+  0xdb, 0x33, 0x5e, 0x6d, 0x31, 0xfe, 0x0f, 0x27, 0xe6, 0x1e, 0x67, 0xa2,
+  0xb4, 0xbf, 0xb4, 0x7d, 0xe0, 0x4a, 0xe8, 0xe0, 0x09, 0x63, 0x0f, 0x9b,
+  0xde, 0xea, 0x33, 0x6c, 0x21, 0x7f, 0x40, 0x3b, 0x04, 0x8d, 0x76, 0xf6,
+  0xb5, 0x01, 0x0b, 0xcd, 0x83, 0x27, 0xdc, 0x3d, 0x6c, 0xdd, 0x7c, 0xed,
+  0x55, 0x43, 0xd3, 0x68, 0xa6, 0x4e, 0x0c, 0xa6, 0xd6, 0x53, 0xf3, 0xa7,
+  0x5d, 0xe8, 0x47, 0x2b, 0x2e, 0xd0, 0x3d, 0xc8, 0x15, 0x68, 0xb6, 0x9c,
+  0xb6, 0xb5, 0x86, 0xad, 0x67, 0xdc, 0xef, 0x55, 0x73, 0xd3, 0x4f, 0xce,
+  0xc8, 0x34, 0x89, 0x51, 0x9c, 0x72, 0x1b, 0x33, 0x7a, 0x1c, 0x93, 0xd7,
+  0x7a, 0x7f, 0x59, 0xc2, 0x99, 0xcf, 0xb1, 0x53, 0xaf, 0x0a, 0x97, 0x70,
+  0xa6, 0x86, 0xb6, 0x5f, 0x13, 0x2c, 0xbc, 0xfa, 0xba, 0x37, 0x2c, 0xe7,
+  0x62, 0x38, 0xe4, 0x96, 0x47, 0xac, 0xcb, 0x6a, 0xde, 0xd4, 0x6b, 0x94,
+  0x74, 0x3f, 0xff, 0x65, 0x5f, 0xaf, 0xd0, 0xf9, 0x7f, 0xbd, 0x50, 0x29,
+  0xe9, 0x8c, 0xd4, 0x06, 0x9d, 0x3b, 0xb6, 0x9b, 0x07, 0x2c, 0x5e, 0xc2,
+  0xf9, 0x6b, 0xc1, 0x5d, 0x34, 0xb5, 0xab, 0x85, 0xd7, 0x2e, 0x16, 0xd3,
+  0x87, 0x20, 0x1d, 0x93, 0xd5, 0xb0, 0x14, 0x9d, 0x44, 0x74, 0x59, 0x08,
+  0x3a, 0x26, 0xa2, 0x4f, 0x87, 0xaf, 0xfc, 0x3e, 0x96, 0x1d, 0xf7, 0x98,
+  0xef, 0x9b, 0xc6, 0xbf,
+  0xed, 0x99, 0x5d, 0x97, 0x9a, 0x38, 0x18, 0x80, 0xef, 0xf7, 0x57, 0xe4,
+  0x7e, 0x98, 0x3d, 0x49, 0x08, 0x08, 0xdc, 0xcd, 0xd8, 0xe9, 0xec, 0x99,
+  0x53, 0xf7, 0xb8, 0xb2, 0x7b, 0xa6, 0xb7, 0x89, 0x44, 0xa5, 0x65, 0xc4,
+  0x83, 0x30, 0xd5, 0x5e, 0xec, 0x6f, 0xdf, 0x40, 0x02, 0x12, 0x44, 0xf1,
+  0x6b, 0x3b, 0x6d, 0xad, 0x37, 0x24, 0x28, 0x21, 0xef, 0x93, 0xf7, 0x5b,
+  0x68, 0xc2, 0xe2, 0x83, 0x09, 0x9e, 0xe4, 0x57, 0x17, 0xc1, 0xf2, 0x53,
+  0x8c, 0x8c, 0x07, 0xba, 0x5c, 0xfb, 0x83, 0x8f, 0xe0, 0xc1, 0x1f, 0xdc,
+  0x8a, 0x2f, 0x91, 0x41, 0x3d, 0x06, 0x0d, 0xe6, 0x31, 0x64, 0x30, 0x3a,
+  0xfe, 0xec, 0x31, 0xdb, 0x08, 0x16, 0x41, 0xfc, 0x65, 0xee, 0xcd, 0xe0,
+  0xef, 0x44, 0x8c, 0x23, 0x3e, 0x49, 0xf3, 0xb1, 0x23, 0xc6, 0x49, 0x38,
+  0x9d, 0x15, 0x13, 0x2c, 0x26, 0xd9, 0x22, 0x1f, 0x21, 0x63, 0x9a, 0x85,
+  0x01, 0xf7, 0x98, 0x63, 0xe4, 0xbf, 0x5c, 0xce, 0xe2, 0x2c, 0x0a, 0x78,
+  0xe2, 0x31, 0x22, 0xe7, 0x69, 0x98, 0x2f, 0xea, 0x16, 0x93, 0x54, 0x3c,
+  0x3f, 0x15, 0xdf, 0x51, 0x5c, 0x4c, 0x57, 0x1e, 0x85, 0xc5, 0x60, 0xed,
+  0x51, 0x64, 0x14, 0x6b, 0x6f, 0x1e, 0xb7, 0xd4, 0x0d, 0xf9, 0x3c, 0x82,
+  0x72, 0x5a, 0xad, 0xa0, 0xbe, 0x16, 0x4b, 0x98, 0x72, 0x24, 0xd6, 0x20,
+  0xc6, 0x32, 0xa5, 0x49, 0xea, 0xb1, 0x9e, 0xb1, 0xf2, 0x18, 0x36, 0xd6,
+  0x1e, 0x33, 0x8d, 0x45, 0x44, 0xd3, 0x49, 0x9c, 0xbc, 0x78, 0x1f, 0xc2,
+  0x79, 0xb6, 0x32, 0x7e, 0x83, 0x0d, 0x40, 0x93, 0x5e, 0x85, 0x47, 0x02,
+  0x1a, 0xd0, 0xf5, 0x24, 0xa2, 0xcb, 0x19, 0x18, 0xd0, 0x69, 0x38, 0x06,
+  0x3e, 0x18, 0x26, 0xf1, 0xd5, 0x42, 0xb2, 0xa0, 0x5b, 0x0c, 0xac, 0x86,
+  0x16, 0xf9, 0xf1, 0x7c, 0x0d, 0x86, 0x3e, 0x06, 0x0b, 0x1a, 0x80, 0x2f,
+  0x61, 0x3a, 0x03, 0xfe, 0x8b, 0x58, 0xf5, 0x29, 0x5e, 0x83, 0xbb, 0x80,
+  0x2e, 0x52, 0x9e, 0xe4, 0xc8, 0x70, 0x1d, 0x99, 0x7b, 0x2c, 0x32, 0x9d,
+  0x94, 0x5d, 0x27, 0x85, 0xa0, 0x86, 0x4a, 0x61, 0xdc, 0x8b, 0xaa, 0xa7,
+  0xa3, 0x42, 0x3a, 0x2a, 0xb6, 0x41, 0x85, 0x2b, 0x54, 0x66, 0x89, 0xca,
+  0xc9, 0x51, 0x99, 0x39, 0x2a, 0xd8, 0x89, 0xca, 0xb6, 0x1d, 0x47, 0x43,
+  0x35, 0x18, 0x3a, 0x8e, 0x6d, 0x03, 0x3f, 0x5b, 0xf0, 0x04, 0xbc, 0xcb,
+  0x68, 0x04, 0xee, 0xe3, 0xd5, 0xb5, 0xd2, 0xe1, 0x8e, 0xba, 0xb3, 0x65,
+  0x6d, 0xcf, 0x61, 0x08, 0xfa, 0x62, 0xb4, 0x14, 0x36, 0x57, 0x53, 0x21,
+  0x94, 0x43, 0x82, 0x0a, 0x92, 0x73, 0xa2, 0xd5, 0x29, 0x20, 0x95, 0xb8,
+  0x94, 0xe8, 0x80, 0xec, 0x4e, 0x40, 0xa5, 0x29, 0x55, 0x8f, 0xf4, 0xf6,
+  0x11, 0x71, 0x2b, 0x22, 0x78, 0x37, 0x11, 0x5b, 0x12, 0x71, 0x9c, 0x86,
+  0xbe, 0xf4, 0xd7, 0x4c, 0x28, 0xca, 0x23, 0x0d, 0xa6, 0x3c, 0x15, 0x97,
+  0x17, 0xde, 0xcf, 0x18, 0x07, 0xfd, 0x78, 0x9e, 0x26, 0x71, 0x14, 0x49,
+  0x2a, 0xca, 0x17, 0x9d, 0xa0, 0x32, 0x95, 0x6f, 0x38, 0x40, 0x29, 0xec,
+  0x9d, 0xee, 0xa4, 0x26, 0xf3, 0xbf, 0x47, 0xf9, 0x13, 0x07, 0x12, 0x29,
+  0x2a, 0xd1, 0xfd, 0xc9, 0x63, 0x42, 0x5f, 0xc3, 0x65, 0x21, 0xee, 0x50,
+  0x78, 0x14, 0xe5, 0x72, 0x8b, 0xc3, 0xc7, 0xcd, 0xc3, 0xbf, 0xa1, 0xa8,
+  0x94, 0xf6, 0x56, 0xec, 0xbe, 0x14, 0xf6, 0xa6, 0x18, 0x0b, 0x59, 0x6f,
+  0x29, 0x6a, 0xf5, 0xb2, 0xb5, 0xe3, 0x6e, 0x77, 0xa3, 0xb5, 0xc3, 0xad,
+  0x1f, 0x24, 0xdc, 0x2f, 0x93, 0xb8, 0x14, 0x81, 0x04, 0x32, 0x29, 0x0b,
+  0x2a, 0x65, 0x7a, 0xe2, 0xcb, 0x25, 0xf8, 0x9b, 0x8f, 0x67, 0xe0, 0xf1,
+  0xf1, 0xc1, 0x85, 0x2e, 0x18, 0xf6, 0xc1, 0x88, 0x8f, 0xe3, 0x30, 0xda,
+  0xb2, 0x7e, 0xe7, 0x3c, 0xeb, 0x27, 0xfb, 0xac, 0xdf, 0x3e, 0x3a, 0x8c,
+  0xa0, 0x9d, 0xba, 0xbe, 0x09, 0x23, 0x78, 0x5b, 0xd7, 0x61, 0x27, 0xa2,
+  0x12, 0x4d, 0x0b, 0xa2, 0xc2, 0x31, 0xde, 0xcd, 0x69, 0x14, 0x4f, 0xc1,
+  0x28, 0x7b, 0x61, 0x11, 0xaf, 0x20, 0x99, 0xdf, 0x00, 0x92, 0x75, 0xb0,
+  0x35, 0x9c, 0x0e, 0xa9, 0xd0, 0x23, 0xd4, 0x0d, 0x09, 0x37, 0x20, 0xf9,
+  0x34, 0x4c, 0xf9, 0x67, 0x30, 0x34, 0x1d, 0x78, 0xbd, 0x4c, 0x10, 0xd4,
+  0x98, 0xfc, 0x45, 0xe7, 0x8c, 0x02, 0x91, 0x6e, 0x14, 0xaf, 0x06, 0xc3,
+  0x28, 0x5b, 0x6e, 0xe5, 0x68, 0xcd, 0x5c, 0xcb, 0xd2, 0xc5, 0xeb, 0x75,
+  0x8b, 0x47, 0x1a, 0xf2, 0xd8, 0xda, 0xde, 0xf1, 0x61, 0x7e, 0x41, 0xec,
+  0x5d, 0x9e, 0x27, 0xd2, 0xf6, 0x7e, 0x97, 0x8c, 0x69, 0xc0, 0x2b, 0x11,
+  0xaa, 0x93, 0x2d, 0x63, 0x1d, 0x82, 0x17, 0x4a, 0x31, 0xad, 0x53, 0x93,
+  0x81, 0x1d, 0x62, 0xa3, 0x0e, 0xb1, 0x31, 0x2a, 0x93, 0x45, 0x57, 0x13,
+  0x7b, 0x44, 0xbf, 0x8a, 0xb8, 0xe6, 0xf3, 0xe4, 0x95, 0x46, 0x6f, 0x92,
+  0x4f, 0x5b, 0x67, 0xe7, 0xd3, 0x64, 0x5f, 0xd0, 0x3f, 0x24, 0xfe, 0x6d,
+  0xe0, 0x28, 0x7d, 0xd6, 0xe1, 0x8c, 0x68, 0xf8, 0x29, 0xdb, 0x1d, 0xf8,
+  0x8e, 0xcd, 0x7a, 0xf0, 0x11, 0xd6, 0x2e, 0xe4, 0x38, 0x33, 0x4c, 0xb4,
+  0xd2, 0xb1, 0x8e, 0x8a, 0xa4, 0x1b, 0x3a, 0xa8, 0x9d, 0x4e, 0x3c, 0x17,
+  0x45, 0x07, 0x01, 0xef, 0xf3, 0xd5, 0x45, 0xe5, 0xf1, 0x0b, 0x95, 0x00,
+  0x44, 0x5a, 0x50, 0x0d, 0xe9, 0x3c, 0x9d, 0xf1, 0x84, 0xe6, 0xb4, 0x7e,
+  0x41, 0x82, 0xb8, 0x0b, 0x92, 0xf9, 0x36, 0x90, 0x2e, 0x9a, 0x9b, 0xed,
+  0xaa, 0x43, 0x0e, 0x85, 0x64, 0x42, 0xaa, 0x55, 0x66, 0x12, 0xd2, 0x73,
+  0x18, 0x05, 0x63, 0x9a, 0x5e, 0x6b, 0x03, 0xa4, 0xa2, 0x63, 0xc1, 0x9e,
+  0x56, 0xb0, 0xd4, 0x1c, 0x36, 0x18, 0xc4, 0x2c, 0x94, 0xf9, 0xaa, 0x86,
+  0xe8, 0xe4, 0x08, 0x8e, 0xf7, 0x57, 0xf7, 0xe6, 0xd1, 0x61, 0xad, 0x51,
+  0xdd, 0x93, 0x63, 0xc2, 0x9a, 0xd0, 0xb8, 0x32, 0xc1, 0x27, 0xdd, 0x98,
+  0x9c, 0xd6, 0xb8, 0x56, 0x77, 0x47, 0xe0, 0xe1, 0x35, 0x2e, 0x93, 0x1f,
+  0xbf, 0xcc, 0x7c, 0x2e, 0x63, 0x7a, 0xe6, 0x8f, 0xea, 0x9f, 0x58, 0x2b,
+  0xb5, 0xe7, 0x38, 0x7a, 0xe5, 0x49, 0x38, 0xe7, 0x02, 0x9b, 0xd5, 0x68,
+  0x00, 0xfc, 0x8c, 0x0e, 0x3d, 0x8d, 0xb3, 0xf1, 0x4c, 0x44, 0xf5, 0xe2,
+  0x24, 0x0f, 0xa0, 0x47, 0x44, 0xa5, 0x94, 0x7f, 0x48, 0xa3, 0x37, 0x39,
+  0xe2, 0x02, 0xd4, 0x3f, 0xfe, 0x3d, 0xf8, 0xd3, 0x26, 0xa0, 0x98, 0x0c,
+  0xe3, 0x24, 0x35, 0x6e, 0xd4, 0xcb, 0x05, 0xae, 0x1b, 0xf5, 0xf6, 0x5c,
+  0xc6, 0xdb, 0xf2, 0xb6, 0xab, 0x86, 0xeb, 0x62, 0xe7, 0x34, 0xb7, 0x1a,
+  0x56, 0xf3, 0x73, 0x0c, 0x97, 0x64, 0x8b, 0xc6, 0x8b, 0xe4, 0xca, 0x54,
+  0xcb, 0x81, 0x35, 0x55, 0xaf, 0x61, 0xa4, 0x87, 0xd4, 0x52, 0xa8, 0xaa,
+  0x8c, 0xc8, 0x3e, 0x99, 0xa5, 0x93, 0xb6, 0x64, 0xdb, 0xba, 0xaa, 0x87,
+  0xfe, 0xc8, 0xc2, 0xa7, 0x90, 0xb6, 0xb5, 0x8b, 0xb6, 0x9a, 0x69, 0xb8,
+  0x92, 0x08, 0x91, 0x8d, 0x48, 0xd6, 0x46, 0x26, 0xb1, 0x77, 0x29, 0x94,
+  0xd2, 0x8f, 0x63, 0x34, 0xa0, 0xb7, 0xf3, 0xc8, 0xad, 0x7d, 0x15, 0xa0,
+  0xd9, 0x2d, 0xb1, 0x0b, 0x1d, 0xbd, 0x2a, 0xfe, 0x60, 0x5b, 0xb6, 0xdd,
+  0x52, 0xf4, 0xfd, 0x18, 0x9d, 0x94, 0x5d, 0xd1, 0x1a, 0x1f, 0x86, 0xc3,
+  0xb4, 0x15, 0x8e, 0xd2, 0x65, 0x88, 0x1c, 0xe6, 0xcd, 0x5d, 0xc4, 0x77,
+  0x91, 0xce, 0x58, 0xd2, 0x2b, 0x20, 0x4c, 0x99, 0xa6, 0x2f, 0xce, 0x7d,
+  0x98, 0xbe, 0x8b, 0x81, 0xff, 0xbe, 0x6f, 0xc2, 0xad, 0xfe, 0x9b, 0x7d,
+  0x4e, 0x6f, 0x71, 0x4b, 0xc2, 0x7a, 0x7e, 0xd1, 0xd5, 0x19, 0x53, 0xdb,
+  0xc5, 0xa8, 0x63, 0xbb, 0xe8, 0xbc, 0xde, 0x40, 0x5b, 0x3e, 0xd1, 0x61,
+  0xc8, 0x5a, 0xfc, 0x27, 0x1d, 0xd4, 0x1d, 0x99, 0x1e, 0x21, 0x9b, 0x94,
+  0x7e, 0x89, 0xa8, 0xf6, 0x7e, 0x00, 0xfa, 0x34, 0xfd, 0x0a, 0x3e, 0xb2,
+  0x78, 0x05, 0x84, 0xd6, 0xb6, 0x37, 0xb2, 0xaf, 0x2b, 0xa7, 0x2c, 0x61,
+  0xa9, 0xce, 0x7f, 0x75, 0xe6, 0x15, 0xac, 0x7a, 0x53, 0xe8, 0xff, 0x34,
+  0xe3, 0x13, 0x0c, 0xf7, 0x82, 0x96, 0xaa, 0x30, 0x98, 0x8e, 0xd4, 0x19,
+  0xf7, 0x24, 0x9d, 0xb9, 0xd4, 0x5f, 0x42, 0xdf, 0x84, 0x08, 0x3e, 0x94,
+  0xc8, 0x5b, 0x2b, 0x86, 0xd4, 0x7d, 0x0a, 0xbf, 0x1f, 0x2d, 0xb1, 0x44,
+  0xb6, 0xac, 0x05, 0xbc, 0x8a, 0x49, 0xd9, 0x0c, 0xca, 0xff, 0x34, 0xba,
+  0xce, 0x52, 0xfe, 0x3f,
+  0xed, 0x98, 0xcb, 0x72, 0x9b, 0x30, 0x14, 0x86, 0xf7, 0x7d, 0x0a, 0xed,
+  0x4b, 0x3a, 0xba, 0x62, 0x60, 0x97, 0x26, 0x4e, 0x16, 0x89, 0x1b, 0x4f,
+  0xe9, 0xb4, 0x49, 0x77, 0xe2, 0x92, 0x98, 0xa9, 0x6d, 0x3c, 0x58, 0x4c,
+  0x2e, 0x4f, 0x5f, 0x89, 0x9b, 0x0d, 0xb6, 0xb9, 0x24, 0x8e, 0xc7, 0x6d,
+  0xc8, 0x46, 0x08, 0x82, 0xcc, 0xf9, 0xf4, 0xff, 0x47, 0x47, 0x82, 0x04,
+  0x26, 0x7f, 0xc4, 0x80, 0x03, 0xd5, 0x32, 0x68, 0x60, 0xd5, 0x22, 0x04,
+  0x91, 0x6a, 0xb5, 0x11, 0xf7, 0xc0, 0x19, 0x17, 0x2f, 0xe0, 0x22, 0x78,
+  0x98, 0x88, 0x85, 0xec, 0x8d, 0xa3, 0x10, 0x8c, 0x6d, 0xaa, 0x71, 0xcb,
+  0x41, 0x9a, 0x63, 0x39, 0x58, 0x73, 0xb8, 0xfb, 0xc7, 0x72, 0x0c, 0xcd,
+  0x5b, 0x78, 0xe1, 0xe3, 0xdc, 0x9a, 0xc0, 0x2f, 0x54, 0x5e, 0x4f, 0xfd,
+  0x7b, 0xa1, 0xae, 0xd5, 0xfd, 0x48, 0xbd, 0xac, 0x3a, 0x58, 0x76, 0xe2,
+  0x85, 0xba, 0x42, 0xda, 0x43, 0x1c, 0x78, 0xbe, 0x1c, 0x04, 0x6b, 0xea,
+  0x5f, 0x97, 0x93, 0x30, 0x9e, 0x7a, 0x7e, 0x64, 0x39, 0x34, 0xed, 0x8b,
+  0x40, 0x8d, 0x8a, 0x60, 0xd2, 0x13, 0x72, 0x84, 0x07, 0xf9, 0x90, 0x93,
+  0xa4, 0xfb, 0x64, 0xf1, 0xf4, 0xfe, 0xb3, 0xc5, 0x91, 0x96, 0x8c, 0xbe,
+  0x7a, 0x9f, 0x65, 0x37, 0xb2, 0x01, 0xb2, 0xe7, 0xc5, 0x08, 0x34, 0xed,
+  0xcb, 0x21, 0x70, 0x7a, 0x25, 0xc7, 0x60, 0xda, 0x52, 0xf0, 0x48, 0x58,
+  0x8e, 0xa9, 0x3d, 0x59, 0x0e, 0xd4, 0x9e, 0x2d, 0x87, 0x68, 0x8b, 0x29,
+  0x17, 0xf7, 0x61, 0x34, 0xb3, 0xae, 0x83, 0x79, 0xfc, 0xa4, 0x7d, 0x82,
+  0x15, 0x56, 0x06, 0x24, 0xb4, 0x86, 0x55, 0xf2, 0xfb, 0x92, 0x14, 0x79,
+  0x6f, 0x52, 0x79, 0x64, 0x8e, 0xde, 0x9a, 0x4d, 0xf1, 0xca, 0x60, 0x0b,
+  0x0c, 0xf2, 0x3a, 0x18, 0x46, 0x1b, 0x18, 0xf4, 0x50, 0x30, 0x3a, 0x08,
+  0xe5, 0x1d, 0x94, 0x41, 0x09, 0x69, 0x84, 0xf1, 0x63, 0x08, 0xec, 0x43,
+  0xc8, 0x63, 0xbb, 0x91, 0x3a, 0x88, 0x65, 0x87, 0x91, 0xf6, 0xa8, 0x1d,
+  0x6a, 0xb4, 0xc6, 0xd5, 0xe7, 0x1d, 0x68, 0x30, 0x92, 0xe6, 0x68, 0xb8,
+  0x2b, 0x47, 0x1f, 0x2c, 0xe3, 0xb0, 0x2a, 0x03, 0x7d, 0x43, 0x23, 0x9d,
+  0x02, 0x44, 0x69, 0x0b, 0x51, 0x92, 0x4b, 0x06, 0x2c, 0x0b, 0xd0, 0x16,
+  0xbe, 0x3f, 0xb5, 0xfd, 0x28, 0xf0, 0x97, 0xc0, 0x16, 0x11, 0x17, 0xf1,
+  0x12, 0x9c, 0xc7, 0xa1, 0x0a, 0x13, 0xaa, 0x30, 0x51, 0x16, 0xa6, 0xfe,
+  0xca, 0x30, 0x8d, 0x3a, 0x25, 0x98, 0x65, 0x21, 0xe0, 0xce, 0x42, 0x80,
+  0x15, 0x21, 0xb0, 0x42, 0x08, 0xa4, 0x10, 0x02, 0xcd, 0x39, 0x0d, 0x14,
+  0x27, 0xdc, 0x92, 0x13, 0xea, 0x39, 0xd5, 0x72, 0x72, 0x52, 0xc3, 0x40,
+  0xca, 0x53, 0x60, 0xb9, 0x61, 0xec, 0x78, 0xee, 0x86, 0x33, 0x60, 0x5f,
+  0xdc, 0x82, 0xf1, 0x34, 0x5e, 0x16, 0x7c, 0x72, 0xbb, 0x0c, 0x72, 0x3e,
+  0x9f, 0xe5, 0x47, 0x67, 0x78, 0x4e, 0x64, 0x20, 0x39, 0x9d, 0xcf, 0xc9,
+  0xb5, 0x84, 0x73, 0x22, 0x9f, 0x97, 0x91, 0xe8, 0x65, 0x83, 0xd0, 0x6a,
+  0xcc, 0x66, 0xc5, 0x20, 0x45, 0x06, 0x30, 0x54, 0x40, 0xa8, 0x3e, 0x20,
+  0x4a, 0xa0, 0x93, 0x39, 0x04, 0x96, 0x02, 0x1a, 0x8e, 0x6c, 0x55, 0x97,
+  0x79, 0xb1, 0x2b, 0x82, 0x70, 0x2e, 0xd3, 0x24, 0x06, 0xa7, 0x1e, 0x5f,
+  0x08, 0x3f, 0x52, 0xb1, 0xe1, 0xf5, 0xb9, 0x2f, 0x52, 0x81, 0x83, 0x8a,
+  0xa9, 0x77, 0x10, 0x2b, 0x62, 0x73, 0x10, 0x49, 0x63, 0xdb, 0x34, 0xbf,
+  0x5e, 0xb7, 0x9e, 0xd0, 0xe6, 0xf9, 0x1e, 0xd4, 0xaf, 0x27, 0xab, 0xf9,
+  0x66, 0xc5, 0x7c, 0xe3, 0x52, 0xfe, 0x20, 0x0a, 0x0f, 0xdc, 0x8d, 0x87,
+  0x41, 0x57, 0xb5, 0x58, 0x81, 0x5a, 0x4f, 0x90, 0xb7, 0xc3, 0x9b, 0x5b,
+  0x60, 0x5f, 0xeb, 0x8c, 0xe9, 0xe0, 0xeb, 0xd5, 0x86, 0x1d, 0x3a, 0x67,
+  0xc7, 0x23, 0x5b, 0x66, 0x1b, 0x6c, 0x40, 0x19, 0x22, 0x6b, 0x62, 0x59,
+  0x61, 0xb9, 0xf4, 0xe7, 0x81, 0xcc, 0x10, 0x23, 0xfe, 0x74, 0x1f, 0x44,
+  0x3e, 0xb8, 0x8c, 0xf8, 0xdc, 0x0b, 0xf8, 0x12, 0xc8, 0x89, 0xff, 0xa8,
+  0x88, 0xd2, 0x42, 0x64, 0x85, 0xe8, 0xdb, 0xdd, 0xd5, 0x0d, 0x38, 0xbb,
+  0xf9, 0x3e, 0xfc, 0xaf, 0xaa, 0xb4, 0x4e, 0x65, 0x07, 0x65, 0x72, 0x7d,
+  0x49, 0x2e, 0x52, 0x26, 0x45, 0x95, 0x66, 0xff, 0x1e, 0xdd, 0x81, 0x71,
+  0xf8, 0xe8, 0x47, 0xe0, 0xdc, 0xa6, 0xe0, 0x97, 0xd4, 0x90, 0xac, 0x43,
+  0xc2, 0xb9, 0x88, 0xc2, 0xe9, 0x34, 0xcd, 0x3c, 0x47, 0x52, 0xa8, 0xcd,
+  0x82, 0xa5, 0x8b, 0x92, 0xcc, 0x76, 0xe0, 0x92, 0x2d, 0x67, 0x87, 0x31,
+  0x42, 0x25, 0x5d, 0xad, 0xb1, 0xbb, 0xe4, 0x33, 0x3f, 0xab, 0xd9, 0xf0,
+  0x9b, 0x2c, 0x77, 0xb4, 0xdb, 0x80, 0xa6, 0xb4, 0x6d, 0x22, 0x33, 0x81,
+  0x63, 0xc2, 0xf2, 0x16, 0xf2, 0x74, 0xc6, 0x5f, 0xe4, 0x6a, 0x76, 0x1d,
+  0xcf, 0x79, 0x45, 0x57, 0xef, 0x5f, 0xcd, 0x74, 0x90, 0x95, 0xb9, 0x4f,
+  0x55, 0xb5, 0xa9, 0x6b, 0xa8, 0x0b, 0x13, 0x55, 0x91, 0x01, 0x2a, 0xef,
+  0x9b, 0xc6, 0x53, 0xfe, 0x6c, 0x0b, 0x9e, 0xd4, 0x00, 0x3f, 0x03, 0xc1,
+  0x77, 0x5b, 0x30, 0x5d, 0xe5, 0xb7, 0x2c, 0xfe, 0x74, 0xd7, 0xe2, 0x4f,
+  0x5b, 0x0b, 0x65, 0x7b, 0xc1, 0xd6, 0xca, 0x2e, 0x59, 0x60, 0xba, 0x01,
+  0xcb, 0x3b, 0x1c, 0xb9, 0x4d, 0xae, 0x66, 0x16, 0x9a, 0x48, 0x80, 0x64,
+  0x81, 0xc1, 0x22, 0x30, 0xbd, 0x88, 0x6b, 0xb0, 0x0a, 0x8b, 0x65, 0x51,
+  0xd1, 0xc2, 0x24, 0x7a, 0x25, 0xbc, 0x6c, 0xbe, 0xf3, 0x39, 0x2b, 0x9b,
+  0xc4, 0x68, 0x8e, 0x3d, 0x9f, 0xe5, 0x6c, 0x00, 0x5c, 0x31, 0x89, 0x59,
+  0x67, 0x12, 0x92, 0x94, 0x7e, 0x4c, 0xb1, 0x91, 0xd8, 0xdb, 0xc3, 0x31,
+  0x76, 0xc1, 0x81, 0xdd, 0x0a, 0x3e, 0x3d, 0x9f, 0x73, 0x52, 0xe0, 0x81,
+  0xb5, 0xde, 0x40, 0x6f, 0x2d, 0xf5, 0x71, 0x97, 0x52, 0x7f, 0x95, 0x43,
+  0x3a, 0xc0, 0x41, 0xbd, 0x72, 0x6a, 0xe0, 0xf4, 0xca, 0xd9, 0x80, 0xc3,
+  0x61, 0xba, 0xb7, 0x5a, 0x53, 0x0e, 0x3d, 0xce, 0x6a, 0xe6, 0xd0, 0x35,
+  0xcc, 0x06, 0x20, 0x63, 0x17, 0x20, 0xb8, 0x97, 0xfa, 0xe5, 0x5f, 0x55,
+  0x90, 0x4b, 0xd3, 0xb6, 0x57, 0x50, 0x23, 0xa0, 0x5e, 0x41, 0xdb, 0x01,
+  0xb9, 0xd0, 0x2c, 0x9d, 0xeb, 0xf4, 0x0a, 0xda, 0x0e, 0xa8, 0xb7, 0x58,
+  0x23, 0xa0, 0xde, 0x62, 0x5b, 0x01, 0x79, 0x3c, 0x3d, 0x23, 0xdc, 0xba,
+  0x67, 0x2a, 0x83, 0xaa, 0xec, 0xc6, 0x1b, 0xce, 0x79, 0xdb, 0x9e, 0x7e,
+  0x6e, 0x9e, 0xfc, 0xb6, 0xda, 0x23, 0x67, 0x9f, 0xef, 0xeb, 0xd5, 0xcf,
+  0xb7, 0xd9, 0x71, 0x9f, 0xb9, 0xd0, 0xfd, 0x5a, 0x41, 0x84, 0xb1, 0x3b,
+  0x59, 0x70, 0x2f, 0xa9, 0x39, 0xdb, 0xfb, 0x62, 0xc5, 0xcd, 0xd8, 0xc5,
+  0xed, 0x63, 0xfb, 0xe2, 0x1e, 0x43, 0xaf, 0x17, 0x56, 0xb3, 0xb0, 0xfe,
+  0x02,
+  0xed, 0x99, 0x5d, 0x4f, 0xdb, 0x30, 0x14, 0x86, 0xef, 0xf7, 0x2b, 0x7c,
+  0x4f, 0x40, 0xb6, 0xe3, 0x7c, 0xde, 0x55, 0x7c, 0x8d, 0x69, 0xb0, 0x6a,
+  0x41, 0x8c, 0x5b, 0xa7, 0x71, 0x8b, 0xb5, 0x90, 0x54, 0x49, 0x0a, 0xf4,
+  0xdf, 0xcf, 0x71, 0xd2, 0x90, 0xb4, 0x69, 0x9a, 0x0f, 0x0a, 0xdb, 0x4a,
+  0x85, 0xd0, 0x71, 0x29, 0xe6, 0xe4, 0xf1, 0x7b, 0xec, 0xd7, 0x07, 0xa8,
+  0x42, 0xf9, 0x22, 0x53, 0x48, 0xb2, 0xc8, 0x95, 0xef, 0x20, 0xf9, 0x05,
+  0xa1, 0x72, 0xfb, 0x10, 0x2d, 0xe2, 0xe4, 0x91, 0xc6, 0x09, 0x8b, 0xc0,
+  0x05, 0x8f, 0x58, 0x9c, 0x84, 0xd1, 0x23, 0x38, 0x5b, 0x50, 0x1f, 0x8c,
+  0xc3, 0x67, 0x16, 0x29, 0xd4, 0x76, 0xa1, 0xe2, 0xda, 0x2e, 0x56, 0x5c,
+  0x3a, 0xf9, 0x6d, 0xbb, 0x96, 0xe2, 0xcd, 0xbd, 0xf0, 0x39, 0xb0, 0x1f,
+  0xe0, 0x09, 0x11, 0xb1, 0xcf, 0xa6, 0x49, 0x1a, 0x9b, 0x22, 0x8e, 0xf8,
+  0xec, 0x41, 0x0e, 0xb0, 0x18, 0x2c, 0xe6, 0x69, 0x84, 0x94, 0xd9, 0x82,
+  0x7b, 0xcc, 0x76, 0x4d, 0x25, 0xfd, 0x64, 0xfc, 0x10, 0x2e, 0x7c, 0x8f,
+  0x45, 0xb6, 0x4b, 0xb2, 0x71, 0xc2, 0xd3, 0x49, 0x11, 0x92, 0xa3, 0x44,
+  0x4c, 0x30, 0x4b, 0x7f, 0xa8, 0xc9, 0xe1, 0x8b, 0x4d, 0xa1, 0x0c, 0x96,
+  0x36, 0x45, 0x8a, 0x9c, 0xfc, 0xf5, 0xf7, 0xf5, 0xfc, 0x8d, 0x7c, 0x02,
+  0x9c, 0x0d, 0x8b, 0x19, 0x8c, 0x6c, 0x2c, 0xa6, 0xc8, 0x7f, 0x22, 0xe6,
+  0x50, 0x95, 0x38, 0xa1, 0x51, 0x22, 0x3e, 0x0d, 0x95, 0x17, 0xf1, 0x5d,
+  0x59, 0xda, 0xae, 0xaa, 0xcc, 0x7d, 0x9a, 0x4c, 0xc5, 0x43, 0xdb, 0xdf,
+  0x79, 0xb0, 0x78, 0x51, 0xbe, 0xc0, 0x75, 0x66, 0x6a, 0x07, 0x66, 0xa3,
+  0x80, 0xfa, 0xe1, 0x0c, 0xe0, 0x12, 0xb6, 0x8e, 0xb8, 0x9a, 0x28, 0xc1,
+  0x2a, 0x25, 0xb3, 0x33, 0x25, 0xb4, 0x46, 0xc9, 0xaa, 0xa5, 0xd4, 0x81,
+  0x0d, 0x19, 0xac, 0x27, 0x73, 0x8f, 0x80, 0xb4, 0xc1, 0x80, 0x1a, 0x65,
+  0x64, 0x75, 0x21, 0x65, 0x78, 0x30, 0x7f, 0xd5, 0x90, 0xba, 0x05, 0xd7,
+  0x3c, 0xe0, 0x29, 0x1b, 0x34, 0x88, 0x4d, 0x5e, 0x6b, 0xa2, 0x1a, 0x3a,
+  0x50, 0xd2, 0x77, 0x53, 0xd2, 0x86, 0x52, 0x82, 0x2d, 0x29, 0x99, 0x4d,
+  0x94, 0x7e, 0x2e, 0x02, 0x70, 0x03, 0xce, 0x22, 0xfe, 0xc4, 0xc0, 0xd8,
+  0xa7, 0x4b, 0x27, 0xa1, 0x09, 0x0f, 0x03, 0x70, 0x1a, 0x06, 0x49, 0x14,
+  0xfa, 0x7e, 0xa6, 0x2e, 0xf4, 0x5e, 0xea, 0xda, 0x0f, 0x37, 0xad, 0x17,
+  0x37, 0xeb, 0xa3, 0xb9, 0xfd, 0xf3, 0xca, 0x63, 0x19, 0x41, 0x84, 0xea,
+  0x08, 0x32, 0xe7, 0x99, 0xce, 0xc1, 0x38, 0x0a, 0x3f, 0x9c, 0x99, 0x78,
+  0xba, 0x81, 0xcc, 0x28, 0x79, 0x2b, 0xd5, 0x21, 0xdc, 0xb4, 0xfb, 0xdf,
+  0x71, 0x37, 0x12, 0x3a, 0x0b, 0x66, 0xe0, 0x92, 0x3e, 0xb2, 0x39, 0xf5,
+  0x0e, 0x75, 0xeb, 0x47, 0x5a, 0x86, 0x09, 0xd6, 0x4a, 0xab, 0x6c, 0x1b,
+  0xd4, 0x13, 0x7c, 0xe8, 0x90, 0xea, 0xb5, 0x54, 0x86, 0x44, 0x0e, 0x15,
+  0x11, 0x86, 0x3b, 0x11, 0xdd, 0x66, 0x7f, 0xf4, 0x60, 0x09, 0xe5, 0x56,
+  0x1d, 0xee, 0x24, 0xf4, 0xe9, 0x1f, 0xaa, 0xe0, 0xf4, 0x1c, 0x1c, 0xce,
+  0xc6, 0x55, 0x70, 0x97, 0x63, 0x70, 0x7f, 0x75, 0x56, 0x88, 0x0a, 0xe5,
+  0x6c, 0xf4, 0x7d, 0xdc, 0x04, 0xad, 0xea, 0x69, 0x87, 0x3b, 0x33, 0x82,
+  0x6b, 0xa7, 0x9d, 0x56, 0x30, 0x52, 0x0b, 0x46, 0x64, 0xc5, 0xc8, 0x48,
+  0x19, 0xe1, 0x5d, 0x8c, 0xd0, 0x34, 0xf3, 0xa6, 0xb0, 0xea, 0x10, 0x6e,
+  0x58, 0x78, 0xc9, 0x42, 0x30, 0x76, 0xd4, 0x7d, 0x5b, 0x81, 0x1e, 0x92,
+  0x29, 0x69, 0xa4, 0x83, 0x1e, 0x34, 0xa8, 0xe2, 0xd5, 0x43, 0x96, 0x5f,
+  0xca, 0x48, 0xcc, 0xc1, 0xc1, 0xa9, 0x4f, 0xe3, 0x98, 0x4f, 0xd6, 0x0a,
+  0xa6, 0x22, 0x0a, 0xdc, 0xf3, 0xc9, 0x8b, 0x25, 0x69, 0x9f, 0x5c, 0xb1,
+  0x10, 0x7f, 0x55, 0x72, 0xb8, 0x9e, 0xdc, 0xf6, 0xa4, 0xfa, 0x36, 0x54,
+  0xf2, 0xed, 0x64, 0x4b, 0x1d, 0xe9, 0xd5, 0x3a, 0xd2, 0xba, 0xd6, 0x91,
+  0xd1, 0xc2, 0x34, 0x16, 0x7b, 0xb4, 0xd9, 0xa2, 0x8c, 0xd6, 0x01, 0xad,
+  0xaf, 0xde, 0x76, 0x40, 0xff, 0xcb, 0x3e, 0xa3, 0xa6, 0x80, 0xf0, 0x76,
+  0x40, 0x1a, 0xb4, 0xb2, 0x93, 0xcb, 0xc0, 0xd5, 0x7d, 0xe6, 0xee, 0xea,
+  0xec, 0x6a, 0x54, 0x4f, 0xa8, 0xa7, 0x74, 0xd4, 0x26, 0x34, 0xe6, 0x40,
+  0xe9, 0x58, 0x5d, 0xa4, 0xd3, 0x66, 0x07, 0x2e, 0xc8, 0x90, 0x5d, 0x64,
+  0xc0, 0x13, 0x44, 0x27, 0x90, 0x6c, 0x48, 0x08, 0x91, 0xbe, 0xa4, 0xf4,
+  0x26, 0x52, 0xc6, 0xc0, 0xab, 0x99, 0xd9, 0xe5, 0x66, 0xa6, 0xb7, 0x22,
+  0x65, 0x6a, 0x92, 0x90, 0x0b, 0xf5, 0x8a, 0x55, 0x4c, 0xaf, 0x60, 0x0e,
+  0x17, 0x47, 0x39, 0x49, 0x6f, 0xb1, 0x9b, 0x7c, 0xe0, 0x30, 0x9f, 0xa3,
+  0x57, 0x7c, 0x8e, 0xda, 0xb9, 0x4d, 0x69, 0x54, 0x6b, 0x8b, 0xb4, 0x6a,
+  0x53, 0xae, 0x9a, 0xb9, 0xa8, 0x28, 0x2e, 0xb2, 0x1d, 0x8c, 0x81, 0xbc,
+  0xcc, 0xdf, 0x14, 0xf6, 0x30, 0x77, 0x88, 0xe1, 0x23, 0x63, 0xc0, 0xb9,
+  0x39, 0x77, 0xc0, 0xc8, 0xa3, 0xf3, 0xa4, 0x69, 0xff, 0x39, 0xa2, 0x68,
+  0x85, 0xe6, 0x98, 0xc2, 0x82, 0xcc, 0x91, 0x8c, 0x05, 0x98, 0x63, 0xba,
+  0xe9, 0xff, 0x36, 0xd6, 0xbf, 0x8b, 0xee, 0x2d, 0x34, 0x91, 0x49, 0x93,
+  0xf5, 0xa4, 0xbf, 0x9e, 0x9f, 0xea, 0x04, 0x7c, 0x0b, 0x97, 0x92, 0x58,
+  0x4d, 0xc6, 0x75, 0xa2, 0xdd, 0x21, 0xcc, 0x3e, 0x89, 0xe9, 0x9b, 0x89,
+  0x95, 0x2e, 0xfb, 0xf8, 0x4d, 0x73, 0x92, 0x2b, 0x0c, 0xb7, 0xe7, 0xc4,
+  0x56, 0xff, 0xe2, 0x80, 0x6e, 0xd6, 0x70, 0xcd, 0xad, 0xec, 0x35, 0x9f,
+  0x44, 0x61, 0x1c, 0x4e, 0x13, 0x70, 0xef, 0x86, 0x2f, 0xe0, 0x47, 0xc0,
+  0xc0, 0xb9, 0xcf, 0x13, 0x56, 0x6a, 0xd2, 0x7f, 0xf4, 0x49, 0x23, 0x78,
+  0x79, 0x3e, 0x43, 0xd2, 0xff, 0x65, 0x31, 0x96, 0x55, 0x90, 0xc5, 0xaa,
+  0x2c, 0xa9, 0x2c, 0x26, 0x22, 0xd6, 0xde, 0xdb, 0x01, 0x6f, 0xa0, 0x35,
+  0x3f, 0xd1, 0xbe, 0x35, 0x5a, 0x5c, 0xde, 0x9a, 0x04, 0x5a, 0x09, 0xf4,
+  0x2d, 0x4d, 0x51, 0x15, 0xa3, 0xd6, 0x70, 0xe0, 0xb7, 0xf0, 0x42, 0xb8,
+  0xf1, 0xc0, 0x6f, 0x69, 0x85, 0xc8, 0x6e, 0x2a, 0x2a, 0xac, 0xb6, 0xb5,
+  0x5f, 0x05, 0xe7, 0x08, 0x75, 0xfc, 0xe2, 0x81, 0x57, 0x6b, 0xa8, 0xeb,
+  0x0e, 0xa7, 0xd2, 0x85, 0xa8, 0xf3, 0x1d, 0x0a, 0x57, 0x8c, 0x6e, 0xdb,
+  0xe4, 0x8d, 0x3e, 0xc9, 0x9b, 0xfb, 0x4b, 0xde, 0xea, 0x92, 0x3c, 0xcd,
+  0x4b, 0x5d, 0xcb, 0x4b, 0xbd, 0x28, 0xf0, 0x9a, 0x66, 0x09, 0xdc, 0x47,
+  0xb3, 0x04, 0x0d, 0x6d, 0x96, 0xe0, 0xce, 0x5d, 0xa6, 0x5d, 0x06, 0x7d,
+  0xc5, 0x86, 0xb5, 0x58, 0x58, 0x70, 0x11, 0x31, 0x16, 0x27, 0x4b, 0x9f,
+  0xd5, 0x1a, 0x2e, 0x6b, 0xa8, 0xdf, 0xda, 0x30, 0x50, 0x3d, 0x14, 0x8a,
+  0x70, 0xbe, 0xc8, 0x08, 0x6a, 0xaf, 0x8b, 0xec, 0xb0, 0x88, 0xb3, 0xf8,
+  0x10, 0x2e, 0x64, 0x5b, 0xf6, 0xe6, 0x3f,
+  0xed, 0xd9, 0x49, 0x8f, 0x9b, 0x30, 0x18, 0x06, 0xe0, 0x7b, 0x7f, 0x05,
+  0xf7, 0xf1, 0x54, 0x5e, 0x20, 0x10, 0x6e, 0x9d, 0x99, 0xaa, 0xaa, 0xd4,
+  0x51, 0x47, 0x4d, 0xd5, 0xe6, 0x6a, 0x07, 0x27, 0x41, 0x61, 0x20, 0x62,
+  0x69, 0x93, 0x4b, 0x7f, 0x7b, 0x3f, 0x63, 0xb6, 0xec, 0xcb, 0x1c, 0xaa,
+  0x14, 0x67, 0x0e, 0x63, 0x43, 0x40, 0xf6, 0xe3, 0xd7, 0x66, 0x09, 0x66,
+  0xb8, 0xfc, 0x38, 0x12, 0xdb, 0xea, 0x3f, 0xa1, 0x58, 0xe8, 0x0d, 0xf0,
+  0x07, 0x1f, 0x34, 0x16, 0xc9, 0xca, 0x1a, 0xc9, 0x34, 0x94, 0x99, 0xf5,
+  0x98, 0xc4, 0x79, 0x9a, 0x44, 0x91, 0x4c, 0x11, 0xf7, 0x05, 0x46, 0xc2,
+  0x17, 0x04, 0x09, 0x3e, 0x59, 0xf8, 0x62, 0x80, 0x82, 0x65, 0x90, 0xfc,
+  0x8e, 0xfd, 0x39, 0x7e, 0x6f, 0x43, 0x39, 0x92, 0xd3, 0x5c, 0x95, 0x3d,
+  0x28, 0xa7, 0xe1, 0x6c, 0x5e, 0x56, 0x28, 0x54, 0x8a, 0xa5, 0x2a, 0x11,
+  0x34, 0x2b, 0xc2, 0x40, 0xfa, 0xc2, 0x43, 0xea, 0x9b, 0xd9, 0x3c, 0x29,
+  0xa2, 0x40, 0xa6, 0xbe, 0xb0, 0x75, 0x3d, 0x0f, 0xd5, 0x49, 0x87, 0x65,
+  0x25, 0x87, 0xe3, 0x67, 0xb0, 0x8f, 0xd3, 0xb2, 0xba, 0xf2, 0x39, 0x2e,
+  0x0b, 0x6b, 0x9f, 0x13, 0x54, 0x9e, 0xbb, 0x3d, 0xdc, 0xa9, 0x36, 0xe8,
+  0xe3, 0x09, 0xd6, 0xd5, 0xe6, 0x0c, 0xd5, 0x6e, 0x38, 0x05, 0xd3, 0x25,
+  0x38, 0x87, 0x8d, 0xb2, 0x9c, 0xa7, 0xb9, 0x2f, 0x5c, 0xb4, 0xf2, 0x05,
+  0x45, 0x6b, 0x5f, 0x30, 0xb4, 0x8c, 0x78, 0x3e, 0x4d, 0xd2, 0x57, 0xff,
+  0x4b, 0x18, 0x17, 0x2b, 0xf4, 0x0e, 0x1f, 0x62, 0x72, 0x6f, 0x83, 0xe9,
+  0x35, 0xcc, 0x26, 0x04, 0x9a, 0xf1, 0xef, 0xc1, 0x86, 0x26, 0x57, 0xe7,
+  0x30, 0x89, 0x8a, 0xe9, 0x39, 0x9c, 0xa4, 0x49, 0x96, 0x4c, 0x73, 0xcb,
+  0x80, 0x1d, 0x05, 0x0b, 0xcc, 0x44, 0xbc, 0x0c, 0x6c, 0x7a, 0x25, 0x98,
+  0x20, 0xac, 0xf6, 0x12, 0xc4, 0x6e, 0xb8, 0x04, 0x71, 0xb4, 0x96, 0x20,
+  0xf4, 0x46, 0xa3, 0xc4, 0xae, 0xbb, 0xf4, 0x41, 0x8b, 0xae, 0xcb, 0xd2,
+  0x0e, 0xd4, 0xa0, 0x0b, 0x05, 0xcc, 0x1b, 0x52, 0xce, 0x69, 0x29, 0x77,
+  0x53, 0xca, 0xde, 0x92, 0xb2, 0x1b, 0x29, 0xda, 0x48, 0xb1, 0x5a, 0x0a,
+  0x12, 0xb9, 0x52, 0x4a, 0x6b, 0x35, 0x5e, 0x27, 0xa9, 0x86, 0x70, 0xe1,
+  0xd3, 0x1f, 0xd2, 0x52, 0xb1, 0x01, 0x3e, 0x33, 0x41, 0x76, 0x9b, 0x20,
+  0xd2, 0x49, 0x10, 0xad, 0x13, 0xc4, 0x6e, 0x7c, 0x55, 0xa2, 0xb5, 0x4e,
+  0xed, 0xd3, 0x2e, 0xe3, 0x23, 0xe8, 0xd7, 0xcf, 0x30, 0x86, 0xe6, 0x58,
+  0x2f, 0x51, 0x31, 0xb3, 0x78, 0x1c, 0x40, 0x81, 0xaf, 0x3b, 0x5c, 0x15,
+  0xd3, 0x1d, 0x27, 0x35, 0xd3, 0x3d, 0xc7, 0x0d, 0xd3, 0x5d, 0x59, 0x06,
+  0xa6, 0x7b, 0xd8, 0xdf, 0x05, 0x10, 0x5b, 0xe3, 0x0d, 0xbd, 0xbd, 0xa0,
+  0xc5, 0xde, 0xc1, 0x16, 0x3f, 0x15, 0x3c, 0xb2, 0x46, 0x70, 0xd6, 0x85,
+  0x54, 0x8d, 0x64, 0xaa, 0x91, 0xb4, 0x1a, 0x53, 0xfb, 0xd2, 0xe8, 0xef,
+  0x0b, 0x7c, 0xd3, 0x60, 0xef, 0x40, 0xa0, 0xcb, 0x31, 0xad, 0x07, 0x84,
+  0xfc, 0xa9, 0x47, 0xa4, 0xec, 0x1f, 0x51, 0xfd, 0xc3, 0x27, 0xfb, 0xe7,
+  0x39, 0x98, 0x1e, 0xe8, 0x9f, 0xca, 0xee, 0xdb, 0xaf, 0x0f, 0x9b, 0x1d,
+  0x73, 0xba, 0x39, 0xf5, 0x2e, 0xce, 0x29, 0xdd, 0xc8, 0xe9, 0xf0, 0xe2,
+  0x98, 0x9e, 0x39, 0x8d, 0xbd, 0xa1, 0x46, 0xa1, 0xc4, 0xa0, 0xb4, 0x28,
+  0x72, 0x2b, 0x29, 0xcd, 0xda, 0xf6, 0x91, 0x67, 0xeb, 0xd1, 0xf3, 0xb8,
+  0xef, 0xb7, 0x5c, 0x0d, 0x10, 0xd1, 0xdb, 0xb7, 0xef, 0x51, 0x81, 0xea,
+  0x28, 0x11, 0xe9, 0x10, 0xd1, 0x2e, 0x91, 0xd7, 0x10, 0xd9, 0x37, 0x2e,
+  0xc3, 0xf4, 0x1e, 0xf4, 0x20, 0x89, 0xf5, 0xe9, 0x11, 0x66, 0xd7, 0x79,
+  0x32, 0x7d, 0x0a, 0x8f, 0xbd, 0x77, 0xc9, 0x31, 0x44, 0x2d, 0x11, 0xb9,
+  0xea, 0xe6, 0xaa, 0x77, 0x46, 0x54, 0xc7, 0x68, 0xf4, 0x19, 0x66, 0x1a,
+  0xc5, 0xd6, 0x0f, 0xfa, 0xb6, 0x47, 0x97, 0xff, 0xc4, 0xc5, 0x36, 0xd9,
+  0x39, 0x65, 0x44, 0xeb, 0xf9, 0xe5, 0x3d, 0x84, 0xf9, 0x53, 0x62, 0x7d,
+  0x08, 0xf8, 0x32, 0x37, 0x3c, 0x2d, 0x8f, 0x5e, 0xa8, 0xd1, 0x68, 0x29,
+  0x65, 0x00, 0x5f, 0x5e, 0x58, 0x63, 0x09, 0x61, 0x7a, 0x49, 0x81, 0x2a,
+  0xe6, 0x51, 0x32, 0x33, 0x52, 0x9a, 0xc8, 0x19, 0x50, 0x73, 0x2d, 0x3b,
+  0x4e, 0x34, 0xa0, 0x94, 0x19, 0xa2, 0xa3, 0x44, 0x2e, 0xae, 0x5e, 0x3b,
+  0x7d, 0x4f, 0xd2, 0x30, 0x30, 0x2a, 0x95, 0x0a, 0xab, 0x54, 0xca, 0x55,
+  0x28, 0x52, 0xab, 0x90, 0xf1, 0x51, 0x3f, 0xa3, 0x90, 0x6a, 0x79, 0x76,
+  0xcd, 0x1b, 0xb8, 0x7d, 0x3e, 0x9c, 0x1c, 0x7a, 0x8a, 0x37, 0x3e, 0x1b,
+  0x3e, 0xae, 0xb9, 0x51, 0x3c, 0x65, 0xb4, 0x7b, 0x33, 0xfd, 0x4d, 0x4e,
+  0x64, 0xf8, 0xab, 0xdf, 0x09, 0x0a, 0x48, 0xf3, 0x1a, 0x68, 0xef, 0xdd,
+  0xcf, 0xd7, 0x58, 0xf6, 0x3d, 0x40, 0x0d, 0x11, 0xed, 0x06, 0x08, 0x60,
+  0xcc, 0x24, 0xdb, 0x35, 0x62, 0xf5, 0x93, 0x7c, 0xef, 0x63, 0xf4, 0x17,
+  0xed, 0xd9, 0xdd, 0x6e, 0x9b, 0x30, 0x14, 0x00, 0xe0, 0xfb, 0x3d, 0x05,
+  0x0f, 0x80, 0x26, 0xff, 0x00, 0x01, 0xee, 0xda, 0xb4, 0xeb, 0x56, 0xb5,
+  0x5b, 0xd4, 0x54, 0x6b, 0x6f, 0x0d, 0x38, 0x09, 0x1a, 0x81, 0x88, 0x98,
+  0x2d, 0x79, 0xfb, 0x19, 0xdb, 0x90, 0x00, 0x09, 0x24, 0x4b, 0x35, 0xad,
+  0x83, 0xa8, 0x12, 0x76, 0x08, 0x6e, 0xf9, 0x74, 0xce, 0xf1, 0xa1, 0x01,
+  0x18, 0x88, 0x97, 0x49, 0x81, 0x91, 0x1f, 0x83, 0x00, 0x20, 0xf1, 0x06,
+  0x96, 0x47, 0xfd, 0x31, 0xf4, 0xd3, 0x64, 0x9d, 0xcc, 0x98, 0xf6, 0xea,
+  0x25, 0x1b, 0xed, 0x5b, 0x4c, 0x75, 0xe2, 0x7a, 0x40, 0xf7, 0x5c, 0x0f,
+  0xea, 0x1e, 0xf1, 0x7f, 0xb8, 0x9e, 0xa5, 0x07, 0xab, 0x20, 0xf9, 0x15,
+  0xbb, 0x0b, 0xf0, 0xd1, 0xe0, 0xe3, 0x88, 0xce, 0x58, 0x3e, 0xb6, 0xf9,
+  0x38, 0x0d, 0xe7, 0x0b, 0x31, 0x41, 0x7c, 0x92, 0xad, 0xf2, 0x11, 0xd4,
+  0xe7, 0x59, 0x18, 0x50, 0xd7, 0xb3, 0xf5, 0xfc, 0x93, 0xeb, 0x45, 0x92,
+  0x45, 0x01, 0x4d, 0x5d, 0xcf, 0x90, 0x73, 0x16, 0xe6, 0x8b, 0x3a, 0x62,
+  0xc2, 0xf8, 0xf5, 0x73, 0x7e, 0x8e, 0x20, 0x31, 0xdd, 0xb8, 0x04, 0x88,
+  0xc1, 0xd6, 0x25, 0x50, 0x17, 0x6b, 0xef, 0x2e, 0x37, 0xd5, 0x1b, 0xf2,
+  0x7a, 0x08, 0xe4, 0xb4, 0x5c, 0x41, 0x9d, 0xe6, 0x4b, 0x60, 0x39, 0xe2,
+  0x6b, 0x18, 0xfa, 0x9a, 0x91, 0x94, 0xb9, 0xde, 0x48, 0xdf, 0xb8, 0x1e,
+  0xd2, 0xb7, 0xae, 0x87, 0xf5, 0x55, 0x44, 0xd8, 0x2c, 0x49, 0x97, 0xee,
+  0x43, 0x18, 0x67, 0x1b, 0xfd, 0x03, 0xa8, 0x11, 0x51, 0xdc, 0x49, 0xa4,
+  0xdd, 0x46, 0x21, 0x1b, 0xa0, 0x88, 0x82, 0x52, 0x2f, 0xbd, 0xe4, 0x19,
+  0x27, 0x31, 0x4b, 0x93, 0x28, 0xa2, 0xe9, 0x60, 0xa4, 0x8c, 0xa0, 0x3c,
+  0x33, 0x18, 0xb5, 0x18, 0xd9, 0x72, 0x3e, 0xd4, 0xa4, 0x1d, 0xd1, 0x0c,
+  0x0a, 0x12, 0x0c, 0x25, 0x11, 0x14, 0x3f, 0x9c, 0x68, 0x32, 0xc5, 0xb5,
+  0x08, 0x42, 0xfb, 0x3c, 0xf6, 0xb9, 0x3c, 0x2d, 0x2a, 0x10, 0x54, 0x58,
+  0x38, 0xfd, 0xb9, 0x2c, 0xb0, 0xca, 0xc2, 0xef, 0xbc, 0x60, 0x41, 0x25,
+  0x0b, 0x2e, 0x58, 0x9c, 0x9c, 0x05, 0xe7, 0x2c, 0xa0, 0x93, 0xc5, 0x37,
+  0x25, 0x47, 0xc9, 0xf2, 0x9c, 0x66, 0x6b, 0xa6, 0xdd, 0x91, 0x25, 0x5d,
+  0x91, 0xe0, 0x72, 0x15, 0x15, 0x34, 0x10, 0xbd, 0x33, 0x1f, 0x0b, 0x23,
+  0x33, 0x3f, 0x22, 0x0c, 0xcc, 0x8a, 0xcf, 0x74, 0x41, 0xe2, 0x17, 0x12,
+  0xbf, 0x9d, 0xd0, 0x3b, 0x75, 0xb1, 0x6a, 0x2e, 0x9f, 0xef, 0x6f, 0x5e,
+  0x1b, 0x35, 0x86, 0xdf, 0xc0, 0x1b, 0xc5, 0x8b, 0x55, 0x71, 0xc1, 0xd5,
+  0x32, 0x63, 0x74, 0xbb, 0x8c, 0xaa, 0x2e, 0xc6, 0xd1, 0x32, 0x73, 0xc0,
+  0x85, 0x2b, 0x16, 0x30, 0x46, 0x27, 0xcc, 0xc8, 0x3c, 0x10, 0x30, 0xbf,
+  0x78, 0xc0, 0xe4, 0xf5, 0x66, 0x32, 0x1e, 0x32, 0xaa, 0x04, 0x82, 0x0a,
+  0xe8, 0xcb, 0x8a, 0xce, 0x89, 0x36, 0xb9, 0xd3, 0x1c, 0xe0, 0x38, 0xbd,
+  0xcb, 0x27, 0xfe, 0x12, 0x03, 0xc3, 0xb6, 0x55, 0x13, 0xa8, 0xc2, 0x26,
+  0x5b, 0xd1, 0x54, 0xbb, 0x4f, 0xb6, 0xda, 0x35, 0xdf, 0xc0, 0x4d, 0x6d,
+  0x92, 0x26, 0x0d, 0x1b, 0xa7, 0xb0, 0xc9, 0x03, 0x5a, 0xd1, 0x78, 0xd0,
+  0x2c, 0x65, 0xf2, 0x44, 0x11, 0x30, 0x5d, 0xf9, 0x54, 0x73, 0x39, 0x3f,
+  0x9f, 0xea, 0x2e, 0xad, 0xf9, 0x64, 0x9f, 0xe1, 0x62, 0x8d, 0x80, 0x55,
+  0x71, 0x99, 0x44, 0x64, 0x3b, 0x65, 0x84, 0x85, 0x49, 0xac, 0x5d, 0x05,
+  0x64, 0xc5, 0xda, 0xf6, 0xee, 0x0b, 0x5d, 0x9c, 0x4b, 0x59, 0xc0, 0x39,
+  0x2c, 0x7b, 0x65, 0xa6, 0xc5, 0xc5, 0x06, 0x44, 0x3d, 0x5a, 0x81, 0xfd,
+  0xa3, 0xfe, 0xfc, 0x74, 0x9d, 0x30, 0xed, 0x7b, 0x98, 0xb2, 0x8c, 0x44,
+  0x79, 0xdc, 0xa8, 0xcd, 0x89, 0xaf, 0xea, 0x89, 0xfb, 0x54, 0x15, 0xd9,
+  0x2c, 0x6d, 0xac, 0x92, 0x06, 0xef, 0x64, 0x0c, 0x05, 0x63, 0xd6, 0x5c,
+  0xe0, 0x68, 0x1f, 0x06, 0xc1, 0x6a, 0x01, 0x36, 0xbb, 0x65, 0xa0, 0x5d,
+  0xa1, 0x41, 0xa8, 0x56, 0x81, 0x51, 0x5b, 0xa3, 0x07, 0xad, 0x9c, 0x06,
+  0x0a, 0x1b, 0xd8, 0x52, 0x83, 0x3d, 0xd9, 0xd4, 0xf0, 0x50, 0xf1, 0x2b,
+  0x35, 0xf8, 0x2b, 0xf1, 0x79, 0xb8, 0xdc, 0x8d, 0x35, 0x7e, 0xfa, 0x76,
+  0xda, 0xd8, 0xa6, 0xfe, 0x9f, 0x1a, 0xdc, 0xd1, 0x0c, 0xef, 0x01, 0x05,
+  0x95, 0x1a, 0xfc, 0x44, 0x7f, 0x26, 0x51, 0x26, 0x92, 0x8a, 0x17, 0x9a,
+  0x5a, 0x5f, 0x2c, 0x22, 0x08, 0xfd, 0x4d, 0x2b, 0x82, 0x2f, 0xb5, 0x22,
+  0xc6, 0x01, 0x2b, 0xb3, 0x62, 0x05, 0x4e, 0xb4, 0x42, 0xc0, 0xa9, 0x58,
+  0x5d, 0x87, 0x73, 0x8f, 0xc6, 0x97, 0xc3, 0xfc, 0x63, 0xa1, 0x73, 0x2a,
+  0x87, 0x23, 0x0b, 0x32, 0x9f, 0xed, 0xe7, 0xd6, 0xd5, 0x7a, 0xbb, 0x5c,
+  0x52, 0xfe, 0xeb, 0x7c, 0xed, 0x25, 0x4c, 0x69, 0x44, 0xd7, 0x6b, 0xde,
+  0xf1, 0x18, 0xc3, 0x33, 0x7a, 0x09, 0x07, 0xf1, 0xa9, 0x39, 0xa7, 0xe1,
+  0x1e, 0x67, 0x5d, 0x20, 0xff, 0x83, 0x01, 0x88, 0x5f, 0x7d, 0x5c, 0x7f,
+  0x48, 0xe6, 0x21, 0xa3, 0xfe, 0x82, 0x87, 0x57, 0x3c, 0x7f, 0xe4, 0xfd,
+  0xf4, 0x53, 0xb6, 0xf4, 0x22, 0x3a, 0x91, 0xbb, 0x1c, 0x78, 0xc3, 0x96,
+  0xd1, 0xaa, 0xe6, 0xde, 0xe8, 0x64, 0x94, 0xf2, 0x92, 0xc3, 0x7b, 0xd9,
+  0x09, 0xcf, 0x10, 0xea, 0xe6, 0x21, 0xec, 0xba, 0xf9, 0x71, 0x92, 0x06,
+  0x22, 0xc7, 0x8e, 0x2b, 0xa0, 0x3f, 0x0c, 0x19, 0xb3, 0x9d, 0xc3, 0x39,
+  0xb9, 0x09, 0x2a, 0x2f, 0x29, 0x72, 0xea, 0x70, 0x0e, 0xd9, 0xe7, 0xc0,
+  0x58, 0xc7, 0x60, 0x6e, 0xf2, 0xae, 0xe7, 0xca, 0xcf, 0xb3, 0xa9, 0x77,
+  0x95, 0xb9, 0x8e, 0x03, 0x07, 0x9c, 0x26, 0x8e, 0x7d, 0x2c, 0x72, 0xca,
+  0x0c, 0xd2, 0x50, 0x6f, 0x71, 0x9c, 0x63, 0x38, 0xcd, 0x3a, 0x33, 0x28,
+  0x35, 0xf3, 0xeb, 0xd3, 0x88, 0xff, 0xd9, 0x7d, 0x55, 0x09, 0x94, 0x8a,
+  0x21, 0xf7, 0xed, 0x3d, 0x15, 0x2c, 0x55, 0x7a, 0xd9, 0xf4, 0x15, 0x3a,
+  0x54, 0xe9, 0x38, 0xa8, 0xae, 0x63, 0x0e, 0x3a, 0x85, 0x0e, 0x02, 0x83,
+  0xce, 0x01, 0x9d, 0x99, 0xd4, 0x01, 0xa6, 0xfa, 0xe2, 0xb3, 0x51, 0x6f,
+  0xfa, 0xac, 0x13, 0x40, 0x9f, 0x54, 0xbe, 0x3a, 0xdf, 0xed, 0x59, 0x8b,
+  0x30, 0x8a, 0xd6, 0x2c, 0xa5, 0x64, 0xd9, 0xd7, 0xa2, 0x5c, 0xe0, 0x34,
+  0xb7, 0xaa, 0x1e, 0xe2, 0xfc, 0x06,
+  0xed, 0x99, 0xcb, 0x72, 0x9b, 0x30, 0x14, 0x86, 0xf7, 0x7d, 0x0a, 0x3d,
+  0x00, 0xe9, 0x48, 0x08, 0x63, 0xcc, 0x2e, 0xd7, 0x76, 0xa6, 0x69, 0xea,
+  0x49, 0x26, 0x69, 0xb7, 0x02, 0x04, 0xd6, 0x14, 0x23, 0x0f, 0x88, 0xc6,
+  0x79, 0xfb, 0x4a, 0x20, 0xb0, 0x4d, 0x6c, 0x7c, 0x49, 0x3a, 0x49, 0x6a,
+  0x79, 0x83, 0xc4, 0x45, 0xe6, 0xff, 0xfc, 0x9f, 0xa3, 0x23, 0x19, 0x62,
+  0x58, 0x7d, 0xdc, 0x08, 0x3a, 0xea, 0x18, 0xd9, 0x21, 0x51, 0x47, 0x84,
+  0x20, 0x52, 0x47, 0x6b, 0x9c, 0xd3, 0x90, 0x15, 0x8c, 0x67, 0xe0, 0x9c,
+  0x67, 0x22, 0xe7, 0x69, 0x4a, 0x73, 0x8b, 0xf8, 0x01, 0xb2, 0x02, 0x3f,
+  0xb0, 0xad, 0x80, 0x84, 0xbf, 0xfd, 0xc0, 0xb3, 0xa2, 0x59, 0xc4, 0x1f,
+  0x33, 0x7f, 0x02, 0x3f, 0x3b, 0xb2, 0x9d, 0xd2, 0x58, 0xa8, 0xb6, 0x3a,
+  0x9f, 0xb3, 0x64, 0x52, 0x75, 0x6c, 0xd9, 0x29, 0x67, 0xaa, 0x85, 0x2c,
+  0x75, 0x43, 0x31, 0xe1, 0x65, 0x1a, 0xd1, 0xdc, 0x0f, 0x9c, 0xba, 0x2f,
+  0x98, 0x1a, 0x0b, 0xc1, 0xaa, 0x27, 0xe4, 0x73, 0x89, 0xba, 0xe8, 0x56,
+  0xdd, 0xb9, 0x4f, 0xea, 0xf3, 0x4f, 0x3e, 0x41, 0x56, 0x35, 0xe6, 0xe2,
+  0xf9, 0x81, 0x3e, 0xa1, 0x07, 0xd0, 0xd7, 0xdb, 0x11, 0x86, 0x75, 0x5f,
+  0x0e, 0x61, 0xd7, 0x2d, 0x39, 0x06, 0xb6, 0x0a, 0x41, 0x72, 0xe1, 0x07,
+  0x23, 0x6b, 0xee, 0x07, 0xd0, 0x7a, 0xf2, 0x03, 0x6c, 0xcd, 0x52, 0x22,
+  0x62, 0x9e, 0x4f, 0xfd, 0x6b, 0x96, 0x95, 0x73, 0xeb, 0x13, 0x6c, 0xe0,
+  0x50, 0x38, 0xa8, 0x1a, 0xd8, 0xae, 0x0e, 0x08, 0x6a, 0x38, 0x97, 0x29,
+  0x0d, 0xf9, 0x14, 0xdc, 0x63, 0x17, 0xe1, 0xef, 0x8a, 0x8a, 0xad, 0xa8,
+  0x60, 0x4d, 0x45, 0x2a, 0xd9, 0x13, 0x4b, 0x52, 0xb2, 0x88, 0xca, 0x07,
+  0xed, 0x3e, 0x40, 0xde, 0x0b, 0xf9, 0x8c, 0xf6, 0xc1, 0x23, 0x61, 0x36,
+  0x7c, 0xd0, 0x76, 0x3e, 0xc3, 0xf5, 0x7c, 0x7e, 0x42, 0x74, 0xff, 0x8c,
+  0xce, 0xab, 0x78, 0xe6, 0x00, 0x0a, 0xfb, 0xda, 0xa2, 0x47, 0x76, 0x0c,
+  0xa9, 0xd6, 0xab, 0xcf, 0xc0, 0x4a, 0xbf, 0x75, 0xcd, 0x13, 0x16, 0xe2,
+  0x4e, 0xc0, 0x40, 0x25, 0x1e, 0x69, 0xf1, 0xee, 0x81, 0xce, 0xf0, 0xfa,
+  0x8c, 0x31, 0x5a, 0x41, 0x42, 0xec, 0xbd, 0x03, 0x07, 0xae, 0x12, 0x22,
+  0x83, 0x96, 0x10, 0x6e, 0x09, 0x39, 0x0d, 0xa1, 0xa1, 0x22, 0x64, 0x6f,
+  0x09, 0x9c, 0x05, 0x21, 0x47, 0x13, 0xaa, 0x8d, 0xf1, 0x85, 0x4c, 0x69,
+  0x21, 0xf8, 0x0c, 0x18, 0x54, 0x5d, 0x54, 0xb8, 0x36, 0x51, 0x9b, 0x80,
+  0x1f, 0x58, 0x28, 0xbf, 0x65, 0x0e, 0xc6, 0x39, 0x07, 0x57, 0xed, 0x2b,
+  0x80, 0xf1, 0x9d, 0xf3, 0xf2, 0x34, 0xdc, 0x9f, 0x6f, 0x96, 0x82, 0x6b,
+  0x6b, 0x28, 0xed, 0x93, 0x4d, 0x1b, 0xa5, 0xc3, 0x77, 0xa3, 0x74, 0xe3,
+  0xd4, 0xf3, 0x4f, 0x74, 0x8f, 0x6a, 0xbd, 0x8b, 0x29, 0xf6, 0x62, 0x2c,
+  0x45, 0x62, 0xf0, 0x40, 0xf3, 0xa2, 0x2c, 0x6a, 0xe9, 0x2c, 0x4b, 0x3e,
+  0xf8, 0xcf, 0x8b, 0xb4, 0x91, 0xdb, 0x98, 0x3f, 0x8d, 0x05, 0xcd, 0x93,
+  0x94, 0x3f, 0x82, 0x5f, 0x01, 0x9f, 0x03, 0xec, 0x42, 0x13, 0xf6, 0xcb,
+  0xb4, 0x56, 0x33, 0x64, 0xc5, 0xc8, 0xf0, 0x69, 0xf9, 0x38, 0x9d, 0x64,
+  0xa1, 0x02, 0xe6, 0x35, 0x2b, 0xd2, 0x03, 0x13, 0xc4, 0xdb, 0xd7, 0xa6,
+  0x0d, 0x20, 0xda, 0xc9, 0x2a, 0xb7, 0x5c, 0xe6, 0xce, 0x73, 0x92, 0x45,
+  0x4f, 0xc0, 0xb0, 0xea, 0xb0, 0x8a, 0x6b, 0x46, 0x6d, 0xb0, 0x2d, 0x58,
+  0x1d, 0x7b, 0x9c, 0xd9, 0xde, 0x86, 0xc9, 0x69, 0xc9, 0x4e, 0x47, 0xbc,
+  0x10, 0xd4, 0x94, 0xb0, 0x36, 0x0e, 0x6c, 0x28, 0x5d, 0x9e, 0x82, 0xbb,
+  0x19, 0xcf, 0x45, 0x61, 0x62, 0xad, 0x8b, 0x0a, 0x75, 0x62, 0x4d, 0x19,
+  0x6a, 0x81, 0xcb, 0xcc, 0x70, 0x2d, 0xa8, 0x51, 0x03, 0xca, 0xc1, 0x9d,
+  0x7a, 0x69, 0x9c, 0xb3, 0x62, 0x4a, 0xe4, 0x0b, 0x18, 0x5c, 0xcf, 0x70,
+  0x35, 0x65, 0xe6, 0x16, 0x5c, 0x00, 0x3a, 0xde, 0x89, 0x5c, 0x72, 0x9c,
+  0xdc, 0x9c, 0x1a, 0x72, 0x35, 0x39, 0x89, 0xcd, 0x5d, 0x57, 0x98, 0xff,
+  0xc8, 0xa8, 0xf1, 0x59, 0x4b, 0xcb, 0x71, 0x3b, 0xa9, 0x7e, 0x69, 0x22,
+  0xdc, 0x0d, 0xd7, 0xc7, 0xd6, 0xef, 0x3a, 0x1d, 0xfd, 0x2a, 0x7f, 0x9f,
+  0x11, 0x21, 0xe4, 0x8b, 0x31, 0x9a, 0x46, 0x4a, 0xff, 0xb1, 0x7b, 0xc4,
+  0x83, 0x9d, 0xa2, 0xe9, 0x8a, 0x84, 0x94, 0xc7, 0x71, 0xb5, 0x93, 0x71,
+  0xc3, 0x32, 0x41, 0xb3, 0x88, 0x83, 0xbb, 0x47, 0x26, 0xc2, 0xc9, 0xfb,
+  0x2c, 0x0e, 0xa6, 0xac, 0x08, 0x91, 0xbc, 0x15, 0xbf, 0x55, 0x99, 0xe0,
+  0xa1, 0x0d, 0x08, 0x2f, 0x68, 0x5a, 0xce, 0xa9, 0x21, 0xb9, 0x3b, 0x49,
+  0xa7, 0x9f, 0xa4, 0xa1, 0xb8, 0x13, 0xc5, 0xc1, 0x9a, 0x75, 0x50, 0xb5,
+  0x33, 0x37, 0x23, 0x51, 0xe5, 0x46, 0xb5, 0x85, 0x1d, 0x96, 0x01, 0x5d,
+  0x07, 0x10, 0xfe, 0x77, 0xd5, 0xfe, 0xae, 0x99, 0x70, 0xb8, 0x79, 0x17,
+  0xc2, 0x18, 0x6f, 0x27, 0x82, 0xdd, 0x05, 0xf8, 0xa2, 0x3a, 0x33, 0x01,
+  0xbc, 0x07, 0x47, 0xa2, 0xff, 0x5d, 0xb0, 0x9b, 0xf5, 0x81, 0x0a, 0xe0,
+  0xb6, 0x60, 0xbb, 0x25, 0x7f, 0x68, 0x06, 0xce, 0x52, 0x49, 0xe9, 0xd8,
+  0x8b, 0x17, 0xe2, 0xf5, 0x81, 0xea, 0xa9, 0x6c, 0x0f, 0x36, 0x17, 0xec,
+  0x35, 0x17, 0x7a, 0x69, 0x72, 0xb3, 0xff, 0x55, 0x72, 0x0b, 0x34, 0xa9,
+  0x95, 0x52, 0xd8, 0x2c, 0x9e, 0x76, 0x20, 0x86, 0x96, 0xbd, 0x65, 0x88,
+  0xf5, 0x10, 0x0b, 0x1b, 0x62, 0xf6, 0x92, 0xc7, 0xbe, 0xb1, 0x2c, 0x89,
+  0xf8, 0x14, 0x7c, 0xa5, 0xe4, 0xb8, 0xf7, 0xcc, 0xfe, 0x02,
+  0xed, 0x59, 0xdf, 0x6f, 0xa3, 0x38, 0x10, 0x7e, 0xbf, 0xbf, 0xc2, 0x8f,
+  0x77, 0x0a, 0x3d, 0xd9, 0xe6, 0x77, 0xde, 0x9a, 0x74, 0xb7, 0xd2, 0xde,
+  0x6e, 0x37, 0x2a, 0xbb, 0x77, 0xab, 0x7b, 0x33, 0xc1, 0x49, 0xd0, 0x12,
+  0x88, 0x08, 0xb9, 0x26, 0x2f, 0xfd, 0xdb, 0xcf, 0x18, 0x63, 0xc0, 0x21,
+  0x04, 0xd2, 0xf4, 0xb4, 0x3d, 0x6d, 0x55, 0x09, 0xe3, 0x08, 0x32, 0xdf,
+  0x37, 0x33, 0xdf, 0x78, 0x26, 0x50, 0x87, 0xfc, 0xcf, 0x5a, 0x40, 0x9a,
+  0x5f, 0x03, 0x1b, 0xe2, 0x62, 0xc3, 0x32, 0xf2, 0x8b, 0x36, 0xbb, 0x9b,
+  0x81, 0x49, 0x44, 0xe6, 0xdf, 0xc1, 0x94, 0xac, 0x13, 0xf0, 0x57, 0x98,
+  0xd2, 0x00, 0x7c, 0xf3, 0x93, 0x3d, 0xf0, 0x68, 0x1a, 0xd2, 0x2d, 0xf8,
+  0x06, 0xa6, 0x49, 0x9c, 0xa5, 0x49, 0x14, 0xd1, 0x54, 0x23, 0x63, 0x1f,
+  0x6a, 0xfe, 0xd8, 0x47, 0x9a, 0xcf, 0x1e, 0x19, 0xfb, 0x96, 0x16, 0x6c,
+  0x82, 0xe4, 0x29, 0x66, 0x3b, 0x3a, 0x5b, 0x46, 0x74, 0x91, 0xb1, 0xa5,
+  0xc1, 0x96, 0x69, 0xb8, 0x5c, 0x65, 0x62, 0x7b, 0xb7, 0xe1, 0x9b, 0xf9,
+  0xa7, 0xdb, 0x55, 0xb2, 0x8b, 0x02, 0x9a, 0x8e, 0x7d, 0x71, 0x9f, 0x85,
+  0xf9, 0x7b, 0x5c, 0x7e, 0x93, 0xb1, 0x87, 0x96, 0xec, 0x33, 0x82, 0xf9,
+  0xed, 0x7e, 0x4c, 0x20, 0x5f, 0x1c, 0xc6, 0x04, 0x69, 0xfc, 0x85, 0xd5,
+  0xe3, 0xa6, 0xd8, 0x28, 0x9e, 0x47, 0xb0, 0xb8, 0x95, 0x6f, 0x10, 0x1f,
+  0xb3, 0x57, 0xe8, 0xc5, 0x8a, 0xbd, 0xc3, 0xd0, 0xb6, 0x19, 0x49, 0x99,
+  0x51, 0xb6, 0xb6, 0x1f, 0xfb, 0x58, 0x3b, 0x8c, 0x7d, 0x5d, 0xdb, 0x44,
+  0x24, 0x5b, 0x24, 0xe9, 0x7a, 0xfc, 0x31, 0x8c, 0x77, 0x7b, 0xed, 0x17,
+  0xa8, 0x12, 0xe6, 0xb4, 0x10, 0x56, 0xe7, 0xa7, 0x0f, 0x3b, 0x2b, 0xf8,
+  0xbb, 0x51, 0xd2, 0xc3, 0xd6, 0x8e, 0xe4, 0x87, 0xdd, 0xe0, 0x82, 0x20,
+  0xb6, 0x42, 0xda, 0x72, 0x17, 0x06, 0x74, 0xec, 0x3b, 0x6f, 0x93, 0x2a,
+  0xba, 0x10, 0x54, 0xd9, 0x27, 0xa8, 0xfa, 0x23, 0x8c, 0x29, 0x33, 0x42,
+  0x04, 0xd9, 0x4f, 0xe2, 0x6c, 0x07, 0x0a, 0x06, 0x8b, 0x0b, 0xe2, 0xff,
+  0x8c, 0xb8, 0x4f, 0xe1, 0x3c, 0x65, 0xec, 0xd0, 0xef, 0xe0, 0x43, 0x72,
+  0xe0, 0x5f, 0x9f, 0x53, 0x84, 0xeb, 0x14, 0xa9, 0x50, 0xad, 0x06, 0x3a,
+  0x81, 0xbc, 0x13, 0x9d, 0xdd, 0x84, 0xc3, 0xd0, 0x0a, 0xd3, 0xdd, 0xdc,
+  0x74, 0x3d, 0x37, 0x1d, 0x76, 0x99, 0x5e, 0xac, 0xc4, 0x7d, 0x79, 0xd5,
+  0xbe, 0x3c, 0x4e, 0x92, 0x0c, 0xfc, 0x19, 0xa6, 0xd9, 0x8e, 0x44, 0xb9,
+  0xf9, 0x1b, 0x12, 0xe4, 0xc6, 0x23, 0xc4, 0xad, 0xc7, 0xc2, 0x7c, 0x64,
+  0x4a, 0xe5, 0xb0, 0xa4, 0x70, 0xe8, 0x95, 0x6e, 0x18, 0x42, 0x36, 0x4c,
+  0x05, 0x26, 0xb2, 0xeb, 0x2e, 0xc5, 0xa8, 0xe9, 0x53, 0xf3, 0x3c, 0x6a,
+  0xe4, 0x34, 0x9c, 0x8a, 0xb1, 0xe2, 0x54, 0xdc, 0xe5, 0x54, 0x64, 0xe5,
+  0xd4, 0x20, 0xce, 0x0d, 0x13, 0xb4, 0x93, 0xe4, 0xb8, 0x82, 0x14, 0x88,
+  0xb8, 0x87, 0x11, 0x2a, 0xfd, 0x4a, 0x0e, 0x8b, 0x88, 0x6c, 0x57, 0x2c,
+  0x03, 0x42, 0xf0, 0x15, 0xcc, 0xd2, 0x04, 0xdc, 0x06, 0x64, 0x93, 0x15,
+  0x29, 0xc0, 0x19, 0xc2, 0xd2, 0xbf, 0x03, 0x53, 0xa0, 0x23, 0xf2, 0x11,
+  0x6c, 0x06, 0x87, 0x35, 0x38, 0xf4, 0x91, 0x12, 0x2b, 0xb6, 0x64, 0x09,
+  0x4b, 0x96, 0xf4, 0x46, 0xfc, 0xc0, 0x33, 0xa1, 0x5f, 0x52, 0xa4, 0x77,
+  0x51, 0x74, 0x97, 0x44, 0x9b, 0x55, 0x18, 0x4f, 0x48, 0x2a, 0xe3, 0x5f,
+  0xbf, 0x94, 0x1f, 0x21, 0x11, 0xa8, 0x9d, 0xa9, 0x0b, 0xb8, 0x19, 0x4a,
+  0x06, 0x3a, 0x4f, 0x86, 0xd0, 0x01, 0x68, 0x0b, 0x32, 0xbe, 0x7a, 0x13,
+  0xb0, 0x24, 0x6b, 0x2a, 0x72, 0x48, 0x11, 0x80, 0xb7, 0x11, 0x20, 0x2d,
+  0x69, 0xd4, 0x4b, 0x60, 0x04, 0x27, 0x08, 0x41, 0x99, 0x4c, 0x92, 0x93,
+  0xfb, 0x73, 0x9c, 0x30, 0xc3, 0x05, 0x23, 0xcc, 0xf2, 0x92, 0x0f, 0x22,
+  0xd8, 0xa8, 0x1b, 0xd2, 0xf7, 0xeb, 0xa5, 0x34, 0x3f, 0x52, 0x56, 0xb4,
+  0x94, 0xda, 0xd5, 0x9e, 0xb8, 0x23, 0xfe, 0xd5, 0xdc, 0x88, 0x1b, 0x6e,
+  0x4f, 0x61, 0xc5, 0x88, 0xaf, 0x99, 0x19, 0x37, 0x04, 0x75, 0x6b, 0xb8,
+  0xad, 0x72, 0x6e, 0x74, 0x2a, 0x76, 0xcf, 0x8c, 0x93, 0x88, 0xca, 0x8c,
+  0xf3, 0xe8, 0x92, 0x00, 0x8f, 0x64, 0xbb, 0x34, 0xfe, 0x2f, 0xc1, 0xa8,
+  0x59, 0x64, 0x5c, 0x04, 0x66, 0xae, 0xc8, 0xc7, 0x97, 0xfb, 0xbf, 0xbb,
+  0x0e, 0x16, 0x08, 0xbe, 0x2c, 0x6b, 0xac, 0x46, 0xd6, 0xe8, 0x4d, 0x88,
+  0x4e, 0xef, 0x9a, 0x5b, 0xbe, 0x40, 0x75, 0xa8, 0xdb, 0xa5, 0x24, 0x2c,
+  0xc7, 0xca, 0xb4, 0x39, 0x5f, 0x7a, 0x30, 0x2e, 0x08, 0x39, 0xe5, 0x65,
+  0x78, 0x75, 0x29, 0xa9, 0x45, 0xa5, 0x02, 0xda, 0x3a, 0xd2, 0x86, 0xba,
+  0xa7, 0x71, 0x3f, 0x4f, 0xeb, 0x6a, 0x2d, 0xbd, 0x4d, 0xe7, 0x24, 0xa0,
+  0xe0, 0xbd, 0xe4, 0x13, 0xbc, 0x67, 0x8f, 0xbc, 0xbc, 0x8e, 0x96, 0x75,
+  0x02, 0xbf, 0x42, 0x9d, 0xb8, 0x20, 0xc2, 0x8d, 0xb2, 0x40, 0x42, 0xb5,
+  0x40, 0xe6, 0x22, 0x38, 0xdd, 0xf9, 0xf4, 0xe8, 0x08, 0x71, 0x51, 0x8c,
+  0xcb, 0x03, 0x90, 0x3e, 0xf8, 0xe4, 0x48, 0x0c, 0x19, 0xb6, 0xa6, 0x0c,
+  0x5b, 0x7c, 0x89, 0x93, 0x0d, 0xe3, 0x2c, 0xd8, 0x16, 0xe5, 0x85, 0x55,
+  0x13, 0x6a, 0x54, 0x4d, 0xa8, 0xd9, 0xd6, 0x84, 0xe2, 0x1f, 0x08, 0xab,
+  0xa9, 0x60, 0x7d, 0xa0, 0xfb, 0x30, 0xda, 0xed, 0xdb, 0xa0, 0xfe, 0x9f,
+  0x5c, 0x6c, 0xa9, 0xb0, 0x43, 0xd6, 0xe8, 0xc4, 0x41, 0x32, 0x0c, 0xf7,
+  0x50, 0x57, 0x5f, 0xd6, 0x10, 0x49, 0xcc, 0xcf, 0x15, 0xe8, 0xe7, 0x4b,
+  0x50, 0x07, 0xf8, 0xd4, 0x31, 0xf7, 0x13, 0x59, 0xb2, 0x8e, 0xf8, 0xc1,
+  0x7b, 0x6d, 0xe1, 0xfa, 0xf1, 0x5b, 0x81, 0x40, 0x24, 0xbf, 0x3c, 0xe9,
+  0xdd, 0xcf, 0xee, 0x58, 0x17, 0x10, 0x03, 0xfc, 0x73, 0x54, 0xc0, 0x48,
+  0x42, 0x81, 0xa0, 0x46, 0x6f, 0xa4, 0xcf, 0x5d, 0xde, 0x66, 0x4f, 0x92,
+  0x3d, 0xef, 0x97, 0xa6, 0x2c, 0xa4, 0xb6, 0x2c, 0x9c, 0x6a, 0x69, 0xf3,
+  0xb2, 0x9e, 0xa1, 0x8c, 0x29, 0xf8, 0x0a, 0xd3, 0x86, 0x73, 0x61, 0x73,
+  0xae, 0x41, 0x98, 0xa3, 0xc6, 0xf8, 0x44, 0x32, 0x72, 0x1b, 0x85, 0x34,
+  0x7e, 0x22, 0x29, 0x05, 0x9c, 0x9b, 0x69, 0xb2, 0xde, 0x90, 0x2c, 0xf4,
+  0x23, 0xca, 0x15, 0x06, 0xcc, 0x22, 0x72, 0xf0, 0x32, 0xb6, 0x93, 0xc4,
+  0xbd, 0x8e, 0xf1, 0x6f, 0xa6, 0xbd, 0xc2, 0x83, 0x92, 0x2e, 0x80, 0x7c,
+  0x46, 0x07, 0x4d, 0xa3, 0xd9, 0x5e, 0xdd, 0xa7, 0xe4, 0x9f, 0x70, 0x0b,
+  0xde, 0x45, 0xe1, 0x3a, 0x8c, 0x49, 0x96, 0xa4, 0xf9, 0x94, 0xe2, 0x9a,
+  0x7d, 0xc1, 0xd1, 0x39, 0xea, 0xaa, 0xa7, 0xa6, 0x12, 0x56, 0x31, 0x81,
+  0xac, 0x82, 0xa2, 0x86, 0xe7, 0x76, 0xc1, 0x52, 0xc3, 0x5b, 0x25, 0xc5,
+  0x50, 0xad, 0x01, 0xcb, 0xad, 0x60, 0xe9, 0x15, 0x2c, 0xb3, 0x06, 0xcb,
+  0x2c, 0x61, 0xe9, 0xaf, 0x38, 0x46, 0x30, 0x8e, 0x7d, 0xea, 0xf4, 0x01,
+  0x4f, 0xa1, 0x59, 0x80, 0xc7, 0x35, 0x8f, 0x32, 0xf0, 0x1f, 0x92, 0xc3,
+  0x0d, 0x0b, 0x75, 0xf0, 0xeb, 0xc7, 0xdf, 0xb4, 0x51, 0x61, 0x17, 0x0f,
+  0xde, 0x51, 0x61, 0x1a, 0x8f, 0xf0, 0x1b, 0xb9, 0xef, 0x14, 0xeb, 0x43,
+  0x11, 0xd6, 0x47, 0x1d, 0x94, 0x7e, 0x26, 0xd2, 0x8f, 0x50, 0xd6, 0x11,
+  0xe0, 0x9e, 0x08, 0xec, 0x53, 0x08, 0x1e, 0xaf, 0x80, 0xa0, 0xbb, 0x40,
+  0xa2, 0x93, 0x08, 0xdc, 0x21, 0x08, 0x5c, 0x5c, 0xe6, 0x15, 0xb6, 0x1c,
+  0xa8, 0x57, 0xc7, 0x1c, 0xef, 0x29, 0xcc, 0xe6, 0x2b, 0x3e, 0xfb, 0x6b,
+  0x3d, 0xcb, 0x16, 0x46, 0x1a, 0xd5, 0x41, 0x07, 0x57, 0x07, 0x9d, 0xda,
+  0x80, 0x14, 0x95, 0x13, 0x52, 0x24, 0x55, 0x5a, 0x9d, 0x95, 0xba, 0x75,
+  0x5c, 0x76, 0xb3, 0xa4, 0xf5, 0x50, 0x6c, 0xe9, 0xcb, 0xe2, 0x05, 0xce,
+  0xc9, 0x92, 0xd6, 0x22, 0xe0, 0x96, 0x14, 0x70, 0xdc, 0x9b, 0x2a, 0x84,
+  0x1c, 0xe5, 0x44, 0x78, 0x92, 0xaa, 0x86, 0x3f, 0xdd, 0x6b, 0x4d, 0x02,
+  0xcd, 0x46, 0x1c, 0x60, 0x75, 0x7e, 0x71, 0x4c, 0xd8, 0x3a, 0xdc, 0xce,
+  0x91, 0x1c, 0xcb, 0x1c, 0x35, 0xbc, 0xd5, 0x98, 0xa0, 0x99, 0xe8, 0x4e,
+  0x67, 0x97, 0x0f, 0x07, 0x50, 0x87, 0x6c, 0x95, 0x3a, 0xef, 0x33, 0xf0,
+  0x1e, 0xde, 0x79, 0x5d, 0xa1, 0x75, 0xdd, 0x6e, 0x7f, 0xa0, 0x7e, 0xf7,
+  0x05, 0xe6, 0xb6, 0x00, 0x7b, 0xb0, 0x8c, 0x3a, 0xae, 0x91, 0x60, 0x31,
+  0xa7, 0x6c, 0x24, 0x78, 0x64, 0xe0, 0x6e, 0xca, 0x6d, 0x57, 0x2c, 0x0f,
+  0xb9, 0x0d, 0x55, 0xd0, 0x5c, 0x29, 0x58, 0x94, 0xd9, 0x0f, 0x3e, 0x1d,
+  0x1e, 0x08, 0xf7, 0x9e, 0xe3, 0x59, 0x67, 0x89, 0xd1, 0x6d, 0xf9, 0x8b,
+  0x4b, 0xa1, 0x8c, 0x6d, 0x53, 0x80, 0x26, 0x52, 0x9e, 0x20, 0x42, 0x40,
+  0x60, 0x4d, 0x40, 0x90, 0x10, 0x10, 0x67, 0xf0, 0x61, 0xd7, 0x1a, 0x7c,
+  0xba, 0xed, 0xe9, 0xf6, 0x1a, 0x3a, 0xc4, 0x54, 0xb3, 0xbb, 0x39, 0x94,
+  0x48, 0x71, 0xcb, 0x4f, 0x49, 0xb5, 0x9f, 0xa0, 0x45, 0xc9, 0xee, 0xa1,
+  0x80, 0xcf, 0x2a, 0x50, 0xb7, 0x8f, 0xe6, 0x3d, 0x37, 0x2a, 0x1c, 0x6a,
+  0xaf, 0x0f, 0xff, 0x02,
+  0xe5, 0x98, 0x59, 0x6f, 0xe3, 0x36, 0x10, 0xc7, 0xdf, 0xfb, 0x29, 0xf8,
+  0x1e, 0xa5, 0xe0, 0xa5, 0xcb, 0x6f, 0x8e, 0x9b, 0x35, 0x50, 0x34, 0x69,
+  0x10, 0x17, 0x45, 0xbb, 0x6f, 0x94, 0x44, 0xd9, 0x42, 0x14, 0xc9, 0xd0,
+  0x81, 0x8d, 0xf7, 0xa1, 0x9f, 0xbd, 0xa4, 0x2e, 0xeb, 0xb4, 0x24, 0xc7,
+  0x8b, 0x4d, 0x60, 0x07, 0xb0, 0x48, 0x07, 0xa6, 0x67, 0x7e, 0x33, 0xf3,
+  0xe7, 0x90, 0x90, 0xc0, 0xec, 0x65, 0x20, 0xa4, 0xcb, 0xa7, 0x69, 0x42,
+  0x96, 0x7d, 0x80, 0xc4, 0x9f, 0x78, 0x29, 0xcf, 0x3c, 0x89, 0xc2, 0xc0,
+  0xb3, 0xc1, 0xd2, 0x61, 0xfb, 0x84, 0x47, 0x0a, 0x5b, 0x58, 0x50, 0xf1,
+  0xb9, 0x9b, 0xbc, 0x2d, 0x58, 0x3e, 0x38, 0x2c, 0x18, 0x52, 0xf6, 0x3e,
+  0x4b, 0xdc, 0x30, 0x7a, 0x5d, 0xfc, 0xe1, 0x05, 0xe9, 0x9b, 0xf2, 0x0b,
+  0x2c, 0x17, 0x26, 0x50, 0x95, 0x4f, 0x15, 0xe2, 0x62, 0xdd, 0x62, 0xe1,
+  0x27, 0xe6, 0x78, 0x6f, 0xe0, 0x39, 0xb4, 0x5f, 0x5c, 0x2f, 0xe2, 0xe0,
+  0xc9, 0x67, 0x87, 0x4d, 0xc2, 0x12, 0x2f, 0x0c, 0xc0, 0x5d, 0xe4, 0x39,
+  0x5b, 0x9e, 0xff, 0x92, 0xb5, 0xb0, 0x90, 0x62, 0x31, 0xfb, 0x45, 0x3c,
+  0xa1, 0xe2, 0xec, 0x9d, 0xf0, 0x5b, 0xb0, 0xd8, 0xc1, 0x5f, 0xa9, 0x18,
+  0xcb, 0x1f, 0x97, 0x63, 0x43, 0x8c, 0x23, 0x6f, 0xbb, 0xcb, 0x26, 0x58,
+  0x4c, 0xd2, 0xbd, 0x1c, 0xa1, 0xcc, 0xba, 0x78, 0x17, 0xa6, 0xbe, 0xc3,
+  0xa3, 0x85, 0x45, 0xf3, 0x79, 0xe2, 0xc9, 0xc5, 0x8c, 0x6c, 0x92, 0x88,
+  0xaf, 0x6d, 0xe5, 0xff, 0xb4, 0x1e, 0x97, 0xb2, 0x25, 0x8f, 0x5f, 0x57,
+  0x8b, 0x0f, 0xf2, 0xef, 0x9b, 0xf9, 0xac, 0x5a, 0x40, 0xcf, 0xe7, 0x62,
+  0x05, 0x9c, 0x8f, 0xc4, 0x12, 0x44, 0x89, 0x13, 0x16, 0x25, 0xc2, 0x72,
+  0xa4, 0xbc, 0x2d, 0x2c, 0xac, 0x1c, 0x16, 0x16, 0x19, 0x25, 0xa5, 0xb5,
+  0x49, 0x79, 0x77, 0xa9, 0xeb, 0x32, 0x3f, 0x04, 0x9b, 0x74, 0xcf, 0x23,
+  0xf0, 0x85, 0xbd, 0x7a, 0x76, 0xf8, 0x0a, 0x56, 0x61, 0x20, 0x42, 0xe3,
+  0xfb, 0x79, 0x4c, 0x90, 0x24, 0x05, 0x0b, 0x52, 0x5a, 0x09, 0xea, 0x46,
+  0xb8, 0x51, 0x70, 0xba, 0x65, 0xb0, 0xc2, 0x74, 0x93, 0x8d, 0x05, 0xa5,
+  0x5b, 0xd6, 0x85, 0xd4, 0x71, 0xbb, 0x70, 0x42, 0x97, 0x3e, 0x10, 0xe9,
+  0x03, 0x1e, 0xf6, 0x41, 0x25, 0xb9, 0xf1, 0xba, 0x70, 0x43, 0xfa, 0x80,
+  0x0b, 0x1f, 0x1e, 0x99, 0x2d, 0x02, 0xbb, 0x5e, 0xdd, 0x8a, 0x69, 0x27,
+  0xb0, 0xda, 0xdc, 0xb8, 0x6e, 0x53, 0xcf, 0xe1, 0x65, 0x0c, 0x07, 0x02,
+  0x6c, 0x36, 0x02, 0x2c, 0xa2, 0x32, 0x33, 0xc0, 0x22, 0xdb, 0x1a, 0x11,
+  0x66, 0x6a, 0x15, 0x61, 0x52, 0x45, 0x98, 0x36, 0xe0, 0x8c, 0x05, 0xd8,
+  0x44, 0x5a, 0x3e, 0x72, 0xb9, 0x7c, 0xc7, 0xb4, 0xac, 0x31, 0xf6, 0x5d,
+  0xc4, 0x75, 0xc3, 0x2c, 0x1e, 0x25, 0x61, 0x98, 0xec, 0xae, 0x1e, 0x10,
+  0x72, 0x9d, 0x1e, 0x40, 0x7f, 0x06, 0xdf, 0x19, 0x58, 0xf9, 0x2c, 0x8e,
+  0x85, 0x1c, 0xdd, 0x3b, 0x9e, 0xd4, 0x8a, 0x61, 0x54, 0x16, 0xaa, 0x48,
+  0xc9, 0xfa, 0x2b, 0x41, 0x59, 0xa8, 0xe0, 0x64, 0x21, 0xf2, 0x59, 0x31,
+  0xb9, 0x30, 0xcb, 0x9f, 0x72, 0x7e, 0x94, 0xd4, 0x0d, 0x69, 0xa9, 0x02,
+  0xae, 0xa3, 0x31, 0x2e, 0x28, 0x9f, 0x08, 0xbe, 0x53, 0x3f, 0x11, 0x9a,
+  0x23, 0xa0, 0x66, 0xa5, 0x3d, 0x70, 0x1c, 0x8b, 0x86, 0x20, 0xac, 0xc8,
+  0x08, 0x2c, 0xeb, 0x88, 0xf3, 0x60, 0x19, 0x7b, 0x0c, 0xdc, 0xfb, 0xdc,
+  0xce, 0xb7, 0xb3, 0xf8, 0x07, 0x82, 0xd2, 0x86, 0xd3, 0xa7, 0x80, 0x78,
+  0x92, 0x93, 0x7e, 0x32, 0x7d, 0xac, 0xbe, 0xf4, 0xc1, 0xcd, 0x8d, 0x66,
+  0x2a, 0x28, 0xa3, 0x95, 0x3f, 0x6b, 0x26, 0x21, 0xd5, 0x77, 0xe2, 0x35,
+  0x7b, 0xe5, 0x7b, 0xe6, 0x5c, 0x6d, 0x2a, 0x39, 0x04, 0x35, 0x08, 0x6d,
+  0xbe, 0x3e, 0xfc, 0x0b, 0x9e, 0xc2, 0x6f, 0x42, 0x8d, 0x08, 0xf8, 0x2b,
+  0x8d, 0xac, 0xb0, 0xda, 0x7b, 0xf1, 0xb9, 0x68, 0x0a, 0x11, 0x42, 0xf8,
+  0xa3, 0x41, 0x82, 0xd3, 0x64, 0x08, 0x15, 0x1f, 0x54, 0x90, 0x1e, 0xd8,
+  0xc1, 0x15, 0x2a, 0xbd, 0x13, 0x3b, 0x5a, 0x92, 0x46, 0x41, 0xb3, 0x73,
+  0xcc, 0x92, 0xe8, 0x5d, 0xc9, 0xa3, 0x36, 0x49, 0xe8, 0x6d, 0xbf, 0xb5,
+  0x96, 0xa3, 0xb8, 0x1b, 0x79, 0x3a, 0xee, 0x14, 0x6e, 0xd7, 0x46, 0x25,
+  0x22, 0xbf, 0x87, 0x87, 0x8c, 0x69, 0x67, 0xeb, 0xf9, 0x91, 0x45, 0xa1,
+  0x8e, 0xc7, 0x5b, 0x9b, 0x1a, 0xef, 0x1e, 0xdd, 0x30, 0x67, 0x6c, 0x3b,
+  0x88, 0x0c, 0xc5, 0xfb, 0x28, 0xa9, 0xf5, 0x98, 0x0f, 0x56, 0x87, 0x51,
+  0x63, 0x84, 0xeb, 0x8c, 0x50, 0xc5, 0x88, 0xf6, 0x4a, 0x6b, 0xe5, 0x93,
+  0x31, 0x59, 0x4d, 0xa5, 0xdb, 0xff, 0x0d, 0xf8, 0x3d, 0x35, 0xcf, 0xe9,
+  0xb0, 0x18, 0x88, 0x9d, 0xf7, 0x7a, 0x85, 0xc0, 0xc4, 0x79, 0xb5, 0x50,
+  0x9d, 0xf2, 0xc6, 0xc6, 0xfb, 0xc8, 0xc3, 0x35, 0x0f, 0xc1, 0x3f, 0x60,
+  0x19, 0xd9, 0xcc, 0xe1, 0x60, 0x73, 0x99, 0xb2, 0xe9, 0x94, 0xf3, 0xf0,
+  0x79, 0xc4, 0xb4, 0xb0, 0x51, 0x6f, 0x95, 0x8e, 0xc7, 0x5a, 0xb6, 0xdf,
+  0x05, 0x3c, 0x01, 0x34, 0xe0, 0x31, 0x8d, 0xc5, 0x5b, 0x65, 0x16, 0x2d,
+  0xcc, 0xc2, 0xbd, 0xa9, 0x37, 0x92, 0x6b, 0x85, 0x69, 0x44, 0x9a, 0x86,
+  0xa4, 0x69, 0xea, 0xa8, 0x69, 0xc5, 0x81, 0xa9, 0x6b, 0xda, 0x7a, 0x05,
+  0x58, 0xe0, 0x80, 0x47, 0x8d, 0x76, 0x14, 0x54, 0x3f, 0x36, 0xb9, 0xe8,
+  0xd8, 0xe4, 0xe2, 0x5a, 0x93, 0x4b, 0xca, 0x26, 0x17, 0xce, 0xee, 0x3f,
+  0xf0, 0x84, 0x86, 0x83, 0x76, 0x3d, 0x35, 0x46, 0x3d, 0xa5, 0x43, 0x9e,
+  0xfe, 0x96, 0x32, 0x1f, 0x3c, 0xde, 0x6f, 0x7a, 0x76, 0x8a, 0x32, 0x16,
+  0x33, 0xce, 0xb3, 0x95, 0x65, 0x63, 0xf6, 0x68, 0xf0, 0x5a, 0xc8, 0x17,
+  0x8d, 0x9e, 0xbc, 0x58, 0xc0, 0x79, 0x65, 0x7a, 0x41, 0xc2, 0x03, 0x27,
+  0xac, 0x8e, 0x53, 0x3d, 0x97, 0x09, 0xb4, 0x0d, 0x3f, 0xf7, 0xad, 0x70,
+  0x99, 0xd6, 0x5c, 0x56, 0x4b, 0x97, 0xbb, 0x35, 0x73, 0xb2, 0x42, 0xe0,
+  0xe9, 0x0a, 0x61, 0xa4, 0x08, 0x91, 0x0e, 0x51, 0x43, 0x57, 0x36, 0xcc,
+  0x4b, 0xf8, 0x0b, 0x78, 0xc2, 0x18, 0x56, 0x9d, 0x29, 0x39, 0xff, 0xca,
+  0x43, 0x1b, 0x69, 0x28, 0x68, 0x27, 0x2c, 0xa5, 0xed, 0x68, 0xdc, 0x76,
+  0x73, 0xc0, 0x76, 0xc3, 0xe8, 0xb1, 0xfd, 0x43, 0xdf, 0x6b, 0xd5, 0xdb,
+  0x86, 0x19, 0x00, 0x2c, 0x48, 0x7b, 0x01, 0x98, 0x26, 0xcc, 0x0b, 0x7f,
+  0x19, 0x30, 0x3f, 0xdc, 0x76, 0xb6, 0x4f, 0xf3, 0x93, 0x1c, 0x31, 0x7a,
+  0xba, 0x29, 0x63, 0xc2, 0xa6, 0x59, 0xf1, 0xb1, 0x73, 0x3e, 0x08, 0xb5,
+  0x93, 0xdb, 0xcc, 0x6f, 0xca, 0x2e, 0xd2, 0x53, 0x98, 0xa7, 0x8e, 0xa8,
+  0x67, 0x28, 0x95, 0x7e, 0x9a, 0xce, 0xe9, 0x33, 0x2a, 0x9e, 0x85, 0xc7,
+  0x75, 0x9b, 0x4d, 0x57, 0x89, 0x47, 0x85, 0x10, 0x7c, 0x09, 0x23, 0x9b,
+  0x83, 0xe7, 0xf4, 0xd5, 0xf2, 0x79, 0xad, 0x9a, 0x8a, 0xeb, 0x62, 0xf4,
+  0xe9, 0xca, 0xaa, 0x24, 0x04, 0x67, 0x14, 0x18, 0x82, 0xf9, 0xb5, 0x71,
+  0xa7, 0xc0, 0x90, 0x0a, 0xbb, 0x47, 0xae, 0xf9, 0xea, 0xa8, 0xb7, 0x3d,
+  0x1f, 0xdd, 0xb4, 0xc6, 0x4f, 0x59, 0x95, 0xed, 0x86, 0xab, 0xf6, 0x46,
+  0x57, 0x36, 0x45, 0xb5, 0xb8, 0xbe, 0xaf, 0x06, 0xa6, 0x0b, 0xc3, 0x19,
+  0xb7, 0x7b, 0x53, 0x84, 0x81, 0xce, 0xe9, 0xa6, 0x4b, 0x36, 0x18, 0xba,
+  0x5a, 0xaf, 0x30, 0x6c, 0xb0, 0x7e, 0x41, 0x38, 0x1f, 0xe8, 0xd0, 0x71,
+  0x1e, 0x26, 0xdc, 0xc2, 0xb4, 0x3a, 0x58, 0x61, 0xb4, 0x05, 0x7f, 0x93,
+  0x9f, 0x8a, 0xe8, 0x46, 0x84, 0xff, 0x9d, 0x8c, 0x6e, 0xcb, 0x0c, 0xba,
+  0x00, 0x24, 0xd2, 0x9f, 0x4b, 0x25, 0x2b, 0xd4, 0xb8, 0xf4, 0xeb, 0xe9,
+  0x05, 0xaf, 0x31, 0xbd, 0xec, 0x8c, 0x5c, 0xa1, 0xad, 0x47, 0x72, 0x7c,
+  0xcb, 0xc0, 0x9a, 0x8b, 0x13, 0xa3, 0x17, 0x83, 0x07, 0x2f, 0xf0, 0x00,
+  0xb9, 0xeb, 0xbf, 0x4b, 0xae, 0x14, 0x97, 0x1e, 0x15, 0x97, 0xd4, 0x14,
+  0x97, 0x94, 0x8a, 0xdb, 0xed, 0x2f, 0x2b, 0x43, 0x47, 0xcd, 0xd3, 0x5b,
+  0xe6, 0x2d, 0x63, 0x61, 0x08, 0x58, 0x79, 0xc9, 0x21, 0x33, 0x6e, 0xf8,
+  0xe2, 0x76, 0xca, 0x46, 0x30, 0xda, 0x07, 0x4f, 0xb8, 0x52, 0xfd, 0x1f,
+  0xe5, 0x98, 0x49, 0x73, 0xda, 0x4c, 0x10, 0x86, 0xef, 0xdf, 0xaf, 0x98,
+  0xbb, 0xe5, 0xd4, 0xac, 0x2c, 0xba, 0x11, 0x6f, 0x71, 0x2a, 0x24, 0x54,
+  0x49, 0xe5, 0xf8, 0x3a, 0x5a, 0x00, 0x55, 0x84, 0x44, 0x49, 0x43, 0x0c,
+  0xf9, 0xf5, 0xdf, 0x2c, 0x92, 0x90, 0x64, 0x8c, 0xc0, 0xc1, 0xa9, 0x10,
+  0xfb, 0x60, 0xf7, 0xc8, 0x85, 0xe8, 0x7e, 0xe6, 0xed, 0x9e, 0x9e, 0x86,
+  0x04, 0xea, 0x1f, 0x4e, 0xa0, 0xaf, 0xfe, 0xe2, 0x81, 0x59, 0x23, 0x04,
+  0x91, 0xfa, 0x6b, 0x8d, 0x72, 0x91, 0xa5, 0xe0, 0x2a, 0x12, 0x1b, 0x30,
+  0x8e, 0x92, 0xc8, 0xe2, 0xb6, 0x87, 0x2d, 0xcf, 0xf6, 0x90, 0xe5, 0x71,
+  0xff, 0x87, 0xed, 0x0d, 0xac, 0x38, 0x9c, 0x8a, 0xb5, 0xcd, 0xa1, 0x36,
+  0x36, 0x36, 0x47, 0x56, 0x16, 0xcd, 0xe6, 0x22, 0x9f, 0xa7, 0xab, 0x38,
+  0x08, 0x33, 0xdb, 0xa3, 0xe6, 0x81, 0x90, 0xbf, 0x67, 0x6a, 0xcd, 0xac,
+  0x5c, 0xf0, 0x4c, 0xd8, 0xde, 0xd0, 0x5a, 0xdb, 0x1e, 0xb1, 0x36, 0xb6,
+  0x07, 0xad, 0x65, 0xcc, 0xc5, 0x34, 0xcd, 0x16, 0xf6, 0x97, 0x28, 0x59,
+  0xad, 0xad, 0xff, 0x60, 0xe9, 0x98, 0x0f, 0x99, 0x76, 0x88, 0xc3, 0x5e,
+  0xc3, 0xb1, 0x3b, 0xbe, 0x08, 0x9d, 0x28, 0xbb, 0x74, 0x09, 0xc0, 0x1f,
+  0x20, 0x56, 0x8e, 0xc1, 0xba, 0x63, 0x08, 0x5a, 0xc1, 0x32, 0x48, 0x9f,
+  0x12, 0x7b, 0x0e, 0x3f, 0x50, 0x69, 0x2b, 0xf7, 0x94, 0x3d, 0x90, 0xb6,
+  0x76, 0x48, 0x2d, 0xb0, 0x5c, 0xac, 0x96, 0xca, 0x42, 0xd6, 0x6c, 0x15,
+  0x05, 0xa1, 0xfc, 0x20, 0xd3, 0x91, 0x6c, 0xfd, 0xef, 0x99, 0xb5, 0x88,
+  0xf4, 0x6b, 0x89, 0x5e, 0x95, 0xc1, 0x70, 0xd6, 0x1d, 0x7f, 0xbf, 0x78,
+  0x50, 0xbc, 0xa0, 0x85, 0x83, 0x17, 0x6b, 0xf9, 0x0a, 0x6c, 0x2c, 0xf9,
+  0x0e, 0x52, 0x22, 0x42, 0xa8, 0x62, 0x44, 0x3b, 0x19, 0x31, 0xaf, 0x60,
+  0x05, 0x9b, 0x8c, 0xc0, 0x1d, 0x79, 0xda, 0xb1, 0x71, 0xaf, 0xc4, 0x83,
+  0x5b, 0x78, 0x68, 0x03, 0x0f, 0x6c, 0xe0, 0x29, 0xd8, 0xed, 0xc5, 0xc3,
+  0x9a, 0x78, 0x50, 0x4b, 0x2d, 0xfd, 0x7d, 0x78, 0x8e, 0x51, 0x50, 0x9f,
+  0x17, 0x74, 0x50, 0x9b, 0x0e, 0x3b, 0xa1, 0x78, 0xf0, 0x11, 0xe2, 0x39,
+  0x24, 0x79, 0x5a, 0xe2, 0xe9, 0xb5, 0xe8, 0x0c, 0x7f, 0x5f, 0x3c, 0x01,
+  0xf2, 0x4c, 0xca, 0x4f, 0x35, 0x1e, 0x42, 0x0c, 0x26, 0xeb, 0x53, 0x9a,
+  0x45, 0x60, 0xc2, 0x03, 0x70, 0xf3, 0x08, 0xdc, 0x55, 0xe6, 0xa5, 0xe0,
+  0x79, 0x92, 0xf5, 0x5e, 0x89, 0x69, 0xb0, 0x4f, 0x43, 0xc3, 0x66, 0x86,
+  0xe1, 0xa3, 0x25, 0x04, 0x5b, 0x19, 0xc6, 0x2a, 0x48, 0xa4, 0x82, 0x44,
+  0x4b, 0x48, 0x7d, 0xc5, 0x08, 0x2b, 0x46, 0xa4, 0x9b, 0x11, 0xd9, 0xc5,
+  0xe8, 0xb6, 0xfa, 0x6e, 0xf0, 0xf0, 0x68, 0x5d, 0x18, 0x6f, 0x75, 0xdc,
+  0x17, 0xc6, 0x61, 0x0d, 0xe7, 0xb2, 0x7a, 0x3e, 0x30, 0xf6, 0xc6, 0x10,
+  0x69, 0x23, 0x1d, 0x54, 0x52, 0x82, 0x3b, 0x21, 0xd5, 0x52, 0x6b, 0x37,
+  0x85, 0x5a, 0xe6, 0xd4, 0xb3, 0xe4, 0xd0, 0x10, 0xe9, 0x74, 0x08, 0x8b,
+  0x33, 0x40, 0x87, 0x38, 0xb9, 0x9e, 0x80, 0x47, 0x2f, 0x5d, 0x03, 0xd2,
+  0x83, 0xe0, 0x21, 0xcc, 0xf2, 0x55, 0x6e, 0x22, 0x8e, 0x92, 0xd9, 0x1b,
+  0xeb, 0xa1, 0x26, 0x81, 0xfd, 0xa1, 0x72, 0xf6, 0x9a, 0xdd, 0x44, 0xbd,
+  0xa9, 0x5e, 0xcb, 0x78, 0xa9, 0x0e, 0x75, 0x2c, 0xc5, 0x7e, 0xc5, 0xc5,
+  0xaf, 0x6d, 0xbc, 0x57, 0x69, 0x22, 0x8f, 0xbf, 0x38, 0x0e, 0xb3, 0xf7,
+  0x2e, 0x7d, 0x1c, 0xbe, 0x04, 0x4b, 0x8b, 0x61, 0x29, 0x57, 0xce, 0xed,
+  0xda, 0x3d, 0x6f, 0x45, 0x90, 0x41, 0x2b, 0x48, 0x47, 0x64, 0x61, 0x28,
+  0x4c, 0x88, 0x61, 0x06, 0xee, 0x1f, 0xea, 0xc9, 0xee, 0xde, 0xfc, 0xb9,
+  0x68, 0x0f, 0xd5, 0xc1, 0xe9, 0x36, 0xde, 0xa3, 0x86, 0x01, 0xe4, 0xa6,
+  0x10, 0x54, 0x05, 0xc1, 0x09, 0x67, 0x1c, 0x38, 0x5c, 0xac, 0xb2, 0xa4,
+  0x16, 0x7f, 0x11, 0xf7, 0x05, 0x47, 0x65, 0xd8, 0x97, 0x1c, 0x56, 0x51,
+  0x5f, 0x68, 0x5b, 0x06, 0x7d, 0x29, 0xff, 0xbf, 0xeb, 0x80, 0x6c, 0x1f,
+  0xf7, 0x2f, 0x57, 0x35, 0x5c, 0x06, 0x31, 0x38, 0xe0, 0x70, 0x2b, 0x83,
+  0x40, 0x08, 0xd3, 0xc6, 0xd9, 0x7f, 0x1b, 0x6f, 0x82, 0x68, 0x16, 0x81,
+  0x07, 0x2e, 0xbf, 0x04, 0x9c, 0xa2, 0x7b, 0xdc, 0x77, 0xec, 0xe3, 0xee,
+  0x9e, 0x71, 0x11, 0xe5, 0x3e, 0xd2, 0xdd, 0xa1, 0x4c, 0xa5, 0x20, 0x0e,
+  0x91, 0x8a, 0xd4, 0x98, 0x58, 0x41, 0x30, 0x26, 0xd1, 0x2d, 0x80, 0xb1,
+  0xa9, 0xb4, 0xfb, 0x1d, 0xed, 0x02, 0x39, 0x79, 0xaf, 0x59, 0x11, 0xc5,
+  0x67, 0x42, 0x14, 0x6f, 0x81, 0x56, 0xe8, 0xb0, 0x46, 0xb7, 0x45, 0x4a,
+  0x6b, 0x48, 0xd9, 0x9f, 0x47, 0xca, 0x60, 0xdf, 0x74, 0x17, 0xc3, 0xe6,
+  0xd1, 0xeb, 0xce, 0xb3, 0x55, 0x2e, 0x16, 0x3c, 0x57, 0xb5, 0xe7, 0x36,
+  0xca, 0xc2, 0x5c, 0xc8, 0x8f, 0x83, 0x6b, 0x89, 0x59, 0xf0, 0xd8, 0x30,
+  0xd6, 0x3d, 0x3d, 0x2d, 0x19, 0xef, 0x87, 0x06, 0xdb, 0xa9, 0xd6, 0x59,
+  0x55, 0x06, 0x8d, 0xd8, 0xe1, 0xb3, 0xe6, 0xb3, 0x0c, 0xb3, 0x8a, 0x92,
+  0x75, 0x46, 0x89, 0xb0, 0x79, 0x52, 0x5d, 0x52, 0xc6, 0xaa, 0x9e, 0x7c,
+  0x4f, 0xb3, 0x38, 0x00, 0x5f, 0xd2, 0x59, 0xe4, 0x03, 0xd2, 0x3a, 0x76,
+  0x75, 0x88, 0xe4, 0xb5, 0xd7, 0x96, 0x23, 0x2e, 0x2b, 0x07, 0xdc, 0xe5,
+  0x7a, 0x87, 0x5e, 0x56, 0xb6, 0x55, 0x17, 0x37, 0xda, 0x30, 0xa8, 0x28,
+  0xa1, 0x6e, 0x4a, 0xac, 0x45, 0xe9, 0x7e, 0xb1, 0xe4, 0xbe, 0x78, 0xaf,
+  0x38, 0xe8, 0x14, 0xc2, 0x46, 0x6a, 0xfc, 0x9b, 0xa2, 0x79, 0xe9, 0x86,
+  0xdb, 0x45, 0x89, 0x63, 0xac, 0x8d, 0x7e, 0x71, 0x54, 0x97, 0x35, 0xd9,
+  0x0d, 0xfd, 0x79, 0x92, 0xc6, 0xe9, 0x6c, 0x03, 0xee, 0x93, 0x24, 0xfd,
+  0xc9, 0x45, 0x94, 0x26, 0x60, 0xe2, 0x60, 0x30, 0x0a, 0xf8, 0x52, 0xec,
+  0xe8, 0x6a, 0xdf, 0x92, 0xd4, 0x29, 0x67, 0x01, 0xec, 0x05, 0x3d, 0xe9,
+  0x22, 0x84, 0x3b, 0x49, 0xe1, 0xb2, 0xa7, 0x29, 0x49, 0x7d, 0x0e, 0xf3,
+  0x1c, 0xd4, 0x70, 0xed, 0x10, 0xd3, 0x49, 0x11, 0xbd, 0x02, 0xca, 0x11,
+  0x59, 0xd5, 0x31, 0x11, 0xf1, 0x7c, 0x5c, 0x24, 0x13, 0x6b, 0xce, 0x8b,
+  0x9c, 0x39, 0x4f, 0x9e, 0xb8, 0x52, 0x08, 0x01, 0x93, 0x2b, 0xf0, 0xc6,
+  0x67, 0xf8, 0x5f, 0x38, 0x49, 0x7b, 0x46, 0x06, 0xed, 0x9e, 0xa4, 0xbd,
+  0x4f, 0x2a, 0x34, 0x60, 0xcd, 0xe1, 0xf0, 0xc7, 0x9b, 0x7b, 0xf7, 0xdb,
+  0xd7, 0x3b, 0x30, 0x42, 0x2e, 0x06, 0x1f, 0x6f, 0xc7, 0xe7, 0x33, 0x47,
+  0xa3, 0x27, 0x9f, 0xa3, 0x95, 0x90, 0x58, 0x8f, 0xed, 0x1c, 0x54, 0x03,
+  0x97, 0x6a, 0xe9, 0x20, 0xc5, 0x07, 0xff, 0x73, 0x43, 0x58, 0xd8, 0x71,
+  0x9b, 0x2c, 0xe8, 0xf4, 0x28, 0xc2, 0x4d, 0x09, 0x85, 0x22, 0x5d, 0x9e,
+  0xb4, 0xdc, 0x16, 0x88, 0x08, 0x3c, 0xb3, 0x39, 0xb5, 0x17, 0x18, 0x34,
+  0x90, 0xf8, 0xb0, 0x51, 0x95, 0x3f, 0xa7, 0x1b, 0x35, 0x5e, 0x19, 0xc5,
+  0xcb, 0xb9, 0xbc, 0x78, 0xcf, 0x53, 0xff, 0xc7, 0xef, 0xeb, 0xe8, 0xcc,
+  0xd4, 0x53, 0xa0, 0x41, 0x2c, 0x68, 0xa2, 0x71, 0xd3, 0x45, 0x18, 0x02,
+  0xe7, 0xeb, 0x8d, 0x73, 0x90, 0x84, 0x8e, 0x9f, 0x4e, 0xd0, 0xe7, 0xa1,
+  0x1e, 0xb1, 0xa5, 0xbe, 0xd2, 0xb9, 0x76, 0x98, 0x36, 0x0b, 0xe7, 0xc4,
+  0xa1, 0x2d, 0x87, 0xcf, 0x7c, 0x3b, 0xd9, 0x31, 0xdb, 0x59, 0x61, 0x21,
+  0xad, 0x53, 0x76, 0xe4, 0x67, 0xab, 0x35, 0x50, 0x05, 0x53, 0x0a, 0xfe,
+  0xfd, 0x16, 0xcb, 0x8a, 0x0f, 0x1b, 0xa2, 0x06, 0x1f, 0x37, 0xcd, 0xa2,
+  0xe0, 0x6d, 0x1a, 0xd2, 0xbf, 0xb7, 0x2e, 0x4a, 0x1a, 0xfa, 0x40, 0x0d,
+  0x7c, 0xdc, 0x6f, 0xf4, 0xec, 0xdf, 0x92, 0xcd, 0xda, 0x49, 0xa7, 0x02,
+  0x5c, 0xaf, 0x78, 0x0c, 0x64, 0x95, 0xbc, 0x8e, 0x7e, 0x46, 0xb9, 0xbc,
+  0xe1, 0x9c, 0x62, 0x2c, 0xf9, 0x72, 0xe2, 0xf7, 0x0e, 0x18, 0x9e, 0x96,
+  0x3e, 0x87, 0x08, 0xb2, 0x86, 0xcf, 0x8f, 0x51, 0x32, 0x4e, 0x8d, 0xc3,
+  0xa3, 0xcc, 0xe7, 0x41, 0xa8, 0x7c, 0xa5, 0xf5, 0xbb, 0x6a, 0x35, 0x42,
+  0x56, 0xba, 0x2d, 0x7c, 0x56, 0x0d, 0x4f, 0xe9, 0xb3, 0xea, 0x5d, 0xb4,
+  0xcf, 0x0a, 0x75, 0xa1, 0xf0, 0x61, 0xcb, 0xf9, 0x83, 0xe6, 0xc5, 0xf5,
+  0x59, 0x30, 0xea, 0xd8, 0x02, 0x54, 0xd6, 0xb1, 0x96, 0x20, 0x6f, 0x78,
+  0xbe, 0x71, 0xc6, 0x8f, 0xef, 0x45, 0x92, 0xff, 0x03,
+  0xed, 0x99, 0x4f, 0x73, 0xa2, 0x30, 0x18, 0xc6, 0xef, 0xfb, 0x29, 0xf8,
+  0x00, 0xd9, 0x4e, 0xfe, 0x22, 0x72, 0xb3, 0xb6, 0xeb, 0x65, 0x6b, 0x1d,
+  0xdd, 0x83, 0xd7, 0x44, 0x50, 0x99, 0x5a, 0x71, 0x30, 0x6e, 0x75, 0x3f,
+  0xfd, 0x06, 0x88, 0x28, 0x34, 0x4a, 0x41, 0xa7, 0xbb, 0x1d, 0xc1, 0x03,
+  0x49, 0x34, 0x19, 0xf2, 0xcb, 0xf3, 0x3e, 0x6f, 0x82, 0x90, 0xc0, 0xe4,
+  0x9a, 0x60, 0x84, 0x92, 0x42, 0xab, 0x9d, 0xdc, 0x55, 0x2d, 0xb9, 0x83,
+  0x7b, 0x1f, 0x59, 0xbd, 0xae, 0xaa, 0x59, 0xdd, 0x70, 0x29, 0xa3, 0x70,
+  0xb1, 0xf0, 0x23, 0x0b, 0xdd, 0x41, 0x02, 0xb8, 0x2b, 0x30, 0x10, 0xae,
+  0x40, 0x40, 0xf0, 0xc9, 0x8b, 0x2b, 0x1c, 0xe0, 0xad, 0xbc, 0xf0, 0x6d,
+  0xe9, 0xce, 0xe1, 0x1d, 0x55, 0xe5, 0x85, 0x3f, 0x95, 0x71, 0x39, 0x6e,
+  0x8f, 0x82, 0xd9, 0x3c, 0xa9, 0x60, 0x55, 0xd9, 0xac, 0xe2, 0x12, 0x02,
+  0xf1, 0x0f, 0xd6, 0xf3, 0x70, 0xb3, 0xf0, 0xfc, 0xc8, 0x15, 0x34, 0xad,
+  0xcb, 0x20, 0x1e, 0x0b, 0xc1, 0xa4, 0x26, 0x55, 0xbf, 0x59, 0xfc, 0xa5,
+  0x9d, 0x54, 0xb7, 0x2e, 0x4f, 0xdb, 0x77, 0x2e, 0x47, 0x20, 0x19, 0xf3,
+  0xd0, 0x9f, 0xe9, 0x06, 0x3d, 0x80, 0xfe, 0x3e, 0x1b, 0xa1, 0x95, 0xd6,
+  0xd5, 0x10, 0x38, 0x2d, 0xa9, 0x31, 0x08, 0x58, 0x4b, 0x1e, 0x49, 0x57,
+  0xb4, 0xc1, 0xd6, 0x15, 0x04, 0xec, 0x5c, 0x01, 0xc1, 0x6a, 0xc1, 0xe5,
+  0x34, 0x8c, 0x5e, 0xdd, 0x9f, 0xc1, 0x72, 0xb3, 0x05, 0xdf, 0xe0, 0x9e,
+  0x10, 0xa9, 0x43, 0x08, 0x1e, 0x13, 0x52, 0xb3, 0xaa, 0x88, 0x68, 0xb6,
+  0x09, 0x3c, 0x5f, 0x75, 0xc4, 0x05, 0x58, 0x76, 0x0e, 0x16, 0xc9, 0xc1,
+  0xe2, 0xac, 0x1c, 0x56, 0x2b, 0x0f, 0x8b, 0xe6, 0x61, 0x71, 0x7a, 0x0e,
+  0x96, 0x42, 0xbb, 0xa7, 0x45, 0x4f, 0xd3, 0xb2, 0x31, 0x4d, 0x4b, 0x4c,
+  0xb7, 0x68, 0x5a, 0x83, 0xf0, 0xcd, 0x8f, 0x3a, 0xef, 0xd0, 0xd8, 0x35,
+  0xc9, 0x38, 0xe7, 0x54, 0xd4, 0xce, 0x73, 0xc1, 0x95, 0x45, 0x04, 0x0b,
+  0x5c, 0x58, 0xc6, 0x85, 0x64, 0x5c, 0xe8, 0x9e, 0x4b, 0x2b, 0xc6, 0x82,
+  0x63, 0x2c, 0xa4, 0x1c, 0x0b, 0x66, 0x22, 0xbd, 0xab, 0x4f, 0x8c, 0xe5,
+  0xd7, 0x3c, 0xda, 0xac, 0xe5, 0x2b, 0x5f, 0x4b, 0x25, 0x9e, 0xde, 0x60,
+  0x7c, 0xf3, 0x80, 0x28, 0xf3, 0x12, 0x3e, 0x54, 0xeb, 0x66, 0xc8, 0xff,
+  0x28, 0x32, 0x23, 0x2e, 0xfc, 0x48, 0x86, 0xa1, 0x9c, 0x37, 0x80, 0x34,
+  0x20, 0xd6, 0x00, 0x32, 0x02, 0x42, 0xdc, 0xe8, 0x3c, 0xd6, 0x53, 0xb0,
+  0x0c, 0xac, 0x41, 0x14, 0x5a, 0x8f, 0xdb, 0x06, 0x11, 0xa3, 0x1a, 0x50,
+  0x0e, 0xd1, 0x58, 0x84, 0x5b, 0xeb, 0x79, 0xe9, 0xa7, 0xac, 0x0e, 0x59,
+  0xad, 0xe1, 0xc5, 0x9c, 0x73, 0xbc, 0x6e, 0x9e, 0x8f, 0x70, 0xda, 0xf9,
+  0xad, 0xd1, 0x83, 0x8a, 0xb7, 0xe7, 0x9e, 0x22, 0x34, 0x60, 0x63, 0x6b,
+  0xb0, 0xd8, 0xac, 0x9b, 0x3d, 0x91, 0xb2, 0xec, 0x22, 0xa6, 0x3d, 0xa2,
+  0x4e, 0x83, 0x48, 0x23, 0x22, 0x27, 0x9c, 0x09, 0x51, 0xec, 0x20, 0x4c,
+  0xbf, 0x43, 0x74, 0xeb, 0xb1, 0x36, 0xf5, 0xa7, 0x3c, 0x97, 0xde, 0x86,
+  0xe1, 0xe4, 0xc5, 0xea, 0xf2, 0xa5, 0xb7, 0x4b, 0xfd, 0x88, 0xd8, 0xb0,
+  0xb1, 0x6e, 0x38, 0x71, 0xb0, 0x07, 0xf5, 0x4e, 0xfb, 0xf8, 0x02, 0xce,
+  0x7d, 0x20, 0x1f, 0xc2, 0x64, 0x23, 0x80, 0x2d, 0xd5, 0x33, 0x81, 0xd6,
+  0x50, 0x22, 0xf9, 0xb3, 0xad, 0xa6, 0xd4, 0xf1, 0xf8, 0x4a, 0x1a, 0x44,
+  0x54, 0xdb, 0x99, 0xaa, 0x18, 0x93, 0x86, 0x79, 0x81, 0x31, 0x29, 0xe2,
+  0x17, 0x1b, 0x53, 0x46, 0xa8, 0x0d, 0x4d, 0x84, 0x7e, 0x74, 0x09, 0x8c,
+  0xc5, 0x14, 0x23, 0x42, 0x31, 0x22, 0x58, 0x1b, 0x51, 0x05, 0xcb, 0xa6,
+  0x17, 0x5b, 0x36, 0x2b, 0x27, 0x43, 0x3f, 0xa8, 0x1d, 0x84, 0x8d, 0xda,
+  0xc9, 0x36, 0x93, 0xa3, 0xfe, 0x01, 0xd1, 0xcd, 0xe6, 0xb7, 0x0c, 0x96,
+  0x39, 0xd0, 0x86, 0xfe, 0xc4, 0x0f, 0x7e, 0xa7, 0x91, 0x76, 0xa1, 0x8c,
+  0xfe, 0xdb, 0x48, 0xfb, 0xb0, 0x9e, 0x18, 0xca, 0x25, 0x38, 0x8d, 0xe8,
+  0x89, 0xc0, 0x2b, 0x28, 0xa8, 0x74, 0x9e, 0x76, 0x95, 0xf7, 0x87, 0x15,
+  0xd7, 0xde, 0x36, 0xa6, 0xa2, 0xe3, 0xf8, 0xf8, 0x34, 0x0b, 0xb9, 0xea,
+  0x92, 0x1b, 0xb2, 0x4f, 0xc5, 0x25, 0xb7, 0x8d, 0xe6, 0xfa, 0xf5, 0xc9,
+  0x5c, 0x1e, 0x0c, 0x36, 0x6a, 0x34, 0x63, 0x26, 0x63, 0x4e, 0xc8, 0xfd,
+  0xc7, 0xd1, 0xcd, 0x67, 0x64, 0xdc, 0x24, 0x99, 0x52, 0x44, 0xe7, 0x1d,
+  0x27, 0x3b, 0x90, 0x5f, 0x87, 0x13, 0xfa, 0xba, 0xa0, 0x52, 0x29, 0x99,
+  0xc3, 0xec, 0x4a, 0xf9, 0xf8, 0x78, 0x5a, 0x85, 0x7f, 0xff, 0x0a, 0xd3,
+  0x6e, 0x17, 0xe6, 0xe9, 0xd4, 0x4b, 0xc4, 0xa4, 0x89, 0x8f, 0x32, 0x44,
+  0xb4, 0x41, 0x54, 0x8a, 0xc8, 0xbc, 0x4f, 0xed, 0xa7, 0x71, 0x71, 0x85,
+  0xd4, 0x63, 0x98, 0xe7, 0xc9, 0xe7, 0x2e, 0x7d, 0x5a, 0x5b, 0x2f, 0x28,
+  0xcd, 0x3f, 0x6d, 0xf2, 0x1e, 0xe4, 0xe6, 0x5f, 0x7f, 0xd8, 0xcc, 0x68,
+  0x72, 0xd7, 0x39, 0x72, 0x9c, 0x15, 0x7a, 0x0d, 0x69, 0x1f, 0x69, 0xb9,
+  0x96, 0xfb, 0xd9, 0xe6, 0xd4, 0x97, 0x29, 0xe1, 0x1f, 0xa4, 0xbc, 0xcf,
+  0x39, 0xa3, 0x9f, 0x08, 0xec, 0xbf,
+  0xed, 0x98, 0x5d, 0x6f, 0x9b, 0x30, 0x14, 0x86, 0xef, 0xf7, 0x2b, 0x7c,
+  0x3f, 0x3a, 0xf9, 0x83, 0x0f, 0xc3, 0x5d, 0x9b, 0xb6, 0x5b, 0xa7, 0xb6,
+  0x8b, 0x84, 0xaa, 0x4d, 0xbb, 0x33, 0xe0, 0x24, 0xd6, 0x08, 0x44, 0xe0,
+  0xa8, 0xc9, 0xbf, 0x9f, 0xf9, 0x48, 0x2a, 0x12, 0x06, 0x24, 0x61, 0x4d,
+  0xb2, 0x25, 0x37, 0x1c, 0x23, 0x4c, 0xec, 0x87, 0xf7, 0x3d, 0x3e, 0x36,
+  0x24, 0x30, 0xff, 0xf9, 0x14, 0x07, 0x79, 0x60, 0x19, 0xa8, 0xb8, 0x03,
+  0xf3, 0xab, 0x46, 0x6f, 0x84, 0xbc, 0x8d, 0xc1, 0x90, 0x40, 0x8d, 0x39,
+  0x1e, 0xd4, 0x3c, 0xc7, 0x43, 0x9a, 0xc7, 0xfc, 0x5f, 0xea, 0x0a, 0xb5,
+  0x60, 0x16, 0xc4, 0xaf, 0x91, 0x33, 0x81, 0x9f, 0x74, 0x15, 0x87, 0x7c,
+  0x24, 0xb3, 0x98, 0xaa, 0x38, 0x11, 0xe3, 0x49, 0xde, 0xc0, 0xaa, 0x31,
+  0x9f, 0x65, 0x11, 0xd2, 0xb2, 0x07, 0xd2, 0x49, 0x3c, 0x0f, 0x03, 0x9e,
+  0x38, 0x9e, 0x99, 0xb7, 0xa5, 0x7a, 0x72, 0xac, 0x9a, 0x8c, 0xe6, 0xcd,
+  0x85, 0xc3, 0x60, 0x1e, 0x2c, 0x1d, 0x86, 0xb4, 0xfc, 0x2d, 0x6f, 0x3d,
+  0xac, 0xe2, 0xc6, 0xaa, 0x8b, 0x67, 0x17, 0x6d, 0xd5, 0x07, 0x17, 0x91,
+  0xea, 0x44, 0xb4, 0x54, 0xb2, 0x44, 0xaa, 0xe1, 0x21, 0x6d, 0xe1, 0x78,
+  0x44, 0x5b, 0x3a, 0x9e, 0xae, 0xcd, 0x42, 0x26, 0x47, 0x71, 0x32, 0x75,
+  0x1e, 0x45, 0x34, 0x5f, 0x68, 0x1f, 0xe0, 0xd6, 0xbc, 0xcd, 0x62, 0xd2,
+  0xa8, 0x3a, 0xef, 0x97, 0x50, 0x8a, 0x29, 0x93, 0x1c, 0x7c, 0x17, 0x09,
+  0x0f, 0x79, 0x9a, 0x66, 0x14, 0x50, 0x46, 0x01, 0xf6, 0x4a, 0x21, 0x95,
+  0x22, 0x7f, 0x19, 0xa9, 0x32, 0x31, 0x3a, 0x33, 0x59, 0xbd, 0x40, 0xaf,
+  0x22, 0x62, 0x7a, 0x3b, 0x22, 0x3d, 0x43, 0x44, 0xda, 0x11, 0xd9, 0xf5,
+  0xd2, 0xb8, 0x8d, 0xc7, 0x5e, 0x1c, 0xf1, 0x9e, 0xc0, 0xd4, 0xcc, 0xf5,
+  0x8f, 0x63, 0x6f, 0x1b, 0x31, 0x2a, 0x6f, 0x6c, 0x7e, 0xd4, 0x61, 0x12,
+  0x03, 0xdc, 0xc3, 0x78, 0xc7, 0x73, 0x11, 0x70, 0xd5, 0x11, 0x9f, 0xeb,
+  0x27, 0x45, 0x88, 0xb4, 0xab, 0x3e, 0xe8, 0xc1, 0xf8, 0xbd, 0x91, 0x9a,
+  0x8a, 0xd4, 0x47, 0x8e, 0x87, 0x4d, 0x6d, 0xc6, 0x82, 0x20, 0xe4, 0x59,
+  0xac, 0x97, 0x31, 0x56, 0xb1, 0xd1, 0x3f, 0xcb, 0x8e, 0x19, 0x04, 0xa1,
+  0xc2, 0x1e, 0x9b, 0x2c, 0x1f, 0x85, 0xe2, 0xe8, 0xde, 0x1d, 0x49, 0x6e,
+  0x1e, 0x3d, 0x54, 0x6e, 0x5d, 0x92, 0x6c, 0x57, 0xb9, 0x61, 0xd2, 0x3d,
+  0xc9, 0x9e, 0x8a, 0xe2, 0x8e, 0xa6, 0x27, 0xdc, 0xa0, 0xa7, 0x33, 0xce,
+  0x5e, 0x46, 0x8f, 0x72, 0xb2, 0x6b, 0xe5, 0xe4, 0x3e, 0x13, 0x98, 0xe5,
+  0xf8, 0x77, 0x5d, 0xaa, 0x7b, 0x35, 0x1a, 0x59, 0x93, 0xd1, 0xf7, 0x23,
+  0x43, 0xce, 0xd0, 0x68, 0x75, 0xa9, 0x9d, 0xbc, 0xa5, 0x76, 0x64, 0x1f,
+  0xcf, 0x8a, 0x46, 0x0b, 0xce, 0xc1, 0x25, 0x61, 0x65, 0x94, 0xea, 0xed,
+  0x58, 0xba, 0xb1, 0x97, 0x9c, 0x75, 0xae, 0x0b, 0x9f, 0x79, 0x11, 0x50,
+  0x07, 0x01, 0x59, 0x17, 0x4a, 0x1d, 0x28, 0xd1, 0x7a, 0x9b, 0xfd, 0xe4,
+  0x2d, 0x1e, 0xfb, 0xa8, 0x06, 0x5d, 0x02, 0xba, 0x62, 0x70, 0xcd, 0xe7,
+  0x63, 0x1e, 0x2b, 0x3c, 0x57, 0x6c, 0xdb, 0x5f, 0x5b, 0x93, 0xdc, 0x47,
+  0xfd, 0x18, 0x31, 0xaf, 0xdc, 0x35, 0x56, 0xd7, 0xe9, 0xfb, 0x41, 0x71,
+  0xaa, 0x70, 0x72, 0x03, 0xa6, 0xa6, 0x55, 0xb7, 0xd3, 0x75, 0x2b, 0x87,
+  0x20, 0x07, 0xa5, 0x2e, 0x5a, 0x4d, 0x56, 0x76, 0xbb, 0xc0, 0xcc, 0x8d,
+  0xec, 0x64, 0x35, 0x2a, 0x0a, 0x76, 0x51, 0x94, 0x8d, 0xf2, 0xe9, 0x8d,
+  0xa0, 0x61, 0x54, 0x14, 0xf5, 0xe5, 0xeb, 0x00, 0x7c, 0x66, 0x53, 0xae,
+  0xd6, 0xde, 0x2d, 0xc7, 0xd1, 0xc3, 0xe6, 0xad, 0x57, 0x6c, 0x06, 0xab,
+  0x14, 0xcc, 0x76, 0x0a, 0x46, 0xd5, 0x66, 0x68, 0x17, 0x28, 0x76, 0xc6,
+  0x04, 0x37, 0x4b, 0x20, 0x40, 0x88, 0x16, 0x91, 0xad, 0x57, 0x98, 0xb8,
+  0x92, 0x05, 0x82, 0x81, 0x41, 0x1c, 0xc9, 0x24, 0x0e, 0x43, 0x9e, 0x6c,
+  0x91, 0x31, 0xf7, 0x4c, 0x45, 0xb4, 0x09, 0x91, 0xbd, 0x73, 0x22, 0xda,
+  0x20, 0x04, 0x77, 0x49, 0x44, 0x56, 0x17, 0x42, 0x26, 0x2e, 0xad, 0xa1,
+  0xaf, 0x2c, 0x52, 0x10, 0x1a, 0xc6, 0xaf, 0x3c, 0xb9, 0x06, 0xf7, 0xf3,
+  0x54, 0xc4, 0x51, 0xb1, 0xe2, 0xf7, 0x8a, 0xab, 0x3b, 0x25, 0x7c, 0x30,
+  0x25, 0xa3, 0xa9, 0x14, 0xdf, 0x89, 0x12, 0xc6, 0xb5, 0x94, 0x7e, 0x78,
+  0xf1, 0x02, 0x7c, 0x8b, 0x78, 0x13, 0x21, 0xeb, 0x6c, 0x09, 0x99, 0xbb,
+  0x11, 0xa2, 0xfb, 0x12, 0x7a, 0x0f, 0xcb, 0x9d, 0x94, 0x98, 0xf4, 0x66,
+  0x31, 0xb9, 0x33, 0xee, 0xcb, 0x84, 0x81, 0x87, 0x68, 0x24, 0x22, 0x21,
+  0x97, 0xff, 0xab, 0xe9, 0x46, 0x0d, 0xa6, 0x73, 0x79, 0x22, 0x78, 0xfa,
+  0x37, 0x54, 0x65, 0x9d, 0x27, 0x2d, 0x04, 0x99, 0x55, 0x59, 0xea, 0x9e,
+  0xd8, 0x72, 0x14, 0xb2, 0x74, 0x02, 0x9e, 0xd8, 0x58, 0xf8, 0xe0, 0xd9,
+  0x5d, 0xd7, 0x68, 0xf8, 0x1f, 0x29, 0x02, 0x60, 0x47, 0x32, 0x68, 0x83,
+  0x4c, 0xa9, 0xa3, 0x41, 0x9c, 0x70, 0x30, 0x0c, 0xe7, 0x69, 0x5e, 0x25,
+  0xf9, 0x73, 0x6f, 0x33, 0x49, 0x55, 0x0a, 0x5a, 0xda, 0xd7, 0x16, 0xe5,
+  0xe4, 0x6b, 0xa7, 0x15, 0x36, 0x5c, 0x8f, 0xad, 0xac, 0x0c, 0x9e, 0x45,
+  0x24, 0x79, 0x14, 0xa8, 0x72, 0xfa, 0x55, 0x48, 0x7f, 0x02, 0xee, 0xb3,
+  0xff, 0x02, 0xc3, 0xa2, 0xd6, 0x3c, 0x4c, 0x66, 0xbd, 0x91, 0x2b, 0xcf,
+  0xa2, 0x10, 0x39, 0x9a, 0xf4, 0x48, 0x3d, 0xc3, 0x4d, 0x78, 0x35, 0xba,
+  0xbb, 0xd0, 0x53, 0xa5, 0x69, 0x3d, 0xbd, 0xd5, 0xfa, 0x78, 0xa1, 0xd8,
+  0x85, 0xa2, 0xb2, 0xb1, 0x5d, 0xa1, 0x78, 0x73, 0x7b, 0x0d, 0x86, 0xae,
+  0x5e, 0x38, 0x76, 0x76, 0x2c, 0xc3, 0x32, 0x72, 0x68, 0xaa, 0xab, 0xdd,
+  0x04, 0x19, 0xfb, 0x20, 0x32, 0x03, 0x9f, 0xd5, 0x09, 0x2d, 0xdb, 0xfd,
+  0xdc, 0x2d, 0x4e, 0x48, 0x4c, 0xef, 0x2d, 0x21, 0x0a, 0xf3, 0x52, 0x95,
+  0x96, 0x85, 0xd8, 0xea, 0xbe, 0xf6, 0xf0, 0xe4, 0x82, 0xe1, 0xe0, 0x65,
+  0xfb, 0xd8, 0x47, 0xdf, 0xe5, 0xd4, 0xa7, 0x1c, 0x89, 0xb1, 0x3e, 0xe4,
+  0xc0, 0x5b, 0x23, 0xf9, 0x0d,
+  0xed, 0x99, 0x5b, 0x73, 0xa3, 0x36, 0x14, 0xc7, 0xdf, 0xfb, 0x29, 0xf4,
+  0x5e, 0xda, 0x91, 0x04, 0x02, 0xcc, 0x9b, 0xd7, 0x9d, 0x24, 0xdb, 0xab,
+  0x67, 0x9d, 0xa6, 0x79, 0x15, 0x46, 0x8e, 0x99, 0xc5, 0xc8, 0x83, 0xe5,
+  0xc6, 0xfe, 0xf6, 0x95, 0x40, 0x80, 0x85, 0xb9, 0x18, 0xc7, 0xd3, 0xd9,
+  0x9d, 0x24, 0x2f, 0x08, 0x3b, 0x66, 0x74, 0x7e, 0xe7, 0x7f, 0x6e, 0x02,
+  0xda, 0x30, 0xff, 0x8b, 0x7c, 0xe4, 0xe4, 0x0b, 0x6f, 0x19, 0xa9, 0x0b,
+  0x42, 0x10, 0xa9, 0xab, 0xf5, 0xc8, 0x79, 0x94, 0xb0, 0x1d, 0xc0, 0x10,
+  0xfa, 0x60, 0xb6, 0x8e, 0x37, 0x5b, 0x30, 0x9f, 0x81, 0xf9, 0xc2, 0xb6,
+  0x68, 0x10, 0x42, 0x2b, 0x0c, 0x42, 0x64, 0x85, 0x74, 0xf9, 0x35, 0x08,
+  0x7d, 0x2b, 0x61, 0x2b, 0xb1, 0x5b, 0xf3, 0x7d, 0x12, 0xb1, 0x2c, 0x08,
+  0x9d, 0xfc, 0x5e, 0x64, 0xf1, 0xcb, 0x8b, 0xba, 0x75, 0xf3, 0xdb, 0x43,
+  0x40, 0x61, 0xbe, 0x38, 0x06, 0x14, 0x59, 0xf2, 0xbb, 0xf5, 0xc9, 0x2f,
+  0x48, 0xf1, 0x41, 0xf5, 0x13, 0xcf, 0xda, 0x09, 0x9a, 0x89, 0x20, 0x9c,
+  0x58, 0x87, 0x20, 0xb4, 0xad, 0x63, 0x10, 0x62, 0x6b, 0x9b, 0x50, 0xb1,
+  0xe2, 0xd9, 0x26, 0xf8, 0x3d, 0x4e, 0xf7, 0x07, 0xeb, 0x07, 0xd8, 0xb4,
+  0xc0, 0x77, 0xb1, 0x61, 0xc1, 0x43, 0x2c, 0x3e, 0xf1, 0x83, 0xda, 0xb2,
+  0xda, 0xf9, 0x34, 0xa5, 0x09, 0x7f, 0x01, 0x7f, 0xf0, 0x88, 0x29, 0x0b,
+  0x90, 0xb2, 0x00, 0x57, 0x16, 0x44, 0xdb, 0x88, 0xbf, 0xa6, 0xc1, 0x8f,
+  0x72, 0x6f, 0xd1, 0x56, 0x6d, 0x33, 0xf8, 0x49, 0xee, 0x37, 0xda, 0xe6,
+  0xfb, 0x92, 0x1f, 0xab, 0xf5, 0x7e, 0x2b, 0x3f, 0x44, 0xd6, 0xcb, 0x3e,
+  0x8e, 0x98, 0xda, 0xda, 0x80, 0xd5, 0x97, 0xda, 0x88, 0xb0, 0x32, 0x12,
+  0x2a, 0x23, 0xed, 0x3e, 0x23, 0x73, 0xf7, 0x40, 0x56, 0xdc, 0x23, 0xa8,
+  0x8d, 0x5c, 0xd0, 0x7f, 0x63, 0x9e, 0x0d, 0xfa, 0xa4, 0x70, 0xc2, 0x4e,
+  0xc4, 0xea, 0x4b, 0x04, 0xcd, 0xbd, 0x7a, 0xc3, 0x1e, 0xc2, 0xfa, 0x03,
+  0xfd, 0x00, 0xd4, 0x30, 0xc6, 0x36, 0x1c, 0xe6, 0x28, 0x5b, 0x48, 0xb7,
+  0x2d, 0x13, 0x98, 0x3b, 0x0c, 0xb9, 0x70, 0x05, 0x2b, 0x73, 0xa4, 0x2d,
+  0xf3, 0x84, 0x1e, 0x17, 0x82, 0x8a, 0x98, 0xa7, 0x60, 0xc6, 0x53, 0x91,
+  0xf1, 0x24, 0x61, 0x19, 0x98, 0x46, 0x74, 0x2b, 0x58, 0x6e, 0x23, 0x36,
+  0x6d, 0xd4, 0x5e, 0x5b, 0xc3, 0x9f, 0x9d, 0xd2, 0x6d, 0x72, 0xed, 0x57,
+  0x7e, 0x93, 0x37, 0xb8, 0x70, 0x9c, 0x5c, 0xa1, 0x31, 0x48, 0x9c, 0x61,
+  0x24, 0x5e, 0x3f, 0x12, 0xed, 0x6f, 0xf9, 0x08, 0xbb, 0x58, 0xc9, 0x67,
+  0xe0, 0x73, 0x5d, 0xc3, 0x6e, 0x4c, 0x91, 0xd6, 0x33, 0xa1, 0x9e, 0xa1,
+  0xeb, 0x39, 0x7f, 0x65, 0xd9, 0x14, 0xdc, 0xed, 0x77, 0x0a, 0xd4, 0x9f,
+  0x71, 0x2a, 0x58, 0x1a, 0x71, 0xb0, 0x78, 0x8d, 0xc5, 0x72, 0x0d, 0xa6,
+  0xd9, 0x92, 0x46, 0x0c, 0x2c, 0xd4, 0xb6, 0xba, 0x85, 0x7e, 0x29, 0x32,
+  0x2d, 0x76, 0xa9, 0xd1, 0x36, 0xb5, 0x77, 0xc0, 0x6b, 0x8b, 0xf8, 0x4d,
+  0xbc, 0x5b, 0x22, 0xf9, 0xaf, 0x76, 0x47, 0x5c, 0x74, 0x61, 0xf4, 0x2a,
+  0x8c, 0xb8, 0xc2, 0x68, 0xaa, 0x6d, 0x28, 0x72, 0x4a, 0x8c, 0x6e, 0x81,
+  0xb1, 0xfc, 0x6b, 0x60, 0x9c, 0x67, 0xfc, 0x0c, 0x65, 0xad, 0xc1, 0x0f,
+  0x90, 0x12, 0x24, 0xc3, 0x7e, 0x11, 0xac, 0x08, 0xd7, 0x41, 0xab, 0x52,
+  0x90, 0x60, 0x74, 0xd3, 0x80, 0x65, 0x24, 0x23, 0xb7, 0x84, 0x15, 0xa2,
+  0x8a, 0x55, 0x88, 0x48, 0x85, 0x4a, 0x19, 0x93, 0x93, 0x52, 0x78, 0x34,
+  0x28, 0xbf, 0x8f, 0xd3, 0xc4, 0xc0, 0x44, 0x71, 0x0b, 0xa6, 0x2d, 0x8d,
+  0x64, 0xf9, 0x42, 0x39, 0x88, 0x62, 0x8d, 0x73, 0xbe, 0xfd, 0x59, 0xb9,
+  0x26, 0xe2, 0x29, 0x22, 0x78, 0x1c, 0x91, 0x2a, 0x42, 0xdb, 0x88, 0xe4,
+  0xa9, 0xcb, 0xd6, 0x44, 0x10, 0xac, 0x2b, 0x0e, 0xa9, 0x2b, 0x8e, 0x73,
+  0x52, 0x71, 0x9c, 0xb2, 0xe2, 0x90, 0x4e, 0xed, 0x98, 0x19, 0xcc, 0x36,
+  0xa1, 0x78, 0xbd, 0x50, 0xc8, 0x09, 0x14, 0x77, 0x20, 0xb3, 0x39, 0x0d,
+  0x46, 0x6e, 0x9f, 0x92, 0x24, 0xee, 0x0b, 0x2a, 0x40, 0x09, 0x0e, 0x23,
+  0xf4, 0x21, 0xa5, 0x36, 0x22, 0xd7, 0x48, 0x29, 0x44, 0x7e, 0x8d, 0x64,
+  0x52, 0x23, 0xc1, 0xb0, 0x44, 0xe2, 0x5d, 0x25, 0x25, 0x0d, 0xb0, 0x0b,
+  0x8a, 0x7b, 0x02, 0x85, 0x74, 0x48, 0xa9, 0x7a, 0xd4, 0xe4, 0x76, 0xda,
+  0x21, 0x3a, 0xe8, 0xa0, 0x41, 0xea, 0x17, 0x56, 0x94, 0x3d, 0x5b, 0x31,
+  0x72, 0x4a, 0x46, 0xa8, 0x66, 0xe4, 0xd5, 0x8c, 0xfc, 0x13, 0xd9, 0x4c,
+  0x4a, 0x46, 0x6e, 0xc5, 0xc8, 0x6e, 0x30, 0xf2, 0x0c, 0x46, 0x66, 0xbf,
+  0x47, 0x27, 0xc3, 0x0d, 0x83, 0x6f, 0x86, 0x55, 0x53, 0x2f, 0x7e, 0x2f,
+  0x9a, 0xbc, 0x49, 0x24, 0x0a, 0x8d, 0x3b, 0x88, 0xc6, 0xf9, 0x08, 0xab,
+  0x0e, 0x22, 0xdf, 0x52, 0x58, 0x0d, 0x64, 0xe8, 0x31, 0x61, 0x75, 0xc3,
+  0x94, 0xbc, 0x5a, 0x8e, 0xd7, 0xce, 0x8d, 0x04, 0xd1, 0xdf, 0xcf, 0xc0,
+  0x86, 0xc9, 0x6d, 0xfd, 0xb5, 0x73, 0x8d, 0x36, 0x56, 0xab, 0x56, 0x8b,
+  0x9f, 0xe2, 0x4c, 0xec, 0x69, 0x02, 0xee, 0xe9, 0x86, 0x49, 0x4f, 0x74,
+  0x87, 0xcc, 0xc8, 0x0e, 0xf0, 0x3b, 0xa3, 0x24, 0xe7, 0xcd, 0x62, 0xf0,
+  0xd4, 0xf7, 0xe5, 0xd5, 0x7a, 0xfc, 0xf2, 0x89, 0x8b, 0x8a, 0xd2, 0xaf,
+  0xfc, 0xa8, 0x21, 0xa1, 0xbc, 0x4f, 0x46, 0x65, 0xa3, 0x9c, 0x27, 0x91,
+  0x22, 0x8e, 0xdc, 0x2a, 0x8c, 0xec, 0x3a, 0x8a, 0x74, 0x9b, 0x23, 0xed,
+  0x30, 0xb1, 0x20, 0x23, 0xdb, 0x62, 0x64, 0x82, 0x21, 0xc3, 0x60, 0x90,
+  0x99, 0x6e, 0x31, 0x6e, 0x90, 0xc1, 0x7d, 0x64, 0x64, 0xf4, 0x1d, 0xf2,
+  0x80, 0x3d, 0xe6, 0x19, 0xb1, 0x13, 0x8e, 0x5f, 0x74, 0xc2, 0x2e, 0x24,
+  0xba, 0x11, 0xd4, 0xe9, 0x65, 0x26, 0x5d, 0xfd, 0x95, 0x83, 0xe9, 0x6f,
+  0xd0, 0x0f, 0x6f, 0x3d, 0xb7, 0x8e, 0x9e, 0x18, 0x6e, 0x3d, 0x27, 0x0c,
+  0xcc, 0xad, 0x6c, 0x05, 0x89, 0xa1, 0x98, 0xb2, 0x40, 0x7f, 0x96, 0xd3,
+  0x55, 0x36, 0x5d, 0x0a, 0x30, 0x3d, 0xc4, 0xbb, 0x79, 0xa1, 0x96, 0x8e,
+  0x9c, 0x7b, 0x03, 0x32, 0xfe, 0x1b, 0xc1, 0x4c, 0x3a, 0xb9, 0xb4, 0xcc,
+  0xf3, 0x45, 0x8a, 0xcd, 0x07, 0x28, 0xd4, 0x09, 0x66, 0xa5, 0x91, 0xf8,
+  0x51, 0x71, 0xad, 0x0f, 0xaa, 0x8e, 0x5b, 0x96, 0x3d, 0x83, 0x59, 0xb2,
+  0x97, 0x53, 0xe7, 0x59, 0xa2, 0x19, 0x4f, 0xe5, 0xaa, 0x6a, 0x44, 0x46,
+  0x9f, 0x78, 0x34, 0xe7, 0x02, 0x67, 0xb8, 0x08, 0xe5, 0xd2, 0x71, 0xfa,
+  0x08, 0xb9, 0x1f, 0xc9, 0xa6, 0x13, 0x0e, 0x26, 0xc5, 0x84, 0xb0, 0x44,
+  0x66, 0xe3, 0xbb, 0xa6, 0xe9, 0x2b, 0x4d, 0xc1, 0x7d, 0xcc, 0x85, 0xec,
+  0x7e, 0xf3, 0x03, 0xcf, 0x96, 0xce, 0xe6, 0x9d, 0xa4, 0x9f, 0x12, 0xd3,
+  0x12, 0xf9, 0xb6, 0x81, 0xe9, 0x9e, 0xf3, 0x28, 0x64, 0x42, 0xe6, 0xa0,
+  0x90, 0xed, 0xc4, 0xb7, 0x79, 0xb8, 0xf3, 0x3f, 0x1f, 0xe9, 0x54, 0xac,
+  0xec, 0x26, 0xab, 0x47, 0xf0, 0xf4, 0x8c, 0xdf, 0x9d, 0x74, 0x22, 0x5d,
+  0xb9, 0xea, 0xd2, 0xd5, 0xa8, 0x5c, 0xf7, 0x5c, 0xd7, 0x2d, 0x3d, 0x5e,
+  0xb6, 0xe5, 0xd7, 0x2b, 0x8e, 0xd5, 0x4f, 0x0e, 0x8d, 0x2f, 0x28, 0x23,
+  0x7a, 0x97, 0x98, 0x62, 0xb7, 0x7d, 0x97, 0x0f, 0x74, 0xb3, 0x61, 0xd9,
+  0x03, 0xa3, 0x11, 0xb8, 0x7b, 0x3e, 0x1f, 0x86, 0xe1, 0x0d, 0xcf, 0xcd,
+  0xf1, 0xf0, 0x49, 0x41, 0x6f, 0x11, 0x21, 0xe3, 0xcf, 0x07, 0x86, 0xf0,
+  0xe8, 0x77, 0x0a, 0xcb, 0x10, 0x36, 0xd2, 0x24, 0x4f, 0x8f, 0xe0, 0xf4,
+  0x15, 0xc3, 0x9c, 0x67, 0x82, 0x86, 0x09, 0x7b, 0x7b, 0x6b, 0xdf, 0x26,
+  0xf3, 0x01, 0x25, 0x8f, 0x68, 0xc1, 0xcb, 0x01, 0xc5, 0x46, 0xb6, 0x19,
+  0xa5, 0xf3, 0xd9, 0x7b, 0xce, 0xf3, 0x9a, 0x8a, 0x73, 0x46, 0x65, 0x81,
+  0xfb, 0xb1, 0xf4, 0x06, 0xed, 0xe5, 0x2f, 0x7e, 0x4e, 0x82, 0x76, 0xd4,
+  0xb6, 0x0b, 0x81, 0x96, 0xd7, 0x2a, 0x7a, 0x9f, 0x43, 0x7e, 0xb8, 0xe8,
+  0x88, 0xe6, 0x3a, 0x77, 0x92, 0xee, 0xde, 0xf8, 0x92, 0x31, 0x13, 0xf7,
+  0xf5, 0xc6, 0x17, 0x4c, 0x99, 0x3d, 0x8d, 0x1f, 0x81, 0xb6, 0xeb, 0x13,
+  0x5c, 0x4c, 0xdf, 0xb8, 0x11, 0xb4, 0x77, 0x71, 0x2a, 0x1b, 0xbe, 0x3b,
+  0x9a, 0x0a, 0xba, 0x3b, 0x82, 0xe7, 0xcf, 0x4f, 0xe0, 0xaf, 0x34, 0x89,
+  0x53, 0x76, 0xd3, 0xf2, 0xfd, 0x9d, 0x14, 0x6d, 0x72, 0xaa, 0x97, 0x93,
+  0x6b, 0xd9, 0x24, 0x57, 0xaf, 0xaf, 0xfe, 0x89, 0x63, 0xf0, 0x85, 0x6d,
+  0x64, 0x37, 0xd8, 0xf2, 0x5e, 0xf8, 0xca, 0xd6, 0x06, 0xf6, 0x52, 0x42,
+  0x6f, 0xa5, 0x84, 0x47, 0x53, 0xc2, 0x03, 0x94, 0x08, 0x0c, 0x8b, 0x85,
+  0x43, 0x8a, 0xe4, 0xa9, 0x29, 0x4d, 0x17, 0x7f, 0x2f, 0x3a, 0x0f, 0x75,
+  0x26, 0x57, 0xe2, 0x71, 0xfb, 0xe8, 0x78, 0xa3, 0xc7, 0x09, 0x13, 0x8e,
+  0x3f, 0x6a, 0xce, 0x82, 0x3d, 0x70, 0xfe, 0x03,
+  0xed, 0x99, 0x5d, 0x73, 0x9b, 0x38, 0x14, 0x86, 0xef, 0xf7, 0x57, 0xe8,
+  0x3e, 0x64, 0x47, 0x5f, 0x88, 0x8f, 0xbb, 0x6c, 0xda, 0x64, 0x77, 0x36,
+  0x6d, 0x33, 0xa1, 0xed, 0x64, 0x2f, 0x85, 0x21, 0x8e, 0xb6, 0x36, 0x78,
+  0x30, 0xde, 0xc6, 0xf9, 0xf5, 0x3d, 0x80, 0xc0, 0x80, 0x6d, 0x30, 0x31,
+  0xc9, 0x26, 0x33, 0x89, 0x67, 0xe2, 0x23, 0x61, 0x0b, 0xf1, 0xe8, 0xe8,
+  0xd5, 0x39, 0xc7, 0xd8, 0xc4, 0xc5, 0x9f, 0x89, 0xfd, 0xc2, 0xe0, 0x79,
+  0x0f, 0xd7, 0xdd, 0xc6, 0x99, 0xf7, 0xcd, 0x43, 0x97, 0x72, 0x1e, 0x2e,
+  0x64, 0x60, 0x48, 0xd7, 0xc7, 0x86, 0xef, 0xfa, 0xc4, 0xf0, 0xe5, 0xe4,
+  0x87, 0xeb, 0x3b, 0x46, 0xb0, 0x08, 0xe2, 0x9f, 0x91, 0x7b, 0x8f, 0x7f,
+  0xe7, 0x60, 0xcf, 0xc2, 0xbb, 0x34, 0xb3, 0x6d, 0xb0, 0x13, 0x35, 0xbd,
+  0xcf, 0x1b, 0x14, 0x1a, 0xab, 0x45, 0x66, 0x11, 0x63, 0xba, 0x52, 0x41,
+  0xe8, 0xfa, 0xc2, 0xc8, 0x3e, 0xb9, 0xbc, 0x8f, 0x57, 0xb3, 0x20, 0x4c,
+  0x5c, 0x9f, 0x17, 0xed, 0x54, 0x65, 0x83, 0x5a, 0x79, 0x23, 0x85, 0xef,
+  0x4f, 0xe1, 0x9a, 0x34, 0xf3, 0xe6, 0x83, 0x2b, 0x71, 0x6e, 0xac, 0x5d,
+  0x49, 0x8c, 0x7c, 0xec, 0xcd, 0xd7, 0x4d, 0xdd, 0x51, 0x7c, 0xdf, 0x2e,
+  0x5a, 0xd5, 0x00, 0xbc, 0x68, 0xc3, 0x08, 0xb4, 0xb0, 0x60, 0x08, 0x66,
+  0x2c, 0x53, 0x99, 0xa4, 0xf0, 0x24, 0xd8, 0x78, 0x70, 0x7d, 0x6a, 0xac,
+  0x5d, 0x9f, 0x19, 0x8b, 0x99, 0x4c, 0xef, 0xe2, 0x64, 0xee, 0x5e, 0xa9,
+  0x68, 0xf5, 0x60, 0xfc, 0x86, 0xdb, 0x70, 0x84, 0xe5, 0xe8, 0x1e, 0xb2,
+  0x81, 0x73, 0xf3, 0xe5, 0x12, 0xfd, 0xbd, 0x8a, 0xa4, 0x42, 0x6c, 0x0b,
+  0x10, 0x0c, 0xff, 0x34, 0x42, 0x84, 0xb6, 0x10, 0x89, 0x3a, 0x22, 0xc2,
+  0xfa, 0x19, 0xcd, 0xd5, 0x72, 0x42, 0xe0, 0xd1, 0x88, 0x01, 0x2b, 0x17,
+  0xcc, 0xc2, 0xcc, 0xa6, 0xda, 0xa6, 0x60, 0xb3, 0x36, 0x45, 0xab, 0x41,
+  0x91, 0xf0, 0x41, 0x18, 0x49, 0x86, 0x91, 0x65, 0x18, 0xf9, 0x7e, 0x8c,
+  0x01, 0xbe, 0xcb, 0xde, 0xee, 0x44, 0x1d, 0x22, 0x60, 0xfc, 0x33, 0x4e,
+  0x14, 0x4c, 0x0c, 0x79, 0x3f, 0x55, 0x3a, 0xb9, 0x47, 0xd7, 0x49, 0x8c,
+  0xce, 0xe3, 0x28, 0x4d, 0xe2, 0xd9, 0x2c, 0x4c, 0xb6, 0x98, 0xda, 0x63,
+  0x21, 0x6d, 0x78, 0x1d, 0xc1, 0x0d, 0xa4, 0x9a, 0xf7, 0x00, 0xb7, 0x23,
+  0xa4, 0x09, 0xac, 0xe4, 0xb9, 0x1b, 0x98, 0x73, 0x80, 0xdb, 0x11, 0x4c,
+  0xed, 0xdc, 0x28, 0x9d, 0xae, 0x74, 0x3b, 0xfb, 0x0f, 0x95, 0x7e, 0x88,
+  0x91, 0x77, 0x71, 0xce, 0x70, 0x86, 0x87, 0x64, 0x78, 0xf0, 0x96, 0xcb,
+  0x9d, 0xc0, 0x94, 0x35, 0x9e, 0x53, 0x89, 0x2b, 0x3a, 0x27, 0xb9, 0x0d,
+  0x70, 0x4e, 0xe1, 0x7a, 0xdb, 0xc9, 0xb6, 0x7c, 0xa2, 0xb1, 0xc0, 0xbc,
+  0x67, 0xc2, 0xa4, 0x98, 0x20, 0x71, 0x08, 0xd7, 0x13, 0x2f, 0x26, 0xec,
+  0xa5, 0x61, 0x38, 0xf3, 0xc2, 0x44, 0x85, 0x4b, 0xe4, 0xa5, 0x89, 0x4c,
+  0x57, 0x4b, 0x74, 0x7b, 0x55, 0x5b, 0xd9, 0x81, 0x2b, 0x7a, 0xe4, 0xd6,
+  0x78, 0x69, 0xc7, 0x2f, 0xb9, 0x30, 0x52, 0x70, 0x21, 0x7e, 0x07, 0x97,
+  0x0f, 0xab, 0x78, 0x3c, 0x19, 0x61, 0xf4, 0xcd, 0xb1, 0x32, 0x89, 0x53,
+  0x3f, 0x80, 0x2a, 0x91, 0xb8, 0x98, 0xad, 0x03, 0x35, 0x55, 0xe8, 0xbb,
+  0x84, 0x89, 0x20, 0x3a, 0x1e, 0x23, 0xda, 0xed, 0x4f, 0xf4, 0x60, 0xa9,
+  0x05, 0x1a, 0x1b, 0xa9, 0xdd, 0x28, 0xad, 0xa9, 0x4d, 0x06, 0x9f, 0x10,
+  0xda, 0xe6, 0x60, 0x5b, 0x3d, 0x6c, 0xd9, 0xf8, 0x6c, 0x2d, 0x6a, 0xe5,
+  0x6c, 0x39, 0xcb, 0xa9, 0xd2, 0x72, 0x7f, 0xde, 0x2a, 0x19, 0x7f, 0x52,
+  0x5d, 0xa2, 0xfb, 0x74, 0xba, 0x78, 0x88, 0x07, 0x5a, 0x47, 0x7b, 0xa0,
+  0xd8, 0x41, 0xc9, 0x1c, 0x44, 0x89, 0xf6, 0xc9, 0xee, 0xe7, 0x8f, 0x5e,
+  0xa7, 0xee, 0x82, 0xcf, 0xd0, 0x92, 0x10, 0xdc, 0xd2, 0xa9, 0x08, 0xc1,
+  0x05, 0x2d, 0xbd, 0xd0, 0x6d, 0x8d, 0xab, 0xbd, 0x14, 0xb3, 0xce, 0x59,
+  0xe7, 0x93, 0xce, 0x8e, 0xd6, 0x8e, 0x89, 0x8f, 0x2f, 0xbf, 0x70, 0x58,
+  0x1f, 0xb9, 0xa0, 0x70, 0x52, 0xf6, 0xba, 0x7d, 0x1f, 0x1a, 0x4e, 0xc3,
+  0xdc, 0x00, 0x67, 0x6c, 0xc6, 0x1d, 0xeb, 0x45, 0x98, 0xfc, 0x50, 0x11,
+  0x3a, 0x0b, 0xe6, 0x2a, 0x91, 0x33, 0xf4, 0x59, 0xf0, 0xfa, 0x26, 0x38,
+  0xd1, 0x77, 0xce, 0x6e, 0x73, 0xa2, 0xef, 0x9d, 0x3d, 0xe1, 0x69, 0xd9,
+  0x6f, 0x6b, 0x73, 0x9d, 0xeb, 0xc4, 0x06, 0xec, 0x51, 0x3c, 0x79, 0x93,
+  0x20, 0xe1, 0x87, 0x44, 0x22, 0x55, 0x58, 0xb1, 0x0f, 0x02, 0xa3, 0xa4,
+  0x0c, 0xc3, 0x72, 0x0f, 0x21, 0x82, 0xc9, 0x1c, 0xc2, 0x8d, 0x7c, 0x04,
+  0x3d, 0x85, 0x43, 0xe8, 0x3f, 0x39, 0xdb, 0xda, 0xf6, 0xe2, 0x89, 0xbb,
+  0xde, 0xee, 0x0a, 0xb5, 0x9c, 0x23, 0x03, 0x7c, 0x70, 0xd8, 0x01, 0xca,
+  0x68, 0x1d, 0x10, 0x69, 0x55, 0x70, 0x24, 0x69, 0x7a, 0x48, 0x01, 0xe7,
+  0x46, 0xaa, 0x7f, 0x57, 0xe8, 0x6b, 0xbc, 0x4a, 0x22, 0x48, 0x84, 0xa2,
+  0x14, 0x7d, 0x0c, 0x54, 0xaa, 0xe2, 0xa8, 0x5a, 0x71, 0x7a, 0x6c, 0x68,
+  0xca, 0x06, 0x84, 0xa6, 0x92, 0x1d, 0x1b, 0x9a, 0xee, 0x04, 0x66, 0x36,
+  0x42, 0x53, 0xdc, 0x03, 0x4c, 0x68, 0x8d, 0xd4, 0xa0, 0x40, 0x7e, 0x0a,
+  0xb5, 0xf9, 0xf2, 0xed, 0x9f, 0xb3, 0x5d, 0xe7, 0x08, 0xab, 0xc4, 0xd1,
+  0xd9, 0x48, 0x23, 0xae, 0x29, 0x23, 0xd1, 0xc2, 0x68, 0x57, 0x4c, 0x78,
+  0x17, 0x13, 0xd1, 0x44, 0x42, 0x87, 0x22, 0xb1, 0x5a, 0x44, 0xcc, 0x8a,
+  0x08, 0xab, 0x88, 0xf0, 0x0c, 0x04, 0xc9, 0x40, 0xd0, 0xc3, 0x41, 0xb0,
+  0x77, 0x10, 0xba, 0x8e, 0xd0, 0x0b, 0x42, 0x1f, 0x3f, 0xfc, 0x70, 0x22,
+  0x07, 0x73, 0x28, 0xc3, 0xb6, 0xa7, 0x83, 0xa8, 0xe2, 0xaf, 0x16, 0x89,
+  0xf2, 0xe0, 0x11, 0x87, 0x30, 0xb1, 0x71, 0x1e, 0x6f, 0x09, 0x61, 0xe6,
+  0x27, 0x0f, 0x35, 0x35, 0x93, 0x4f, 0x90, 0xec, 0x9e, 0xcb, 0xf4, 0x11,
+  0x9d, 0x7f, 0xbd, 0xb9, 0xba, 0x19, 0x4f, 0x46, 0x5e, 0x5d, 0x86, 0xdb,
+  0x23, 0x23, 0x9c, 0xf1, 0x3b, 0x1e, 0xc0, 0x8b, 0xf0, 0x90, 0x57, 0x11,
+  0x3f, 0x00, 0xfa, 0x7e, 0x9b, 0xd5, 0x9c, 0x54, 0x34, 0x05, 0xcf, 0x99,
+  0xcf, 0x65, 0x14, 0xa0, 0x22, 0x4b, 0x3a, 0xbe, 0x18, 0x30, 0x40, 0x67,
+  0xcd, 0x67, 0xd1, 0xd9, 0x41, 0x25, 0x00, 0x6e, 0x99, 0x8c, 0xc2, 0x7f,
+  0x41, 0x44, 0x20, 0x4c, 0x0b, 0xc3, 0x7b, 0x8e, 0xc9, 0xc8, 0x2a, 0x72,
+  0x5e, 0x1a, 0x2f, 0xf6, 0x96, 0xe6, 0x9e, 0x11, 0xcc, 0x6b, 0xa8, 0x8d,
+  0x14, 0x60, 0xc4, 0x0e, 0x30, 0x1e, 0x9a, 0x6e, 0x21, 0x79, 0x86, 0x20,
+  0xe6, 0x35, 0x32, 0x71, 0x8a, 0xd4, 0x19, 0x0e, 0xe3, 0xda, 0x5e, 0x02,
+  0x26, 0x7f, 0x2d, 0xc2, 0xa9, 0x44, 0xd7, 0x97, 0x0e, 0x21, 0xf6, 0x08,
+  0x99, 0xdd, 0x1b, 0xab, 0x28, 0xb4, 0xb1, 0x54, 0xd5, 0x97, 0x12, 0x0b,
+  0x72, 0xb0, 0x70, 0x46, 0x2c, 0xdd, 0x8a, 0x37, 0x8f, 0x88, 0x96, 0xf1,
+  0xef, 0xd9, 0x5c, 0x3e, 0xc6, 0x11, 0xba, 0x50, 0x49, 0xf8, 0x2c, 0xd5,
+  0x81, 0x1d, 0x59, 0xf0, 0xd3, 0xca, 0xdc, 0x84, 0xfe, 0x7f, 0xd0, 0xd8,
+  0x1e, 0xbf, 0x72, 0xb0, 0xe3, 0xbc, 0xe8, 0x76, 0x7b, 0x99, 0x6c, 0xbb,
+  0x0f, 0xcb, 0xa4, 0xb0, 0x84, 0x8d, 0x69, 0x43, 0x85, 0xae, 0x3d, 0xd6,
+  0xf2, 0x21, 0xb8, 0xbb, 0x9f, 0x3f, 0x44, 0x81, 0x66, 0x53, 0x40, 0x11,
+  0x55, 0x20, 0x68, 0x6d, 0xe2, 0x40, 0x53, 0x87, 0x81, 0x7c, 0xb3, 0xd1,
+  0x5a, 0x6c, 0xb4, 0x26, 0x97, 0xcf, 0x36, 0x98, 0x4d, 0x29, 0xc9, 0x7a,
+  0x00, 0x3a, 0x84, 0x0d, 0xcb, 0xe3, 0x41, 0xd3, 0x28, 0x4a, 0x01, 0x03,
+  0xe0, 0x90, 0x57, 0x00, 0x47, 0x1e, 0x12, 0x2e, 0x77, 0xd3, 0x91, 0xb5,
+  0x78, 0x79, 0x44, 0x3c, 0xf6, 0x3e, 0xdf, 0xd9, 0x1d, 0xec, 0x14, 0xd9,
+  0x84, 0xce, 0x21, 0xcc, 0x5a, 0x0e, 0x21, 0xca, 0xba, 0x1b, 0xab, 0x00,
+  0xe1, 0xce, 0xe3, 0x9d, 0x1c, 0x99, 0x57, 0x11, 0x7a, 0x50, 0x62, 0x55,
+  0x3f, 0xde, 0x59, 0x77, 0x36, 0xb1, 0x03, 0x0e, 0x79, 0x87, 0xd3, 0x82,
+  0x33, 0xe1, 0xd5, 0xaf, 0x8d, 0x25, 0x1c, 0xde, 0xde, 0x58, 0x2f, 0x9e,
+  0x6a, 0xbd, 0x86, 0x8a, 0xcd, 0x36, 0x20, 0x7b, 0x1f, 0xa0, 0x71, 0x7e,
+  0x6d, 0x7d, 0xf3, 0x1e, 0x44, 0x2a, 0xed, 0x79, 0x07, 0xd4, 0x00, 0x34,
+  0xc1, 0xce, 0xfb, 0x16, 0xab, 0x01, 0xfa, 0x05,
+  0xed, 0xd8, 0x5b, 0x4f, 0xdb, 0x30, 0x18, 0x06, 0xe0, 0xfb, 0xfd, 0x8a,
+  0xdc, 0x63, 0x90, 0xcf, 0x39, 0xdc, 0x31, 0xd8, 0x05, 0xd2, 0x60, 0x48,
+  0x95, 0x18, 0xda, 0x5d, 0x0e, 0x2e, 0x8d, 0x08, 0x49, 0x95, 0xc3, 0x28,
+  0xff, 0x7e, 0xce, 0x91, 0x3a, 0x0d, 0x69, 0xd2, 0xac, 0x1b, 0x6c, 0xa9,
+  0x04, 0x8a, 0x53, 0x62, 0xd9, 0x0f, 0x6f, 0x92, 0xcf, 0x86, 0x0c, 0x16,
+  0x1f, 0xea, 0xc2, 0xe2, 0xc8, 0x75, 0xa1, 0x59, 0x9e, 0x31, 0x50, 0xfe,
+  0x1b, 0xdc, 0x2e, 0xa8, 0x76, 0x11, 0x85, 0x69, 0x1c, 0x05, 0x81, 0x88,
+  0x81, 0x6d, 0x39, 0x10, 0x38, 0x96, 0x83, 0x80, 0x63, 0xbb, 0x8f, 0x96,
+  0x63, 0x00, 0x6f, 0xed, 0x45, 0xcf, 0xa1, 0xb5, 0x82, 0x67, 0x54, 0x1e,
+  0x07, 0x62, 0x99, 0xe6, 0xc7, 0xf9, 0xf9, 0xd8, 0x7f, 0x58, 0x15, 0x0d,
+  0x2c, 0x1b, 0xd9, 0x3a, 0x3f, 0x42, 0xe0, 0x21, 0xf3, 0x3d, 0x21, 0xaf,
+  0x87, 0x20, 0xff, 0xd3, 0x64, 0x15, 0x65, 0x81, 0x27, 0x62, 0xcb, 0xa1,
+  0x65, 0x3b, 0xf5, 0xf3, 0x5e, 0x11, 0x2a, 0x5a, 0xa9, 0xec, 0xe1, 0x41,
+  0x7e, 0x69, 0xe3, 0xa2, 0xb9, 0xb1, 0xec, 0xf2, 0xaa, 0x17, 0xcb, 0x46,
+  0xa0, 0xe8, 0xfd, 0xf5, 0x7a, 0x56, 0x9d, 0xa8, 0x3a, 0xc0, 0x65, 0xb3,
+  0xe9, 0xa1, 0xfa, 0x5a, 0x76, 0x41, 0xca, 0x23, 0xd9, 0x07, 0x05, 0x49,
+  0x6a, 0xc7, 0xa9, 0xe5, 0x98, 0x60, 0x63, 0x39, 0x04, 0xbc, 0x58, 0x0e,
+  0x06, 0xeb, 0xc0, 0x4e, 0x97, 0x51, 0xfc, 0x64, 0x7d, 0xf5, 0xc3, 0x6c,
+  0x03, 0x3e, 0xc1, 0xb7, 0x80, 0x50, 0x79, 0x1e, 0x2c, 0xa2, 0xf0, 0x45,
+  0xbb, 0xcc, 0xec, 0x60, 0xb1, 0x8a, 0xdc, 0x47, 0x8d, 0xe6, 0x44, 0x28,
+  0x27, 0xc2, 0x53, 0x89, 0x70, 0x2f, 0x11, 0x54, 0x89, 0xc8, 0x68, 0x22,
+  0xd4, 0x22, 0xa2, 0x0d, 0x11, 0x6e, 0x88, 0x98, 0x42, 0x04, 0x73, 0x22,
+  0x32, 0x82, 0xc8, 0x80, 0x73, 0x86, 0x3a, 0x80, 0x04, 0x87, 0x6e, 0x79,
+  0x06, 0xd6, 0x37, 0x19, 0x6b, 0x01, 0xfd, 0x8b, 0x09, 0x4a, 0xa3, 0xcc,
+  0x5d, 0xad, 0x6d, 0x4f, 0x5e, 0x49, 0x46, 0xc4, 0xe9, 0x55, 0xcb, 0x78,
+  0x4b, 0xeb, 0xff, 0x8e, 0xd3, 0x12, 0x43, 0x6f, 0x8e, 0xd3, 0xfe, 0x38,
+  0x71, 0x93, 0x13, 0x2c, 0x9b, 0x3a, 0xe6, 0x92, 0x8c, 0x12, 0xbe, 0xe4,
+  0x42, 0x6a, 0xdd, 0xf8, 0x61, 0x2a, 0x42, 0x2f, 0xd2, 0x16, 0xcf, 0x7e,
+  0xea, 0xae, 0x8e, 0x12, 0xad, 0x31, 0x72, 0x0e, 0xef, 0x90, 0x7b, 0xf2,
+  0x13, 0x17, 0x15, 0x33, 0x1d, 0x65, 0xe8, 0xe8, 0x1d, 0x86, 0x44, 0x09,
+  0x19, 0xde, 0xc3, 0xe6, 0xd1, 0x25, 0x25, 0x8c, 0x31, 0x4a, 0x19, 0xf6,
+  0x08, 0x24, 0x8c, 0x40, 0x26, 0x9f, 0xeb, 0xe0, 0x3a, 0x72, 0xb3, 0x54,
+  0x68, 0x90, 0xd1, 0xfb, 0x1d, 0x27, 0x39, 0xa3, 0x91, 0x50, 0x2a, 0x0f,
+  0x57, 0x78, 0x88, 0x1a, 0x2c, 0xb6, 0x3f, 0x58, 0xba, 0x8a, 0x42, 0x07,
+  0x04, 0xab, 0x41, 0x91, 0x84, 0xf5, 0xad, 0x47, 0xc7, 0xa8, 0x10, 0x55,
+  0x85, 0xdc, 0x4f, 0x4f, 0xcf, 0xc4, 0xcc, 0xfc, 0xe9, 0xa4, 0x08, 0x79,
+  0x83, 0x79, 0x1c, 0xeb, 0x4c, 0x27, 0xd8, 0x81, 0xcd, 0x07, 0x2c, 0x52,
+  0x21, 0x82, 0x85, 0x88, 0x7d, 0x91, 0x68, 0x37, 0xfe, 0x93, 0x93, 0x25,
+  0xda, 0x6d, 0x90, 0x25, 0x5d, 0xa9, 0xa9, 0xef, 0x97, 0xde, 0xb9, 0x1b,
+  0x13, 0xa7, 0x6e, 0x8e, 0x99, 0xb9, 0xbc, 0x75, 0xf7, 0x4f, 0x9d, 0x41,
+  0xf9, 0x60, 0x29, 0x9e, 0xbf, 0x08, 0x6e, 0x7f, 0xc0, 0xb9, 0xec, 0xc4,
+  0xd7, 0x2e, 0x02, 0x3b, 0x49, 0x7c, 0xb7, 0xef, 0xc9, 0x82, 0x0f, 0x7c,
+  0xb2, 0x34, 0x2f, 0x8c, 0xe1, 0x83, 0xa3, 0xb4, 0x7a, 0x4d, 0xbc, 0xcb,
+  0xc1, 0xf1, 0xf7, 0x38, 0x38, 0xdc, 0xfd, 0x6f, 0x7d, 0x7b, 0x50, 0xfc,
+  0xc0, 0x41, 0x19, 0x7d, 0xb9, 0x37, 0xa7, 0x56, 0x20, 0x70, 0x4c, 0x05,
+  0xa2, 0x0f, 0xa8, 0x40, 0xda, 0x40, 0x94, 0xa9, 0xff, 0xbd, 0x19, 0xa8,
+  0x0d, 0xc4, 0x67, 0xa0, 0x7e, 0x20, 0x5d, 0x01, 0xba, 0xbb, 0x58, 0x68,
+  0xd7, 0x91, 0x1c, 0x49, 0xd8, 0x67, 0x65, 0x1e, 0xa5, 0xe2, 0xe7, 0x0a,
+  0xd6, 0xc9, 0x90, 0xba, 0x43, 0xd5, 0xd2, 0x55, 0xac, 0xd3, 0xfe, 0xba,
+  0xc3, 0x18, 0xf4, 0x9e, 0xa1, 0x2e, 0x45, 0xcc, 0x64, 0x44, 0x16, 0x1e,
+  0x48, 0xfe, 0x98, 0xb2, 0x0c, 0x11, 0x45, 0xc5, 0x4f, 0xda, 0x15, 0x3f,
+  0x2d, 0x84, 0x48, 0x45, 0xd4, 0x14, 0x64, 0x45, 0xb0, 0x0a, 0x20, 0x39,
+  0xbe, 0x9a, 0x47, 0x0e, 0xbc, 0xc0, 0x91, 0x00, 0x35, 0x0d, 0x6f, 0xd1,
+  0xd4, 0x56, 0x55, 0x10, 0xd4, 0x57, 0xb0, 0xb1, 0x9f, 0xa6, 0xae, 0x37,
+  0xaa, 0x0e, 0x5a, 0x8b, 0xa1, 0xfa, 0x9d, 0xdc, 0x4d, 0x53, 0x94, 0xf7,
+  0x88, 0xe5, 0x36, 0xa8, 0x27, 0x4a, 0xac, 0xdc, 0x76, 0x40, 0x54, 0xc7,
+  0xca, 0x0e, 0xcd, 0xcd, 0xdd, 0xd5, 0xe5, 0xd5, 0xf9, 0x96, 0x8f, 0xf6,
+  0x13, 0xa2, 0x33, 0x48, 0x77, 0x0b, 0x10, 0x7a, 0x68, 0x90, 0x78, 0x5f,
+  0x90, 0xf4, 0x89, 0x0b, 0x23, 0x63, 0xcc, 0xba, 0x88, 0x0f, 0x89, 0x91,
+  0x80, 0xb4, 0xca, 0x53, 0x59, 0xa7, 0xe1, 0x52, 0x0e, 0xdc, 0x3b, 0xd1,
+  0x46, 0xfb, 0x16, 0x0a, 0xed, 0x4b, 0xe0, 0xcb, 0x2a, 0xb6, 0xaa, 0xd9,
+  0xf0, 0x2e, 0x14, 0xe1, 0x47, 0x2c, 0xf0, 0xf9, 0xe4, 0x02, 0x9f, 0x4d,
+  0x2e, 0xf0, 0x77, 0x88, 0x48, 0x45, 0x74, 0xed, 0xbb, 0x71, 0x94, 0x44,
+  0xcb, 0x54, 0x6b, 0x61, 0x75, 0x28, 0xe9, 0xbf, 0x6b, 0xb9, 0xf8, 0x61,
+  0xb8, 0x10, 0xa9, 0xb8, 0x50, 0xf9, 0x4d, 0x99, 0xa8, 0x2a, 0x47, 0x3d,
+  0x4f, 0xf0, 0xf1, 0x0b, 0xc6, 0x83, 0xa8, 0xde, 0xc3, 0xd2, 0x71, 0x87,
+  0x8a, 0xcd, 0x54, 0x43, 0xa9, 0xf4, 0x0f, 0x43, 0x55, 0xef, 0xd7, 0xb0,
+  0xbf, 0x8f, 0x66, 0xce, 0x68, 0xa3, 0xd1, 0x10, 0x9a, 0xd1, 0xc6, 0xa3,
+  0x91, 0x19, 0x6d, 0x3c, 0x1a, 0x9b, 0xd1, 0x06, 0xa3, 0xc9, 0xba, 0xbe,
+  0x23, 0x69, 0xdf, 0xfd, 0x58, 0x04, 0x22, 0x99, 0xdf, 0x9a, 0x2d, 0x2c,
+  0xdc, 0x85, 0xb5, 0x55, 0xb0, 0xce, 0x5e, 0x8a, 0x97, 0x28, 0xf2, 0xb5,
+  0x55, 0xea, 0x37, 0x5e, 0x47, 0xd8, 0xa6, 0xe9, 0xdf, 0x7a, 0x30, 0x26,
+  0xee, 0xd3, 0x98, 0xa3, 0xb7, 0x69, 0x06, 0xae, 0x18, 0x6b, 0x23, 0x52,
+  0xed, 0xd7, 0x02, 0xe3, 0xb3, 0x9f, 0x5e, 0x46, 0xda, 0x0f, 0x11, 0x47,
+  0x1d, 0x2b, 0xa0, 0x46, 0xe7, 0x44, 0x8e, 0xb8, 0xc2, 0x39, 0xb5, 0x61,
+  0x63, 0x73, 0x52, 0x1c, 0x4b, 0x9a, 0x53, 0x7b, 0x77, 0xc7, 0x7f, 0x67,
+  0x86, 0x03, 0xc6, 0xfb, 0x0b,
+  0xe5, 0x98, 0x4b, 0x6f, 0xa3, 0x48, 0x10, 0xc7, 0xef, 0xfb, 0x29, 0x38,
+  0xee, 0xca, 0x78, 0xd5, 0x0f, 0x68, 0x1a, 0x6e, 0x49, 0x36, 0x89, 0x34,
+  0xca, 0x38, 0x56, 0x3c, 0x3b, 0x13, 0xed, 0x0d, 0x6c, 0x92, 0xa0, 0x75,
+  0x4c, 0x84, 0xb1, 0xc6, 0x99, 0xc3, 0x7c, 0xf6, 0xe9, 0x17, 0x98, 0xf7,
+  0xc3, 0x30, 0x8a, 0xa3, 0x44, 0x91, 0x5c, 0x60, 0xd3, 0x54, 0xfd, 0xfa,
+  0x5f, 0xd5, 0xd5, 0x0d, 0x4c, 0x20, 0xfe, 0x4c, 0x1f, 0x18, 0xfc, 0xd3,
+  0xc7, 0x00, 0x89, 0x1b, 0x08, 0xd8, 0xfc, 0x43, 0xbf, 0xf7, 0xc2, 0xbd,
+  0x76, 0xbb, 0xf1, 0xb5, 0xcb, 0x75, 0x10, 0xfb, 0xba, 0xeb, 0x78, 0x40,
+  0xf7, 0x1c, 0x0f, 0xea, 0x9e, 0xbb, 0xfc, 0x9f, 0x7d, 0x62, 0xa2, 0xaf,
+  0x5e, 0x56, 0xe1, 0xf7, 0x8d, 0xf3, 0x04, 0xfe, 0x36, 0x98, 0xbd, 0xf6,
+  0x1f, 0x62, 0x6e, 0x53, 0x66, 0x47, 0xc1, 0xe3, 0x93, 0xb8, 0x40, 0xec,
+  0x62, 0xf7, 0xc2, 0x2d, 0xa8, 0xf3, 0x1f, 0x6c, 0x9f, 0xc2, 0xdd, 0x7a,
+  0xe5, 0x47, 0x8e, 0x47, 0xe4, 0x75, 0x1c, 0xc8, 0xd1, 0xc4, 0x55, 0xcc,
+  0x9e, 0x7b, 0x64, 0x5f, 0xba, 0xf2, 0xcb, 0xbd, 0xe3, 0x02, 0x61, 0xbc,
+  0x3a, 0x2e, 0xd4, 0xc5, 0x98, 0x87, 0xe7, 0x2d, 0x75, 0x43, 0x0d, 0x60,
+  0xc8, 0xcb, 0x74, 0x04, 0x53, 0x5e, 0xb3, 0x21, 0x90, 0xb4, 0xd8, 0x18,
+  0x58, 0xdf, 0xc6, 0x6e, 0x14, 0xb3, 0x5f, 0x43, 0x7d, 0xef, 0x78, 0x58,
+  0x7f, 0x75, 0x3c, 0x43, 0x7f, 0x59, 0xbb, 0xf1, 0x43, 0x18, 0x3d, 0x3b,
+  0x37, 0xc1, 0x66, 0xb7, 0xd7, 0xff, 0x00, 0x05, 0x32, 0x0f, 0x2b, 0x45,
+  0x06, 0x17, 0xc9, 0x5c, 0x84, 0x9b, 0x38, 0x0a, 0xd7, 0x6b, 0x3f, 0x2a,
+  0xe3, 0x31, 0xfb, 0xd2, 0x79, 0xdc, 0x05, 0x2b, 0x9f, 0x3d, 0x48, 0xfa,
+  0x70, 0x32, 0x07, 0x73, 0x32, 0x46, 0xe7, 0x84, 0x01, 0x84, 0x9d, 0x39,
+  0x91, 0x23, 0x31, 0xd1, 0x02, 0x25, 0x23, 0x4b, 0xc9, 0xce, 0x43, 0x42,
+  0xed, 0x90, 0xcc, 0x3c, 0x24, 0x50, 0x2b, 0x26, 0x9c, 0x42, 0x32, 0x12,
+  0x48, 0x16, 0x67, 0x84, 0x38, 0x23, 0x5c, 0xcb, 0x88, 0xd8, 0xc4, 0xb0,
+  0x10, 0x79, 0xe0, 0x9f, 0xd8, 0x25, 0x98, 0x59, 0xbe, 0x60, 0x14, 0xac,
+  0xa2, 0x30, 0x58, 0x2d, 0xc3, 0x4d, 0x01, 0x12, 0xe4, 0x90, 0x90, 0x82,
+  0x44, 0x87, 0x65, 0x5a, 0x8e, 0x0d, 0x04, 0x39, 0x38, 0x1e, 0xe9, 0x0d,
+  0x07, 0xe6, 0xe1, 0x24, 0x02, 0xab, 0x56, 0x90, 0xcd, 0xe1, 0x80, 0x66,
+  0x38, 0x16, 0x04, 0x42, 0x30, 0xd0, 0x96, 0x42, 0xe2, 0xa6, 0x80, 0x73,
+  0xf6, 0xec, 0xfe, 0x60, 0x64, 0x6e, 0x76, 0x1b, 0xb7, 0x49, 0x43, 0xf6,
+  0xb1, 0xa9, 0x06, 0x9a, 0x40, 0x59, 0xed, 0x99, 0xf6, 0x1c, 0x6c, 0x97,
+  0xf0, 0x40, 0xa4, 0x8e, 0x18, 0xed, 0x93, 0x72, 0xa4, 0x83, 0x9a, 0x2c,
+  0x5f, 0x59, 0x04, 0x65, 0x70, 0x31, 0x60, 0x9f, 0xc2, 0xd7, 0x29, 0x03,
+  0xa5, 0xfd, 0x79, 0xf3, 0x97, 0x3e, 0x91, 0xfe, 0x8a, 0xd0, 0x27, 0xd2,
+  0x65, 0xc1, 0x67, 0x9a, 0xde, 0xa7, 0xd2, 0x7e, 0x95, 0x50, 0xca, 0x05,
+  0xbe, 0x45, 0x46, 0xa5, 0x98, 0x55, 0x04, 0xf4, 0xa8, 0x08, 0xa8, 0x8c,
+  0x60, 0x16, 0x6c, 0x62, 0x7f, 0xb3, 0x0a, 0xb5, 0xc5, 0xf7, 0x20, 0x5e,
+  0x3e, 0x69, 0x37, 0xec, 0x95, 0x9a, 0x0a, 0x4b, 0xe4, 0x05, 0x11, 0x3e,
+  0x9a, 0xca, 0x49, 0xa3, 0xb1, 0x58, 0xa6, 0x89, 0x0f, 0x93, 0x39, 0x03,
+  0x3f, 0x8b, 0x6e, 0xd3, 0x9c, 0x52, 0x59, 0x79, 0x64, 0x7e, 0x43, 0xab,
+  0xdd, 0x71, 0xab, 0x0e, 0xfd, 0xdd, 0x08, 0xe8, 0x51, 0x23, 0x7a, 0x58,
+  0x8b, 0xde, 0xee, 0x83, 0xde, 0x6a, 0x41, 0x7f, 0xc7, 0x5f, 0x92, 0x63,
+  0x9f, 0xad, 0x49, 0x76, 0x87, 0x22, 0xc3, 0xc9, 0xff, 0x4c, 0xd1, 0x17,
+  0xbd, 0x26, 0x39, 0xc1, 0x80, 0x8e, 0x5e, 0xdb, 0x05, 0xee, 0x45, 0xaf,
+  0xe7, 0x51, 0xd8, 0x54, 0x2b, 0xe8, 0xb1, 0xb5, 0x02, 0x0d, 0x2d, 0xaa,
+  0x49, 0xb1, 0xc0, 0xa3, 0x97, 0x57, 0xd4, 0x17, 0x1d, 0x3d, 0x0a, 0xdd,
+  0xd1, 0x65, 0xb6, 0xb8, 0x1e, 0x99, 0x15, 0x49, 0x9a, 0x09, 0xb7, 0x16,
+  0x9d, 0x51, 0x56, 0x50, 0x8e, 0x1c, 0x2e, 0x90, 0xa3, 0x8d, 0xad, 0x0d,
+  0x48, 0x5b, 0x1b, 0xd4, 0x8a, 0x0e, 0x16, 0xb3, 0x7d, 0xb6, 0xb8, 0xd5,
+  0x16, 0xb3, 0xcb, 0xc5, 0xa8, 0xbc, 0xaa, 0x28, 0x15, 0x65, 0x50, 0x0a,
+  0x3e, 0x13, 0xed, 0xb0, 0xc8, 0x68, 0x63, 0x64, 0x22, 0xf7, 0xc1, 0x98,
+  0xfd, 0x48, 0x26, 0x59, 0xaa, 0x13, 0x22, 0x13, 0x7a, 0x56, 0xed, 0x5d,
+  0x03, 0xb3, 0x2b, 0xa6, 0x6c, 0x46, 0x8c, 0x6c, 0x5c, 0x13, 0xa5, 0x0f,
+  0x16, 0xd0, 0x44, 0x09, 0x84, 0xbd, 0x6c, 0x9a, 0xdc, 0xc5, 0xca, 0x14,
+  0xef, 0x3b, 0x30, 0x18, 0xb5, 0x80, 0x0c, 0x2a, 0x19, 0xe9, 0xc3, 0x6c,
+  0xca, 0x53, 0x44, 0xdd, 0xc1, 0xd0, 0x76, 0x30, 0x6c, 0xe0, 0x94, 0x0c,
+  0x3d, 0x90, 0xb1, 0x0f, 0x64, 0xac, 0x8c, 0xee, 0x47, 0xaa, 0x0f, 0xf9,
+  0x3d, 0x8e, 0x87, 0x1a, 0xc8, 0xa0, 0x22, 0x99, 0xc2, 0xf6, 0xe6, 0xb0,
+  0x34, 0x92, 0x56, 0x30, 0x58, 0xfc, 0x57, 0x2d, 0x2d, 0xdf, 0x82, 0x40,
+  0xfb, 0xb7, 0xf3, 0xca, 0xc2, 0x9b, 0x08, 0x15, 0xbd, 0xdc, 0x06, 0xca,
+  0xe0, 0x79, 0xeb, 0x22, 0x62, 0xe7, 0xf3, 0xd9, 0xa9, 0x03, 0x55, 0x60,
+  0x06, 0xb4, 0xea, 0xa8, 0xf7, 0x5a, 0xd2, 0x92, 0x5d, 0x2e, 0x50, 0xac,
+  0x10, 0x46, 0x39, 0x56, 0xf4, 0x3c, 0x88, 0xff, 0x09, 0xb5, 0xff, 0xfc,
+  0x28, 0x2c, 0xb7, 0x33, 0x69, 0xce, 0x4c, 0x5c, 0x98, 0xa0, 0x99, 0xba,
+  0x20, 0x45, 0x33, 0x11, 0x36, 0x43, 0x33, 0x75, 0xcb, 0xa7, 0x04, 0xa5,
+  0xed, 0x6c, 0x9f, 0xbd, 0x69, 0xc9, 0x5f, 0xaa, 0xb6, 0x16, 0xa7, 0xea,
+  0xef, 0x52, 0x5a, 0x48, 0xed, 0xa5, 0xa1, 0xa7, 0xfc, 0xbd, 0x76, 0x9f,
+  0xfd, 0x45, 0x10, 0x69, 0xd7, 0xc6, 0xb6, 0xc1, 0xdf, 0x9e, 0x99, 0x87,
+  0xf1, 0x7b, 0x3b, 0x6b, 0x48, 0xf8, 0x94, 0xf4, 0xf7, 0xf5, 0x4e, 0x3b,
+  0x0f, 0xf7, 0xa3, 0x76, 0x7e, 0x4d, 0x68, 0x0a, 0xfd, 0x9e, 0xd1, 0x1b,
+  0x0d, 0x2c, 0xd5, 0xa9, 0xf2, 0x09, 0x03, 0xea, 0xd3, 0xe5, 0x79, 0x4b,
+  0x55, 0xd6, 0x81, 0x69, 0xe6, 0xc8, 0x9c, 0x5f, 0x7e, 0xb9, 0x9d, 0x6b,
+  0x67, 0xf7, 0x50, 0x3b, 0xbf, 0xfa, 0x3c, 0x9e, 0x76, 0x4a, 0xeb, 0x59,
+  0x93, 0x76, 0xd4, 0x71, 0xcd, 0x00, 0xed, 0x30, 0x06, 0x43, 0xb5, 0xb3,
+  0x24, 0x48, 0x1c, 0x2f, 0x40, 0x97, 0xda, 0xb9, 0x63, 0x86, 0xcf, 0xb7,
+  0xd7, 0x67, 0xda, 0xfd, 0xdc, 0xbc, 0xd7, 0xe6, 0xeb, 0xdd, 0xf6, 0x8d,
+  0x10, 0x9d, 0x44, 0x7a, 0x25, 0x88, 0x50, 0x1d, 0xa2, 0xb3, 0x91, 0x11,
+  0xa1, 0xf7, 0x87, 0x88, 0xb2, 0xda, 0x2c, 0x8f, 0x2e, 0x40, 0x0e, 0x91,
+  0x5a, 0x51, 0x16, 0x57, 0x18, 0xf0, 0x56, 0xa1, 0xd4, 0x34, 0xf7, 0x67,
+  0x74, 0x6a, 0xf9, 0x65, 0x34, 0x57, 0xa0, 0x0c, 0x19, 0xf8, 0x9b, 0xc9,
+  0x24, 0xea, 0x39, 0x39, 0xf1, 0x74, 0x45, 0x04, 0x51, 0x25, 0xa2, 0xf4,
+  0xc4, 0x7c, 0x31, 0x3b, 0xb0, 0xfa, 0xb0, 0xc5, 0x28, 0x85, 0x55, 0xa3,
+  0xa7, 0xd9, 0x5b, 0xea, 0xe9, 0xb4, 0x52, 0x0e, 0x35, 0x23, 0x4a, 0xab,
+  0xf6, 0x38, 0x9c, 0xe0, 0xfb, 0x05, 0x85, 0xcd, 0x5a, 0x50, 0xbf, 0xa9,
+  0x62, 0x77, 0x09, 0x7c, 0x8c, 0xc8, 0x48, 0xf5, 0x7a, 0xc4, 0x67, 0x1f,
+  0xbd, 0xd1, 0xd4, 0x9f, 0x56, 0xcd, 0xa5, 0xd5, 0x53, 0x3f, 0x97, 0x33,
+  0x3f, 0xb0, 0xca, 0x56, 0x41, 0x49, 0x83, 0xe8, 0x9e, 0x01, 0x63, 0xb6,
+  0xbb, 0x2a, 0x6e, 0x08, 0x30, 0xad, 0x8a, 0xfb, 0xea, 0xe2, 0xa3, 0x35,
+  0x2a, 0xbf, 0x00,
+  0xed, 0x98, 0x5b, 0x6f, 0xa2, 0x40, 0x14, 0xc7, 0xdf, 0xf7, 0x53, 0xf0,
+  0x5e, 0xba, 0x99, 0x0b, 0x0c, 0x97, 0xc7, 0x6d, 0xbb, 0xb7, 0xd4, 0x6e,
+  0x13, 0xb2, 0x49, 0xb3, 0x6f, 0x83, 0x8c, 0x4a, 0x56, 0xc1, 0xe0, 0x98,
+  0xda, 0x6f, 0xbf, 0x03, 0x33, 0x42, 0xb9, 0x29, 0x28, 0xad, 0x6b, 0xaa,
+  0x2f, 0xcc, 0xa8, 0x8c, 0x9c, 0xdf, 0xf9, 0x9f, 0x9b, 0xc0, 0x04, 0xd9,
+  0x6b, 0x6c, 0xa3, 0x20, 0xbd, 0x42, 0x68, 0x42, 0xf9, 0x0e, 0xc8, 0xae,
+  0xba, 0xfd, 0x25, 0xe4, 0xb7, 0xb1, 0x76, 0x1f, 0x72, 0xa6, 0x79, 0x77,
+  0x3a, 0x75, 0x7d, 0xa8, 0xfb, 0xae, 0x0f, 0x74, 0x9f, 0x8e, 0xff, 0x8a,
+  0x0d, 0xd0, 0x83, 0x65, 0x10, 0x3f, 0x47, 0xee, 0x0c, 0x7c, 0x36, 0xc4,
+  0x7a, 0xce, 0x26, 0x3c, 0x5d, 0xdb, 0x62, 0x9d, 0x84, 0xd3, 0x59, 0xb6,
+  0x41, 0x62, 0xb3, 0x5e, 0xa6, 0x2b, 0xa8, 0x4f, 0xd7, 0x61, 0xc0, 0xc4,
+  0x8d, 0x48, 0x4f, 0xbf, 0xba, 0x9a, 0xc5, 0xeb, 0x79, 0xc0, 0x12, 0xd7,
+  0x27, 0x72, 0xcf, 0xc3, 0xec, 0x58, 0x9c, 0xed, 0xb8, 0x38, 0x61, 0x9a,
+  0x7e, 0x68, 0x67, 0xdb, 0x8d, 0x4b, 0x41, 0xb6, 0x78, 0x71, 0x29, 0xd4,
+  0xb3, 0xd3, 0x8b, 0xfb, 0x2d, 0xf5, 0x86, 0x3a, 0xc0, 0x90, 0xdb, 0xfc,
+  0x04, 0x47, 0xee, 0xc5, 0x11, 0x48, 0xae, 0xc4, 0x19, 0x58, 0x5f, 0x71,
+  0x9a, 0x70, 0xf1, 0x6d, 0xa8, 0x6f, 0x5c, 0xdf, 0xd0, 0x5f, 0x5c, 0x1f,
+  0xeb, 0xcb, 0x39, 0xe5, 0x93, 0x38, 0x59, 0xb8, 0xf7, 0x61, 0xb4, 0xde,
+  0xe8, 0x9f, 0x40, 0x15, 0x11, 0xc2, 0xa0, 0x09, 0xd1, 0xef, 0x39, 0x0f,
+  0x17, 0x94, 0xb3, 0x94, 0x11, 0x48, 0x19, 0xc1, 0x77, 0x65, 0x44, 0xcd,
+  0x63, 0x19, 0x51, 0x63, 0x3f, 0x23, 0x9c, 0x32, 0x32, 0x3a, 0x30, 0xda,
+  0x21, 0x23, 0x74, 0x22, 0x15, 0xbd, 0x0f, 0xa1, 0x8e, 0x2a, 0x42, 0x00,
+  0xdb, 0x4d, 0x84, 0x1e, 0xee, 0x3c, 0x0c, 0xb4, 0xc7, 0x24, 0x1e, 0x0e,
+  0xd2, 0xd9, 0x32, 0xc2, 0x00, 0x35, 0x32, 0xf2, 0xbe, 0xde, 0x60, 0xb0,
+  0x83, 0xcf, 0x95, 0x78, 0x66, 0x85, 0xe7, 0x9a, 0x82, 0x9c, 0xce, 0x55,
+  0xb6, 0x16, 0x70, 0xae, 0xc5, 0xe7, 0x55, 0x24, 0x35, 0x1b, 0x0f, 0x7b,
+  0x60, 0x8c, 0x9a, 0x1e, 0xf8, 0x0f, 0x4b, 0xe2, 0x41, 0x64, 0xdf, 0xe4,
+  0xc8, 0x2e, 0xbe, 0x1a, 0xc0, 0x19, 0x22, 0xa0, 0x49, 0x93, 0x6d, 0x23,
+  0xe9, 0x0a, 0x95, 0xf1, 0x8e, 0xb2, 0xc7, 0x2e, 0x27, 0x7d, 0x67, 0xbf,
+  0x79, 0xa4, 0x92, 0xe5, 0xad, 0x83, 0xb2, 0x15, 0x41, 0x2d, 0x3a, 0x7b,
+  0x18, 0x2c, 0x14, 0xcf, 0xb4, 0xd6, 0x11, 0xb3, 0x99, 0x8c, 0x02, 0xf3,
+  0x66, 0x9a, 0x3e, 0x07, 0x34, 0x4e, 0x0b, 0x1a, 0x62, 0x1c, 0x1e, 0x0f,
+  0xbb, 0xcb, 0xda, 0x01, 0x1c, 0x3a, 0x1b, 0xbe, 0xcf, 0x5c, 0x1b, 0x40,
+  0xd0, 0x5a, 0xaf, 0x06, 0x68, 0x79, 0xca, 0xf6, 0x5a, 0x65, 0x7b, 0x6b,
+  0xe9, 0xd9, 0xa9, 0x58, 0x67, 0xf7, 0x8a, 0xfb, 0x00, 0x42, 0xe5, 0x3a,
+  0xc7, 0x28, 0xd9, 0xe4, 0x71, 0x1a, 0x84, 0x54, 0xbb, 0x89, 0x23, 0x9e,
+  0xc4, 0xf3, 0x39, 0x4b, 0x6a, 0x86, 0x91, 0x03, 0x3d, 0x6a, 0x57, 0x0c,
+  0x34, 0x5e, 0xcb, 0xdc, 0xe9, 0x5d, 0x82, 0xcd, 0xb2, 0xca, 0x41, 0x9f,
+  0x12, 0x6c, 0xa5, 0x84, 0xd0, 0x6e, 0x91, 0x07, 0x44, 0xd6, 0x31, 0x0b,
+  0xaa, 0x85, 0x72, 0xbe, 0x3e, 0x8a, 0xa7, 0xb4, 0x88, 0xfc, 0x12, 0x1a,
+  0xe7, 0x38, 0x97, 0x97, 0x88, 0x58, 0x47, 0x12, 0xb1, 0xfb, 0x00, 0x21,
+  0x3d, 0x80, 0xd0, 0x00, 0x04, 0x8d, 0x40, 0x86, 0xaa, 0x81, 0xe7, 0x81,
+  0x81, 0x99, 0xb6, 0x53, 0xc7, 0xf0, 0xd1, 0x34, 0xc1, 0x54, 0x05, 0x40,
+  0xb0, 0x1c, 0x24, 0x1e, 0x67, 0x74, 0xd1, 0x29, 0x8b, 0xa4, 0x05, 0x4a,
+  0x51, 0xf1, 0xa1, 0x99, 0x43, 0x49, 0x0b, 0x5f, 0xc6, 0x24, 0xad, 0x04,
+  0x07, 0x64, 0x10, 0xd4, 0xc0, 0x66, 0x49, 0x83, 0x60, 0xce, 0xa0, 0x4c,
+  0xf6, 0xd9, 0x1a, 0x15, 0x99, 0xa3, 0xc6, 0x2c, 0x3f, 0xaa, 0x5f, 0xda,
+  0xd8, 0x12, 0x31, 0x21, 0xbc, 0x10, 0x29, 0x11, 0x21, 0x17, 0x22, 0xd2,
+  0x72, 0x66, 0x03, 0x55, 0x74, 0xa9, 0x04, 0xe2, 0x6f, 0x8b, 0x2f, 0x5d,
+  0xac, 0xd6, 0xd1, 0x54, 0xbb, 0xfb, 0xf1, 0xed, 0x11, 0x81, 0x01, 0xff,
+  0x45, 0x31, 0xdf, 0x64, 0x6c, 0xda, 0xd3, 0x63, 0x6c, 0xcd, 0x24, 0x4c,
+  0x5e, 0x73, 0x33, 0x47, 0xf1, 0x78, 0xcd, 0x99, 0x06, 0x4c, 0xfc, 0xa4,
+  0x8d, 0x4c, 0x67, 0xf0, 0xd6, 0xe9, 0xf4, 0x0d, 0x74, 0x1b, 0x19, 0x35,
+  0x3e, 0x1a, 0x63, 0xc9, 0x88, 0xd8, 0xa0, 0x3c, 0x2c, 0x3f, 0x7a, 0xb8,
+  0x12, 0x10, 0xe2, 0xd7, 0xfd, 0xcc, 0x08, 0x89, 0x26, 0x27, 0x93, 0x05,
+  0x87, 0x8c, 0x08, 0xab, 0x08, 0x08, 0x53, 0xc5, 0x83, 0x91, 0x7b, 0x9e,
+  0x54, 0xd8, 0x40, 0x50, 0x82, 0xd3, 0x9b, 0x0d, 0x84, 0x25, 0x38, 0xa8,
+  0x0f, 0x1b, 0x9c, 0xa2, 0x11, 0x5a, 0x7c, 0xc9, 0x02, 0xb6, 0x15, 0x0e,
+  0x23, 0x0e, 0x61, 0x96, 0x41, 0x4c, 0xc2, 0x88, 0x41, 0x26, 0x48, 0xe8,
+  0xc4, 0xb2, 0x04, 0x9c, 0x87, 0x30, 0xe2, 0x2c, 0x0a, 0xc4, 0x50, 0xfa,
+  0x1c, 0xf2, 0xf1, 0x4c, 0x80, 0x5a, 0xf8, 0x61, 0xc4, 0x02, 0xed, 0x67,
+  0xfc, 0x72, 0x2d, 0xa8, 0xad, 0xda, 0x6b, 0xaf, 0xcc, 0x1a, 0x2a, 0x81,
+  0x90, 0x57, 0x09, 0xc4, 0xda, 0x26, 0x90, 0x82, 0x58, 0x55, 0x4d, 0x66,
+  0x09, 0x18, 0x2a, 0x13, 0xb3, 0x1a, 0x88, 0x2d, 0xc2, 0xd5, 0x18, 0xa6,
+  0x3e, 0x68, 0x9e, 0xd4, 0x0b, 0x5d, 0x56, 0x1b, 0xf8, 0x5d, 0xb2, 0x02,
+  0xb9, 0xac, 0xda, 0xc9, 0x99, 0xdb, 0x40, 0x43, 0xc0, 0x97, 0xbd, 0xab,
+  0x94, 0x99, 0xfe, 0xe4, 0xc7, 0x1b, 0xcd, 0x63, 0x49, 0xc8, 0x56, 0xa7,
+  0xee, 0xec, 0xd1, 0xd1, 0x9d, 0xbd, 0x99, 0x73, 0xc2, 0x39, 0x27, 0xa3,
+  0x53, 0xfa, 0x6d, 0xc3, 0xe4, 0x28, 0x4c, 0xa3, 0x70, 0x9c, 0xc4, 0xab,
+  0x78, 0xc2, 0xb5, 0x0c, 0xd8, 0xaf, 0x88, 0xfd, 0x37, 0x88, 0x94, 0xa6,
+  0xe0, 0xe9, 0x61, 0xf9, 0x17, 0x4d, 0x75, 0xc1, 0x34, 0x39, 0x0f, 0x4c,
+  0x27, 0xd7, 0x15, 0xa3, 0xaa, 0x04, 0x96, 0x74, 0x25, 0x42, 0x4f, 0xf3,
+  0x2e, 0xb2, 0xaa, 0x53, 0x0a, 0x2e, 0x94, 0xea, 0x94, 0x2c, 0xa6, 0x5a,
+  0x4e, 0xb2, 0xed, 0xa6, 0xd4, 0x84, 0x71, 0xe9, 0x18, 0xf6, 0x74, 0x0c,
+  0x39, 0x39, 0xfb, 0x42, 0xee, 0x30, 0x72, 0xd8, 0x82, 0xb8, 0x99, 0x1c,
+  0xbe, 0xf5, 0x6a, 0x90, 0xec, 0x02, 0x12, 0x2c, 0x20, 0xa1, 0xa6, 0x89,
+  0x16, 0x34, 0xc6, 0x60, 0x97, 0x38, 0x6b, 0xb6, 0xca, 0xe9, 0x60, 0x94,
+  0x98, 0x77, 0x59, 0x96, 0x6e, 0x26, 0x3e, 0x93, 0x7f, 0xeb, 0xa8, 0xb9,
+  0xe4, 0x7b, 0x18, 0x24, 0xf1, 0x82, 0x46, 0x63, 0x96, 0x7c, 0xe0, 0x7c,
+  0xf3, 0x0f,
+  0xe5, 0x94, 0xcf, 0x8e, 0x9b, 0x30, 0x10, 0xc6, 0xef, 0x7d, 0x0a, 0x1e,
+  0xc0, 0xad, 0x3c, 0x36, 0x10, 0xe2, 0x5b, 0xb7, 0x51, 0xa3, 0x56, 0x95,
+  0x52, 0xa5, 0x3d, 0xf4, 0x6a, 0x83, 0x93, 0xa0, 0xb2, 0x38, 0xf2, 0x42,
+  0x9b, 0xbc, 0x7d, 0x0d, 0x36, 0x7f, 0xc2, 0xae, 0x58, 0xdc, 0xdd, 0xdb,
+  0x72, 0x99, 0x99, 0x80, 0x47, 0xf9, 0x7e, 0x9e, 0x6f, 0x70, 0x8c, 0xdb,
+  0x27, 0x4d, 0x48, 0x66, 0x33, 0x62, 0x43, 0x8c, 0xa1, 0x09, 0x28, 0xb9,
+  0xcb, 0xab, 0x8d, 0x0a, 0xbe, 0x6b, 0x15, 0x90, 0xe0, 0xa0, 0x74, 0xf0,
+  0x4b, 0xa8, 0x0b, 0xe2, 0x4c, 0x60, 0x24, 0x98, 0x00, 0x24, 0x78, 0xfa,
+  0x9b, 0x89, 0x18, 0x65, 0xe7, 0x4c, 0xfd, 0x2d, 0xd9, 0x09, 0x7f, 0x08,
+  0x4d, 0x5e, 0xc8, 0x43, 0xd5, 0xe4, 0x89, 0xc9, 0x75, 0x7e, 0x3c, 0xb5,
+  0x05, 0x31, 0x45, 0x7d, 0x6e, 0x32, 0x40, 0xc7, 0x3a, 0xcf, 0x24, 0x13,
+  0x09, 0x6a, 0xbe, 0x7c, 0x38, 0xa9, 0xba, 0xc8, 0xa4, 0x66, 0x22, 0xb4,
+  0x75, 0x95, 0x37, 0x4d, 0xd7, 0x6d, 0x51, 0x99, 0xf3, 0x47, 0xf3, 0x8e,
+  0x93, 0xb6, 0xbc, 0x30, 0x8e, 0xdb, 0xe4, 0xca, 0x38, 0xa0, 0xb6, 0xf7,
+  0x70, 0x3c, 0x72, 0x3f, 0xd8, 0xf3, 0x80, 0x6d, 0xd9, 0x77, 0x70, 0xaf,
+  0x4d, 0x0b, 0x6a, 0x33, 0xd3, 0x23, 0x44, 0x0f, 0x15, 0xd7, 0x15, 0x13,
+  0x2b, 0x74, 0x61, 0x82, 0xa0, 0x2b, 0x13, 0x14, 0x9d, 0x0b, 0x5e, 0x19,
+  0xad, 0xf7, 0xec, 0x5b, 0x5e, 0xd6, 0x17, 0xf4, 0x0e, 0x3b, 0x4a, 0x87,
+  0x08, 0x6c, 0x92, 0xac, 0x6c, 0xa4, 0x8e, 0xd2, 0xcf, 0x5a, 0x57, 0x85,
+  0x0c, 0xee, 0x24, 0x4f, 0x4f, 0xc1, 0x5e, 0xa6, 0xaa, 0x7c, 0x6b, 0x88,
+  0x60, 0x6d, 0x89, 0x60, 0x78, 0x14, 0x2d, 0xa2, 0xdd, 0x66, 0xbf, 0xfb,
+  0xb2, 0x09, 0xb6, 0x66, 0x8e, 0x1a, 0x36, 0xd0, 0xb0, 0xc1, 0x1d, 0x13,
+  0xd3, 0xda, 0x11, 0x11, 0x03, 0x0f, 0xa3, 0xae, 0xa5, 0x61, 0xd0, 0x39,
+  0x16, 0x80, 0xe7, 0x60, 0x00, 0xb9, 0xa1, 0x21, 0x00, 0xbc, 0x71, 0xd0,
+  0x5b, 0x1c, 0x02, 0x7a, 0xed, 0x10, 0xf9, 0x88, 0x77, 0x26, 0x02, 0x57,
+  0x3f, 0x23, 0x7e, 0xdd, 0x8b, 0x07, 0x3c, 0xa8, 0x37, 0x7f, 0xdf, 0xca,
+  0x4f, 0x7a, 0xf9, 0x64, 0x56, 0x7e, 0x38, 0x91, 0x4f, 0xbd, 0xe5, 0x47,
+  0x53, 0xf9, 0x71, 0x2f, 0x7f, 0xd1, 0xdd, 0xd3, 0x49, 0x24, 0x36, 0x43,
+  0x5b, 0x7e, 0x2f, 0x3f, 0x2b, 0x9d, 0xca, 0xe0, 0x93, 0x2a, 0x2b, 0xad,
+  0x8a, 0x42, 0xea, 0x11, 0x07, 0x6b, 0x90, 0xa4, 0xe7, 0xd1, 0x2a, 0x77,
+  0x40, 0xc8, 0x08, 0x08, 0x75, 0x40, 0x0c, 0xa5, 0x8e, 0x48, 0xec, 0x43,
+  0x24, 0xee, 0x80, 0x40, 0x07, 0x04, 0x7b, 0x02, 0x59, 0x3d, 0x61, 0x0f,
+  0xd2, 0x31, 0x5a, 0x2f, 0x40, 0x14, 0x8a, 0x30, 0xb9, 0x1d, 0x15, 0x67,
+  0x8f, 0xed, 0xee, 0xfd, 0xc7, 0xec, 0x0f, 0x2f, 0xe7, 0x19, 0xc1, 0x62,
+  0xc7, 0x3c, 0x85, 0x65, 0xb8, 0xd7, 0xe5, 0x8b, 0x62, 0x3c, 0x4e, 0x3e,
+  0x56, 0x78, 0x24, 0x14, 0xfc, 0x84, 0x92, 0xe5, 0xee, 0x98, 0x9b, 0x00,
+  0x3a, 0x11, 0x1e, 0x7a, 0x7b, 0x22, 0x9e, 0x72, 0x88, 0xbc, 0x3c, 0x31,
+  0xe2, 0x00, 0xd3, 0x0b, 0xff, 0x51, 0x9f, 0xa5, 0x7e, 0x2d, 0x0a, 0x2f,
+  0x73, 0xc4, 0x7f, 0xaf, 0x88, 0xc1, 0x11, 0xa4, 0x77, 0xc4, 0x30, 0x29,
+  0xd4, 0x87, 0x10, 0x4c, 0x08, 0xed, 0xa5, 0xe1, 0xd2, 0xac, 0x8e, 0xe0,
+  0xab, 0xba, 0x9e, 0x79, 0x36, 0xb7, 0x31, 0xc2, 0x01, 0x4f, 0x34, 0xc2,
+  0x13, 0x77, 0x1b, 0x83, 0xce, 0x52, 0x81, 0x97, 0x52, 0x21, 0x3e, 0x54,
+  0xe6, 0xf6, 0xc4, 0x3f,
+};
+static const struct gcdb_chunk_s gcdb_chunks[] = {
+	{ "00000000526574726f53746f6e653200", 0, 1049, 8101 },
+	{ "030000000d0f00008501000015010000", 1049, 1036, 8712 },
+	{ "03000000242f00009100000000010000", 2085, 1180, 8692 },
+	{ "03000000380700005082000011010000", 3265, 961, 9009 },
+	{ "030000004f04000000b3000010010000", 4226, 979, 8501 },
+	{ "030000005e040000120b000005050000", 5205, 708, 9108 },
+	{ "030000005e040000dd02000003020000", 5913, 894, 9153 },
+	{ "030000006d040000d2ca000011010000", 6807, 790, 9390 },
+	{ "030000006f0e0000d702000006640000", 7597, 1288, 8072 },
+	{ "0300000081170000990a000001010000", 8885, 1164, 7777 },
+	{ "03000000a30c00002800000011010000", 10049, 1185, 8494 },
+	{ "03000000c21100000791000011010000", 11234, 738, 8971 },
+	{ "03000000c82d00000751000000010000", 11972, 869, 8921 },
+	{ "03000000d814000007cd000011010000", 12841, 1256, 8693 },
+	{ "05000000050b00000045000040000000", 14097, 1184, 9028 },
+	{ "050000004c050000cc09000000810000", 15281, 917, 8911 },
+	{ "050000005e040000e302000002090000", 16198, 1071, 8435 },
+	{ "05000000c82d00001151000000010000", 17269, 950, 8746 },
+	{ "06000000c82d00000020000006010000", 18219, 508, 2448 },
 };
-const unsigned long gcdb_bin_len = 10855;
-const unsigned long gcdb_txt_len = 159426;
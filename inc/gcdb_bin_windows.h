@@ -1,1151 +1,1930 @@
-const unsigned char gcdb_bin[] = {
-  0x54, 0x50, 0x45, 0x56, 0xc6, 0x40, 0x0c, 0xde, 0x73, 0x8a, 0x1e, 0x20,
-  0x8f, 0x37, 0x82, 0x66, 0x09, 0x2b, 0x4e, 0xc0, 0x3a, 0xa9, 0xbb, 0xdb,
-  0xed, 0x99, 0xa4, 0xd8, 0x5f, 0xcd, 0xa7, 0xed, 0x8c, 0xf1, 0x46, 0x0e,
-  0x79, 0x65, 0x3a, 0x90, 0xb1, 0xe6, 0xdf, 0x01, 0x3e, 0xfa, 0xe8, 0x22,
-  0x1b, 0xbd, 0xf7, 0xdd, 0x96, 0x4e, 0x73, 0xd9, 0x77, 0xd1, 0x5b, 0x7f,
-  0x00, 0x21, 0x3b, 0x60, 0x64, 0x0b, 0x4c, 0x71, 0x8d, 0xfc, 0x0a, 0xc9,
-  0x90, 0xf4, 0x7b, 0x87, 0x85, 0xb9, 0x7f, 0x08, 0x73, 0x93, 0x66, 0x8b,
-  0xcc, 0x2f, 0x61, 0x9e, 0xca, 0xbc, 0x50, 0xe0, 0x02, 0x58, 0x07, 0x99,
-  0x2c, 0x88, 0x61, 0x2e, 0xfa, 0xb5, 0x49, 0xd2, 0x09, 0xf9, 0xe9, 0xc2,
-  0x4b, 0x29, 0x5d, 0xd6, 0x28, 0x5a, 0x42, 0x2e, 0x17, 0xf1, 0x41, 0xe1,
-  0x81, 0x74, 0xf1, 0x27, 0x92, 0x05, 0xe9, 0xfc, 0x97, 0x7f, 0x56, 0xe2,
-  0xb7, 0xe0, 0xd2, 0xff, 0x1a, 0x1e, 0x15, 0x4b, 0x85, 0xd7, 0x49, 0x3a,
-  0x1c, 0xcc, 0x0b, 0x4d, 0x0b, 0xf2, 0x0b, 0x1c, 0xc8, 0x1e, 0x4e, 0x64,
-  0x03, 0x43, 0x43, 0x4b, 0xd6, 0x4f, 0x2d, 0x7e, 0x96, 0x5d, 0x58, 0xce,
-  0x0c, 0x77, 0x3f, 0xfb, 0x93, 0x91, 0x4b, 0x74, 0xb0, 0xe6, 0xe6, 0x00,
-  0x9f, 0x7c, 0xb5, 0x77, 0x2e, 0xdd, 0x6d, 0xe3, 0x4a, 0xe2, 0x5f, 0xff,
-  0xbf, 0x05, 0x97, 0x33, 0x27, 0x37, 0xf7, 0x54, 0xe1, 0xc1, 0xc7, 0xd2,
-  0xf1, 0xab, 0xd3, 0xb7, 0xdd, 0xf1, 0x44, 0x4e, 0xda, 0x33, 0x3b, 0x90,
-  0x84, 0x6c, 0x4e, 0x64, 0xd1, 0x87, 0x92, 0x92, 0xf8, 0x2e, 0xfa, 0xb3,
-  0xff, 0x87, 0xa2, 0x28, 0x59, 0x25, 0x42, 0x04, 0x4d, 0x39, 0x36, 0x4d,
-  0x6e, 0xc6, 0x9c, 0x9c, 0x73, 0x5b, 0xa8, 0x1f, 0x0a, 0x85, 0x42, 0xa1,
-  0xaa, 0xf0, 0x79, 0x11, 0xc7, 0x3a, 0x73, 0xce, 0xd2, 0x74, 0xee, 0x5c,
-  0xa4, 0xf3, 0x24, 0x9d, 0xe6, 0xb4, 0xe6, 0x59, 0x3a, 0x99, 0xe8, 0xac,
-  0x72, 0xec, 0xc5, 0x58, 0xe4, 0x66, 0x2c, 0x7b, 0x7e, 0x38, 0x06, 0x74,
-  0x97, 0x1f, 0x02, 0xe2, 0xad, 0x1f, 0x16, 0x97, 0x13, 0xf5, 0xe0, 0x1c,
-  0xc5, 0xea, 0x7e, 0xae, 0xb3, 0x7c, 0x42, 0x30, 0x9f, 0x10, 0xbe, 0x9a,
-  0x10, 0x51, 0x4e, 0x48, 0x88, 0x58, 0xce, 0x47, 0x88, 0x6c, 0x3d, 0x1d,
-  0x21, 0xf2, 0x62, 0x36, 0x0a, 0xdc, 0xe6, 0xc9, 0x10, 0xdb, 0x93, 0xe1,
-  0x37, 0x9e, 0x0c, 0x49, 0x26, 0x23, 0xa8, 0x98, 0x0c, 0x51, 0x4e, 0x86,
-  0xcc, 0x27, 0x03, 0xf2, 0xc9, 0xb0, 0x62, 0x22, 0x77, 0x98, 0x0c, 0x4c,
-  0xdc, 0x1d, 0x26, 0x03, 0x13, 0x8f, 0x32, 0x19, 0x98, 0xb8, 0x00, 0x6a,
-  0x60, 0x52, 0xc8, 0x1e, 0xf9, 0x6c, 0xa5, 0x1f, 0x1c, 0xb7, 0x98, 0xf8,
-  0x1f, 0x92, 0xf9, 0x49, 0xfa, 0x18, 0x0a, 0x3c, 0xde, 0xf5, 0x10, 0x9a,
-  0x6e, 0x7b, 0x37, 0x8b, 0x24, 0xd6, 0xf9, 0x60, 0xf6, 0x21, 0xe2, 0x6d,
-  0x11, 0x89, 0x26, 0x88, 0x10, 0xd7, 0x1b, 0xa0, 0xb0, 0x61, 0x24, 0xf7,
-  0x32, 0x72, 0x58, 0x4e, 0x69, 0xa0, 0x14, 0xc8, 0x4a, 0x4a, 0x27, 0xe9,
-  0x4d, 0x98, 0x4e, 0xf5, 0x7a, 0x79, 0xc1, 0x93, 0x19, 0x51, 0x69, 0x59,
-  0xc5, 0xe8, 0xe5, 0x66, 0xf4, 0x7b, 0xc6, 0x0c, 0xe0, 0x17, 0x7f, 0x18,
-  0x42, 0xd5, 0x98, 0xcf, 0x38, 0xb4, 0x9f, 0x53, 0x3a, 0x95, 0xcd, 0x27,
-  0xcf, 0x38, 0x5b, 0x8c, 0xca, 0x6b, 0x3d, 0x5b, 0x5c, 0x22, 0xcb, 0xff,
-  0x22, 0xaa, 0xd0, 0x20, 0xb9, 0x73, 0x94, 0x45, 0x2a, 0xd6, 0xce, 0xef,
-  0xe9, 0xc3, 0x52, 0x6f, 0xd6, 0x33, 0xc7, 0x56, 0x24, 0xfc, 0x76, 0x20,
-  0xc4, 0x3e, 0xcf, 0xd7, 0xad, 0xc7, 0x22, 0xf7, 0x7b, 0xbe, 0xde, 0x3e,
-  0x4a, 0xc1, 0xda, 0x38, 0x72, 0x0b, 0x95, 0x46, 0x60, 0xbe, 0x3d, 0x24,
-  0xaa, 0x2e, 0x74, 0xfe, 0x6d, 0x26, 0xbc, 0xf9, 0xd2, 0x7b, 0xea, 0x64,
-  0xc2, 0xdb, 0x33, 0x55, 0xa2, 0x6e, 0x5e, 0xfd, 0xf2, 0x28, 0x13, 0x00,
-  0xd4, 0xf0, 0x1a, 0x15, 0xb0, 0xde, 0x98, 0x0d, 0xa0, 0xea, 0xcd, 0x8d,
-  0xea, 0x7d, 0x99, 0xa5, 0xdd, 0x57, 0x15, 0x33, 0x23, 0x61, 0x6b, 0x02,
-  0xd6, 0xba, 0x42, 0x19, 0x1d, 0x53, 0x48, 0x7d, 0x5a, 0x4f, 0x54, 0x91,
-  0x58, 0xf5, 0xd6, 0xff, 0x47, 0x32, 0xd7, 0x0e, 0x3b, 0x1c, 0x22, 0xec,
-  0x32, 0x23, 0xdc, 0xc3, 0x68, 0x74, 0x3a, 0x40, 0x5a, 0x7e, 0xa0, 0xac,
-  0x5c, 0x6d, 0x17, 0x1c, 0xda, 0x03, 0xaa, 0x97, 0xd4, 0x35, 0xba, 0x12,
-  0xbc, 0xbd, 0x21, 0x31, 0xcc, 0xff, 0x05, 0x71, 0x35, 0x0f, 0xe5, 0x1a,
-  0xb7, 0x17, 0xcd, 0xde, 0xf3, 0x77, 0x8d, 0xb3, 0xf6, 0x7c, 0x27, 0x23,
-  0x7f, 0x5b, 0x8f, 0x83, 0xa7, 0xcc, 0xee, 0xd3, 0xc4, 0x95, 0x08, 0x6e,
-  0x73, 0x71, 0xdf, 0x29, 0x56, 0x4a, 0xfb, 0x5e, 0xc1, 0x5a, 0xd8, 0x77,
-  0x0a, 0x0a, 0x59, 0xdf, 0x2b, 0x66, 0x2b, 0xea, 0x73, 0x09, 0x06, 0xbc,
-  0xfa, 0x34, 0xf4, 0xe7, 0xc1, 0x54, 0xf4, 0x97, 0x78, 0xc3, 0x20, 0x24,
-  0x9a, 0xc5, 0x78, 0xf9, 0x43, 0x28, 0x1d, 0x2f, 0x03, 0xe6, 0x9b, 0xc7,
-  0x3b, 0xb8, 0x60, 0x3e, 0xbc, 0x09, 0xb5, 0xd4, 0x00, 0xcc, 0x56, 0x0c,
-  0xaf, 0xf5, 0xd6, 0x56, 0x0e, 0xd2, 0xb5, 0xda, 0x9a, 0x02, 0x03, 0xe0,
-  0xc1, 0xc5, 0x2d, 0x19, 0xa1, 0xdc, 0xcb, 0xc8, 0x61, 0xc3, 0x52, 0x5d,
-  0x3a, 0x02, 0xcc, 0xaf, 0xa3, 0x34, 0xe8, 0x12, 0x30, 0x83, 0x2e, 0xb9,
-  0xe2, 0x1f, 0xef, 0x56, 0x3f, 0x13, 0x06, 0xab, 0xcf, 0xe5, 0x7f, 0xf3,
-  0x7d, 0xf9, 0xaf, 0xa2, 0xf8, 0xcc, 0xff, 0xd5, 0xdf, 0x58, 0x8d, 0x83,
-  0x06, 0x25, 0x10, 0x6c, 0x60, 0x35, 0xd9, 0xe0, 0x38, 0x70, 0xbf, 0x4f,
-  0xf2, 0xba, 0x01, 0x33, 0xca, 0x4b, 0x65, 0x68, 0x7f, 0xba, 0x6b, 0xae,
-  0xe9, 0x0d, 0x55, 0xdb, 0x22, 0x98, 0xcc, 0x54, 0x58, 0x29, 0xf0, 0xe9,
-  0x88, 0xc3, 0x4e, 0xe2, 0x84, 0xbb, 0x71, 0x89, 0xb1, 0xc6, 0x25, 0xa6,
-  0x53, 0x27, 0xa8, 0x2c, 0x6b, 0x43, 0xe5, 0x99, 0x53, 0x1a, 0xc8, 0x0c,
-  0x59, 0x0d, 0x98, 0xda, 0xa8, 0xe6, 0x5e, 0x42, 0x43, 0xdb, 0x00, 0x8c,
-  0x01, 0x89, 0x37, 0xd1, 0x91, 0x1d, 0x6c, 0x37, 0xee, 0x9c, 0xe1, 0x64,
-  0xc0, 0x7d, 0xc2, 0x66, 0x80, 0x43, 0x74, 0xba, 0x80, 0x54, 0x07, 0x67,
-  0xd8, 0x7b, 0xbd, 0xea, 0xc3, 0xe1, 0xe5, 0x4b, 0xdc, 0xf8, 0xb1, 0x06,
-  0xa6, 0xb9, 0x7d, 0x94, 0xc6, 0xef, 0xad, 0xe4, 0xdc, 0x85, 0x4a, 0xc9,
-  0xb3, 0x74, 0x88, 0x4e, 0xaf, 0x11, 0xe1, 0x80, 0xa8, 0x26, 0xca, 0x39,
-  0x68, 0x51, 0x1d, 0x22, 0xac, 0x4e, 0x94, 0xf9, 0xac, 0x23, 0x9d, 0x7c,
-  0x5f, 0xa5, 0x58, 0x0d, 0xa7, 0xbf, 0x01, 0x92, 0x85, 0x3d, 0xaa, 0x87,
-  0x34, 0x40, 0x12, 0xb5, 0x90, 0x06, 0x48, 0xcc, 0x77, 0xbd, 0x2a, 0x48,
-  0x23, 0x0e, 0x87, 0x0a, 0x28, 0xd0, 0xfb, 0x99, 0x43, 0xdf, 0xc6, 0x41,
-  0x33, 0x6f, 0x07, 0x39, 0x54, 0x0a, 0x7c, 0x36, 0xdc, 0x27, 0x14, 0x80,
-  0xc0, 0x35, 0x00, 0xea, 0xee, 0x21, 0x92, 0xb2, 0xe1, 0x4f, 0x67, 0x83,
-  0xcf, 0xcc, 0x86, 0x2a, 0x50, 0x77, 0x20, 0x21, 0x30, 0x12, 0x86, 0xa0,
-  0x90, 0x8e, 0xf7, 0x2e, 0xb1, 0xe6, 0xf1, 0x2e, 0x77, 0x57, 0xca, 0x27,
-  0x5a, 0x41, 0x54, 0x61, 0xc7, 0x86, 0xcc, 0x0b, 0xda, 0x5d, 0x18, 0x72,
-  0x19, 0x07, 0x65, 0x60, 0xa0, 0x4c, 0xef, 0xf8, 0xda, 0x8e, 0x98, 0x54,
-  0x14, 0xec, 0x08, 0x20, 0xe9, 0xfe, 0xf2, 0x64, 0x73, 0xc0, 0xc1, 0x2c,
-  0xd0, 0xeb, 0xd3, 0x9a, 0x62, 0x2e, 0x9a, 0x8f, 0xb8, 0x95, 0x61, 0x37,
-  0xef, 0xf4, 0x07, 0x4e, 0x21, 0x42, 0x16, 0x74, 0x6c, 0x36, 0x6a, 0x16,
-  0xc4, 0xe0, 0x8b, 0x08, 0x62, 0xe4, 0x08, 0xa0, 0x01, 0x90, 0xcb, 0x98,
-  0xdf, 0x31, 0x0b, 0x04, 0xcc, 0x60, 0x81, 0x0a, 0x17, 0x8a, 0x6c, 0x04,
-  0x5d, 0x72, 0x2f, 0xdb, 0x47, 0x62, 0xd1, 0x35, 0x59, 0xb0, 0xc1, 0xbd,
-  0x7c, 0x04, 0xa9, 0x56, 0x81, 0x06, 0x48, 0x6c, 0xbf, 0x26, 0x39, 0x97,
-  0x93, 0xc5, 0xac, 0x20, 0x35, 0x90, 0xc2, 0x81, 0x94, 0x9d, 0x7f, 0x55,
-  0xed, 0xed, 0x7e, 0x99, 0xcc, 0x93, 0x3b, 0x35, 0xd7, 0xc4, 0x72, 0xbf,
-  0x68, 0x90, 0xff, 0x5e, 0xc5, 0xf1, 0x44, 0x63, 0xce, 0xbb, 0xf8, 0x64,
-  0x85, 0xd7, 0xff, 0x52, 0xd5, 0x9f, 0x28, 0xf7, 0xb3, 0x73, 0x8e, 0x5f,
-  0x11, 0xbd, 0x97, 0xe4, 0xe4, 0x5a, 0x71, 0x1a, 0x38, 0x79, 0x56, 0x9c,
-  0x06, 0x4e, 0x58, 0xc3, 0xe9, 0xaf, 0x24, 0xd3, 0xf1, 0x6b, 0x62, 0x75,
-  0x97, 0xcc, 0xa2, 0xdc, 0x6e, 0xb9, 0x8f, 0x6c, 0x98, 0xd8, 0x18, 0x31,
-  0xf6, 0xa2, 0x56, 0x8c, 0x5b, 0xd0, 0x9c, 0xe8, 0xd9, 0xec, 0x85, 0x80,
-  0x2a, 0x69, 0x09, 0x94, 0x6f, 0x80, 0x62, 0xd0, 0x0c, 0xa8, 0x12, 0xf5,
-  0x5b, 0x6a, 0x03, 0x87, 0xbf, 0xfa, 0x30, 0x74, 0x1d, 0xa6, 0x3f, 0x9d,
-  0x4f, 0x53, 0x4d, 0x4f, 0x45, 0x3d, 0x5d, 0xcd, 0x0a, 0x40, 0xe6, 0x7f,
-  0x39, 0xe3, 0xac, 0x0a, 0xd7, 0xff, 0xe8, 0x2c, 0x6d, 0x57, 0x5b, 0x44,
-  0x99, 0x1c, 0xac, 0xf4, 0xdc, 0x0f, 0xc0, 0x34, 0x62, 0x87, 0xbd, 0xd6,
-  0xc8, 0x32, 0x67, 0xcd, 0xc6, 0xfc, 0xfc, 0x35, 0x25, 0xed, 0xbd, 0x58,
-  0x7f, 0x0c, 0xba, 0x58, 0x71, 0xe4, 0x76, 0xe2, 0x28, 0xba, 0xd3, 0xce,
-  0xf9, 0x11, 0xd0, 0x36, 0x25, 0xcf, 0xdb, 0xc8, 0x41, 0xd6, 0x4b, 0xed,
-  0xda, 0x36, 0x72, 0xa0, 0x2d, 0xcc, 0xca, 0x46, 0x0e, 0xac, 0x76, 0xc6,
-  0x01, 0x71, 0x15, 0x15, 0x96, 0x84, 0x49, 0xb6, 0xf8, 0xf9, 0x06, 0x1a,
-  0x5b, 0xf0, 0x66, 0x8d, 0x2d, 0xc6, 0x0a, 0x83, 0xe5, 0x5f, 0x18, 0x8f,
-  0x09, 0x8f, 0xb9, 0x8e, 0xbe, 0x39, 0x47, 0xe7, 0xbf, 0x3b, 0x9c, 0x01,
-  0xcd, 0xd9, 0xee, 0x3c, 0x99, 0xfa, 0xcc, 0xf0, 0x18, 0xd1, 0x5f, 0x05,
-  0x64, 0xa3, 0x6d, 0x32, 0x27, 0x57, 0xd8, 0x22, 0x51, 0xc0, 0x7e, 0x6b,
-  0x17, 0x6d, 0x77, 0x22, 0xc5, 0x2b, 0x30, 0x48, 0x2b, 0x6b, 0xee, 0xae,
-  0x6c, 0x87, 0xef, 0x03, 0x6e, 0x4b, 0x3f, 0x9e, 0xeb, 0xec, 0x66, 0x92,
-  0xfe, 0x70, 0x4e, 0xf4, 0x64, 0xf1, 0x53, 0x3b, 0x7f, 0x26, 0xd3, 0xb9,
-  0x9e, 0xc6, 0xa9, 0x33, 0xfa, 0x91, 0xcc, 0xa3, 0xdb, 0x47, 0x6d, 0xff,
-  0x5a, 0xaf, 0x26, 0xba, 0x81, 0x37, 0xd7, 0x1e, 0xe2, 0x11, 0x21, 0xff,
-  0xf5, 0x2b, 0x8c, 0x0b, 0x54, 0xab, 0x94, 0x53, 0xdf, 0x40, 0xf2, 0x72,
-  0xc4, 0x5f, 0x27, 0xb6, 0x5f, 0x06, 0x8b, 0xaa, 0x1d, 0x30, 0x97, 0x0f,
-  0xb0, 0x2c, 0x61, 0x21, 0x02, 0x0e, 0xb0, 0x6c, 0x61, 0x89, 0x26, 0xb0,
-  0x06, 0x58, 0x6c, 0x80, 0x65, 0x0b, 0x2b, 0x18, 0x34, 0xcb, 0x1e, 0x96,
-  0x1a, 0x60, 0xd9, 0xc3, 0xe2, 0x46, 0x58, 0x79, 0xd8, 0x84, 0xd0, 0x02,
-  0x52, 0x5a, 0x79, 0x20, 0x37, 0x9d, 0x66, 0xb5, 0x2a, 0xd6, 0x14, 0x51,
-  0x40, 0xbc, 0x53, 0xb9, 0x2f, 0x4e, 0xe2, 0x91, 0xe3, 0x5c, 0x2d, 0x21,
-  0x56, 0x43, 0x68, 0x20, 0x24, 0x06, 0x42, 0xfb, 0x37, 0x3b, 0xe4, 0xb6,
-  0x84, 0x06, 0x9b, 0xc4, 0x0d, 0xbb, 0xdd, 0xa0, 0x4f, 0x2a, 0x5c, 0x05,
-  0xdc, 0x10, 0xf8, 0x1b, 0x24, 0xc4, 0x0e, 0x40, 0x28, 0xc6, 0xb0, 0xf8,
-  0x1a, 0x07, 0xaf, 0x8e, 0x50, 0x88, 0xd0, 0x12, 0x51, 0x88, 0xd8, 0x9e,
-  0x51, 0xb9, 0xb8, 0xfc, 0x9d, 0xe0, 0xed, 0xb7, 0x64, 0x76, 0x9b, 0xde,
-  0x3b, 0xc7, 0x8b, 0xd9, 0x3c, 0xbd, 0x9b, 0xe5, 0xee, 0x92, 0x0b, 0x07,
-  0xb5, 0x48, 0xed, 0x13, 0x8b, 0xed, 0xcd, 0x89, 0x17, 0x61, 0x19, 0x15,
-  0x71, 0xb7, 0xc5, 0x9c, 0x24, 0x7a, 0xfa, 0x43, 0x65, 0xda, 0x39, 0x59,
-  0xa8, 0x89, 0x73, 0x9c, 0xde, 0xdd, 0xab, 0x79, 0x12, 0x4e, 0xb4, 0x93,
-  0xb7, 0x68, 0x1f, 0xcd, 0x15, 0x79, 0x63, 0xa2, 0xb3, 0xa1, 0x5b, 0x1a,
-  0xca, 0xb6, 0x46, 0x27, 0x02, 0x0c, 0x8a, 0x73, 0x07, 0xdd, 0xd9, 0xef,
-  0xd4, 0xbf, 0xd3, 0xa9, 0xf3, 0xc7, 0x62, 0xaa, 0x0e, 0xb1, 0x84, 0xa8,
-  0x8a, 0xf8, 0x0d, 0x48, 0x29, 0x6e, 0x0e, 0xc6, 0x05, 0xd6, 0xc8, 0xcc,
-  0xb7, 0x90, 0xb2, 0xd9, 0xa2, 0xf2, 0x10, 0xb0, 0x01, 0xb2, 0x03, 0xd6,
-  0xf0, 0x52, 0xf5, 0x92, 0xd4, 0x00, 0xd9, 0x42, 0x12, 0x5b, 0x90, 0xbc,
-  0x7d, 0x86, 0xc6, 0x5d, 0x47, 0x7a, 0xd9, 0x1e, 0x26, 0x3e, 0x07, 0x59,
-  0x99, 0x89, 0x59, 0xf4, 0x3d, 0x7e, 0xa6, 0x1e, 0x3b, 0x5e, 0xfd, 0x0a,
-  0x62, 0x64, 0xc9, 0xf0, 0xe2, 0xd2, 0xab, 0x26, 0x70, 0x8d, 0x0c, 0xa2,
-  0x95, 0xfd, 0xd4, 0x44, 0x9c, 0xbb, 0x34, 0x73, 0x78, 0x6b, 0x3b, 0xd1,
-  0x56, 0xfb, 0x0f, 0xa6, 0xf4, 0xf6, 0x76, 0x02, 0xc2, 0xe5, 0x5f, 0x41,
-  0x4d, 0xec, 0xe8, 0xf8, 0xe3, 0x47, 0x67, 0xa4, 0xd5, 0x5d, 0x12, 0xed,
-  0x33, 0x14, 0xfe, 0xaf, 0x9e, 0x79, 0xba, 0xa7, 0x6c, 0x0c, 0xa3, 0xd5,
-  0xdd, 0x85, 0xef, 0x06, 0xcb, 0x3d, 0x85, 0x49, 0xba, 0x75, 0xce, 0xe6,
-  0x59, 0xea, 0x1c, 0x0b, 0x70, 0xae, 0x3e, 0x3b, 0x97, 0x23, 0x41, 0x84,
-  0xee, 0x97, 0x5a, 0x28, 0x5e, 0x2c, 0x14, 0xe6, 0x55, 0x53, 0x4a, 0xe6,
-  0x0f, 0xce, 0x45, 0x32, 0x4d, 0xcc, 0x37, 0x7f, 0xef, 0x94, 0xd8, 0x5c,
-  0xd8, 0xf3, 0x47, 0x17, 0xf6, 0xbc, 0xbc, 0xb0, 0x17, 0x54, 0x2c, 0x9a,
-  0x2a, 0x21, 0x2d, 0xef, 0xe4, 0xe8, 0x98, 0xfd, 0xa6, 0x63, 0x2e, 0x89,
-  0xf3, 0x92, 0xf8, 0xa1, 0x87, 0x06, 0x12, 0xc2, 0xe2, 0xaf, 0x17, 0x90,
-  0x55, 0xf6, 0x65, 0xe4, 0x7c, 0xfe, 0x74, 0xee, 0xfc, 0x6b, 0x31, 0x55,
-  0x89, 0xc3, 0x7b, 0x9a, 0xd7, 0x42, 0x31, 0xb9, 0x1d, 0xc0, 0x44, 0x6f,
-  0x0f, 0xe5, 0x0b, 0x00, 0x93, 0x65, 0x6a, 0x0a, 0x22, 0x51, 0xf9, 0xb9,
-  0xca, 0x12, 0xe7, 0xeb, 0xf1, 0xc8, 0x39, 0x9e, 0xa8, 0xd9, 0x6c, 0xbf,
-  0x09, 0x17, 0x4f, 0x64, 0xb7, 0xb6, 0xbc, 0xdc, 0x66, 0x88, 0xcc, 0x38,
-  0xc4, 0x8b, 0x34, 0xd6, 0xd9, 0x74, 0xdf, 0x08, 0x11, 0x0e, 0xef, 0x8e,
-  0x36, 0x77, 0xd4, 0xcd, 0x0e, 0x95, 0x7d, 0x8a, 0x89, 0x16, 0x28, 0x57,
-  0xc7, 0xff, 0xf1, 0x16, 0x8e, 0x0f, 0x6a, 0xae, 0x32, 0x35, 0xbd, 0xe9,
-  0xdf, 0x61, 0x36, 0x76, 0x59, 0x81, 0x46, 0x4a, 0xaf, 0x12, 0x09, 0x3d,
-  0xd4, 0x0d, 0x81, 0xb6, 0x75, 0xa6, 0x12, 0x72, 0xc9, 0x28, 0xb3, 0xb9,
-  0x9a, 0x24, 0xe3, 0xed, 0x27, 0x5c, 0xdc, 0x1c, 0x93, 0xb7, 0xc2, 0x44,
-  0xa5, 0xb5, 0x50, 0x02, 0x2c, 0x47, 0xb7, 0x71, 0xb3, 0xa5, 0x4d, 0x18,
-  0x90, 0x01, 0xee, 0x8c, 0x6e, 0xa2, 0xc7, 0x89, 0x9e, 0xc4, 0x8e, 0x18,
-  0xee, 0x72, 0x76, 0x63, 0x5e, 0x48, 0x62, 0x5e, 0x1f, 0x3e, 0x38, 0xe0,
-  0x41, 0x6f, 0x82, 0xa4, 0xc4, 0x22, 0x30, 0xe5, 0x11, 0x1c, 0x27, 0x47,
-  0x4b, 0xd7, 0xfc, 0x2c, 0xff, 0xef, 0xde, 0xab, 0xf8, 0x80, 0x3a, 0xd3,
-  0x39, 0x17, 0x3d, 0x8c, 0x0a, 0x48, 0x92, 0x49, 0xd8, 0x86, 0xa4, 0x93,
-  0x79, 0x3a, 0xbd, 0x71, 0xce, 0x77, 0xdd, 0x24, 0xf6, 0x54, 0x3c, 0xcf,
-  0x5b, 0x44, 0x2a, 0x1b, 0xb9, 0x46, 0xd2, 0xce, 0x97, 0x8c, 0xa1, 0xe0,
-  0xc2, 0xc0, 0x27, 0x78, 0x26, 0xdf, 0x92, 0xa9, 0xf3, 0x67, 0x9a, 0x9f,
-  0x0a, 0xee, 0x52, 0xe7, 0x4f, 0x01, 0x07, 0xcf, 0x74, 0x6d, 0x9e, 0xdb,
-  0x6a, 0xb4, 0x29, 0xb2, 0x69, 0x32, 0x2b, 0xd5, 0x0f, 0x17, 0x90, 0x11,
-  0x00, 0xf3, 0xf4, 0xde, 0x61, 0xc8, 0xdc, 0xb3, 0xfe, 0x24, 0x6e, 0x52,
-  0x2a, 0x00, 0x52, 0x56, 0x50, 0xf9, 0x70, 0x76, 0xd1, 0xd3, 0x23, 0x18,
-  0xd5, 0x1a, 0x5e, 0xa5, 0x35, 0x64, 0xbb, 0xee, 0xa7, 0xea, 0xb8, 0x9c,
-  0x61, 0x35, 0x9a, 0x01, 0x8d, 0x18, 0xb4, 0xc6, 0x54, 0x53, 0x20, 0xa5,
-  0xac, 0x46, 0x33, 0xa0, 0x71, 0x09, 0x9a, 0x01, 0xcd, 0xda, 0xef, 0xf5,
-  0x00, 0x2a, 0xd0, 0x9c, 0xab, 0x3b, 0x5d, 0xb8, 0xbf, 0x5d, 0xe7, 0x22,
-  0x9a, 0x71, 0xf1, 0xc1, 0x2f, 0xbe, 0xf8, 0xc0, 0xa5, 0xea, 0xc4, 0xed,
-  0x0a, 0x7a, 0xe2, 0x3e, 0xcb, 0xeb, 0x26, 0x3b, 0x70, 0x80, 0x6c, 0x75,
-  0x75, 0xcb, 0x01, 0xc6, 0x2b, 0x67, 0x9f, 0xec, 0x3f, 0xc9, 0x4d, 0xa8,
-  0xa7, 0x1d, 0x3d, 0x3f, 0x53, 0xd7, 0xdf, 0x1a, 0x87, 0x1b, 0xa2, 0x58,
-  0xe1, 0x08, 0x0c, 0x38, 0x7a, 0x52, 0xc8, 0x46, 0x81, 0x80, 0x94, 0x15,
-  0x40, 0x48, 0x24, 0x8a, 0xa8, 0xcb, 0x5b, 0x8a, 0x44, 0xd9, 0xab, 0x0e,
-  0x02, 0xef, 0x35, 0x29, 0x9a, 0x1a, 0x61, 0xcc, 0x25, 0x60, 0x34, 0x97,
-  0xe0, 0x43, 0x96, 0xa6, 0xdf, 0x9c, 0x0b, 0x95, 0xcd, 0xc8, 0x35, 0x72,
-  0x9f, 0xd6, 0x1d, 0x61, 0x84, 0xf5, 0x8c, 0x86, 0x28, 0x70, 0x49, 0x6b,
-  0x5c, 0x4d, 0xeb, 0x72, 0xc4, 0x9c, 0xa3, 0x58, 0xdd, 0xcf, 0x2b, 0x28,
-  0x21, 0x7f, 0xb3, 0x19, 0x09, 0x04, 0x0e, 0x47, 0x88, 0x2a, 0xe0, 0x8c,
-  0x16, 0xf7, 0x3a, 0xcb, 0xf5, 0xe8, 0xbb, 0xce, 0x56, 0x80, 0xd8, 0xf3,
-  0xa5, 0xa9, 0xd8, 0x14, 0xdf, 0xb6, 0xcb, 0x18, 0x88, 0x7d, 0x8c, 0x8b,
-  0xa3, 0x35, 0x75, 0x74, 0x17, 0xe3, 0xb1, 0x9a, 0xa4, 0xce, 0x87, 0xd1,
-  0xf9, 0x25, 0xba, 0x80, 0xce, 0x48, 0x67, 0x89, 0x9e, 0xe5, 0x02, 0xcb,
-  0x5c, 0x60, 0x5e, 0x6a, 0x04, 0x6b, 0x27, 0xb1, 0xdf, 0x72, 0xb9, 0x04,
-  0x2d, 0x96, 0x0b, 0x16, 0xd7, 0x4c, 0x75, 0x16, 0x58, 0x86, 0x58, 0x58,
-  0x17, 0x41, 0x18, 0x1d, 0xab, 0xfb, 0x28, 0xbd, 0x73, 0x7e, 0x4b, 0xef,
-  0xf4, 0xea, 0x81, 0x7e, 0x62, 0x61, 0x78, 0x4e, 0x4a, 0xac, 0x48, 0x79,
-  0x44, 0x72, 0x2b, 0x0f, 0xae, 0xcc, 0xa2, 0x5b, 0xeb, 0x2e, 0xda, 0x0c,
-  0x54, 0xbe, 0xf2, 0x81, 0xba, 0x31, 0x2c, 0x59, 0x0a, 0x16, 0xb1, 0xed,
-  0x81, 0xde, 0x26, 0x93, 0xc9, 0x68, 0x9e, 0x69, 0x75, 0xf7, 0xfc, 0xce,
-  0x74, 0x23, 0xef, 0xb9, 0xfd, 0x6d, 0x93, 0xf6, 0xcb, 0x40, 0xb9, 0xf4,
-  0xb7, 0x85, 0x4e, 0x62, 0xfd, 0x2d, 0x75, 0x8e, 0xfe, 0x05, 0x7e, 0xd8,
-  0xbf, 0x10, 0x84, 0x90, 0x9e, 0x2c, 0x3e, 0x00, 0xb7, 0xb1, 0xa4, 0x61,
-  0xa6, 0x3a, 0xbf, 0x4f, 0xb7, 0xd8, 0x8a, 0x20, 0x2c, 0x56, 0x09, 0xe7,
-  0xae, 0x24, 0x64, 0xee, 0xee, 0xf5, 0x3c, 0xc9, 0xf3, 0x14, 0x2a, 0x9b,
-  0x14, 0x55, 0x2d, 0x58, 0x8b, 0x14, 0x1a, 0x11, 0x15, 0x57, 0x59, 0x91,
-  0x04, 0xf2, 0x7b, 0x59, 0x3a, 0x5d, 0xcc, 0x2e, 0xd4, 0x4f, 0xe2, 0x17,
-  0xf4, 0x28, 0x51, 0x31, 0xf6, 0x51, 0xac, 0x6a, 0x05, 0xe2, 0x6d, 0x36,
-  0xf3, 0xdb, 0xc5, 0xe4, 0x76, 0xd1, 0x71, 0x9f, 0xbb, 0x05, 0x91, 0x48,
-  0x8f, 0xd5, 0x40, 0x64, 0xd5, 0xfb, 0x35, 0x28, 0xda, 0x95, 0xf8, 0xc4,
-  0xc0, 0x3f, 0x84, 0x3a, 0x73, 0xce, 0x55, 0x7c, 0xa3, 0xe7, 0xcb, 0xd8,
-  0xe1, 0xf1, 0x22, 0x24, 0x3b, 0x70, 0x8b, 0xf4, 0xf6, 0xb5, 0x9a, 0x37,
-  0xbb, 0xff, 0x35, 0x37, 0x55, 0xfb, 0xbb, 0x61, 0x50, 0xcc, 0x07, 0xaf,
-  0x90, 0x3f, 0x0a, 0xa9, 0xd8, 0x69, 0xf6, 0xbc, 0x89, 0x66, 0x08, 0x2d,
-  0xa3, 0x62, 0x88, 0xcf, 0x50, 0x59, 0xc6, 0xc1, 0x5d, 0xf2, 0x60, 0x63,
-  0xb7, 0x02, 0x88, 0xf3, 0xf5, 0x9f, 0xdc, 0xf9, 0xbc, 0xb8, 0x0b, 0x27,
-  0xfa, 0x57, 0xae, 0x91, 0x77, 0xed, 0x0d, 0xe9, 0xfb, 0xca, 0x5e, 0x3e,
-  0xa2, 0x61, 0xb3, 0x27, 0x1f, 0xdc, 0x92, 0xd3, 0x16, 0x9d, 0x93, 0x23,
-  0xe7, 0x0f, 0xad, 0xe2, 0x62, 0x39, 0x78, 0x39, 0x15, 0xf7, 0x40, 0xad,
-  0xce, 0x60, 0x5f, 0x6e, 0x62, 0x3d, 0x14, 0xb6, 0x37, 0x35, 0x91, 0xef,
-  0x3d, 0x61, 0x30, 0xab, 0x44, 0x36, 0x54, 0x58, 0x1e, 0x36, 0x71, 0x9b,
-  0x89, 0x9a, 0xeb, 0x49, 0xe1, 0xb2, 0x6f, 0x32, 0xed, 0x0e, 0xaf, 0x35,
-  0xcd, 0x6d, 0xe9, 0xc1, 0x8d, 0xa7, 0x90, 0xc8, 0xcb, 0x52, 0xa0, 0x6d,
-  0x04, 0x7a, 0xac, 0xa7, 0xb1, 0xce, 0x96, 0x86, 0xd3, 0xf9, 0xac, 0x22,
-  0x9d, 0x39, 0xd7, 0x5e, 0xfb, 0x88, 0x60, 0xd7, 0x22, 0xa6, 0x5e, 0x80,
-  0x71, 0x65, 0xc4, 0x74, 0x59, 0x9a, 0xf8, 0x21, 0xfd, 0xe9, 0xfc, 0x95,
-  0xd0, 0x9a, 0x83, 0x16, 0xee, 0x32, 0x1c, 0x3e, 0x32, 0x71, 0x90, 0x9b,
-  0xdc, 0xa5, 0xed, 0xd0, 0x08, 0x72, 0x97, 0xc1, 0x9b, 0xaa, 0xc3, 0x14,
-  0x0d, 0x97, 0xcf, 0x18, 0x56, 0xfe, 0x29, 0x8c, 0x77, 0xc9, 0x5c, 0xa6,
-  0x3f, 0x0a, 0x28, 0x7e, 0x0e, 0x25, 0xa0, 0xf9, 0xf8, 0x21, 0x96, 0x48,
-  0x42, 0xb6, 0x06, 0x12, 0xf2, 0x02, 0x47, 0x48, 0x35, 0x01, 0xf9, 0x23,
-  0x1a, 0x54, 0x2f, 0xd0, 0x42, 0x31, 0x70, 0xdb, 0xa0, 0x52, 0x3d, 0xc1,
-  0xb5, 0xe5, 0x90, 0xb9, 0xe8, 0x58, 0x44, 0x13, 0xd0, 0x42, 0x78, 0x64,
-  0x21, 0x37, 0x08, 0xff, 0xa8, 0x96, 0x83, 0x75, 0xaa, 0xcd, 0xa4, 0x79,
-  0xb5, 0xa0, 0xad, 0x4e, 0x30, 0xa8, 0xc2, 0x72, 0x55, 0xfc, 0x52, 0xff,
-  0xb0, 0x84, 0x31, 0xae, 0xd2, 0x7e, 0x35, 0xec, 0x62, 0xf9, 0x9a, 0x84,
-  0x59, 0x51, 0x01, 0x50, 0x6e, 0xb7, 0xcf, 0x13, 0xe3, 0x2d, 0xbd, 0x89,
-  0xa7, 0x9a, 0xd5, 0x35, 0x61, 0x6a, 0x65, 0xf7, 0xd5, 0x74, 0x23, 0x5a,
-  0x99, 0xd9, 0xf1, 0x18, 0xb1, 0x88, 0x81, 0xf3, 0x5d, 0xc5, 0x39, 0x4b,
-  0xb3, 0x48, 0xaf, 0x99, 0xf0, 0x37, 0x92, 0xf9, 0x50, 0x18, 0x19, 0x8b,
-  0x3e, 0xb6, 0x10, 0xe0, 0xae, 0xd6, 0x8c, 0x6e, 0xd3, 0xe8, 0x9b, 0xc3,
-  0xfa, 0xa7, 0x29, 0xbc, 0x6c, 0x88, 0x8f, 0x60, 0xa2, 0xc2, 0xfb, 0xf5,
-  0xb2, 0x10, 0xa9, 0x4c, 0xa1, 0x0e, 0xfd, 0xe9, 0x91, 0x33, 0xba, 0x4f,
-  0xb3, 0xf9, 0x6c, 0xa8, 0x4a, 0xd9, 0x98, 0x9b, 0x08, 0x04, 0x90, 0x7b,
-  0x8b, 0x02, 0x96, 0x9a, 0x3d, 0x38, 0xe7, 0x59, 0x72, 0xdf, 0xf9, 0x6a,
-  0x70, 0x57, 0x43, 0x21, 0x9b, 0x62, 0x44, 0xc4, 0x89, 0xce, 0x6f, 0x66,
-  0x4e, 0xbe, 0x5c, 0xbb, 0xe0, 0x5c, 0x5c, 0x7c, 0xda, 0x31, 0xac, 0xe8,
-  0x1d, 0xf2, 0x7e, 0x8d, 0x1c, 0xf5, 0x90, 0xd5, 0x4b, 0x8e, 0xb8, 0xad,
-  0x00, 0x94, 0x04, 0xf2, 0x7d, 0xde, 0x2b, 0x03, 0x2b, 0xeb, 0x1a, 0xfa,
-  0x2b, 0x3e, 0x02, 0x2b, 0xf9, 0xd0, 0x84, 0x3b, 0xfe, 0x46, 0x4e, 0x7d,
-  0xf6, 0x60, 0xdc, 0x01, 0x4c, 0xf5, 0x8a, 0x92, 0xd5, 0x2b, 0xea, 0x92,
-  0x03, 0x7e, 0x31, 0x54, 0x74, 0x6e, 0xae, 0x31, 0xe8, 0x62, 0x83, 0x03,
-  0x62, 0xf3, 0x5b, 0x52, 0x0b, 0x9a, 0x40, 0x43, 0xb4, 0xa2, 0x26, 0xb0,
-  0xf0, 0x7d, 0x85, 0x90, 0x95, 0xd4, 0xbe, 0x20, 0x20, 0xeb, 0x11, 0x16,
-  0xaa, 0x4c, 0x9c, 0x55, 0x63, 0xe1, 0x2e, 0xf2, 0x8b, 0x56, 0x5c, 0xc8,
-  0x26, 0xdd, 0x59, 0x42, 0xda, 0x44, 0x28, 0x40, 0x76, 0xd5, 0x63, 0xcd,
-  0x19, 0x1b, 0xb8, 0x08, 0x40, 0x3e, 0xea, 0x2f, 0x17, 0xe4, 0x26, 0x2e,
-  0x88, 0xbc, 0x9f, 0x4e, 0x2f, 0x01, 0x04, 0x66, 0x40, 0xdd, 0x55, 0x1c,
-  0x7a, 0xa2, 0x7c, 0xc2, 0x82, 0xf2, 0xaa, 0xb9, 0xfc, 0x05, 0xf8, 0x85,
-  0x50, 0x79, 0xa5, 0x17, 0x20, 0x0d, 0x1d, 0x1a, 0x2f, 0x06, 0x51, 0x10,
-  0x10, 0x54, 0xf0, 0xe4, 0x2e, 0x99, 0xaa, 0x79, 0x9a, 0x39, 0xcb, 0xd6,
-  0x94, 0xcb, 0x63, 0xf5, 0xce, 0xd2, 0x09, 0x36, 0x0d, 0x91, 0xf8, 0xa6,
-  0x21, 0x92, 0x7c, 0xd4, 0x10, 0x49, 0x96, 0x0d, 0x91, 0xf8, 0x33, 0x8a,
-  0x2f, 0x76, 0x27, 0xde, 0x6f, 0x96, 0x94, 0xea, 0x62, 0x44, 0xc5, 0x9f,
-  0xeb, 0x3e, 0x17, 0xe0, 0x0b, 0x0e, 0x61, 0x65, 0x2d, 0xd2, 0xe9, 0xc5,
-  0x28, 0x4f, 0xff, 0x89, 0x17, 0x51, 0xee, 0xdf, 0x92, 0xbc, 0x5d, 0x43,
-  0x20, 0x2a, 0xc4, 0x35, 0xad, 0x10, 0x37, 0xda, 0x11, 0x22, 0x2f, 0x58,
-  0xd5, 0x15, 0x13, 0x43, 0xdb, 0x28, 0x14, 0xda, 0x47, 0xa1, 0x6c, 0x6f,
-  0x85, 0x98, 0x60, 0xe3, 0xe2, 0x2b, 0xf4, 0xb6, 0x01, 0x8d, 0x2e, 0x9c,
-  0x00, 0x71, 0xb7, 0xee, 0xde, 0x7b, 0x3e, 0x23, 0x2a, 0x9a, 0x1b, 0xd1,
-  0x06, 0xd7, 0x64, 0xae, 0x65, 0xdb, 0xd6, 0x62, 0x0d, 0xa1, 0x4f, 0xd7,
-  0xd2, 0x6c, 0xa6, 0xa7, 0xf3, 0x44, 0x4d, 0x7e, 0x51, 0x9a, 0x21, 0x41,
-  0x82, 0x25, 0x12, 0x68, 0xba, 0xdf, 0xb6, 0x51, 0x12, 0x12, 0xbf, 0x1d,
-  0x73, 0x12, 0x91, 0xbb, 0x3e, 0xfd, 0xaf, 0x37, 0x72, 0x9b, 0x4c, 0x70,
-  0x30, 0x8b, 0x07, 0x81, 0x00, 0xc1, 0xdf, 0xc1, 0xe1, 0x7c, 0x3e, 0xdb,
-  0x04, 0x16, 0x28, 0x99, 0x97, 0xcb, 0xc2, 0x6d, 0x77, 0x8d, 0x4e, 0xdf,
-  0x94, 0xa2, 0xe9, 0xa6, 0x67, 0x2a, 0xd2, 0xe9, 0x78, 0x3c, 0xbc, 0x28,
-  0xd5, 0xac, 0x05, 0xbb, 0x8f, 0xfb, 0x39, 0x5e, 0x66, 0xa9, 0x2d, 0xcb,
-  0x81, 0x25, 0x18, 0x58, 0x0e, 0x10, 0xeb, 0x21, 0x6e, 0x1a, 0xff, 0x05,
-  0xb0, 0x0d, 0xf1, 0xb8, 0x78, 0xcb, 0xf5, 0xd0, 0x2f, 0x68, 0x92, 0xd0,
-  0x3a, 0x6f, 0x5b, 0xba, 0x22, 0xec, 0xb3, 0x42, 0xac, 0x5f, 0xdf, 0x44,
-  0x84, 0x22, 0x49, 0xd7, 0x05, 0x0a, 0xc5, 0x07, 0xac, 0x48, 0xcd, 0x24,
-  0xf3, 0x5f, 0x2f, 0x44, 0xc3, 0x0a, 0x6a, 0x5f, 0xae, 0xa6, 0x89, 0x51,
-  0x55, 0x3f, 0x73, 0xce, 0x2f, 0xb1, 0x47, 0xa5, 0x8b, 0xa4, 0x25, 0x1b,
-  0xf3, 0xc7, 0x64, 0x86, 0xca, 0xde, 0x63, 0x87, 0xcf, 0x9f, 0x6d, 0xde,
-  0x9b, 0xf1, 0x80, 0xdd, 0x18, 0xa9, 0xdc, 0xda, 0x5e, 0xee, 0xee, 0x44,
-  0x3e, 0x5a, 0x00, 0xe1, 0x26, 0x45, 0x70, 0xae, 0x4e, 0x9f, 0x59, 0x17,
-  0xfc, 0xba, 0x89, 0x0f, 0xec, 0x45, 0x92, 0xc0, 0xdd, 0xf5, 0x62, 0x07,
-  0xa0, 0x22, 0x4d, 0xd5, 0xc4, 0x39, 0x53, 0xd3, 0x79, 0x7e, 0xc3, 0x7b,
-  0xfd, 0xf1, 0xab, 0xf3, 0x69, 0x3a, 0x49, 0xa6, 0xba, 0x9f, 0x45, 0xcc,
-  0x34, 0x31, 0x1a, 0x15, 0x27, 0xb4, 0x32, 0x3d, 0x9b, 0xa7, 0xd9, 0x5d,
-  0xce, 0x24, 0xc8, 0x99, 0x78, 0x07, 0xcc, 0x87, 0x46, 0x68, 0x95, 0x10,
-  0x5d, 0xc1, 0x82, 0x64, 0x3f, 0xfb, 0xb5, 0xbd, 0xc0, 0xe4, 0xaa, 0x80,
-  0x80, 0x07, 0x41, 0xb5, 0xe0, 0x8f, 0x52, 0x6b, 0xc4, 0x7a, 0xf3, 0x6e,
-  0x7d, 0xa7, 0xef, 0x53, 0xed, 0xae, 0x48, 0xf2, 0x90, 0x16, 0xe3, 0x46,
-  0x0e, 0xcc, 0x30, 0xee, 0x93, 0xc7, 0x69, 0x87, 0x87, 0x6f, 0xde, 0x67,
-  0x95, 0xee, 0x26, 0x40, 0xac, 0x02, 0xcd, 0x62, 0x7b, 0x94, 0x93, 0x87,
-  0x38, 0xb9, 0x49, 0x9c, 0xa3, 0x7b, 0xfd, 0xb3, 0x8f, 0x39, 0x3a, 0x28,
-  0x8b, 0xa7, 0x4b, 0xd6, 0x54, 0x28, 0x98, 0xaf, 0x79, 0x31, 0xc2, 0x4a,
-  0xf5, 0xbc, 0xe5, 0x14, 0xba, 0x25, 0x9d, 0xe0, 0x89, 0x1e, 0x36, 0x75,
-  0xb0, 0x18, 0xdf, 0xe2, 0xe4, 0x6d, 0x73, 0x62, 0xb8, 0xb7, 0x0f, 0xf8,
-  0xbd, 0x8a, 0xe3, 0x89, 0xce, 0xbf, 0x71, 0xf5, 0xcd, 0x96, 0x13, 0x57,
-  0x7c, 0xf3, 0x25, 0xf7, 0xe2, 0x5b, 0x2c, 0xd7, 0x22, 0x5d, 0xc5, 0x64,
-  0x19, 0x53, 0xf5, 0x62, 0xb0, 0xd7, 0x01, 0xf5, 0x73, 0xc8, 0x4c, 0xe6,
-  0x94, 0x99, 0xb0, 0xd1, 0x3f, 0x64, 0xa2, 0x0e, 0xf3, 0x33, 0xaa, 0x20,
-  0xb3, 0xef, 0xb0, 0x2e, 0x36, 0x64, 0xc5, 0x06, 0xac, 0x7c, 0xc4, 0xd5,
-  0x7d, 0xc4, 0xd5, 0xab, 0x51, 0x5d, 0xde, 0xbc, 0x7b, 0x22, 0xb3, 0x5e,
-  0xd3, 0xac, 0x23, 0x4c, 0xd9, 0x06, 0xe9, 0x1a, 0x1e, 0x5b, 0xc2, 0xdb,
-  0x40, 0x15, 0x8f, 0xa0, 0xca, 0xc3, 0x43, 0xa5, 0xf6, 0xc0, 0xfc, 0x06,
-  0x0d, 0xa8, 0x6d, 0x7b, 0x70, 0x0e, 0xfe, 0xf5, 0x17, 0x73, 0x37, 0xfb,
-  0x77, 0x0a, 0x37, 0x17, 0x2e, 0xf0, 0xe8, 0xc2, 0x05, 0xca, 0x0b, 0x97,
-  0x5d, 0x8a, 0x54, 0xba, 0x72, 0xa8, 0xd2, 0x2e, 0x86, 0xe5, 0x8e, 0xbd,
-  0xca, 0xac, 0xcb, 0x65, 0x89, 0xcc, 0xd7, 0x8f, 0x1f, 0x48, 0xee, 0x72,
-  0x2f, 0xee, 0x0f, 0x49, 0x11, 0x26, 0x73, 0x99, 0xa4, 0x6c, 0xda, 0xd7,
-  0x5d, 0x52, 0x73, 0x6e, 0xf9, 0x56, 0x3e, 0x6d, 0xba, 0x45, 0xdd, 0x44,
-  0x3b, 0xa7, 0x9a, 0x44, 0x6e, 0xe5, 0xd8, 0xb3, 0x11, 0xb0, 0x98, 0xfe,
-  0xa6, 0xf7, 0x3f, 0x4d, 0xae, 0xc0, 0x3c, 0x22, 0xa4, 0xa8, 0x6d, 0x2a,
-  0x8c, 0x34, 0x5a, 0x6f, 0xbc, 0xf3, 0x92, 0x00, 0xd6, 0xb3, 0xc8, 0x36,
-  0x42, 0xc2, 0x5a, 0x48, 0x7f, 0x23, 0x63, 0x50, 0x8a, 0x88, 0x74, 0xda,
-  0x1a, 0xd7, 0xcd, 0x72, 0xb3, 0x88, 0xb5, 0x7e, 0x19, 0x69, 0xbd, 0x28,
-  0x3c, 0xf4, 0x6d, 0x44, 0x2c, 0x42, 0x57, 0xaf, 0x6b, 0x1e, 0x99, 0xb5,
-  0x90, 0x6e, 0xbd, 0x90, 0x3b, 0xcd, 0x05, 0x9a, 0x9a, 0xaa, 0x17, 0x15,
-  0x98, 0x5e, 0x33, 0xc5, 0xe4, 0x9a, 0x69, 0x75, 0x9f, 0xe2, 0x70, 0xe7,
-  0x6a, 0x91, 0x85, 0x69, 0xaf, 0x5f, 0x21, 0x58, 0xf5, 0x99, 0xe0, 0x31,
-  0xf0, 0x1d, 0x46, 0xa3, 0x24, 0x73, 0xce, 0x3b, 0x5c, 0x33, 0xd0, 0xdc,
-  0xff, 0xa0, 0x58, 0x64, 0x08, 0xd2, 0x80, 0xe5, 0x47, 0x61, 0xd0, 0xdf,
-  0x6e, 0x23, 0x3c, 0xb0, 0xe0, 0xc3, 0x62, 0x60, 0xd5, 0x7c, 0x44, 0xaf,
-  0x8e, 0xb1, 0x04, 0x8b, 0x88, 0x41, 0x18, 0xb0, 0xf4, 0x79, 0x35, 0xa1,
-  0x02, 0xb7, 0x0a, 0xcb, 0xfb, 0x2b, 0xee, 0xb0, 0x7f, 0x02, 0x3b, 0x60,
-  0x1b, 0x7e, 0xd9, 0x3d, 0x4a, 0x22, 0x02, 0xbd, 0xaa, 0x29, 0xdf, 0xb5,
-  0x39, 0xb3, 0x79, 0x45, 0xe7, 0x4d, 0xaf, 0xbb, 0xcf, 0x44, 0xd9, 0x25,
-  0xcf, 0x40, 0x5c, 0x54, 0x50, 0x23, 0x22, 0xec, 0x2a, 0x4e, 0xfe, 0xbb,
-  0x8d, 0x4f, 0x10, 0xcd, 0x17, 0x54, 0x73, 0xdd, 0x68, 0x6f, 0x48, 0x84,
-  0x27, 0x97, 0x5f, 0x2e, 0xba, 0x71, 0x85, 0xe0, 0xe9, 0x7d, 0x9f, 0x7a,
-  0x2e, 0x90, 0xce, 0xf1, 0x28, 0xa0, 0x12, 0x49, 0xf1, 0x4a, 0xd0, 0x82,
-  0x3c, 0x17, 0xd6, 0xdf, 0xb7, 0x82, 0x5c, 0x26, 0x8d, 0x81, 0x89, 0xbc,
-  0x93, 0xc9, 0xf9, 0x15, 0x80, 0x70, 0x00, 0xd7, 0x3d, 0x07, 0xa1, 0xea,
-  0xcc, 0x16, 0x6c, 0xce, 0x33, 0xfe, 0xe6, 0xcc, 0x46, 0x61, 0x50, 0xe9,
-  0x76, 0x8f, 0x5f, 0xcc, 0xc2, 0x51, 0x47, 0x81, 0x48, 0x87, 0x9a, 0x32,
-  0xe7, 0x24, 0xf9, 0xae, 0xfa, 0xdd, 0x4b, 0x57, 0xf9, 0x92, 0xc6, 0x17,
-  0xe6, 0x69, 0x96, 0xbf, 0xf3, 0xf8, 0xa3, 0x7f, 0xed, 0xdf, 0xa2, 0xa0,
-  0xd0, 0x92, 0x31, 0x48, 0xb2, 0x4f, 0x1e, 0x23, 0xc0, 0xf5, 0x59, 0x9f,
-  0x4c, 0x23, 0x89, 0x96, 0x06, 0x34, 0x5a, 0xaa, 0xa7, 0xc9, 0x62, 0xd6,
-  0x5f, 0x20, 0x1c, 0xc3, 0x2a, 0x20, 0xce, 0x85, 0xfa, 0x39, 0x4e, 0x32,
-  0xed, 0x7c, 0x98, 0xa8, 0x7f, 0x6b, 0x87, 0xf7, 0x09, 0x10, 0xe9, 0xf0,
-  0x04, 0xb8, 0x17, 0xd0, 0x79, 0xa6, 0xa6, 0x71, 0xa2, 0x66, 0x0e, 0xb2,
-  0xfe, 0x41, 0x92, 0x51, 0x11, 0xdd, 0xe5, 0x9c, 0x9b, 0x20, 0x9d, 0x11,
-  0x48, 0x5f, 0x0f, 0x4d, 0xc9, 0xa5, 0x94, 0x1a, 0xde, 0xab, 0x8b, 0xb6,
-  0x19, 0xff, 0xf6, 0xef, 0x70, 0x84, 0x40, 0x36, 0xef, 0xf3, 0xd3, 0x00,
-  0x02, 0xe7, 0xb3, 0x8e, 0xd2, 0x64, 0xd2, 0xb5, 0x5e, 0xba, 0xed, 0x93,
-  0xdc, 0xc7, 0xab, 0x16, 0x0a, 0x11, 0xf3, 0x49, 0x64, 0x2d, 0x49, 0xe7,
-  0x3a, 0xfa, 0x66, 0xa8, 0x87, 0xee, 0x65, 0x54, 0x89, 0x20, 0x63, 0x18,
-  0x61, 0x35, 0xb2, 0x11, 0x3f, 0x24, 0xaa, 0xce, 0x02, 0xe2, 0x03, 0xa0,
-  0x9a, 0x45, 0xc7, 0x0d, 0x8b, 0xee, 0xeb, 0x35, 0xa3, 0x0b, 0x6f, 0x80,
-  0x25, 0xcc, 0xb0, 0x06, 0x58, 0xb4, 0x81, 0x9b, 0x1b, 0x12, 0x58, 0x97,
-  0xce, 0xf5, 0xc7, 0x93, 0xbe, 0x3c, 0xd7, 0x4c, 0x2f, 0x13, 0x63, 0x81,
-  0x3e, 0xc1, 0x71, 0xe2, 0xfc, 0x95, 0x4c, 0xfb, 0xc6, 0x23, 0x72, 0x59,
-  0xd9, 0x37, 0x29, 0x24, 0x3c, 0xae, 0x7b, 0xc3, 0x82, 0x56, 0x4f, 0xfb,
-  0x34, 0x52, 0x97, 0xa9, 0xef, 0xc9, 0xcc, 0x39, 0xd1, 0xf9, 0x33, 0xcc,
-  0x0f, 0x3a, 0x73, 0xae, 0x92, 0xc9, 0xfc, 0x1f, 0xef, 0x8a, 0x11, 0xe7,
-  0x22, 0x17, 0xdf, 0x0f, 0x05, 0x97, 0xf7, 0xeb, 0x7f, 0xf7, 0x97, 0xdf,
-  0xc5, 0xbf, 0x3f, 0x2e, 0x4b, 0x68, 0x9c, 0xf4, 0x63, 0x0e, 0x58, 0x91,
-  0xc8, 0x43, 0x8d, 0x60, 0xb2, 0x5a, 0xb0, 0x47, 0xd5, 0xe1, 0x97, 0x59,
-  0xc5, 0xb5, 0x72, 0x8b, 0x01, 0x13, 0x8b, 0x58, 0x5b, 0x04, 0xde, 0xb0,
-  0x5b, 0xba, 0xbf, 0x12, 0x0c, 0xab, 0x05, 0xcb, 0x43, 0x86, 0x97, 0x2a,
-  0x7e, 0xa2, 0x54, 0xbc, 0x94, 0x4a, 0xfc, 0x22, 0xa9, 0xe8, 0xfd, 0xbf,
-  0x8b, 0x54, 0x2a, 0xad, 0xa7, 0x47, 0xb3, 0x44, 0x75, 0xb5, 0x49, 0xa0,
-  0x6c, 0xdc, 0x24, 0x90, 0x5e, 0xc5, 0xb9, 0x3b, 0x17, 0xdb, 0x57, 0x4c,
-  0xf5, 0xeb, 0xca, 0x96, 0xa4, 0x70, 0xd1, 0xc4, 0xf1, 0xdf, 0xd4, 0x9d,
-  0x72, 0x46, 0x51, 0x9a, 0xdd, 0xab, 0xb8, 0x8f, 0x19, 0x22, 0xf4, 0x0e,
-  0x4e, 0x04, 0x00, 0x04, 0xd0, 0x7c, 0xb6, 0x98, 0x6a, 0xe7, 0x22, 0xf9,
-  0xb6, 0x70, 0x46, 0xb7, 0xe9, 0xd0, 0x45, 0x71, 0xcd, 0x0c, 0x01, 0xfc,
-  0xe2, 0x43, 0x23, 0x61, 0xf6, 0x3d, 0x99, 0x3b, 0xbf, 0x7d, 0x75, 0xce,
-  0x5d, 0xa0, 0xc6, 0xe7, 0xe5, 0xf6, 0x07, 0x62, 0x35, 0xcc, 0x3a, 0x00,
-  0x11, 0xd5, 0x81, 0xd3, 0xeb, 0x2b, 0xb3, 0x7b, 0xd3, 0xb5, 0x6b, 0xe9,
-  0x7a, 0x07, 0x87, 0x3c, 0x40, 0xe3, 0xbb, 0xc4, 0x66, 0x24, 0xf3, 0xbc,
-  0xf9, 0xfb, 0x69, 0x5c, 0xbc, 0x07, 0x44, 0x5e, 0x5f, 0x39, 0xfc, 0x4a,
-  0x90, 0x64, 0x8b, 0xa9, 0x6b, 0xfb, 0xee, 0x36, 0xac, 0x85, 0xe6, 0xab,
-  0x78, 0x8c, 0x0b, 0x72, 0x5b, 0xce, 0xdf, 0x4f, 0x9c, 0xeb, 0x03, 0x66,
-  0x6b, 0xb0, 0x0e, 0x65, 0x6b, 0xd0, 0x25, 0xa1, 0xe8, 0x92, 0x48, 0xb3,
-  0xc4, 0x39, 0xf9, 0x74, 0xf4, 0xdc, 0xf5, 0x81, 0xcd, 0x4b, 0x45, 0x5b,
-  0xbc, 0x9b, 0x46, 0xa5, 0xf6, 0x65, 0x95, 0xd4, 0xcb, 0xea, 0xc8, 0x64,
-  0x7a, 0xe3, 0x1c, 0xa7, 0x77, 0x77, 0x6a, 0xf9, 0x50, 0x04, 0x03, 0x74,
-  0xf3, 0x8d, 0x61, 0xd8, 0x41, 0x01, 0x98, 0x2d, 0xb4, 0x83, 0xd3, 0x7a,
-  0x7e, 0x97, 0x9b, 0x8a, 0x1a, 0xdb, 0x8a, 0x4a, 0xcf, 0x14, 0x87, 0x17,
-  0xb7, 0xa1, 0x3a, 0x3c, 0xdf, 0xfc, 0xcb, 0xb1, 0x25, 0x14, 0x51, 0xac,
-  0x98, 0x7e, 0x40, 0xd1, 0x0d, 0xa0, 0x88, 0xe7, 0x87, 0xd2, 0x38, 0xd3,
-  0xe1, 0x30, 0xa9, 0x0d, 0xc4, 0xbc, 0x0a, 0x4b, 0x28, 0xb2, 0x9f, 0x6f,
-  0x32, 0x12, 0x15, 0x42, 0x3b, 0x5a, 0x87, 0x59, 0x55, 0x5d, 0xa5, 0xe4,
-  0xbb, 0x96, 0x94, 0xae, 0xc3, 0xf4, 0xa7, 0xc3, 0x5d, 0xe8, 0x4d, 0xd8,
-  0x92, 0x80, 0x0a, 0x55, 0x7b, 0x50, 0x5d, 0x7d, 0x1d, 0x97, 0xa8, 0x8c,
-  0xbf, 0x97, 0x44, 0x91, 0x80, 0x7b, 0x97, 0x4c, 0x13, 0x47, 0x38, 0xff,
-  0x71, 0x39, 0xe2, 0xff, 0x69, 0xee, 0x84, 0xf9, 0x62, 0x7e, 0x8b, 0xdf,
-  0x6c, 0x91, 0x78, 0x8d, 0x24, 0x16, 0xff, 0xd9, 0x79, 0x4f, 0x0d, 0xc1,
-  0x24, 0x71, 0xa1, 0x50, 0xfd, 0x35, 0x98, 0x9c, 0xed, 0x27, 0xe3, 0xf0,
-  0xbf, 0xfa, 0x0b, 0x27, 0x82, 0x1a, 0x38, 0xa2, 0xaf, 0xdb, 0x07, 0xc4,
-  0x35, 0x64, 0x4e, 0xaf, 0x59, 0x7f, 0x2b, 0x39, 0xb8, 0x07, 0xb8, 0x97,
-  0xce, 0x45, 0x32, 0x4d, 0x36, 0x55, 0xa7, 0xdd, 0xd8, 0x50, 0x69, 0x87,
-  0x4f, 0x73, 0x0c, 0x1d, 0x00, 0x6a, 0xa5, 0x77, 0x78, 0xe7, 0x02, 0x86,
-  0x54, 0x4e, 0x86, 0x35, 0x72, 0x7e, 0xed, 0xb1, 0x23, 0xce, 0xbc, 0x5a,
-  0x38, 0x9d, 0xf7, 0x2a, 0x54, 0xa5, 0xa2, 0xe7, 0xcf, 0x47, 0x39, 0x57,
-  0x47, 0xc7, 0xe2, 0x2d, 0x15, 0x2d, 0x20, 0x6f, 0x46, 0x46, 0x56, 0x90,
-  0x29, 0xee, 0xd0, 0x2e, 0xb3, 0xf4, 0x7f, 0x75, 0x34, 0x5f, 0xd6, 0xbb,
-  0x38, 0xd7, 0xce, 0x6f, 0x27, 0x79, 0xc4, 0x63, 0xeb, 0x46, 0x6d, 0x38,
-  0xeb, 0x2b, 0x77, 0xc0, 0xd7, 0x22, 0xda, 0x06, 0x58, 0xb1, 0xfd, 0x16,
-  0xbb, 0xce, 0xd6, 0x75, 0xee, 0xd9, 0x55, 0x7b, 0x5a, 0x5d, 0x65, 0x24,
-  0x2b, 0x83, 0x6f, 0x79, 0xfa, 0xcb, 0x70, 0x8b, 0x41, 0x5a, 0xfa, 0x12,
-  0x3c, 0x65, 0x3b, 0x8d, 0x01, 0x92, 0x88, 0x4d, 0x90, 0x8e, 0x06, 0x3c,
-  0x00, 0xdc, 0x07, 0xac, 0xc0, 0x73, 0xec, 0x9c, 0x4e, 0x6f, 0x92, 0xa9,
-  0x2e, 0x0c, 0xd2, 0x21, 0x2d, 0x77, 0x39, 0x4a, 0x8b, 0xb1, 0x05, 0xac,
-  0x72, 0xea, 0xd2, 0x6f, 0xdf, 0xf4, 0xd4, 0xb9, 0x4a, 0x17, 0xd9, 0x54,
-  0xdd, 0xe9, 0xe9, 0xdc, 0x39, 0xb9, 0x3e, 0xc8, 0xd5, 0xd5, 0x0b, 0xdd,
-  0xcf, 0xf1, 0x8a, 0x09, 0x20, 0xfb, 0xa5, 0xf3, 0x47, 0xfe, 0x4b, 0xbd,
-  0xca, 0x09, 0x23, 0x94, 0xb0, 0xf2, 0x18, 0xf3, 0x59, 0xab, 0x89, 0x73,
-  0x94, 0x45, 0x2a, 0x2e, 0x3a, 0xea, 0xbf, 0xdc, 0xae, 0x60, 0xbf, 0x7e,
-  0xdb, 0xa8, 0x8a, 0x6b, 0x05, 0xe1, 0xb2, 0xbf, 0x07, 0x3a, 0x11, 0x5a,
-  0x11, 0xea, 0x71, 0xb4, 0xd0, 0x55, 0x36, 0x84, 0x44, 0x3f, 0xdb, 0x35,
-  0x10, 0x54, 0xa1, 0x25, 0xaa, 0xc1, 0x8b, 0xf0, 0x07, 0xad, 0xb2, 0x46,
-  0x35, 0x68, 0x95, 0xf5, 0x02, 0x1c, 0x5b, 0xa1, 0x72, 0xbe, 0xfe, 0x71,
-  0xdd, 0xf1, 0x30, 0x56, 0x0b, 0x48, 0x1e, 0xd8, 0x43, 0x7a, 0xd3, 0xde,
-  0x11, 0x8f, 0x6d, 0x40, 0xfc, 0x79, 0xf0, 0x70, 0x37, 0xc2, 0x63, 0xe1,
-  0xe9, 0x3b, 0x22, 0xd8, 0x54, 0x57, 0xdc, 0xe7, 0x5b, 0x4f, 0x4a, 0x5b,
-  0x11, 0x12, 0x6f, 0x37, 0x8b, 0x22, 0xb2, 0x01, 0x70, 0xd9, 0xdb, 0x0b,
-  0x53, 0x65, 0xb5, 0x8d, 0x8f, 0xfa, 0xeb, 0x3d, 0xc7, 0xbe, 0x15, 0x20,
-  0x73, 0x57, 0xf4, 0x10, 0xd9, 0xa6, 0x41, 0x31, 0x7f, 0xd4, 0xa0, 0x58,
-  0x98, 0x3a, 0x7a, 0x05, 0x8f, 0xe1, 0x78, 0x8d, 0x5b, 0x34, 0x23, 0x6c,
-  0xc1, 0xf1, 0xed, 0x3b, 0x6f, 0x37, 0xbd, 0x4f, 0x66, 0xcc, 0x86, 0xcd,
-  0xd7, 0xde, 0x64, 0xd3, 0x86, 0x56, 0x38, 0xc4, 0x70, 0x95, 0x04, 0x20,
-  0xa3, 0xde, 0xb0, 0x6a, 0xbf, 0x89, 0x8f, 0xad, 0x58, 0xfd, 0xf6, 0x4b,
-  0xad, 0xb4, 0x62, 0x6d, 0x11, 0x99, 0xb7, 0xb1, 0xe6, 0x88, 0xd0, 0x6e,
-  0xe9, 0x5d, 0xbf, 0xad, 0xba, 0x20, 0xf2, 0x60, 0x1a, 0xb0, 0xb1, 0x7c,
-  0x12, 0x04, 0xef, 0x35, 0x3d, 0xa4, 0x47, 0x4c, 0x4b, 0xf3, 0x5d, 0x29,
-  0xa8, 0x32, 0x2d, 0x79, 0xe6, 0x43, 0x71, 0x65, 0x30, 0xc4, 0x23, 0xa2,
-  0xa0, 0x12, 0x90, 0x4a, 0xbe, 0xa5, 0xfd, 0x7c, 0x77, 0x8e, 0xf0, 0x71,
-  0x45, 0x05, 0x9f, 0xe5, 0x93, 0x05, 0x57, 0x3d, 0x0e, 0xb4, 0x23, 0x37,
-  0x51, 0xe9, 0x71, 0x6c, 0x5d, 0x4a, 0x03, 0x14, 0xe1, 0x9c, 0x5d, 0x8e,
-  0x06, 0x63, 0x03, 0xe0, 0x6a, 0x23, 0xa1, 0xa1, 0x32, 0xb5, 0x20, 0xe4,
-  0xee, 0x21, 0x24, 0x06, 0x1d, 0x02, 0x10, 0xcc, 0x40, 0xe8, 0xa8, 0x47,
-  0x96, 0x87, 0x3a, 0x7b, 0x38, 0x96, 0x95, 0x4c, 0x4e, 0xaf, 0xaf, 0x58,
-  0x8f, 0xba, 0x42, 0x10, 0x55, 0xd1, 0x06, 0x73, 0x53, 0x64, 0xb5, 0x0c,
-  0x47, 0x6f, 0x00, 0x88, 0xd0, 0x80, 0x68, 0x78, 0x58, 0xdf, 0x0e, 0xe0,
-  0xd8, 0x6d, 0x0e, 0xb0, 0x3f, 0xfd, 0x9b, 0xe9, 0xee, 0xe6, 0x19, 0x60,
-  0x7d, 0x9a, 0xea, 0x67, 0x35, 0x53, 0x41, 0xdb, 0x70, 0x05, 0x3c, 0x5f,
-  0xd4, 0x3d, 0x8e, 0x0c, 0x50, 0x0a, 0xc5, 0xe9, 0xdb, 0x65, 0x04, 0x13,
-  0xac, 0x30, 0xdb, 0x21, 0x23, 0x58, 0x1e, 0xee, 0x75, 0xf6, 0x2d, 0x99,
-  0x3a, 0x47, 0xf1, 0x5d, 0x92, 0xa9, 0x89, 0xf3, 0xa7, 0xbb, 0x95, 0x54,
-  0xfe, 0x6e, 0xf5, 0xd3, 0x21, 0xe2, 0xea, 0xfb, 0x61, 0x69, 0x1a, 0xde,
-  0x97, 0xff, 0xee, 0x2f, 0x3f, 0x8b, 0x7f, 0x66, 0xf4, 0x3d, 0xbd, 0x43,
-  0xc5, 0x3b, 0x84, 0x0d, 0xc2, 0x72, 0xf1, 0x58, 0x60, 0x18, 0x8f, 0x21,
-  0xac, 0xc6, 0x90, 0x8b, 0x4f, 0x1f, 0x07, 0x64, 0xed, 0x85, 0x69, 0x6e,
-  0x3b, 0xcc, 0xc6, 0xc1, 0xe6, 0x0d, 0x44, 0x1d, 0xc8, 0x4a, 0xf9, 0xc8,
-  0xf4, 0x1e, 0x5a, 0x54, 0xaf, 0x71, 0x4f, 0x40, 0x73, 0xd3, 0x3f, 0xcb,
-  0xa9, 0x74, 0x15, 0xf7, 0xab, 0x45, 0xbd, 0xca, 0xd2, 0xf4, 0xbe, 0xf2,
-  0x69, 0x62, 0x41, 0x86, 0x6d, 0xb1, 0x42, 0xd7, 0xf8, 0xe5, 0xfe, 0xc6,
-  0x59, 0xc5, 0x7d, 0x39, 0x75, 0x91, 0x92, 0x0f, 0x8b, 0xf1, 0x58, 0x4d,
-  0x52, 0xe7, 0xe8, 0x18, 0x58, 0x19, 0x2a, 0x5c, 0x3f, 0x9c, 0x4b, 0x87,
-  0x17, 0xbc, 0x6c, 0x4f, 0xfd, 0xba, 0x27, 0xf7, 0x8d, 0x7e, 0x52, 0x51,
-  0x8e, 0x9e, 0xe3, 0x7d, 0xb0, 0xe4, 0x34, 0x36, 0x71, 0xfa, 0x30, 0x3a,
-  0xbf, 0x44, 0x06, 0xc2, 0x19, 0xe9, 0x2c, 0xd1, 0xb3, 0x67, 0x6d, 0x64,
-  0x89, 0xd0, 0xb6, 0x93, 0x25, 0x45, 0x24, 0x5b, 0xf4, 0x63, 0x26, 0x88,
-  0x10, 0xea, 0x10, 0x5d, 0xf6, 0x96, 0x91, 0x8c, 0x40, 0xad, 0xfa, 0xbb,
-  0xca, 0x6d, 0x46, 0x27, 0x59, 0x9a, 0xc4, 0xc7, 0xe9, 0xf4, 0xf0, 0xd9,
-  0xdd, 0xcd, 0xf3, 0xb9, 0x1b, 0x27, 0x70, 0x17, 0xeb, 0xc7, 0xdd, 0x23,
-  0xb8, 0x1b, 0xb8, 0xa2, 0xfc, 0x5b, 0x2d, 0x78, 0xaf, 0xa3, 0xcc, 0x12,
-  0x57, 0xe6, 0x85, 0x71, 0xb2, 0x76, 0xce, 0xbf, 0x9c, 0x7f, 0x59, 0x76,
-  0xfb, 0x8d, 0xd2, 0x4c, 0xb7, 0xc3, 0x80, 0x7b, 0x12, 0x94, 0x78, 0x3d,
-  0x05, 0x20, 0x62, 0xb3, 0x3d, 0xf2, 0x84, 0xb2, 0x48, 0x48, 0x43, 0x41,
-  0x1e, 0xb1, 0xfd, 0x78, 0x77, 0xaf, 0xa2, 0x79, 0xfe, 0xcc, 0x4f, 0xc5,
-  0xf3, 0xeb, 0x7e, 0x93, 0x79, 0x93, 0xf5, 0x23, 0x76, 0xdb, 0x3e, 0x29,
-  0x52, 0xfb, 0x9e, 0xba, 0xbb, 0x6a, 0x68, 0xcc, 0x04, 0xe0, 0xb6, 0x9c,
-  0xd3, 0xff, 0x5d, 0xe4, 0xbf, 0xab, 0x37, 0x65, 0xc4, 0xf4, 0x2d, 0x88,
-  0xee, 0x95, 0x14, 0x93, 0xb7, 0x9c, 0x24, 0x72, 0x20, 0x42, 0xcf, 0x75,
-  0x76, 0x14, 0xcd, 0x9d, 0xa3, 0x28, 0xef, 0xb6, 0x79, 0x59, 0xb4, 0xe9,
-  0x85, 0x03, 0x75, 0x54, 0x25, 0x86, 0xcc, 0xab, 0x93, 0x6a, 0x33, 0x95,
-  0x56, 0x25, 0x26, 0x7a, 0x5c, 0x48, 0x05, 0x1c, 0x4c, 0x52, 0xfd, 0x4c,
-  0x66, 0xb9, 0x4c, 0x54, 0x6d, 0x11, 0x0e, 0x7d, 0x12, 0x6b, 0x61, 0x9d,
-  0x82, 0x26, 0x4a, 0x8e, 0x68, 0xa5, 0xe5, 0xe3, 0x78, 0x85, 0x86, 0xf1,
-  0x37, 0x87, 0x86, 0xee, 0x6b, 0x4f, 0x45, 0x03, 0x55, 0x68, 0x72, 0x53,
-  0x77, 0x9e, 0x16, 0x60, 0x72, 0x26, 0xbb, 0x7e, 0xbc, 0xdb, 0xdc, 0xd7,
-  0xa5, 0x5e, 0x49, 0xa3, 0x71, 0xf2, 0x00, 0x58, 0xf5, 0x14, 0xfe, 0xa6,
-  0xee, 0xee, 0x74, 0x76, 0xab, 0xb7, 0x06, 0x7b, 0x38, 0x77, 0x8c, 0x11,
-  0x37, 0x64, 0x9f, 0xef, 0x55, 0x95, 0x10, 0x51, 0x4e, 0x0b, 0x34, 0x12,
-  0x97, 0x29, 0xe6, 0xd6, 0x89, 0xeb, 0x9c, 0x5d, 0x6f, 0x24, 0xee, 0x92,
-  0xd3, 0x65, 0x4f, 0x61, 0x6c, 0x4d, 0x41, 0xe4, 0x14, 0x64, 0x97, 0x28,
-  0x98, 0xdf, 0x32, 0x25, 0x14, 0x24, 0x37, 0xa9, 0xfe, 0x65, 0x96, 0x5e,
-  0xb6, 0x50, 0xfb, 0x5f, 0xbe, 0xa4, 0xc9, 0x8b, 0xef, 0x11, 0x95, 0xeb,
-  0x5e, 0xdf, 0x28, 0x73, 0x9c, 0xb9, 0xfd, 0xbc, 0xfa, 0xb4, 0x60, 0xb4,
-  0xa1, 0x59, 0x0e, 0xf6, 0x17, 0x8c, 0x7a, 0x87, 0x78, 0xba, 0x3b, 0xc0,
-  0x22, 0xb0, 0xc4, 0x40, 0x54, 0xc0, 0xb9, 0x3c, 0x0f, 0x80, 0xf1, 0x7e,
-  0xbd, 0xfc, 0x4e, 0xc0, 0x70, 0x23, 0x18, 0xdf, 0x5b, 0xc7, 0x4d, 0xdf,
-  0x29, 0xb9, 0x0e, 0x96, 0xbe, 0x57, 0xa2, 0xcb, 0xc0, 0x9a, 0x61, 0xf2,
-  0xf4, 0x6a, 0x5f, 0x77, 0x49, 0xf4, 0xf9, 0xf7, 0xf4, 0xe1, 0x7d, 0x7e,
-  0x5a, 0xfd, 0x8f, 0x3f, 0xfe, 0xb3, 0xf9, 0x3b, 0x39, 0x94, 0x1e, 0xaf,
-  0x39, 0xf0, 0x98, 0x02, 0xc6, 0x3e, 0x89, 0xa0, 0xd7, 0xc8, 0xe0, 0x99,
-  0x64, 0xf8, 0xdc, 0x56, 0x86, 0xda, 0xcb, 0xbb, 0x3d, 0x41, 0x6f, 0x2b,
-  0x19, 0x98, 0x2c, 0xbb, 0x5b, 0xa0, 0x47, 0x65, 0xb8, 0x57, 0xf1, 0x3a,
-  0x1a, 0x4c, 0x23, 0x49, 0x41, 0x4d, 0x9b, 0xad, 0xe6, 0x5b, 0x91, 0xbb,
-  0x86, 0x6f, 0x15, 0xe9, 0x09, 0x63, 0x2c, 0xa8, 0xf3, 0x08, 0x2a, 0x07,
-  0x3e, 0xb9, 0xbf, 0x55, 0xf9, 0x23, 0x1d, 0xd1, 0xb7, 0xfe, 0x85, 0x3b,
-  0xc6, 0x63, 0xc4, 0xa2, 0xfb, 0x1a, 0xe7, 0xdb, 0x70, 0x2e, 0x4f, 0x9c,
-  0xb3, 0xb3, 0x0f, 0xdd, 0x7e, 0xcc, 0x8e, 0x9c, 0xb1, 0xa4, 0x95, 0xbe,
-  0x30, 0xc1, 0xaa, 0xfb, 0xb4, 0xff, 0xfe, 0xdf, 0x23, 0xa2, 0xe5, 0xfd,
-  0x7a, 0x89, 0x94, 0xf0, 0xf1, 0xd5, 0x7e, 0x3e, 0xd8, 0xdc, 0x8d, 0x6f,
-  0xff, 0xfe, 0xc5, 0xe1, 0xf7, 0xf1, 0xfa, 0x37, 0xd7, 0x05, 0x16, 0x7f,
-  0xc1, 0x67, 0x5b, 0x3c, 0xfe, 0x75, 0x74, 0x72, 0xda, 0xbf, 0x0c, 0x28,
-  0x9f, 0xad, 0x30, 0xa0, 0x0f, 0xdb, 0x38, 0x74, 0x92, 0x92, 0x83, 0xcd,
-  0x6e, 0xa0, 0x91, 0x35, 0x0e, 0x86, 0xba, 0xf5, 0x21, 0x34, 0xb4, 0xb8,
-  0xf5, 0x04, 0x06, 0x64, 0xb8, 0xc9, 0xf4, 0xe6, 0xad, 0xbd, 0x19, 0x4b,
-  0x0b, 0x38, 0xec, 0xf7, 0x4e, 0xd4, 0xdb, 0x74, 0xfe, 0xd0, 0x2a, 0xd6,
-  0xd9, 0xec, 0x36, 0xb9, 0xef, 0xec, 0xd5, 0x51, 0xe3, 0xd7, 0xab, 0x69,
-  0xa8, 0x19, 0x10, 0xf8, 0x36, 0x94, 0xf4, 0x26, 0x89, 0x78, 0x9f, 0xd2,
-  0x43, 0x08, 0x0e, 0x31, 0xe0, 0x28, 0x5e, 0x56, 0x24, 0x09, 0xf9, 0x04,
-  0x47, 0xeb, 0xe5, 0xf2, 0xfc, 0x25, 0x96, 0x0d, 0x57, 0x44, 0x5c, 0x4c,
-  0x7d, 0x8c, 0x91, 0xda, 0x91, 0x79, 0xae, 0xf3, 0x5c, 0xbb, 0xdb, 0x64,
-  0x32, 0x19, 0xcd, 0x33, 0xad, 0xee, 0xfa, 0xe4, 0x64, 0x13, 0x3c, 0xcc,
-  0x88, 0x27, 0xcd, 0xe2, 0x89, 0x9e, 0xcd, 0x9c, 0xcb, 0x4c, 0x47, 0xc9,
-  0x2c, 0x49, 0xa7, 0xbd, 0x4c, 0xbd, 0x27, 0xbc, 0x10, 0x23, 0x56, 0xc3,
-  0xeb, 0xaf, 0x64, 0x7a, 0x73, 0xa7, 0xa6, 0x07, 0x4d, 0xe0, 0xa4, 0x35,
-  0xde, 0x92, 0x20, 0x6a, 0x5c, 0xe3, 0xcd, 0x6c, 0xc2, 0x6a, 0x39, 0x19,
-  0x61, 0x03, 0xc5, 0x35, 0x41, 0x39, 0x59, 0xa8, 0xc9, 0xea, 0xc2, 0xaf,
-  0xbf, 0x6b, 0x0c, 0x63, 0x13, 0x9e, 0x33, 0x8e, 0x6f, 0xe8, 0x39, 0x12,
-  0x2a, 0xb6, 0x6f, 0x14, 0x5b, 0x22, 0xf4, 0x58, 0x1d, 0xb4, 0x99, 0xcb,
-  0x5b, 0x56, 0x87, 0xc0, 0x28, 0xb6, 0xd7, 0x6b, 0x75, 0x18, 0x9b, 0xb9,
-  0xbc, 0x65, 0x75, 0x50, 0x26, 0xb1, 0xa9, 0xbf, 0xd1, 0x85, 0x17, 0xd9,
-  0x4b, 0xa9, 0xc0, 0xa8, 0xe4, 0xb9, 0x57, 0x70, 0xa1, 0x9e, 0x3d, 0x83,
-  0xcf, 0x6b, 0xee, 0x6c, 0x33, 0x1a, 0xbb, 0xb6, 0xdb, 0xf4, 0x21, 0xac,
-  0x11, 0x75, 0xb5, 0xef, 0x3b, 0x55, 0x99, 0x3e, 0xac, 0xbd, 0xd0, 0xa6,
-  0x03, 0x97, 0xfc, 0xbb, 0xe9, 0x81, 0x9c, 0x00, 0x51, 0xec, 0xef, 0x27,
-  0x12, 0x51, 0x75, 0x44, 0x3e, 0x2f, 0xee, 0xc2, 0x89, 0xae, 0x02, 0xe2,
-  0xbf, 0xbc, 0x16, 0x54, 0x2c, 0x6d, 0x2b, 0xf1, 0xb9, 0x5f, 0xa4, 0xf3,
-  0x49, 0x57, 0xc8, 0x6d, 0xf1, 0x1f, 0xa6, 0x3f, 0x7b, 0x57, 0x98, 0xc2,
-  0x8a, 0x16, 0x47, 0x2e, 0xcd, 0x73, 0xbe, 0x50, 0x91, 0x9a, 0x4c, 0x1e,
-  0x88, 0x4d, 0x6b, 0xdd, 0x49, 0x83, 0xf3, 0xd7, 0xbb, 0xd1, 0x11, 0xfd,
-  0xe0, 0xbe, 0xef, 0x13, 0x24, 0xb1, 0x73, 0xac, 0xe6, 0xff, 0x2e, 0x0a,
-  0x08, 0xb6, 0x92, 0x21, 0xaf, 0x4e, 0x9d, 0x91, 0x73, 0x39, 0x59, 0xcc,
-  0x7a, 0xf0, 0xb4, 0x6a, 0xc9, 0xc7, 0x97, 0x9c, 0x35, 0xe1, 0xd3, 0x23,
-  0x34, 0x2e, 0x97, 0x06, 0x34, 0xc7, 0x57, 0x9f, 0xff, 0xf8, 0xdc, 0xa7,
-  0x1b, 0x0d, 0x02, 0xc6, 0xad, 0x01, 0xd3, 0xf9, 0x88, 0x0d, 0xb5, 0xc4,
-  0x8d, 0x11, 0x49, 0x30, 0x2c, 0xab, 0x62, 0x3d, 0xdd, 0xab, 0x38, 0x4f,
-  0xf1, 0xea, 0x71, 0x6b, 0x09, 0x42, 0xcb, 0xb7, 0xa3, 0xd5, 0xd3, 0x36,
-  0x13, 0xc4, 0x64, 0x03, 0xc7, 0x3d, 0xb4, 0x8a, 0xf7, 0x47, 0x8b, 0x64,
-  0x8e, 0xcb, 0x11, 0xff, 0x7f, 0xed, 0x91, 0x75, 0x15, 0x14, 0xf7, 0x43,
-  0xcf, 0x0c, 0x6a, 0xbd, 0xa9, 0x3d, 0x77, 0xb3, 0xb5, 0xda, 0xd6, 0x6a,
-  0xc4, 0xd9, 0xb3, 0x55, 0x03, 0xc1, 0xb9, 0x85, 0x74, 0xce, 0x68, 0xb0,
-  0x32, 0x25, 0x30, 0xdf, 0x12, 0xd8, 0x60, 0x68, 0x0a, 0x60, 0xc8, 0x85,
-  0x05, 0x30, 0xf6, 0xbc, 0x0a, 0xe6, 0x3d, 0xaf, 0x82, 0x89, 0x03, 0x2a,
-  0x18, 0xfa, 0x56, 0xbc, 0x9e, 0x57, 0xbf, 0x24, 0xe1, 0xd5, 0xb4, 0x2f,
-  0xaf, 0xf8, 0x75, 0x7e, 0x24, 0x33, 0xf9, 0x91, 0x17, 0x49, 0x94, 0xa5,
-  0x83, 0x37, 0xb9, 0x56, 0x2c, 0xc6, 0x0d, 0xa0, 0x2e, 0x27, 0xea, 0x61,
-  0x34, 0x57, 0xcb, 0x90, 0xd7, 0x87, 0x4c, 0xfd, 0x98, 0xdc, 0xab, 0xb8,
-  0x3d, 0xb1, 0xd7, 0x7c, 0x5e, 0xf5, 0x38, 0xd6, 0xa3, 0xd8, 0xac, 0xb7,
-  0x37, 0x0d, 0x43, 0xba, 0xca, 0x37, 0xc0, 0x20, 0xf9, 0x5a, 0xc3, 0xee,
-  0x8f, 0xc6, 0x40, 0xd0, 0xe8, 0xec, 0xe3, 0x57, 0x52, 0x13, 0x4b, 0x5d,
-  0xc2, 0x03, 0x5a, 0xe7, 0xc6, 0x31, 0x53, 0x41, 0x98, 0xb8, 0xb5, 0x4c,
-  0xec, 0x5d, 0x48, 0xf0, 0xd1, 0xc4, 0xe4, 0x2b, 0x09, 0x00, 0x3d, 0x3e,
-  0x54, 0x88, 0xae, 0x45, 0x80, 0xe4, 0x53, 0x75, 0x46, 0x78, 0x06, 0x3e,
-  0xf3, 0x4c, 0xeb, 0x79, 0xc1, 0x46, 0x67, 0x8e, 0x70, 0xae, 0xc3, 0xf4,
-  0xa7, 0xc3, 0x5d, 0x78, 0x74, 0x06, 0xeb, 0xea, 0xb9, 0x02, 0x0c, 0x5e,
-  0x5f, 0xe9, 0xea, 0x51, 0xeb, 0xda, 0x83, 0x20, 0x29, 0xf8, 0x7b, 0x91,
-  0x88, 0x17, 0x40, 0x62, 0x75, 0x54, 0x38, 0xfc, 0xd9, 0x80, 0xa9, 0xe2,
-  0x96, 0x01, 0x81, 0x51, 0x24, 0xf3, 0x2c, 0x89, 0xd2, 0x3b, 0xaa, 0xf5,
-  0xdd, 0xf7, 0xd7, 0xec, 0xed, 0x6a, 0x30, 0x2e, 0x9b, 0x5f, 0x86, 0x21,
-  0x81, 0xf3, 0x73, 0x55, 0x64, 0xf3, 0x35, 0xc9, 0xe6, 0x0b, 0x35, 0xd9,
-  0xb7, 0x39, 0x07, 0xaf, 0xd7, 0x43, 0xa1, 0xb5, 0x46, 0xf5, 0x45, 0x52,
-  0xc8, 0xe8, 0xae, 0xfb, 0x30, 0x9e, 0xa8, 0xd9, 0x6d, 0xb9, 0xbb, 0x8c,
-  0xaa, 0xd7, 0x0c, 0x91, 0xa9, 0x79, 0xf6, 0x33, 0xdf, 0x7b, 0xb5, 0x2e,
-  0x69, 0x73, 0x18, 0x73, 0xf2, 0x2a, 0x87, 0xea, 0xf1, 0xd3, 0xfe, 0x5f,
-  0x35, 0x5e, 0x96, 0xff, 0x68, 0x22, 0xd9, 0xe3, 0x89, 0xc4, 0xf5, 0x44,
-  0x8a, 0x56, 0xb5, 0xca, 0x44, 0x85, 0xff, 0xde, 0xd7, 0x3f, 0x84, 0x5b,
-  0x54, 0xb5, 0x70, 0x0f, 0x0c, 0x92, 0x9f, 0x21, 0x60, 0xe7, 0x3a, 0x85,
-  0xd0, 0x32, 0x07, 0x0e, 0xe8, 0x1b, 0xc4, 0xe3, 0x00, 0xb4, 0xbb, 0xd8,
-  0x6b, 0x3c, 0x45, 0x3c, 0x6d, 0x56, 0x0b, 0xf1, 0x4d, 0x62, 0x9f, 0x4e,
-  0x92, 0xb9, 0xa6, 0xc2, 0xf7, 0xe8, 0xa2, 0x8b, 0x76, 0x00, 0x14, 0x26,
-  0x25, 0xc9, 0xdb, 0x1f, 0x1d, 0x2f, 0x42, 0x5d, 0x6d, 0xc7, 0x9b, 0xe1,
-  0x69, 0xbc, 0xad, 0x7b, 0x74, 0x5b, 0x37, 0xb6, 0xff, 0x6b, 0x2e, 0x31,
-  0x6f, 0x20, 0xf1, 0xc1, 0x7b, 0x3c, 0xbe, 0x24, 0x09, 0xba, 0x52, 0x3c,
-  0x6e, 0x5a, 0x29, 0x17, 0xea, 0x26, 0x89, 0x9c, 0x3f, 0x47, 0xbd, 0xa8,
-  0xed, 0x23, 0xfa, 0x11, 0x33, 0xf4, 0xeb, 0xa9, 0xf4, 0xb5, 0x22, 0x34,
-  0x5e, 0x95, 0xe6, 0x23, 0x28, 0xaf, 0x9e, 0x52, 0xdf, 0x22, 0x32, 0x74,
-  0x85, 0x8d, 0x85, 0x69, 0x85, 0xd1, 0xfe, 0xaa, 0xaf, 0xb1, 0x95, 0xac,
-  0x6c, 0xd2, 0x4a, 0xd6, 0x0b, 0xd0, 0x7f, 0x01, 0x51, 0xa9, 0x0b, 0x19,
-  0x18, 0x44, 0xb5, 0xec, 0xcd, 0xe5, 0xdb, 0x38, 0xcc, 0x60, 0x72, 0x98,
-  0x47, 0x6a, 0xbe, 0xc8, 0xa6, 0x1b, 0x09, 0xcb, 0x63, 0x62, 0x3b, 0x09,
-  0x65, 0x4d, 0x0b, 0x36, 0xb7, 0x5d, 0x0b, 0xb6, 0xf2, 0x1c, 0xa3, 0x7d,
-  0xe0, 0xd5, 0x62, 0xfd, 0x95, 0x24, 0xce, 0xf1, 0x44, 0xcd, 0x66, 0x49,
-  0xb4, 0x33, 0x7b, 0xd0, 0x76, 0x71, 0xc3, 0xb6, 0xb4, 0xaa, 0xb1, 0xea,
-  0xaa, 0x27, 0x16, 0xb9, 0x31, 0x9b, 0x4a, 0x61, 0x8e, 0xbe, 0x99, 0xc9,
-  0x49, 0x3a, 0xb9, 0xbf, 0x4d, 0xa6, 0x1f, 0x54, 0x46, 0x5a, 0xb0, 0xb5,
-  0xc0, 0xf1, 0x62, 0xc1, 0x78, 0xb4, 0xc1, 0x01, 0xfb, 0x70, 0x7c, 0xc9,
-  0x33, 0x58, 0xa8, 0x82, 0xf4, 0xa0, 0xee, 0x80, 0x40, 0x62, 0x82, 0x42,
-  0xca, 0x5b, 0xfc, 0x9c, 0x64, 0xc9, 0x77, 0xea, 0x4a, 0xb7, 0x37, 0x0e,
-  0xf4, 0xf0, 0x68, 0xbf, 0xfa, 0xe9, 0xa8, 0x95, 0x6e, 0x38, 0x6a, 0x92,
-  0x65, 0x1b, 0xe2, 0x7a, 0xf0, 0x21, 0xca, 0x47, 0x6f, 0xab, 0xf2, 0x62,
-  0xe8, 0x21, 0x3b, 0xb0, 0xd9, 0x8a, 0x00, 0xdd, 0xfc, 0x6f, 0x10, 0x80,
-  0x6a, 0x86, 0xdb, 0xbe, 0xd4, 0xa1, 0x72, 0x80, 0x35, 0x3d, 0x65, 0x75,
-  0x91, 0xb3, 0xce, 0xe8, 0x63, 0xb5, 0xcb, 0xfb, 0xde, 0x59, 0x3a, 0x9e,
-  0x17, 0xb5, 0x7b, 0xa3, 0x79, 0x96, 0x7c, 0xd3, 0xeb, 0xee, 0x67, 0xc5,
-  0x2a, 0x39, 0x74, 0x17, 0x34, 0xdf, 0x1c, 0x3d, 0x81, 0xb5, 0x9a, 0xe3,
-  0x3a, 0x2b, 0x5f, 0xae, 0x3b, 0xbb, 0x81, 0x85, 0x84, 0xc0, 0x8d, 0x12,
-  0x8e, 0x92, 0x58, 0xe7, 0xff, 0xbb, 0x0a, 0x85, 0x09, 0xba, 0x52, 0x95,
-  0x41, 0xa5, 0xf5, 0x9e, 0x22, 0xad, 0xff, 0x6a, 0xa4, 0x0d, 0x9a, 0x49,
-  0xab, 0x2d, 0xa4, 0x75, 0xce, 0x32, 0xad, 0x67, 0xf3, 0x87, 0xc9, 0xf2,
-  0x35, 0x4b, 0xf3, 0x4c, 0xbf, 0x5c, 0x43, 0xbf, 0x27, 0xcd, 0x34, 0xb3,
-  0x99, 0xe9, 0x3c, 0x87, 0xfe, 0xc6, 0x51, 0xd3, 0x78, 0x79, 0x27, 0xff,
-  0x24, 0xeb, 0x42, 0xe2, 0xbd, 0x74, 0xf0, 0x76, 0x55, 0x11, 0x3e, 0xc4,
-  0xc5, 0x07, 0x30, 0x32, 0xe6, 0xa5, 0xaf, 0xfd, 0x47, 0x1e, 0xeb, 0x3a,
-  0x56, 0x46, 0xf3, 0xdd, 0xdc, 0xdc, 0xd0, 0x49, 0x58, 0xdb, 0x8e, 0x46,
-  0xef, 0xa3, 0x32, 0x3e, 0x26, 0x8c, 0xff, 0x38, 0x37, 0xef, 0x2d, 0x87,
-  0xaf, 0x68, 0xe1, 0x6d, 0x2b, 0x5a, 0xdc, 0x7d, 0x01, 0x07, 0xb7, 0x11,
-  0x0b, 0xae, 0x77, 0x59, 0xbc, 0x89, 0xec, 0x4d, 0x97, 0xfb, 0x8c, 0x0a,
-  0x36, 0x64, 0x6d, 0x3c, 0x6a, 0xc7, 0x36, 0x2e, 0x27, 0x9e, 0xcc, 0x7f,
-  0x1a, 0x2d, 0xe6, 0xda, 0xb9, 0x00, 0xc9, 0xa9, 0x7f, 0xd0, 0xd6, 0xa8,
-  0x22, 0x9a, 0x1f, 0xb4, 0x0f, 0x65, 0xe3, 0x66, 0x07, 0xd4, 0x85, 0x13,
-  0xc6, 0x55, 0x51, 0x5a, 0x61, 0xb4, 0x8d, 0x2f, 0x69, 0xe9, 0x07, 0x84,
-  0xca, 0x8d, 0x72, 0xd8, 0x2b, 0x2d, 0xdb, 0xa5, 0x41, 0x13, 0xba, 0x58,
-  0xea, 0xe5, 0xf5, 0xd0, 0x65, 0xbb, 0xf2, 0xd2, 0x7d, 0xf5, 0x2d, 0x49,
-  0xac, 0x62, 0x88, 0x6d, 0x24, 0xee, 0x7e, 0x69, 0x76, 0xe4, 0xb2, 0xc2,
-  0xb3, 0x50, 0x55, 0x3a, 0x7d, 0x7d, 0x29, 0x8f, 0x96, 0x25, 0x79, 0x54,
-  0xee, 0x16, 0xc1, 0x76, 0xd9, 0xa5, 0x16, 0xb9, 0x04, 0x52, 0xf8, 0xab,
-  0x20, 0xb1, 0xee, 0x42, 0x42, 0x93, 0x26, 0x5d, 0x6f, 0x20, 0x0d, 0x90,
-  0xc2, 0x01, 0x52, 0x6d, 0xd4, 0xd7, 0x75, 0x69, 0xce, 0xe8, 0xe5, 0x7b,
-  0xdf, 0x77, 0x5d, 0x67, 0xb4, 0xb8, 0xd7, 0x59, 0x11, 0xab, 0xf8, 0x90,
-  0xfe, 0xac, 0x68, 0xf5, 0xdb, 0xc9, 0x47, 0xa3, 0xec, 0xd3, 0x7b, 0x20,
-  0x40, 0x56, 0x5c, 0x90, 0x53, 0x40, 0x5f, 0x46, 0x1f, 0x8f, 0xb6, 0x52,
-  0xb1, 0x99, 0xf3, 0x71, 0x7a, 0xbf, 0x98, 0x3b, 0x27, 0xc9, 0xec, 0xbe,
-  0x3c, 0x0d, 0x92, 0xa0, 0xce, 0xc1, 0x1a, 0xbf, 0xbb, 0xf4, 0xc9, 0xdf,
-  0xa6, 0x8d, 0xdf, 0x3d, 0xc3, 0x93, 0xbf, 0x84, 0x15, 0x09, 0x09, 0xd5,
-  0xb8, 0xb2, 0xde, 0xaa, 0x2e, 0x9f, 0xbe, 0x67, 0xbb, 0x7e, 0x25, 0x31,
-  0x4d, 0xe2, 0xcd, 0x13, 0x91, 0xec, 0xd1, 0x0b, 0x91, 0x9b, 0x07, 0x22,
-  0xc5, 0xe6, 0x81, 0x48, 0xb9, 0x46, 0xc8, 0x37, 0xf1, 0x45, 0xdc, 0xc4,
-  0x17, 0x59, 0x45, 0x7c, 0x11, 0xa1, 0xf9, 0xc5, 0x10, 0x55, 0x2a, 0x9b,
-  0x5b, 0x20, 0x37, 0x44, 0xb1, 0x92, 0x35, 0xda, 0x96, 0x55, 0x45, 0xe9,
-  0xd4, 0x39, 0x3f, 0x76, 0x04, 0xc0, 0xe9, 0xa8, 0xfb, 0x39, 0x82, 0xcd,
-  0x73, 0xaf, 0x29, 0x22, 0x44, 0x70, 0x2b, 0x10, 0x7d, 0xd6, 0xdf, 0xd3,
-  0xc9, 0x62, 0xb9, 0x72, 0x78, 0x9e, 0x59, 0x4a, 0xce, 0x83, 0x7d, 0xc9,
-  0xc3, 0x21, 0xac, 0x00, 0xe2, 0xfd, 0xac, 0x3e, 0x4e, 0xc7, 0xc9, 0x34,
-  0x99, 0x3f, 0xbc, 0x3d, 0x64, 0xfc, 0x69, 0xc8, 0xc0, 0xaf, 0x43, 0xf6,
-  0x65, 0x3a, 0x49, 0xee, 0x92, 0xb9, 0x2e, 0x6a, 0xab, 0xfb, 0xc9, 0x8c,
-  0x36, 0xf7, 0x8d, 0x88, 0x85, 0xd6, 0xe1, 0x62, 0xa2, 0xba, 0xdb, 0xee,
-  0x58, 0x3e, 0xb5, 0xb3, 0xaf, 0x0e, 0xcb, 0x2f, 0xa0, 0x44, 0xce, 0xa3,
-  0xf4, 0xf1, 0x25, 0xbe, 0x2a, 0xc0, 0x6c, 0xb6, 0x22, 0x77, 0xbd, 0x13,
-  0x79, 0x9b, 0x8d, 0x48, 0x16, 0x2c, 0x42, 0x61, 0xa8, 0x46, 0xa4, 0x22,
-  0x20, 0x6e, 0xae, 0x93, 0x96, 0x9e, 0x5c, 0xf1, 0x30, 0x72, 0x7d, 0x58,
-  0x4d, 0x8f, 0x43, 0xbd, 0x3d, 0xe0, 0xd3, 0x4f, 0xce, 0xe8, 0xb4, 0x53,
-  0x0d, 0x81, 0x58, 0xfb, 0x43, 0x75, 0xc0, 0x56, 0xfe, 0x99, 0x27, 0x08,
-  0x0e, 0x9d, 0x9e, 0xeb, 0xd4, 0xb9, 0x26, 0xe9, 0xd7, 0x2d, 0xb7, 0x63,
-  0xcb, 0xfc, 0x01, 0x3a, 0xb8, 0x50, 0xb8, 0x64, 0xae, 0x46, 0x0e, 0x73,
-  0xee, 0xd3, 0x6c, 0x6e, 0xcc, 0xa4, 0x40, 0x78, 0xe2, 0xd0, 0x10, 0xcd,
-  0x23, 0xda, 0x3c, 0xa2, 0x8b, 0x00, 0x74, 0x44, 0x5b, 0x96, 0x91, 0x8c,
-  0x86, 0x35, 0xb9, 0xd1, 0x28, 0x15, 0xda, 0x86, 0x0c, 0xaf, 0x20, 0x63,
-  0xb8, 0x68, 0x3e, 0xec, 0x38, 0x48, 0x36, 0xa8, 0x44, 0x9f, 0x8c, 0xe3,
-  0xfa, 0xe3, 0x1f, 0x5f, 0xae, 0xad, 0x92, 0x41, 0xe1, 0xd5, 0xa5, 0xc1,
-  0xd6, 0xaf, 0x1b, 0x04, 0x28, 0x04, 0x46, 0x2d, 0xa9, 0xe0, 0x57, 0xce,
-  0x68, 0x77, 0x1a, 0xd8, 0x81, 0x5e, 0x92, 0x14, 0x75, 0xd7, 0x0c, 0x6e,
-  0x33, 0x03, 0x0e, 0x12, 0xc2, 0x72, 0x0e, 0x89, 0x01, 0xf8, 0xb9, 0x98,
-  0x1d, 0xfa, 0x3a, 0x52, 0x98, 0x03, 0xe7, 0x4a, 0x36, 0x35, 0x87, 0x3e,
-  0x9d, 0xd6, 0x7d, 0x1b, 0x3c, 0x82, 0xdd, 0xbc, 0x4a, 0xb6, 0xfa, 0xf0,
-  0xd9, 0x36, 0x8e, 0xf3, 0x93, 0x51, 0x67, 0xb7, 0x77, 0xde, 0xfc, 0x35,
-  0x03, 0xf2, 0x0c, 0x53, 0xc0, 0x88, 0xbd, 0x4b, 0xa6, 0x73, 0x3d, 0x8d,
-  0x53, 0x67, 0xf4, 0x23, 0x99, 0x47, 0xb7, 0xd4, 0x33, 0x7c, 0x3d, 0xc7,
-  0xb6, 0xbb, 0x64, 0x16, 0x61, 0xee, 0x77, 0xfc, 0xfa, 0x03, 0x1c, 0xc4,
-  0xeb, 0x57, 0x59, 0x89, 0x71, 0x4c, 0x67, 0xf3, 0x2c, 0xbd, 0x4b, 0x9d,
-  0x3f, 0x85, 0x3c, 0x18, 0xaa, 0x60, 0x2f, 0x29, 0xf6, 0x4b, 0x1f, 0x20,
-  0x46, 0x68, 0xf4, 0xc8, 0x17, 0xee, 0x68, 0xd7, 0xe8, 0x13, 0xc9, 0x77,
-  0xdd, 0x84, 0x3d, 0xfc, 0x4d, 0xd8, 0x83, 0x6d, 0xc2, 0x1e, 0x7c, 0x13,
-  0xf6, 0xf0, 0xe8, 0xc6, 0x72, 0x28, 0xad, 0x6b, 0xa3, 0x67, 0x5b, 0xb1,
-  0xa6, 0x52, 0x8b, 0x6c, 0xd0, 0x78, 0x15, 0x68, 0xe8, 0xf6, 0xd2, 0x56,
-  0x85, 0x5a, 0x16, 0x56, 0x61, 0xc3, 0x77, 0xd1, 0xe4, 0x2a, 0x68, 0x8a,
-  0xc2, 0x23, 0x36, 0xf6, 0xeb, 0xc7, 0x93, 0x8f, 0x47, 0x44, 0x32, 0xc4,
-  0xa5, 0x68, 0x6b, 0xbf, 0x8e, 0x3f, 0x4b, 0xbb, 0x18, 0x49, 0xce, 0x1b,
-  0x4d, 0xd7, 0x87, 0xb0, 0xe8, 0xd5, 0xe9, 0x3e, 0x3e, 0xaa, 0x84, 0x41,
-  0x8e, 0xc9, 0xb7, 0xc1, 0x04, 0xd5, 0x98, 0x46, 0xb7, 0x89, 0x9e, 0xc4,
-  0x39, 0xa2, 0x20, 0x27, 0xe4, 0x97, 0x80, 0xda, 0xe7, 0x49, 0x6f, 0xb0,
-  0x70, 0xe2, 0x6b, 0x35, 0x6d, 0x0a, 0xc3, 0x9a, 0xd4, 0x15, 0x43, 0x8e,
-  0xc5, 0x33, 0x16, 0x5c, 0x12, 0x2c, 0x00, 0xa1, 0xa8, 0xc0, 0x52, 0xd6,
-  0xcd, 0xfe, 0xc2, 0x83, 0xdc, 0xbb, 0xd6, 0x27, 0xb9, 0xf7, 0x87, 0x38,
-  0xca, 0x21, 0x5b, 0x85, 0x52, 0x99, 0x4f, 0xb6, 0x9b, 0x87, 0x6f, 0xa9,
-  0x73, 0x94, 0x64, 0xce, 0xd9, 0x24, 0x2d, 0xda, 0x0f, 0xd8, 0xa4, 0xa2,
-  0x1e, 0x1c, 0x53, 0x88, 0xd0, 0x12, 0x53, 0x88, 0xd8, 0x3e, 0x61, 0x48,
-  0x84, 0x65, 0x0c, 0x47, 0xc4, 0x95, 0x98, 0xc6, 0x93, 0x94, 0x52, 0x39,
-  0x5c, 0x5e, 0x3e, 0x7f, 0xc4, 0x47, 0x51, 0xf7, 0x65, 0x2f, 0x0c, 0xc5,
-  0xcc, 0x85, 0x9d, 0x4d, 0x12, 0x06, 0x30, 0x96, 0x9e, 0x49, 0xee, 0x21,
-  0xaf, 0xe8, 0xd1, 0xc9, 0x16, 0x0b, 0xf5, 0x08, 0x00, 0x76, 0x71, 0xe5,
-  0xf7, 0x56, 0xf7, 0x5b, 0x7d, 0xb2, 0x0f, 0xfe, 0x94, 0x6c, 0xf3, 0xab,
-  0x4d, 0x6a, 0x56, 0x1b, 0xbe, 0x1a, 0xeb, 0xb3, 0xe2, 0x4b, 0xe1, 0xb6,
-  0xc0, 0x9f, 0xa6, 0x93, 0xdd, 0x2c, 0x70, 0x94, 0x4b, 0xb1, 0x45, 0x53,
-  0xab, 0x41, 0x14, 0x43, 0xee, 0xcd, 0xac, 0x0a, 0x1a, 0xc7, 0xcb, 0x10,
-  0xf6, 0x9e, 0x10, 0x65, 0xad, 0xf9, 0xc0, 0xfa, 0x08, 0x22, 0xc4, 0xab,
-  0x18, 0x90, 0x00, 0x24, 0xa0, 0x1e, 0x7e, 0xbe, 0xb9, 0xac, 0x1b, 0x3f,
-  0xc0, 0xd5, 0xa5, 0xe4, 0x38, 0x26, 0xd2, 0xfe, 0x5b, 0x39, 0xc7, 0xdd,
-  0x0a, 0x98, 0xf2, 0x03, 0xf2, 0x80, 0x2a, 0x1e, 0x57, 0xa7, 0x7d, 0xe9,
-  0x28, 0x4f, 0xb7, 0x15, 0x97, 0x6e, 0x2b, 0x9f, 0x2e, 0x2f, 0x87, 0xed,
-  0xa4, 0xe2, 0xbe, 0x5b, 0x11, 0xa3, 0x91, 0xa9, 0xe9, 0x8d, 0x7e, 0x96,
-  0xd8, 0x09, 0xec, 0xa3, 0xe4, 0xb6, 0x4a, 0xe5, 0x7e, 0x96, 0x98, 0x2a,
-  0x77, 0x99, 0x5f, 0x19, 0x5c, 0xff, 0xf4, 0xe5, 0xbf, 0xe9, 0xa9, 0x90,
-  0xa4, 0x35, 0x04, 0x9b, 0xac, 0x06, 0x78, 0x94, 0xd5, 0x80, 0x05, 0x95,
-  0xd0, 0x5f, 0x33, 0x11, 0x0d, 0x98, 0xb0, 0x96, 0x4c, 0x42, 0xac, 0xb6,
-  0x37, 0x65, 0x2e, 0x08, 0xb3, 0x70, 0xe6, 0xc7, 0x2e, 0xe8, 0x2d, 0x16,
-  0x97, 0x62, 0x19, 0x53, 0xaf, 0xea, 0xde, 0x88, 0xec, 0x89, 0x9a, 0xe2,
-  0x5b, 0x96, 0xca, 0x9a, 0x1b, 0xcd, 0x3d, 0xad, 0xc4, 0x8f, 0x91, 0x0d,
-  0xf4, 0xf2, 0xf8, 0x6d, 0x3d, 0x1d, 0xcb, 0x9f, 0xf6, 0x4a, 0xaa, 0x2f,
-  0x29, 0x97, 0x93, 0xcb, 0xad, 0xfe, 0xe6, 0x7b, 0x9b, 0x8a, 0x40, 0x2f,
-  0x43, 0xae, 0x04, 0x21, 0x04, 0x3b, 0x08, 0x8b, 0xdd, 0xe8, 0xab, 0xce,
-  0x66, 0x8b, 0x59, 0x41, 0x33, 0x99, 0xde, 0x74, 0xae, 0x3b, 0x11, 0xad,
-  0xa2, 0x17, 0xd4, 0x56, 0x2e, 0x33, 0xea, 0xf4, 0x8d, 0xda, 0xe8, 0xc3,
-  0xd3, 0xef, 0x9a, 0x68, 0xf1, 0x58, 0xb3, 0xa2, 0x40, 0x51, 0x3b, 0x59,
-  0xae, 0xeb, 0x2e, 0xff, 0x7a, 0x24, 0xc1, 0xe9, 0x51, 0x56, 0xa0, 0xf9,
-  0xf9, 0x78, 0xdb, 0x92, 0xd9, 0x9a, 0xbc, 0xd2, 0xa0, 0x6d, 0xd2, 0x24,
-  0x34, 0x49, 0x9a, 0x44, 0xb4, 0xcb, 0xaa, 0xe0, 0x45, 0xf4, 0x37, 0x70,
-  0x41, 0xd6, 0x93, 0xe9, 0x5b, 0x4e, 0xa9, 0x88, 0x0a, 0x2a, 0xb1, 0x82,
-  0xc8, 0x44, 0xa7, 0xec, 0xb4, 0xf0, 0x4c, 0xb7, 0xb0, 0x2e, 0xc5, 0x42,
-  0x21, 0x50, 0xa9, 0x1b, 0xee, 0x04, 0x9c, 0x2d, 0x25, 0x64, 0xdc, 0xbc,
-  0x32, 0x88, 0x64, 0x2d, 0x73, 0xb0, 0x5f, 0x28, 0xf3, 0x9a, 0xea, 0x80,
-  0x7d, 0xb8, 0x62, 0x0c, 0x05, 0xa2, 0x08, 0x7d, 0xbe, 0x17, 0xd1, 0x70,
-  0xf6, 0x88, 0x83, 0xf2, 0x1d, 0x5c, 0x18, 0x5b, 0xa0, 0x22, 0x86, 0xa5,
-  0x07, 0xcf, 0xd4, 0x53, 0xc3, 0xc2, 0x3d, 0x34, 0xeb, 0xd4, 0xd7, 0x64,
-  0xae, 0xcc, 0xda, 0x14, 0x22, 0xaf, 0xde, 0x8d, 0x84, 0x69, 0x37, 0xb2,
-  0x90, 0x5c, 0xb6, 0x69, 0x10, 0x4f, 0xa2, 0xbf, 0xa8, 0xbc, 0x6d, 0xd1,
-  0xd2, 0x1f, 0x3a, 0xcb, 0x4f, 0x57, 0x99, 0x2e, 0x5e, 0x34, 0x1b, 0x7c,
-  0x4b, 0x13, 0xc2, 0x15, 0x43, 0x94, 0xd5, 0x08, 0xcf, 0x16, 0xb3, 0x5c,
-  0x3f, 0x68, 0x66, 0x84, 0xb9, 0x7d, 0xe9, 0x1b, 0x05, 0x69, 0xaf, 0x8b,
-  0xac, 0x09, 0xc8, 0xc2, 0x67, 0x2f, 0x9f, 0xeb, 0x1c, 0x28, 0xae, 0xd5,
-  0xd1, 0xdd, 0x4b, 0xf1, 0x32, 0x4b, 0x29, 0x49, 0xd3, 0xb6, 0x38, 0x28,
-  0x24, 0xaf, 0x46, 0x39, 0xf0, 0xb3, 0x8d, 0x01, 0x47, 0xaa, 0x8a, 0x5f,
-  0xae, 0x83, 0xa7, 0x3f, 0x7b, 0x1d, 0xfe, 0x65, 0x85, 0x23, 0x5f, 0x06,
-  0xc9, 0x29, 0x21, 0x1a, 0x28, 0xef, 0x7e, 0x67, 0xcc, 0xd6, 0x6b, 0x51,
-  0x54, 0xaf, 0xc5, 0xd1, 0xbd, 0x8e, 0xe6, 0x99, 0x1a, 0xd6, 0xa4, 0xe5,
-  0x93, 0xdf, 0xbe, 0xa0, 0x6b, 0xb2, 0x7c, 0xbf, 0xfc, 0xd0, 0xa9, 0x1f,
-  0xb2, 0x65, 0xea, 0x87, 0x78, 0xbe, 0xd4, 0x0f, 0xa2, 0x5b, 0x81, 0x94,
-  0x1e, 0x61, 0x92, 0x16, 0x1d, 0xad, 0x87, 0x1b, 0xab, 0x8a, 0x22, 0x79,
-  0xc9, 0x77, 0x61, 0xfd, 0x74, 0x2e, 0x92, 0x69, 0x62, 0xb8, 0xec, 0xec,
-  0x64, 0xf6, 0x90, 0xd7, 0x4c, 0x85, 0xc6, 0x1c, 0xab, 0xa8, 0xdc, 0x25,
-  0xd3, 0x64, 0x50, 0xa2, 0x1d, 0x5c, 0x91, 0x27, 0xbd, 0x01, 0x17, 0xd8,
-  0xa6, 0xf0, 0x21, 0x82, 0xa6, 0xb8, 0x64, 0x9f, 0x9e, 0x67, 0xa5, 0x45,
-  0x36, 0xf4, 0x92, 0x63, 0x84, 0x44, 0x63, 0xfa, 0x11, 0xa8, 0xa2, 0xb7,
-  0x3f, 0x9e, 0xe4, 0x7b, 0xc1, 0x74, 0x70, 0x15, 0x61, 0x9b, 0x55, 0x44,
-  0xd4, 0x86, 0x03, 0xa5, 0xc3, 0xde, 0x82, 0xda, 0x88, 0xc6, 0x6a, 0x43,
-  0xdf, 0xda, 0x01, 0xdf, 0x37, 0x83, 0xe9, 0xd3, 0x8d, 0x12, 0x01, 0xe3,
-  0xfa, 0xbf, 0x14, 0x8c, 0x7c, 0x5e, 0x30, 0xee, 0xe1, 0xc0, 0xf8, 0xfe,
-  0xa0, 0x31, 0xd5, 0xf9, 0x5c, 0x1c, 0x78, 0x0d, 0x98, 0xbe, 0xf6, 0x2f,
-  0x09, 0x62, 0x88, 0xc9, 0xcb, 0x58, 0xcf, 0x83, 0xa8, 0x1e, 0x4c, 0x9b,
-  0xba, 0xb7, 0xc3, 0x83, 0x41, 0x89, 0xaa, 0x08, 0x0a, 0x31, 0x46, 0xc1,
-  0x14, 0xad, 0xa2, 0xf2, 0x8b, 0x18, 0xf3, 0xfd, 0x7e, 0xf3, 0xcc, 0x87,
-  0xee, 0xac, 0x2b, 0x64, 0xa0, 0x0c, 0x2e, 0x1f, 0xef, 0xf2, 0x8d, 0x77,
-  0xab, 0x04, 0x7d, 0x72, 0x38, 0xe0, 0xe0, 0xd5, 0xa0, 0xe9, 0xcb, 0x31,
-  0x81, 0x80, 0x89, 0xc6, 0x38, 0x80, 0xa9, 0x00, 0x33, 0x0e, 0x40, 0x0f,
-  0x60, 0x2a, 0x1f, 0x9d, 0x44, 0xbf, 0x02, 0xcc, 0xe0, 0x08, 0x03, 0x1b,
-  0xc0, 0x54, 0x83, 0x91, 0x00, 0x4f, 0x01, 0x43, 0x5f, 0xf6, 0x14, 0x1d,
-  0x01, 0x63, 0x5e, 0x4a, 0x24, 0x67, 0xc6, 0xf5, 0x81, 0x35, 0x06, 0x73,
-  0xf8, 0x2e, 0xa1, 0xd4, 0xda, 0xfc, 0xdd, 0x96, 0x91, 0x12, 0x7f, 0x9b,
-  0xed, 0x8d, 0x75, 0xc6, 0xe2, 0x18, 0x8b, 0xcc, 0x2b, 0xbf, 0x56, 0x7b,
-  0xba, 0xf9, 0x78, 0x28, 0xc9, 0x5b, 0xf4, 0x24, 0xc8, 0x1a, 0x39, 0xfb,
-  0xfa, 0xf2, 0xdf, 0xfa, 0x24, 0xed, 0x03, 0x7f, 0x79, 0x44, 0x41, 0x5b,
-  0x42, 0xd0, 0xa4, 0xe7, 0x0c, 0x62, 0x53, 0x44, 0xa2, 0x6e, 0xb5, 0x88,
-  0x25, 0x23, 0xbe, 0x82, 0x04, 0xb6, 0xcd, 0xe5, 0x4a, 0x38, 0x2e, 0x81,
-  0x83, 0xb0, 0xa5, 0x40, 0x8d, 0x8f, 0x01, 0x88, 0x5b, 0x78, 0x58, 0x93,
-  0xc4, 0x57, 0x9e, 0xc3, 0x41, 0x69, 0xae, 0x3f, 0x25, 0xc1, 0x5f, 0xe0,
-  0x4d, 0xb6, 0xa2, 0xee, 0x37, 0x01, 0xb5, 0x8e, 0x8a, 0xa3, 0xe0, 0x58,
-  0x09, 0x66, 0xb8, 0x60, 0x0a, 0x55, 0x11, 0x72, 0x60, 0x80, 0x4d, 0x8e,
-  0xd7, 0xdd, 0xef, 0x63, 0x69, 0x5b, 0x6f, 0x07, 0x3e, 0x3d, 0x5c, 0x17,
-  0x6d, 0x62, 0x87, 0xc3, 0x35, 0xa2, 0x1e, 0xc0, 0x54, 0x81, 0x61, 0x03,
-  0x18, 0x53, 0x9c, 0x6a, 0x00, 0x53, 0x09, 0x46, 0x0e, 0x60, 0xaa, 0xc1,
-  0xf8, 0x03, 0x18, 0x03, 0x98, 0xc1, 0xc6, 0x54, 0x83, 0x09, 0x06, 0x30,
-  0xd5, 0x60, 0xf4, 0xb0, 0x94, 0x2a, 0xc1, 0xa8, 0x40, 0x0e, 0x0e, 0x5e,
-  0x25, 0x18, 0x35, 0x80, 0xa9, 0xbe, 0x3d, 0x61, 0x18, 0x0d, 0x60, 0xaa,
-  0xc0, 0xf0, 0x01, 0x4c, 0x35, 0x18, 0x31, 0x80, 0xa9, 0x06, 0x23, 0x07,
-  0x30, 0xd5, 0x60, 0xbc, 0x61, 0xbb, 0xa6, 0x60, 0xf4, 0x06, 0xd0, 0x00,
-  0x66, 0x03, 0xc6, 0x1d, 0xc0, 0x54, 0x83, 0x51, 0x38, 0x80, 0xd9, 0x77,
-  0x43, 0xab, 0x00, 0xc2, 0x67, 0x02, 0x43, 0xc2, 0xe2, 0x9d, 0x45, 0x14,
-  0x09, 0x90, 0x3d, 0x44, 0x34, 0x4f, 0x17, 0xd1, 0xed, 0xbd, 0x8a, 0xf3,
-  0x9b, 0xb4, 0x66, 0xbc, 0x22, 0x08, 0xf6, 0xf2, 0x1a, 0x54, 0x4a, 0xbb,
-  0x3b, 0xe6, 0x48, 0xbe, 0x2e, 0x44, 0xb4, 0x58, 0x55, 0xbc, 0x12, 0xe5,
-  0x1a, 0x33, 0x88, 0x07, 0x72, 0x4d, 0xc8, 0xf9, 0xbc, 0x20, 0x27, 0x81,
-  0x01, 0x21, 0x77, 0x7d, 0xe0, 0x8c, 0x59, 0x42, 0xc9, 0x6f, 0x79, 0xa5,
-  0x17, 0x34, 0xb9, 0xea, 0x44, 0xb4, 0x6b, 0x27, 0xba, 0x7e, 0xab, 0x0b,
-  0x71, 0x8b, 0xc6, 0x7f, 0xa9, 0x69, 0xa8, 0x1c, 0xd6, 0x27, 0x4f, 0x80,
-  0x10, 0x61, 0xd5, 0x44, 0x2e, 0xdb, 0x37, 0xfa, 0xe9, 0x4e, 0x91, 0x02,
-  0x41, 0x02, 0x55, 0x48, 0xb6, 0x9a, 0xf7, 0x38, 0x08, 0xe0, 0xbf, 0xe2,
-  0x14, 0x2d, 0x84, 0x46, 0x4a, 0x80, 0x6e, 0xbd, 0xc4, 0x02, 0x90, 0x4a,
-  0xdc, 0xe2, 0x81, 0xef, 0xa0, 0x7d, 0x8b, 0xcc, 0x26, 0x99, 0x89, 0x8c,
-  0xb1, 0x68, 0xf5, 0x25, 0x2b, 0x04, 0x3d, 0xc9, 0xd4, 0x4d, 0x3a, 0x2d,
-  0xe5, 0xfd, 0x3d, 0x7d, 0x58, 0x6a, 0x59, 0x5f, 0x5d, 0x16, 0x02, 0x0c,
-  0x2a, 0x81, 0xa5, 0x53, 0xfd, 0xcb, 0xda, 0x59, 0x11, 0x3c, 0x14, 0x06,
-  0x95, 0xfe, 0x69, 0x86, 0x10, 0x2b, 0x0d, 0x21, 0x51, 0x86, 0xbe, 0xbc,
-  0xa3, 0x4c, 0xc0, 0xc0, 0x1e, 0x30, 0xe4, 0xe5, 0xff, 0xb6, 0x54, 0xa8,
-  0x98, 0x0d, 0x4d, 0xb8, 0xc0, 0xb2, 0x64, 0x48, 0xec, 0x1b, 0xf3, 0x7f,
-  0x89, 0xcf, 0x47, 0x67, 0xf9, 0xa0, 0x65, 0x3e, 0x68, 0xf7, 0xd0, 0xdd,
-  0xd5, 0x9b, 0x27, 0x67, 0x73, 0x63, 0xb2, 0x2d, 0x69, 0x11, 0x5e, 0xb3,
-  0x5c, 0x19, 0xe3, 0x15, 0x72, 0x7f, 0x0a, 0x67, 0x49, 0x9c, 0xa8, 0xe9,
-  0xb6, 0x45, 0xbf, 0x1c, 0xf1, 0x9e, 0xe6, 0xbf, 0x51, 0x13, 0xd7, 0x84,
-  0x99, 0xd8, 0x61, 0x86, 0xbc, 0x3f, 0xfb, 0x82, 0xaf, 0x98, 0x28, 0xfa,
-  0x35, 0x93, 0x37, 0x31, 0x3f, 0xa3, 0x73, 0x91, 0x86, 0xc9, 0x84, 0xf6,
-  0x8a, 0xe4, 0x5b, 0x5d, 0x85, 0x76, 0x45, 0xd8, 0xea, 0xda, 0x23, 0x6a,
-  0x5f, 0x28, 0xf5, 0x5d, 0xaf, 0xf8, 0x79, 0xe6, 0x6e, 0xff, 0xbc, 0x8a,
-  0x93, 0x74, 0x74, 0xab, 0xa2, 0x6f, 0xfd, 0xcb, 0x75, 0x1d, 0x8f, 0x8b,
-  0x9d, 0x4b, 0x78, 0x9c, 0x13, 0x28, 0x77, 0xe9, 0x4f, 0xe7, 0xec, 0x72,
-  0xf4, 0xba, 0x53, 0x81, 0x09, 0x8f, 0x46, 0xb2, 0x07, 0x21, 0xf3, 0xc9,
-  0x12, 0x2e, 0x65, 0xbf, 0xbf, 0x9d, 0xea, 0xb9, 0xc3, 0x4f, 0x3e, 0xad,
-  0xab, 0x67, 0xe9, 0xb1, 0x57, 0xb4, 0x13, 0xdd, 0x6d, 0x5c, 0x4f, 0xcc,
-  0x4a, 0xe1, 0xb8, 0x85, 0x48, 0x6e, 0xf0, 0xe6, 0x44, 0x02, 0xdf, 0x20,
-  0xd2, 0x49, 0xa6, 0xd5, 0x5d, 0xa4, 0x66, 0xf3, 0x8a, 0x4a, 0xe7, 0x32,
-  0x8d, 0x5f, 0x96, 0xe2, 0x84, 0xee, 0x5a, 0x98, 0xd0, 0xa3, 0x6f, 0xc4,
-  0xd3, 0xe7, 0x3a, 0x2a, 0x5f, 0xfd, 0x29, 0x24, 0xd9, 0xca, 0xb5, 0x5f,
-  0x5a, 0xbe, 0xc0, 0x66, 0x5a, 0x98, 0x41, 0x86, 0x75, 0xb3, 0x5c, 0x3a,
-  0x37, 0xde, 0x5a, 0x04, 0xc4, 0xb5, 0x0c, 0xc8, 0xaa, 0x8a, 0xb4, 0x9b,
-  0x3b, 0x0e, 0xcc, 0xa2, 0xa3, 0x8c, 0xd8, 0x16, 0xd5, 0xf8, 0xd8, 0x24,
-  0x91, 0x94, 0x1b, 0x25, 0x3d, 0x76, 0xd4, 0x34, 0xce, 0x5f, 0x65, 0x3d,
-  0x9c, 0xac, 0xef, 0x94, 0x6c, 0x2c, 0xec, 0x3b, 0xc5, 0x0e, 0x27, 0xad,
-  0x0b, 0x7d, 0x92, 0x16, 0x4d, 0x2b, 0xf1, 0x77, 0x75, 0xb3, 0x50, 0xb4,
-  0xef, 0xf7, 0xc1, 0xec, 0xcb, 0x13, 0xaa, 0xe9, 0xc1, 0xf8, 0x66, 0x6e,
-  0x21, 0x31, 0xd2, 0x22, 0x19, 0xf3, 0x0c, 0x1b, 0xf6, 0x88, 0xad, 0xa9,
-  0x5d, 0xbf, 0x2d, 0x1c, 0x6c, 0xde, 0x16, 0xf6, 0x36, 0x6f, 0x0b, 0xfb,
-  0x9b, 0xb7, 0x85, 0x5d, 0x7a, 0xe8, 0xb1, 0x57, 0x03, 0x63, 0xdc, 0xc3,
-  0xe6, 0x99, 0xa1, 0x46, 0x06, 0x97, 0x99, 0x44, 0x3e, 0x1d, 0x3d, 0x9e,
-  0x63, 0xef, 0xf1, 0x31, 0x48, 0x36, 0x9c, 0x63, 0xb3, 0x53, 0x27, 0x2c,
-  0x86, 0x28, 0x84, 0x61, 0x88, 0x97, 0x23, 0x5c, 0x2e, 0xbc, 0xcb, 0x11,
-  0x5b, 0x0f, 0x95, 0xba, 0xde, 0xb2, 0xb2, 0xd7, 0xba, 0x78, 0x44, 0x5e,
-  0x3e, 0xa9, 0xff, 0x85, 0xdf, 0xb2, 0x54, 0xb4, 0xe6, 0xb9, 0x3d, 0x51,
-  0xe3, 0x6b, 0x13, 0x42, 0x26, 0xbd, 0x1d, 0xa9, 0xf9, 0x22, 0x9b, 0x12,
-  0x35, 0x6c, 0x01, 0x63, 0xe3, 0x84, 0x35, 0xf7, 0xdb, 0x18, 0xad, 0x82,
-  0xb5, 0x9b, 0x7d, 0x90, 0x7b, 0x65, 0x2b, 0x27, 0xde, 0x61, 0xff, 0x84,
-  0xcd, 0xe4, 0xbf, 0xd0, 0x5b, 0x1d, 0xf6, 0x33, 0x06, 0xc6, 0x19, 0x23,
-  0xeb, 0x6e, 0x39, 0x6f, 0xe5, 0xc3, 0x99, 0xac, 0xbd, 0xef, 0x56, 0xab,
-  0xb3, 0x3b, 0x9b, 0x85, 0xb4, 0x10, 0x47, 0xba, 0x96, 0xe2, 0x20, 0x11,
-  0xe7, 0xc9, 0xd3, 0xb4, 0x7f, 0xe0, 0x60, 0x3d, 0x70, 0xaf, 0xa3, 0x03,
-  0x47, 0x6d, 0x18, 0xf8, 0xd7, 0xbc, 0xe3, 0xb1, 0xfe, 0x59, 0xe1, 0xff,
-  0x3f, 0xcd, 0x66, 0x63, 0xa9, 0x2b, 0xac, 0x26, 0xbe, 0x46, 0x8e, 0x5b,
-  0xa1, 0x61, 0x7c, 0x7f, 0x25, 0x49, 0xf9, 0xdc, 0x8e, 0x99, 0x6f, 0x13,
-  0x3b, 0x65, 0x0a, 0xb1, 0xb9, 0xcd, 0x0d, 0xb6, 0xbd, 0x85, 0x6e, 0x3a,
-  0x5d, 0x65, 0x20, 0x09, 0x06, 0x1c, 0xeb, 0x53, 0xde, 0x80, 0x83, 0x33,
-  0x2c, 0x77, 0x37, 0x4e, 0x70, 0xfc, 0x5b, 0x67, 0xce, 0x6f, 0x0f, 0x71,
-  0xa6, 0x5e, 0xe5, 0x1b, 0xc1, 0x25, 0x84, 0x43, 0xbc, 0x44, 0x3f, 0xf6,
-  0xd9, 0xd2, 0x08, 0x87, 0x63, 0x08, 0x2b, 0x20, 0xfc, 0x2b, 0x99, 0xdd,
-  0x26, 0x39, 0x04, 0xb7, 0x38, 0x4f, 0x15, 0x10, 0xd0, 0x7d, 0x6a, 0x44,
-  0xd5, 0x27, 0x3c, 0x90, 0x6d, 0xb9, 0x79, 0xa4, 0xc7, 0x01, 0x8a, 0x7a,
-  0x42, 0xc8, 0xb7, 0x10, 0xb1, 0x9d, 0xf3, 0x88, 0xdc, 0x07, 0x09, 0x97,
-  0x94, 0x82, 0x9c, 0x12, 0x82, 0x8d, 0xae, 0x30, 0x10, 0x15, 0x98, 0x2e,
-  0xd5, 0x74, 0x7e, 0xab, 0x33, 0x35, 0xf4, 0x47, 0xde, 0x25, 0x86, 0x75,
-  0xc4, 0x44, 0x3f, 0x2f, 0x72, 0xa9, 0x11, 0x42, 0xa8, 0xc0, 0xf4, 0x59,
-  0x25, 0xff, 0xbb, 0x68, 0xcd, 0xa7, 0xbb, 0x54, 0x24, 0x78, 0x26, 0x2a,
-  0xab, 0xfb, 0x8c, 0xce, 0xb6, 0x17, 0xac, 0xe9, 0xba, 0x22, 0x6c, 0xf0,
-  0x78, 0x7b, 0xf1, 0x0c, 0x78, 0x10, 0x8c, 0x78, 0xae, 0x4e, 0x7b, 0xbc,
-  0xac, 0xd4, 0xf3, 0x83, 0xe9, 0xe6, 0x66, 0x25, 0xf6, 0x80, 0xf9, 0xd2,
-  0x67, 0x8d, 0x09, 0x06, 0x30, 0xa6, 0x7d, 0x1b, 0xab, 0xc1, 0xa4, 0xd3,
-  0xdc, 0xb7, 0x59, 0x3f, 0x06, 0x3e, 0x38, 0x39, 0x85, 0x1e, 0x55, 0xc0,
-  0x1a, 0xe9, 0xec, 0xbb, 0x9a, 0xfc, 0xe3, 0x5d, 0x31, 0xc0, 0xfc, 0x1e,
-  0xe5, 0x7d, 0xf1, 0xf9, 0x5e, 0xe1, 0xee, 0xfe, 0xc5, 0x9e, 0xca, 0x0d,
-  0x2c, 0xcf, 0x62, 0xf5, 0x47, 0xb0, 0x76, 0x47, 0xae, 0x80, 0x21, 0x5b,
-  0xda, 0x1a, 0x29, 0xc8, 0xee, 0xad, 0xe7, 0x59, 0xea, 0x7c, 0x48, 0xe6,
-  0x4e, 0xfe, 0x2a, 0xb8, 0x73, 0xae, 0xa7, 0x7a, 0x96, 0xcc, 0x0c, 0xcf,
-  0xbd, 0x16, 0x50, 0x1a, 0x84, 0xc2, 0x9e, 0xfa, 0x40, 0xb8, 0x6b, 0xb5,
-  0xe7, 0x7a, 0x01, 0x59, 0x0d, 0xdb, 0x42, 0xd9, 0x9c, 0x89, 0xde, 0x29,
-  0xb1, 0x91, 0x81, 0x3f, 0x92, 0x81, 0x97, 0x32, 0x88, 0x86, 0x8f, 0x9e,
-  0x8b, 0x76, 0xe1, 0xe2, 0x32, 0x47, 0xdf, 0x05, 0x56, 0x2f, 0x13, 0x8d,
-  0x12, 0x34, 0x9b, 0x17, 0xe3, 0x8d, 0x93, 0xa4, 0x32, 0xf9, 0xd4, 0x61,
-  0x6a, 0xa6, 0x7c, 0x61, 0x5c, 0x28, 0x1f, 0xf2, 0xb8, 0x42, 0xa6, 0x49,
-  0x32, 0xfd, 0x56, 0x28, 0x5f, 0x11, 0xdf, 0x27, 0x4f, 0x73, 0x13, 0x59,
-  0x9f, 0x2c, 0xa3, 0xac, 0xc9, 0x26, 0x66, 0x74, 0x87, 0xb7, 0xbd, 0xbc,
-  0x20, 0x32, 0x4a, 0x93, 0x8c, 0x45, 0x80, 0xf9, 0x79, 0xde, 0x1b, 0x17,
-  0x54, 0x9a, 0x86, 0xe9, 0x42, 0x5c, 0x14, 0xa3, 0x07, 0x51, 0xb5, 0x92,
-  0xbe, 0x8c, 0x3e, 0x2c, 0xef, 0x43, 0x97, 0xff, 0xcf, 0x65, 0x9a, 0xcd,
-  0x37, 0x37, 0xa2, 0xfe, 0xe6, 0x46, 0x14, 0x61, 0x73, 0x25, 0x1a, 0x6c,
-  0xae, 0x44, 0x11, 0x37, 0x97, 0x89, 0xeb, 0x30, 0x1e, 0xdb, 0x44, 0xf1,
-  0x36, 0x41, 0xbc, 0x95, 0x74, 0x21, 0x37, 0x5f, 0x10, 0xdb, 0x66, 0xa0,
-  0x20, 0xb3, 0xb9, 0x6e, 0x5c, 0xe7, 0xf6, 0x73, 0x93, 0xd4, 0x85, 0xc4,
-  0x8f, 0x36, 0x52, 0xf9, 0x2b, 0xee, 0x03, 0xec, 0x46, 0x3d, 0x46, 0xd3,
-  0xa8, 0x47, 0x8b, 0x7b, 0x9d, 0x6d, 0x66, 0xeb, 0x35, 0x0c, 0x9e, 0x9a,
-  0x37, 0x08, 0x5c, 0x3a, 0xf8, 0xef, 0x7a, 0x7a, 0xb3, 0xb5, 0xd4, 0xdb,
-  0x5e, 0x47, 0xd2, 0x15, 0xcd, 0xd7, 0xe9, 0x84, 0xd2, 0xe6, 0xe5, 0x0e,
-  0x84, 0x98, 0x8e, 0x30, 0x9d, 0x2c, 0xe6, 0xe5, 0xa3, 0xb9, 0x43, 0x19,
-  0xe3, 0x16, 0x2d, 0x66, 0x4b, 0xcb, 0x61, 0x03, 0x2f, 0x00, 0xe4, 0xd6,
-  0xbc, 0x78, 0xaf, 0x79, 0x95, 0x3d, 0x5b, 0xc7, 0x40, 0x8e, 0x3c, 0x69,
-  0xf4, 0xcd, 0x39, 0x56, 0xd3, 0xf8, 0xe1, 0x17, 0x3e, 0x32, 0xa9, 0xd8,
-  0x4b, 0xde, 0x9e, 0x10, 0x24, 0xc2, 0x7d, 0x1b, 0x48, 0x64, 0x0b, 0x24,
-  0xe4, 0x2d, 0xd2, 0xb1, 0x1e, 0x2b, 0x03, 0x92, 0x7a, 0xcf, 0xb9, 0xf9,
-  0x7a, 0xf2, 0xf7, 0x61, 0x0a, 0x5a, 0x62, 0x42, 0x38, 0x20, 0x27, 0xa2,
-  0x3a, 0xbe, 0x67, 0x54, 0x9d, 0xe1, 0xe1, 0x64, 0x5b, 0x8b, 0xa4, 0xcd,
-  0x0c, 0x87, 0x1b, 0x39, 0x4a, 0x8b, 0xf9, 0x03, 0xad, 0x06, 0xb4, 0xc6,
-  0x03, 0xad, 0x7a, 0x5a, 0x20, 0x8b, 0xf4, 0x01, 0xcd, 0xd1, 0xdf, 0xa6,
-  0xf5, 0xe9, 0xdc, 0x39, 0xbe, 0x55, 0xdf, 0x32, 0x75, 0xb7, 0xe6, 0x03,
-  0xbb, 0x23, 0x26, 0x26, 0xb3, 0xe6, 0x47, 0xe4, 0x2f, 0xf8, 0x11, 0xe9,
-  0x63, 0x60, 0xfa, 0x11, 0xe7, 0x38, 0xcd, 0xf4, 0xc1, 0x7e, 0x09, 0x7d,
-  0x54, 0xc6, 0x5f, 0xba, 0x3e, 0xdc, 0xcf, 0xa8, 0x5f, 0xf3, 0x33, 0xd1,
-  0xb3, 0xfe, 0x8c, 0x18, 0xc3, 0xea, 0x48, 0x48, 0x63, 0x3b, 0x8b, 0xbb,
-  0x70, 0xa2, 0x9d, 0xb3, 0x34, 0x8b, 0x36, 0x97, 0x9e, 0xec, 0x8d, 0xbc,
-  0x53, 0x88, 0x75, 0x58, 0xfc, 0x00, 0xdd, 0xe2, 0x6b, 0xac, 0xb7, 0xb0,
-  0x8c, 0x54, 0xa8, 0xb3, 0x79, 0x9a, 0xce, 0x6f, 0xfb, 0xea, 0x88, 0x82,
-  0x58, 0x85, 0x01, 0x07, 0x24, 0x8a, 0x83, 0x5b, 0x98, 0x82, 0xb1, 0x24,
-  0x48, 0x92, 0xb9, 0xfe, 0xe6, 0x1c, 0x3f, 0x84, 0x69, 0x76, 0xd3, 0xd9,
-  0xeb, 0x5f, 0xca, 0xa5, 0x7e, 0xf7, 0x22, 0x5c, 0x18, 0x1f, 0xbb, 0x66,
-  0x2e, 0xce, 0xd7, 0x7f, 0xe2, 0xb2, 0x8a, 0xec, 0x0d, 0x6d, 0xf4, 0x2d,
-  0xda, 0x31, 0x00, 0x56, 0xa0, 0x2a, 0xde, 0x44, 0x3d, 0x9a, 0xaa, 0x49,
-  0x7a, 0xb3, 0x0e, 0xaa, 0xf3, 0x4e, 0x59, 0x61, 0xfa, 0xd6, 0x3b, 0x81,
-  0x83, 0x16, 0x7a, 0x04, 0x5e, 0x35, 0x9c, 0x4b, 0xc6, 0x60, 0x43, 0xa5,
-  0x4d, 0xe4, 0xb7, 0xe9, 0xbd, 0x57, 0xa3, 0xd1, 0x47, 0xe3, 0x71, 0xf5,
-  0xe8, 0x25, 0x40, 0xb1, 0xc1, 0x3a, 0xc5, 0x6e, 0xbb, 0x33, 0xc3, 0x88,
-  0x9d, 0x6d, 0x54, 0x05, 0xcd, 0x18, 0xc5, 0xd2, 0xc0, 0xc8, 0x05, 0xd8,
-  0xb1, 0x0f, 0xc1, 0xcb, 0x36, 0x1e, 0xaa, 0xd1, 0x6d, 0xbf, 0x91, 0x8d,
-  0x84, 0x78, 0xdc, 0x5c, 0xf2, 0x2e, 0x3e, 0x46, 0xd4, 0x10, 0x4b, 0x04,
-  0xa2, 0x1a, 0x4b, 0x40, 0xb0, 0xb4, 0x4a, 0x62, 0xf0, 0x5f, 0x7e, 0x6f,
-  0x65, 0x4f, 0xdb, 0x5b, 0xd1, 0x1f, 0xcb, 0x4a, 0x40, 0x9c, 0x01, 0xf4,
-  0xc8, 0xe5, 0xa0, 0xfb, 0x28, 0x18, 0xb6, 0x0a, 0xe1, 0x03, 0xb5, 0xb2,
-  0xfd, 0xdb, 0x47, 0x03, 0x03, 0x1c, 0xdf, 0x27, 0xfb, 0xe8, 0x81, 0xf2,
-  0x59, 0xfd, 0xc6, 0x17, 0x9b, 0x62, 0xef, 0x96, 0x23, 0x2b, 0x59, 0x34,
-  0x42, 0x10, 0x1a, 0xec, 0x4a, 0x10, 0x40, 0xf7, 0xfd, 0xd0, 0xf6, 0x66,
-  0x85, 0x21, 0xb8, 0x95, 0x7c, 0x46, 0x08, 0x00, 0xce, 0xe5, 0x44, 0x3d,
-  0x8c, 0xe6, 0x2a, 0xbf, 0xcb, 0x7b, 0x93, 0x91, 0xba, 0x16, 0x67, 0x1d,
-  0x18, 0x1b, 0xc0, 0x31, 0x6f, 0x00, 0xb7, 0xcf, 0x62, 0x63, 0xb5, 0x51,
-  0xa2, 0xc6, 0xba, 0xfd, 0x0e, 0xdf, 0x11, 0x6b, 0xad, 0xd7, 0x6f, 0xbf,
-  0x2a, 0x20, 0x60, 0xee, 0x66, 0x8b, 0xe9, 0x8d, 0x73, 0xfa, 0xf1, 0xfc,
-  0x92, 0x41, 0x8b, 0x4a, 0x84, 0x16, 0x05, 0xd5, 0xed, 0xab, 0x09, 0xa2,
-  0x32, 0xa7, 0x91, 0x49, 0x46, 0xc4, 0x9b, 0xfe, 0x50, 0xce, 0xa9, 0x9a,
-  0x3d, 0x38, 0xe7, 0x59, 0x72, 0xdf, 0xfe, 0x21, 0xce, 0x67, 0xab, 0xf9,
-  0x0f, 0x1a, 0x09, 0x2a, 0xb8, 0x84, 0x0a, 0x41, 0x2f, 0x92, 0x28, 0x4b,
-  0x97, 0x92, 0x3a, 0x97, 0x9c, 0x74, 0x9f, 0xed, 0x64, 0x84, 0xd5, 0xea,
-  0xb1, 0x51, 0x81, 0x65, 0xb2, 0x6e, 0x2d, 0x94, 0x2c, 0xed, 0x6c, 0xdc,
-  0x19, 0xe9, 0xda, 0xaf, 0x8f, 0x3b, 0x13, 0x9d, 0x41, 0x0b, 0x3c, 0x7d,
-  0x0a, 0xcb, 0x13, 0x3c, 0xa2, 0x12, 0xcf, 0xa7, 0xe9, 0x24, 0x99, 0xea,
-  0x6a, 0xeb, 0x81, 0xec, 0x90, 0x75, 0x5a, 0xd0, 0xd8, 0x98, 0xf8, 0x4d,
-  0xfa, 0xa7, 0x10, 0xdd, 0x41, 0x61, 0x97, 0x33, 0xce, 0x57, 0xe5, 0x6b,
-  0x02, 0xb0, 0x82, 0x4e, 0xee, 0x82, 0x14, 0x84, 0x4c, 0xb5, 0x6c, 0x8d,
-  0x92, 0x27, 0x8b, 0xb1, 0xd9, 0x25, 0x7c, 0x23, 0xab, 0x9a, 0xae, 0xd1,
-  0x9d, 0xca, 0xe6, 0x85, 0x36, 0x7f, 0xfc, 0xb8, 0x51, 0xe6, 0x97, 0x0f,
-  0xee, 0x34, 0x51, 0x45, 0x00, 0x49, 0x61, 0xcf, 0x75, 0x74, 0x9b, 0x10,
-  0x2f, 0xaf, 0x9b, 0x35, 0x83, 0x34, 0xb7, 0x8d, 0xee, 0xf2, 0xf5, 0xf7,
-  0x8a, 0xcc, 0x0f, 0xf9, 0x36, 0x9e, 0x28, 0xcd, 0xb4, 0x73, 0xd4, 0xbf,
-  0xfe, 0xc2, 0x81, 0x64, 0xba, 0x70, 0x7b, 0x3c, 0x8f, 0x10, 0x59, 0x8c,
-  0x9d, 0xbe, 0xbf, 0xd4, 0xa3, 0x38, 0x44, 0x05, 0x1d, 0x92, 0xf9, 0xbd,
-  0x55, 0xba, 0x73, 0x91, 0x4c, 0x13, 0x87, 0x7f, 0xa8, 0xac, 0x34, 0xb0,
-  0x2f, 0x7b, 0x31, 0x97, 0xb1, 0xd8, 0x0c, 0x50, 0x54, 0x0d, 0xf0, 0x22,
-  0xff, 0x3f, 0x27, 0x59, 0xf2, 0x5d, 0x17, 0x63, 0x74, 0x5b, 0x8f, 0xb1,
-  0xe6, 0x0e, 0xa2, 0x69, 0x15, 0x44, 0xd9, 0x7a, 0x8a, 0xf9, 0x41, 0xb8,
-  0x33, 0x7c, 0xd2, 0x7d, 0xea, 0x35, 0x77, 0x9e, 0xa2, 0xe5, 0x0d, 0x3e,
-  0x80, 0x49, 0x1c, 0x32, 0x03, 0xcd, 0x25, 0xaa, 0x19, 0xf2, 0xda, 0x77,
-  0x81, 0x7c, 0xc8, 0x32, 0x1f, 0xb2, 0x6b, 0xb3, 0x3b, 0xbb, 0x80, 0x35,
-  0x43, 0x26, 0x9b, 0x46, 0xb7, 0x8e, 0x3d, 0xa1, 0x58, 0x1d, 0x5f, 0x55,
-  0x43, 0x39, 0x9f, 0xe9, 0xfe, 0xae, 0x7d, 0xf3, 0x36, 0x1e, 0x96, 0x7e,
-  0x95, 0x22, 0x12, 0x9d, 0x5d, 0xef, 0xf8, 0xe0, 0x5e, 0xdd, 0x42, 0xa8,
-  0xe1, 0x5f, 0x11, 0xf4, 0xdc, 0x1a, 0x2d, 0x5a, 0x74, 0xa0, 0xc1, 0xe2,
-  0x7d, 0x68, 0xba, 0x34, 0x6e, 0xd3, 0x9b, 0xc5, 0xd4, 0xf9, 0x90, 0xa5,
-  0xb3, 0x3c, 0x81, 0xe8, 0x4e, 0x4f, 0x74, 0x3a, 0x75, 0xae, 0x71, 0x63,
-  0x9e, 0xda, 0x5f, 0x32, 0x35, 0x92, 0xd8, 0x6c, 0x0c, 0x0c, 0x27, 0x05,
-  0x32, 0x67, 0x60, 0xf3, 0x18, 0x74, 0x84, 0x24, 0x81, 0x67, 0xaa, 0xbe,
-  0xe9, 0x0f, 0x0f, 0x73, 0xed, 0x88, 0x51, 0xef, 0x77, 0x5d, 0xe0, 0xc5,
-  0x5a, 0x8d, 0x30, 0x20, 0x3e, 0xc9, 0x6e, 0x3d, 0x1f, 0x1c, 0xaa, 0x67,
-  0x5c, 0xcb, 0x2e, 0x7d, 0x3e, 0xa2, 0xb7, 0xaa, 0xb2, 0x52, 0x75, 0x63,
-  0x16, 0x45, 0x48, 0xe5, 0x99, 0xc7, 0x5c, 0xd8, 0x7e, 0xb4, 0x19, 0x73,
-  0xbc, 0x6f, 0xcc, 0x5d, 0xe8, 0x91, 0xe8, 0x93, 0x96, 0x8f, 0x1d, 0x94,
-  0x84, 0x96, 0x8d, 0xbb, 0x92, 0x77, 0x45, 0xf7, 0xcb, 0x54, 0x81, 0x28,
-  0xa4, 0x7b, 0x6b, 0x3a, 0x7d, 0xd8, 0xba, 0x63, 0xc8, 0x8b, 0x23, 0x55,
-  0x38, 0xd1, 0x87, 0x4f, 0xc9, 0xb3, 0xef, 0xd8, 0xeb, 0x35, 0x7b, 0xc3,
-  0x84, 0x81, 0xbf, 0x2d, 0xd3, 0xbd, 0xd6, 0xf1, 0xb2, 0xba, 0xd8, 0x95,
-  0x52, 0xfe, 0xc2, 0xdc, 0xc2, 0xf7, 0x4a, 0xb4, 0x4d, 0x2e, 0x14, 0xe6,
-  0x70, 0x4e, 0x63, 0x2e, 0xc1, 0x1e, 0x2e, 0xae, 0x4b, 0xb8, 0xf4, 0xe1,
-  0xdd, 0x32, 0xbf, 0x70, 0xc7, 0xd0, 0x63, 0xcc, 0x00, 0xe6, 0x38, 0xbd,
-  0xbb, 0xd7, 0xf3, 0xa4, 0x2c, 0x39, 0x7c, 0x92, 0x8f, 0x69, 0x35, 0x16,
-  0x7f, 0x0c, 0x9a, 0x9e, 0x43, 0xc8, 0x58, 0x46, 0xf3, 0x2c, 0xf9, 0xa6,
-  0x9d, 0xc2, 0x55, 0x64, 0x6f, 0x69, 0xa6, 0xcc, 0x4e, 0x18, 0x8d, 0x91,
-  0xc9, 0x00, 0x0d, 0x74, 0xae, 0xd2, 0x2c, 0x89, 0xfb, 0x47, 0x26, 0xc6,
-  0xb2, 0xe4, 0x22, 0x20, 0xe9, 0x08, 0x73, 0x15, 0x27, 0x6a, 0x5f, 0xf0,
-  0xd0, 0x7f, 0x8e, 0x7e, 0x2d, 0xd4, 0x69, 0x47, 0xd6, 0x94, 0x12, 0xf5,
-  0xe1, 0x11, 0x4d, 0x77, 0x85, 0xf6, 0x2b, 0x3d, 0xd6, 0x85, 0xb3, 0x31,
-  0x8e, 0x10, 0x09, 0x25, 0xad, 0xee, 0x9c, 0xaf, 0x49, 0x36, 0x5f, 0xa8,
-  0xc9, 0x32, 0x87, 0xf8, 0x5e, 0xc5, 0xed, 0x77, 0x88, 0xce, 0x94, 0x3c,
-  0x12, 0x3c, 0xe3, 0x17, 0xc7, 0xe3, 0x93, 0xe7, 0x1e, 0xda, 0x66, 0xe7,
-  0xbf, 0x6f, 0x57, 0x4d, 0x4c, 0xce, 0x80, 0x2e, 0x68, 0xca, 0x47, 0x4f,
-  0x96, 0xee, 0x92, 0x73, 0xa1, 0xe7, 0x6a, 0x92, 0x07, 0xec, 0x7b, 0x7f,
-  0x16, 0x2c, 0xf3, 0x30, 0x30, 0x40, 0xb1, 0x4b, 0x6b, 0xa4, 0xb3, 0x44,
-  0xb7, 0x7d, 0xf7, 0x8e, 0x5e, 0x58, 0x98, 0x0d, 0xb2, 0xf1, 0x7e, 0xe2,
-  0x50, 0x59, 0x08, 0xdc, 0xc7, 0x95, 0x8e, 0x98, 0xa5, 0x75, 0xce, 0x32,
-  0x5d, 0xd1, 0xf0, 0xf1, 0xf9, 0x4f, 0x32, 0xe6, 0x0d, 0xa6, 0x5e, 0x40,
-  0x3a, 0x9d, 0x1c, 0xcd, 0x02, 0xe6, 0xbe, 0x89, 0x9a, 0x2f, 0x66, 0xce,
-  0xc9, 0x22, 0xed, 0x55, 0x63, 0x4b, 0xa2, 0x04, 0x1c, 0x9e, 0xc8, 0xc8,
-  0x6d, 0xb9, 0x17, 0x77, 0xa0, 0xd2, 0x89, 0x90, 0xb2, 0xd4, 0xa6, 0x81,
-  0x14, 0xfa, 0x16, 0xa4, 0xae, 0xff, 0xd8, 0x5d, 0x76, 0xfe, 0x53, 0x1a,
-  0xc2, 0x07, 0xaf, 0x6d, 0xbb, 0x31, 0x73, 0xa2, 0x0d, 0xee, 0x22, 0x24,
-  0xc7, 0xdb, 0xab, 0x7f, 0x39, 0x1e, 0x30, 0x71, 0xdd, 0x4f, 0x8b, 0x04,
-  0x5e, 0xf1, 0x57, 0x78, 0x44, 0x7b, 0x32, 0xad, 0xe7, 0x45, 0xf7, 0x4b,
-  0x9d, 0x39, 0x67, 0xeb, 0x81, 0x38, 0x57, 0xa7, 0x07, 0xf7, 0xec, 0xc8,
-  0x59, 0x00, 0x9a, 0xdf, 0x19, 0x21, 0x36, 0x74, 0xd5, 0xc6, 0xe0, 0x17,
-  0x1f, 0x9a, 0xac, 0x9a, 0xc5, 0x7d, 0x2e, 0xae, 0xba, 0x4b, 0xa2, 0xf4,
-  0xee, 0xb5, 0x75, 0x98, 0x23, 0xaa, 0x0c, 0x02, 0x7d, 0xab, 0xc1, 0x1f,
-  0x7a, 0xc2, 0x38, 0x6f, 0x1d, 0x83, 0x2b, 0xbb, 0x18, 0x02, 0x54, 0x48,
-  0xf0, 0x59, 0x45, 0x3a, 0xab, 0x28, 0x9b, 0xa8, 0xe9, 0x42, 0x58, 0xab,
-  0x35, 0xbb, 0x8e, 0x9d, 0x4d, 0x7e, 0xac, 0x90, 0x5e, 0x71, 0x95, 0xcd,
-  0xe8, 0xb1, 0xe7, 0xdf, 0x77, 0x0f, 0xce, 0x65, 0xfa, 0x23, 0x6f, 0x87,
-  0x7f, 0x5c, 0x1e, 0x7b, 0x7a, 0xd9, 0x45, 0x82, 0x16, 0xf7, 0xab, 0x70,
-  0x9b, 0xd4, 0x15, 0xba, 0x00, 0x70, 0x71, 0xc0, 0x66, 0xb0, 0x35, 0x36,
-  0x24, 0xa8, 0xc7, 0xe1, 0x9a, 0x1f, 0xf7, 0xb7, 0xd2, 0x61, 0x88, 0x8b,
-  0x9c, 0x00, 0x8f, 0xbe, 0xd5, 0x73, 0x75, 0x74, 0xec, 0x9c, 0x9f, 0x1e,
-  0x7d, 0xee, 0x5f, 0xca, 0x91, 0x16, 0x50, 0x86, 0xd6, 0xbd, 0x6d, 0x24,
-  0x2a, 0x99, 0xa7, 0xce, 0xe9, 0x4d, 0xa6, 0xe7, 0xce, 0xc7, 0x8f, 0x45,
-  0xca, 0x4a, 0xc5, 0xcd, 0x19, 0x6b, 0xde, 0x7e, 0x75, 0xad, 0x11, 0x41,
-  0xed, 0xc3, 0x86, 0x5b, 0x26, 0xca, 0xaf, 0x0d, 0x76, 0x94, 0xfe, 0x14,
-  0x2a, 0x32, 0xbd, 0xa7, 0xce, 0xbf, 0x92, 0xf9, 0xfc, 0xa1, 0x7f, 0x5d,
-  0xd6, 0xc7, 0x6a, 0x75, 0xc7, 0xef, 0x81, 0xbb, 0x8d, 0x24, 0x0f, 0xff,
-  0xc8, 0xfe, 0x45, 0x55, 0x43, 0x59, 0xe8, 0x39, 0x32, 0xe0, 0x04, 0x48,
-  0x74, 0x7b, 0x97, 0xe7, 0xbc, 0x26, 0xf3, 0x07, 0xe7, 0xda, 0x7d, 0xcf,
-  0xfd, 0xaf, 0xfd, 0xab, 0x02, 0x0c, 0x15, 0x63, 0xeb, 0x6a, 0x7a, 0x4a,
-  0x67, 0x9a, 0x4e, 0xd2, 0x9b, 0x07, 0xe7, 0xe3, 0x74, 0x9a, 0x7e, 0x2f,
-  0x6e, 0x10, 0xc9, 0x3b, 0x94, 0x9d, 0xbc, 0x63, 0x32, 0xb0, 0xaa, 0x2f,
-  0x53, 0x88, 0x5c, 0x44, 0xf2, 0x88, 0x4c, 0xc9, 0x6a, 0x1a, 0xe9, 0xe9,
-  0xdc, 0xb9, 0x4e, 0xd4, 0xf4, 0x21, 0x5d, 0x54, 0x04, 0x57, 0xbb, 0x77,
-  0x44, 0x69, 0xd2, 0x8f, 0x9c, 0xb9, 0x54, 0x79, 0xce, 0xff, 0xa7, 0x7f,
-  0x4f, 0xd0, 0xcb, 0x00, 0xab, 0x93, 0x41, 0xaf, 0x7e, 0x3b, 0x3d, 0x76,
-  0x85, 0xf3, 0x7b, 0xfa, 0xb0, 0xfc, 0xf5, 0x0a, 0x47, 0xbf, 0xee, 0x3a,
-  0x5d, 0x3c, 0xd9, 0x95, 0x27, 0x43, 0x73, 0x77, 0x87, 0x56, 0x2a, 0x2b,
-  0x9d, 0xaf, 0x0a, 0xa6, 0x5b, 0x3f, 0x4a, 0x78, 0x98, 0x1d, 0x4d, 0x94,
-  0x21, 0x31, 0xbc, 0xb7, 0xd9, 0x62, 0x36, 0xbf, 0x53, 0xb3, 0xb9, 0xce,
-  0x1e, 0xf7, 0x32, 0x71, 0x44, 0x8f, 0x8a, 0x57, 0x08, 0x24, 0xc6, 0x6b,
-  0x21, 0x5d, 0x15, 0x3f, 0x6b, 0xae, 0x1a, 0xed, 0x8b, 0x23, 0x4b, 0xd0,
-  0x81, 0x8e, 0xa1, 0x02, 0xdd, 0x45, 0x81, 0x4e, 0x8f, 0x7e, 0xa8, 0xfb,
-  0xa1, 0x81, 0xf5, 0x2e, 0x35, 0x7f, 0x1f, 0xb5, 0x33, 0x9d, 0x65, 0x2a,
-  0x4b, 0x1c, 0x94, 0xf0, 0x82, 0xfa, 0xd6, 0x08, 0xd5, 0x01, 0xd1, 0xc0,
-  0xbe, 0xb5, 0x78, 0x96, 0x64, 0x7a, 0x36, 0x4f, 0xb3, 0xbb, 0x62, 0x55,
-  0x2e, 0x43, 0x0b, 0x3b, 0x76, 0x2b, 0x78, 0x96, 0xc2, 0x64, 0x6c, 0x6b,
-  0xc0, 0x58, 0xf3, 0x6e, 0x3d, 0x68, 0x4d, 0x4d, 0x34, 0xa5, 0xd6, 0x5f,
-  0x6b, 0x0f, 0x7c, 0xdf, 0xe2, 0xfb, 0xbc, 0x98, 0x3a, 0x7f, 0x16, 0x85,
-  0x23, 0xcf, 0xdd, 0x22, 0x80, 0x24, 0xa6, 0x2b, 0x4e, 0x11, 0x36, 0x4b,
-  0xda, 0x56, 0x62, 0x3f, 0x42, 0x79, 0xc0, 0x45, 0x1a, 0xbc, 0x30, 0xc2,
-  0xee, 0x35, 0xdb, 0x8d, 0x0b, 0x72, 0xbe, 0x1f, 0x29, 0x42, 0x6e, 0x31,
-  0x8d, 0x75, 0x56, 0x95, 0x0e, 0xe2, 0xb5, 0x83, 0x22, 0xf7, 0xf4, 0x7d,
-  0x41, 0x68, 0xde, 0xf8, 0xa5, 0x49, 0x36, 0x91, 0x6b, 0xd7, 0x21, 0xdc,
-  0x75, 0x0b, 0x9f, 0x98, 0xf9, 0xfe, 0x36, 0x94, 0xe4, 0x46, 0x67, 0xb9,
-  0x6f, 0xbc, 0xa5, 0x3f, 0xe5, 0xd9, 0xd7, 0x58, 0x1d, 0x11, 0xe2, 0x1a,
-  0x53, 0x88, 0xf2, 0xd1, 0xfd, 0x1c, 0x5f, 0xdf, 0xcf, 0x35, 0xa9, 0x21,
-  0x16, 0x8d, 0x4f, 0x77, 0x78, 0xc8, 0xb2, 0x09, 0xc2, 0x48, 0x0c, 0x8c,
-  0x6a, 0xcd, 0x92, 0x47, 0xcd, 0x52, 0x1e, 0x47, 0xed, 0xf3, 0x7d, 0x83,
-  0xf4, 0x70, 0x89, 0x84, 0x21, 0x10, 0x32, 0xe9, 0x9d, 0xd6, 0xce, 0x76,
-  0x5e, 0x3d, 0xad, 0x36, 0xac, 0xaa, 0xd3, 0x10, 0x35, 0xd1, 0xe6, 0xd2,
-  0x02, 0xd8, 0x8d, 0x0a, 0x2a, 0x47, 0x35, 0x32, 0x0f, 0x8b, 0x1c, 0xdd,
-  0xed, 0x87, 0x45, 0x67, 0xae, 0xe5, 0x99, 0x3e, 0x76, 0x8b, 0xb1, 0xbb,
-  0xbb, 0x12, 0x2c, 0xb2, 0xa9, 0xba, 0xd3, 0xd3, 0xf9, 0xd0, 0x3b, 0xbd,
-  0xaa, 0x32, 0x5f, 0x6e, 0xd3, 0xca, 0xd2, 0xe9, 0x2c, 0xef, 0x39, 0xd0,
-  0xbf, 0xc8, 0xb8, 0x1c, 0xa3, 0x58, 0xb2, 0x91, 0x34, 0x7c, 0x97, 0x7b,
-  0x52, 0x8e, 0x29, 0x30, 0xd4, 0x7d, 0xad, 0xb1, 0x26, 0x14, 0xfa, 0x20,
-  0x81, 0x1a, 0xaf, 0x81, 0x50, 0xc5, 0xbe, 0xe7, 0x7b, 0x21, 0xb9, 0x6e,
-  0xfa, 0xeb, 0x78, 0xe4, 0x5c, 0xdd, 0x66, 0xe9, 0x7c, 0x3e, 0xd1, 0xeb,
-  0x9d, 0xdf, 0x5f, 0x6f, 0xfc, 0xc1, 0x66, 0xdf, 0xf7, 0x96, 0x24, 0xc8,
-  0x2e, 0x2f, 0x49, 0xf5, 0x8d, 0xf1, 0xfc, 0xb6, 0xc9, 0x2f, 0x96, 0x16,
-  0x2d, 0x86, 0x40, 0x48, 0x32, 0x93, 0x3f, 0x92, 0xa9, 0x33, 0xba, 0x4d,
-  0xa3, 0x6f, 0x87, 0x35, 0x00, 0x44, 0x9c, 0xa0, 0xad, 0xcf, 0x02, 0xd4,
-  0x67, 0xa9, 0x4f, 0x2c, 0xaa, 0x2f, 0x38, 0x08, 0xa0, 0x7c, 0xcc, 0x6c,
-  0x17, 0xca, 0x92, 0x49, 0x7e, 0xe1, 0x43, 0x76, 0x90, 0x56, 0x88, 0x5e,
-  0xc0, 0xaf, 0x23, 0x8c, 0x58, 0x33, 0xfd, 0x46, 0x59, 0x5c, 0xa7, 0x4a,
-  0xd7, 0xdb, 0xf6, 0x7d, 0xbf, 0x4c, 0x93, 0xfb, 0x3c, 0x57, 0xfc, 0x8b,
-  0xdb, 0xc7, 0x94, 0x34, 0x84, 0xe2, 0x42, 0x01, 0x3d, 0x8c, 0xb6, 0xb0,
-  0x2c, 0x3e, 0xab, 0x1b, 0x4d, 0x0d, 0x63, 0x7f, 0xb6, 0xd4, 0xb2, 0x93,
-  0x28, 0x07, 0x57, 0x6e, 0xab, 0xcb, 0x88, 0x36, 0xff, 0xe8, 0xd7, 0xe5,
-  0x18, 0x13, 0x6c, 0x9c, 0xff, 0x75, 0x35, 0x40, 0x0d, 0x18, 0xdc, 0xd4,
-  0xd5, 0x56, 0xa4, 0xfa, 0xfa, 0x8d, 0x85, 0x0b, 0x9a, 0x48, 0x83, 0xd8,
-  0xa8, 0x4f, 0x25, 0x78, 0x80, 0x6f, 0x70, 0x9e, 0x9b, 0xdb, 0x4b, 0x5a,
-  0xa0, 0xca, 0x38, 0xf8, 0x35, 0x60, 0xe0, 0x6d, 0xba, 0x4c, 0xf6, 0x21,
-  0x27, 0xf4, 0x6b, 0x10, 0xb5, 0xeb, 0xc0, 0xd1, 0xa5, 0x18, 0x0a, 0x7d,
-  0x5b, 0x95, 0x0f, 0xba, 0xb3, 0x3f, 0xab, 0x58, 0x01, 0xbc, 0xed, 0xfd,
-  0x45, 0x58, 0xda, 0x1d, 0xd2, 0x60, 0xc8, 0xc7, 0xc8, 0x1d, 0x36, 0xde,
-  0xaa, 0xf4, 0x37, 0x59, 0xb3, 0xa8, 0x3a, 0x9a, 0xf9, 0x26, 0x1b, 0x67,
-  0xbe, 0xd1, 0x07, 0xec, 0x59, 0x0c, 0x4d, 0xac, 0x8d, 0xfb, 0xec, 0xcd,
-  0x2f, 0xca, 0xd2, 0x5d, 0x81, 0xdc, 0x30, 0x65, 0xdd, 0x3e, 0x8c, 0x89,
-  0xa7, 0x3a, 0x17, 0x2e, 0x67, 0x72, 0xe5, 0x5c, 0xc8, 0x1d, 0x30, 0x5f,
-  0x93, 0x30, 0x2b, 0x2e, 0x20, 0xca, 0x44, 0xab, 0x1e, 0x1d, 0x3f, 0x68,
-  0xfd, 0x94, 0x22, 0x45, 0x27, 0x5f, 0xf5, 0x34, 0xbd, 0xeb, 0x67, 0xfc,
-  0x97, 0x90, 0x09, 0xab, 0xc8, 0x38, 0x47, 0x59, 0xa4, 0x62, 0xbd, 0xd6,
-  0x9c, 0xe7, 0x24, 0x45, 0xd8, 0xd4, 0xf5, 0x9d, 0x7d, 0xda, 0x83, 0xaa,
-  0xc0, 0x81, 0x6d, 0x8b, 0x99, 0x44, 0xf3, 0x2c, 0xf9, 0xb9, 0x2c, 0x68,
-  0xbf, 0xcc, 0xd2, 0xa2, 0x56, 0xec, 0x8d, 0xc8, 0xea, 0xbd, 0xbc, 0xac,
-  0x74, 0x05, 0x3c, 0x8f, 0xe4, 0xb4, 0x32, 0x4b, 0xc5, 0xa1, 0xde, 0x92,
-  0xfc, 0xfb, 0xff, 0x29, 0xb0, 0x73, 0xa2, 0xbf, 0x27, 0x51, 0x45, 0x89,
-  0xba, 0x5c, 0x47, 0x61, 0xdd, 0x75, 0x14, 0xd6, 0xdb, 0x44, 0x61, 0xfd,
-  0x42, 0xca, 0x50, 0xae, 0x65, 0xa4, 0x3b, 0x5d, 0xb0, 0x2f, 0x2e, 0x85,
-  0x58, 0xbf, 0xcc, 0x11, 0xf6, 0x47, 0xa6, 0x70, 0x6f, 0x7f, 0x07, 0xd1,
-  0xa8, 0xbf, 0x83, 0x0a, 0xa5, 0xb7, 0xc5, 0xe6, 0x2f, 0x95, 0x65, 0x49,
-  0x9a, 0xe5, 0x6b, 0xfc, 0x5e, 0xc5, 0xce, 0xef, 0x23, 0xf0, 0x79, 0xff,
-  0x1a, 0x3a, 0x78, 0x1a, 0xe4, 0x2a, 0x80, 0xc1, 0xb7, 0xf1, 0x24, 0x89,
-  0xf3, 0x85, 0xf4, 0x45, 0x22, 0x4c, 0x8c, 0xf7, 0xf6, 0x6e, 0x79, 0x6f,
-  0xcf, 0xf7, 0xba, 0x14, 0xd8, 0xd6, 0xa5, 0x60, 0xf6, 0x67, 0x4e, 0xdb,
-  0x9c, 0x7e, 0xce, 0x50, 0x16, 0x1f, 0xa0, 0x08, 0x8f, 0x49, 0x1c, 0xa9,
-  0x79, 0x6f, 0x5e, 0x2f, 0x25, 0x3c, 0x50, 0x50, 0x1e, 0xe9, 0xe4, 0xbb,
-  0xce, 0x92, 0xa9, 0xee, 0x1b, 0x11, 0xa6, 0x8b, 0x57, 0x7f, 0xf5, 0x98,
-  0x18, 0xdb, 0xeb, 0x30, 0xfd, 0xe9, 0x70, 0x17, 0x88, 0x4b, 0xfe, 0xbc,
-  0x45, 0xd7, 0x07, 0x2b, 0xb1, 0x26, 0x6d, 0xd3, 0x5c, 0xe1, 0xd5, 0x09,
-  0xd7, 0x9b, 0x89, 0x27, 0x6c, 0x18, 0x08, 0x69, 0x66, 0xd3, 0xbf, 0xec,
-  0x7b, 0x42, 0xc7, 0x15, 0xe2, 0x45, 0x35, 0xc7, 0xa3, 0x6b, 0xa4, 0xa5,
-  0xea, 0xd4, 0xa4, 0x92, 0xfb, 0xcd, 0x74, 0xe7, 0xc5, 0xd7, 0xd5, 0x33,
-  0xd2, 0x69, 0xbf, 0xb2, 0xdc, 0x70, 0xb0, 0x3a, 0x06, 0x36, 0xfc, 0x2d,
-  0x6b, 0x8e, 0x47, 0xd7, 0x95, 0x2d, 0x1d, 0xa9, 0x41, 0xac, 0xfa, 0x98,
-  0x0f, 0x9a, 0x63, 0x60, 0xe3, 0x6b, 0x60, 0x75, 0x6c, 0x7a, 0xd4, 0xf7,
-  0x8f, 0xd0, 0x09, 0x90, 0xd2, 0x19, 0x34, 0x47, 0xc5, 0x18, 0x16, 0x5f,
-  0xe3, 0x78, 0xd8, 0xad, 0x8c, 0x74, 0xf0, 0x55, 0xd1, 0x51, 0xb2, 0xad,
-  0xe6, 0xb0, 0xc3, 0xb1, 0x41, 0x77, 0x0c, 0xc3, 0xaa, 0xaa, 0x66, 0xe3,
-  0xeb, 0xae, 0x5b, 0x9c, 0xc3, 0xeb, 0x4d, 0xe4, 0x96, 0x55, 0xf2, 0x92,
-  0x0f, 0x16, 0xc7, 0x44, 0x67, 0x1c, 0x8f, 0xd5, 0xcb, 0xd3, 0x69, 0x4e,
-  0xe3, 0x30, 0x87, 0x03, 0xdf, 0xe0, 0x00, 0x17, 0xf1, 0xfc, 0x7b, 0x15,
-  0xbf, 0xce, 0x16, 0x77, 0x07, 0xf3, 0x54, 0x94, 0xd1, 0x53, 0xf9, 0x2b,
-  0xc9, 0xf4, 0x44, 0xcf, 0x66, 0xce, 0x67, 0x1d, 0xe9, 0xe4, 0x7b, 0x9f,
-  0xdd, 0x39, 0x50, 0x10, 0xee, 0x40, 0x2a, 0xca, 0x75, 0xfe, 0x0f, 0x0c,
-  0x59, 0x27, 0xfd, 0xec, 0x74, 0x0d, 0xca, 0xf7, 0x77, 0x10, 0xed, 0x23,
-  0xe3, 0x75, 0xc4, 0xbe, 0xb2, 0xc6, 0x45, 0x9f, 0x84, 0x0c, 0x82, 0x89,
-  0xcc, 0x0b, 0xec, 0xca, 0x7f, 0xb7, 0x76, 0x59, 0xfe, 0x3e, 0x40, 0xb0,
-  0x5b, 0x81, 0x4b, 0x0b, 0x02, 0xac, 0xc8, 0x20, 0x2f, 0xd1, 0x84, 0xc1,
-  0xe6, 0x92, 0x08, 0x1e, 0x5d, 0x12, 0x61, 0x81, 0x25, 0xf4, 0xf7, 0xd5,
-  0x08, 0x63, 0xf3, 0x97, 0x5a, 0x49, 0xc9, 0xb9, 0x6c, 0x94, 0xed, 0xcb,
-  0xf6, 0x53, 0x21, 0xd9, 0xbe, 0xbe, 0xff, 0xc4, 0x95, 0x54, 0xf0, 0xd9,
-  0x47, 0x05, 0x59, 0x97, 0x4a, 0xa7, 0xe9, 0xdd, 0x81, 0x7c, 0x56, 0xfb,
-  0xd2, 0x59, 0x32, 0xcc, 0x40, 0x66, 0x88, 0xfc, 0xf2, 0x41, 0x67, 0x0c,
-  0x64, 0xfc, 0x4a, 0x32, 0x43, 0x54, 0x13, 0x18, 0xb0, 0x41, 0x63, 0xaa,
-  0xc8, 0xf8, 0xd2, 0x92, 0x4c, 0xf7, 0x4f, 0x88, 0x44, 0x70, 0xef, 0x2d,
-  0xa9, 0x84, 0x77, 0x40, 0x8d, 0x08, 0x7e, 0x2d, 0x18, 0x04, 0x4a, 0xa6,
-  0x59, 0xb2, 0x37, 0xe2, 0x5e, 0x32, 0xa2, 0x05, 0x19, 0xd2, 0x07, 0xda,
-  0xe5, 0x55, 0x7e, 0xed, 0xa7, 0xa9, 0x7e, 0xa1, 0x5d, 0xd9, 0x6f, 0x69,
-  0x61, 0x0f, 0xb9, 0x9c, 0x20, 0x82, 0xb0, 0x9a, 0xcd, 0xb0, 0xfb, 0xc4,
-  0x08, 0x6c, 0x60, 0x63, 0x60, 0x13, 0x0f, 0x6c, 0x4c, 0x6c, 0x34, 0x0c,
-  0x6c, 0x8c, 0x6c, 0xf8, 0xc0, 0xc6, 0xc8, 0x46, 0x99, 0xd9, 0x0c, 0x77,
-  0xf8, 0xe3, 0xc1, 0xe2, 0x98, 0xd9, 0x8c, 0x07, 0xcd, 0x31, 0xd7, 0x8a,
-  0x28, 0x7f, 0xd0, 0x1c, 0x13, 0x9b, 0xc8, 0x82, 0x4d, 0x6f, 0x9e, 0x53,
-  0xa5, 0x57, 0xb1, 0x5c, 0x49, 0x51, 0x0d, 0x67, 0x30, 0x39, 0xc8, 0xab,
-  0x0e, 0x0e, 0xc5, 0xab, 0x76, 0x04, 0x4f, 0xcf, 0x9e, 0xff, 0xa3, 0xaf,
-  0xb6, 0xbb, 0x40, 0xee, 0x0f, 0x74, 0xfa, 0xb3, 0xcf, 0xed, 0x0c, 0x84,
-  0x84, 0x68, 0x95, 0x62, 0xcf, 0x77, 0xc0, 0x38, 0xa3, 0x3f, 0x5c, 0x29,
-  0xdd, 0x0f, 0xff, 0xea, 0xd5, 0x6b, 0xf6, 0xb4, 0x8c, 0x93, 0x84, 0x2b,
-  0xce, 0xb5, 0xea, 0x6e, 0xe1, 0xb7, 0x7c, 0x72, 0x17, 0x2e, 0x8f, 0x79,
-  0x4b, 0x7d, 0x11, 0x1c, 0xb7, 0x79, 0x24, 0x2a, 0xbd, 0x4b, 0xf6, 0x5e,
-  0x4c, 0xc2, 0x13, 0x97, 0x13, 0x83, 0x5f, 0xda, 0x96, 0x4b, 0x99, 0x2f,
-  0x2a, 0xeb, 0xdb, 0x72, 0x51, 0x4e, 0x9c, 0x4b, 0xa8, 0xe2, 0x74, 0x7d,
-  0x71, 0x7e, 0x09, 0xf8, 0xdf, 0x17, 0x87, 0xa3, 0x84, 0xac, 0x9e, 0x52,
-  0x43, 0x2c, 0xed, 0xbb, 0x93, 0x85, 0x11, 0x2b, 0x36, 0x28, 0x70, 0xf7,
-  0x63, 0x78, 0x57, 0x0c, 0x2a, 0x77, 0x52, 0xdf, 0x15, 0x3f, 0xb6, 0x6c,
-  0x23, 0xf8, 0xbe, 0xf8, 0xe7, 0xfc, 0xe1, 0xb2, 0xf7, 0xab, 0x7f, 0x7e,
-  0xaf, 0xc4, 0xe1, 0xa1, 0x35, 0x55, 0xad, 0x16, 0x8d, 0xde, 0xec, 0x00,
-  0xfe, 0x4c, 0xa6, 0xf7, 0x8b, 0xf9, 0x3f, 0xae, 0x3f, 0xe6, 0x7f, 0x86,
-  0xad, 0xbb, 0x68, 0xe7, 0x2c, 0x56, 0x7b, 0x38, 0x51, 0xa5, 0xb9, 0xce,
-  0xee, 0x92, 0xa9, 0x9a, 0xa7, 0x99, 0x73, 0x92, 0xdc, 0x24, 0x73, 0xf2,
-  0xa8, 0xfe, 0xe1, 0x1a, 0x02, 0xe6, 0xba, 0x47, 0xce, 0x54, 0x55, 0x46,
-  0xf9, 0x5e, 0xc5, 0xf1, 0x44, 0x63, 0x2e, 0x58, 0xf1, 0xc9, 0xf2, 0x69,
-  0x6a, 0x14, 0x4c, 0x66, 0x94, 0x17, 0x2d, 0x7c, 0xb2, 0x7f, 0x12, 0x4a,
-  0x8c, 0x49, 0x9f, 0x85, 0xff, 0x39, 0xb9, 0x72, 0x8e, 0xa6, 0x71, 0x96,
-  0x26, 0xf1, 0xb3, 0x98, 0x6b, 0x64, 0x5d, 0xea, 0xa2, 0x48, 0x32, 0xb4,
-  0x24, 0xc0, 0x36, 0x2c, 0x9d, 0xa5, 0xf7, 0x93, 0xc5, 0xcc, 0xd8, 0x4b,
-  0x1d, 0xf1, 0x15, 0xf5, 0x26, 0x05, 0xcb, 0xb6, 0x9b, 0x44, 0x8d, 0xc0,
-  0x2a, 0x43, 0x0b, 0x75, 0x35, 0x99, 0x4b, 0x51, 0x2e, 0xb7, 0x3e, 0xbe,
-  0xe6, 0xf3, 0xff, 0x01
+/* Generated by tools/gen_gcdb.sh. Do not edit. */
+#pragma once
+
+/* Separately compressed chunk of the game controller database. */
+struct gcdb_chunk_s
+{
+	char first_guid[33];
+	unsigned long offset;
+	unsigned long len;
+	unsigned long txt_len;
+};
+
+static const unsigned char gcdb_bin[] = {
+  0xe5, 0x58, 0xcb, 0x72, 0x9b, 0x30, 0x14, 0xdd, 0xf7, 0x2b, 0xb4, 0xaf,
+  0xda, 0xd1, 0x03, 0x61, 0x60, 0xe7, 0x38, 0x71, 0x93, 0xe9, 0xa4, 0xc9,
+  0x84, 0x64, 0x9a, 0xad, 0x30, 0x24, 0x66, 0x6c, 0x83, 0x07, 0xc4, 0x34,
+  0xfe, 0xfb, 0x8a, 0x67, 0x10, 0x60, 0x63, 0x62, 0xe7, 0xd5, 0x7a, 0x61,
+  0x4b, 0x18, 0xd0, 0xb9, 0xe7, 0xbe, 0x8e, 0x84, 0x28, 0x2a, 0x3f, 0x2c,
+  0xfd, 0x22, 0x86, 0xe9, 0xa0, 0xda, 0x07, 0xda, 0xde, 0x23, 0x07, 0x36,
+  0x17, 0x49, 0x14, 0x80, 0xb1, 0xcb, 0xd7, 0xc2, 0x8b, 0x20, 0xb7, 0x1c,
+  0x0c, 0x1d, 0xcb, 0x21, 0xd0, 0x5d, 0xbb, 0xe1, 0x9f, 0xc0, 0xfa, 0xca,
+  0xb1, 0x1c, 0x2e, 0xbd, 0x07, 0x61, 0x7d, 0xe3, 0x48, 0x0e, 0x23, 0xff,
+  0x71, 0x2e, 0xe4, 0xe5, 0x74, 0x9c, 0xac, 0xe5, 0x45, 0x0c, 0xd3, 0x7f,
+  0xe3, 0x79, 0x98, 0x2c, 0x5d, 0x2f, 0xb2, 0x1c, 0x3d, 0x9b, 0x0b, 0x79,
+  0xdf, 0x63, 0x3a, 0xd5, 0x60, 0xf6, 0xc4, 0xf3, 0xff, 0xa3, 0xfc, 0x42,
+  0x75, 0x03, 0x83, 0xb1, 0xe0, 0x91, 0xb0, 0x1c, 0x13, 0x3e, 0x59, 0x0e,
+  0x82, 0x1b, 0xcb, 0xa1, 0x70, 0xbd, 0xe4, 0xe2, 0x21, 0x8c, 0x56, 0xd6,
+  0x6f, 0x3f, 0x90, 0x38, 0x62, 0xf8, 0x05, 0x3d, 0x9b, 0xf3, 0x90, 0x7d,
+  0x63, 0xa4, 0x7c, 0xe0, 0xaf, 0x33, 0x1b, 0x4c, 0xc2, 0x40, 0x44, 0xe1,
+  0x72, 0x59, 0xb3, 0x04, 0x41, 0x87, 0xcf, 0x16, 0x03, 0x2d, 0x2a, 0x10,
+  0xed, 0xc6, 0x61, 0xe4, 0x3f, 0x44, 0x05, 0x02, 0x8d, 0x13, 0x5f, 0x9c,
+  0x86, 0x60, 0x4a, 0x51, 0x8a, 0x01, 0xa5, 0x18, 0x70, 0x81, 0x01, 0xa3,
+  0x12, 0xc4, 0x1c, 0x7d, 0xd7, 0x4a, 0x14, 0x72, 0x6c, 0x54, 0x30, 0xe4,
+  0x84, 0xe4, 0x38, 0xe4, 0xa8, 0x87, 0x5a, 0x23, 0x9b, 0x3e, 0x59, 0x12,
+  0x79, 0x3a, 0xd8, 0x58, 0x12, 0x79, 0x0f, 0xd9, 0x66, 0x3e, 0x97, 0xcf,
+  0x90, 0x7c, 0x24, 0x1f, 0xaa, 0x1c, 0x80, 0x71, 0xea, 0x01, 0x9a, 0x7a,
+  0x40, 0xdb, 0x69, 0x79, 0xee, 0x80, 0x9a, 0x47, 0x72, 0xcb, 0x6f, 0x3c,
+  0x49, 0xfe, 0x9d, 0x7d, 0x02, 0xb2, 0xc1, 0x35, 0x77, 0x2b, 0x27, 0xb0,
+  0x97, 0x38, 0xa1, 0x69, 0x7b, 0xcb, 0xb4, 0xca, 0x4b, 0x65, 0xdc, 0xec,
+  0x85, 0xda, 0x68, 0xa0, 0xae, 0xa7, 0x41, 0x47, 0xfc, 0x0c, 0x82, 0xdc,
+  0xc3, 0x3e, 0x2d, 0x21, 0xa3, 0x14, 0x32, 0x4b, 0x21, 0xeb, 0x7b, 0x40,
+  0x7e, 0xc0, 0xdb, 0x88, 0xb6, 0x93, 0xb5, 0x17, 0x15, 0x74, 0x87, 0x91,
+  0xf8, 0x50, 0x7c, 0x57, 0x79, 0x61, 0xaa, 0xe0, 0xa7, 0x13, 0x8a, 0xc0,
+  0x75, 0x14, 0xb6, 0x32, 0xf4, 0xd0, 0xec, 0xc8, 0xd3, 0x21, 0x16, 0x7e,
+  0xf6, 0x32, 0xaa, 0xe6, 0x8a, 0xde, 0x9f, 0x2b, 0x45, 0x6e, 0x94, 0x2f,
+  0xd0, 0x1a, 0xce, 0x1b, 0x55, 0xa9, 0x43, 0xab, 0xd4, 0xd1, 0xd4, 0xd4,
+  0xd1, 0x7a, 0x8b, 0x17, 0x21, 0xdd, 0xa4, 0x14, 0x45, 0x43, 0xd6, 0xb0,
+  0x57, 0x22, 0x47, 0xdf, 0x45, 0xce, 0xfe, 0x85, 0x64, 0x1b, 0x39, 0xe6,
+  0x31, 0xc8, 0xa1, 0x48, 0x4b, 0x7f, 0x66, 0xd8, 0x1c, 0xa9, 0x19, 0xda,
+  0x2e, 0xed, 0x59, 0x59, 0xd5, 0x5e, 0x3d, 0xca, 0x71, 0x8a, 0x99, 0xed,
+  0xc2, 0xcc, 0x50, 0xd1, 0x54, 0x35, 0xa6, 0x76, 0x23, 0xef, 0x29, 0x89,
+  0x5b, 0x0d, 0xc0, 0x3c, 0xcc, 0x89, 0x5a, 0xdd, 0x89, 0x23, 0xc5, 0x87,
+  0xb2, 0x8a, 0xf7, 0xfa, 0x90, 0x29, 0x3e, 0x34, 0x54, 0x17, 0x72, 0xad,
+  0xa3, 0x35, 0x54, 0x05, 0x0b, 0x67, 0x15, 0x8b, 0xf4, 0xba, 0xb0, 0xa4,
+  0x83, 0x8d, 0x94, 0x00, 0x87, 0x63, 0xfb, 0xce, 0x06, 0x37, 0x57, 0x3f,
+  0xc0, 0xcf, 0x24, 0xe0, 0x3e, 0xa0, 0x47, 0x68, 0x8d, 0x8f, 0x89, 0xef,
+  0x7a, 0xf2, 0x41, 0xf2, 0xe1, 0x22, 0xbd, 0xbf, 0x83, 0x96, 0x34, 0xe9,
+  0x9f, 0x88, 0xa6, 0x95, 0x1f, 0xcf, 0xb0, 0xbc, 0x95, 0xbd, 0x23, 0x61,
+  0xd8, 0xc0, 0x5c, 0xed, 0x84, 0x92, 0xab, 0xc9, 0x9c, 0x2f, 0x22, 0xbe,
+  0x02, 0xf7, 0xb5, 0xa2, 0xd9, 0x86, 0x3f, 0x24, 0x7c, 0x31, 0x7f, 0x9b,
+  0x65, 0x66, 0x6f, 0xb2, 0x0c, 0x33, 0xb0, 0xb9, 0x75, 0x99, 0x49, 0x18,
+  0x79, 0x47, 0x5b, 0xc9, 0xa3, 0xd8, 0xd8, 0xb6, 0xd2, 0xf1, 0x16, 0x61,
+  0xaf, 0xb9, 0x88, 0xa1, 0x67, 0xbd, 0x47, 0xd7, 0x89, 0xae, 0x2e, 0xc2,
+  0x5d, 0x3f, 0xb4, 0xe7, 0x32, 0x09, 0xd3, 0x35, 0x48, 0x3d, 0x27, 0x8d,
+  0x23, 0x16, 0x75, 0x8c, 0x06, 0xcb, 0x16, 0xb5, 0xaa, 0x63, 0xbc, 0x55,
+  0xb6, 0x74, 0x28, 0x7e, 0xb3, 0xca, 0x3e, 0xb4, 0x8b, 0x14, 0x13, 0x67,
+  0xb2, 0x45, 0xd3, 0x0c, 0x95, 0xf9, 0xcb, 0x3b, 0xfb, 0x62, 0x0c, 0xae,
+  0x97, 0x7c, 0x63, 0x0b, 0x2e, 0xfc, 0x30, 0x00, 0x04, 0x5c, 0x04, 0xeb,
+  0x44, 0x80, 0x53, 0x3f, 0x96, 0xef, 0xdb, 0x54, 0xf5, 0x8b, 0x14, 0x5c,
+  0x69, 0x47, 0x94, 0x78, 0x8d, 0xdd, 0x10, 0x46, 0x43, 0x25, 0x5e, 0x53,
+  0x9e, 0x97, 0xdc, 0x75, 0xb7, 0x40, 0x56, 0x09, 0x82, 0x9d, 0x01, 0xe4,
+  0xe4, 0x22, 0x86, 0x22, 0x5d, 0x15, 0x04, 0xa9, 0x5c, 0x57, 0x35, 0xcc,
+  0x7f, 0x16, 0x44, 0x25, 0x31, 0xb4, 0x41, 0xcc, 0x24, 0x5c, 0xad, 0x3d,
+  0xe1, 0x67, 0xe1, 0x53, 0x28, 0x5f, 0xa5, 0xe5, 0x91, 0x0e, 0xf4, 0xfb,
+  0xec, 0xcf, 0xdd, 0xfc, 0xd8, 0x03, 0x11, 0x75, 0xc7, 0x07, 0x4f, 0xbc,
+  0xe5, 0xc2, 0x0f, 0xc0, 0xaf, 0x30, 0x96, 0xbe, 0x58, 0x49, 0xcd, 0xad,
+  0xb5, 0x37, 0xea, 0x47, 0xf1, 0x46, 0xed, 0x84, 0xa3, 0x97, 0x7f, 0x7d,
+  0x2b, 0xe1, 0xac, 0x22, 0x9c, 0x28, 0x84, 0xf7, 0x97, 0xb2, 0x92, 0x00,
+  0xda, 0x20, 0xa0, 0x66, 0x39, 0x3b, 0xdc, 0xf2, 0x42, 0x5f, 0x98, 0x3b,
+  0x03, 0x92, 0xbc, 0x94, 0x90, 0xfe, 0x80, 0xa4, 0x6d, 0x7e, 0xf6, 0x15,
+  0xab, 0x6e, 0x75, 0x92, 0xa4, 0x6c, 0xb0, 0xe1, 0x79, 0x18, 0xf9, 0xe0,
+  0xd2, 0x0f, 0x7c, 0x70, 0xce, 0x45, 0x9c, 0x04, 0x9e, 0x9c, 0x2c, 0x12,
+  0x30, 0xbd, 0xad, 0x1d, 0x0a, 0x7c, 0xd6, 0xac, 0xa5, 0x03, 0x4f, 0xdb,
+  0x4a, 0x8e, 0xb4, 0x06, 0x47, 0x57, 0xc1, 0xe6, 0xa9, 0x15, 0x3c, 0xfa,
+  0x11, 0xe9, 0x30, 0x86, 0x9a, 0xbf, 0x53, 0x67, 0x8e, 0x86, 0x45, 0x84,
+  0xd9, 0x38, 0x70, 0xc9, 0x22, 0xe2, 0x9a, 0xbb, 0x80, 0x82, 0xdb, 0x24,
+  0x72, 0xc2, 0xc3, 0x03, 0x61, 0x9b, 0x2c, 0xff, 0x44, 0x21, 0xc1, 0xbb,
+  0x48, 0x3a, 0xbd, 0x1a, 0xbf, 0x4e, 0x58, 0x0c, 0xd9, 0xc2, 0xb1, 0x21,
+  0x5b, 0x90, 0x81, 0xa1, 0x31, 0x6b, 0x5a, 0x7d, 0x76, 0x7f, 0xfb, 0x06,
+  0x89, 0x30, 0x48, 0xe6, 0x74, 0x26, 0x46, 0x97, 0xcc, 0x39, 0x9c, 0x0e,
+  0xb7, 0x2b, 0x08, 0xa6, 0xd5, 0xea, 0xe0, 0xec, 0x9e, 0xb4, 0xd8, 0x19,
+  0x7d, 0x5e, 0x76, 0xf4, 0x41, 0xec, 0x34, 0xce, 0x6d, 0x5b, 0xec, 0xfc,
+  0x03, 0xfd, 0x84, 0xbd, 0xac, 0x78, 0x60, 0xdc, 0xc5, 0xcc, 0x8d, 0xc7,
+  0x97, 0x60, 0x1c, 0xcd, 0xb8, 0xeb, 0xa5, 0x52, 0x30, 0x3f, 0xff, 0x78,
+  0x97, 0x3a, 0x3b, 0x94, 0x98, 0xbd, 0x48, 0xf8, 0x0b,
+  0xed, 0x99, 0xcb, 0x72, 0x9b, 0x30, 0x14, 0x86, 0xf7, 0x7d, 0x0a, 0x3d,
+  0x80, 0xa6, 0xa3, 0x1b, 0x60, 0xb3, 0xcb, 0x64, 0x9a, 0x76, 0xd1, 0x0b,
+  0x53, 0x77, 0x92, 0x6c, 0x85, 0xc1, 0x36, 0x13, 0x0c, 0x1e, 0x0c, 0x53,
+  0xe7, 0xed, 0x2b, 0x01, 0x25, 0x40, 0xc0, 0x16, 0x18, 0xec, 0xa6, 0xc4,
+  0x1b, 0x4b, 0xc6, 0x12, 0x9c, 0x4f, 0xff, 0x7f, 0x24, 0x24, 0x44, 0x51,
+  0xf6, 0x71, 0xd0, 0x4a, 0x7e, 0x61, 0x8c, 0x51, 0xf9, 0x03, 0x3f, 0xf3,
+  0xad, 0xbb, 0x88, 0xbd, 0xe5, 0x13, 0xb8, 0x0d, 0x83, 0x38, 0x0a, 0x7d,
+  0xdf, 0x8d, 0x20, 0x37, 0x6d, 0x04, 0x6d, 0xd3, 0xc6, 0xd0, 0xd9, 0x39,
+  0xe1, 0xef, 0xc0, 0xdc, 0xa0, 0x8f, 0x4c, 0x94, 0x7d, 0x77, 0x15, 0xcb,
+  0xf2, 0x4c, 0x94, 0x23, 0x6f, 0xbd, 0x49, 0x2b, 0x44, 0x54, 0x92, 0x9d,
+  0x2c, 0x61, 0x28, 0xff, 0xb0, 0xdf, 0x84, 0x89, 0xef, 0xb8, 0x91, 0x69,
+  0xeb, 0x59, 0x5d, 0xf6, 0x2e, 0xfa, 0xa2, 0x69, 0xed, 0x60, 0x72, 0x94,
+  0x16, 0x9e, 0x4d, 0x8e, 0x61, 0xda, 0xc9, 0x4b, 0x03, 0x23, 0xff, 0x21,
+  0x6f, 0xc1, 0xb2, 0xaa, 0x68, 0x42, 0xb2, 0x92, 0x68, 0xa3, 0xc1, 0x7d,
+  0xcc, 0xa3, 0x58, 0x5c, 0xc5, 0xf0, 0x60, 0xda, 0x14, 0x3e, 0x9b, 0x36,
+  0x83, 0x3b, 0x9f, 0xc7, 0xab, 0x30, 0xda, 0x9a, 0x0f, 0x5e, 0x20, 0x1e,
+  0x78, 0x0f, 0x3f, 0xa0, 0x7a, 0xe0, 0x14, 0x55, 0x03, 0xff, 0x12, 0x46,
+  0xde, 0x8e, 0x3b, 0x80, 0x3e, 0xc8, 0x70, 0xb1, 0x0c, 0x97, 0x40, 0x9b,
+  0xcb, 0x1b, 0xcf, 0xce, 0x0b, 0x9b, 0x55, 0xc2, 0xce, 0xa2, 0x8d, 0x45,
+  0xbb, 0xf5, 0x0b, 0x93, 0xa3, 0x14, 0xb4, 0x2a, 0x85, 0xfc, 0x7a, 0xd1,
+  0x83, 0x71, 0x8c, 0xca, 0x5c, 0x42, 0x41, 0x12, 0x0a, 0x55, 0x81, 0x62,
+  0x37, 0x40, 0x01, 0x3f, 0x5d, 0xee, 0x83, 0x9b, 0x68, 0xc9, 0x1d, 0x17,
+  0x58, 0x51, 0x08, 0xee, 0x1f, 0x4b, 0x82, 0xc8, 0x08, 0xe9, 0x43, 0x10,
+  0x2a, 0x22, 0x9a, 0x29, 0x33, 0x29, 0x9a, 0xcc, 0x0b, 0x08, 0xb4, 0x80,
+  0xc0, 0xfe, 0x42, 0x30, 0x24, 0x04, 0xa2, 0x0a, 0x81, 0xe0, 0x26, 0x08,
+  0x77, 0xc5, 0x10, 0x80, 0x7b, 0x3a, 0x5d, 0x85, 0x10, 0xa2, 0xa4, 0x90,
+  0x01, 0x08, 0xad, 0x13, 0xcf, 0x71, 0x45, 0x27, 0xe4, 0xb8, 0x56, 0xf4,
+  0xee, 0x5a, 0x69, 0xc2, 0x41, 0x7b, 0xe2, 0xa0, 0x08, 0xbf, 0xc6, 0x61,
+  0x2d, 0x58, 0x29, 0x7b, 0x82, 0xaf, 0xf2, 0x1e, 0xaf, 0x2c, 0x23, 0x86,
+  0x79, 0xf0, 0x64, 0xda, 0xc5, 0x41, 0xcd, 0xb9, 0xb5, 0xc1, 0x50, 0xe7,
+  0xe7, 0x5a, 0xa2, 0xb5, 0x3a, 0xca, 0x0b, 0xd6, 0x02, 0xd5, 0x76, 0xcb,
+  0x03, 0xf1, 0x50, 0xe0, 0x92, 0xb2, 0x39, 0x29, 0x92, 0x7e, 0x82, 0xd0,
+  0x55, 0xfc, 0x41, 0xad, 0x09, 0x67, 0x10, 0xe3, 0x02, 0xe9, 0xf5, 0xda,
+  0x2a, 0x70, 0x54, 0x05, 0x2f, 0xe5, 0x30, 0x91, 0x5c, 0x49, 0xc9, 0x89,
+  0x81, 0x9f, 0xf2, 0xca, 0x8b, 0x1a, 0x4d, 0x13, 0x49, 0x09, 0xce, 0x37,
+  0x2f, 0xf0, 0x0a, 0x3c, 0x68, 0xc8, 0x65, 0x57, 0x1e, 0xdd, 0xac, 0x2b,
+  0x8e, 0xd3, 0x4b, 0xae, 0x74, 0x82, 0x20, 0x2a, 0xd1, 0xcf, 0x1a, 0xa7,
+  0xd1, 0x5b, 0xf0, 0x29, 0x58, 0x7b, 0x81, 0x9b, 0x06, 0x5f, 0x7b, 0x1f,
+  0x39, 0x4f, 0x26, 0xc5, 0x18, 0x29, 0x3c, 0x9b, 0xa3, 0x92, 0xd1, 0xbf,
+  0x0f, 0xbe, 0x26, 0xcc, 0xe5, 0x9a, 0xc3, 0xae, 0x39, 0x19, 0xe3, 0xae,
+  0xa3, 0xa5, 0x8f, 0x67, 0x6c, 0x86, 0x4e, 0x18, 0x3b, 0x1d, 0xbe, 0x11,
+  0xb3, 0xba, 0x56, 0x85, 0xc3, 0x5a, 0x96, 0x3a, 0x25, 0xe7, 0xf7, 0x8b,
+  0x93, 0xb4, 0xbc, 0x32, 0xde, 0x4c, 0x37, 0x6f, 0xb1, 0x79, 0x9d, 0x09,
+  0x8f, 0xf7, 0x49, 0x6a, 0xd9, 0xa7, 0x04, 0x2c, 0x36, 0xa1, 0x58, 0x0c,
+  0xd3, 0x41, 0xad, 0x7b, 0x7c, 0xae, 0xbb, 0x28, 0xb3, 0xbe, 0x7e, 0x51,
+  0x7a, 0xcb, 0x9e, 0xf2, 0x6c, 0xc8, 0x1a, 0x73, 0xae, 0x35, 0x8c, 0xd5,
+  0xde, 0xbe, 0x80, 0x34, 0xac, 0xb8, 0xbc, 0x14, 0xde, 0x9b, 0xae, 0x88,
+  0x34, 0xd6, 0x26, 0x22, 0xfa, 0x2e, 0x22, 0x81, 0x47, 0x6b, 0x99, 0xcd,
+  0x18, 0xb8, 0xb3, 0x16, 0xd7, 0x21, 0xc4, 0xe9, 0xb9, 0x84, 0x38, 0x1b,
+  0x50, 0x40, 0x6a, 0xbb, 0xa1, 0xec, 0xbf, 0x52, 0x53, 0x5f, 0x56, 0xcb,
+  0x09, 0xb2, 0xea, 0xeb, 0x3c, 0x57, 0x31, 0x7d, 0x33, 0xb9, 0x93, 0x78,
+  0xa9, 0xdd, 0x81, 0x0e, 0xde, 0x1b, 0xc5, 0x6c, 0xab, 0x0e, 0x50, 0xa6,
+  0xb2, 0xbd, 0xac, 0xd7, 0x0f, 0xa9, 0x1e, 0xed, 0xf0, 0x00, 0x7e, 0x88,
+  0xe5, 0x75, 0xe3, 0xe1, 0xdc, 0x58, 0x9b, 0x02, 0x3d, 0x0e, 0x66, 0xaa,
+  0x7b, 0x04, 0x63, 0x1c, 0xd3, 0xe8, 0xac, 0xed, 0x00, 0xef, 0xd7, 0x84,
+  0x77, 0x57, 0x75, 0xbd, 0x75, 0x56, 0xbf, 0x40, 0x2e, 0x79, 0x0b, 0xb3,
+  0xba, 0x6e, 0xb4, 0x10, 0x12, 0xb6, 0x1a, 0xd5, 0x4b, 0xf3, 0x2a, 0x14,
+  0xd2, 0x19, 0x0a, 0xaa, 0x41, 0xd1, 0x06, 0x34, 0x13, 0x57, 0x99, 0xbe,
+  0xdf, 0xf5, 0x23, 0x51, 0xd9, 0xff, 0x30, 0xaa, 0xeb, 0x2e, 0x74, 0xfe,
+  0x00,
+  0xed, 0x99, 0x5b, 0x73, 0xa2, 0x30, 0x14, 0xc7, 0xdf, 0xf7, 0x53, 0xe4,
+  0x71, 0x77, 0x9a, 0xee, 0x84, 0x8b, 0x08, 0xbc, 0x39, 0x6d, 0xb7, 0x3e,
+  0x6c, 0x1d, 0xa7, 0x74, 0xba, 0xbe, 0x26, 0x10, 0x35, 0xab, 0x80, 0x83,
+  0xd8, 0xcb, 0xb7, 0xdf, 0x04, 0xd0, 0x2d, 0x16, 0x35, 0x20, 0xde, 0xaa,
+  0xbe, 0x98, 0x80, 0xc4, 0x9c, 0x5f, 0xce, 0xf9, 0x9f, 0x93, 0x80, 0x34,
+  0x94, 0x7e, 0x3c, 0xd4, 0x17, 0x5f, 0x06, 0x45, 0xb9, 0x0f, 0x6c, 0x87,
+  0x11, 0x9b, 0x60, 0x0f, 0xe8, 0xa0, 0xeb, 0x68, 0x10, 0xdb, 0x44, 0x81,
+  0xc4, 0x26, 0x2a, 0x24, 0xd8, 0x1d, 0xd9, 0xc4, 0x84, 0xde, 0xc4, 0x0b,
+  0x5f, 0x03, 0x7b, 0x88, 0x7e, 0xea, 0xbc, 0x3d, 0xa6, 0xfd, 0x58, 0xb4,
+  0xc5, 0xf5, 0x88, 0x0d, 0x86, 0x49, 0x47, 0xe5, 0x9d, 0xd9, 0x44, 0xb4,
+  0x14, 0x38, 0x98, 0x31, 0x8f, 0xf2, 0x41, 0x54, 0x28, 0x7e, 0x3a, 0x1d,
+  0x86, 0xb3, 0xb1, 0x47, 0x23, 0x9b, 0xe8, 0x69, 0x3f, 0x66, 0x62, 0x54,
+  0x05, 0x25, 0xbd, 0x98, 0x8f, 0x30, 0x10, 0x37, 0x8d, 0xa4, 0xfb, 0x66,
+  0xe3, 0xf4, 0xfa, 0xbb, 0x8d, 0x15, 0x98, 0x8c, 0xfe, 0xff, 0xf9, 0x46,
+  0x76, 0x21, 0x1b, 0x20, 0xbb, 0xbf, 0x18, 0xa1, 0x99, 0xf6, 0xf9, 0x10,
+  0x6a, 0xda, 0xe2, 0x63, 0x68, 0x70, 0x1a, 0xe3, 0x28, 0xb6, 0x89, 0x05,
+  0xdf, 0x6c, 0x82, 0xe0, 0xbb, 0x4d, 0x34, 0x38, 0x19, 0xe3, 0xb8, 0x1f,
+  0x46, 0xbe, 0xfd, 0x87, 0x05, 0xdc, 0xb0, 0x29, 0xfc, 0x86, 0x96, 0x09,
+  0xf5, 0x0b, 0x08, 0x81, 0x47, 0x8a, 0xc7, 0xa0, 0x15, 0xb9, 0xd8, 0xa3,
+  0xa0, 0x1b, 0x85, 0x1c, 0xd7, 0xf3, 0xef, 0xde, 0xf6, 0xb8, 0xe4, 0x21,
+  0x71, 0x73, 0xb6, 0x84, 0x84, 0xf5, 0xfa, 0x20, 0x35, 0xd1, 0x1e, 0x21,
+  0x55, 0xf4, 0xa9, 0xb2, 0x1e, 0x54, 0x0d, 0x04, 0x59, 0x02, 0xf1, 0xd4,
+  0xba, 0x01, 0xf7, 0x77, 0xad, 0xc7, 0x7d, 0xfa, 0xc6, 0x8e, 0x02, 0xa8,
+  0x51, 0x0d, 0x89, 0xa9, 0x17, 0xf9, 0xc6, 0x2f, 0x31, 0x28, 0x0b, 0x06,
+  0xe0, 0x26, 0xf4, 0x7d, 0x1c, 0xf0, 0x39, 0x81, 0xc6, 0x97, 0x92, 0x9b,
+  0xaa, 0xb4, 0x1a, 0x92, 0xb4, 0x54, 0xa4, 0x18, 0x17, 0x8d, 0xce, 0xa0,
+  0x19, 0x92, 0xd0, 0x7a, 0x24, 0x7c, 0x03, 0x9a, 0x81, 0x04, 0x34, 0x24,
+  0xa0, 0x29, 0x19, 0x34, 0xa3, 0xc6, 0x68, 0x34, 0xf3, 0x42, 0xad, 0x96,
+  0x25, 0x65, 0x2d, 0xe9, 0x74, 0x63, 0x01, 0x4a, 0x5b, 0x80, 0xd2, 0xe7,
+  0xa0, 0x9a, 0x02, 0x94, 0x2a, 0x0d, 0xaa, 0xb9, 0x16, 0x94, 0x23, 0x26,
+  0x00, 0x7c, 0x16, 0x30, 0xae, 0xd5, 0xdf, 0xbb, 0x8e, 0xfe, 0x63, 0xd7,
+  0xde, 0xb5, 0x51, 0x9f, 0xb7, 0x15, 0x64, 0xd3, 0x2c, 0x65, 0xb1, 0xf6,
+  0xd9, 0x62, 0xeb, 0xe0, 0x16, 0x9b, 0xe5, 0x2c, 0xc6, 0x52, 0xb9, 0xf8,
+  0x30, 0xba, 0xb1, 0xa3, 0xb2, 0xa5, 0xaa, 0xd8, 0x92, 0x23, 0x46, 0x75,
+  0x64, 0x12, 0xeb, 0xca, 0xa0, 0xea, 0xea, 0xe7, 0xaa, 0xac, 0x96, 0x5a,
+  0xc4, 0xa7, 0x1b, 0x8e, 0x46, 0x34, 0x00, 0x4f, 0xe1, 0x2c, 0x0a, 0xb0,
+  0x4f, 0x83, 0x18, 0xdc, 0xf6, 0x04, 0xa8, 0xdd, 0x54, 0x83, 0x3b, 0x17,
+  0x53, 0xab, 0xd0, 0x09, 0x44, 0x89, 0x5b, 0x8b, 0x4d, 0xa7, 0x2f, 0x28,
+  0xb8, 0x70, 0x1f, 0x74, 0xcf, 0xb7, 0xd4, 0x82, 0x92, 0xfe, 0x05, 0x36,
+  0x88, 0x0b, 0x30, 0x8a, 0x56, 0x8e, 0x4c, 0x61, 0x5d, 0xfb, 0xc0, 0x46,
+  0x33, 0xe1, 0x3b, 0x7f, 0xa9, 0xcb, 0x43, 0x83, 0xbd, 0x60, 0xd0, 0x03,
+  0xed, 0x5b, 0x5e, 0xd6, 0xea, 0xbc, 0x68, 0x0b, 0xe2, 0x28, 0x1c, 0x8f,
+  0x69, 0x74, 0xd9, 0x16, 0x70, 0x7c, 0xc6, 0x05, 0xdf, 0x16, 0xd9, 0x0b,
+  0x4b, 0xd5, 0x44, 0xce, 0xf9, 0x6e, 0xd2, 0x31, 0x95, 0x01, 0xd4, 0xd9,
+  0x47, 0x7a, 0x2f, 0x9f, 0xcf, 0xeb, 0xc8, 0xdf, 0x58, 0xea, 0x98, 0xef,
+  0xb9, 0xbd, 0x57, 0x1f, 0x29, 0x5f, 0xe1, 0x7c, 0xd2, 0xf0, 0xb5, 0x25,
+  0x4e, 0x39, 0x1f, 0x21, 0xf8, 0xf8, 0x76, 0xd9, 0x87, 0x71, 0x16, 0x17,
+  0xad, 0x24, 0x91, 0xfc, 0x19, 0x38, 0xdb, 0x32, 0xd8, 0x55, 0x56, 0xbc,
+  0x4f, 0xe8, 0xb0, 0x20, 0xa6, 0xfc, 0x21, 0xe0, 0xbc, 0xb2, 0xd8, 0x1d,
+  0x1e, 0x67, 0x7e, 0xf2, 0xd9, 0xd4, 0x55, 0x92, 0xd2, 0xe6, 0x60, 0x99,
+  0xca, 0xb5, 0x0a, 0x4b, 0x6c, 0xcc, 0x46, 0x61, 0xad, 0xcc, 0x4e, 0x35,
+  0x93, 0x7b, 0xa6, 0x74, 0x26, 0xcf, 0xc5, 0x9f, 0x3e, 0x07, 0x24, 0xdc,
+  0x24, 0xe3, 0x23, 0x16, 0x7a, 0x8e, 0x87, 0x28, 0x7a, 0x4a, 0x47, 0xcc,
+  0x3e, 0x0f, 0xc7, 0xfa, 0x08, 0xa7, 0x99, 0x8f, 0x3d, 0x7d, 0x33, 0x1b,
+  0x8e, 0xf3, 0x23, 0x1c, 0x73, 0x65, 0xf0, 0x15, 0xb0, 0x31, 0x4a, 0x05,
+  0x9f, 0xe7, 0xae, 0x08, 0xbe, 0x34, 0xe6, 0xce, 0x55, 0x93, 0xe8, 0xaa,
+  0x77, 0x9c, 0x0f, 0xc9, 0xb1, 0xdf, 0x65, 0x7b, 0x81, 0x50, 0xdf, 0xa8,
+  0x24, 0xdb, 0x39, 0x6f, 0x3a, 0x75, 0x09, 0xda, 0xe8, 0x4f, 0xf3, 0xd4,
+  0x66, 0x2e, 0x1f, 0xf5, 0xb4, 0x46, 0x8c, 0xcf, 0x63, 0x02, 0x6e, 0x66,
+  0xd3, 0x38, 0xf4, 0xa7, 0xe2, 0xad, 0x4c, 0x5a, 0xfc, 0x9c, 0xe4, 0xc9,
+  0x39, 0x37, 0xd3, 0xcc, 0xd9, 0x3b, 0x37, 0xb3, 0xeb, 0x28, 0x4b, 0xeb,
+  0xaf, 0xd6, 0xb8, 0xfe, 0xc6, 0xba, 0xf5, 0x97, 0x90, 0xd9, 0xe6, 0xfa,
+  0xf5, 0x2f, 0xd2, 0x13, 0x35, 0x07, 0x46, 0x13, 0x60, 0x90, 0x14, 0x18,
+  0xaa, 0xe4, 0x83, 0x05, 0xbf, 0xb0, 0x18, 0xb4, 0x9f, 0xc1, 0x7d, 0xba,
+  0xec, 0xc5, 0x58, 0xae, 0xf8, 0x9c, 0x33, 0x2a, 0xd7, 0xdc, 0x8e, 0x39,
+  0x94, 0xab, 0xa4, 0xcd, 0x99, 0x5c, 0xe3, 0x7a, 0x4f, 0xf5, 0xca, 0xd8,
+  0x93, 0x3b, 0x9c, 0x81, 0x9d, 0xbb, 0xde, 0x13, 0x70, 0x3a, 0x77, 0x8e,
+  0xd4, 0x72, 0x57, 0xb1, 0x6b, 0x83, 0x21, 0x86, 0x9c, 0x21, 0xff, 0x00,
+  0xed, 0x9a, 0x4b, 0x73, 0x9b, 0x30, 0x10, 0xc7, 0xef, 0xfd, 0x14, 0xba,
+  0x87, 0x74, 0x24, 0xf1, 0x30, 0x70, 0xcb, 0xa3, 0xc9, 0x29, 0x1d, 0x4f,
+  0x39, 0xb4, 0x93, 0x9b, 0xb0, 0x15, 0x9b, 0x31, 0xb1, 0x18, 0x21, 0x1a,
+  0xfb, 0x92, 0xcf, 0x5e, 0x09, 0x64, 0x12, 0xcb, 0x8a, 0x83, 0x1f, 0x49,
+  0x9b, 0x06, 0x2e, 0x48, 0x60, 0x34, 0xbb, 0x3f, 0xed, 0x7f, 0x57, 0x08,
+  0x43, 0x17, 0xd6, 0x07, 0x82, 0x30, 0xac, 0x1b, 0xba, 0xbf, 0x3a, 0x9c,
+  0x61, 0x82, 0xc1, 0x05, 0x9b, 0x0b, 0xce, 0xf2, 0x9c, 0x72, 0x87, 0xc4,
+  0x29, 0x76, 0xd2, 0x38, 0x45, 0x4e, 0x4a, 0x46, 0xb3, 0x38, 0x0d, 0x9d,
+  0x71, 0x31, 0x66, 0x0f, 0xf3, 0x78, 0x0a, 0xbf, 0x7a, 0xb2, 0x9d, 0xd3,
+  0x3b, 0xa1, 0xda, 0xea, 0x3a, 0xcf, 0x26, 0xd3, 0xba, 0x83, 0x65, 0xa7,
+  0x2a, 0x54, 0x0b, 0x39, 0xea, 0x07, 0xe5, 0x94, 0x55, 0xf9, 0x98, 0xf2,
+  0x38, 0x0d, 0x9a, 0xbe, 0xc8, 0xd4, 0x58, 0x08, 0xd6, 0x3d, 0x21, 0x9f,
+  0x9b, 0xa8, 0x9b, 0x5e, 0xdd, 0x5d, 0xc4, 0xa4, 0xb9, 0xbe, 0x8c, 0x09,
+  0x72, 0xea, 0x31, 0x9f, 0x9e, 0x1f, 0xe8, 0x0b, 0x7a, 0x00, 0x7d, 0xbf,
+  0x1d, 0xc1, 0x6f, 0xfa, 0x72, 0x08, 0xaf, 0x69, 0xc9, 0x31, 0xb0, 0x53,
+  0x0a, 0xc2, 0x45, 0x9c, 0x46, 0xce, 0x22, 0x4e, 0x5d, 0x67, 0x19, 0xa7,
+  0xd0, 0x29, 0x72, 0x22, 0xee, 0x18, 0xbf, 0x8f, 0x7f, 0x66, 0x73, 0xe9,
+  0x4e, 0xe9, 0x7c, 0x81, 0x2d, 0x18, 0x34, 0xaa, 0xcf, 0x83, 0xe6, 0xdc,
+  0x82, 0xa9, 0x7e, 0x90, 0x09, 0x05, 0xd7, 0xe4, 0x9e, 0x16, 0x64, 0x7c,
+  0x6c, 0x2e, 0xde, 0x36, 0x2e, 0xc1, 0xeb, 0x5c, 0xfc, 0xed, 0x5c, 0x06,
+  0x2d, 0x17, 0xdc, 0x72, 0x71, 0xf7, 0xe4, 0x12, 0x1a, 0x5c, 0xbe, 0x95,
+  0x25, 0x9d, 0x8b, 0x8c, 0xe4, 0xef, 0xca, 0xa4, 0x8d, 0x15, 0xb4, 0x62,
+  0x02, 0xf7, 0x66, 0xe2, 0xee, 0x1f, 0x2b, 0xb8, 0x11, 0x51, 0x64, 0x88,
+  0x28, 0x3c, 0xcf, 0xc4, 0x25, 0x03, 0xc9, 0xd5, 0x85, 0x0b, 0x15, 0x16,
+  0xa4, 0xb0, 0x40, 0x8d, 0x45, 0xba, 0xa2, 0xb9, 0x9c, 0x48, 0xeb, 0x35,
+  0x96, 0x53, 0x02, 0x5b, 0x2a, 0x27, 0x75, 0x5b, 0x42, 0x39, 0x25, 0x9b,
+  0xfa, 0xd9, 0x10, 0x84, 0xb6, 0x58, 0xfa, 0xb7, 0x50, 0x58, 0x96, 0xca,
+  0xee, 0x2d, 0x26, 0x23, 0x25, 0x7d, 0x79, 0x8e, 0x90, 0xb7, 0x66, 0x72,
+  0x22, 0x28, 0xcd, 0x13, 0xca, 0x33, 0x5a, 0x2a, 0x8b, 0x61, 0x33, 0x91,
+  0xfb, 0x4c, 0xa0, 0xe6, 0xed, 0x76, 0x0d, 0x62, 0xfd, 0x7b, 0xaf, 0xc3,
+  0xfc, 0x78, 0xeb, 0xde, 0xd6, 0x13, 0xe4, 0x75, 0xf0, 0xd6, 0x45, 0x2f,
+  0x7b, 0x0b, 0x12, 0xc1, 0x89, 0xa8, 0x4a, 0x70, 0x59, 0xb1, 0x67, 0x9e,
+  0x9b, 0x73, 0x75, 0x8c, 0x7c, 0x67, 0x20, 0x09, 0x77, 0xce, 0x77, 0x26,
+  0xa3, 0xe8, 0x38, 0x8c, 0x6a, 0x36, 0xa3, 0xc0, 0x08, 0xe2, 0xab, 0x8b,
+  0x10, 0xa2, 0x0d, 0x22, 0x81, 0x55, 0xa5, 0xaf, 0x24, 0x27, 0x6d, 0xd1,
+  0x40, 0x19, 0x84, 0x5f, 0x0d, 0x51, 0x0c, 0xc9, 0xaa, 0x46, 0x19, 0xa5,
+  0xc9, 0x35, 0x4a, 0xd3, 0xc7, 0x9c, 0xab, 0xa7, 0x1c, 0xec, 0xef, 0x3a,
+  0x57, 0x18, 0x36, 0xc9, 0x17, 0x87, 0xe1, 0x1a, 0x9a, 0xef, 0xcb, 0x19,
+  0x03, 0x67, 0x19, 0x07, 0x57, 0x39, 0x03, 0xbf, 0x52, 0xb6, 0xd8, 0x06,
+  0x6a, 0x70, 0xc4, 0xbc, 0x1c, 0xae, 0x63, 0xd2, 0x69, 0x7a, 0x87, 0x5a,
+  0x15, 0x19, 0x98, 0x56, 0x79, 0xda, 0x1e, 0xd3, 0x41, 0xd7, 0x08, 0x6a,
+  0x30, 0xf9, 0x46, 0x04, 0xdd, 0x52, 0xce, 0x8a, 0x5c, 0x6a, 0xfd, 0x6c,
+  0x4c, 0x0a, 0x61, 0x59, 0xde, 0x20, 0x74, 0xc4, 0x18, 0x8a, 0x0e, 0x5c,
+  0xde, 0xc0, 0x17, 0x57, 0x37, 0x96, 0x8a, 0x15, 0x76, 0xab, 0x58, 0x2b,
+  0x32, 0x21, 0x1c, 0x18, 0xda, 0xf2, 0x8c, 0x90, 0xa9, 0x6b, 0x16, 0x7e,
+  0xfb, 0x52, 0x4e, 0xdc, 0x43, 0x97, 0x37, 0xab, 0xc5, 0x9e, 0x5d, 0x5a,
+  0x75, 0x29, 0x87, 0x9d, 0x43, 0x86, 0x18, 0xca, 0xfa, 0x5f, 0xc4, 0x84,
+  0x0f, 0x15, 0x93, 0xcc, 0xc6, 0x74, 0x8d, 0xcc, 0x19, 0xbf, 0x67, 0x1c,
+  0xb8, 0x9f, 0x37, 0x56, 0xe4, 0xe2, 0x82, 0xda, 0xd3, 0xcb, 0xd0, 0x7b,
+  0xfe, 0xa2, 0x70, 0x18, 0x9d, 0x49, 0x95, 0x8d, 0xa9, 0x1c, 0x04, 0x7f,
+  0x60, 0x4e, 0x3b, 0x6a, 0x2a, 0x78, 0x33, 0x4d, 0x11, 0xfc, 0x78, 0xa0,
+  0xa6, 0x88, 0xff, 0xb8, 0xad, 0x40, 0x0d, 0x76, 0xd3, 0x14, 0x32, 0x34,
+  0x35, 0xe4, 0xcc, 0xff, 0xc4, 0x82, 0x42, 0x86, 0xa0, 0xfa, 0xaa, 0xa4,
+  0xc1, 0xe0, 0x1e, 0x8c, 0x1d, 0x8c, 0xbb, 0xb1, 0x8e, 0x71, 0x7b, 0x30,
+  0x0d, 0x98, 0x3e, 0x62, 0xac, 0x60, 0xfc, 0x1e, 0x8c, 0x1d, 0x4c, 0x60,
+  0x80, 0xa9, 0xf7, 0x48, 0xc0, 0x30, 0x27, 0x4b, 0x70, 0x43, 0x05, 0xc9,
+  0x05, 0x1d, 0x4d, 0x41, 0x4f, 0x4b, 0xd3, 0x0a, 0xfb, 0x30, 0x7a, 0x01,
+  0x4c, 0x5f, 0xaa, 0xec, 0x60, 0xa2, 0x1e, 0x8c, 0x1d, 0xcc, 0xc8, 0x00,
+  0x93, 0xcc, 0xc9, 0x8c, 0x9e, 0x2f, 0x05, 0x05, 0x5e, 0xd2, 0x27, 0x9c,
+  0x96, 0xd2, 0x1d, 0xea, 0x57, 0x3a, 0x36, 0x30, 0xb4, 0xcf, 0xc4, 0x56,
+  0x30, 0xd8, 0xdc, 0xb0, 0x39, 0xe7, 0x8c, 0xcd, 0xc0, 0x0d, 0xe1, 0xe5,
+  0x5f, 0x54, 0xd5, 0xbb, 0x7c, 0xcd, 0xec, 0xce, 0x08, 0xbd, 0x1f, 0xa3,
+  0x7d, 0x36, 0x72, 0xfe, 0x2d, 0x5a, 0x2e, 0x82, 0x23, 0x0b, 0xad, 0xa4,
+  0x2a, 0x28, 0x57, 0xa8, 0x7e, 0x53, 0x2e, 0xde, 0xea, 0x3f, 0x03, 0x7b,
+  0x6c, 0xa3, 0x3f, 0xdb, 0x38, 0xdf, 0xed, 0xb3, 0xae, 0x76, 0x97, 0x84,
+  0xfe, 0xfa, 0xcb, 0xe5, 0x35, 0x11, 0x4c, 0x3a, 0x9a, 0x93, 0x87, 0xcf,
+  0x93, 0x55, 0xfe, 0x00,
+  0xed, 0x99, 0x59, 0x73, 0xd3, 0x30, 0x10, 0xc7, 0xdf, 0xf9, 0x14, 0x7a,
+  0xaf, 0xcb, 0xe8, 0xf2, 0x11, 0xbf, 0x15, 0x02, 0x65, 0x3a, 0xd3, 0x12,
+  0x26, 0x14, 0xca, 0xa3, 0x1c, 0x3b, 0xa9, 0xa6, 0x4e, 0x94, 0x71, 0x9c,
+  0xa1, 0xf9, 0xf6, 0x48, 0xbe, 0x1a, 0xc9, 0x22, 0x37, 0x2d, 0x50, 0xfb,
+  0xc5, 0x92, 0x0f, 0x65, 0xf7, 0xa7, 0xdd, 0xbf, 0xd6, 0x0a, 0x24, 0xb0,
+  0x38, 0x10, 0x86, 0x23, 0x75, 0x66, 0x3d, 0xd7, 0x87, 0x6b, 0x87, 0x33,
+  0x18, 0x52, 0xf0, 0x5e, 0xcc, 0xf2, 0x4c, 0xa4, 0x69, 0x92, 0x39, 0x2c,
+  0x8c, 0x90, 0x13, 0x85, 0x11, 0x76, 0x22, 0x36, 0x7a, 0x08, 0xa3, 0xc0,
+  0x89, 0xe7, 0xb1, 0xf8, 0x39, 0x0b, 0xef, 0xe1, 0x5b, 0x2a, 0xdb, 0x69,
+  0x32, 0xce, 0x55, 0x5b, 0x5d, 0xcf, 0xf8, 0xe4, 0xbe, 0xe8, 0x60, 0xd9,
+  0x59, 0xce, 0x55, 0x0b, 0x39, 0xea, 0x81, 0xc5, 0xbd, 0x58, 0xa6, 0x71,
+  0x92, 0x85, 0x11, 0x2d, 0xfb, 0x39, 0x57, 0x63, 0x21, 0x58, 0xf4, 0x72,
+  0xf9, 0xde, 0x44, 0xde, 0x64, 0xa4, 0xe8, 0x3e, 0x86, 0xac, 0xbc, 0xbe,
+  0x0a, 0x19, 0x72, 0x8a, 0x31, 0x9f, 0xde, 0x77, 0xab, 0x0b, 0xd5, 0x00,
+  0xd5, 0xfd, 0x66, 0x04, 0x5a, 0xf6, 0xe5, 0x10, 0xb8, 0x6c, 0xc9, 0x31,
+  0x5c, 0x67, 0x91, 0xb3, 0x2c, 0x0f, 0xa3, 0x9e, 0xf3, 0x18, 0x46, 0xd0,
+  0x59, 0x85, 0x11, 0x71, 0xe6, 0x29, 0xcb, 0xc7, 0x22, 0x9b, 0x86, 0xdf,
+  0xf9, 0x4c, 0xba, 0xb3, 0x70, 0xde, 0x40, 0x13, 0x0c, 0xeb, 0xc0, 0xd8,
+  0xc1, 0x44, 0x06, 0x98, 0xef, 0x2c, 0xcb, 0xb8, 0xc8, 0xc0, 0x95, 0x58,
+  0xcd, 0x59, 0x0c, 0xae, 0x86, 0x30, 0x20, 0xaf, 0x17, 0xcf, 0x18, 0xc1,
+  0x44, 0xc3, 0xf3, 0x2e, 0x13, 0xe2, 0x01, 0x0c, 0x86, 0x18, 0x5c, 0xc4,
+  0x6c, 0x9e, 0x5b, 0x42, 0x07, 0x91, 0x57, 0x03, 0x07, 0xa3, 0x51, 0x97,
+  0x54, 0x36, 0x30, 0xa4, 0x03, 0x63, 0x07, 0x43, 0x3b, 0x30, 0x76, 0x30,
+  0x6e, 0x07, 0xc6, 0x0e, 0xc6, 0x33, 0x04, 0x78, 0x40, 0xc1, 0x25, 0x9b,
+  0x26, 0x72, 0x6d, 0x6a, 0x2b, 0x2f, 0xde, 0x97, 0xca, 0x64, 0xc9, 0xe3,
+  0x44, 0xd1, 0xd4, 0xf1, 0xb8, 0x1a, 0x90, 0xc8, 0x37, 0xdd, 0xa7, 0xba,
+  0xbf, 0x91, 0x77, 0xa8, 0x6f, 0xc6, 0xa4, 0x7f, 0x48, 0x79, 0x9e, 0x1c,
+  0x3f, 0xd7, 0x95, 0x57, 0x12, 0xc7, 0x3f, 0x3b, 0xeb, 0xbe, 0x39, 0xeb,
+  0x5d, 0x3a, 0x94, 0x60, 0x7a, 0x2d, 0x30, 0xe4, 0xb5, 0x83, 0x49, 0xd6,
+  0x01, 0x75, 0x11, 0x53, 0x83, 0x71, 0x51, 0x4f, 0x9d, 0x29, 0xd4, 0x0f,
+  0xe7, 0x63, 0xba, 0x8a, 0xf9, 0x84, 0x83, 0x6f, 0x4c, 0x5a, 0x02, 0xb0,
+  0x22, 0x83, 0xfd, 0x02, 0x8d, 0x57, 0xeb, 0x68, 0xef, 0x40, 0xc5, 0xf1,
+  0x0c, 0x4a, 0x98, 0x68, 0x98, 0x7c, 0x5d, 0x56, 0x31, 0xb2, 0x70, 0x9a,
+  0xf2, 0xc5, 0x08, 0xc9, 0x67, 0x5d, 0x47, 0x2a, 0x7c, 0x9c, 0x26, 0xa8,
+  0xa0, 0x53, 0xb6, 0x71, 0x81, 0xba, 0x6c, 0x93, 0xa2, 0xd0, 0x2e, 0xdb,
+  0xb4, 0xd0, 0x3a, 0x83, 0x30, 0xc6, 0x3a, 0x62, 0xcf, 0xd0, 0x6c, 0x0c,
+  0x1b, 0xc6, 0xa4, 0x61, 0x4c, 0x6b, 0xc6, 0x28, 0x50, 0x90, 0xb1, 0xab,
+  0x28, 0x63, 0xba, 0x03, 0x66, 0xd7, 0xf3, 0x03, 0x0d, 0xf3, 0xed, 0x8c,
+  0xcb, 0xb7, 0x56, 0xe0, 0xd6, 0x53, 0x84, 0xa1, 0x02, 0x8c, 0x6a, 0xbe,
+  0xf0, 0xb8, 0xe0, 0xf3, 0x34, 0xaa, 0x44, 0xa7, 0x1a, 0x6c, 0x0f, 0x3e,
+  0x5f, 0x27, 0x63, 0xae, 0x66, 0xbd, 0x8d, 0x60, 0x90, 0x02, 0x43, 0x14,
+  0x97, 0x2d, 0x58, 0x98, 0x3a, 0x7b, 0x18, 0x63, 0x23, 0x2d, 0x31, 0xe8,
+  0x2f, 0x59, 0x0a, 0x06, 0xe9, 0x72, 0xb1, 0xfe, 0x0d, 0x85, 0xd7, 0x09,
+  0x35, 0x01, 0xa8, 0xac, 0xab, 0xf8, 0xa8, 0x98, 0xa8, 0xf1, 0x94, 0x1f,
+  0x59, 0x92, 0x4e, 0x7b, 0x91, 0xf3, 0x36, 0x64, 0x66, 0x95, 0xb6, 0xfb,
+  0xc0, 0x31, 0x32, 0xb3, 0x4e, 0x5c, 0x2d, 0x33, 0x49, 0x0d, 0x27, 0x68,
+  0xd8, 0xc0, 0x8d, 0x6c, 0x2a, 0x24, 0x28, 0xd0, 0xd9, 0xdc, 0x5c, 0xf6,
+  0x87, 0x2d, 0x14, 0x7f, 0x50, 0xa8, 0x2a, 0x56, 0x47, 0x08, 0x55, 0x4d,
+  0xcb, 0x1e, 0x2b, 0xbd, 0xdd, 0x70, 0x78, 0x9d, 0x82, 0xdb, 0xc1, 0xf8,
+  0xb8, 0xd8, 0x9a, 0x21, 0xc4, 0xd5, 0x15, 0xfc, 0x8e, 0x33, 0x31, 0xe5,
+  0xe0, 0xee, 0xfa, 0x72, 0x00, 0xd1, 0x8f, 0xeb, 0x13, 0xe8, 0xcb, 0xef,
+  0x2a, 0x46, 0x9b, 0xd2, 0x1c, 0x20, 0x2d, 0xc7, 0x49, 0x49, 0x85, 0x81,
+  0x52, 0x82, 0x6c, 0x18, 0xf4, 0x10, 0x39, 0x0d, 0x08, 0x0c, 0x9f, 0x55,
+  0x72, 0x99, 0xbf, 0x29, 0x5a, 0x76, 0xe5, 0xc4, 0x9a, 0xaf, 0x09, 0x9d,
+  0x53, 0x9f, 0xe5, 0x49, 0x0a, 0x2e, 0xb2, 0x91, 0x5c, 0xf0, 0xd5, 0xb6,
+  0x5e, 0x61, 0xc4, 0x9f, 0x49, 0xa7, 0x03, 0x94, 0xc5, 0x22, 0x25, 0x87,
+  0x67, 0x0c, 0x43, 0x9d, 0x94, 0x58, 0xc1, 0x8c, 0x61, 0x59, 0x9d, 0xa0,
+  0x44, 0xab, 0x07, 0x9d, 0xe1, 0x72, 0x2e, 0x8b, 0xc0, 0x8f, 0x6c, 0xca,
+  0x47, 0x62, 0x6a, 0x20, 0xb2, 0x2f, 0x43, 0x67, 0xd2, 0xfe, 0x8a, 0xd0,
+  0x39, 0x83, 0x0d, 0xa0, 0xb3, 0xa2, 0x2d, 0xf9, 0x9c, 0xb3, 0x36, 0x9e,
+  0x96, 0xbf, 0x7b, 0x2d, 0x10, 0x18, 0x92, 0xd2, 0xf8, 0x9e, 0x51, 0xc9,
+  0x06, 0xef, 0x78, 0xde, 0x17, 0xe0, 0xe6, 0xc3, 0x90, 0x40, 0x30, 0xc8,
+  0x44, 0x33, 0xaf, 0xf0, 0xbf, 0x29, 0xb4, 0xe8, 0xb6, 0x99, 0xc5, 0x55,
+  0x81, 0xe5, 0x99, 0x65, 0xfe, 0x35, 0x1b, 0xb1, 0x34, 0x5d, 0xb5, 0x62,
+  0xdd, 0x3f, 0x0e, 0x09, 0x21, 0xcf, 0x55, 0x50, 0x58, 0xea, 0xab, 0xdd,
+  0x82, 0x5d, 0x12, 0x19, 0xd5, 0x91, 0xa3, 0x21, 0xf9, 0xc2, 0x66, 0x11,
+  0x03, 0xfd, 0x4c, 0xcc, 0x92, 0x5a, 0x0e, 0x87, 0xa7, 0xd1, 0xc2, 0xcd,
+  0x3b, 0x2e, 0x6b, 0x5a, 0xb0, 0x59, 0x03, 0x8d, 0xd2, 0x69, 0x1f, 0x4f,
+  0x89, 0xc5, 0xd3, 0xcf, 0xd1, 0x82, 0xc7, 0x9c, 0xcd, 0x34, 0x67, 0x81,
+  0xd4, 0xc2, 0x13, 0xfc, 0x67, 0xf1, 0xef, 0xee, 0x31, 0xad, 0x41, 0x73,
+  0xad, 0xe1, 0xc1, 0x26, 0x62, 0x76, 0xfa, 0xe5, 0xf2, 0x3f, 0x00, 0x86,
+  0xf7, 0x8a, 0x32, 0xf2, 0x32, 0xcc, 0xfe, 0x12, 0x0d, 0xa2, 0xb8, 0xdc,
+  0xa7, 0x8b, 0x0c, 0x0d, 0xfa, 0xb4, 0x92, 0x0b, 0xee, 0x03, 0x97, 0xb4,
+  0xe2, 0x29, 0xcf, 0xe4, 0x77, 0xf0, 0x8d, 0xa7, 0x95, 0x26, 0x67, 0xd5,
+  0x4f, 0x2b, 0xab, 0xce, 0xaa, 0x1f, 0x57, 0xe9, 0x79, 0x5e, 0x5f, 0x0f,
+  0xaa, 0xe6, 0xaa, 0xe0, 0xf2, 0xb4, 0xe2, 0x9d, 0xb2, 0x7a, 0x43, 0x74,
+  0x17, 0x86, 0x0d, 0x90, 0xed, 0x18, 0x3c, 0x46, 0x02, 0x3b, 0x86, 0xaf,
+  0x99, 0x10, 0xf3, 0x7a, 0x1f, 0x4a, 0x2b, 0xde, 0xa9, 0xb9, 0x99, 0xb4,
+  0xdd, 0xa6, 0x66, 0x92, 0xdc, 0x1d, 0x6c, 0x1a, 0x8f, 0x61, 0x64, 0xb7,
+  0x49, 0x4d, 0x49, 0xfb, 0xdf, 0xdd, 0x97, 0x29, 0x8f, 0x7f, 0x17, 0x84,
+  0x6d, 0xff, 0x7e, 0x01,
+  0xed, 0x99, 0x4d, 0x73, 0x9b, 0x30, 0x10, 0x86, 0xef, 0xfd, 0x15, 0xdc,
+  0x43, 0x3a, 0x92, 0x00, 0x21, 0xb8, 0x25, 0x6e, 0xea, 0x69, 0xa6, 0xce,
+  0xb8, 0xf5, 0x74, 0xd2, 0x1e, 0x25, 0x23, 0x3b, 0x4c, 0x89, 0xf1, 0x60,
+  0x9c, 0xda, 0x97, 0xfe, 0xf6, 0x8a, 0x8f, 0x10, 0x4b, 0x06, 0x8c, 0xfc,
+  0x91, 0x34, 0x93, 0xd8, 0x87, 0x88, 0x18, 0x98, 0x7d, 0x9f, 0x5d, 0xed,
+  0x4a, 0x2b, 0x60, 0x81, 0xfc, 0x83, 0x6c, 0x34, 0x29, 0x46, 0xcc, 0x05,
+  0x1b, 0x1f, 0xf3, 0x6a, 0x34, 0x30, 0x3c, 0x08, 0x81, 0x49, 0x7d, 0x06,
+  0x4c, 0xe6, 0x33, 0x68, 0x32, 0x3a, 0xfe, 0xed, 0x33, 0xd7, 0x0c, 0xe6,
+  0x41, 0xfc, 0x67, 0xe6, 0xdf, 0x81, 0x8f, 0xb6, 0x18, 0x47, 0x7c, 0x92,
+  0x66, 0x63, 0x22, 0xc6, 0x49, 0x38, 0xbd, 0xcb, 0x2f, 0x90, 0xb8, 0x58,
+  0xce, 0xb3, 0x11, 0x34, 0xb3, 0x1b, 0x16, 0x77, 0xf1, 0x32, 0x0a, 0x78,
+  0xe2, 0x33, 0xbb, 0xb8, 0x4e, 0xc3, 0xec, 0x5d, 0x24, 0xbf, 0x48, 0xc5,
+  0x63, 0xd3, 0xa7, 0xdf, 0x56, 0x3e, 0x05, 0xf9, 0x60, 0xed, 0x53, 0x68,
+  0xe6, 0xaf, 0x7c, 0x7a, 0xdc, 0x29, 0xff, 0x51, 0x3c, 0xef, 0x15, 0x57,
+  0xd5, 0x0b, 0xca, 0x5f, 0xc5, 0x1b, 0x50, 0x31, 0x12, 0xaf, 0xb0, 0xcc,
+  0x45, 0x4a, 0x93, 0xd4, 0x67, 0xd8, 0x5c, 0xf9, 0x0c, 0x99, 0x6b, 0x9f,
+  0x59, 0xe6, 0x3c, 0xa2, 0xe9, 0x24, 0x4e, 0xee, 0xfd, 0xdb, 0x70, 0x26,
+  0xc4, 0x2c, 0xcc, 0x0f, 0x40, 0x01, 0x82, 0x02, 0x20, 0x7d, 0xcc, 0xeb,
+  0x5f, 0x23, 0xe3, 0x22, 0xa0, 0xf3, 0x94, 0x27, 0x19, 0x13, 0xb4, 0xc9,
+  0x84, 0xe8, 0x32, 0x99, 0x2e, 0xc3, 0x80, 0x8b, 0xe7, 0x51, 0x1b, 0x1d,
+  0x08, 0x64, 0x3c, 0x58, 0x17, 0x0f, 0x84, 0x0a, 0x1f, 0xb7, 0x8d, 0x8f,
+  0x97, 0xf1, 0xb1, 0x32, 0x3e, 0xa0, 0x03, 0x1f, 0xcb, 0x55, 0xf8, 0x0c,
+  0xe8, 0x7a, 0x12, 0xd1, 0xc5, 0x9d, 0xf1, 0x19, 0x02, 0x98, 0x11, 0x82,
+  0x19, 0x21, 0x74, 0x1a, 0x42, 0x1b, 0x4c, 0xea, 0x09, 0x6c, 0x48, 0xde,
+  0x94, 0x07, 0xba, 0xba, 0xdf, 0xf2, 0x1a, 0xe5, 0x89, 0x3b, 0x8d, 0xab,
+  0x28, 0x4c, 0xb9, 0x71, 0x91, 0x8c, 0x69, 0xc0, 0x8d, 0xeb, 0x78, 0x9d,
+  0x03, 0x3f, 0x5c, 0xf4, 0x8b, 0x07, 0x83, 0xb3, 0x1f, 0x2d, 0xcc, 0x15,
+  0x5a, 0x3f, 0x46, 0x97, 0x46, 0x2f, 0x9e, 0xa5, 0x49, 0x1c, 0x45, 0xc5,
+  0x7c, 0xc9, 0xc1, 0xd8, 0x25, 0x98, 0x52, 0xcc, 0x93, 0xa9, 0x44, 0x5b,
+  0x9c, 0xa7, 0xa3, 0x46, 0x68, 0xd7, 0x91, 0xe3, 0x5a, 0x4d, 0xce, 0x1f,
+  0xd0, 0x69, 0x38, 0x36, 0x6e, 0x46, 0x75, 0x8a, 0x8e, 0x14, 0xe0, 0x58,
+  0xf2, 0xba, 0x25, 0x83, 0x21, 0x2a, 0x06, 0x57, 0xf6, 0xb1, 0xad, 0x50,
+  0xf1, 0x2a, 0x2a, 0x56, 0x45, 0xc5, 0xde, 0x93, 0x0a, 0xa1, 0xed, 0x19,
+  0xf1, 0xad, 0xf1, 0x98, 0xd8, 0x4d, 0x51, 0x72, 0x83, 0xed, 0x8d, 0xe8,
+  0xdf, 0x62, 0x84, 0x8e, 0x91, 0x16, 0xf6, 0x48, 0x04, 0x4d, 0x33, 0xbd,
+  0x45, 0xaa, 0x03, 0xca, 0x3c, 0x08, 0xe5, 0xd5, 0x81, 0x48, 0x79, 0x73,
+  0x1a, 0x34, 0xd6, 0x43, 0x4f, 0x31, 0xd9, 0xd1, 0xae, 0xf3, 0xae, 0xe2,
+  0x38, 0xfc, 0x68, 0x2e, 0xe9, 0x56, 0xa5, 0x2a, 0xc3, 0x09, 0x91, 0x0c,
+  0x1f, 0x8e, 0x90, 0x92, 0x98, 0x14, 0xc3, 0x0f, 0x72, 0x0d, 0x6e, 0xcb,
+  0xd8, 0xdd, 0x55, 0x37, 0x65, 0xec, 0xd6, 0xe5, 0x8d, 0x26, 0x18, 0x08,
+  0x55, 0x30, 0xd6, 0x3b, 0x98, 0x1c, 0x0c, 0x22, 0xf5, 0xb3, 0xba, 0xac,
+  0xf6, 0xa3, 0x86, 0x52, 0x2f, 0x0b, 0xd6, 0x97, 0x68, 0xb5, 0x2e, 0x5c,
+  0x9c, 0xcc, 0x7e, 0xdc, 0xc5, 0x7e, 0xf4, 0xee, 0xd8, 0x7a, 0x30, 0x8e,
+  0x92, 0xae, 0x35, 0xc0, 0x90, 0x0d, 0x30, 0xf6, 0x2b, 0x01, 0xb3, 0xbb,
+  0x8e, 0x95, 0x60, 0x30, 0x56, 0x72, 0xe4, 0x60, 0x78, 0x4e, 0x08, 0xc6,
+  0xc6, 0x68, 0x39, 0x17, 0xd5, 0xeb, 0xd3, 0x92, 0x46, 0xc6, 0x65, 0xbc,
+  0x7a, 0xbb, 0x91, 0x23, 0xf8, 0x3c, 0x67, 0x11, 0x71, 0x4e, 0x0b, 0x06,
+  0x1f, 0x0f, 0x0c, 0x21, 0xef, 0xd5, 0xb5, 0x16, 0x0c, 0x27, 0xc0, 0xaa,
+  0x2f, 0x22, 0xb7, 0x61, 0x68, 0xf4, 0xc4, 0x68, 0x21, 0xb6, 0x11, 0xea,
+  0xba, 0x10, 0x1c, 0xba, 0x57, 0x56, 0x76, 0x55, 0x54, 0x7b, 0xa5, 0x48,
+  0x9d, 0xfd, 0x1a, 0x06, 0xa8, 0x8d, 0x09, 0x2e, 0x98, 0x20, 0x8c, 0xa4,
+  0x0c, 0x6c, 0xf6, 0xe9, 0x3d, 0xef, 0x2d, 0x19, 0x57, 0x22, 0xa6, 0x6c,
+  0x36, 0xed, 0x87, 0x00, 0x4b, 0x8a, 0x69, 0x63, 0x50, 0x54, 0x77, 0xb4,
+  0x3a, 0xdd, 0xed, 0xd6, 0x31, 0xc2, 0x0d, 0xb3, 0xa1, 0xb7, 0x66, 0x22,
+  0x7f, 0xf6, 0x69, 0x30, 0xe5, 0xa9, 0x71, 0x54, 0xb5, 0x92, 0x48, 0x67,
+  0x77, 0xe4, 0x63, 0x45, 0xb5, 0x5d, 0xa7, 0xfa, 0xaf, 0xa6, 0x6c, 0x02,
+  0x8a, 0x0d, 0x10, 0x94, 0xf7, 0x41, 0x66, 0x3f, 0xa1, 0x0f, 0xe1, 0x22,
+  0x17, 0x3c, 0x14, 0x7b, 0x84, 0x61, 0x12, 0x37, 0x37, 0x46, 0xce, 0x28,
+  0x7c, 0xd4, 0x7b, 0x4e, 0x41, 0x25, 0xf7, 0x4c, 0xf8, 0x20, 0x57, 0x7b,
+  0x5e, 0xba, 0xf0, 0xf9, 0xfa, 0x3f, 0x04, 0x14, 0x8d, 0x3f, 0x24, 0xbe,
+  0xd2, 0x0c, 0x0e, 0xf3, 0xbd, 0xdc, 0xd7, 0xac, 0xef, 0xd3, 0xa3, 0x35,
+  0x2e, 0x2c, 0x94, 0xd9, 0xfb, 0xb8, 0x52, 0xf6, 0x5d, 0x69, 0xaf, 0xd3,
+  0xcd, 0x0b, 0x14, 0xe0, 0xdc, 0x09, 0x62, 0x5b, 0xaa, 0x64, 0x1c, 0x81,
+  0x60, 0x1c, 0xdf, 0x6f, 0x59, 0xf8, 0xfa, 0x7a, 0x95, 0x35, 0x5b, 0x75,
+  0x4f, 0x0b, 0x0e, 0x02, 0xca, 0xd2, 0xef, 0x27, 0x8b, 0x57, 0xf5, 0x13,
+  0xb1, 0xec, 0x5e, 0x58, 0x8f, 0x90, 0xf2, 0x9a, 0x95, 0x23, 0x2a, 0x5a,
+  0x1a, 0x05, 0xa1, 0xcc, 0xda, 0x1c, 0xd0, 0xd6, 0xba, 0x5f, 0x2e, 0xde,
+  0xfa, 0x5b, 0x75, 0x5b, 0x86, 0xe2, 0x68, 0x75, 0xb9, 0x50, 0x37, 0x2a,
+  0x1c, 0xe6, 0x54, 0xf8, 0x84, 0xf1, 0x6d, 0x2a, 0x16, 0x06, 0x6d, 0x64,
+  0xf0, 0x51, 0x7b, 0x17, 0x02, 0xe9, 0x8e, 0xe9, 0x0b, 0xa1, 0x5e, 0x56,
+  0x12, 0x7f, 0xca, 0xf3, 0x0c, 0x08, 0x25, 0x71, 0xdf, 0xe8, 0x8c, 0x51,
+  0x69, 0x0f, 0x67, 0x88, 0x1b, 0xc8, 0x69, 0x7a, 0xb6, 0x7b, 0x4c, 0x83,
+  0xed, 0x84, 0x25, 0xe0, 0x74, 0xc9, 0x58, 0x95, 0x62, 0x58, 0xab, 0x18,
+  0x3d, 0x67, 0x57, 0x9a, 0x5a, 0x87, 0x4e, 0xfb, 0xda, 0xd2, 0xa4, 0xd9,
+  0x95, 0xae, 0x88, 0xa8, 0x39, 0xfc, 0x32, 0x9c, 0x32, 0x3e, 0x3b, 0x4d,
+  0x4c, 0xd7, 0x9e, 0x68, 0x51, 0x74, 0xe0, 0x89, 0xd6, 0xc6, 0xfa, 0xc4,
+  0xa9, 0x70, 0xa0, 0x3d, 0xa7, 0x04, 0xaa, 0x0f, 0x90, 0xe1, 0xe1, 0x0b,
+  0xd0, 0xff, 0xec, 0x10, 0xab, 0x3b, 0x12, 0x17, 0xc0, 0x1d, 0xe7, 0x16,
+  0x87, 0x9d, 0xf3, 0xbd, 0x78, 0xc5, 0x44, 0x7a, 0xa7, 0x7b, 0x15, 0x18,
+  0xaa, 0x80, 0xb1, 0x8c, 0x2f, 0x33, 0x03, 0x66, 0x6c, 0x1e, 0x78, 0xb2,
+  0x08, 0xe3, 0xd9, 0xab, 0x6e, 0x09, 0xd4, 0xf0, 0x21, 0x7a, 0x7c, 0x98,
+  0xc2, 0xa7, 0xdf, 0xbf, 0xf2, 0x80, 0x67, 0x7c, 0xe7, 0xe3, 0x38, 0x8c,
+  0xde, 0x4e, 0xdc, 0xfc, 0x03,
+  0xed, 0x99, 0x5b, 0x6f, 0x9b, 0x30, 0x18, 0x86, 0xef, 0xf7, 0x2b, 0x7c,
+  0x5f, 0x3a, 0xd9, 0xc6, 0xe6, 0x74, 0xd7, 0x6d, 0xed, 0xa6, 0x49, 0x9b,
+  0xd2, 0xb0, 0x6a, 0xbd, 0xb5, 0x83, 0xdb, 0xb0, 0x52, 0x88, 0x28, 0x74,
+  0xc9, 0x7e, 0xfd, 0x6c, 0x20, 0x07, 0x3b, 0x84, 0x90, 0xa6, 0xcb, 0x52,
+  0xb5, 0xa8, 0x52, 0x6c, 0xd2, 0x80, 0xdf, 0xe7, 0x3b, 0x99, 0x0f, 0x68,
+  0xc3, 0xea, 0x90, 0x1f, 0x37, 0xea, 0x13, 0x55, 0x7f, 0xcb, 0xc3, 0x0a,
+  0x59, 0x5c, 0x88, 0x3b, 0x30, 0x20, 0x1e, 0x04, 0xc3, 0xf2, 0x9e, 0x27,
+  0xc2, 0x62, 0x01, 0xc7, 0x16, 0x0f, 0xb8, 0x6d, 0x71, 0x36, 0xba, 0x0b,
+  0xb8, 0x67, 0x45, 0x93, 0x28, 0xfb, 0x9d, 0x06, 0x63, 0xf8, 0x9e, 0xc8,
+  0x71, 0x22, 0x6e, 0x0a, 0x35, 0x56, 0xe7, 0xf3, 0xf8, 0x76, 0x5c, 0x4d,
+  0xb0, 0x9c, 0x94, 0x13, 0x35, 0x42, 0x96, 0xfa, 0x87, 0x87, 0x71, 0x56,
+  0x26, 0x91, 0xc8, 0x03, 0x4e, 0xea, 0x79, 0x11, 0xab, 0x6b, 0x21, 0x58,
+  0xcd, 0x0a, 0xf9, 0xbb, 0x5b, 0xf5, 0x25, 0xad, 0xa6, 0xd3, 0x80, 0xd5,
+  0xe7, 0x67, 0x01, 0x43, 0x56, 0x75, 0xcd, 0xe5, 0xef, 0x9d, 0xe6, 0x44,
+  0x73, 0x81, 0xe6, 0xfb, 0xc5, 0x15, 0xdc, 0x7a, 0x2e, 0x2f, 0x61, 0xd7,
+  0x23, 0x79, 0x0d, 0x6c, 0x3d, 0x14, 0x2c, 0x2f, 0x02, 0xee, 0x5b, 0xd3,
+  0x80, 0x43, 0x6b, 0x26, 0x7f, 0x67, 0x4d, 0x12, 0x56, 0xdc, 0x64, 0xf9,
+  0x7d, 0xf0, 0x33, 0x4e, 0xa5, 0x9c, 0x07, 0xeb, 0x1d, 0x34, 0xe1, 0xa0,
+  0x76, 0x38, 0x6b, 0x5c, 0x76, 0xe4, 0x71, 0x5b, 0xc6, 0x91, 0x50, 0x1c,
+  0x5f, 0x2c, 0x18, 0xdc, 0x0e, 0xe6, 0x53, 0xc9, 0x12, 0x70, 0x96, 0xb2,
+  0x24, 0xbb, 0x7d, 0xc5, 0x5e, 0x83, 0x35, 0x36, 0xd0, 0xba, 0x64, 0x29,
+  0x67, 0xe0, 0x6b, 0x36, 0xab, 0x6e, 0x0e, 0x06, 0x49, 0xf9, 0xa0, 0xe8,
+  0x40, 0x45, 0x07, 0xed, 0x4b, 0xc5, 0x90, 0x49, 0xb5, 0x35, 0x63, 0xb5,
+  0x66, 0xbb, 0xdf, 0x9a, 0x51, 0xc7, 0x9a, 0xd5, 0x72, 0x91, 0x5a, 0x2e,
+  0x3e, 0x80, 0x31, 0x9d, 0xed, 0xc6, 0xa4, 0x7d, 0x8d, 0x89, 0x17, 0xc6,
+  0xa4, 0xeb, 0xc6, 0xec, 0x05, 0xc6, 0x69, 0x05, 0x73, 0x96, 0x8f, 0x58,
+  0x24, 0x40, 0x58, 0x19, 0x94, 0x40, 0xe4, 0xad, 0x11, 0x92, 0xaa, 0x9e,
+  0x96, 0x15, 0xfc, 0x56, 0x56, 0x2b, 0x74, 0xda, 0x59, 0xac, 0x88, 0x6f,
+  0x84, 0x7a, 0x3b, 0x09, 0xf5, 0xe4, 0xa1, 0x09, 0xbd, 0xe6, 0xd9, 0x14,
+  0x7c, 0xcc, 0xd2, 0x22, 0xcf, 0x92, 0x44, 0xe4, 0x2b, 0x1e, 0x5b, 0x0b,
+  0x74, 0xe7, 0xfa, 0x38, 0xb2, 0xe7, 0xf2, 0x6a, 0xd5, 0xb5, 0x3a, 0x65,
+  0x96, 0x4a, 0x1c, 0x47, 0xd8, 0x90, 0x44, 0x57, 0xcd, 0xef, 0xe9, 0xfa,
+  0x1a, 0x6f, 0xe8, 0x34, 0x3f, 0xd1, 0xcc, 0xef, 0x1b, 0x00, 0xe6, 0xee,
+  0xa0, 0xc5, 0x32, 0x99, 0x53, 0x71, 0xfa, 0xc5, 0x05, 0x72, 0xeb, 0x91,
+  0x1e, 0xca, 0xd0, 0x52, 0x19, 0x2e, 0x1c, 0x67, 0xd2, 0xea, 0xf6, 0x1a,
+  0x91, 0xdd, 0x4d, 0xae, 0x63, 0x71, 0xb4, 0xa8, 0xb0, 0x75, 0x2e, 0xde,
+  0x76, 0x2c, 0xae, 0x1e, 0x15, 0xc4, 0xe0, 0xe2, 0x77, 0x45, 0x85, 0x84,
+  0x36, 0x55, 0x48, 0x66, 0x8a, 0x6e, 0x07, 0x17, 0x8c, 0x28, 0x5c, 0x38,
+  0xce, 0x0a, 0x97, 0x21, 0xfb, 0x23, 0x72, 0xf0, 0x65, 0x16, 0xe5, 0x6c,
+  0x8d, 0x8b, 0xf3, 0x8c, 0xc9, 0xc2, 0xdb, 0x35, 0x39, 0x18, 0xde, 0x31,
+  0xd7, 0xde, 0xee, 0x1c, 0x6e, 0x3f, 0xe7, 0x58, 0x42, 0xf0, 0x5b, 0x20,
+  0x84, 0x22, 0x7f, 0x64, 0x89, 0x75, 0x52, 0xaf, 0xef, 0x44, 0xde, 0xf1,
+  0xb4, 0x1e, 0x9e, 0xca, 0xb5, 0xae, 0xf9, 0x0c, 0x7e, 0x62, 0x9a, 0x68,
+  0xe2, 0x64, 0x3b, 0xa6, 0x3e, 0x74, 0x9e, 0x87, 0x86, 0x51, 0xf6, 0x6a,
+  0x1a, 0x43, 0x16, 0xff, 0x2a, 0x0f, 0x59, 0x3f, 0x98, 0xbd, 0x6f, 0xfd,
+  0x60, 0xe4, 0x19, 0xea, 0xc7, 0x92, 0x0a, 0x6a, 0xa7, 0x92, 0xa5, 0x60,
+  0x10, 0x12, 0x70, 0xa1, 0xae, 0x3f, 0x61, 0xd1, 0xfe, 0x88, 0xe6, 0x8e,
+  0x81, 0x5f, 0x2e, 0x2c, 0x04, 0x49, 0x0b, 0xac, 0x01, 0x4b, 0x8b, 0xb1,
+  0xc8, 0x99, 0xe2, 0xf5, 0x86, 0x49, 0x1e, 0x78, 0x1b, 0x26, 0xdb, 0x28,
+  0xdc, 0x87, 0x27, 0xf6, 0x8f, 0x76, 0x71, 0xf6, 0x13, 0x89, 0xd9, 0x90,
+  0x69, 0xc4, 0x7e, 0xc6, 0x49, 0x34, 0x62, 0xc5, 0x01, 0x4a, 0xd5, 0x4a,
+  0xe1, 0xd9, 0xb3, 0x72, 0xd1, 0x67, 0xcc, 0xd5, 0x64, 0x73, 0xae, 0x06,
+  0x57, 0xe7, 0xaf, 0x38, 0x5d, 0x53, 0xe8, 0x6e, 0x04, 0xf3, 0x2d, 0xe3,
+  0x71, 0xfd, 0xd8, 0xff, 0x32, 0xb7, 0x7d, 0x2d, 0x6e, 0xb3, 0xeb, 0xb6,
+  0xcf, 0x7d, 0xc3, 0xd3, 0x89, 0xa7, 0x23, 0xac, 0x7e, 0xbc, 0xe6, 0xb0,
+  0xf2, 0xdf, 0xf2, 0x4d, 0x3b, 0x18, 0x76, 0x34, 0x1e, 0x73, 0x5c, 0x15,
+  0x1b, 0x11, 0xb3, 0x62, 0x67, 0xc9, 0xa3, 0xc8, 0xe3, 0x54, 0xbc, 0xba,
+  0x9a, 0x4d, 0x10, 0xae, 0x6b, 0xb6, 0xd1, 0x8a, 0x18, 0x0a, 0xb9, 0xc3,
+  0xbb, 0x0a, 0x3f, 0x80, 0xef, 0x0e, 0x01, 0xd5, 0x64, 0x90, 0xe5, 0x85,
+  0x75, 0xd2, 0xdc, 0x51, 0x6a, 0x39, 0x69, 0x6e, 0xa9, 0x4c, 0x7d, 0x3a,
+  0x3f, 0xed, 0x37, 0xc3, 0x59, 0x65, 0x40, 0xa6, 0x96, 0xc1, 0x57, 0x20,
+  0x72, 0xbc, 0x6c, 0xe6, 0x2c, 0x7b, 0x39, 0xb0, 0x69, 0xe5, 0xd8, 0x06,
+  0x3c, 0x33, 0x1f, 0xf7, 0x68, 0xc4, 0xa2, 0x45, 0x5b, 0x95, 0xf4, 0x50,
+  0x8d, 0x6c, 0x43, 0x75, 0x58, 0x4e, 0xaa, 0x00, 0x19, 0xd5, 0x3b, 0x5b,
+  0xa3, 0xc5, 0xdc, 0xd6, 0x67, 0xda, 0xc5, 0xc1, 0xc9, 0x9a, 0x47, 0xf7,
+  0xea, 0xfc, 0x36, 0x8b, 0x65, 0x11, 0x17, 0xda, 0x62, 0x1f, 0xbf, 0x66,
+  0x33, 0xf0, 0x49, 0x3c, 0xc6, 0xa3, 0x96, 0xba, 0x48, 0x17, 0xc8, 0x9d,
+  0x05, 0x72, 0x77, 0x89, 0xdc, 0x6b, 0x90, 0xd3, 0xc5, 0xfe, 0xdb, 0x31,
+  0xe4, 0xf9, 0x5d, 0x95, 0x11, 0xa1, 0x1e, 0xa6, 0x80, 0xdd, 0xb5, 0x11,
+  0x75, 0x36, 0x4b, 0x48, 0x5f, 0xf7, 0x65, 0xad, 0xcf, 0x76, 0x46, 0x57,
+  0xfc, 0x92, 0x0c, 0xcf, 0x2e, 0x14, 0x24, 0x5a, 0xbb, 0xe3, 0x9e, 0xcf,
+  0x2a, 0x66, 0x77, 0xc4, 0xc8, 0x75, 0x64, 0x3b, 0x1c, 0x7b, 0x53, 0x5f,
+  0xb5, 0x4a, 0x64, 0x48, 0xe9, 0xc6, 0xfd, 0x74, 0xeb, 0x7d, 0xd5, 0xf3,
+  0xeb, 0xf3, 0x4b, 0x30, 0xbc, 0x00, 0x9f, 0xd9, 0xbd, 0x68, 0x9e, 0xfb,
+  0x35, 0xbf, 0xf0, 0xfe, 0x67, 0xb7, 0x6c, 0x7b, 0x06, 0xef, 0x6f, 0x70,
+  0x6c, 0x08, 0x0f, 0x27, 0x42, 0x44, 0x49, 0x9c, 0xde, 0x01, 0x87, 0x52,
+  0x7a, 0xc0, 0x34, 0x7e, 0xca, 0xc8, 0xbe, 0x79, 0x9c, 0x74, 0xbd, 0x1e,
+  0x72, 0x77, 0xe3, 0x62, 0x43, 0xac, 0x71, 0xf9, 0xc2, 0xee, 0x19, 0x08,
+  0x47, 0x59, 0xfe, 0xdf, 0xba, 0x40, 0x47, 0x52, 0xfa, 0xe7, 0x80, 0xe8,
+  0x8d, 0xfe, 0x90, 0xa1, 0x22, 0xe5, 0x63, 0xc9, 0x85, 0xd1, 0xd4, 0xd0,
+  0xdf, 0xbd, 0xaa, 0xec, 0xb5, 0x28, 0x5c, 0x74, 0xe5, 0x2d, 0x84, 0xad,
+  0xbf, 0x85, 0xd8, 0x65, 0x1f, 0xe8, 0x6e, 0xf4, 0x02, 0xba, 0xe1, 0x25,
+  0x61, 0x95, 0x16, 0x60, 0x1f, 0x91, 0x8e, 0x11, 0x1d, 0xd7, 0x22, 0x9b,
+  0xee, 0x9f, 0x0b, 0x8e, 0xd6, 0xfa, 0xfd, 0xc3, 0xc3, 0xef, 0x48, 0x1b,
+  0x8e, 0xf3, 0x4f, 0xd3, 0xe5, 0x51, 0x81, 0xf9, 0x0b,
+  0xed, 0x99, 0x5b, 0x73, 0x9a, 0x40, 0x14, 0xc7, 0x9f, 0xdb, 0x4f, 0xc1,
+  0x7b, 0x48, 0x67, 0x2f, 0x5c, 0x36, 0xbc, 0x19, 0x9b, 0x74, 0xda, 0x49,
+  0xda, 0x4c, 0x48, 0x7a, 0x79, 0x5c, 0x84, 0x28, 0x13, 0x22, 0x0c, 0xae,
+  0x13, 0xed, 0xa7, 0xef, 0x2e, 0xb7, 0xca, 0x2a, 0x28, 0x22, 0xd1, 0x24,
+  0xf2, 0xe2, 0x2e, 0x86, 0x75, 0xcf, 0xef, 0xfc, 0xcf, 0x85, 0x0d, 0xc0,
+  0x20, 0xb9, 0xb0, 0x06, 0xa9, 0xf8, 0x44, 0x18, 0x10, 0xb0, 0x70, 0xa9,
+  0xf7, 0xf6, 0xb9, 0xd2, 0x0f, 0xc7, 0x2c, 0x0e, 0x83, 0xc0, 0x8b, 0x55,
+  0x6a, 0x39, 0x40, 0x75, 0x2c, 0x07, 0xaa, 0x0e, 0x1d, 0x3c, 0x5a, 0x0e,
+  0x51, 0xdd, 0xc8, 0x0d, 0x9f, 0xc7, 0xd6, 0x08, 0x7c, 0xd2, 0xf8, 0x38,
+  0xf0, 0x1e, 0x98, 0x18, 0x8b, 0xfb, 0xb1, 0x3f, 0x1c, 0x25, 0x13, 0xc4,
+  0x27, 0xd3, 0x48, 0x8c, 0xa0, 0x3a, 0x9c, 0xfa, 0xae, 0xc7, 0x9f, 0x47,
+  0xaa, 0xf8, 0xd3, 0xc9, 0x28, 0x9c, 0x06, 0xae, 0x17, 0x5b, 0x8e, 0x96,
+  0xce, 0x99, 0x2f, 0x56, 0x85, 0x20, 0x99, 0x31, 0xbe, 0xc2, 0x50, 0x7c,
+  0x69, 0x24, 0xd3, 0x99, 0x45, 0xd3, 0xfb, 0x73, 0x8b, 0x42, 0x35, 0x59,
+  0xfd, 0xff, 0xf3, 0x7a, 0x76, 0x23, 0x5b, 0x20, 0xfb, 0xbe, 0x58, 0xc1,
+  0x4c, 0xe7, 0x7c, 0x09, 0x94, 0x8e, 0xf8, 0x1a, 0x58, 0x9d, 0x30, 0x1a,
+  0x33, 0xcb, 0x39, 0x53, 0x67, 0x96, 0x83, 0xd4, 0xb9, 0xe5, 0x60, 0x35,
+  0x0a, 0x28, 0x7b, 0x08, 0xe3, 0x27, 0xeb, 0x97, 0x3f, 0xe6, 0x86, 0x4d,
+  0xd4, 0x8f, 0x40, 0x42, 0x84, 0x0d, 0x09, 0x51, 0xef, 0x81, 0x79, 0xf1,
+  0x30, 0x08, 0x9f, 0x95, 0x1b, 0x1b, 0x4b, 0xb0, 0xa0, 0x80, 0x85, 0xde,
+  0x1c, 0x2c, 0xb0, 0x16, 0x96, 0x0e, 0x91, 0xf8, 0x84, 0x90, 0x3a, 0x25,
+  0x58, 0xe4, 0xdc, 0x67, 0x9f, 0x43, 0xe5, 0x12, 0x03, 0xa5, 0x17, 0x0f,
+  0xa8, 0xeb, 0x29, 0xdf, 0xc2, 0x79, 0xb2, 0x91, 0xf6, 0xb8, 0xf6, 0x0e,
+  0x49, 0xdf, 0x12, 0x12, 0x5a, 0x0d, 0xe9, 0xfb, 0x85, 0x8d, 0x81, 0xc0,
+  0x82, 0x16, 0x43, 0xce, 0xc8, 0xb1, 0x9c, 0xf0, 0x3d, 0x67, 0x54, 0x4e,
+  0xb9, 0x1d, 0x39, 0x94, 0x93, 0x64, 0xcc, 0x99, 0x9c, 0xd2, 0x65, 0x24,
+  0x4b, 0x36, 0x66, 0x1b, 0x36, 0xc5, 0x86, 0xb1, 0xd8, 0x30, 0xd8, 0x60,
+  0xc3, 0x08, 0xac, 0xde, 0xb0, 0xfd, 0x3d, 0xdd, 0x6f, 0x29, 0x45, 0x40,
+  0xd0, 0x66, 0xc3, 0x92, 0xd7, 0x56, 0xfb, 0x68, 0xc1, 0x29, 0x99, 0x3d,
+  0xdc, 0x5d, 0x33, 0xf1, 0xf8, 0x3a, 0x0f, 0x18, 0x28, 0x8d, 0x65, 0x08,
+  0x4a, 0x97, 0xfa, 0xe3, 0xfe, 0x4f, 0x6f, 0x55, 0xde, 0xc3, 0xb9, 0x2d,
+  0xdc, 0xc5, 0x99, 0x29, 0xa9, 0x81, 0xa9, 0x29, 0xe2, 0x77, 0x13, 0x53,
+  0xb8, 0x78, 0xf3, 0xe0, 0xd5, 0xea, 0x74, 0x69, 0x94, 0x0c, 0xa4, 0xa8,
+  0xa9, 0x2c, 0x4d, 0x09, 0x00, 0xc4, 0x85, 0x2c, 0x71, 0x21, 0x4b, 0x4d,
+  0xb0, 0x80, 0x82, 0x05, 0xaa, 0x63, 0x41, 0x80, 0x99, 0x0c, 0xd0, 0xa0,
+  0xec, 0xdc, 0xfe, 0xdc, 0x09, 0xe3, 0xe1, 0x92, 0x5f, 0x8d, 0xee, 0xc2,
+  0xb3, 0x39, 0x07, 0x39, 0x3c, 0xf3, 0xa0, 0x94, 0x38, 0x2c, 0xaa, 0x7d,
+  0x7d, 0xc2, 0xcf, 0x80, 0x40, 0x43, 0xd3, 0x4b, 0x40, 0x7e, 0x3b, 0xe1,
+  0xac, 0xae, 0x28, 0x9a, 0xed, 0xc8, 0xe8, 0x8b, 0x64, 0x48, 0x39, 0x02,
+  0x32, 0x50, 0xb5, 0x64, 0xb4, 0x12, 0x99, 0x33, 0x59, 0x21, 0xb0, 0x8e,
+  0x8c, 0xd1, 0x94, 0x8c, 0xb9, 0x4c, 0x86, 0x17, 0xc8, 0x3a, 0x3a, 0xbb,
+  0xd4, 0x0d, 0x69, 0x29, 0x1b, 0x09, 0x0e, 0xd5, 0x77, 0xa8, 0x1a, 0x13,
+  0xa1, 0x12, 0x1b, 0x3b, 0xf2, 0x3c, 0x37, 0xf0, 0xc7, 0x8f, 0x1c, 0xce,
+  0x53, 0xe4, 0x31, 0x9f, 0xf9, 0xe1, 0x58, 0xb9, 0x89, 0xc3, 0x05, 0x42,
+  0x0d, 0x12, 0x65, 0xa3, 0xbd, 0x10, 0xc9, 0x4f, 0xd7, 0xd4, 0x55, 0xfa,
+  0x94, 0xfd, 0x55, 0x6c, 0x16, 0x7b, 0x1e, 0x53, 0x2e, 0xc5, 0xfa, 0x5e,
+  0xac, 0x68, 0x4a, 0xe1, 0xc1, 0xe4, 0x96, 0x9d, 0x17, 0xe6, 0xdd, 0x7b,
+  0xb0, 0x10, 0x24, 0x59, 0x97, 0xd4, 0xcf, 0xb6, 0x74, 0x00, 0x21, 0xa4,
+  0xc2, 0xe8, 0xcb, 0xaf, 0x3f, 0x53, 0xfb, 0x12, 0x19, 0x88, 0xb6, 0xad,
+  0xbb, 0xc6, 0x56, 0x2f, 0x5b, 0x6b, 0x6e, 0x1c, 0xbf, 0x72, 0xd5, 0x6b,
+  0xd5, 0xbb, 0x66, 0x4c, 0x10, 0x58, 0x95, 0xca, 0x96, 0x03, 0xf6, 0x9d,
+  0xf5, 0x61, 0x39, 0x1d, 0x43, 0xd3, 0xf6, 0x9a, 0xce, 0xcc, 0xe6, 0xc9,
+  0x5e, 0xdf, 0x34, 0xd9, 0xaf, 0xa0, 0x43, 0x9a, 0x69, 0xa7, 0x69, 0x19,
+  0xec, 0x2e, 0xd1, 0xef, 0x96, 0x4c, 0xeb, 0x54, 0x8f, 0x0e, 0xab, 0x0c,
+  0x1e, 0x1c, 0x1d, 0xe7, 0xd8, 0x24, 0x54, 0xb1, 0x21, 0x55, 0xca, 0x49,
+  0xca, 0x53, 0x44, 0xdd, 0x8e, 0x8b, 0x6f, 0x03, 0xa9, 0x74, 0x22, 0x0e,
+  0x7c, 0xec, 0xad, 0xab, 0xc9, 0xbc, 0xdd, 0xa4, 0x62, 0x2e, 0x17, 0xa3,
+  0x86, 0xba, 0x91, 0x03, 0x47, 0x6a, 0x64, 0x17, 0xba, 0xbb, 0xbb, 0x8b,
+  0xc3, 0x8c, 0xa1, 0x2d, 0xed, 0xae, 0x6a, 0x6a, 0xb3, 0xd3, 0xb4, 0x92,
+  0xe1, 0x8a, 0xad, 0xdc, 0x04, 0xd3, 0x49, 0xde, 0xe0, 0x76, 0x79, 0x18,
+  0xb9, 0x45, 0x47, 0xb7, 0xd3, 0xf3, 0xc6, 0x82, 0x8f, 0x53, 0xf1, 0xa6,
+  0xf3, 0x92, 0x8a, 0xe8, 0xea, 0x95, 0x46, 0x07, 0x18, 0xd5, 0x58, 0xc7,
+  0xcb, 0x85, 0x78, 0x9f, 0x7c, 0x09, 0x77, 0x1f, 0xf4, 0xd9, 0x73, 0x41,
+  0x8b, 0x6c, 0x46, 0x4b, 0xdb, 0x0f, 0x2d, 0x6e, 0x57, 0xdb, 0x53, 0x2e,
+  0x6d, 0x77, 0x2f, 0x3f, 0xba, 0x5c, 0x89, 0xaf, 0xe6, 0xe3, 0xd9, 0x7b,
+  0xed, 0xcb, 0x74, 0x83, 0x56, 0xa4, 0xd9, 0xe3, 0xbf, 0x78, 0x64, 0x56,
+  0x06, 0xd2, 0x2b, 0xc2, 0xec, 0xda, 0x1f, 0xf0, 0xf8, 0xea, 0xdf, 0xdd,
+  0x5e, 0xdd, 0xbe, 0x01, 0x50, 0x2b, 0x44, 0xd5, 0x10, 0x14, 0xae, 0x02,
+  0xb5, 0x23, 0x44, 0xaf, 0xf5, 0xdc, 0xc5, 0xc0, 0x72, 0xa2, 0xbe, 0xfa,
+  0x72, 0x0c, 0xb4, 0x65, 0x4c, 0x46, 0xc7, 0xfa, 0x79, 0xfd, 0x21, 0x46,
+  0x00, 0x86, 0x35, 0x25, 0x3f, 0x39, 0xce, 0x56, 0x7a, 0x41, 0x34, 0xa2,
+  0x42, 0x5f, 0x1f, 0x5e, 0x32, 0xe4, 0xf6, 0x5b, 0xed, 0xff, 0x01,
+  0xed, 0x98, 0x5b, 0x73, 0xe2, 0x36, 0x14, 0xc7, 0xdf, 0xfb, 0x29, 0xf4,
+  0xbe, 0xde, 0x8e, 0x6e, 0xbe, 0xe0, 0x37, 0x96, 0x4d, 0x32, 0x99, 0x26,
+  0x2d, 0x53, 0x6f, 0xdb, 0xbc, 0x4a, 0xb6, 0x08, 0x9e, 0x35, 0x36, 0x63,
+  0xcc, 0x00, 0xf9, 0xf4, 0x95, 0x7c, 0x0b, 0xb6, 0x89, 0x2f, 0x89, 0xd9,
+  0x0d, 0x4d, 0x79, 0x00, 0x09, 0x90, 0xed, 0xf3, 0xd3, 0xff, 0x5c, 0x74,
+  0x20, 0x81, 0xe9, 0x8b, 0x58, 0xd0, 0x54, 0x9f, 0x16, 0x24, 0x14, 0x1e,
+  0xbd, 0xb4, 0x7b, 0xe6, 0x81, 0x19, 0x4b, 0x9e, 0xc0, 0xb7, 0x2b, 0x0c,
+  0xe6, 0x0e, 0x01, 0xd7, 0xfe, 0xe3, 0x32, 0xd9, 0x24, 0xbe, 0xfb, 0x5d,
+  0x63, 0x36, 0x47, 0x1a, 0xb7, 0x39, 0xd6, 0x38, 0x73, 0xbf, 0xdb, 0xdc,
+  0xd2, 0xbc, 0xb5, 0x17, 0xed, 0x42, 0x7b, 0x09, 0x7f, 0xa5, 0x72, 0x1c,
+  0x88, 0x45, 0xa2, 0xc6, 0xea, 0xfb, 0x58, 0x2d, 0x53, 0x13, 0x2c, 0x27,
+  0xdb, 0xb5, 0x1a, 0x21, 0xed, 0x71, 0xeb, 0x7b, 0x42, 0x5e, 0x04, 0x6b,
+  0xea, 0xaf, 0x9b, 0x65, 0xb4, 0x0d, 0x3c, 0x11, 0xdb, 0x9c, 0xa6, 0xf3,
+  0x44, 0xae, 0x79, 0x54, 0x53, 0x23, 0x9d, 0xee, 0x6d, 0x06, 0xd3, 0xc1,
+  0xc1, 0x66, 0x48, 0x4b, 0xaf, 0xf7, 0xbc, 0x42, 0xcf, 0xbe, 0x28, 0x97,
+  0x98, 0xd9, 0x5c, 0xae, 0xc1, 0xd9, 0x48, 0x2e, 0x22, 0xda, 0x26, 0x61,
+  0x71, 0x62, 0xf3, 0x89, 0xb6, 0xb7, 0x39, 0xd4, 0x0e, 0x36, 0x27, 0xda,
+  0x3a, 0x60, 0xc9, 0x22, 0x8a, 0x57, 0xf6, 0x3f, 0x7e, 0x28, 0x9f, 0x7d,
+  0xa3, 0xfd, 0x02, 0x1b, 0x48, 0x2c, 0x74, 0x1a, 0x89, 0x73, 0xfd, 0x37,
+  0x98, 0xc6, 0x2e, 0xf3, 0xc4, 0x11, 0x15, 0x30, 0x0d, 0xd6, 0x4b, 0x26,
+  0x51, 0xd1, 0x4b, 0xe3, 0xa3, 0xbf, 0x9a, 0x4f, 0xab, 0x64, 0xe8, 0x4f,
+  0x90, 0x8c, 0xdc, 0xeb, 0xa1, 0x48, 0x18, 0x1d, 0x11, 0x09, 0x7a, 0xc9,
+  0x8b, 0x8e, 0x74, 0x92, 0x3b, 0xd4, 0xf9, 0x90, 0x98, 0xd9, 0x5c, 0xdd,
+  0x4c, 0xfe, 0x0a, 0x5f, 0xab, 0x99, 0xe2, 0x02, 0xa8, 0x26, 0x21, 0x3a,
+  0xa2, 0x8b, 0x21, 0xab, 0x2f, 0xaf, 0x33, 0x7a, 0x95, 0xde, 0xc2, 0x8b,
+  0xd1, 0x6e, 0x5e, 0xb4, 0x9d, 0xd7, 0x98, 0x2e, 0x87, 0x09, 0x3e, 0xcd,
+  0x6b, 0x1e, 0xb0, 0x83, 0x93, 0xb0, 0xc4, 0x8f, 0x42, 0xf0, 0x25, 0x66,
+  0xbb, 0x60, 0xcd, 0xbc, 0xb7, 0x13, 0x7b, 0xcf, 0xd1, 0x99, 0x12, 0xd2,
+  0x43, 0x3a, 0xc0, 0x39, 0xaf, 0xaf, 0xd1, 0xf3, 0xfa, 0xda, 0xa8, 0xc0,
+  0xac, 0xde, 0xc0, 0xe8, 0xcf, 0x01, 0x36, 0x20, 0x7a, 0xbf, 0x00, 0x6c,
+  0xd4, 0x60, 0xae, 0xbf, 0xe4, 0x6c, 0xcd, 0xdc, 0xff, 0xa3, 0x84, 0xf6,
+  0x5e, 0x9c, 0xcf, 0xa0, 0x7a, 0x05, 0xcd, 0x03, 0x8f, 0xf6, 0x60, 0x16,
+  0x85, 0x49, 0x1c, 0x05, 0x81, 0x88, 0x15, 0x06, 0xa8, 0x30, 0xa0, 0x1c,
+  0x83, 0x31, 0x46, 0xe4, 0xc9, 0xf7, 0xdc, 0xaa, 0x6a, 0x06, 0x0f, 0xd5,
+  0xcc, 0xa4, 0x26, 0x19, 0xbd, 0xe4, 0x42, 0x4a, 0x2e, 0xb4, 0xe0, 0x62,
+  0x2a, 0x2e, 0xb8, 0x37, 0x17, 0x93, 0xa0, 0xee, 0xf8, 0x3c, 0x66, 0x59,
+  0xf4, 0x8e, 0x45, 0x22, 0x16, 0x5c, 0x54, 0x60, 0xfc, 0x7e, 0xf5, 0x07,
+  0x70, 0xae, 0x2e, 0x4a, 0x1b, 0x78, 0x0c, 0x6d, 0x64, 0x92, 0x40, 0x18,
+  0x55, 0x6b, 0x1d, 0x27, 0x11, 0x22, 0x70, 0x44, 0xec, 0x8b, 0x0d, 0xb8,
+  0x8e, 0x85, 0x68, 0x80, 0x41, 0xf8, 0x6d, 0x64, 0x7a, 0x6c, 0x7f, 0xeb,
+  0x76, 0xcb, 0xe0, 0xba, 0x57, 0xb6, 0x1d, 0x14, 0xe4, 0x1e, 0x06, 0x5a,
+  0x2d, 0x06, 0x3a, 0x49, 0xcc, 0x92, 0xed, 0x06, 0x3c, 0xdc, 0x35, 0xcd,
+  0x2c, 0x45, 0xcf, 0x11, 0x29, 0xac, 0xe4, 0x88, 0x96, 0x46, 0x72, 0xa4,
+  0x67, 0x36, 0x2a, 0x22, 0x45, 0x7c, 0x9c, 0xbc, 0xb7, 0xbc, 0xd2, 0x5b,
+  0x08, 0x04, 0xf6, 0xe0, 0xf4, 0x75, 0x1b, 0xbd, 0xdd, 0x51, 0x0a, 0x56,
+  0xf0, 0xe2, 0xc2, 0x69, 0x4e, 0x0a, 0xfd, 0x4f, 0xaa, 0x83, 0x14, 0xcf,
+  0x62, 0x2d, 0xa4, 0xac, 0x9a, 0x78, 0x9c, 0xeb, 0x87, 0x92, 0x4a, 0x91,
+  0x5c, 0xcc, 0x93, 0xf1, 0xe1, 0xe8, 0x5c, 0xd7, 0x69, 0x4f, 0xcd, 0x02,
+  0x5e, 0x7a, 0x80, 0xa5, 0x9e, 0x16, 0x75, 0x3d, 0x2d, 0x45, 0x28, 0xab,
+  0xa8, 0xaa, 0xd5, 0x03, 0xd4, 0xbe, 0xed, 0xfc, 0x10, 0x38, 0xcb, 0x28,
+  0xcb, 0x88, 0xf8, 0x78, 0x2b, 0xad, 0x31, 0x62, 0x60, 0xb9, 0x01, 0x43,
+  0x0d, 0x36, 0xab, 0x51, 0x01, 0x36, 0xec, 0x6f, 0xd9, 0xc1, 0xa3, 0xf0,
+  0x09, 0x7b, 0x40, 0xa1, 0x75, 0x28, 0x57, 0x81, 0x70, 0xa3, 0x15, 0xf8,
+  0x0b, 0xc9, 0xd4, 0x51, 0x62, 0x21, 0x45, 0xd0, 0x84, 0x67, 0xcb, 0x9a,
+  0xc3, 0x8f, 0x2d, 0x93, 0x21, 0x45, 0x44, 0x86, 0x25, 0xad, 0x22, 0x50,
+  0x1f, 0x2c, 0x7a, 0x0d, 0x8b, 0xc3, 0xc2, 0x1d, 0x03, 0xf7, 0xbe, 0x1b,
+  0x47, 0xe0, 0x26, 0xf6, 0xd7, 0x60, 0x1e, 0x47, 0x0d, 0xa9, 0x5b, 0x23,
+  0xd2, 0xa9, 0x9f, 0xea, 0xf4, 0x6e, 0x3c, 0x46, 0xdf, 0x53, 0x1d, 0x2a,
+  0xf9, 0xe0, 0x4a, 0x32, 0xe9, 0x76, 0x25, 0x02, 0x79, 0x9e, 0x4d, 0x6a,
+  0xaa, 0xb9, 0x77, 0x14, 0x11, 0x6f, 0xeb, 0xa6, 0xb5, 0xe6, 0xdc, 0xc1,
+  0x60, 0xea, 0xb1, 0x75, 0x92, 0x15, 0xe5, 0xa7, 0x5d, 0x2b, 0x4b, 0xb6,
+  0x79, 0xde, 0xd5, 0x8f, 0xf2, 0x2e, 0x79, 0xce, 0xbb, 0x2d, 0x6e, 0x55,
+  0x07, 0x34, 0xdc, 0xaf, 0x50, 0x0f, 0xbf, 0xaa, 0x02, 0xea, 0x76, 0xab,
+  0x02, 0x90, 0x5e, 0x03, 0x74, 0xc3, 0x56, 0x62, 0xb6, 0xe5, 0xe2, 0xd4,
+  0x71, 0x05, 0x3f, 0x13, 0x81, 0x25, 0x91, 0x67, 0xcd, 0xc8, 0x5b, 0xe7,
+  0x3c, 0xd0, 0xe0, 0x26, 0x91, 0x51, 0x0b, 0xfe, 0xa4, 0x34, 0x51, 0x6f,
+  0x9a, 0x68, 0xf6, 0xd3, 0x80, 0x0e, 0x5d, 0xf5, 0x89, 0x95, 0xb1, 0x95,
+  0xd3, 0x98, 0x90, 0xa7, 0x31, 0xe7, 0xce, 0xd0, 0x75, 0xe3, 0xcb, 0x6f,
+  0x8d, 0xe4, 0x78, 0x4e, 0xdf, 0xf8, 0x11, 0x1d, 0x0f, 0xdc, 0xcd, 0x05,
+  0xe5, 0x23, 0x54, 0xdb, 0x7a, 0x11, 0xfa, 0xb2, 0x62, 0xb8, 0x67, 0xfb,
+  0x85, 0x1f, 0x0b, 0x19, 0x3d, 0x58, 0xe8, 0xf9, 0x6c, 0x03, 0xb2, 0xf8,
+  0xfa, 0x41, 0x21, 0x55, 0xbb, 0x42, 0x50, 0xfb, 0x2a, 0x16, 0x22, 0x94,
+  0x0f, 0x01, 0x94, 0xa3, 0x80, 0x3f, 0x99, 0x2b, 0x87, 0x0f, 0xe6, 0x47,
+  0x04, 0x64, 0x66, 0xa1, 0x83, 0x56, 0x65, 0xa4, 0xcd, 0x22, 0x1e, 0xb3,
+  0xff, 0x54, 0x47, 0x71, 0x60, 0x83, 0xac, 0x20, 0x83, 0x31, 0xaa, 0x15,
+  0x9d, 0x4f, 0xab, 0x03, 0x98, 0x47, 0x3b, 0xa9, 0x98, 0xf9, 0x2c, 0xd5,
+  0xcf, 0x28, 0x5d, 0xe8, 0xcb, 0xed, 0xbd, 0x52, 0x53, 0x4f, 0x47, 0x06,
+  0x32, 0xbc, 0x46, 0x12, 0x72, 0x92, 0x68, 0xfd, 0x01, 0xdd, 0x6a, 0x92,
+  0xe5, 0x65, 0x4a, 0xa1, 0x51, 0x41, 0x32, 0x75, 0x66, 0xb7, 0xb7, 0xc0,
+  0x11, 0x6c, 0xe5, 0xbb, 0x6d, 0xad, 0xc4, 0x51, 0x0e, 0x04, 0x47, 0x16,
+  0x0d, 0x6e, 0x91, 0x9d, 0x28, 0x44, 0x68, 0xab, 0xc1, 0x68, 0x02, 0xf3,
+  0x34, 0x5d, 0x31, 0xf8, 0x76, 0x2d, 0x1e, 0x19, 0x98, 0xdf, 0x4c, 0x20,
+  0x26, 0xcd, 0xa6, 0x08, 0x1c, 0xf1, 0xdc, 0x83, 0x48, 0xd5, 0x68, 0x6b,
+  0x70, 0x81, 0x46, 0x6b, 0x0c, 0x26, 0x3d, 0x0f, 0x3e, 0xbd, 0xc0, 0x90,
+  0x17, 0xc1, 0x58, 0xa6, 0xf6, 0x29, 0xbf, 0xfc, 0x27, 0x19, 0xa5, 0x3e,
+  0xe7, 0xe3, 0xcf, 0x8c, 0x5e, 0x32, 0xb0, 0xd7, 0x61, 0x92, 0xef, 0x55,
+  0x4c, 0xd3, 0x15, 0x7b, 0x92, 0x15, 0xfe, 0xdd, 0x36, 0x64, 0xa3, 0xb6,
+  0xde, 0xf3, 0x70, 0x6b, 0xbd, 0xb5, 0xc1, 0xb6, 0xf2, 0x37, 0x2e, 0x2a,
+  0x2d, 0x1f, 0xa7, 0xd3, 0xd6, 0xde, 0x15, 0xf9, 0x17,
+  0xed, 0x99, 0x49, 0x73, 0x9b, 0x30, 0x14, 0xc7, 0xef, 0xfd, 0x14, 0xba,
+  0x87, 0x74, 0xb4, 0xb0, 0xdf, 0x3c, 0xc9, 0x24, 0xd3, 0x83, 0x3b, 0x99,
+  0xba, 0xdb, 0x55, 0x02, 0x1c, 0x33, 0xc5, 0xe0, 0x11, 0xd0, 0x38, 0x97,
+  0x7e, 0xf6, 0x4a, 0x6c, 0xb1, 0x64, 0x1b, 0xf0, 0x92, 0xe9, 0xe2, 0xf8,
+  0x82, 0xb0, 0x15, 0xa2, 0xff, 0xef, 0x3d, 0xbd, 0x45, 0x40, 0x02, 0xab,
+  0x8f, 0xc9, 0x10, 0xae, 0x06, 0xc8, 0x0c, 0xe1, 0xc6, 0xc7, 0xf8, 0xf8,
+  0xfc, 0x23, 0x03, 0x93, 0x98, 0xcf, 0x93, 0xcc, 0xa0, 0x3e, 0x83, 0x06,
+  0xf3, 0x19, 0x32, 0x18, 0x0d, 0x7e, 0xf8, 0xcc, 0x35, 0xc2, 0x55, 0x98,
+  0x3d, 0xa5, 0xfe, 0x02, 0xbe, 0x37, 0xc5, 0x38, 0x89, 0xe6, 0x85, 0x1c,
+  0xcb, 0xef, 0x79, 0xfc, 0xb8, 0xa8, 0x6e, 0xb0, 0xb8, 0x29, 0x57, 0x72,
+  0x84, 0x8c, 0xc7, 0x32, 0x0e, 0x23, 0xf1, 0xf7, 0xd0, 0x90, 0x53, 0xf3,
+  0x45, 0x56, 0x26, 0x61, 0xc4, 0x7d, 0x4a, 0xea, 0xfb, 0x22, 0x16, 0x4f,
+  0xa5, 0xf5, 0x8f, 0x85, 0x78, 0xc0, 0xa3, 0xf8, 0x8d, 0xd9, 0x46, 0xf5,
+  0xa8, 0x6e, 0x32, 0xb3, 0x9a, 0x2f, 0xea, 0xd9, 0xb8, 0xbe, 0xeb, 0xa6,
+  0x3b, 0x46, 0x5e, 0x50, 0x5e, 0xf8, 0xcc, 0x33, 0xd6, 0x3e, 0xc3, 0xc6,
+  0xb3, 0xcf, 0x88, 0xb1, 0x4a, 0x68, 0x31, 0xcf, 0xf8, 0xd2, 0xff, 0x16,
+  0xa7, 0x62, 0xc1, 0xb9, 0xf1, 0x0e, 0xb6, 0xba, 0x03, 0x68, 0xc9, 0x2b,
+  0x71, 0x10, 0x51, 0x74, 0x3f, 0x24, 0xf4, 0x79, 0x56, 0xd0, 0x22, 0xce,
+  0x52, 0xf0, 0x35, 0x2e, 0xa8, 0x14, 0x8f, 0xa4, 0x78, 0xac, 0x8b, 0x67,
+  0x88, 0xb4, 0xda, 0x19, 0xb2, 0x3a, 0xe9, 0x0c, 0x99, 0xb5, 0x72, 0x41,
+  0x56, 0x95, 0xcb, 0xcc, 0xea, 0x7e, 0xdd, 0x4a, 0x7d, 0xf6, 0x29, 0xda,
+  0x23, 0x72, 0x2d, 0xd9, 0x54, 0x23, 0x31, 0xc9, 0x54, 0xa4, 0xc1, 0xb1,
+  0xd2, 0x6c, 0x17, 0x62, 0x55, 0xda, 0x8c, 0x80, 0x9b, 0x2c, 0x2d, 0x78,
+  0x96, 0x24, 0x11, 0x97, 0xc2, 0xf0, 0xa6, 0x55, 0xbd, 0x63, 0xad, 0xaa,
+  0xcb, 0xb4, 0x37, 0xac, 0xda, 0xda, 0xbc, 0xb5, 0x13, 0x25, 0xbf, 0x86,
+  0x21, 0x38, 0x9b, 0x96, 0x66, 0x08, 0xa9, 0xa6, 0xa6, 0xe6, 0xaf, 0x0e,
+  0x12, 0xee, 0x20, 0x59, 0x2d, 0x24, 0x57, 0x42, 0x22, 0x12, 0x12, 0x1c,
+  0x01, 0x89, 0x42, 0xc8, 0x34, 0x48, 0xa6, 0x06, 0x69, 0xb7, 0xf5, 0x4f,
+  0x85, 0x64, 0xf6, 0x42, 0x1a, 0xed, 0x28, 0x7b, 0x19, 0xf5, 0x21, 0x3a,
+  0xcc, 0x8f, 0x02, 0xb3, 0xbe, 0x5e, 0x18, 0xa2, 0x22, 0x2b, 0x83, 0xc5,
+  0x8a, 0x86, 0xd5, 0x3e, 0x3f, 0x88, 0x97, 0xa5, 0xf1, 0xba, 0xe1, 0x59,
+  0x5a, 0xe6, 0x53, 0xba, 0x06, 0x93, 0x90, 0xae, 0x8a, 0x73, 0x20, 0xfb,
+  0x67, 0x7d, 0x29, 0x80, 0xde, 0xdb, 0x76, 0xeb, 0x45, 0x14, 0x52, 0x18,
+  0xec, 0xcd, 0x48, 0x37, 0x09, 0xcd, 0xf3, 0x38, 0xe8, 0x0b, 0xe3, 0x1d,
+  0xb2, 0x2b, 0xa1, 0xa2, 0x21, 0x76, 0x2d, 0x94, 0xb5, 0xc0, 0xae, 0xaa,
+  0xb1, 0xe0, 0x75, 0x4d, 0xd1, 0xce, 0xc0, 0xdd, 0xa5, 0x54, 0x73, 0x4f,
+  0x5c, 0xee, 0x26, 0xa8, 0x0a, 0x47, 0xc7, 0xdc, 0xc8, 0xd6, 0x15, 0xce,
+  0xac, 0xbf, 0xd3, 0x09, 0x96, 0x71, 0x1e, 0xa0, 0x2a, 0xa3, 0xff, 0x1d,
+  0xa1, 0x65, 0x8e, 0x61, 0xf8, 0x46, 0xee, 0x40, 0x72, 0x51, 0x55, 0xde,
+  0x42, 0xa2, 0x06, 0xe5, 0x7b, 0xba, 0x8c, 0xf2, 0x26, 0x16, 0x2b, 0xc5,
+  0xad, 0x73, 0xc6, 0x58, 0xec, 0xaa, 0x1b, 0xaa, 0x01, 0x77, 0x40, 0xa0,
+  0xf1, 0xb4, 0x1d, 0xd7, 0xf2, 0xda, 0x5d, 0x1f, 0xda, 0xe3, 0x4a, 0xdf,
+  0x39, 0x34, 0xeb, 0x11, 0x53, 0x4b, 0xdf, 0xcf, 0x0b, 0x5e, 0xe6, 0xc5,
+  0x92, 0x4a, 0x2c, 0xe0, 0x2e, 0xe6, 0x82, 0x8f, 0x78, 0x00, 0xb8, 0x2d,
+  0x69, 0x02, 0x1e, 0xb2, 0xa7, 0x0d, 0x56, 0xf8, 0xc4, 0x92, 0xd1, 0xed,
+  0x75, 0x2f, 0xa4, 0x52, 0xb3, 0x86, 0xa1, 0xd9, 0xaa, 0x53, 0x6d, 0xf7,
+  0x06, 0xdb, 0x4e, 0x45, 0x5a, 0x68, 0xc2, 0x28, 0x6b, 0x69, 0xfd, 0xb1,
+  0xd4, 0x90, 0xb2, 0x03, 0xa1, 0xf1, 0xa9, 0x5c, 0xb2, 0x24, 0x02, 0x77,
+  0x19, 0x0f, 0xa2, 0x2d, 0x40, 0xaf, 0x98, 0xd8, 0x8f, 0xe0, 0x82, 0x0e,
+  0xe1, 0xe2, 0x1d, 0x86, 0x85, 0x68, 0x58, 0x6a, 0x67, 0x9a, 0xd6, 0xce,
+  0xf4, 0xa9, 0x4c, 0xc1, 0x47, 0x70, 0xcb, 0xe3, 0x9f, 0x11, 0x50, 0xd2,
+  0xd9, 0xf9, 0x43, 0x97, 0xd3, 0xd3, 0x62, 0x6e, 0x21, 0x1c, 0x6e, 0xc8,
+  0xda, 0x80, 0xb4, 0x0f, 0xa1, 0x75, 0x86, 0xc4, 0xdf, 0x22, 0x34, 0x4f,
+  0xde, 0x8f, 0x97, 0xe3, 0x6e, 0x0e, 0x9c, 0x2b, 0xac, 0x54, 0x28, 0xae,
+  0x84, 0xe2, 0x35, 0x50, 0xcc, 0x97, 0x86, 0xbd, 0xeb, 0xd7, 0xf1, 0x4b,
+  0xbb, 0x4e, 0x9a, 0x6e, 0x5d, 0x3b, 0x9b, 0x90, 0x09, 0x66, 0x83, 0x86,
+  0x56, 0x1a, 0xa1, 0x11, 0xad, 0x7c, 0x1b, 0x86, 0x9a, 0x27, 0xe8, 0xc5,
+  0x13, 0xea, 0xdc, 0xc4, 0xaa, 0xa4, 0x57, 0x7e, 0x22, 0x98, 0x8d, 0x11,
+  0xaf, 0xef, 0xb5, 0x69, 0x9c, 0xc6, 0x7f, 0x26, 0xf9, 0x37, 0x60, 0x4e,
+  0xa8, 0x9d, 0x47, 0xb8, 0xc5, 0xf8, 0x2d, 0xe4, 0xf6, 0x45, 0xa1, 0xbb,
+  0x88, 0x73, 0xca, 0x63, 0x80, 0x2c, 0xf8, 0x6a, 0x51, 0x68, 0x98, 0xdc,
+  0x11, 0xa8, 0xce, 0x12, 0x5d, 0xbc, 0x3f, 0x1d, 0xa0, 0xff, 0x59, 0xa7,
+  0xa2, 0x62, 0x7d, 0x0a, 0x39, 0x64, 0x8b, 0xcb, 0x74, 0xab, 0x72, 0x44,
+  0xf8, 0xd8, 0x1d, 0xb7, 0x1b, 0x4e, 0x27, 0xc6, 0x1b, 0x1d, 0x7a, 0xb7,
+  0x8f, 0x43, 0xeb, 0xf2, 0x66, 0x7c, 0x51, 0x18, 0xf5, 0xb9, 0x49, 0x34,
+  0x7b, 0xa2, 0x2b, 0xf0, 0xc0, 0xb3, 0xb7, 0x9e, 0x5d, 0xa1, 0x86, 0xb0,
+  0x96, 0xba, 0x5f, 0xd2, 0x11, 0x20, 0x97, 0x9b, 0xa5, 0x91, 0xd5, 0x57,
+  0xd1, 0x54, 0x8c, 0x26, 0x29, 0x4d, 0xb2, 0x47, 0x60, 0x5e, 0x2e, 0x24,
+  0x0c, 0x77, 0xf9, 0xce, 0xe7, 0xfa, 0x3f, 0x5d, 0x30, 0x16, 0x32, 0xe8,
+  0x3b, 0x0d, 0xa3, 0xff, 0x37, 0x61, 0x1d, 0x19, 0x8d, 0xb0, 0xad, 0xa1,
+  0xbb, 0x7f, 0x00, 0xdf, 0x3f, 0xdc, 0x6e, 0xe5, 0x2b, 0xfb, 0xd5, 0x4e,
+  0x3a, 0x28, 0x3e, 0xf1, 0xa0, 0x83, 0xf6, 0xbe, 0x07, 0x73, 0x0e, 0x4a,
+  0x69, 0xd8, 0xd5, 0x70, 0xcc, 0x82, 0x8c, 0x47, 0x60, 0x72, 0xb9, 0x0e,
+  0xe2, 0x3a, 0xcc, 0x56, 0xf7, 0xd6, 0xb7, 0x9b, 0x19, 0x10, 0x1b, 0x2c,
+  0x2b, 0x8a, 0x24, 0xea, 0xda, 0x25, 0xb7, 0x6b, 0x97, 0xbc, 0x97, 0x76,
+  0xc9, 0x69, 0xda, 0x25, 0xe5, 0x25, 0x9f, 0xa5, 0x88, 0xbd, 0xa6, 0x7b,
+  0x23, 0x49, 0x3b, 0xe5, 0x4a, 0x4c, 0xe9, 0x5b, 0x27, 0xaa, 0xbb, 0x3b,
+  0x17, 0xc2, 0x81, 0x37, 0x98, 0xe7, 0x37, 0xe0, 0x11, 0x26, 0xdb, 0xf3,
+  0x12, 0x7a, 0xd0, 0x1e, 0x16, 0x24, 0xcd, 0xcb, 0x77, 0xa4, 0xea, 0x9c,
+  0x14, 0xb2, 0x4f, 0xf9, 0x2a, 0x8c, 0xb2, 0xfb, 0xc0, 0x5f, 0xd9, 0xc6,
+  0xe6, 0x91, 0xf5, 0x16, 0x6e, 0x17, 0x3b, 0x6a, 0x89, 0x78, 0xef, 0x12,
+  0xa7, 0x99, 0x60, 0x91, 0xf6, 0xad, 0x10, 0xc1, 0xd7, 0x38, 0x27, 0x3c,
+  0x78, 0x4b, 0x39, 0x83, 0xef, 0xd6, 0x07, 0x63, 0x8a, 0x85, 0x9a, 0xe3,
+  0x3f, 0x4c, 0x54, 0x1c, 0xf1, 0xfd, 0x97, 0xfb, 0x2f, 0x40, 0x1e, 0x2a,
+  0xcb, 0xe0, 0x72, 0x9a, 0x1f, 0xa2, 0x4d, 0x95, 0x9a, 0x53, 0x8e, 0x28,
+  0x7b, 0xa1, 0xe6, 0x94, 0x78, 0x87, 0x9e, 0xdf,
+  0xed, 0x97, 0x4d, 0x73, 0x9b, 0x30, 0x10, 0x86, 0xef, 0xfd, 0x15, 0xdc,
+  0x43, 0x3a, 0x12, 0xdf, 0x70, 0xcb, 0xe4, 0xbb, 0x33, 0x49, 0x3b, 0x75,
+  0x27, 0xe9, 0x55, 0x80, 0x62, 0x33, 0xc1, 0xc6, 0x03, 0xb8, 0xb5, 0x2f,
+  0xfd, 0xed, 0x95, 0x04, 0xa2, 0x08, 0x84, 0x0d, 0x31, 0x53, 0xbb, 0xa9,
+  0x7d, 0xf1, 0x0a, 0x5b, 0x62, 0xf7, 0xd1, 0xbb, 0xab, 0x15, 0xd0, 0x01,
+  0xfb, 0x98, 0x26, 0x70, 0x0b, 0xcb, 0x37, 0x40, 0xed, 0xa3, 0x3e, 0x3e,
+  0xdd, 0x5f, 0xdd, 0x5f, 0x28, 0x4f, 0x51, 0x9a, 0xaf, 0x50, 0xac, 0x22,
+  0xcf, 0x07, 0xaa, 0xef, 0xf9, 0x50, 0xf5, 0x51, 0xf0, 0xea, 0xf9, 0x96,
+  0x1a, 0x2e, 0xc3, 0xe4, 0xe7, 0xc2, 0x9b, 0x81, 0x8f, 0x06, 0xb1, 0x63,
+  0xfc, 0x92, 0x53, 0xdb, 0x21, 0x76, 0x1a, 0x4d, 0x67, 0x6c, 0xa0, 0x91,
+  0xc1, 0x6a, 0x49, 0x2d, 0xa8, 0xd2, 0x3f, 0x64, 0xb3, 0x64, 0x15, 0x87,
+  0x38, 0xf5, 0x7c, 0xa3, 0x18, 0xe7, 0x11, 0x5d, 0xcb, 0x61, 0x83, 0x9c,
+  0x4c, 0x9b, 0x92, 0xdf, 0xce, 0x90, 0xc6, 0xc6, 0x6b, 0x0f, 0x01, 0x66,
+  0x6c, 0x3c, 0x04, 0x55, 0xb6, 0xe6, 0x9f, 0xf9, 0x66, 0xf9, 0xa0, 0x58,
+  0xc0, 0x2d, 0x46, 0x7c, 0x85, 0x73, 0xb2, 0x02, 0x7b, 0x40, 0x96, 0xd0,
+  0x0b, 0x8b, 0xac, 0x61, 0xa8, 0x59, 0x8e, 0xd2, 0xdc, 0xf3, 0x6d, 0x75,
+  0xed, 0xf9, 0x9a, 0xba, 0xf1, 0x7c, 0x5d, 0x5d, 0xc6, 0x28, 0x7f, 0x49,
+  0xd2, 0xb9, 0xf7, 0x1c, 0x2d, 0x48, 0x38, 0x99, 0xfa, 0x01, 0x34, 0xc0,
+  0x40, 0x60, 0x6b, 0x32, 0x30, 0x93, 0x59, 0x84, 0xe3, 0x90, 0x72, 0x71,
+  0x29, 0x17, 0xa7, 0xe4, 0x02, 0xe1, 0x7e, 0x60, 0xcc, 0x3a, 0x18, 0x5d,
+  0x00, 0x83, 0xf4, 0xdd, 0x5c, 0x0c, 0x81, 0x8b, 0x26, 0x72, 0x41, 0x46,
+  0x85, 0x45, 0xab, 0xb0, 0x98, 0x1c, 0x0b, 0xa0, 0x58, 0x6c, 0x8a, 0xc5,
+  0xea, 0x83, 0xc5, 0x90, 0x63, 0xb9, 0x4c, 0x16, 0x79, 0x9a, 0xc4, 0x31,
+  0x4e, 0x29, 0x1a, 0x42, 0x83, 0x6a, 0x06, 0x70, 0x38, 0xfa, 0x50, 0x38,
+  0xd3, 0x55, 0x14, 0x62, 0x32, 0x51, 0x6b, 0x60, 0xb2, 0xeb, 0x98, 0x4c,
+  0x11, 0x93, 0xb1, 0x1b, 0x93, 0x25, 0x60, 0x32, 0x1a, 0x98, 0x4c, 0x89,
+  0x7a, 0x2c, 0x8e, 0x49, 0xa7, 0x98, 0x5c, 0x8a, 0xc9, 0xd9, 0x86, 0xc9,
+  0x86, 0x21, 0xfd, 0x16, 0x18, 0x51, 0x4c, 0xdf, 0x92, 0x39, 0xc6, 0xca,
+  0xe4, 0xf1, 0x7a, 0x52, 0x43, 0xa5, 0x5c, 0x84, 0x68, 0x99, 0x17, 0xc8,
+  0xe4, 0x59, 0x76, 0x86, 0x2a, 0x5c, 0xe7, 0x24, 0x2e, 0x4e, 0xeb, 0x8c,
+  0xd9, 0x04, 0xd6, 0x79, 0x19, 0x75, 0x5b, 0x09, 0x35, 0x65, 0x0d, 0xd3,
+  0x3f, 0x8f, 0x00, 0x4a, 0x23, 0xe8, 0x0e, 0x80, 0x6d, 0x39, 0xdf, 0x71,
+  0x6d, 0x48, 0x00, 0x15, 0xe1, 0x2d, 0x5e, 0xb9, 0x30, 0x60, 0x5e, 0x19,
+  0x4d, 0xaf, 0xee, 0xae, 0x2f, 0x2d, 0x43, 0xf9, 0x94, 0x6c, 0xd8, 0xa6,
+  0x4a, 0x48, 0xca, 0x0a, 0x50, 0x5d, 0x24, 0x7b, 0x03, 0xe3, 0xae, 0x59,
+  0x6d, 0xd7, 0x6e, 0xd1, 0x1c, 0x2f, 0x11, 0xab, 0x16, 0x5a, 0xdb, 0x2b,
+  0x51, 0xaa, 0xf5, 0x97, 0xea, 0xf4, 0xa5, 0x60, 0xdb, 0x4b, 0xfd, 0x0e,
+  0x1e, 0x97, 0x68, 0x19, 0x24, 0x73, 0xe5, 0x8e, 0x6c, 0x96, 0x72, 0x91,
+  0x06, 0x28, 0xc4, 0x8d, 0xd4, 0xd4, 0xa9, 0x1f, 0x46, 0xe9, 0x87, 0xdd,
+  0xa0, 0xd3, 0xab, 0x02, 0x97, 0x8e, 0x5a, 0xd4, 0x51, 0x40, 0x1d, 0x85,
+  0x7d, 0x1c, 0x35, 0x8f, 0xdd, 0xd1, 0x00, 0x20, 0x66, 0x68, 0x8e, 0xe0,
+  0xaa, 0x1a, 0x5d, 0xa5, 0x49, 0x14, 0x12, 0xdf, 0x5a, 0xda, 0x82, 0x60,
+  0xbf, 0x9a, 0x6f, 0x09, 0xf5, 0xab, 0x3c, 0x0e, 0xb7, 0xc6, 0x64, 0x8b,
+  0x15, 0x8b, 0x1f, 0x80, 0xf2, 0xc2, 0x4e, 0x8a, 0xf0, 0x9a, 0x12, 0xdc,
+  0x55, 0xd9, 0x03, 0xc8, 0x02, 0xd7, 0x75, 0x5d, 0xdc, 0xa1, 0x5b, 0xbc,
+  0x88, 0x56, 0x99, 0xf2, 0x80, 0xd6, 0x37, 0x51, 0x8a, 0x95, 0xdb, 0x14,
+  0x2d, 0xc2, 0x08, 0x65, 0x0a, 0xd4, 0x9e, 0x5a, 0x28, 0x9c, 0x31, 0x48,
+  0x94, 0x65, 0x19, 0x02, 0x91, 0x8b, 0x3d, 0xf4, 0xf8, 0x83, 0xb0, 0x81,
+  0x49, 0x56, 0xd8, 0x35, 0x8e, 0xc9, 0xed, 0x97, 0xe5, 0x18, 0x14, 0xa9,
+  0xa6, 0x89, 0xb5, 0x5d, 0xfd, 0xee, 0x27, 0xeb, 0x86, 0x72, 0x05, 0x32,
+  0xf6, 0x88, 0x7d, 0x81, 0xd8, 0x30, 0x71, 0x50, 0x03, 0xc8, 0x34, 0x1a,
+  0xa6, 0x8a, 0x94, 0xbc, 0x61, 0xb2, 0x86, 0x91, 0xd1, 0x1b, 0x19, 0xfe,
+  0x10, 0x05, 0x69, 0x92, 0x25, 0x2f, 0xb9, 0x32, 0x21, 0x87, 0x39, 0x9d,
+  0x27, 0xc1, 0xe3, 0x8e, 0x9a, 0x42, 0x76, 0xef, 0x0e, 0xb2, 0x9a, 0x52,
+  0xe9, 0xc0, 0xa9, 0x0a, 0xaf, 0xd1, 0x27, 0x5a, 0xfb, 0x2d, 0xd1, 0x3a,
+  0x47, 0x13, 0xad, 0x3b, 0x2c, 0x5a, 0x04, 0xfc, 0xb6, 0xea, 0xd9, 0xe1,
+  0x1f, 0xfd, 0xc0, 0xdb, 0xe4, 0xff, 0xfe, 0xef, 0x0b, 0x1c, 0x51, 0x20,
+  0x43, 0xf4, 0x79, 0x71, 0x20, 0x3a, 0x7b, 0xc3, 0x91, 0x76, 0xc3, 0x6f,
+  0x65, 0x83, 0x7b, 0x24, 0x8b, 0x72, 0x93, 0x62, 0x9c, 0xe5, 0x9b, 0x18,
+  0x2b, 0x5f, 0xd2, 0xe4, 0xf0, 0x85, 0x42, 0x6b, 0x1d, 0x22, 0x6f, 0x2a,
+  0x14, 0x50, 0x97, 0xe9, 0x62, 0x82, 0xd3, 0x08, 0x67, 0xa3, 0x4a, 0x83,
+  0x5f, 0x99, 0xc0, 0x3f, 0x2a, 0x12, 0xe8, 0x8a, 0x35, 0xb5, 0x00, 0xa5,
+  0x5b, 0xe0, 0x94, 0x40, 0x40, 0xeb, 0x73, 0xda, 0x28, 0x5f, 0xe2, 0xd5,
+  0x54, 0x21, 0x4d, 0x1a, 0x31, 0xd0, 0xa6, 0x86, 0xaa, 0xba, 0x8a, 0xc1,
+  0x1d, 0x57, 0x31, 0x28, 0x26, 0x89, 0xd1, 0xca, 0x80, 0x41, 0x3e, 0x3b,
+  0x9d, 0x3e, 0x5f, 0xad, 0x50, 0xac, 0x4c, 0xc8, 0xba, 0xaf, 0xb8, 0xea,
+  0xf4, 0xb5, 0x72, 0x47, 0x8d, 0x91, 0x7b, 0x6a, 0x79, 0x07, 0xcd, 0xb6,
+  0x95, 0x6f, 0x0a, 0xfc, 0xc5, 0x77, 0x85, 0x45, 0x08, 0x77, 0x5e, 0xbe,
+  0xca, 0x08, 0xc9, 0x45, 0x61, 0x58, 0x2f, 0x38, 0xbe, 0x5a, 0x87, 0xcb,
+  0x73, 0x0c, 0x39, 0x3a, 0xf6, 0x7b, 0x6a, 0x82, 0xed, 0xf1, 0x7a, 0x60,
+  0xc7, 0xfd, 0xbb, 0x60, 0x78, 0xb1, 0x97, 0x92, 0x31, 0x77, 0x83, 0xe1,
+  0xfd, 0x7f, 0x07, 0x19, 0x63, 0x44, 0x32, 0x58, 0x46, 0xe6, 0x60, 0xd5,
+  0xfd, 0xc8, 0x9a, 0x47, 0x17, 0x1e, 0x15, 0x9d, 0xa3, 0x3a, 0xfb, 0x50,
+  0x27, 0x9b, 0xe7, 0x28, 0xc5, 0x31, 0xce, 0x32, 0xe5, 0x2b, 0x0e, 0x30,
+  0xb9, 0x87, 0xfc, 0xc7, 0x02, 0x0a, 0xa5, 0x90, 0x4e, 0xb7, 0x0f, 0xc6,
+  0x26, 0x3c, 0xb1, 0xe9, 0x62, 0x83, 0xc1, 0x89, 0x4d, 0x27, 0x1b, 0xfd,
+  0xc4, 0xa6, 0x93, 0x0d, 0x3a, 0x2a, 0x36, 0x07, 0xae, 0xc6, 0xbf, 0x01,
+  0xed, 0xda, 0x4d, 0x73, 0x9a, 0x40, 0x18, 0x00, 0xe0, 0x7b, 0x7f, 0x05,
+  0xf7, 0xd2, 0xce, 0x7e, 0x00, 0x02, 0xb7, 0xc4, 0x74, 0xd2, 0x64, 0xda,
+  0xc6, 0x89, 0x49, 0x9a, 0xeb, 0xae, 0x80, 0x32, 0x45, 0x70, 0x10, 0x9b,
+  0x78, 0xc9, 0x6f, 0xef, 0xee, 0xa2, 0x86, 0x45, 0xe4, 0x43, 0x48, 0x27,
+  0x51, 0xb9, 0xb0, 0x68, 0x58, 0xb3, 0x4f, 0xde, 0xf7, 0xdd, 0x75, 0x09,
+  0xc0, 0x40, 0x1c, 0xba, 0x0b, 0x34, 0x7e, 0xf6, 0x1c, 0x80, 0x40, 0xe6,
+  0x50, 0x1f, 0x69, 0xf4, 0xac, 0xdc, 0x84, 0xae, 0xd2, 0x8f, 0xc2, 0x24,
+  0x8e, 0x82, 0xc0, 0x8d, 0x55, 0x62, 0x53, 0xa0, 0x52, 0x9b, 0x42, 0x95,
+  0x92, 0xd1, 0x1f, 0x9b, 0x1a, 0xaa, 0x33, 0x73, 0xa2, 0xa7, 0xd0, 0x9e,
+  0x80, 0xaf, 0x1a, 0x6b, 0x07, 0xae, 0x97, 0xf0, 0xb6, 0xc9, 0xda, 0xb1,
+  0x3f, 0x9e, 0x88, 0x0b, 0xc4, 0x2e, 0x16, 0x33, 0xde, 0x82, 0x2a, 0xff,
+  0x81, 0xf9, 0x24, 0x5a, 0x04, 0x8e, 0x1b, 0xdb, 0x54, 0x4b, 0xaf, 0x13,
+  0x9f, 0xf7, 0x65, 0x8a, 0x8b, 0x84, 0xdd, 0x36, 0x66, 0xef, 0x11, 0x24,
+  0x2e, 0x9f, 0x6d, 0x02, 0x44, 0x63, 0x69, 0x13, 0xa8, 0x8a, 0x2e, 0x5f,
+  0x6f, 0xd7, 0x57, 0x2f, 0xa4, 0xf7, 0x5b, 0xe9, 0xd5, 0xa6, 0x83, 0xd5,
+  0xbb, 0xac, 0x07, 0x9c, 0xb6, 0x58, 0x17, 0x9a, 0x3a, 0x4f, 0x48, 0x9c,
+  0xd8, 0xb4, 0xa7, 0x3e, 0xdb, 0x14, 0xa9, 0x4b, 0x9b, 0x62, 0x75, 0x16,
+  0x90, 0xc4, 0x8b, 0xe2, 0xa9, 0xfd, 0xdb, 0x0f, 0xd9, 0x60, 0xe6, 0xea,
+  0x27, 0x90, 0xb7, 0xf1, 0xde, 0x95, 0xcd, 0xe7, 0xd6, 0x38, 0x5f, 0x58,
+  0x0f, 0xed, 0x75, 0x3c, 0x28, 0x74, 0x46, 0x3a, 0x80, 0x92, 0xce, 0x5d,
+  0xbc, 0x98, 0x27, 0xca, 0x25, 0x99, 0xba, 0x33, 0xe2, 0x70, 0x17, 0x94,
+  0x75, 0x31, 0x9b, 0xba, 0x8c, 0x17, 0xbe, 0xe3, 0xb2, 0xfb, 0x51, 0x99,
+  0x10, 0x04, 0x12, 0x11, 0xd3, 0x6f, 0x28, 0x04, 0xa1, 0x4c, 0xc4, 0x10,
+  0xd6, 0x42, 0x68, 0x23, 0x84, 0xd7, 0x42, 0x16, 0x17, 0xc2, 0x5c, 0x08,
+  0x94, 0x08, 0x19, 0x08, 0x18, 0xfc, 0xec, 0xe8, 0x3d, 0x20, 0x09, 0x0d,
+  0xa2, 0x27, 0x37, 0x3e, 0x53, 0x06, 0x43, 0x9c, 0x8b, 0xa0, 0x03, 0x95,
+  0x02, 0x55, 0xb1, 0x64, 0x60, 0xa4, 0xf3, 0x33, 0xc2, 0x40, 0x97, 0xa4,
+  0xee, 0x87, 0xe7, 0xca, 0x83, 0x4f, 0x63, 0x92, 0xf8, 0x51, 0xa8, 0x5c,
+  0x47, 0x4b, 0xf1, 0x4b, 0xb4, 0xa7, 0xfa, 0x70, 0xa1, 0xf4, 0x0a, 0x64,
+  0xc8, 0xa1, 0x14, 0x90, 0xe5, 0x30, 0x49, 0x79, 0x4a, 0xaa, 0x11, 0x1b,
+  0x54, 0x2b, 0x21, 0x43, 0x12, 0xc2, 0xb2, 0x90, 0x59, 0x2d, 0xd4, 0x93,
+  0x85, 0xb4, 0x9c, 0x90, 0x55, 0x26, 0xc4, 0x3c, 0xd7, 0x44, 0x5a, 0x1d,
+  0x22, 0x23, 0x17, 0x43, 0xdf, 0xaf, 0x2f, 0x94, 0xc7, 0x0e, 0x44, 0x76,
+  0xa5, 0xd7, 0x7f, 0xb3, 0x29, 0x28, 0xd5, 0x0d, 0x6d, 0x7a, 0x7a, 0xce,
+  0xe6, 0x68, 0x4a, 0x50, 0x75, 0x86, 0xb1, 0x43, 0x34, 0xa0, 0x69, 0x6e,
+  0x95, 0xa0, 0x12, 0x22, 0xab, 0xcb, 0xc4, 0xca, 0xc1, 0x68, 0x8d, 0x83,
+  0x27, 0x0f, 0xa3, 0x97, 0xc1, 0x98, 0xcd, 0x60, 0x50, 0x0e, 0xe6, 0xce,
+  0x67, 0x1f, 0xc1, 0xa7, 0x79, 0x25, 0x5b, 0x84, 0xce, 0x1c, 0x32, 0x4b,
+  0xca, 0x9c, 0x78, 0x84, 0xaf, 0x98, 0x28, 0xd4, 0x37, 0x4a, 0x3c, 0x73,
+  0x04, 0x52, 0x55, 0x82, 0xbd, 0x6b, 0x23, 0xed, 0x64, 0x54, 0x65, 0x64,
+  0xf4, 0x4a, 0xa6, 0xb0, 0x5d, 0x32, 0x66, 0x47, 0x32, 0x56, 0x5b, 0x18,
+  0xd0, 0x04, 0x26, 0x53, 0x9d, 0xcb, 0x65, 0xbc, 0x74, 0x81, 0x28, 0xad,
+  0xa3, 0x99, 0x8c, 0x08, 0x9c, 0x87, 0xab, 0xf3, 0xed, 0x85, 0x0f, 0xee,
+  0x68, 0x5e, 0x2f, 0xf9, 0x9a, 0xd1, 0xbc, 0x2c, 0x5b, 0x3b, 0xab, 0xf2,
+  0xeb, 0xcc, 0x85, 0x64, 0x1b, 0xb1, 0x32, 0x84, 0x65, 0x36, 0x96, 0xa1,
+  0x65, 0xcf, 0x1b, 0x1b, 0xff, 0x22, 0x8e, 0x7c, 0xa7, 0xbf, 0xb5, 0xec,
+  0x81, 0x9c, 0x07, 0x1d, 0xc8, 0xba, 0xb0, 0x7a, 0xe1, 0x4c, 0xe1, 0x8a,
+  0x45, 0x97, 0x27, 0xf6, 0x73, 0x7f, 0x4c, 0xdd, 0xb0, 0xe0, 0x2b, 0x06,
+  0x38, 0xcc, 0xf9, 0x1d, 0xd5, 0x96, 0x82, 0xeb, 0x57, 0x8e, 0x54, 0x4a,
+  0x94, 0x23, 0x54, 0x4f, 0x6a, 0x24, 0x49, 0xfd, 0x22, 0x23, 0x96, 0x6e,
+  0x97, 0x7d, 0x85, 0xbd, 0xfd, 0x6d, 0x78, 0x0a, 0x26, 0x41, 0xe4, 0x48,
+  0x44, 0xb7, 0xee, 0xdf, 0x28, 0x58, 0x88, 0xa9, 0x6c, 0x10, 0x47, 0x9d,
+  0x96, 0xa6, 0x7d, 0xb4, 0x08, 0x6e, 0xab, 0x45, 0xb4, 0x02, 0x2d, 0x7d,
+  0xcf, 0x22, 0x05, 0x89, 0xbc, 0x53, 0x74, 0x13, 0x93, 0x70, 0xec, 0xbe,
+  0x49, 0xda, 0x81, 0x32, 0x25, 0xa3, 0x25, 0x52, 0x6f, 0xa7, 0x91, 0xbe,
+  0x3d, 0xd1, 0x35, 0x8c, 0x28, 0x94, 0x2b, 0x4f, 0xdb, 0x5f, 0x3f, 0x8e,
+  0x3e, 0xe9, 0x10, 0xb0, 0x0a, 0x2a, 0xf8, 0x11, 0x4f, 0xfe, 0xa8, 0x6e,
+  0x15, 0x52, 0xd0, 0xa9, 0x0e, 0xb1, 0x03, 0xe7, 0x72, 0x6c, 0x30, 0x44,
+  0xa7, 0x1c, 0x93, 0x89, 0xcc, 0x5c, 0x48, 0xa5, 0x73, 0x7f, 0x26, 0xb0,
+  0xee, 0xc3, 0xc0, 0x9f, 0xfa, 0x89, 0xeb, 0x74, 0x3e, 0xd1, 0x7d, 0xd4,
+  0x34, 0x64, 0x73, 0x5b, 0x85, 0xd9, 0x55, 0xe8, 0xf9, 0xa1, 0x9f, 0x2c,
+  0xd9, 0x62, 0x53, 0x3b, 0x91, 0x71, 0x32, 0x98, 0xdb, 0x0b, 0xd8, 0x22,
+  0xc3, 0x87, 0x67, 0xb5, 0x67, 0xd5, 0x82, 0xb8, 0x76, 0x95, 0xc7, 0x47,
+  0x5d, 0xe5, 0x9d, 0xf4, 0xa9, 0x2d, 0xb0, 0x46, 0xf2, 0x53, 0xdb, 0x1f,
+  0xd1, 0x98, 0xd5, 0xab, 0xd1, 0x44, 0x61, 0xb7, 0x8c, 0x7f, 0x92, 0xf0,
+  0x8d, 0x1e, 0x92, 0x64, 0xfe, 0xf6, 0x75, 0x35, 0x36, 0xb7, 0xa0, 0xed,
+  0x2d, 0x35, 0xad, 0xce, 0x50, 0x49, 0xc5, 0x50, 0x95, 0xdb, 0xc5, 0x94,
+  0x06, 0xee, 0x20, 0x7d, 0x1e, 0x0b, 0x3a, 0x7c, 0x74, 0xd6, 0xc5, 0x98,
+  0x8b, 0x9e, 0x6f, 0x34, 0x1a, 0x3e, 0xad, 0x1a, 0xfe, 0xd9, 0x28, 0x4d,
+  0x93, 0x82, 0xf1, 0xa3, 0x0e, 0xf7, 0xef, 0x73, 0xff, 0xc3, 0xa0, 0xbf,
+  0x34, 0xdd, 0x5e, 0xcc, 0xd9, 0x10, 0xf4, 0xb2, 0x5f, 0x40, 0x40, 0xb8,
+  0x4b, 0xa4, 0x1f, 0xc5, 0x4e, 0xe0, 0xce, 0xe7, 0x82, 0x66, 0x5a, 0x90,
+  0x04, 0x2d, 0xe3, 0xc1, 0xca, 0x7a, 0xe8, 0x8d, 0xcb, 0xe9, 0x7a, 0x7f,
+  0x75, 0xd5, 0x01, 0xaa, 0xb1, 0xa3, 0x28, 0x62, 0xa5, 0x16, 0x8a, 0xb1,
+  0x0b, 0xe5, 0x62, 0x41, 0x82, 0x55, 0x8c, 0x1c, 0xcf, 0x5c, 0xfc, 0x0f,
+  0xed, 0x98, 0xcb, 0x92, 0xa2, 0x30, 0x14, 0x86, 0xf7, 0xf3, 0x14, 0xec,
+  0x3b, 0x3d, 0x95, 0x1b, 0xd7, 0x5d, 0xd7, 0xf4, 0xf4, 0x6c, 0xc6, 0x1a,
+  0xab, 0xec, 0x8b, 0xdb, 0x00, 0x51, 0xa9, 0x41, 0xb1, 0x00, 0xab, 0xf5,
+  0xed, 0x27, 0xe1, 0x22, 0x82, 0x82, 0xf7, 0xae, 0x51, 0x60, 0x63, 0x02,
+  0x72, 0xe0, 0xff, 0x72, 0xce, 0x9f, 0x04, 0x48, 0x60, 0x72, 0x68, 0x2e,
+  0xa4, 0xf2, 0x17, 0x19, 0x0e, 0x86, 0x1b, 0x07, 0xf8, 0x1d, 0x8c, 0xbd,
+  0x98, 0x3b, 0x13, 0xe5, 0x45, 0x45, 0x10, 0x30, 0xcb, 0x46, 0xc0, 0xb6,
+  0x6c, 0x0c, 0x6c, 0xe6, 0xfc, 0xb5, 0x6c, 0x03, 0xb8, 0x73, 0x37, 0xf8,
+  0x9c, 0x59, 0x13, 0xf8, 0x9d, 0x8a, 0xb6, 0xcf, 0x47, 0xb1, 0x6c, 0xcb,
+  0xf3, 0xa1, 0x37, 0x9e, 0x24, 0x1d, 0x2c, 0x3a, 0x8b, 0xb9, 0x6c, 0x21,
+  0x20, 0xff, 0x10, 0x4d, 0x82, 0x85, 0xef, 0xf2, 0xd0, 0xb2, 0x69, 0xda,
+  0x8f, 0x3d, 0x19, 0x4b, 0x84, 0x97, 0xbd, 0x58, 0xdc, 0x37, 0x96, 0x17,
+  0xb5, 0xa4, 0xbb, 0xb4, 0x58, 0x7a, 0x7e, 0x65, 0x31, 0x04, 0x92, 0x98,
+  0xc5, 0xfd, 0x6a, 0x76, 0x22, 0x0b, 0x90, 0x5d, 0x5f, 0x47, 0xd0, 0xd3,
+  0xbe, 0x08, 0x81, 0xd3, 0x96, 0x88, 0x41, 0x40, 0x14, 0xb3, 0x30, 0xb6,
+  0x6c, 0x13, 0x2c, 0x2d, 0x1b, 0x82, 0x95, 0x65, 0x13, 0x30, 0xf7, 0x59,
+  0x3c, 0x0a, 0xc2, 0xa9, 0xf5, 0xe1, 0xcd, 0x84, 0x9c, 0x08, 0x7c, 0x83,
+  0x55, 0x2e, 0x66, 0x2d, 0x17, 0xbd, 0xd5, 0x5c, 0x58, 0x1d, 0x97, 0x7e,
+  0xc8, 0x1d, 0x2f, 0xf2, 0x82, 0x59, 0x3d, 0x9c, 0x07, 0xf1, 0xe6, 0x19,
+  0x9b, 0x47, 0xa1, 0x26, 0x47, 0xf3, 0x90, 0xb4, 0x05, 0x99, 0x47, 0xb6,
+  0x1b, 0xcc, 0x06, 0x8a, 0xdd, 0xc2, 0x37, 0x94, 0x9e, 0xa6, 0xca, 0xad,
+  0x1d, 0x6d, 0x92, 0x8e, 0x36, 0x94, 0x82, 0x50, 0x26, 0x48, 0xbb, 0xe0,
+  0x68, 0x1b, 0xc7, 0x8e, 0xae, 0xb9, 0x1e, 0x4c, 0xb2, 0x1e, 0x4c, 0x9a,
+  0xcb, 0xd6, 0xa5, 0x6c, 0x7c, 0xb0, 0x6c, 0xbe, 0xaf, 0xf8, 0xef, 0x53,
+  0xf6, 0x68, 0x5f, 0x6d, 0xdf, 0xa5, 0x6c, 0x8a, 0x2b, 0xb2, 0x7f, 0x4c,
+  0x3c, 0xdf, 0x1f, 0xc4, 0x21, 0x67, 0xd3, 0xbb, 0x15, 0x6d, 0x50, 0x87,
+  0x95, 0x44, 0x97, 0x6c, 0xaa, 0x24, 0x59, 0x3f, 0x4f, 0xb2, 0xba, 0x2d,
+  0x79, 0x6d, 0x4b, 0x99, 0xa5, 0x37, 0x22, 0xa0, 0xbb, 0x10, 0x14, 0x11,
+  0x50, 0x13, 0x13, 0xed, 0x38, 0x26, 0x46, 0x85, 0xc9, 0xeb, 0x64, 0x31,
+  0x13, 0xef, 0x30, 0x67, 0x6e, 0x7b, 0xa1, 0xb8, 0xa8, 0x02, 0x65, 0x6d,
+  0x0a, 0x95, 0x32, 0x69, 0xe7, 0xbc, 0xef, 0xe2, 0x5a, 0x3c, 0x41, 0xe8,
+  0xfa, 0x3c, 0x8a, 0x0e, 0x59, 0x00, 0x1c, 0x4a, 0x69, 0xbc, 0xf0, 0x5c,
+  0x2e, 0x82, 0xe0, 0xdb, 0xe3, 0xc5, 0xa1, 0x9a, 0x34, 0x48, 0xc9, 0x6b,
+  0x21, 0xf8, 0xe9, 0x73, 0x27, 0x98, 0x2a, 0x6f, 0x44, 0x43, 0xa4, 0x27,
+  0x09, 0x61, 0x49, 0x88, 0x64, 0x84, 0x10, 0xbc, 0x0a, 0x22, 0xe3, 0x4c,
+  0x42, 0xe6, 0x31, 0x80, 0x04, 0xce, 0x9c, 0x10, 0x3a, 0x84, 0x90, 0xba,
+  0x9b, 0x50, 0x9f, 0x40, 0xf4, 0xa6, 0xf4, 0x7d, 0xb6, 0x1a, 0xc4, 0x2c,
+  0x16, 0xe9, 0x24, 0x32, 0x6c, 0x16, 0x87, 0x81, 0xef, 0xf3, 0x50, 0x79,
+  0x72, 0xd9, 0x3c, 0xe6, 0xe1, 0x05, 0xf8, 0xdd, 0x2a, 0x35, 0x7d, 0x37,
+  0xb5, 0x0f, 0x01, 0x6d, 0x8b, 0xca, 0x45, 0xdc, 0xe9, 0x04, 0x0e, 0xc7,
+  0x16, 0xd4, 0x41, 0xc2, 0xd9, 0x6e, 0xe1, 0xcf, 0x6f, 0x43, 0x0d, 0x2a,
+  0xbd, 0xde, 0x9f, 0xed, 0x9c, 0x38, 0x73, 0xee, 0x32, 0x4a, 0x66, 0x53,
+  0x81, 0x91, 0xd5, 0x5d, 0x23, 0x8d, 0xdc, 0x5f, 0xf2, 0x10, 0x55, 0x3a,
+  0x88, 0x34, 0x4d, 0x5f, 0x18, 0x1e, 0xc7, 0x87, 0xd7, 0x19, 0x8e, 0x89,
+  0xf0, 0x6b, 0x8b, 0x0b, 0x66, 0x54, 0xc3, 0x85, 0x42, 0x44, 0x06, 0xed,
+  0xe5, 0x82, 0x60, 0x1d, 0x17, 0x74, 0xc3, 0x5c, 0x8a, 0x3a, 0xc2, 0xa7,
+  0x72, 0x21, 0x0d, 0x5c, 0x5a, 0xbd, 0xb2, 0x19, 0x41, 0x0e, 0xd3, 0xcc,
+  0x21, 0x5b, 0x2b, 0x41, 0x87, 0x7c, 0xc1, 0x0e, 0x32, 0x57, 0xc3, 0xf0,
+  0x99, 0x09, 0xc3, 0xd4, 0x0b, 0x6c, 0x30, 0x0b, 0x1c, 0xb4, 0xc3, 0x51,
+  0xe0, 0xc0, 0x5a, 0x39, 0x3b, 0x9e, 0x46, 0x62, 0xbd, 0x36, 0xf6, 0x83,
+  0x4f, 0xa5, 0x3f, 0x20, 0x1b, 0x4b, 0xb9, 0xae, 0x94, 0xe4, 0x26, 0x01,
+  0x96, 0xbd, 0x66, 0xf8, 0x8b, 0xb3, 0x62, 0x71, 0x8b, 0x2e, 0xb3, 0x8c,
+  0xd3, 0x9a, 0x78, 0xd0, 0xfd, 0x3c, 0xf4, 0x66, 0x1e, 0x45, 0xf2, 0xa8,
+  0xdb, 0xe6, 0x9b, 0xf0, 0x20, 0x92, 0x07, 0x3c, 0x8c, 0x47, 0xf9, 0x0b,
+  0xd5, 0xbb, 0xe7, 0x88, 0xe7, 0x2c, 0x45, 0xea, 0x50, 0xb1, 0xbd, 0x0c,
+  0x94, 0x97, 0xf5, 0x8b, 0x5c, 0x3b, 0x7d, 0xae, 0xf7, 0xc9, 0x39, 0xd7,
+  0xaa, 0xff, 0x37, 0x5a, 0x6b, 0x4b, 0xe5, 0x4a, 0xca, 0x4d, 0xe1, 0x99,
+  0xa5, 0x4f, 0x72, 0xcf, 0xfd, 0xc4, 0x1c, 0xde, 0x79, 0x18, 0x2d, 0xa2,
+  0x54, 0xb8, 0x37, 0x1b, 0xdf, 0xfc, 0x10, 0x23, 0x54, 0x11, 0xda, 0x79,
+  0x61, 0x03, 0x2c, 0x52, 0x0b, 0x6b, 0x68, 0x07, 0xcb, 0x0a, 0xad, 0x36,
+  0x4e, 0xad, 0xa8, 0xea, 0x8e, 0x1d, 0xa1, 0x6d, 0x42, 0xb4, 0x23, 0xd4,
+  0x48, 0x88, 0x76, 0x96, 0x04, 0x8f, 0x80, 0x85, 0x3b, 0x58, 0x35, 0xb0,
+  0xfe, 0x01,
+  0xed, 0xd9, 0xdf, 0x73, 0x9a, 0x30, 0x1c, 0x00, 0xf0, 0xf7, 0xfd, 0x15,
+  0x79, 0x2f, 0xdd, 0x25, 0x10, 0x04, 0x79, 0xab, 0xed, 0xdc, 0xed, 0xb6,
+  0x6e, 0x5e, 0xbd, 0x5e, 0xf7, 0x1a, 0x24, 0x28, 0x2b, 0x12, 0x0e, 0xc3,
+  0xd4, 0xfd, 0xf5, 0x4b, 0x10, 0xac, 0x44, 0xa4, 0x60, 0xdd, 0x3a, 0x3b,
+  0x7c, 0x69, 0xc2, 0x8f, 0x34, 0xf9, 0xdc, 0x37, 0xc9, 0x37, 0x0a, 0x0d,
+  0x98, 0x7d, 0x7a, 0x3e, 0xa4, 0xf2, 0x2f, 0xc2, 0x28, 0xbf, 0xb2, 0xf9,
+  0x68, 0x57, 0x3e, 0xa7, 0xc9, 0x34, 0x64, 0x4b, 0xf0, 0xdd, 0x65, 0x2b,
+  0x70, 0xcd, 0x22, 0x9e, 0xb0, 0x30, 0xa4, 0x89, 0x46, 0x1c, 0x17, 0x69,
+  0xae, 0xe3, 0xea, 0x9a, 0x4b, 0x26, 0x8f, 0x8e, 0x6b, 0x6b, 0x5e, 0xec,
+  0xb1, 0x65, 0xe4, 0xcc, 0xe0, 0x7b, 0x2c, 0xca, 0x21, 0xf5, 0xb9, 0x2c,
+  0xcb, 0xeb, 0x49, 0x30, 0x9d, 0x65, 0x15, 0x5d, 0x54, 0xd2, 0x58, 0x96,
+  0x90, 0x36, 0x4d, 0x03, 0x8f, 0x8a, 0x46, 0x74, 0x4d, 0x3e, 0xba, 0x98,
+  0xb1, 0x34, 0xf4, 0x68, 0xe2, 0xb8, 0x78, 0x53, 0xe7, 0x81, 0x6c, 0x15,
+  0xc1, 0xac, 0xc6, 0x45, 0x0b, 0x53, 0x79, 0xb3, 0x97, 0x55, 0x57, 0x0e,
+  0xd9, 0x5c, 0x5f, 0x3b, 0x04, 0x69, 0x59, 0xeb, 0x4f, 0xef, 0x9b, 0xf9,
+  0x85, 0xbc, 0x81, 0xfc, 0xfe, 0xb6, 0x05, 0x6b, 0x53, 0x17, 0x4d, 0xe8,
+  0x9b, 0x92, 0x68, 0xc3, 0xd0, 0x16, 0x9c, 0x24, 0xdc, 0x71, 0xfb, 0xda,
+  0xca, 0x71, 0xa1, 0xb6, 0x76, 0x5c, 0x43, 0x8b, 0x43, 0xc2, 0x7d, 0x96,
+  0xcc, 0x9d, 0x87, 0x20, 0x12, 0x03, 0x5b, 0x68, 0xef, 0xa0, 0xaa, 0xd5,
+  0x87, 0xe8, 0x80, 0xd6, 0x68, 0x6c, 0x74, 0x58, 0x65, 0x2c, 0xd2, 0x61,
+  0x35, 0xc7, 0xa2, 0x0a, 0xd6, 0x1d, 0x9b, 0x3c, 0x82, 0x6b, 0x12, 0x79,
+  0xeb, 0x4e, 0x6b, 0x5f, 0xcb, 0x3f, 0xa8, 0x25, 0x79, 0xa0, 0xe4, 0x41,
+  0x39, 0x4f, 0xaf, 0x2d, 0x4f, 0x0d, 0x8a, 0x5d, 0x32, 0x21, 0x7a, 0x5b,
+  0x93, 0x7e, 0x99, 0xa4, 0x80, 0x58, 0x49, 0x88, 0x82, 0x04, 0x17, 0x24,
+  0x96, 0x24, 0xd1, 0x9b, 0x92, 0xe8, 0x58, 0x21, 0xf9, 0x14, 0xfd, 0x48,
+  0xe5, 0xbf, 0xa5, 0x60, 0xb8, 0xed, 0xc1, 0x5f, 0x0e, 0xa5, 0x9d, 0xe0,
+  0xa9, 0x66, 0xd9, 0x89, 0x8d, 0xa3, 0xe2, 0x40, 0xb7, 0xbb, 0x59, 0xd3,
+  0x42, 0xcb, 0xef, 0xb4, 0x9a, 0x6b, 0x89, 0x6a, 0x59, 0xeb, 0xc3, 0x15,
+  0x18, 0xc7, 0x2c, 0xe1, 0x8b, 0x0e, 0x6b, 0x1f, 0x4b, 0x57, 0xb0, 0x06,
+  0x84, 0x73, 0xd1, 0xad, 0x80, 0x86, 0x1e, 0xc0, 0x1d, 0xd8, 0x3e, 0xd8,
+  0xe1, 0x4c, 0xb2, 0x22, 0xef, 0x3e, 0x9b, 0x0d, 0xcd, 0x3c, 0xdd, 0x86,
+  0x86, 0x7b, 0x6f, 0x63, 0x8f, 0x3f, 0x21, 0x49, 0x4f, 0xdd, 0xe3, 0x07,
+  0x43, 0xf0, 0x2d, 0xa2, 0xe7, 0xc0, 0x51, 0x9a, 0x33, 0xe6, 0x71, 0xc3,
+  0xb7, 0xd5, 0x15, 0x79, 0x48, 0x26, 0x94, 0xf9, 0x3e, 0x18, 0x25, 0x0c,
+  0x7c, 0x0d, 0x22, 0x4e, 0xc5, 0x8b, 0x60, 0xbc, 0x0c, 0xf8, 0x64, 0xf6,
+  0x6f, 0x2e, 0x37, 0xf3, 0x60, 0x31, 0x41, 0xe2, 0x51, 0xe3, 0xf5, 0x16,
+  0x1e, 0x1b, 0x1d, 0x40, 0xbc, 0xa1, 0x61, 0xba, 0xa2, 0x9d, 0x65, 0x1b,
+  0x4b, 0x5c, 0x6f, 0xd9, 0x39, 0x36, 0x74, 0x34, 0x15, 0xc7, 0xd1, 0xcd,
+  0x68, 0x73, 0x6a, 0x89, 0x89, 0x97, 0x45, 0xe4, 0x47, 0x32, 0xa7, 0xd7,
+  0xa9, 0x4b, 0xab, 0x08, 0xe1, 0x1b, 0x26, 0x6c, 0xbe, 0x36, 0x5a, 0x87,
+  0x73, 0xfb, 0x2e, 0x0c, 0x1b, 0x1a, 0xda, 0x07, 0x73, 0xb2, 0x6e, 0x42,
+  0xb7, 0x92, 0x24, 0x36, 0xd4, 0x4b, 0x92, 0x59, 0x4e, 0x2b, 0x52, 0x95,
+  0x2e, 0xaf, 0x85, 0x93, 0xd7, 0xb6, 0xe9, 0xbf, 0xd0, 0x46, 0xc4, 0xe0,
+  0xc9, 0x71, 0xac, 0x3c, 0x2b, 0x41, 0x7d, 0x88, 0xcb, 0x53, 0x70, 0x4e,
+  0x7e, 0xb1, 0x08, 0x7c, 0x49, 0x23, 0x52, 0xb7, 0xf6, 0x8b, 0x3e, 0x1d,
+  0x39, 0xdd, 0x54, 0x2a, 0x73, 0x3f, 0x8c, 0x2a, 0xa7, 0x57, 0x5f, 0x45,
+  0xc2, 0x25, 0x24, 0xab, 0xce, 0xa4, 0x27, 0x4d, 0x0c, 0x69, 0xa2, 0xd7,
+  0x99, 0x18, 0xd0, 0xca, 0x0a, 0x6a, 0x96, 0x31, 0x26, 0xd1, 0x92, 0x80,
+  0x51, 0x48, 0xd6, 0xdf, 0xa2, 0x30, 0x10, 0x81, 0x73, 0xcb, 0xdc, 0x20,
+  0xdc, 0x3f, 0x06, 0xe8, 0x85, 0xc9, 0x85, 0xe8, 0x76, 0x4e, 0x72, 0x49,
+  0xe0, 0x56, 0xe4, 0x22, 0x2b, 0x0b, 0x90, 0x4b, 0x71, 0x3f, 0xef, 0x9a,
+  0xd1, 0xa4, 0x43, 0xea, 0xc9, 0x6c, 0x4c, 0xa7, 0x04, 0x8c, 0x09, 0x4f,
+  0x93, 0xa8, 0x3a, 0x88, 0x5f, 0x14, 0xbc, 0xbd, 0xf2, 0x92, 0x67, 0x35,
+  0x8e, 0xd7, 0xed, 0x2b, 0x7a, 0x69, 0x15, 0xcb, 0xe0, 0x71, 0xdd, 0x38,
+  0x6d, 0x7d, 0x53, 0x22, 0xa5, 0x61, 0x42, 0x4d, 0x72, 0xff, 0xdc, 0xcb,
+  0x41, 0xcc, 0x6c, 0x8c, 0x38, 0x47, 0xb7, 0x8e, 0x0c, 0x44, 0x53, 0x19,
+  0x75, 0x11, 0x98, 0xc7, 0xce, 0xd9, 0x62, 0x96, 0x6e, 0x23, 0xb9, 0xc5,
+  0x9c, 0xcd, 0xe2, 0x13, 0x65, 0x4e, 0xa8, 0x36, 0x42, 0xfb, 0x05, 0x0d,
+  0xb2, 0x4b, 0x50, 0xb7, 0x64, 0xed, 0x87, 0x64, 0x31, 0x03, 0x0f, 0x41,
+  0x00, 0xee, 0xb3, 0x0c, 0xee, 0xca, 0x23, 0x31, 0x3f, 0xc5, 0x3e, 0x79,
+  0x6e, 0xdf, 0xf8, 0x6c, 0x91, 0x4a, 0xab, 0xbe, 0x40, 0xfa, 0x1c, 0x44,
+  0xd3, 0x8a, 0x6f, 0xc6, 0xf4, 0xdd, 0x29, 0x7c, 0x7e, 0x3a, 0x78, 0x7f,
+  0xae, 0xc1, 0x26, 0x3a, 0x46, 0x5d, 0x08, 0xdd, 0xb0, 0x30, 0x9e, 0x05,
+  0xd1, 0x80, 0x3c, 0x09, 0x19, 0x2f, 0xcd, 0xb3, 0xd0, 0x73, 0x3f, 0x59,
+  0xb4, 0x5e, 0x66, 0x1a, 0x06, 0x0b, 0x6a, 0xc2, 0x81, 0x15, 0x8e, 0x71,
+  0x1a, 0xd3, 0x04, 0x0c, 0xc9, 0x3c, 0x98, 0xb0, 0xf9, 0x1f, 0xcc, 0x14,
+  0x8c, 0x8a, 0xac, 0xb1, 0xdd, 0x4e, 0x5e, 0x8c, 0xc0, 0x52, 0xc2, 0x7d,
+  0x40, 0x39, 0x8b, 0xb3, 0x83, 0x9c, 0x38, 0xd4, 0xfd, 0xc7, 0x81, 0x4e,
+  0x14, 0x97, 0xfb, 0xf1, 0xa0, 0x5b, 0x01, 0xe4, 0x16, 0x82, 0x14, 0x98,
+  0x3b, 0x2a, 0x4c, 0x1a, 0x1d, 0xb1, 0x2e, 0x08, 0x7e, 0xca, 0x6f, 0x8c,
+  0x9d, 0xfc, 0xc6, 0x28, 0xf2, 0x1b, 0xfc, 0x5c, 0x4e, 0x51, 0x9d, 0xcc,
+  0x6d, 0x1f, 0x30, 0x9b, 0xad, 0xf9, 0xbf, 0x01,
+  0xdd, 0x99, 0x5d, 0x73, 0xda, 0x38, 0x14, 0x86, 0xef, 0xf7, 0x57, 0xe8,
+  0x72, 0x3b, 0x98, 0x1d, 0x49, 0xfe, 0xf6, 0x1d, 0x0d, 0x69, 0xfa, 0xc9,
+  0x66, 0x96, 0xb4, 0x9b, 0xe9, 0x9d, 0x8c, 0x05, 0x68, 0x62, 0x6c, 0xc6,
+  0x98, 0x26, 0xfe, 0xf7, 0x2b, 0x7f, 0x01, 0x16, 0x36, 0xc8, 0xc6, 0x6c,
+  0xd3, 0x72, 0x13, 0x49, 0x31, 0xc2, 0xcf, 0x7b, 0x8e, 0x8f, 0x5f, 0x49,
+  0x50, 0x85, 0xd9, 0xc7, 0xb4, 0xf3, 0xbf, 0x88, 0x20, 0x0b, 0x1e, 0x7c,
+  0x94, 0x6f, 0x34, 0x08, 0x57, 0x0a, 0x71, 0x5c, 0xa4, 0xb8, 0x8e, 0x8b,
+  0x15, 0x97, 0xcc, 0x9e, 0x1c, 0xd7, 0x52, 0xbc, 0xb5, 0x17, 0x3e, 0x07,
+  0xce, 0x12, 0xfe, 0xa5, 0xf1, 0xb6, 0x4f, 0xe7, 0x71, 0xda, 0x4e, 0xc7,
+  0x23, 0xb6, 0x58, 0x66, 0x1d, 0xcc, 0x3b, 0xdb, 0x75, 0xda, 0x42, 0xca,
+  0x62, 0xcb, 0x3c, 0xca, 0x27, 0xc1, 0x4a, 0x7a, 0xe9, 0x66, 0x19, 0x6e,
+  0x7d, 0x8f, 0x46, 0x8e, 0xab, 0xe5, 0xfd, 0x98, 0xa5, 0xb3, 0x22, 0x98,
+  0xf5, 0x62, 0x3e, 0xc3, 0x22, 0xfd, 0xa7, 0x91, 0x75, 0x5f, 0x1c, 0x92,
+  0x8f, 0x27, 0x0e, 0x41, 0x4a, 0x36, 0xfb, 0xfe, 0xfb, 0x7a, 0x31, 0x50,
+  0x4c, 0x50, 0xfc, 0x7f, 0x37, 0x83, 0x99, 0xf7, 0xf9, 0x14, 0x38, 0x6f,
+  0xf1, 0x39, 0x54, 0x65, 0x13, 0x93, 0x28, 0x76, 0x5c, 0x5b, 0x79, 0x71,
+  0x5c, 0xa8, 0x24, 0x8e, 0xab, 0x2a, 0x6b, 0x9f, 0xc4, 0xf3, 0x30, 0x5a,
+  0x39, 0xff, 0xb2, 0x80, 0x83, 0x6d, 0x94, 0x3f, 0xa0, 0xa8, 0x8c, 0x5b,
+  0xa7, 0x0c, 0x18, 0x45, 0x33, 0xe2, 0x51, 0xf0, 0x31, 0x4c, 0xb2, 0x7b,
+  0xb8, 0xb6, 0x52, 0x07, 0xda, 0xd4, 0x2b, 0x71, 0x80, 0xde, 0x0d, 0x73,
+  0x26, 0x60, 0x4e, 0x1f, 0x3e, 0x01, 0x13, 0x62, 0xed, 0x31, 0x45, 0x83,
+  0x29, 0x1a, 0x2a, 0xd0, 0x78, 0xb8, 0x5a, 0xb2, 0x55, 0x89, 0x8c, 0x4a,
+  0xec, 0xd5, 0x2a, 0x9f, 0x75, 0x3e, 0xf6, 0x66, 0x35, 0xf6, 0x9a, 0x20,
+  0x80, 0xbd, 0x8b, 0xbd, 0xba, 0x8b, 0xbd, 0x56, 0x8a, 0xc2, 0x33, 0xe5,
+  0x25, 0x15, 0x24, 0x49, 0x85, 0x3d, 0xaf, 0x0a, 0xc6, 0x10, 0x55, 0x54,
+  0xb9, 0xbf, 0x01, 0x37, 0x61, 0x10, 0x47, 0xa1, 0xef, 0xd3, 0x28, 0x55,
+  0x06, 0x1f, 0x2a, 0x63, 0x5d, 0x26, 0xcc, 0x4f, 0x7f, 0x28, 0x32, 0x5d,
+  0xa0, 0x8c, 0x2e, 0x9a, 0x90, 0x2d, 0x5f, 0xe8, 0x82, 0x80, 0x71, 0xc4,
+  0x7e, 0x50, 0x41, 0x9f, 0x22, 0x73, 0x2e, 0x4c, 0x18, 0x01, 0x14, 0x1f,
+  0xdf, 0xb5, 0x54, 0x34, 0x0d, 0x21, 0x9a, 0x0f, 0x77, 0xdf, 0x7f, 0x83,
+  0x18, 0xea, 0xdd, 0x62, 0xa8, 0x42, 0x31, 0x86, 0x24, 0x99, 0xfb, 0x64,
+  0xb3, 0x04, 0xef, 0xf8, 0x95, 0xfd, 0x17, 0xb8, 0x33, 0x65, 0x4d, 0x56,
+  0x99, 0x4b, 0x0b, 0x9d, 0xa6, 0x36, 0x61, 0xdf, 0x91, 0x15, 0xbd, 0xd9,
+  0xba, 0x87, 0x19, 0x0c, 0x46, 0x1e, 0x59, 0xc7, 0x79, 0x26, 0x17, 0xf4,
+  0x3d, 0x52, 0x13, 0x55, 0xba, 0xd8, 0xed, 0xbe, 0xa2, 0xed, 0x12, 0x40,
+  0xdf, 0x25, 0x00, 0xee, 0xa8, 0x84, 0xd6, 0x42, 0x89, 0xcb, 0x14, 0x78,
+  0x2d, 0xc4, 0xba, 0x40, 0x3c, 0xb9, 0x7d, 0xfc, 0xf0, 0xf9, 0xeb, 0xa3,
+  0x54, 0xe8, 0xe1, 0xeb, 0x03, 0xc7, 0xd2, 0xe0, 0x86, 0x00, 0xfe, 0xdb,
+  0x03, 0x9b, 0xe7, 0x81, 0x8f, 0x41, 0x53, 0x33, 0x51, 0x70, 0xba, 0x48,
+  0xdf, 0x61, 0xa6, 0x26, 0x25, 0xa3, 0x2c, 0xdd, 0xd9, 0x6b, 0x81, 0xa4,
+  0xb6, 0x5e, 0x81, 0x7c, 0x9f, 0xac, 0x69, 0xf4, 0xc4, 0x02, 0x30, 0x31,
+  0xb4, 0x2b, 0x56, 0x31, 0xb3, 0x5a, 0xbb, 0x35, 0xe9, 0xda, 0xdd, 0x04,
+  0x2d, 0x81, 0x3a, 0x17, 0xe2, 0xf9, 0x7d, 0xfc, 0x00, 0x46, 0x81, 0x17,
+  0x85, 0xcc, 0xab, 0x77, 0x1c, 0x5d, 0xbd, 0x6a, 0x93, 0x0f, 0xff, 0x85,
+  0x5c, 0xab, 0x69, 0x37, 0x15, 0xf6, 0xeb, 0xe6, 0x85, 0x51, 0x15, 0xc5,
+  0x6e, 0x12, 0xa5, 0xc6, 0xcd, 0xa8, 0xc7, 0x69, 0x61, 0x49, 0x90, 0x12,
+  0xda, 0xd2, 0x87, 0xe6, 0x59, 0x61, 0x4a, 0x3f, 0xf0, 0x58, 0x0c, 0xa3,
+  0x21, 0x20, 0x74, 0xb4, 0xa2, 0x1e, 0x6e, 0x0a, 0xd1, 0x17, 0xb2, 0x60,
+  0x33, 0x30, 0x99, 0x5e, 0x6e, 0x4c, 0x5f, 0xed, 0xda, 0x5b, 0xda, 0xa2,
+  0x7a, 0xa2, 0x43, 0xb9, 0xbb, 0x1f, 0x03, 0x7e, 0xf5, 0x51, 0x40, 0x8d,
+  0x1e, 0x4d, 0xbb, 0x55, 0x2d, 0xf1, 0xb8, 0xad, 0x20, 0xb6, 0x50, 0xf0,
+  0xf5, 0x53, 0x4f, 0xb6, 0x29, 0x59, 0xf0, 0x91, 0x97, 0xaf, 0xd2, 0xcb,
+  0x91, 0x42, 0x8f, 0xf1, 0x96, 0xf8, 0xe0, 0x6d, 0xf8, 0xc2, 0x45, 0x61,
+  0xfd, 0x25, 0x0c, 0x3c, 0xfd, 0x5c, 0x6b, 0xad, 0x5f, 0x7a, 0x07, 0xf5,
+  0xff, 0x82, 0x9c, 0x28, 0x34, 0xb0, 0x21, 0xac, 0x7a, 0xb8, 0xe4, 0x29,
+  0x04, 0xf7, 0x3e, 0x49, 0xd6, 0xc4, 0xeb, 0x6f, 0xc5, 0x79, 0x5c, 0xec,
+  0x3b, 0x54, 0xf7, 0xfa, 0x65, 0x9a, 0x6c, 0x35, 0xdf, 0xef, 0xc8, 0x18,
+  0x15, 0xe0, 0x91, 0xcf, 0x68, 0xf0, 0x4c, 0x22, 0x0a, 0xb2, 0xf0, 0xdf,
+  0x84, 0xab, 0x35, 0x89, 0x99, 0xeb, 0xd3, 0x4c, 0x85, 0x69, 0xcc, 0x3b,
+  0x61, 0x50, 0x6f, 0xdd, 0x7f, 0xad, 0x25, 0xae, 0xda, 0xd9, 0xef, 0x7b,
+  0x50, 0xcb, 0xd7, 0xb8, 0x5a, 0x35, 0x57, 0x1e, 0xf9, 0xdb, 0x6e, 0xc5,
+  0x02, 0x12, 0x87, 0x11, 0x18, 0xb3, 0x05, 0x8b, 0xb9, 0x7e, 0xa9, 0x33,
+  0xac, 0xa6, 0x4e, 0x2f, 0xdb, 0x5c, 0x43, 0x52, 0x5d, 0xec, 0x0d, 0x48,
+  0xdd, 0x73, 0xc3, 0x7f, 0xd8, 0xf3, 0x29, 0x4a, 0xa9, 0xf3, 0x26, 0x6e,
+  0xde, 0xe2, 0xab, 0xaf, 0x2f, 0xe5, 0x2b, 0xaa, 0xa2, 0x97, 0xbe, 0x7f,
+  0x89, 0x4a, 0xa5, 0x5a, 0xa9, 0x97, 0x2e, 0xe8, 0x75, 0x17, 0x91, 0x1f,
+  0x6c, 0x03, 0x6e, 0x7d, 0x56, 0xaa, 0x76, 0x1f, 0x85, 0xcd, 0xf9, 0x34,
+  0x20, 0xa8, 0xd4, 0x69, 0x48, 0xe0, 0x4e, 0xa6, 0x41, 0xd6, 0xe6, 0x2a,
+  0x0d, 0x09, 0xfa, 0x9f, 0x77, 0x37, 0x4b, 0x30, 0x43, 0x00, 0x3b, 0x20,
+  0x1a, 0xcd, 0x79, 0x52, 0x4c, 0x97, 0x61, 0xcd, 0x1e, 0x87, 0xbd, 0x07,
+  0x53, 0xf7, 0x60, 0xfa, 0x01, 0x98, 0x5e, 0x82, 0xa9, 0x57, 0xd8, 0xdf,
+  0x28, 0xe3, 0xaa, 0xd5, 0x99, 0xa3, 0x56, 0xf8, 0x56, 0x7d, 0x5c, 0xc7,
+  0x74, 0xc3, 0x6b, 0x44, 0xc2, 0x9d, 0xe0, 0x03, 0xf3, 0x63, 0x65, 0x90,
+  0xdf, 0x63, 0x96, 0xd5, 0x83, 0xfc, 0x36, 0xb3, 0xd4, 0x1f, 0xee, 0xc6,
+  0xad, 0xbc, 0x9d, 0xe4, 0xf9, 0x7e, 0x64, 0x1b, 0xbb, 0xc4, 0xff, 0x48,
+  0x05, 0x29, 0x30, 0x0a, 0xf3, 0x95, 0x8f, 0x81, 0xab, 0x60, 0x1f, 0xc3,
+  0x64, 0xc8, 0x2b, 0x1f, 0xf8, 0xf3, 0xf3, 0x9b, 0x2e, 0x38, 0xd5, 0x02,
+  0xa0, 0x9e, 0x29, 0x7c, 0x47, 0xb7, 0x7e, 0x18, 0x1c, 0x2c, 0xcd, 0x60,
+  0x36, 0x31, 0xfc, 0xd3, 0x03, 0xc3, 0x69, 0xf3, 0x87, 0x1a, 0x19, 0xec,
+  0x76, 0x0c, 0xb6, 0xc0, 0x30, 0x61, 0x41, 0x4c, 0xf9, 0xc5, 0x60, 0xfa,
+  0xcc, 0xe2, 0xd9, 0x32, 0x2d, 0x1b, 0xa7, 0x0c, 0xf9, 0xcf, 0xf3, 0xb6,
+  0x2b, 0xb6, 0x99, 0xa1, 0x2c, 0xd6, 0x7d, 0xbb, 0x5c, 0x69, 0xf1, 0x90,
+  0x98, 0x00, 0x93, 0xe9, 0xdf, 0x60, 0x3a, 0xb9, 0x9d, 0xf6, 0xaa, 0xd8,
+  0x65, 0x75, 0x17, 0x75, 0x4c, 0x0c, 0x64, 0xd7, 0xb0, 0x55, 0x57, 0xa1,
+  0xca, 0xa0, 0x50, 0x92, 0x33, 0x0d, 0x0a, 0x29, 0xf9, 0x0f, 0x0c, 0xcb,
+  0x51, 0xb5, 0x68, 0x26, 0xa9, 0xe8, 0x9d, 0xf7, 0xa6, 0xa4, 0x8f, 0xd7,
+  0xda, 0xa7, 0xc8, 0x5e, 0x24, 0x28, 0xb5, 0xa5, 0x51, 0x48, 0xa3, 0x42,
+  0xc1, 0xcc, 0x73, 0x0f, 0x0f, 0xbe, 0x96, 0x2f, 0xd8, 0xfa, 0x60, 0x37,
+  0xae, 0x57, 0x8d, 0x72, 0x83, 0x4a, 0x3d, 0xe9, 0x64, 0x51, 0x57, 0x27,
+  0x5f, 0x4e, 0x80, 0xbb, 0x19, 0x7b, 0x7c, 0x42, 0x0f, 0xab, 0x3c, 0x94,
+  0x11, 0x8d, 0xbd, 0xf5, 0x96, 0xc5, 0xe3, 0x30, 0x3d, 0x8d, 0x28, 0x0f,
+  0x23, 0xa6, 0xe5, 0x49, 0xc4, 0x15, 0xce, 0x23, 0x3b, 0xec, 0xe5, 0xd4,
+  0x6c, 0xde, 0xb4, 0xb7, 0xfb, 0xff, 0x01,
+  0xe5, 0x99, 0x5d, 0x73, 0x9b, 0x38, 0x14, 0x86, 0xef, 0xfb, 0x2b, 0x74,
+  0x5f, 0xba, 0xa3, 0x0f, 0x20, 0xc0, 0x9d, 0xd3, 0x26, 0x9e, 0xcc, 0x6e,
+  0x76, 0xb3, 0x21, 0x3b, 0xcd, 0xad, 0x30, 0xb2, 0xcd, 0x84, 0x80, 0x07,
+  0xe3, 0x6d, 0xd2, 0x8b, 0xfe, 0xf6, 0x4a, 0x02, 0x61, 0x90, 0x31, 0x60,
+  0xe3, 0xb4, 0x4d, 0xea, 0x99, 0x4c, 0x24, 0x6c, 0xe4, 0x73, 0x1e, 0xbd,
+  0x9c, 0x0f, 0x19, 0x12, 0x28, 0x5f, 0x0e, 0x74, 0x8a, 0x51, 0x39, 0x57,
+  0x2f, 0xe3, 0x9c, 0xe5, 0xe9, 0x0a, 0x4c, 0xe9, 0x23, 0x5b, 0xd1, 0xd0,
+  0xa0, 0x5e, 0x80, 0x8d, 0xc0, 0x0b, 0x90, 0x11, 0xd0, 0xd9, 0x83, 0x17,
+  0x38, 0x46, 0xb8, 0x0a, 0xd3, 0x2f, 0x89, 0xb7, 0x84, 0x7f, 0x98, 0x7c,
+  0x1c, 0xb3, 0x79, 0x2e, 0xc6, 0xe2, 0x7a, 0x16, 0x2d, 0x96, 0x72, 0x82,
+  0xf9, 0x64, 0xb3, 0x12, 0x23, 0x64, 0x88, 0x0f, 0xac, 0x97, 0xe9, 0x26,
+  0x0e, 0x59, 0xe6, 0x05, 0x66, 0x31, 0xcf, 0x23, 0xb1, 0x16, 0x82, 0x72,
+  0x96, 0xf3, 0xfb, 0x16, 0xe2, 0x4d, 0x5b, 0x4e, 0x9f, 0x3c, 0x5a, 0x5c,
+  0x7f, 0xf6, 0x28, 0x32, 0xe4, 0x9a, 0xdb, 0xfb, 0xad, 0xf2, 0x42, 0xb9,
+  0x40, 0xf9, 0x7e, 0xb5, 0xc2, 0x59, 0x31, 0xe7, 0x4b, 0xe0, 0x62, 0xc4,
+  0xd7, 0x30, 0x8d, 0x75, 0x4e, 0xb3, 0xdc, 0x0b, 0x5c, 0xe3, 0xc9, 0x0b,
+  0x88, 0xf1, 0xec, 0x05, 0xd0, 0x58, 0xc5, 0x34, 0x9f, 0xa7, 0xd9, 0xa3,
+  0xf7, 0x39, 0x4a, 0xb8, 0x3b, 0x6b, 0xe3, 0x9d, 0xe2, 0xe0, 0x20, 0x74,
+  0x26, 0xfe, 0xbb, 0x36, 0xa4, 0x0d, 0x2e, 0xfe, 0xdf, 0x17, 0x3e, 0xf8,
+  0x98, 0x26, 0x79, 0x96, 0xc6, 0x31, 0xcb, 0x04, 0x19, 0x53, 0x90, 0x81,
+  0x25, 0x19, 0xac, 0xc8, 0xbc, 0xe7, 0x66, 0x97, 0x60, 0x3e, 0x70, 0x57,
+  0x14, 0x97, 0xf7, 0x72, 0xcc, 0xb1, 0x7c, 0xa0, 0x3a, 0x15, 0x5b, 0x77,
+  0xf3, 0x4c, 0xd9, 0x4c, 0x84, 0xcd, 0x96, 0xb0, 0x19, 0x0d, 0xb1, 0x39,
+  0xec, 0xb7, 0x19, 0x0a, 0x9b, 0x4d, 0xdd, 0xe6, 0xe3, 0x76, 0x73, 0xc0,
+  0x86, 0x35, 0x3d, 0x41, 0xc2, 0x13, 0xab, 0xcb, 0x13, 0xec, 0x60, 0x39,
+  0x40, 0x4e, 0x53, 0x95, 0x7f, 0xb2, 0x28, 0xad, 0x90, 0x5b, 0x95, 0x18,
+  0x9b, 0xf6, 0xe0, 0xa6, 0x9e, 0x48, 0xbf, 0x79, 0xf6, 0x8e, 0x80, 0xea,
+  0x62, 0x81, 0xbd, 0xe0, 0x09, 0xb4, 0x8a, 0x11, 0x6d, 0x9a, 0x3b, 0x85,
+  0xce, 0xfd, 0x7f, 0x15, 0x6e, 0xf5, 0xf0, 0x98, 0x2f, 0x21, 0x11, 0x4b,
+  0x58, 0x8a, 0x85, 0xa5, 0x64, 0x88, 0xa5, 0xc8, 0x6e, 0x5a, 0x3a, 0xc9,
+  0x66, 0x34, 0x64, 0x35, 0x53, 0x4f, 0xa0, 0x88, 0x1a, 0xce, 0xde, 0x1d,
+  0xc0, 0xda, 0x0e, 0x48, 0x9d, 0x98, 0xc2, 0x1d, 0x73, 0x88, 0x3b, 0xae,
+  0xe6, 0xce, 0x2d, 0xfb, 0x9f, 0x25, 0x8b, 0x9a, 0xd4, 0x5f, 0xd2, 0x42,
+  0x6b, 0x90, 0x85, 0xba, 0x34, 0x58, 0x12, 0x6d, 0xd6, 0x3b, 0xda, 0x78,
+  0x7d, 0x81, 0x95, 0x34, 0x9e, 0x95, 0xc1, 0x0a, 0x24, 0x28, 0x68, 0x03,
+  0x02, 0xae, 0xe9, 0xd3, 0x3c, 0xca, 0x18, 0x38, 0x8f, 0xe9, 0x57, 0x06,
+  0xc8, 0xef, 0x0b, 0xc8, 0x82, 0xb8, 0x09, 0xe8, 0xc6, 0xbf, 0xdf, 0xa1,
+  0x81, 0xe0, 0x09, 0x71, 0x38, 0x23, 0x69, 0xb8, 0x87, 0xc0, 0xe0, 0xe8,
+  0x0e, 0xa2, 0x81, 0x9a, 0x05, 0x8a, 0x71, 0x95, 0xe4, 0x2c, 0x9b, 0xcc,
+  0x72, 0xc0, 0xff, 0xa2, 0x34, 0xb9, 0x29, 0x8a, 0x94, 0x76, 0xa9, 0x1c,
+  0x13, 0x67, 0xb5, 0xf0, 0xd0, 0xee, 0x78, 0xf5, 0x01, 0xbc, 0x5b, 0x5d,
+  0x0c, 0x89, 0x5b, 0xb6, 0xbe, 0xc7, 0xb7, 0x8c, 0xe7, 0xe8, 0xb6, 0x54,
+  0xad, 0x7c, 0xb2, 0x8f, 0xf7, 0xc9, 0x6c, 0xfa, 0x64, 0xe9, 0x3e, 0x39,
+  0x9a, 0x4f, 0xae, 0xf2, 0xe9, 0xec, 0xa0, 0x9d, 0xb2, 0x91, 0xe6, 0x93,
+  0x4f, 0x93, 0x2f, 0x14, 0xf8, 0x8f, 0x7c, 0x2d, 0x30, 0xcd, 0xa2, 0x15,
+  0xb8, 0xba, 0xaa, 0xdc, 0xc2, 0xa7, 0x90, 0xef, 0x11, 0x8a, 0xad, 0xed,
+  0xac, 0xaa, 0x47, 0x3a, 0x7d, 0xb3, 0x30, 0x92, 0x03, 0x0c, 0x51, 0xc3,
+  0xb7, 0xcb, 0x4b, 0x30, 0xbd, 0x41, 0xc2, 0x1d, 0x54, 0xb8, 0xf3, 0x36,
+  0x82, 0x14, 0xec, 0x05, 0x62, 0xbb, 0xb2, 0x32, 0xc3, 0x96, 0xd6, 0x36,
+  0x4c, 0xd6, 0x52, 0xc0, 0x26, 0x04, 0x77, 0xb7, 0xe0, 0xc6, 0x37, 0x35,
+  0x2d, 0xff, 0x28, 0x4a, 0x94, 0x8c, 0xa5, 0xc4, 0x1b, 0x86, 0x5d, 0x4a,
+  0xd6, 0x81, 0x94, 0xf8, 0xab, 0xec, 0xb2, 0x88, 0x16, 0xca, 0x89, 0x06,
+  0x66, 0x5c, 0x77, 0xb5, 0xd8, 0x44, 0x21, 0xe3, 0xf7, 0xe3, 0x2e, 0x44,
+  0xee, 0x58, 0x1d, 0xc1, 0xbd, 0x3a, 0x22, 0xbb, 0x6d, 0x56, 0x11, 0xdf,
+  0xfb, 0xfb, 0xac, 0x2d, 0x22, 0xb3, 0x07, 0x11, 0x92, 0x45, 0x3f, 0x22,
+  0x25, 0xa4, 0x2a, 0xf3, 0xc9, 0x98, 0x28, 0x11, 0x71, 0x8b, 0x14, 0x20,
+  0x6e, 0xbb, 0xc4, 0xc3, 0x11, 0x28, 0x38, 0xb6, 0x06, 0xa7, 0x94, 0x8c,
+  0xf2, 0xae, 0x49, 0xc7, 0xe9, 0xa7, 0xa3, 0x14, 0x53, 0x2e, 0x80, 0x77,
+  0xc2, 0x67, 0xc7, 0x53, 0x56, 0xb4, 0x41, 0x45, 0x47, 0x87, 0xbb, 0xf0,
+  0xb8, 0xaa, 0x50, 0x9f, 0x87, 0x0d, 0x3c, 0xff, 0x24, 0x5f, 0x29, 0xb8,
+  0xbb, 0xd8, 0x9f, 0x1f, 0x4e, 0x5e, 0x0f, 0x50, 0x3c, 0xb2, 0x1e, 0xa0,
+  0x56, 0x97, 0x5e, 0x06, 0x26, 0x99, 0x2d, 0x0f, 0xa6, 0x25, 0x99, 0x80,
+  0x65, 0x79, 0x9a, 0xe6, 0xcb, 0xdf, 0x16, 0x09, 0x6a, 0x93, 0xc8, 0xc7,
+  0xd7, 0x25, 0x11, 0x72, 0x02, 0x1e, 0x14, 0xcb, 0x48, 0x62, 0xdb, 0x0e,
+  0x6e, 0xd6, 0x56, 0x08, 0x5c, 0xa7, 0x41, 0x14, 0x33, 0x2d, 0xae, 0x90,
+  0x3a, 0x9c, 0xb6, 0x46, 0xb0, 0xfc, 0x7a, 0xbb, 0x6a, 0xf8, 0x3a, 0x03,
+  0x5a, 0x80, 0x9d, 0xd6, 0x03, 0xb5, 0xd7, 0x77, 0x08, 0x33, 0x87, 0xac,
+  0xd5, 0x93, 0x53, 0x67, 0xaf, 0x9f, 0x5e, 0xfc, 0x58, 0x07, 0x9e, 0x0d,
+  0x2a, 0x30, 0x36, 0xd2, 0x5a, 0xd8, 0x8c, 0xb1, 0x64, 0xb2, 0x8e, 0xe8,
+  0xa9, 0x99, 0xd8, 0x1d, 0x79, 0xdc, 0x1c, 0xb2, 0xf1, 0x9d, 0x79, 0x7c,
+  0x1b, 0x84, 0xac, 0x0a, 0x09, 0x3e, 0x34, 0x8f, 0x2b, 0x26, 0x8e, 0x2e,
+  0xfb, 0x15, 0x63, 0x61, 0x1c, 0x25, 0x0f, 0xc0, 0xe7, 0x5f, 0xf8, 0xc0,
+  0xc0, 0xe5, 0xfd, 0x1b, 0x50, 0x0c, 0x39, 0x52, 0x31, 0xae, 0xa6, 0x98,
+  0x4f, 0x1b, 0x1a, 0xfb, 0xcb, 0x74, 0xf6, 0x00, 0xf0, 0x6b, 0xd5, 0x0c,
+  0x19, 0xaf, 0x99, 0x90, 0x34, 0xbb, 0xaa, 0xf2, 0x57, 0x07, 0x40, 0xc0,
+  0xdd, 0x26, 0x0b, 0xd2, 0xf1, 0x8d, 0xc3, 0xa0, 0xfa, 0xf8, 0xd7, 0x6c,
+  0xb4, 0x14, 0xa3, 0xb9, 0xc6, 0xe8, 0xe2, 0xfe, 0xe2, 0xdf, 0x37, 0x77,
+  0x38, 0x26, 0x25, 0x83, 0x07, 0xe0, 0x40, 0x5a, 0x52, 0x32, 0xae, 0xe9,
+  0xf3, 0x3c, 0xa6, 0xeb, 0x25, 0xf0, 0x69, 0xbe, 0xc9, 0x12, 0x30, 0x09,
+  0xe9, 0x2a, 0x6f, 0x9c, 0x9f, 0x8c, 0x22, 0x63, 0xf5, 0x9c, 0x07, 0xd9,
+  0x23, 0xcf, 0x83, 0x94, 0x5b, 0x58, 0x6f, 0xa7, 0x67, 0x8f, 0x0c, 0x4c,
+  0x27, 0x10, 0xff, 0xd0, 0xad, 0xb6, 0x06, 0xff, 0x62, 0xd2, 0xbf, 0xd5,
+  0x2d, 0xe1, 0x61, 0xe0, 0x39, 0xa8, 0x62, 0xa2, 0x97, 0x1f, 0x7f, 0xa5,
+  0x8b, 0x68, 0x46, 0x5e, 0x26, 0x89, 0x8c, 0x3b, 0x4a, 0x3a, 0x59, 0x9e,
+  0x40, 0x64, 0x9f, 0xbc, 0xb7, 0x75, 0x57, 0x5d, 0xe2, 0x7b, 0xa3, 0xa3,
+  0x53, 0x03, 0x81, 0xeb, 0x20, 0x50, 0x05, 0xc2, 0xec, 0x3e, 0xfa, 0x74,
+  0x06, 0xa7, 0x0a, 0xb1, 0xd9, 0xdf, 0xf6, 0xec, 0xf6, 0xde, 0x38, 0xf7,
+  0x1d,
+  0xed, 0x59, 0x5b, 0x6f, 0xda, 0x30, 0x18, 0x7d, 0xdf, 0xaf, 0xf0, 0x3b,
+  0x69, 0xe5, 0x5b, 0x2e, 0xe4, 0xad, 0x97, 0xa9, 0x52, 0xa5, 0x75, 0x55,
+  0x23, 0xb5, 0xd3, 0xde, 0x1c, 0x62, 0x68, 0x34, 0x4a, 0x50, 0x08, 0x1b,
+  0xfc, 0xfb, 0xd9, 0x26, 0x81, 0x38, 0xc1, 0xc1, 0x01, 0x36, 0xa9, 0x55,
+  0x79, 0xc1, 0x0e, 0xc4, 0x7c, 0xe7, 0x7c, 0xe7, 0xbb, 0x05, 0x48, 0xa0,
+  0x7a, 0x05, 0x63, 0xc8, 0xe5, 0x3b, 0xa2, 0x08, 0xc1, 0xda, 0xcb, 0xb9,
+  0x63, 0x6f, 0x19, 0x06, 0xb7, 0xe9, 0x6f, 0x36, 0x9d, 0xf2, 0xdc, 0x61,
+  0x61, 0x8c, 0x9c, 0x38, 0x8c, 0xb1, 0x13, 0xb3, 0xd1, 0xaf, 0x30, 0x0e,
+  0x9c, 0x64, 0x9e, 0x64, 0x7f, 0x66, 0xe1, 0x2b, 0xbc, 0xa4, 0x62, 0x3d,
+  0xe5, 0xe3, 0x42, 0xae, 0xe5, 0xf5, 0x3c, 0x9d, 0xbc, 0xaa, 0x0d, 0x16,
+  0x9b, 0xe5, 0x5c, 0xae, 0x90, 0x23, 0xbf, 0xb0, 0x78, 0xcd, 0x96, 0xd3,
+  0x84, 0xe7, 0x61, 0x4c, 0x37, 0xfb, 0x22, 0x95, 0x67, 0x21, 0xa8, 0x76,
+  0x85, 0xb8, 0x6f, 0x22, 0x3f, 0xf4, 0xd4, 0x76, 0x15, 0xb2, 0xcd, 0xf5,
+  0x75, 0xc8, 0x90, 0xa3, 0xce, 0xdc, 0xdd, 0xef, 0x96, 0x17, 0xca, 0x03,
+  0xca, 0xcf, 0xb7, 0x27, 0xf8, 0x9b, 0xbd, 0x38, 0x02, 0x6f, 0x56, 0xe2,
+  0x0c, 0xe2, 0x2c, 0x0a, 0x96, 0x17, 0x61, 0x3c, 0x74, 0x56, 0x61, 0x0c,
+  0x9d, 0x75, 0x18, 0x13, 0x67, 0x3e, 0x65, 0xc5, 0x38, 0xcb, 0xdf, 0xc2,
+  0x97, 0x74, 0x26, 0xe0, 0x2c, 0x9c, 0x2f, 0xb0, 0x45, 0x0c, 0xd1, 0x89,
+  0x79, 0x8c, 0x08, 0xb8, 0xc9, 0x66, 0x45, 0x9e, 0x9d, 0x87, 0x98, 0xc9,
+  0x32, 0x4d, 0xb8, 0x38, 0x04, 0xbf, 0x5b, 0x8a, 0xa8, 0x46, 0x90, 0xa4,
+  0x68, 0xca, 0xd6, 0x11, 0x9f, 0xb0, 0x2d, 0x39, 0xb0, 0x22, 0x65, 0x20,
+  0xec, 0x2c, 0x39, 0xb9, 0x60, 0x70, 0x4b, 0xc9, 0x40, 0xad, 0x05, 0x23,
+  0x17, 0xac, 0xa9, 0x14, 0x4f, 0x07, 0xee, 0x1b, 0x60, 0x6e, 0xbf, 0x80,
+  0x2b, 0x0c, 0x81, 0xc4, 0x40, 0x6d, 0x31, 0xf8, 0x2e, 0x69, 0x60, 0x88,
+  0x50, 0xdd, 0xcd, 0xef, 0xd0, 0xc3, 0xe8, 0x74, 0x0f, 0x0f, 0x31, 0xc2,
+  0xca, 0xc3, 0x84, 0x7a, 0x1a, 0x3b, 0x0f, 0x5f, 0xa3, 0x46, 0x10, 0x40,
+  0x49, 0x11, 0x2a, 0x29, 0xc2, 0x7d, 0xfc, 0x5d, 0x5a, 0x64, 0x65, 0x87,
+  0x4b, 0x7d, 0xcd, 0x8e, 0x27, 0x2e, 0x4c, 0x00, 0xd7, 0x69, 0x01, 0xa4,
+  0xde, 0xc0, 0x1d, 0x9f, 0xf1, 0x45, 0xba, 0xa8, 0x99, 0x06, 0xae, 0x12,
+  0x36, 0x2f, 0x34, 0x13, 0x7b, 0x4a, 0xf1, 0x08, 0xe9, 0x79, 0x92, 0x5c,
+  0x22, 0xc9, 0xa5, 0x36, 0xa0, 0x3c, 0x5d, 0x7b, 0x4e, 0x64, 0x60, 0x97,
+  0x1e, 0xc3, 0x6e, 0x33, 0x9a, 0x1a, 0x18, 0xfc, 0x1d, 0xfd, 0x2b, 0x49,
+  0xce, 0x5a, 0xc2, 0xb2, 0xb0, 0xd9, 0xa7, 0x5c, 0x17, 0x04, 0xcf, 0xee,
+  0x78, 0x06, 0x7e, 0x80, 0xab, 0x7c, 0xc4, 0x12, 0x0e, 0x22, 0x29, 0xca,
+  0x96, 0x2e, 0x7a, 0x87, 0x4e, 0x5d, 0xad, 0x8a, 0x50, 0x6c, 0x63, 0x5c,
+  0xbc, 0x47, 0xad, 0x18, 0xcc, 0xb3, 0xbc, 0xa8, 0xcb, 0xa1, 0xcc, 0x4c,
+  0x1b, 0xcb, 0x10, 0x3c, 0xd2, 0x34, 0x11, 0x76, 0x1d, 0x16, 0xb9, 0x58,
+  0xd1, 0x84, 0x5d, 0x5f, 0xd7, 0x6d, 0x34, 0x5a, 0x8e, 0xc1, 0x63, 0x44,
+  0xcf, 0x5a, 0x49, 0xec, 0xb3, 0x8b, 0xc8, 0x03, 0x27, 0x66, 0x17, 0x46,
+  0xf7, 0x64, 0x17, 0xb7, 0x67, 0x76, 0x89, 0x71, 0xa0, 0x16, 0xb8, 0x51,
+  0x3f, 0x9e, 0xd8, 0xfc, 0x75, 0xc6, 0x0b, 0x20, 0xfd, 0x56, 0x73, 0x98,
+  0x2f, 0xd9, 0xf1, 0x4a, 0x76, 0xdc, 0x63, 0xd8, 0xd1, 0x01, 0x97, 0xc6,
+  0x52, 0x1b, 0x13, 0x89, 0xc1, 0xc4, 0xa8, 0x61, 0xe3, 0xfe, 0x40, 0x3d,
+  0xce, 0x83, 0x16, 0x25, 0xa0, 0x6f, 0xf8, 0x56, 0x70, 0x5c, 0x13, 0x1c,
+  0x56, 0x2c, 0xf3, 0x59, 0x05, 0x08, 0xe0, 0x4b, 0x58, 0x93, 0xe5, 0xb9,
+  0x6a, 0x38, 0x6d, 0xa3, 0xd0, 0x13, 0xe9, 0xb1, 0x3a, 0x0a, 0x0c, 0xa8,
+  0x6e, 0x73, 0xce, 0xde, 0x46, 0x6c, 0xa1, 0x85, 0x3f, 0xd6, 0xaa, 0x81,
+  0xd2, 0x93, 0xc2, 0x24, 0xac, 0xad, 0x20, 0x09, 0xc3, 0x14, 0xa2, 0x32,
+  0x96, 0xb6, 0xda, 0xc7, 0x3b, 0xc7, 0xe8, 0x41, 0x41, 0xb6, 0xa1, 0x80,
+  0x74, 0xc7, 0x28, 0x0c, 0x43, 0x0b, 0x0c, 0xc8, 0x84, 0xe1, 0x9e, 0x4d,
+  0x96, 0x2c, 0xdf, 0x03, 0x60, 0x23, 0x35, 0x7a, 0x9a, 0xd4, 0x10, 0xd1,
+  0x5d, 0x14, 0x1c, 0x96, 0x1e, 0x6c, 0xb6, 0x1b, 0x50, 0x87, 0xac, 0xc4,
+  0x88, 0xb0, 0x0d, 0x66, 0x6e, 0xc0, 0xfc, 0xcc, 0x47, 0x45, 0xce, 0x57,
+  0xe6, 0x1a, 0xde, 0x33, 0xf6, 0x51, 0x05, 0x06, 0x4b, 0x0b, 0xb1, 0xad,
+  0xae, 0xb0, 0x29, 0xf8, 0xc9, 0xed, 0xf7, 0x3d, 0xb6, 0x9d, 0xc5, 0x21,
+  0x8d, 0x90, 0x71, 0x0f, 0xfb, 0x03, 0x5b, 0x35, 0x52, 0x15, 0xa4, 0xd8,
+  0x00, 0xe9, 0x25, 0x4d, 0xc1, 0xcd, 0x94, 0x2d, 0x16, 0xe9, 0xa8, 0x55,
+  0x2b, 0x5b, 0x69, 0x4d, 0xca, 0xa6, 0x8a, 0x1a, 0x44, 0x77, 0x61, 0x83,
+  0xdc, 0x32, 0x6e, 0x84, 0xfb, 0xab, 0xe6, 0x17, 0x76, 0x03, 0x0c, 0x6c,
+  0x72, 0x9d, 0x2e, 0xb8, 0xe1, 0xb6, 0x02, 0xed, 0xc2, 0x8e, 0x6a, 0x1a,
+  0x84, 0xb6, 0xf9, 0x10, 0x8f, 0x3e, 0xe9, 0xa8, 0xd1, 0x41, 0x4c, 0x05,
+  0xf9, 0xee, 0x06, 0xb0, 0x59, 0x02, 0x1e, 0x3c, 0xda, 0xd2, 0xbd, 0xbf,
+  0x63, 0x01, 0xed, 0x58, 0xc0, 0x35, 0x16, 0x48, 0xc5, 0x82, 0xde, 0x8b,
+  0x0c, 0x98, 0x95, 0xb8, 0x35, 0xb0, 0x83, 0xaa, 0xe9, 0xe8, 0x40, 0xab,
+  0xf2, 0x4f, 0x60, 0x81, 0x96, 0x92, 0xce, 0x62, 0xd8, 0xce, 0x3a, 0x36,
+  0x7e, 0x3e, 0x30, 0xc4, 0xda, 0x76, 0x5f, 0x86, 0xb1, 0xf6, 0xf0, 0x6c,
+  0x51, 0x61, 0xa3, 0x06, 0x6c, 0x72, 0xbc, 0x95, 0xae, 0x7c, 0x8c, 0x70,
+  0x4b, 0xd8, 0xb8, 0xd9, 0x62, 0x1d, 0x0b, 0xd8, 0x30, 0xda, 0xda, 0x8b,
+  0xdb, 0x34, 0xda, 0x76, 0x6a, 0x9d, 0xf6, 0x6a, 0x1a, 0x5c, 0xcf, 0xb2,
+  0xb3, 0x43, 0xff, 0x67, 0x04, 0xb3, 0x0e, 0x52, 0xd7, 0x7f, 0xa7, 0x86,
+  0x37, 0x08, 0xff, 0xe0, 0xd9, 0xc5, 0x33, 0xe6, 0x52, 0xf6, 0xc6, 0x6f,
+  0x96, 0x31, 0x3f, 0x1f, 0xd6, 0xb2, 0x4d, 0xed, 0x03, 0xb5, 0xca, 0x33,
+  0x67, 0x41, 0x6a, 0xca, 0xa3, 0x75, 0x87, 0x0e, 0xca, 0x9f, 0x13, 0x21,
+  0x3c, 0x28, 0x7f, 0x4f, 0x00, 0xbe, 0xa8, 0xae, 0x06, 0xe5, 0x72, 0x2d,
+  0xe5, 0xb6, 0x27, 0xf1, 0xda, 0x11, 0xd2, 0x1c, 0x82, 0x6b, 0x59, 0xd4,
+  0x22, 0xf1, 0xf6, 0x68, 0xa3, 0xbc, 0xe1, 0x87, 0xeb, 0x0c, 0x03, 0xf8,
+  0xd9, 0x0a, 0x49, 0x3a, 0x12, 0x98, 0xa8, 0xd9, 0x84, 0xb4, 0x9e, 0x0b,
+  0xe3, 0xae, 0x27, 0x9f, 0xff, 0xf2, 0x7f, 0x11, 0x0b, 0x57, 0x7b, 0xa7,
+  0x3e, 0xf4, 0x3f, 0x3c, 0x14, 0x8d, 0x37, 0xef, 0x2c, 0x89, 0xb5, 0x19,
+  0xc2, 0xf9, 0xc6, 0x56, 0xf7, 0xd9, 0x7a, 0xce, 0x12, 0xf0, 0x9c, 0xe6,
+  0xc5, 0x92, 0x4d, 0xbb, 0x9e, 0x6d, 0x0d, 0xcf, 0x41, 0xd3, 0x11, 0xcf,
+  0xca, 0xed, 0x98, 0xd8, 0xf5, 0x58, 0xb0, 0x83, 0x09, 0x56, 0x3e, 0x46,
+  0x21, 0x58, 0xef, 0x97, 0x9d, 0xe0, 0x3a, 0x2d, 0x6e, 0x33, 0xf0, 0x93,
+  0xe7, 0x59, 0x4b, 0x1f, 0xa8, 0xf6, 0x57, 0x08, 0x3e, 0x50, 0x80, 0xb1,
+  0x75, 0x01, 0x16, 0x8e, 0xee, 0xea, 0x0a, 0xff, 0x02,
+  0xed, 0x99, 0x5d, 0x73, 0xa2, 0x30, 0x18, 0x85, 0xef, 0xf7, 0x57, 0xe4,
+  0xbe, 0xb4, 0x93, 0x0f, 0xbe, 0xef, 0xda, 0xee, 0x6e, 0x77, 0x2f, 0x3a,
+  0xd3, 0xa9, 0x9d, 0x6e, 0x6f, 0x03, 0x04, 0xcb, 0x94, 0x8a, 0x83, 0xb8,
+  0xad, 0xff, 0x7e, 0x13, 0x10, 0x85, 0x18, 0x54, 0x84, 0xb5, 0x5a, 0xeb,
+  0x85, 0x13, 0x50, 0xf1, 0xe4, 0xf1, 0x9c, 0x37, 0x79, 0x11, 0x12, 0x98,
+  0x3f, 0x28, 0x81, 0x66, 0x3e, 0xb0, 0x20, 0x82, 0x95, 0x87, 0x36, 0xa0,
+  0x51, 0xc6, 0x5e, 0xc0, 0x1d, 0xc6, 0x50, 0xa3, 0xae, 0x87, 0x35, 0xcf,
+  0xf5, 0x88, 0x16, 0x8c, 0x83, 0xe4, 0x6d, 0xe4, 0x9e, 0x51, 0xc4, 0x87,
+  0x31, 0x0b, 0x33, 0xf7, 0x9c, 0x42, 0x3e, 0x4c, 0xa3, 0xe1, 0x73, 0xc6,
+  0x4f, 0x8b, 0xf1, 0x74, 0xcc, 0x4f, 0x22, 0x4d, 0xbc, 0x3a, 0x79, 0x4e,
+  0xa6, 0x71, 0xc0, 0x52, 0xd7, 0x33, 0xf3, 0xe3, 0x8c, 0xbf, 0x6f, 0x28,
+  0x0e, 0x2d, 0x2d, 0xff, 0xc4, 0xf2, 0x75, 0xbd, 0x38, 0xb1, 0x78, 0x83,
+  0xa1, 0xbd, 0xbb, 0x1e, 0xd4, 0x66, 0xae, 0x87, 0xb4, 0x71, 0x4c, 0xb3,
+  0x30, 0x49, 0x5f, 0xdd, 0x3f, 0xd1, 0x88, 0x7f, 0xfd, 0x44, 0xfb, 0x06,
+  0x65, 0xf5, 0x4e, 0x83, 0x7a, 0xdb, 0x56, 0xa8, 0x7f, 0x86, 0x17, 0x7a,
+  0x29, 0x9f, 0x8f, 0xed, 0x85, 0x7e, 0x7e, 0x80, 0x8b, 0x09, 0xf0, 0x91,
+  0x7a, 0x06, 0x93, 0x2c, 0xf2, 0x5f, 0x5c, 0xcf, 0x96, 0xa7, 0x23, 0x0e,
+  0xdf, 0x5d, 0x3e, 0x7f, 0x31, 0x98, 0xb9, 0x7c, 0xfe, 0xea, 0x09, 0xce,
+  0x3f, 0xef, 0xac, 0x4c, 0x37, 0x3f, 0xe6, 0x57, 0x20, 0xc5, 0x88, 0x5f,
+  0x02, 0xb7, 0x43, 0xe0, 0x41, 0x5d, 0x89, 0xc0, 0x71, 0x72, 0x04, 0x48,
+  0x20, 0xe0, 0x1c, 0x68, 0x21, 0xbf, 0x25, 0x8a, 0xe1, 0x34, 0x0a, 0x18,
+  0xbf, 0x08, 0x96, 0xa0, 0xe8, 0x55, 0x28, 0x08, 0xd6, 0xa9, 0x98, 0x9b,
+  0xa9, 0x18, 0x35, 0x2a, 0x08, 0x49, 0x58, 0x2c, 0x25, 0x96, 0x49, 0x46,
+  0xd3, 0x4c, 0x30, 0x2c, 0xf9, 0x90, 0x6d, 0xf8, 0xf8, 0x0d, 0x7c, 0xb0,
+  0x03, 0x57, 0x01, 0x21, 0xbc, 0x23, 0x21, 0xfb, 0x88, 0x01, 0x85, 0xa1,
+  0x1a, 0x90, 0x01, 0x21, 0xf8, 0x99, 0xa4, 0x3e, 0x03, 0xf7, 0xd3, 0x57,
+  0x2f, 0x66, 0x95, 0x44, 0xcd, 0x69, 0xa1, 0x6e, 0xd1, 0xd2, 0xd7, 0x44,
+  0xab, 0x35, 0x23, 0xa7, 0x11, 0x11, 0x5e, 0x20, 0x22, 0x25, 0x22, 0xfe,
+  0x8b, 0xb4, 0x0a, 0x59, 0x60, 0x34, 0x30, 0x32, 0x15, 0x26, 0x72, 0xfa,
+  0xa0, 0xb2, 0x03, 0x88, 0xed, 0xdc, 0x61, 0xb7, 0x73, 0x47, 0x10, 0xee,
+  0x7b, 0xe6, 0x7b, 0x08, 0x8d, 0xd1, 0x15, 0x0b, 0xb2, 0x43, 0x43, 0x89,
+  0x85, 0x60, 0xd8, 0x43, 0xd9, 0xfd, 0xf0, 0x5a, 0xa2, 0xef, 0x56, 0x4b,
+  0x10, 0x55, 0x63, 0xb9, 0x9e, 0x79, 0x49, 0x3a, 0x3c, 0x5d, 0x2e, 0x18,
+  0x86, 0xa6, 0xd2, 0x2e, 0x03, 0x6c, 0xf1, 0x22, 0x7b, 0x17, 0xd3, 0xd9,
+  0x20, 0xa3, 0x59, 0x94, 0x8c, 0xc0, 0x75, 0x32, 0xca, 0xd2, 0x24, 0x8e,
+  0x59, 0xfa, 0x09, 0x56, 0x6f, 0xdc, 0x19, 0x1c, 0x82, 0x0d, 0xe0, 0xc4,
+  0xbe, 0xef, 0x0b, 0x5c, 0x33, 0x38, 0x2c, 0x39, 0xae, 0x88, 0x20, 0x78,
+  0xbc, 0x20, 0x95, 0xd5, 0x7c, 0x5f, 0x69, 0x3c, 0xe3, 0x11, 0xea, 0x08,
+  0xe7, 0xbc, 0x4c, 0x61, 0x2f, 0x74, 0x88, 0x3a, 0x8f, 0x0b, 0x48, 0x08,
+  0xdc, 0xd0, 0x57, 0x76, 0xe2, 0x46, 0xf2, 0x73, 0x54, 0xb5, 0xdd, 0xb3,
+  0x40, 0xc5, 0x86, 0x14, 0xdc, 0x8a, 0xa7, 0xef, 0x69, 0xf4, 0x97, 0x81,
+  0xdb, 0x68, 0x14, 0x01, 0xf3, 0x4a, 0xca, 0x5f, 0xbe, 0x4f, 0x44, 0xcb,
+  0xbe, 0x51, 0x5f, 0xf6, 0x8d, 0xa4, 0xd2, 0x37, 0x92, 0xb2, 0x6f, 0xd4,
+  0x37, 0x37, 0x86, 0x55, 0xf9, 0x44, 0xc8, 0x87, 0xdb, 0xc8, 0x37, 0x54,
+  0xf2, 0x6f, 0xd8, 0x88, 0x4d, 0xa2, 0x49, 0xa1, 0x9d, 0xf4, 0xa4, 0x5d,
+  0x25, 0x75, 0x0b, 0x81, 0x96, 0x24, 0xf0, 0x72, 0xc2, 0xa5, 0x80, 0xeb,
+  0x28, 0x9b, 0xe5, 0xf2, 0x2a, 0x82, 0x24, 0x0f, 0x7e, 0x20, 0x54, 0xbb,
+  0xb5, 0xe6, 0xb9, 0xa3, 0x49, 0xe9, 0xe8, 0xde, 0xa5, 0xf1, 0x8c, 0xe5,
+  0x03, 0x54, 0x9e, 0x29, 0xa5, 0x85, 0x19, 0x4b, 0x87, 0x71, 0xf2, 0x06,
+  0x9e, 0xbc, 0xe4, 0x5d, 0xfa, 0xa5, 0x61, 0x55, 0xa4, 0xf9, 0xdf, 0x9a,
+  0x19, 0x8a, 0x3b, 0x36, 0x33, 0x65, 0x8c, 0xd5, 0x7b, 0x11, 0x4b, 0x10,
+  0xc2, 0x1b, 0x03, 0xed, 0x43, 0xa3, 0xd8, 0xa3, 0x49, 0x4b, 0xaa, 0xa8,
+  0x74, 0x83, 0x28, 0x3d, 0x7f, 0x20, 0x00, 0x5f, 0x40, 0xbc, 0xc2, 0x05,
+  0xc1, 0x5d, 0xab, 0x9e, 0xb1, 0xee, 0x56, 0x0a, 0x22, 0xf5, 0xaa, 0x67,
+  0x6f, 0x66, 0x64, 0xd5, 0xab, 0x9e, 0x6c, 0x19, 0x67, 0x1d, 0x24, 0x5e,
+  0x23, 0x4b, 0x1f, 0xe9, 0x5b, 0x50, 0xc2, 0x3e, 0xc4, 0x35, 0x4a, 0xbf,
+  0xc7, 0xa2, 0x70, 0xac, 0xb1, 0x4f, 0x7b, 0x4c, 0x75, 0x38, 0xf6, 0x3a,
+  0x38, 0x5b, 0x2c, 0x09, 0xce, 0x7a, 0x38, 0x56, 0x9f, 0x70, 0x02, 0x09,
+  0xce, 0xdc, 0x42, 0xe0, 0x46, 0xef, 0x1d, 0xcb, 0xde, 0x3c, 0xb3, 0x5c,
+  0x29, 0x8d, 0x1d, 0xb1, 0x90, 0x40, 0xaa, 0x3d, 0x0b, 0x2c, 0xe4, 0x78,
+  0xb1, 0x74, 0x77, 0x8b, 0x1e, 0x48, 0x77, 0xe0, 0x3e, 0x83, 0x5b, 0xba,
+  0x63, 0x31, 0x3c, 0x68, 0x34, 0xb8, 0xe5, 0xad, 0x79, 0xd1, 0x3f, 0xc2,
+  0x8d, 0x27, 0x69, 0xb9, 0x92, 0xcf, 0xf9, 0x98, 0x2b, 0x7c, 0x1e, 0x30,
+  0x3d, 0xc9, 0xf2, 0x12, 0x20, 0xaf, 0x18, 0x85, 0xce, 0xc1, 0x6d, 0x6d,
+  0x4a, 0x0f, 0x75, 0xb8, 0x51, 0x5b, 0x9a, 0xa8, 0xd3, 0xe6, 0x66, 0xc9,
+  0x28, 0xa8, 0x31, 0xca, 0xc9, 0x10, 0x13, 0x7e, 0xd1, 0xc9, 0xf7, 0x7e,
+  0xd2, 0xed, 0xb9, 0x5f, 0x49, 0x1a, 0x8d, 0x69, 0x00, 0x7e, 0x3c, 0x3d,
+  0xe0, 0x93, 0xc6, 0x52, 0x0f, 0xd6, 0xd5, 0x15, 0x80, 0x16, 0x3c, 0xaa,
+  0x06, 0xc1, 0xe8, 0x15, 0xc7, 0x21, 0x65, 0x88, 0x1a, 0x87, 0xd0, 0x3c,
+  0x95, 0x6c, 0xb0, 0x22, 0x41, 0xe0, 0x9e, 0xd1, 0x18, 0x5c, 0xa6, 0x3e,
+  0x0d, 0x18, 0xb8, 0xe3, 0x8d, 0xf0, 0xe3, 0xd3, 0x0a, 0x1f, 0xab, 0xd7,
+  0xff, 0x84, 0x5a, 0xe4, 0x47, 0x95, 0x18, 0xc5, 0x5a, 0x64, 0xb6, 0xc2,
+  0x80, 0xcc, 0x10, 0x1e, 0x92, 0x45, 0x3e, 0x32, 0x3e, 0xff, 0x00,
+  0xed, 0x98, 0x4b, 0x73, 0xe2, 0x38, 0x10, 0x80, 0xef, 0xfb, 0x2b, 0x74,
+  0xc7, 0x6c, 0xe9, 0x61, 0x19, 0xe3, 0xdb, 0x64, 0x67, 0x42, 0xcd, 0xd4,
+  0x64, 0x2b, 0x55, 0x64, 0xb3, 0xd9, 0xa3, 0x8c, 0x15, 0x70, 0x8d, 0xb1,
+  0x5d, 0x46, 0xec, 0xc2, 0xbf, 0x5f, 0x49, 0x7e, 0x80, 0x85, 0xc1, 0x36,
+  0x90, 0x4c, 0x31, 0x15, 0x2e, 0x69, 0x39, 0x48, 0x74, 0x7f, 0xdd, 0xea,
+  0x87, 0x21, 0x81, 0xfa, 0xc3, 0x02, 0xe4, 0xab, 0xbf, 0x98, 0xbc, 0xc2,
+  0xfd, 0x8f, 0xf5, 0xf0, 0x7d, 0x62, 0x31, 0xcf, 0x87, 0x96, 0xef, 0xf9,
+  0xc8, 0xf2, 0xd9, 0xec, 0x87, 0xe7, 0x8f, 0xac, 0x20, 0x0d, 0x92, 0xff,
+  0x62, 0x6f, 0x01, 0x7f, 0xb7, 0xa5, 0x1c, 0xf1, 0x57, 0xa1, 0x64, 0x57,
+  0xca, 0x59, 0x38, 0x5f, 0xe8, 0x05, 0x96, 0x8b, 0x75, 0xaa, 0x24, 0x64,
+  0xa9, 0x2f, 0xac, 0x16, 0xc9, 0x3a, 0x0a, 0x78, 0xe6, 0xf9, 0x76, 0xbe,
+  0x16, 0xa1, 0x3a, 0xcb, 0xd5, 0x0b, 0x21, 0xb7, 0xcd, 0xe5, 0xff, 0x18,
+  0xd1, 0xcb, 0x8d, 0xc7, 0xa0, 0x16, 0xb6, 0x1e, 0x43, 0x96, 0x3e, 0x72,
+  0xb7, 0x9d, 0x16, 0x0f, 0xf2, 0xfd, 0xe3, 0x7c, 0x55, 0x1d, 0xe0, 0xe4,
+  0xeb, 0x8d, 0x3a, 0x4a, 0x4b, 0xf2, 0x08, 0xdb, 0x5a, 0x09, 0x96, 0x09,
+  0xcf, 0x77, 0xac, 0x8d, 0xe7, 0x63, 0x6b, 0xeb, 0xf9, 0xc4, 0x4a, 0x23,
+  0x26, 0x5e, 0x93, 0x6c, 0xe9, 0xfd, 0x1d, 0xc6, 0xd2, 0x98, 0x95, 0xf5,
+  0x1b, 0x34, 0x59, 0xb8, 0x06, 0x8b, 0x7b, 0x75, 0x5e, 0xca, 0x82, 0x03,
+  0x20, 0xce, 0x35, 0x80, 0x94, 0x26, 0xf8, 0x08, 0x76, 0x86, 0xb0, 0xdb,
+  0x83, 0x4e, 0xd9, 0x3d, 0xea, 0x67, 0x37, 0x7f, 0x57, 0xbb, 0x1b, 0x03,
+  0x41, 0x1e, 0x7d, 0x59, 0x20, 0x48, 0x9b, 0xaf, 0x06, 0x84, 0x1c, 0x0b,
+  0x04, 0xf0, 0xf4, 0xe5, 0x8d, 0x63, 0xc1, 0x6d, 0x73, 0xfc, 0xf8, 0x4c,
+  0x93, 0xf8, 0xe1, 0x3d, 0x07, 0xf7, 0x15, 0xce, 0xdb, 0x35, 0xcc, 0xe5,
+  0x10, 0xd7, 0x0c, 0x7b, 0xf1, 0x93, 0x0d, 0x20, 0x0e, 0x04, 0x7f, 0x24,
+  0xb1, 0xc8, 0x92, 0x28, 0xe2, 0xd9, 0x3b, 0xc6, 0x31, 0xc3, 0x97, 0x26,
+  0x34, 0x7c, 0x79, 0x1c, 0xfb, 0x36, 0xb4, 0x73, 0x48, 0x10, 0xd5, 0xd8,
+  0x4c, 0xf9, 0x9c, 0x81, 0x29, 0x13, 0xeb, 0x2c, 0x6e, 0xc6, 0x53, 0x60,
+  0x19, 0x30, 0x54, 0x52, 0x19, 0x4a, 0x43, 0x4a, 0x28, 0x03, 0x2d, 0x4b,
+  0x26, 0x43, 0x66, 0x22, 0x71, 0xea, 0xde, 0x1e, 0xb5, 0x79, 0x1b, 0x97,
+  0x16, 0xb9, 0xca, 0x22, 0xa2, 0x2c, 0xb2, 0x3b, 0x58, 0x84, 0x20, 0xb6,
+  0xeb, 0x37, 0x33, 0xda, 0x06, 0xe1, 0x3c, 0x04, 0x9f, 0x52, 0xbe, 0x39,
+  0x70, 0x33, 0x82, 0x97, 0xf9, 0xd9, 0xd9, 0xf7, 0x33, 0x22, 0x66, 0x40,
+  0xb7, 0x3a, 0x7a, 0x54, 0x73, 0x34, 0xb2, 0x0f, 0x22, 0xbe, 0xf4, 0x34,
+  0xae, 0x3c, 0x4d, 0x4b, 0x2e, 0x32, 0xc1, 0xf7, 0x02, 0x83, 0x8e, 0x80,
+  0x79, 0x66, 0x52, 0x15, 0x80, 0xdf, 0x98, 0x0d, 0x6e, 0x67, 0xb3, 0x0c,
+  0x57, 0x33, 0xa4, 0x29, 0xc8, 0x44, 0x1a, 0x44, 0x1c, 0x69, 0xc3, 0xb4,
+  0x88, 0x55, 0x7c, 0xe4, 0x22, 0x91, 0xdf, 0x70, 0x0a, 0xd9, 0x96, 0xf2,
+  0xa8, 0x85, 0x29, 0x39, 0xca, 0xb4, 0xe1, 0xf6, 0xe4, 0x4c, 0x3b, 0x5f,
+  0x1f, 0x84, 0x6f, 0x84, 0x29, 0xde, 0x21, 0xad, 0xe0, 0x61, 0x0d, 0x6f,
+  0x07, 0xd5, 0xde, 0x83, 0x4a, 0xaf, 0x0f, 0xb5, 0x73, 0xa0, 0xba, 0x68,
+  0xe6, 0xd4, 0xa0, 0xfe, 0x35, 0xbd, 0x33, 0x72, 0x11, 0xde, 0x67, 0xea,
+  0x5e, 0x31, 0x55, 0x17, 0x8d, 0xd6, 0xf9, 0x3d, 0x47, 0xd9, 0x75, 0x35,
+  0x34, 0x1d, 0x0d, 0x57, 0x78, 0x5c, 0x81, 0x81, 0xa7, 0xc0, 0x50, 0x38,
+  0xd2, 0x02, 0x19, 0x8f, 0x8d, 0xa6, 0x23, 0xe3, 0x2b, 0x21, 0xf7, 0xe4,
+  0x91, 0xa6, 0xa9, 0xd8, 0xbb, 0x48, 0x6b, 0xc9, 0xbf, 0xad, 0x96, 0xb9,
+  0xc7, 0xea, 0xef, 0x9e, 0x43, 0x69, 0x07, 0xbd, 0x11, 0x2e, 0x9f, 0x14,
+  0x7a, 0x3f, 0xf1, 0xd9, 0x62, 0x99, 0xf8, 0x61, 0x14, 0x8a, 0x2d, 0x78,
+  0x71, 0x86, 0xc4, 0x7d, 0xae, 0xf4, 0x27, 0xef, 0xe0, 0x55, 0xda, 0x6e,
+  0xbb, 0xd3, 0xd5, 0xab, 0xbb, 0x78, 0xc7, 0x35, 0xaf, 0x42, 0x45, 0x07,
+  0x75, 0xa1, 0x43, 0x8c, 0xf6, 0x64, 0xe7, 0xd5, 0xcf, 0xa4, 0x4a, 0x20,
+  0xf8, 0x74, 0xef, 0xd4, 0xdd, 0xa2, 0x3d, 0x13, 0x36, 0x4a, 0xc1, 0xb6,
+  0x4c, 0x57, 0x6a, 0x69, 0x1b, 0x3e, 0xfc, 0xba, 0x4c, 0xd9, 0x4c, 0x80,
+  0xbb, 0x48, 0x7a, 0xab, 0xc1, 0x79, 0x37, 0xeb, 0x0d, 0x6a, 0xd8, 0x79,
+  0x24, 0xf9, 0xdc, 0x5a, 0x98, 0xd2, 0xb3, 0xc1, 0x38, 0x98, 0xc2, 0xbc,
+  0xb1, 0xaa, 0x8f, 0x07, 0x13, 0xb6, 0xe4, 0x82, 0x47, 0x60, 0xf2, 0x04,
+  0xa1, 0x0d, 0x20, 0x52, 0x68, 0x88, 0x42, 0x53, 0x95, 0xb8, 0xbc, 0xda,
+  0x69, 0x22, 0xf2, 0xc7, 0x4a, 0x1e, 0x1a, 0x99, 0xa4, 0xa1, 0xb4, 0x35,
+  0x61, 0x1c, 0xa4, 0xd6, 0xfd, 0xa6, 0x56, 0xc7, 0x2a, 0x3e, 0xa5, 0xaa,
+  0x0b, 0x73, 0x55, 0x71, 0x5d, 0x57, 0xeb, 0x29, 0x5b, 0xaf, 0x04, 0x50,
+  0x0a, 0x17, 0x23, 0xeb, 0x65, 0xf5, 0x63, 0xbe, 0x0e, 0x03, 0x5e, 0x95,
+  0xdf, 0x9f, 0x5a, 0x49, 0x48, 0xcf, 0x4a, 0x52, 0x12, 0xb2, 0x0d, 0x42,
+  0x5f, 0x22, 0x3e, 0x4b, 0x96, 0x07, 0x88, 0xc8, 0xcd, 0x96, 0x58, 0xd2,
+  0x33, 0xca, 0x4b, 0x30, 0xce, 0x07, 0x98, 0x3a, 0x18, 0x86, 0xf3, 0xea,
+  0x34, 0x32, 0x06, 0x45, 0x55, 0xc3, 0xe3, 0x24, 0x4a, 0xe6, 0x5b, 0xf0,
+  0x35, 0x8e, 0x93, 0x7f, 0x99, 0x08, 0x93, 0x18, 0x3c, 0x4e, 0x31, 0xf8,
+  0x14, 0xb0, 0x54, 0x34, 0x8c, 0xd4, 0xb7, 0xc2, 0xea, 0x58, 0x0d, 0x21,
+  0xad, 0xf9, 0xa7, 0x60, 0x85, 0x8d, 0x5c, 0x69, 0x3d, 0x4e, 0xc9, 0xa9,
+  0x77, 0x0d, 0xb7, 0x02, 0x86, 0x9e, 0x0d, 0x66, 0x56, 0x76, 0x38, 0x94,
+  0xd6, 0xc0, 0xdc, 0x71, 0x91, 0xa4, 0xe0, 0xee, 0xfe, 0xe1, 0x0a, 0x83,
+  0xd2, 0xb1, 0xac, 0xfc, 0x6e, 0x23, 0xfa, 0x05, 0x93, 0x4f, 0xc1, 0x87,
+  0x42, 0xa7, 0x1e, 0x38, 0x2f, 0x21, 0x4b, 0x96, 0x21, 0x78, 0x79, 0x98,
+  0x3c, 0x42, 0xf4, 0xcf, 0x83, 0x35, 0xc8, 0x95, 0x1c, 0x48, 0x07, 0x0c,
+  0x8a, 0x1f, 0x1b, 0x48, 0xb7, 0x0c, 0xf3, 0xc7, 0xea, 0x9d, 0xcb, 0xb0,
+  0x78, 0x3c, 0x94, 0x4a, 0xfc, 0x7c, 0xa6, 0xe7, 0xa3, 0x3c, 0x13, 0x20,
+  0xa6, 0xd0, 0x08, 0xb0, 0x50, 0x24, 0xf1, 0x1c, 0x4c, 0xc8, 0x01, 0x0d,
+  0x7c, 0x2e, 0x8c, 0xb7, 0x7d, 0x07, 0x44, 0x7b, 0xc5, 0x17, 0xed, 0x85,
+  0xc7, 0x51, 0xa3, 0xd8, 0xe1, 0xfd, 0xc3, 0x08, 0x3b, 0xf7, 0xbf, 0xc0,
+  0x58, 0xdd, 0xb7, 0x19, 0x2a, 0xa9, 0x90, 0x46, 0x2a, 0xbf, 0xd4, 0x1b,
+  0x87, 0xb3, 0xd1, 0xd4, 0x5b, 0xe9, 0x0f, 0x34, 0x3b, 0x34, 0xf6, 0x47,
+  0xd4, 0x98, 0x68, 0x82, 0x02, 0x09, 0x9a, 0xd5, 0xb3, 0xf0, 0x9f, 0xdc,
+  0x5f, 0x47, 0xec, 0x76, 0x89, 0x9c, 0x6c, 0x7c, 0xba, 0x11, 0xe1, 0x75,
+  0x22, 0xdf, 0xb9, 0x7a, 0x41, 0xbc, 0x5a, 0x84, 0xe9, 0xb5, 0xa1, 0x38,
+  0xa7, 0xa0, 0xd8, 0xbd, 0xdb, 0x1d, 0x13, 0x0a, 0xed, 0xd6, 0x26, 0x77,
+  0x82, 0x82, 0x0d, 0x28, 0x9f, 0xd7, 0x2c, 0x02, 0xcf, 0xa1, 0x9f, 0xe5,
+  0xb3, 0xc4, 0xb7, 0x64, 0xab, 0xb5, 0x78, 0x53, 0x42, 0xe3, 0x4b, 0x01,
+  0xc1, 0x3e, 0x80, 0xf6, 0xda, 0x99, 0x26, 0x42, 0xff, 0x03,
+  0xed, 0x99, 0x49, 0x73, 0x9b, 0x30, 0x14, 0xc7, 0xef, 0xfd, 0x14, 0xba,
+  0x87, 0x74, 0xb4, 0x20, 0x02, 0xdc, 0xb2, 0x35, 0x33, 0xed, 0x24, 0xf1,
+  0xc4, 0xe9, 0xd4, 0x57, 0x01, 0x72, 0xcc, 0x84, 0x20, 0x06, 0x43, 0x63,
+  0x7f, 0xfb, 0x4a, 0x18, 0x13, 0x4b, 0xde, 0x70, 0xcd, 0x64, 0x73, 0x7c,
+  0x89, 0x84, 0x83, 0xe6, 0xbd, 0xdf, 0x5b, 0xf4, 0x97, 0x0c, 0x09, 0xac,
+  0x3e, 0x41, 0x84, 0x70, 0x35, 0x20, 0x21, 0x5c, 0xfc, 0x58, 0x3f, 0xc5,
+  0x34, 0x63, 0x11, 0x38, 0x4d, 0xb2, 0x11, 0x03, 0xfd, 0x91, 0x08, 0x1f,
+  0x2d, 0xe6, 0x07, 0xc8, 0x0a, 0xfc, 0x00, 0x5b, 0x01, 0x0b, 0x1f, 0xfd,
+  0xc0, 0xb5, 0xa2, 0x2c, 0x12, 0xcf, 0xa9, 0x3f, 0x82, 0xdf, 0x6d, 0x39,
+  0x4e, 0xf8, 0xb0, 0x50, 0x63, 0xf5, 0x3c, 0x8f, 0x1f, 0x46, 0xd5, 0x04,
+  0xcb, 0x49, 0x99, 0xa9, 0x11, 0xb2, 0xd4, 0x3f, 0x8c, 0x47, 0xa2, 0x4c,
+  0x22, 0x9e, 0xfb, 0x81, 0x3d, 0x9b, 0x17, 0xb1, 0x5a, 0x0b, 0xc1, 0x6a,
+  0x56, 0xc8, 0xf7, 0x1e, 0xd4, 0x97, 0x4e, 0x35, 0x9d, 0xf8, 0x6c, 0xf6,
+  0x7c, 0xea, 0x33, 0x64, 0x55, 0x6b, 0xbe, 0xbc, 0x4f, 0xeb, 0x07, 0xf5,
+  0x02, 0xf5, 0xf7, 0xcd, 0x0a, 0x27, 0xb3, 0xb9, 0x5c, 0x02, 0xcf, 0x46,
+  0x72, 0x0d, 0x62, 0x8d, 0x0b, 0x96, 0x17, 0x7e, 0xe0, 0x59, 0x13, 0x3f,
+  0x80, 0xd6, 0xd4, 0x0f, 0x88, 0x95, 0x25, 0xac, 0x18, 0x8a, 0xfc, 0xc9,
+  0xff, 0x13, 0xa7, 0xd2, 0x9d, 0xb1, 0xf5, 0x0d, 0x1a, 0x70, 0x10, 0x8e,
+  0x74, 0x38, 0xbf, 0xfb, 0x67, 0xe0, 0x5c, 0xa4, 0x45, 0x2e, 0x92, 0x84,
+  0xe7, 0x0a, 0x0c, 0x54, 0x60, 0x50, 0x0d, 0xc6, 0x59, 0xe9, 0xe9, 0x16,
+  0x67, 0x6a, 0xcb, 0x4e, 0x94, 0x65, 0xb8, 0xb5, 0x65, 0xc4, 0xb0, 0xec,
+  0x8e, 0x2b, 0xa3, 0xe2, 0xf4, 0x11, 0xf4, 0xf9, 0x83, 0x0c, 0x1c, 0x2b,
+  0xca, 0x3c, 0x05, 0xe7, 0x09, 0x1b, 0x8f, 0xe3, 0x70, 0xb5, 0xcd, 0x75,
+  0x10, 0x8f, 0x18, 0x9a, 0xc7, 0xf0, 0x58, 0x1a, 0x3a, 0x0f, 0xe1, 0x51,
+  0x35, 0x96, 0x11, 0x3c, 0x66, 0x66, 0x00, 0xa9, 0x19, 0x32, 0xc3, 0x27,
+  0xbc, 0x14, 0x91, 0xda, 0x47, 0x57, 0xf9, 0x48, 0x94, 0x8f, 0x76, 0x1b,
+  0x1f, 0xe9, 0x7a, 0x1f, 0x6f, 0x2e, 0xfb, 0x86, 0x53, 0x78, 0x31, 0x10,
+  0xee, 0xff, 0x3b, 0x67, 0xaf, 0x8d, 0x90, 0xd7, 0x58, 0x0f, 0x37, 0x58,
+  0x1f, 0x42, 0x84, 0x66, 0x23, 0x8a, 0x34, 0xeb, 0x65, 0x48, 0x78, 0x38,
+  0x8a, 0x37, 0xe5, 0x0f, 0x82, 0xfb, 0x55, 0x96, 0xa3, 0x55, 0x16, 0xd1,
+  0xc3, 0xe4, 0x6e, 0x4f, 0xc6, 0x13, 0xbd, 0xb2, 0x6c, 0x23, 0x8e, 0xde,
+  0x8a, 0xca, 0x6a, 0xe8, 0xc8, 0x3a, 0x6c, 0x13, 0xdc, 0x05, 0x3c, 0x54,
+  0xc3, 0x73, 0x9f, 0x8b, 0x74, 0xfc, 0x24, 0x97, 0x5a, 0x1f, 0xcc, 0x0f,
+  0xda, 0x6e, 0xda, 0xa7, 0x0c, 0xb2, 0xf5, 0x84, 0xbf, 0x62, 0x4f, 0xbc,
+  0x5f, 0x88, 0x0c, 0xf4, 0xfa, 0x36, 0xf8, 0x51, 0xa6, 0x46, 0xee, 0xec,
+  0xd7, 0x94, 0x1f, 0xca, 0x38, 0xe2, 0x72, 0x11, 0xbc, 0x03, 0x2f, 0x46,
+  0xf6, 0xe5, 0xc5, 0xec, 0x4d, 0x49, 0xd4, 0xae, 0x3d, 0x37, 0xbc, 0x30,
+  0xc5, 0x46, 0x89, 0xa5, 0xcf, 0x0c, 0x5c, 0xb2, 0xf1, 0x14, 0x5c, 0xe5,
+  0x71, 0xb6, 0x54, 0x5f, 0x6e, 0x17, 0xe5, 0xb5, 0x10, 0xf9, 0xb6, 0x2c,
+  0x9a, 0x57, 0xf0, 0x72, 0x62, 0xb4, 0x2a, 0x16, 0x62, 0x14, 0xcb, 0x69,
+  0x98, 0x97, 0x93, 0xc3, 0xdb, 0x97, 0x1b, 0x1e, 0xd4, 0xe0, 0x71, 0xc6,
+  0x55, 0x95, 0xb4, 0xd9, 0x10, 0x3e, 0x7d, 0x0f, 0xa1, 0x9e, 0xb1, 0xed,
+  0x64, 0x9c, 0x47, 0xd5, 0xa6, 0x79, 0x2f, 0xf2, 0x38, 0x3a, 0x60, 0x32,
+  0xce, 0x57, 0xd2, 0xac, 0x41, 0x83, 0x88, 0xd1, 0x48, 0xcf, 0x58, 0x51,
+  0xb0, 0x24, 0x1e, 0x72, 0x20, 0x8f, 0x03, 0x95, 0x01, 0x0a, 0x8e, 0xa3,
+  0xe0, 0x9c, 0xd4, 0x70, 0xcc, 0x6d, 0x03, 0x6e, 0x77, 0x08, 0xcd, 0xad,
+  0x23, 0xca, 0x3a, 0x5b, 0x59, 0x47, 0x5b, 0x58, 0x67, 0x23, 0x0a, 0x57,
+  0xb4, 0xf9, 0xeb, 0x38, 0xcc, 0x45, 0xd5, 0xe7, 0x41, 0x2f, 0x17, 0x4d,
+  0xaf, 0x7f, 0x8d, 0x66, 0x48, 0xb7, 0xfb, 0xea, 0xec, 0x1b, 0x3c, 0xd4,
+  0xb6, 0x19, 0xda, 0x64, 0x2b, 0x1e, 0xd2, 0x6c, 0x15, 0xf0, 0x03, 0xd3,
+  0x99, 0x67, 0x34, 0x6e, 0x03, 0xc5, 0x5e, 0x09, 0xe5, 0x36, 0x95, 0x9d,
+  0x90, 0xaf, 0x16, 0x07, 0x08, 0x77, 0x29, 0xbe, 0xe1, 0xce, 0x5a, 0xc1,
+  0xdd, 0xcc, 0xe4, 0x45, 0x7c, 0x93, 0x86, 0x49, 0x23, 0x27, 0xa4, 0x54,
+  0x6f, 0xa9, 0x27, 0x1c, 0xf5, 0xd7, 0xf3, 0x20, 0xd3, 0xe8, 0x5c, 0xab,
+  0x33, 0xe3, 0x45, 0x1e, 0xff, 0xe5, 0x7b, 0x1f, 0x15, 0xd7, 0x08, 0x1e,
+  0xd2, 0xc2, 0x2c, 0x8e, 0xa0, 0xde, 0xa1, 0x2f, 0x4a, 0x96, 0x74, 0xaa,
+  0x79, 0xdf, 0xa8, 0x41, 0xbf, 0x44, 0xcc, 0xde, 0x51, 0xf0, 0xd8, 0xa8,
+  0x26, 0xe4, 0xea, 0x0d, 0xfa, 0xd7, 0xe9, 0xc5, 0xe5, 0x27, 0xd0, 0x7f,
+  0xbb, 0x0a, 0x7f, 0xa7, 0xde, 0xaf, 0xa0, 0xfe, 0xb1, 0xee, 0x79, 0x1a,
+  0xf2, 0xb4, 0x00, 0x83, 0x98, 0xa5, 0x53, 0x51, 0x02, 0x75, 0x70, 0xca,
+  0x58, 0xb4, 0x9c, 0xc1, 0xef, 0xfc, 0x5c, 0xbd, 0x98, 0x28, 0xad, 0x0a,
+  0xda, 0xc1, 0xf5, 0x91, 0x91, 0x12, 0x0d, 0xc8, 0x20, 0x10, 0x13, 0x40,
+  0x1c, 0xb8, 0xf9, 0xb6, 0xaa, 0xbb, 0x74, 0x71, 0x75, 0x26, 0x08, 0xee,
+  0x9a, 0x2e, 0x9e, 0xc1, 0x64, 0x9e, 0x3e, 0xab, 0xab, 0xa7, 0xdd, 0x65,
+  0x59, 0x43, 0x07, 0xd3, 0x40, 0x3f, 0x57, 0xf7, 0x06, 0xaf, 0x48, 0x83,
+  0xe1, 0x3d, 0x61, 0x30, 0xda, 0x21, 0x0b, 0x5b, 0xbf, 0x55, 0x93, 0x1b,
+  0x63, 0xc0, 0xf3, 0x42, 0x88, 0x62, 0x74, 0xa8, 0x48, 0x10, 0x33, 0x8a,
+  0x47, 0xca, 0x49, 0x70, 0x39, 0x91, 0x0a, 0x2a, 0x8d, 0x0f, 0xb7, 0x68,
+  0x10, 0x73, 0x3d, 0x5d, 0x23, 0x08, 0xa9, 0x11, 0x06, 0x3d, 0x3a, 0x00,
+  0xbd, 0xa4, 0x1c, 0x77, 0x70, 0x77, 0xb9, 0xee, 0x02, 0xea, 0x4d, 0xba,
+  0xed, 0x8e, 0xb7, 0x98, 0x73, 0x48, 0xc1, 0x17, 0xa4, 0xad, 0x90, 0xf0,
+  0xba, 0x4c, 0x3a, 0xed, 0x1a, 0x12, 0xfd, 0xc0, 0x90, 0x82, 0xd7, 0x82,
+  0xf4, 0x81, 0x33, 0x89, 0x30, 0x6a, 0x2f, 0xcb, 0x9c, 0xdb, 0x94, 0xbf,
+  0x8d, 0xcc, 0x79, 0x57, 0xbb, 0xd8, 0x30, 0x1a, 0xb2, 0x77, 0x20, 0x01,
+  0x77, 0x87, 0xd1, 0x89, 0xf3, 0xdc, 0x70, 0xfe, 0x4e, 0x84, 0x8f, 0xe0,
+  0x9c, 0xa5, 0xd1, 0xb4, 0x53, 0xf7, 0xeb, 0x1a, 0x72, 0x37, 0x71, 0xf0,
+  0xf6, 0xcc, 0x11, 0x59, 0xd9, 0xdd, 0x27, 0x89, 0x3b, 0xff, 0x25, 0x1b,
+  0xeb, 0xb7, 0xc3, 0xee, 0x59, 0x5c, 0x5c, 0x08, 0xd0, 0xbf, 0x21, 0x50,
+  0xbb, 0x45, 0x3b, 0x80, 0x5f, 0x24, 0xff, 0x01,
+  0xed, 0x59, 0xc1, 0x72, 0xda, 0x30, 0x10, 0xbd, 0xf7, 0x2b, 0x7c, 0x47,
+  0xe9, 0x68, 0x25, 0xdb, 0x18, 0xdd, 0x92, 0x66, 0x72, 0xc8, 0x4c, 0x28,
+  0xd3, 0x1e, 0xda, 0xab, 0x85, 0x1d, 0xf0, 0x84, 0x22, 0xc6, 0x98, 0x16,
+  0xfe, 0xbe, 0x92, 0x6d, 0x70, 0x00, 0xd9, 0x28, 0xae, 0x69, 0x12, 0x22,
+  0x4e, 0x2b, 0x99, 0x59, 0xed, 0x7b, 0x5a, 0xbd, 0x5d, 0xcb, 0x98, 0xe2,
+  0xfc, 0x37, 0x0e, 0x48, 0x54, 0x58, 0xe5, 0x44, 0xf9, 0x43, 0xc1, 0x4d,
+  0x92, 0xdd, 0x0a, 0xe7, 0xfb, 0x90, 0x62, 0x14, 0x32, 0x0e, 0x88, 0x33,
+  0x8e, 0x11, 0x0f, 0xc7, 0x4f, 0x72, 0x80, 0x51, 0xb4, 0x88, 0xc4, 0x9f,
+  0x39, 0xeb, 0x85, 0x20, 0xcd, 0x59, 0xfc, 0x98, 0xb1, 0xab, 0x50, 0xcd,
+  0xa6, 0xc9, 0x64, 0x9a, 0xc9, 0x69, 0x65, 0xaf, 0x16, 0x72, 0x12, 0x90,
+  0x7a, 0xba, 0x9c, 0x8a, 0xd5, 0x2c, 0x8a, 0x53, 0xc6, 0x7d, 0x94, 0xff,
+  0xa5, 0x9a, 0xe8, 0xa3, 0x65, 0x16, 0xa6, 0x99, 0xf4, 0x0a, 0x68, 0xcd,
+  0xb8, 0x8b, 0x36, 0x8c, 0x53, 0xb4, 0x98, 0x85, 0xd9, 0xa3, 0x48, 0x7f,
+  0xb1, 0x1f, 0xc9, 0x5c, 0xae, 0xb4, 0x44, 0x9f, 0xf0, 0x71, 0xc4, 0xa0,
+  0x8b, 0xf8, 0x3a, 0x0a, 0x17, 0x59, 0x9c, 0xaa, 0xa0, 0xb1, 0x0a, 0x1a,
+  0x8e, 0x82, 0x9e, 0xe2, 0xcf, 0xee, 0x36, 0x6a, 0x69, 0x07, 0xbb, 0xb0,
+  0xe5, 0x80, 0x14, 0x71, 0x4b, 0x0b, 0xd0, 0x64, 0x95, 0x44, 0x31, 0xe3,
+  0xe4, 0x08, 0x41, 0x3e, 0xce, 0x92, 0xdc, 0x2b, 0xcd, 0x47, 0x99, 0x74,
+  0x30, 0x51, 0x0f, 0x83, 0x7c, 0xb8, 0x66, 0x92, 0x00, 0x65, 0x6c, 0x98,
+  0x24, 0xe0, 0x08, 0x70, 0x31, 0x51, 0x3a, 0x70, 0x8b, 0xe1, 0xce, 0xc3,
+  0xa0, 0x18, 0x4b, 0x17, 0xb4, 0xb0, 0xa4, 0x0f, 0x77, 0x9f, 0x23, 0xaa,
+  0x38, 0x72, 0x8d, 0x38, 0xf2, 0xf5, 0xbb, 0x7a, 0x47, 0xb1, 0x33, 0x4a,
+  0x45, 0xc3, 0xce, 0x9a, 0x92, 0xf4, 0x4a, 0xdc, 0x90, 0x1d, 0x37, 0xb4,
+  0x75, 0xfe, 0xf8, 0x70, 0x66, 0x6e, 0x5e, 0x3b, 0x81, 0xba, 0x20, 0x69,
+  0xa0, 0x4d, 0xa0, 0xbb, 0x2f, 0x17, 0x43, 0x52, 0xed, 0x29, 0x33, 0x27,
+  0x09, 0x88, 0x36, 0x93, 0x7e, 0x72, 0xb1, 0x76, 0xbe, 0xce, 0xe3, 0x5c,
+  0x44, 0xb7, 0x6c, 0x75, 0xa3, 0x49, 0xf0, 0x9e, 0x45, 0x09, 0x68, 0xad,
+  0x28, 0x5d, 0xd4, 0xa1, 0xf3, 0x5a, 0xe7, 0x93, 0xbe, 0xb2, 0x7d, 0x8b,
+  0xc7, 0x71, 0xf2, 0xbb, 0x28, 0x6d, 0xf6, 0xd0, 0x81, 0xa7, 0xcd, 0xa2,
+  0x87, 0x4e, 0x92, 0xe8, 0x24, 0x52, 0xff, 0x00, 0x5a, 0x5f, 0x03, 0xad,
+  0xfd, 0xfe, 0x7b, 0xd0, 0x00, 0xed, 0x1f, 0x15, 0xe4, 0x10, 0x1a, 0xe9,
+  0x00, 0xda, 0x0b, 0xce, 0xbe, 0x5f, 0xdb, 0x66, 0xda, 0xa2, 0x5b, 0x91,
+  0x04, 0x96, 0xa4, 0x93, 0x24, 0xe9, 0x3b, 0x93, 0xa1, 0x6d, 0x4c, 0x2a,
+  0x8e, 0x88, 0x2d, 0x24, 0x06, 0x24, 0x35, 0x4b, 0x92, 0x33, 0x9a, 0xad,
+  0x96, 0xf6, 0xc8, 0x15, 0x4c, 0x81, 0x65, 0xca, 0x8c, 0xa9, 0x1a, 0x71,
+  0xf2, 0x5d, 0xd4, 0x2b, 0x97, 0x91, 0x0b, 0xf6, 0xca, 0x75, 0xa4, 0xcf,
+  0xab, 0xed, 0xac, 0x5b, 0x9a, 0x1b, 0x85, 0xa9, 0xaa, 0xf6, 0x1d, 0xbc,
+  0x95, 0xef, 0x90, 0x02, 0x36, 0x21, 0xab, 0x42, 0x6e, 0x80, 0x77, 0x5f,
+  0x67, 0x9e, 0x8b, 0x71, 0x47, 0x1d, 0xcb, 0x21, 0x18, 0xe3, 0xe0, 0x5f,
+  0xd4, 0x9d, 0x50, 0xab, 0x97, 0x06, 0x24, 0x79, 0xd0, 0xe2, 0xa6, 0xb0,
+  0xab, 0xcd, 0x26, 0x35, 0xd0, 0xbb, 0xe9, 0xbc, 0xa9, 0xbe, 0x16, 0x28,
+  0x71, 0x23, 0xdd, 0xed, 0x3e, 0xbc, 0xeb, 0xed, 0xd7, 0x17, 0x01, 0x4b,
+  0x51, 0x45, 0x91, 0x6b, 0x65, 0xc4, 0x80, 0x24, 0xbd, 0x8c, 0x0c, 0xcf,
+  0xf2, 0xfe, 0x4e, 0x4e, 0x88, 0x84, 0x41, 0xbc, 0x5e, 0xe3, 0xe7, 0x86,
+  0x22, 0xf7, 0xed, 0x07, 0x07, 0xbf, 0xf1, 0x56, 0xe6, 0x3c, 0xfc, 0x04,
+  0xfb, 0x8c, 0x0c, 0xda, 0xdc, 0xde, 0xb4, 0x85, 0x6b, 0xeb, 0xc5, 0x29,
+  0x8a, 0xfa, 0xfa, 0x73, 0x3e, 0x3a, 0x5b, 0x6b, 0xd8, 0x40, 0x44, 0x5d,
+  0xf3, 0xd0, 0x88, 0xbc, 0xf5, 0x5d, 0x57, 0xf0, 0x61, 0x91, 0x0f, 0xf4,
+  0xc8, 0x6f, 0xc5, 0x84, 0x8b, 0x79, 0xfc, 0x26, 0xf5, 0x1d, 0x30, 0x09,
+  0xb4, 0x5f, 0xba, 0xe4, 0xbb, 0xed, 0x75, 0x3a, 0x0e, 0xa3, 0xd8, 0xb9,
+  0x17, 0x9b, 0xfc, 0xc4, 0xe8, 0x76, 0xef, 0xbf, 0xbd, 0xa3, 0x00, 0xa6,
+  0xb5, 0x71, 0x5e, 0xda, 0xdd, 0xa0, 0x69, 0x1b, 0xff, 0x17,
+  0xed, 0x98, 0x5d, 0x6f, 0xda, 0x30, 0x14, 0x86, 0xef, 0xf7, 0x2b, 0xb8,
+  0xc7, 0x9d, 0xfc, 0x4d, 0x92, 0xbb, 0xae, 0x6b, 0x27, 0x4d, 0x5b, 0x55,
+  0x09, 0x4d, 0x9d, 0x76, 0xe7, 0x90, 0x00, 0xd1, 0x42, 0x83, 0x42, 0xaa,
+  0x95, 0x7f, 0x3f, 0xdb, 0x71, 0x89, 0x42, 0x9c, 0x0f, 0x02, 0x52, 0xd8,
+  0x14, 0x6e, 0x38, 0x0e, 0x10, 0x1f, 0x3f, 0x3e, 0xef, 0x9b, 0x63, 0x20,
+  0x81, 0xfa, 0xb5, 0x70, 0x70, 0xa0, 0xde, 0x11, 0x32, 0x17, 0xcc, 0x0b,
+  0x38, 0x9f, 0xa2, 0xec, 0x73, 0x32, 0xf9, 0x11, 0x67, 0xd1, 0x46, 0x64,
+  0xe1, 0xe4, 0x39, 0x4a, 0xc3, 0x00, 0x08, 0xcf, 0x87, 0xc0, 0xf7, 0x7c,
+  0x04, 0x7c, 0xb1, 0xf8, 0x2d, 0xdf, 0x21, 0x08, 0xb6, 0x41, 0xf2, 0xe7,
+  0xc5, 0x5b, 0xc3, 0x8f, 0x54, 0xc6, 0x71, 0xb8, 0xcc, 0x54, 0xec, 0xc8,
+  0x38, 0x8d, 0x56, 0x6b, 0x3d, 0xc0, 0x72, 0xf0, 0xba, 0x55, 0x11, 0x02,
+  0xab, 0xd7, 0x28, 0x08, 0xe5, 0x0f, 0x31, 0x50, 0x5f, 0xdd, 0xad, 0x93,
+  0xd7, 0x38, 0x08, 0x53, 0xcf, 0xe7, 0xf9, 0x38, 0x8b, 0xf4, 0x6d, 0x89,
+  0x1e, 0x65, 0xf2, 0x0e, 0x2b, 0xf5, 0xa1, 0xa3, 0x87, 0x6f, 0x9e, 0x80,
+  0x3a, 0xd8, 0x7b, 0x02, 0x81, 0x4d, 0xb4, 0x5b, 0x20, 0xcf, 0xc7, 0x1c,
+  0x6c, 0x45, 0x10, 0xc4, 0xa1, 0x8a, 0xa9, 0x89, 0xb1, 0x8c, 0x19, 0xd0,
+  0xf3, 0x17, 0x33, 0xcc, 0xcc, 0x05, 0x33, 0x05, 0xcd, 0x87, 0x87, 0x39,
+  0xdc, 0x7c, 0x2c, 0x27, 0x21, 0x79, 0x24, 0x67, 0xa1, 0x60, 0x97, 0x89,
+  0x34, 0x93, 0xdf, 0x46, 0xe0, 0xcd, 0xf3, 0x09, 0xd8, 0x7b, 0xbe, 0x9c,
+  0x23, 0x16, 0xd9, 0x32, 0x49, 0x37, 0xde, 0x73, 0xf4, 0x22, 0xd7, 0xbe,
+  0x03, 0x1f, 0x60, 0x85, 0x26, 0x43, 0x36, 0x9a, 0xdf, 0x22, 0x49, 0x72,
+  0x7e, 0xaf, 0x30, 0x22, 0x85, 0x11, 0x0e, 0x8f, 0xf1, 0xe2, 0x90, 0xa8,
+  0x82, 0x44, 0x3a, 0x41, 0x12, 0xbe, 0x0d, 0xd2, 0x03, 0x81, 0x93, 0xdb,
+  0x74, 0x21, 0x82, 0x70, 0xf2, 0x35, 0xd9, 0xeb, 0x4c, 0x2e, 0x07, 0xec,
+  0x5f, 0xe6, 0x85, 0x9b, 0x25, 0x7a, 0x4d, 0xe2, 0x2c, 0x24, 0x59, 0x28,
+  0x72, 0x50, 0x41, 0xe2, 0x06, 0x41, 0xe2, 0x51, 0x8f, 0x39, 0x23, 0xd7,
+  0x5a, 0x5f, 0xf3, 0x47, 0x02, 0x1b, 0x08, 0x4d, 0x65, 0xd2, 0x06, 0xd0,
+  0x8d, 0x80, 0x07, 0x3e, 0x53, 0x1d, 0x4b, 0x3c, 0x37, 0xf2, 0xf3, 0x63,
+  0x26, 0x95, 0x45, 0xf6, 0xcd, 0xd8, 0xee, 0x20, 0x8f, 0xf7, 0x73, 0x7b,
+  0xca, 0xb6, 0xbd, 0x69, 0xc1, 0xdf, 0x33, 0x33, 0xd2, 0xe1, 0x71, 0x1a,
+  0x87, 0xbb, 0xdd, 0x40, 0xa2, 0x15, 0xac, 0xe3, 0x13, 0x95, 0x14, 0xfa,
+  0x45, 0xee, 0x69, 0xc5, 0x29, 0xe8, 0xa1, 0x38, 0xf1, 0xa1, 0x38, 0x49,
+  0x5f, 0x01, 0xb3, 0x16, 0xa0, 0x77, 0xd7, 0x64, 0x7f, 0x03, 0x1a, 0x1d,
+  0xb3, 0x8b, 0x58, 0x6a, 0x78, 0xf2, 0x94, 0x26, 0x97, 0xf4, 0xba, 0xc1,
+  0x28, 0x15, 0xd5, 0xc4, 0xfa, 0xca, 0x93, 0x8f, 0xd5, 0xd4, 0xa9, 0x9a,
+  0x66, 0x23, 0xa7, 0x4e, 0x9c, 0x1c, 0xbb, 0xea, 0x7e, 0x85, 0x2d, 0x92,
+  0x1b, 0xf0, 0xe1, 0x89, 0x21, 0x76, 0x6a, 0x9c, 0x62, 0xf4, 0x08, 0xcd,
+  0x87, 0x38, 0xb5, 0xcd, 0x85, 0xf2, 0xd2, 0xf1, 0x50, 0xa2, 0x29, 0xd9,
+  0x5b, 0xb0, 0xf9, 0x58, 0x46, 0x06, 0x50, 0xcd, 0x29, 0x77, 0xfe, 0x70,
+  0x77, 0xad, 0x6d, 0x35, 0x76, 0xf8, 0xcc, 0x9a, 0x72, 0x9e, 0xb0, 0xb1,
+  0xfb, 0x13, 0x77, 0xb2, 0x9c, 0xab, 0x53, 0xde, 0x32, 0xb7, 0xb2, 0x65,
+  0xf8, 0x78, 0x31, 0xfc, 0x68, 0x8f, 0x66, 0x96, 0x22, 0x2e, 0xf6, 0x08,
+  0x9e, 0x64, 0xdf, 0xa4, 0xc6, 0x0a, 0xaf, 0x78, 0x8f, 0x08, 0x24, 0xb8,
+  0xd7, 0x13, 0xa7, 0xdf, 0x7e, 0xf1, 0xce, 0x9a, 0x6a, 0xea, 0xf6, 0x4f,
+  0x59, 0x9d, 0xdd, 0x7b, 0x39, 0x05, 0x53, 0x33, 0x8d, 0x2c, 0x9a, 0xa9,
+  0x99, 0x47, 0xde, 0xf3, 0xe6, 0xfd, 0x2a, 0x35, 0xe1, 0x5e, 0x15, 0xd9,
+  0x85, 0xaa, 0x95, 0x97, 0xab, 0xd5, 0x1c, 0x24, 0x3b, 0x1f, 0x1c, 0xdb,
+  0xd7, 0x4b, 0xeb, 0x0a, 0x70, 0x74, 0xd1, 0x1c, 0x10, 0x43, 0x90, 0xdb,
+  0x00, 0x7d, 0x2f, 0x59, 0x52, 0x55, 0x9f, 0xb8, 0x45, 0x9f, 0xb8, 0x8e,
+  0x4d, 0xc5, 0xa0, 0x5a, 0xed, 0xa8, 0x5f, 0xe7, 0xc8, 0x71, 0xaf, 0x9d,
+  0x1f, 0xd0, 0x79, 0x38, 0xab, 0xed, 0x1b, 0xff, 0x9b, 0x13, 0xe6, 0xf9,
+  0x7d, 0x11, 0x77, 0x71, 0xad, 0x83, 0xf5, 0x76, 0xa5, 0xe6, 0x93, 0x52,
+  0x0f, 0x12, 0x9d, 0x97, 0xde, 0xbe, 0x60, 0x07, 0x22, 0xd8, 0x70, 0x9c,
+  0x38, 0xf3, 0x8c, 0x78, 0xee, 0x1f, 0x77, 0x9d, 0xf5, 0x18, 0xaa, 0x96,
+  0xb6, 0xe3, 0x32, 0x66, 0x7d, 0x56, 0x51, 0xce, 0xda, 0x24, 0xc9, 0x9b,
+  0x32, 0x73, 0x91, 0x26, 0xbb, 0x84, 0x8c, 0x95, 0x32, 0xfb, 0x72, 0x27,
+  0xaf, 0xff, 0x7c, 0xa8, 0xa4, 0xe5, 0x9c, 0x07, 0x97, 0x96, 0x44, 0x06,
+  0xcb, 0xa5, 0xd5, 0x81, 0x3c, 0x2b, 0x8b, 0x0c, 0xd5, 0xf6, 0x6d, 0x96,
+  0x36, 0xc1, 0x55, 0x7b, 0x85, 0xdb, 0x34, 0x16, 0x40, 0x94, 0x3f, 0x0c,
+  0x28, 0x0c, 0x4a, 0x44, 0xe8, 0x53, 0x2c, 0xf6, 0x93, 0xdb, 0x40, 0x6c,
+  0xb3, 0x30, 0x3d, 0xd8, 0x10, 0x31, 0x5c, 0xe8, 0x3b, 0x17, 0x95, 0x94,
+  0xc1, 0xa2, 0xb4, 0xf4, 0x4e, 0x45, 0x39, 0x8a, 0x86, 0x52, 0xf7, 0x4f,
+  0x71, 0xe1, 0x1b, 0x67, 0x1a, 0x0f, 0x3b, 0x45, 0x7d, 0x4c, 0x31, 0x81,
+  0x8a, 0x09, 0xee, 0xc2, 0x84, 0x8d, 0x4c, 0x2a, 0x4c, 0xf8, 0xc8, 0xe4,
+  0x2f,
+  0xed, 0xda, 0xdb, 0x6e, 0x9b, 0x30, 0x18, 0x00, 0xe0, 0xfb, 0x3d, 0x85,
+  0x1f, 0x00, 0x4d, 0xb6, 0x31, 0xe1, 0x70, 0x97, 0xa4, 0x87, 0x69, 0x53,
+  0x3b, 0x24, 0x26, 0xed, 0xda, 0x80, 0x49, 0xac, 0x12, 0x88, 0x88, 0x51,
+  0x93, 0xb7, 0x9f, 0x39, 0xa5, 0xc1, 0x21, 0x07, 0x92, 0x4e, 0x3d, 0xc1,
+  0x45, 0xfb, 0x3b, 0x11, 0x6e, 0xf8, 0xf2, 0xfb, 0xc7, 0xc6, 0x85, 0x3a,
+  0x2c, 0x8f, 0x10, 0xa2, 0x51, 0x19, 0x98, 0x32, 0xdc, 0x39, 0x34, 0xe2,
+  0xc6, 0x74, 0x03, 0xc6, 0x21, 0x5d, 0x0a, 0x96, 0x69, 0xd4, 0xf1, 0x91,
+  0xe6, 0x3b, 0xbe, 0xae, 0xf9, 0x34, 0x78, 0x72, 0x7c, 0xa2, 0x85, 0xcb,
+  0x30, 0x7d, 0x4e, 0xe4, 0xcb, 0x48, 0x86, 0x31, 0x8b, 0x84, 0x0c, 0xb1,
+  0x0c, 0x33, 0x3e, 0x9b, 0x17, 0xb1, 0x2e, 0xe3, 0x7c, 0x29, 0x03, 0xa8,
+  0x15, 0xef, 0xae, 0xe6, 0x69, 0x1e, 0x87, 0x2c, 0x73, 0xfc, 0x51, 0xd5,
+  0x16, 0xbc, 0xe8, 0x07, 0x91, 0xb2, 0x25, 0xe4, 0x59, 0xb3, 0xe2, 0x4d,
+  0xab, 0x6c, 0xae, 0x1d, 0x5a, 0x9d, 0xb5, 0x71, 0x28, 0xd2, 0xca, 0x1e,
+  0x5f, 0xce, 0x37, 0xeb, 0x17, 0xea, 0x0e, 0x8c, 0xaa, 0xb9, 0xed, 0xc1,
+  0xae, 0xda, 0xb2, 0x0b, 0xbd, 0x8a, 0x64, 0x1f, 0x44, 0x5b, 0x09, 0x9a,
+  0xc9, 0x4f, 0x65, 0x68, 0x6b, 0xc7, 0x87, 0xda, 0xc6, 0xf1, 0xb1, 0xb6,
+  0x8c, 0xa9, 0x88, 0xd2, 0x6c, 0xe1, 0xfc, 0xe5, 0x89, 0xbc, 0x94, 0x95,
+  0xf6, 0x0d, 0x2a, 0x26, 0xf2, 0x07, 0x1d, 0x4c, 0x6a, 0x13, 0x84, 0xac,
+  0x2a, 0xb2, 0x49, 0xcb, 0xc4, 0x13, 0x34, 0xe4, 0x14, 0x4c, 0xd3, 0x44,
+  0x64, 0x69, 0x1c, 0x57, 0x2e, 0xb0, 0x70, 0x41, 0xb5, 0x8b, 0xd5, 0xb8,
+  0xcc, 0xe1, 0x77, 0xd2, 0xc0, 0xc8, 0xd8, 0xda, 0xca, 0xc8, 0x06, 0xae,
+  0x68, 0x64, 0x84, 0xb4, 0x59, 0xce, 0x43, 0xd6, 0xa1, 0x44, 0x76, 0x95,
+  0x46, 0x6d, 0x24, 0xe9, 0x7c, 0x52, 0xc9, 0x68, 0x29, 0x99, 0x0a, 0x12,
+  0x42, 0xc7, 0x94, 0xec, 0x42, 0x09, 0x17, 0x4a, 0xfa, 0x19, 0x4a, 0x04,
+  0xe2, 0xa0, 0xa5, 0x34, 0xbe, 0xf9, 0x83, 0x76, 0x60, 0x7a, 0x82, 0x1c,
+  0x4b, 0x16, 0xbd, 0xe5, 0x40, 0x49, 0xef, 0x64, 0x21, 0x6d, 0x87, 0xe6,
+  0xe2, 0x65, 0x17, 0x78, 0xcb, 0x50, 0xe6, 0x88, 0x5e, 0x5c, 0x3d, 0x39,
+  0x76, 0xf5, 0x23, 0x5c, 0xfe, 0x46, 0x90, 0x9a, 0xad, 0xab, 0x7f, 0xa0,
+  0x9b, 0x28, 0xa6, 0xab, 0x39, 0x78, 0xa0, 0x33, 0x1e, 0x80, 0x47, 0x6f,
+  0x3b, 0x76, 0xf0, 0xb5, 0x39, 0x82, 0x8f, 0xe5, 0x48, 0x9d, 0x41, 0xdb,
+  0xaf, 0x78, 0xd4, 0x37, 0x47, 0x9a, 0x9c, 0xd8, 0xf6, 0x60, 0x76, 0xe0,
+  0xe8, 0xad, 0x1c, 0x81, 0x27, 0x73, 0xa4, 0x51, 0x42, 0x8a, 0x92, 0x9b,
+  0x3e, 0xb3, 0x6c, 0x2c, 0x47, 0x52, 0xc6, 0x80, 0x1b, 0xe7, 0x2b, 0x70,
+  0x4f, 0x17, 0x6c, 0x9a, 0xfb, 0x4c, 0x19, 0x5c, 0x25, 0x1c, 0x7c, 0x73,
+  0xb8, 0x05, 0x5f, 0x05, 0xa8, 0x4c, 0xc0, 0xd7, 0x26, 0xc4, 0x67, 0x13,
+  0xe2, 0x6e, 0xc2, 0xbb, 0x7c, 0xc5, 0xd3, 0x04, 0x3c, 0xf2, 0x44, 0x30,
+  0x79, 0x2a, 0xf0, 0x9e, 0xb9, 0x08, 0xe6, 0xe0, 0xae, 0xf8, 0x6b, 0xc0,
+  0xa5, 0xe1, 0x3b, 0x4a, 0xbf, 0xff, 0xa7, 0x78, 0x7e, 0x22, 0xea, 0xdd,
+  0x8a, 0x2a, 0x5f, 0x47, 0x16, 0x0e, 0x7e, 0x85, 0x1f, 0xe9, 0xf6, 0xf3,
+  0x96, 0x2c, 0x10, 0x19, 0x1d, 0x1c, 0xcf, 0x75, 0x0c, 0x8d, 0xb6, 0xe3,
+  0xe3, 0xe6, 0x29, 0x05, 0x63, 0x9e, 0x45, 0x71, 0x0a, 0x5c, 0x4f, 0x7f,
+  0x9f, 0x70, 0x6f, 0xc6, 0x25, 0x6b, 0x9f, 0xdd, 0xe2, 0x9a, 0xdc, 0x8c,
+  0x25, 0x13, 0xa9, 0xca, 0xdc, 0xf2, 0xad, 0xaa, 0x1c, 0xd5, 0xaf, 0x45,
+  0xa2, 0xa4, 0x73, 0x06, 0x72, 0x11, 0xd2, 0x08, 0xb6, 0x0f, 0xed, 0x4f,
+  0x9a, 0x67, 0x89, 0xbc, 0xaf, 0x26, 0x62, 0x48, 0xa9, 0x7d, 0x2d, 0x75,
+  0x04, 0xfe, 0x76, 0xdd, 0x81, 0xa9, 0x83, 0x29, 0xa0, 0x5d, 0x05, 0xdf,
+  0xcd, 0x52, 0x70, 0xbb, 0x1e, 0x84, 0x20, 0x34, 0x51, 0x1d, 0x6c, 0x57,
+  0x00, 0xe9, 0x8c, 0x16, 0x3e, 0x7b, 0x8b, 0xc3, 0xd1, 0x75, 0x6b, 0xa1,
+  0x16, 0x89, 0xd5, 0x97, 0xc0, 0x3e, 0x56, 0x68, 0xcc, 0x5e, 0x53, 0x51,
+  0xdb, 0x50, 0x86, 0x4e, 0x99, 0x0c, 0x31, 0x17, 0x6c, 0x18, 0x40, 0xfb,
+  0x58, 0x91, 0x8e, 0xf6, 0xb1, 0xd6, 0x60, 0xc1, 0x13, 0x3e, 0x70, 0xed,
+  0x71, 0xd1, 0x50, 0x79, 0x36, 0xf7, 0xde, 0x47, 0x53, 0xc7, 0xf3, 0x93,
+  0x7e, 0xa3, 0x29, 0x30, 0xbb, 0x46, 0xd3, 0x90, 0x20, 0x07, 0xb8, 0x98,
+  0x5a, 0x7c, 0x26, 0x54, 0x76, 0x43, 0x93, 0x19, 0x28, 0x1e, 0x58, 0x7a,
+  0x82, 0x8a, 0x62, 0x39, 0x3c, 0x98, 0xb5, 0xcd, 0x2c, 0x7b, 0x7f, 0x50,
+  0xe1, 0xcf, 0x77, 0x83, 0xb2, 0x50, 0xf5, 0xc0, 0x16, 0x51, 0x65, 0x26,
+  0x7c, 0x0b, 0x7e, 0x71, 0x21, 0x36, 0xd7, 0x27, 0xc3, 0x87, 0x4b, 0x81,
+  0x86, 0xc4, 0x0c, 0xda, 0x75, 0x75, 0x2a, 0xe6, 0x79, 0x3c, 0xcf, 0x3f,
+  0x81, 0x88, 0x71, 0xa1, 0x88, 0xa5, 0xcc, 0xdb, 0x7e, 0x70, 0x31, 0x49,
+  0xd7, 0xe0, 0x36, 0xe4, 0x55, 0x09, 0x79, 0x2d, 0xa0, 0x43, 0xf5, 0xc3,
+  0x68, 0xe3, 0x90, 0x03, 0xcf, 0xae, 0x77, 0xf4, 0x2e, 0xba, 0xce, 0x80,
+  0x45, 0x74, 0xf8, 0xe6, 0x6b, 0x91, 0x6a, 0x0c, 0xf8, 0xca, 0x42, 0x79,
+  0x92, 0x47, 0x11, 0x8d, 0x53, 0x30, 0xf1, 0xee, 0x5d, 0x34, 0x82, 0x08,
+  0x78, 0x2c, 0xe3, 0x6c, 0x55, 0x08, 0x19, 0xbb, 0xbb, 0x5e, 0xe5, 0x06,
+  0xd7, 0x15, 0x44, 0xd6, 0x95, 0x44, 0xf6, 0x15, 0xe5, 0x02, 0xe9, 0x85,
+  0x11, 0x39, 0xb9, 0xf7, 0xd5, 0x18, 0x31, 0xc5, 0x88, 0x37, 0x48, 0xe3,
+  0x29, 0xc4, 0x60, 0x9c, 0x05, 0x34, 0x64, 0xe0, 0x67, 0xba, 0x29, 0x3f,
+  0xcc, 0xde, 0x9d, 0xc4, 0x7e, 0xcd, 0x6d, 0x1f, 0x05, 0xca, 0x3c, 0x0d,
+  0x85, 0x8f, 0x43, 0xe9, 0xc7, 0x72, 0xc9, 0xda, 0x3a, 0x19, 0xe7, 0x38,
+  0x45, 0x87, 0x9c, 0xca, 0x64, 0xc2, 0x90, 0xec, 0x24, 0x13, 0xbe, 0x6a,
+  0xab, 0xb0, 0x07, 0x51, 0xff, 0x9d, 0x31, 0x95, 0xc8, 0x38, 0x79, 0xeb,
+  0x29, 0xb7, 0xc8, 0xe0, 0x19, 0x44, 0x08, 0x9e, 0x22, 0x72, 0xbf, 0xae,
+  0x91, 0x0d, 0xab, 0x9b, 0x11, 0x56, 0x9f, 0xdd, 0x3d, 0xf3, 0xc4, 0x9b,
+  0xa7, 0xc1, 0x93, 0x5c, 0x02, 0x60, 0x65, 0x3a, 0xfb, 0x21, 0x89, 0x5e,
+  0xd6, 0x49, 0xf8, 0x32, 0x22, 0x59, 0x98, 0xa3, 0xf6, 0x3a, 0xa9, 0x73,
+  0xbe, 0xbf, 0xfb, 0x2f, 0x0b, 0x5f, 0x0c, 0xaa, 0x9e, 0xee, 0x23, 0xa3,
+  0xd7, 0x4e, 0x61, 0x5d, 0xca, 0xbd, 0xa6, 0x8e, 0x7f, 0xdd, 0x4d, 0x9a,
+  0x7f,
+  0xed, 0x99, 0x5d, 0x77, 0xa2, 0x38, 0x18, 0x80, 0xef, 0xf7, 0x57, 0xe4,
+  0x5e, 0xba, 0x27, 0x1f, 0x80, 0xc0, 0x9d, 0xd3, 0x69, 0xdd, 0xee, 0xec,
+  0xcc, 0xf1, 0x8c, 0x7b, 0x66, 0x7b, 0x1b, 0x20, 0x28, 0xa7, 0x6a, 0x3c,
+  0x10, 0x4f, 0xeb, 0xfe, 0xfa, 0x4d, 0x42, 0xa0, 0x82, 0x8a, 0x58, 0x69,
+  0x67, 0x66, 0x3b, 0xde, 0x90, 0xa0, 0x86, 0xbc, 0xcf, 0xfb, 0x99, 0x17,
+  0x48, 0xa0, 0xfe, 0xc4, 0xb1, 0x8b, 0xd5, 0x15, 0xb9, 0x74, 0x08, 0x77,
+  0x3e, 0xd6, 0x84, 0x3f, 0xb2, 0x6c, 0x04, 0x6e, 0x37, 0x79, 0xca, 0x57,
+  0x60, 0x92, 0x71, 0xf0, 0x25, 0x5d, 0x09, 0xb6, 0x8a, 0x39, 0x98, 0x3e,
+  0xa6, 0x22, 0x9a, 0x83, 0x6b, 0xbe, 0x12, 0x19, 0x5f, 0x2c, 0x58, 0x66,
+  0xd1, 0x20, 0x44, 0x56, 0x18, 0x84, 0xd8, 0x0a, 0x69, 0xf4, 0x10, 0x84,
+  0x9e, 0x15, 0xaf, 0x63, 0xfe, 0xb8, 0x0a, 0xe6, 0xf0, 0x77, 0x5b, 0x8e,
+  0x17, 0x2c, 0x11, 0x6a, 0xac, 0xee, 0x67, 0xe9, 0x6c, 0xae, 0x27, 0x58,
+  0x4e, 0x36, 0x6b, 0x35, 0x42, 0xd6, 0x6c, 0x93, 0xc6, 0x4c, 0x2e, 0x82,
+  0x2d, 0xf5, 0xd3, 0x7c, 0xce, 0x37, 0x8b, 0x98, 0x65, 0x41, 0x68, 0x17,
+  0x73, 0x91, 0xaa, 0x55, 0x11, 0xd4, 0x33, 0x21, 0x57, 0x98, 0xa9, 0x2f,
+  0x5d, 0x3d, 0x7d, 0x0a, 0x68, 0x71, 0x7f, 0x1b, 0x50, 0x64, 0x2d, 0xd3,
+  0x3c, 0x42, 0xf2, 0xa7, 0xc4, 0xd2, 0xcf, 0x79, 0x5e, 0xc9, 0x31, 0x37,
+  0xcc, 0x52, 0xa8, 0x98, 0x56, 0x6b, 0x0d, 0x8b, 0xb9, 0x5c, 0x0c, 0x17,
+  0x23, 0xb9, 0x1a, 0xb1, 0x72, 0x41, 0x33, 0x11, 0x84, 0xbe, 0xf5, 0x14,
+  0x84, 0xd0, 0xda, 0x06, 0x21, 0xb1, 0xd6, 0x0b, 0x2a, 0x12, 0x9e, 0x2d,
+  0x83, 0x7f, 0x52, 0xc9, 0xe2, 0x31, 0xb7, 0x7e, 0x83, 0x25, 0x4a, 0x86,
+  0x3d, 0x75, 0x4d, 0x22, 0x84, 0x6a, 0x28, 0xa7, 0x82, 0xd1, 0x25, 0xf8,
+  0x96, 0x66, 0x62, 0x43, 0x17, 0x60, 0x4c, 0x97, 0x6c, 0x4d, 0x63, 0xc5,
+  0x0c, 0x2a, 0x66, 0xc8, 0x30, 0x73, 0xcf, 0x65, 0xd6, 0x42, 0xca, 0xaf,
+  0x81, 0xa2, 0xf8, 0x00, 0xa8, 0x76, 0x3c, 0xb0, 0x8e, 0x87, 0x3a, 0x15,
+  0x1e, 0x52, 0xe1, 0xb1, 0x4b, 0x3c, 0x43, 0x85, 0x07, 0x77, 0xc6, 0x93,
+  0x7c, 0x77, 0x3c, 0x5e, 0x0d, 0xcf, 0xe0, 0x7c, 0x3e, 0x7e, 0x1d, 0xcf,
+  0x55, 0x69, 0x34, 0x97, 0xf0, 0x61, 0x04, 0x3a, 0xea, 0xea, 0xbb, 0xc5,
+  0xf5, 0xd9, 0x13, 0x17, 0x74, 0x3b, 0x15, 0x54, 0x28, 0x3f, 0x1c, 0xc5,
+  0x74, 0x2d, 0x0a, 0x87, 0xc3, 0xbb, 0x74, 0xfc, 0xcb, 0xe8, 0xb8, 0x6d,
+  0x6e, 0x66, 0x9f, 0xa6, 0x33, 0x6c, 0x77, 0x2e, 0xa7, 0xcd, 0xb9, 0x3c,
+  0x45, 0x87, 0x28, 0x3a, 0xb0, 0x8d, 0x8e, 0x0d, 0xa9, 0x1e, 0x60, 0x58,
+  0x8f, 0x53, 0x7f, 0xd3, 0x54, 0x70, 0x70, 0x33, 0xcb, 0x98, 0x00, 0x77,
+  0x77, 0xe0, 0x73, 0xba, 0x4a, 0x1b, 0x91, 0xc9, 0xde, 0x8d, 0x4c, 0x95,
+  0x19, 0x0d, 0xa4, 0x14, 0x86, 0xd3, 0x95, 0x94, 0xac, 0xc4, 0x34, 0xd0,
+  0x63, 0x49, 0xe9, 0x8a, 0x56, 0x51, 0xc9, 0x6f, 0x8a, 0xdb, 0xf0, 0x0e,
+  0xa9, 0x85, 0x5d, 0x4d, 0x7b, 0x27, 0x35, 0x6d, 0x23, 0xad, 0x61, 0x04,
+  0x49, 0x52, 0x93, 0xe5, 0x03, 0x95, 0xcb, 0xd0, 0xd5, 0xec, 0x0d, 0x8d,
+  0xbf, 0xd4, 0xf6, 0xcb, 0x8d, 0xbf, 0x52, 0xf7, 0x45, 0xc6, 0xef, 0x41,
+  0xbb, 0x18, 0x51, 0x58, 0x0f, 0x0e, 0x74, 0x99, 0x6f, 0x56, 0x33, 0x70,
+  0x73, 0x37, 0x9e, 0x60, 0xb8, 0x07, 0x06, 0xc1, 0x3e, 0x0c, 0xbf, 0x8b,
+  0x6d, 0x1f, 0x96, 0x4e, 0xca, 0x5e, 0x5a, 0xaf, 0xdd, 0x2a, 0x9e, 0x4e,
+  0xb2, 0x50, 0xba, 0xb6, 0x57, 0x13, 0xef, 0x5a, 0x1a, 0xd8, 0x03, 0x07,
+  0xa3, 0x4f, 0xd0, 0x0b, 0xf7, 0x9c, 0xda, 0xeb, 0x51, 0xeb, 0x5d, 0x72,
+  0x67, 0xdf, 0x19, 0xf3, 0xb4, 0x53, 0x87, 0xe5, 0xa8, 0xfe, 0xb1, 0xbe,
+  0xb0, 0x71, 0x54, 0x8b, 0x76, 0xb4, 0x00, 0x43, 0x4a, 0x22, 0xda, 0x23,
+  0x34, 0x0f, 0xb9, 0x8f, 0x92, 0x86, 0xdc, 0xb1, 0x66, 0x61, 0x24, 0xaf,
+  0x92, 0x57, 0x15, 0xc0, 0xd0, 0xbe, 0xe5, 0x9a, 0xfd, 0x12, 0x4b, 0xeb,
+  0x77, 0xab, 0x4b, 0x90, 0x96, 0x0d, 0x27, 0x26, 0x36, 0x37, 0xb6, 0x6d,
+  0xdd, 0xc9, 0xd2, 0x28, 0x1b, 0x45, 0x02, 0x8c, 0x9e, 0xd2, 0x7c, 0x52,
+  0xa4, 0x2f, 0xbd, 0x65, 0xd2, 0x93, 0xa1, 0xb6, 0xb9, 0xb0, 0x7b, 0xa9,
+  0x07, 0x1f, 0x32, 0x71, 0x5c, 0x37, 0x71, 0x5d, 0xfd, 0xa0, 0x16, 0x34,
+  0x09, 0xc4, 0x1a, 0x0d, 0x46, 0x51, 0x3d, 0xbd, 0x8f, 0x53, 0x2e, 0x58,
+  0xf4, 0x00, 0x26, 0x53, 0xd2, 0x08, 0xcc, 0xef, 0xcb, 0xd8, 0x4b, 0x40,
+  0xe4, 0x17, 0xa0, 0x76, 0x40, 0x11, 0xf2, 0xc8, 0xd1, 0x02, 0xe8, 0x87,
+  0x3c, 0x74, 0xbc, 0xf9, 0x51, 0xa3, 0x42, 0x85, 0x1b, 0xa8, 0x2a, 0x5b,
+  0x3a, 0x8a, 0xec, 0x32, 0x9b, 0xfa, 0x61, 0x91, 0x75, 0xb7, 0x2e, 0x72,
+  0x04, 0xd9, 0xb7, 0x7b, 0xfc, 0x6a, 0xd8, 0x7e, 0x5a, 0x58, 0xf6, 0x2f,
+  0x58, 0xa7, 0x61, 0x0d, 0x65, 0x5d, 0x57, 0xd4, 0xf3, 0x8d, 0x2a, 0xc6,
+  0xb5, 0x8b, 0x12, 0x86, 0xa7, 0xb1, 0x35, 0x30, 0xcf, 0x91, 0x70, 0x06,
+  0xe6, 0x41, 0x12, 0xd1, 0x55, 0x79, 0xd7, 0x36, 0xc3, 0xad, 0xda, 0x71,
+  0x59, 0xe5, 0x3e, 0x97, 0x3b, 0xa8, 0x3a, 0xac, 0x28, 0xdf, 0xab, 0x0a,
+  0x1e, 0x5d, 0x10, 0xa9, 0x8a, 0xc7, 0x80, 0x69, 0x16, 0xb6, 0x95, 0x98,
+  0x7e, 0x97, 0x3a, 0xb7, 0x3a, 0x90, 0xb5, 0xc8, 0xea, 0x19, 0x59, 0x21,
+  0xad, 0x1b, 0xc6, 0xc7, 0x11, 0xf8, 0x8b, 0xd1, 0xb8, 0xd0, 0xff, 0x50,
+  0x6d, 0xde, 0xed, 0xa9, 0xf2, 0x81, 0x6d, 0x87, 0x97, 0xd3, 0x62, 0xe1,
+  0xd6, 0xca, 0x87, 0xb4, 0xa9, 0x5f, 0x92, 0xd6, 0x9a, 0xd1, 0x3a, 0xe9,
+  0xc0, 0x04, 0x35, 0x98, 0xdc, 0xa6, 0x19, 0xcb, 0x85, 0xfc, 0x8f, 0x62,
+  0xe2, 0x2b, 0x26, 0xc3, 0x1e, 0x51, 0x34, 0x7d, 0xe1, 0x6c, 0x16, 0x7b,
+  0xbe, 0xd0, 0x10, 0xdc, 0x3b, 0x75, 0xaa, 0x49, 0x3c, 0xac, 0x4d, 0x1e,
+  0xf9, 0x0d, 0xc3, 0x9f, 0xce, 0xf9, 0x6c, 0xb3, 0x02, 0x1f, 0x32, 0x9e,
+  0x83, 0xeb, 0x39, 0x5d, 0xb2, 0x05, 0x93, 0x31, 0xe2, 0x1e, 0xbd, 0x4e,
+  0xdb, 0xe2, 0x05, 0x8d, 0x8a, 0x3e, 0x3b, 0x13, 0x92, 0x82, 0xee, 0x48,
+  0x84, 0x09, 0x0c, 0x6b, 0x14, 0xbe, 0xd2, 0x7f, 0x59, 0x06, 0x3e, 0xa5,
+  0xf9, 0x3c, 0x55, 0x82, 0xbb, 0x85, 0x01, 0x18, 0xa7, 0x70, 0x5f, 0x9a,
+  0x79, 0xbd, 0x06, 0x83, 0x32, 0x15, 0x1b, 0x9d, 0xfa, 0x0d, 0xa3, 0xe8,
+  0xc0, 0xa4, 0xea, 0x95, 0x16, 0x4b, 0xe0, 0xbd, 0xee, 0x46, 0x6b, 0xf3,
+  0x0f, 0xe9, 0x03, 0xbe, 0xaf, 0x8f, 0x07, 0xad, 0x98, 0xa8, 0x31, 0x93,
+  0x32, 0x5a, 0x56, 0x0d, 0x1c, 0xd5, 0xfd, 0x73, 0xde, 0x61, 0xda, 0x30,
+  0x40, 0x12, 0x98, 0xd4, 0xbb, 0x40, 0xf2, 0x18, 0xa9, 0x52, 0xec, 0x68,
+  0xfc, 0x27, 0x20, 0x18, 0xc2, 0xf7, 0x48, 0x06, 0xc7, 0x07, 0x13, 0x2a,
+  0x89, 0xbf, 0x6e, 0x62, 0xb9, 0x09, 0x70, 0xcb, 0xb9, 0x00, 0x9f, 0x79,
+  0xb3, 0xf4, 0x38, 0xb2, 0xf7, 0xa7, 0xaa, 0x7f, 0xad, 0xcf, 0xb5, 0x2d,
+  0x0f, 0x8e, 0x4c, 0x17, 0x0a, 0x3b, 0xf5, 0x07, 0xdf, 0xd0, 0x7c, 0x0b,
+  0xc6, 0x59, 0xba, 0xde, 0x6b, 0x40, 0x79, 0xbd, 0x46, 0xb0, 0x61, 0x67,
+  0xfc, 0xd5, 0x5f, 0xf0, 0x3e, 0xdb, 0xd6, 0x98, 0x1d, 0x97, 0xdd, 0x65,
+  0x72, 0xa0, 0x83, 0x41, 0x23, 0x01, 0xc6, 0xdc, 0xf4, 0x2f, 0x88, 0x92,
+  0xd3, 0xbe, 0x78, 0xc3, 0x78, 0x2f, 0xe4, 0x76, 0x6a, 0x27, 0x94, 0xfb,
+  0xc4, 0xe4, 0xff, 0xd9, 0x69, 0x79, 0xf6, 0x0e, 0xe7, 0xdc, 0x4e, 0x8b,
+  0x41, 0x83, 0x29, 0x76, 0x0f, 0xa3, 0xf9, 0x83, 0x2e, 0x97, 0x2c, 0x9b,
+  0xcb, 0x7a, 0x0c, 0xdc, 0xde, 0xef, 0xa8, 0xb2, 0xcf, 0x9e, 0x69, 0x25,
+  0x92, 0x77, 0x7e, 0xd6, 0xf5, 0xfb, 0xa4, 0x90, 0x74, 0xa6, 0xa0, 0x5f,
+  0x04, 0x38, 0x3f, 0x13, 0x05, 0xa4, 0x28, 0xe0, 0x0e, 0x14, 0x88, 0x0f,
+  0xf1, 0x29, 0x0a, 0x3b, 0x86, 0xd0, 0xdf, 0xcb, 0x22, 0xdc, 0xc4, 0xd0,
+  0xfa, 0x66, 0xc8, 0xd9, 0x43, 0x50, 0x8a, 0x0b, 0xcf, 0x52, 0xba, 0x43,
+  0x8e, 0x89, 0x3b, 0xc9, 0x1a, 0xe1, 0xeb, 0x8d, 0xc3, 0xf3, 0x0b, 0xa3,
+  0x9d, 0xa9, 0x00, 0xa2, 0x10, 0x36, 0xde, 0x8d, 0xf2, 0xd5, 0xb6, 0x76,
+  0xd0, 0x9e, 0xf0, 0x4c, 0xd0, 0x70, 0xc1, 0x5e, 0xe7, 0x15, 0xd1, 0x89,
+  0xc8, 0xd6, 0xe9, 0x95, 0xce, 0x7f,
+  0xd5, 0x94, 0x4d, 0x6e, 0xc2, 0x30, 0x10, 0x85, 0xf7, 0x3d, 0x85, 0x0f,
+  0x60, 0x55, 0x76, 0x1c, 0x27, 0xe0, 0x25, 0x45, 0x91, 0x5a, 0x09, 0x15,
+  0x15, 0xf5, 0x67, 0x6b, 0x43, 0x02, 0x51, 0x8d, 0x8d, 0x1c, 0x47, 0x85,
+  0xdb, 0xd7, 0x4e, 0xd2, 0x34, 0x0d, 0x08, 0x8a, 0x4a, 0x17, 0xcc, 0x26,
+  0xf3, 0xc6, 0x99, 0x91, 0xde, 0xa7, 0xd1, 0x20, 0x82, 0xaa, 0xc8, 0x32,
+  0x8c, 0xfd, 0x97, 0x60, 0xd2, 0x54, 0xea, 0x80, 0xe3, 0x92, 0xcb, 0x44,
+  0x9b, 0x79, 0x0a, 0x39, 0x13, 0x01, 0x14, 0x4c, 0x10, 0x28, 0xf8, 0xfc,
+  0x9d, 0x89, 0x01, 0x5c, 0x6c, 0x16, 0xfa, 0x43, 0xb1, 0x15, 0xba, 0x0d,
+  0x5d, 0x2e, 0xd3, 0xcc, 0xfa, 0xdc, 0xd7, 0x4d, 0xbe, 0x5c, 0x55, 0x22,
+  0x70, 0xa2, 0xdc, 0xf8, 0x0c, 0x43, 0xff, 0x43, 0xb1, 0xd2, 0xa5, 0x5c,
+  0xa4, 0x86, 0x89, 0xb0, 0xd6, 0x36, 0xf7, 0xb3, 0x30, 0xaa, 0x94, 0x75,
+  0x7d, 0x4b, 0xff, 0x18, 0x55, 0x72, 0xcb, 0x78, 0x5d, 0xdf, 0x31, 0x8e,
+  0x61, 0x35, 0xf3, 0xbb, 0x9f, 0x36, 0x85, 0x66, 0x40, 0xf3, 0xde, 0x4e,
+  0x88, 0x6b, 0xed, 0x46, 0x04, 0x75, 0xe6, 0x66, 0x84, 0xb0, 0xb0, 0xdc,
+  0x58, 0x26, 0x86, 0x70, 0xcb, 0x04, 0x82, 0x3b, 0xd7, 0x07, 0x37, 0x92,
+  0xdb, 0x4c, 0x9b, 0x35, 0x7b, 0xcd, 0x95, 0xb3, 0x53, 0xc0, 0x1b, 0xd4,
+  0x63, 0x12, 0xa2, 0x1e, 0x93, 0x87, 0xe9, 0x18, 0x24, 0xc9, 0xa8, 0x25,
+  0x82, 0xaf, 0x96, 0x48, 0xf0, 0x45, 0x04, 0x53, 0x8f, 0x84, 0x78, 0x24,
+  0xe8, 0x37, 0x48, 0xfa, 0x6b, 0xf2, 0x3c, 0x1b, 0x81, 0x3b, 0xad, 0xac,
+  0xd1, 0x52, 0xa6, 0xe6, 0xd2, 0x64, 0xa2, 0x63, 0x64, 0xc2, 0xd3, 0x64,
+  0xe2, 0xe3, 0x64, 0x68, 0x4b, 0x26, 0xdc, 0x27, 0x33, 0x3c, 0x0f, 0x4c,
+  0xdc, 0x03, 0xf3, 0xc4, 0xd7, 0x7a, 0x0b, 0x92, 0xe9, 0xec, 0x1f, 0xf1,
+  0x5c, 0x68, 0x71, 0x3a, 0x9b, 0x72, 0xa6, 0xf7, 0x2c, 0x43, 0x07, 0x02,
+  0x4e, 0xf4, 0xbc, 0xb4, 0x29, 0x98, 0x20, 0x4a, 0xbc, 0x65, 0xe2, 0x2d,
+  0x07, 0x8d, 0xe5, 0xe1, 0xdf, 0x2c, 0x63, 0xdc, 0xf5, 0x1c, 0xff, 0xb4,
+  0x4c, 0x4f, 0x5b, 0x76, 0x94, 0xba, 0x2b, 0x11, 0xf5, 0x08, 0x84, 0xed,
+  0x46, 0x90, 0xfd, 0xeb, 0x31, 0xf0, 0x54, 0xf0, 0x31, 0x2a, 0x14, 0x91,
+  0x68, 0x40, 0x03, 0x7c, 0x90, 0x4a, 0x92, 0x2b, 0x2e, 0x41, 0xc2, 0x95,
+  0xe5, 0xc5, 0x0e, 0xbc, 0xdd, 0xbf, 0x80, 0x47, 0x25, 0x73, 0x95, 0xf6,
+  0x16, 0x04, 0x77, 0x69, 0x5d, 0xdf, 0x65, 0x21, 0xfb, 0xb7, 0x96, 0x1c,
+  0xa0, 0xf5, 0x09,
+};
+static const struct gcdb_chunk_s gcdb_chunks[] = {
+	{ "0300000000050000289b000000000000", 0, 981, 7058 },
+	{ "030000000d0f00001110000000000000", 981, 709, 8797 },
+	{ "030000000d0f00006e00000000000000", 1690, 816, 8909 },
+	{ "03000000100800000300000000000000", 2506, 796, 8753 },
+	{ "03000000120c0000a957000000000000", 3302, 964, 8716 },
+	{ "03000000242f000000b7000000000000", 4266, 989, 8263 },
+	{ "03000000300f00001001000000000000", 5255, 1017, 8618 },
+	{ "03000000341a00002308000000000000", 6272, 863, 8680 },
+	{ "03000000380700008034000000000000", 7135, 1065, 8917 },
+	{ "030000004b120000014d000000000000", 8200, 1028, 8703 },
+	{ "030000005509000000b4000000000000", 9228, 924, 8021 },
+	{ "030000005e040000fd02000000000000", 10152, 900, 9218 },
+	{ "030000006d04000018c2000000000000", 11052, 746, 8777 },
+	{ "030000006f0e00001413000000000000", 11798, 860, 9054 },
+	{ "03000000790000001a18000000000000", 12658, 1111, 8074 },
+	{ "03000000808300000300000000000000", 13769, 1045, 7816 },
+	{ "030000008f0e00001411000000000000", 14814, 1017, 7149 },
+	{ "03000000a30600000701000000000000", 15831, 875, 8530 },
+	{ "03000000ad1b000023f0000000000000", 16706, 1030, 8571 },
+	{ "03000000bd12000003c0000000000000", 17736, 944, 8458 },
+	{ "03000000c82d00000030000000000000", 18680, 622, 8397 },
+	{ "03000000c82d00001130000000000000", 19302, 769, 8176 },
+	{ "03000000d0160000070d000000000000", 20071, 925, 9256 },
+	{ "03000000dd62000016a7000000000000", 20996, 1182, 8282 },
+	{ "03000000ff1100003133000000000000", 22178, 363, 1664 },
 };
-const unsigned long gcdb_bin_len = 13756;
-const unsigned long gcdb_txt_len = 205123;
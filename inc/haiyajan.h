@@ -17,11 +17,16 @@
 #include <SDL.h>
 
 #include <font.h>
+#include <audio.h>
+#include <coreinfo.h>
+#include <fmap.h>
 #include <gl.h>
 #include <input.h>
 #include <libretro.h>
 #include <retro-extensions.h>
 #include <rec.h>
+#include <recpipe.h>
+#include <rewind.h>
 #include <tai.h>
 #include <timer.h>
 #include <ui.h>
@@ -35,10 +40,32 @@ struct settings_s
 	Uint8 fullscreen : 1;
 	Uint8 benchmark : 1;
 	Uint8 start_core : 1;
+	Uint8 rec_direct_io : 1;
+	Uint8 preload : 1;
 	Uint8 frameskip_limit;
+
+	/* Directory of cores to scan, or NULL if not scanning. */
+	const char *scan_dir;
 	Uint32 benchmark_dur;
+
+	/* Target audio latency in milliseconds. 0 for default. */
+	Uint32 audio_latency_ms;
+	resample_quality_e audio_quality;
+
+	/* Milliseconds to wait after VSYNC before running the core. Negative
+	 * for automatic. */
+	int frame_delay_ms;
 	char *core_filename;
 	char *content_filename;
+
+	/* Outputs for raw video and audio recording. NULL if unused. */
+	const char *rec_y4m_path;
+	const char *rec_pcm_path;
+
+	/* Size of the rewind buffer in MiB, 0 to disable rewinding, and the
+	 * number of frames between each state. */
+	Uint32 rewind_mib;
+	Uint32 rewind_interval;
 };
 
 /**
@@ -99,9 +126,13 @@ struct core_ctx_s
 		void *handle;
 
 		/* For cores which require the content to be loaded into memory.
-		 * This is an allocated buffer of content for libretro cores. */
+		 * This is an allocated buffer of content decompressed from an
+		 * archive. */
 		Uint8 *game_data;
 
+		/* Otherwise, content is mapped into memory. */
+		fmap_ctx *game_map;
+
 		/* The texture that the libretro core renders to. */
 		SDL_Texture *core_tex;
 
@@ -112,8 +143,8 @@ struct core_ctx_s
 		/* The resolution of the drawn frame. x and y must be 0. */
 		SDL_Rect game_frame_res;
 
-		/* The context of the audio device. */
-		SDL_AudioDeviceID audio_dev;
+		/* Audio output. NULL if audio could not be initialised. */
+		audio_ctx *audio;
 
 		/* OpenGL context for Libretro Cores. */
 		gl_ctx *gl;
@@ -128,6 +159,28 @@ struct core_ctx_s
 	char *content_filename;
 	char *sram_filename;
 
+	/* Hash of SRAM when it was last saved, used to detect changes.
+	 * Written by the background save whilst sram_saving is set. */
+	Uint64 sram_hash;
+
+	/* Non-zero whilst SRAM is being saved in the background. */
+	SDL_atomic_t sram_saving;
+
+	/* Flags from fmap_flags_e used to map content into memory. */
+	unsigned content_map_flags;
+
+	/* Content being read in the background. NULL once given to the
+	 * core. */
+	struct load_content_s *content_load;
+
+	/* Disk images of content given as a playlist that the core does not
+	 * support. NULL if content is not a playlist. */
+	struct disk_s *disks;
+
+	/* Save state buffers. NULL until a state is first saved or
+	 * loaded. */
+	struct state_s *state;
+
 	/* Libretro core environment status. */
 	struct
 	{
@@ -144,6 +197,19 @@ struct core_ctx_s
 				Uint8 video_disabled : 1;
 				Uint8 valid_frame : 1;
 				Uint8 support_no_game : 1;
+
+				/* Set when the last frame is identical to the
+				 * frame before it. */
+				Uint8 dupe_frame : 1;
+
+				/* Set when the audio callback of the core is
+				 * called by the audio producer thread. */
+				Uint8 audio_thread : 1;
+
+				/* Set when input events are read when the
+				 * core polls for input, instead of only once
+				 * before each frame. */
+				Uint8 late_input : 1;
 			} bits;
 			Uint16 all;
 		} status;
@@ -153,9 +219,17 @@ struct core_ctx_s
 		Uint32 frames;
 		SDL_RendererFlip flip;
 
+		/* Hash of the last frame. Only calculated whilst recording. */
+		Uint64 frame_hash;
+
 		struct retro_audio_callback audio_cb;
+		retro_audio_buffer_status_callback_t audio_status_cb;
 		retro_frame_time_callback_t ftcb;
 		retro_usec_t ftref;
+
+		/* Disk control interface of the core. Functions are NULL if
+		 * unsupported. */
+		struct retro_disk_control_ext_callback disk_cb;
 	} env;
 
 	struct timer_ctx_s tim;
@@ -164,6 +238,9 @@ struct core_ctx_s
 #if ENABLE_VIDEO_RECORDING == 1
 	rec_ctx *vid;
 #endif
+
+	/* Raw recording to an external encoder. */
+	recpipe_ctx *pipe;
 };
 
 struct haiyajan_ctx_s
@@ -183,6 +260,9 @@ struct haiyajan_ctx_s
 	/* Libretro core context. */
 	struct core_ctx_s core;
 
+	/* Cache of core information. NULL if unavailable. */
+	coreinfo_ctx *coreinfo;
+
 	/* User interface context. */
 	ui *ui;
 	ui_overlay_ctx *ui_overlay;
@@ -193,6 +273,20 @@ struct haiyajan_ctx_s
 	/* Tool assist context. */
 	tai *tai;
 
+	/* Save state slot selected by the user. */
+	unsigned state_slot;
+
+	/* Rewind buffer. NULL if rewinding is disabled. */
+	rewind_ctx *rewind;
+
 	Uint8 quit : 1;
+
+	/* Set whilst the rewind button is held. */
+	Uint8 rewinding : 1;
+
+	/* Set once a raw recording to an inherited file descriptor has
+	 * finished. The descriptor is not recorded to again, as the reader
+	 * would otherwise receive a second header within the same stream. */
+	Uint8 recpipe_fd_ended : 1;
 };
 
@@ -52,7 +52,20 @@ typedef enum {
 	INPUT_EVENT_TOGGLE_INFO = 0,
 	INPUT_EVENT_TOGGLE_FULLSCREEN,
 	INPUT_EVENT_TAKE_SCREENSHOT,
-	INPUT_EVENT_RECORD_VIDEO_TOGGLE
+	INPUT_EVENT_RECORD_VIDEO_TOGGLE,
+	INPUT_EVENT_DISK_EJECT_TOGGLE,
+	INPUT_EVENT_DISK_NEXT,
+	INPUT_EVENT_STATE_SAVE,
+	INPUT_EVENT_STATE_LOAD,
+	INPUT_EVENT_STATE_SLOT_PREV,
+	INPUT_EVENT_STATE_SLOT_NEXT,
+	INPUT_EVENT_STATE_QUICK_SAVE,
+	INPUT_EVENT_STATE_QUICK_LOAD,
+
+	/* Sent when the rewind button is pressed, and again with
+	 * INPUT_EVENT_REWIND_RELEASE when it is released. */
+	INPUT_EVENT_REWIND,
+	INPUT_EVENT_REWIND_RELEASE
 } input_cmd_event_codes_e;
 
 /* Libretro joypad input as an enum for improved type tracking. */
@@ -184,7 +197,9 @@ struct input_ctx_s
 /**
  * Range of events that can be handled by input_handle_event().
  */
-#define INPUT_EVENT_CHK(x) (x >= 0x300 && x < 0x900)
+#define INPUT_EVENT_MIN		0x300
+#define INPUT_EVENT_MAX		0x8FF
+#define INPUT_EVENT_CHK(x) (x >= INPUT_EVENT_MIN && x <= INPUT_EVENT_MAX)
 
 /**
  * Initialise input system.
@@ -211,6 +226,15 @@ void input_add_controller(struct input_ctx_s *ctx, unsigned port,
  */
 void input_handle_event(struct input_ctx_s *const in_ctx, const SDL_Event *ev);
 
+/**
+ * Capture the state of all connected game controllers. input_get() returns
+ * the state captured by the last call to this function, such that a core
+ * querying every button of every port does not query SDL each time.
+ *
+ * \param in_ctx	Input struct context.
+ */
+void input_poll(struct input_ctx_s *const in_ctx);
+
 /**
  * Obtain input.
  *
@@ -218,7 +242,8 @@ void input_handle_event(struct input_ctx_s *const in_ctx, const SDL_Event *ev);
  * \param port		Port the controller is attached to.
  * \param device	Type of device that is connect to the port.
  * \param index		The series of buttons that is requested.
- * \param id		The button requested.
+ * \param id		The button requested, or RETRO_DEVICE_ID_JOYPAD_MASK
+ *			to obtain all joypad buttons as a bitmask.
  * \return		Value of requested button. 0 is not pressed.
  */
 Sint16 input_get(const struct input_ctx_s *const in_ctx,
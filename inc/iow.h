@@ -0,0 +1,142 @@
+/**
+ * Buffered asynchronous file writer.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#pragma once
+
+#include <SDL.h>
+
+/**
+ * Writes are copied into one of a small number of large aligned buffers. Once
+ * a buffer is full, it is handed to a background thread which writes it to the
+ * file whilst the caller continues filling the next buffer. The caller only
+ * waits when every buffer is waiting to be written, which is counted as a
+ * stall.
+ *
+ * Except for iow_tell() and iow_get_stats(), functions in this file must only
+ * be called by a single thread per context.
+ */
+typedef struct iow_s iow_ctx;
+
+enum iow_flags_e {
+	IOW_FLAG_NONE = 0,
+
+	/* Bypass the page cache with O_DIRECT where supported. Only whole
+	 * buffers are written this way; the final partial buffer is written
+	 * through the page cache. Ignored on unsupported platforms. */
+	IOW_FLAG_DIRECT = (1 << 0),
+
+	/* Advise the kernel that written data will not be read again, so that
+	 * recordings do not evict the page cache. Ignored on unsupported
+	 * platforms. */
+	IOW_FLAG_NOCACHE = (1 << 1),
+
+	/* Discard data rather than wait when every buffer is waiting to be
+	 * written. This is intended for pipes to other processes, which must
+	 * not be able to stall the caller. Discarded data is counted as a
+	 * drop. */
+	IOW_FLAG_NONBLOCK = (1 << 2)
+};
+
+struct iow_stats_s {
+	/* Number of bytes given to iow_write(). */
+	Uint64 bytes_queued;
+
+	/* Number of bytes written to the file. */
+	Uint64 bytes_written;
+
+	/* Number of buffers written, and the time taken to write them. */
+	Uint32 flushes;
+	Uint64 flush_us;
+
+	/* Number of times the caller had to wait for a free buffer, and the
+	 * total time spent waiting. */
+	Uint32 stalls;
+	Uint64 stall_us;
+
+	/* Number of writes discarded due to IOW_FLAG_NONBLOCK, and their total
+	 * size. */
+	Uint32 drops;
+	Uint64 bytes_dropped;
+};
+
+/**
+ * Open a file for buffered writing. The file is truncated if it exists.
+ *
+ * A filename of the form "fd:N" writes to the already open file descriptor N
+ * instead, where supported. A duplicate of N is written to and closed, such
+ * that N remains open. Named pipes may be given as a filename, but must
+ * already be opened for reading, as this function does not wait for a
+ * reader.
+ *
+ * \param filename	File to write to.
+ * \param buf_sz	Size of each buffer in bytes. Rounded up to a multiple
+ *			of 4 KiB.
+ * \param nbufs		Number of buffers. Must be at least 2.
+ * \param flags		Bitwise OR of iow_flags_e.
+ * \return		Writer context, or NULL on error. Use SDL_GetError().
+ */
+iow_ctx *iow_open(const char *filename, size_t buf_sz, Uint8 nbufs,
+		  unsigned flags);
+
+/**
+ * Queue data to be written to the end of the file.
+ *
+ * \return	0 on success, else failure. Use SDL_GetError().
+ */
+int iow_write(iow_ctx *ctx, const void *data, size_t len);
+
+/**
+ * Obtain contiguous space within a buffer so that data may be generated
+ * directly into it, without being copied by iow_write(). The space is queued
+ * for writing with iow_commit().
+ *
+ * \param len	Size of space required. Must not exceed the buffer size.
+ * \return	Pointer to space of len bytes, or NULL if IOW_FLAG_NONBLOCK is
+ *		set and no buffer is free, or on error.
+ */
+void *iow_reserve(iow_ctx *ctx, size_t len);
+
+/**
+ * Queue space obtained with iow_reserve() for writing.
+ *
+ * \param len	Number of bytes written to the reserved space.
+ * \return	0 on success, else failure. Use SDL_GetError().
+ */
+int iow_commit(iow_ctx *ctx, size_t len);
+
+/**
+ * Write data at the given offset of the file, after all queued data has been
+ * written. This waits for the background thread, so should only be used
+ * sparingly, such as to update a file header before closing the file.
+ *
+ * \return	0 on success, else failure. Use SDL_GetError().
+ */
+int iow_pwrite(iow_ctx *ctx, Sint64 offset, const void *data, size_t len);
+
+/**
+ * Returns the size of the file once all queued data has been written.
+ */
+Sint64 iow_tell(iow_ctx *ctx);
+
+/**
+ * Obtain throughput and backpressure counters.
+ */
+void iow_get_stats(iow_ctx *ctx, struct iow_stats_s *stats);
+
+/**
+ * Write all queued data, close the file and free the context.
+ *
+ * \return	0 on success, else failure. Use SDL_GetError().
+ */
+int iow_close(iow_ctx *ctx);
@@ -0,0 +1,62 @@
+/**
+ * Pool of worker threads for background jobs.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#pragma once
+
+#include <SDL.h>
+
+/**
+ * Background work, such as encoding screenshots and writing files, is executed
+ * by a small fixed number of worker threads instead of a new thread per task.
+ * Jobs are queued in lock-free queues, one per priority. Higher priority jobs
+ * are always started before lower priority jobs.
+ */
+typedef enum {
+	/* Jobs that the user may be waiting on, such as saving files. */
+	JOB_PRIO_HIGH = 0,
+	JOB_PRIO_NORMAL,
+
+	/* Jobs that may be delayed, such as encoding screenshots. */
+	JOB_PRIO_LOW,
+
+	JOB_PRIO_MAX
+} job_prio_e;
+
+typedef void (*job_fn)(void *arg);
+
+/**
+ * Start the worker threads.
+ *
+ * \return	0 on success, else failure. Use SDL_GetError().
+ */
+int job_init(void);
+
+/**
+ * Queue a job to be executed by a worker thread.
+ * If the job pool is not running or the queue is full, the job is executed
+ * immediately on the calling thread instead. The job is therefore always
+ * executed, and must free its own argument.
+ *
+ * \param prio	Priority of job.
+ * \param fn	Function to execute.
+ * \param arg	Argument given to function.
+ */
+void job_submit(job_prio_e prio, job_fn fn, void *arg);
+
+/**
+ * Wait for all queued jobs to complete, and stop the worker threads. Jobs
+ * submitted after this call are executed on the calling thread.
+ * Must not be called whilst threads other than the workers may submit jobs.
+ */
+void job_exit(void);
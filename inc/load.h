@@ -16,8 +16,46 @@
 
 #include <haiyajan.h>
 
+/* Number of frames between checks for changes to SRAM. */
+#define SRAM_AUTOSAVE_FRAMES 120
+
+/**
+ * Content that is read in the background whilst the core and renderer are
+ * initialised.
+ */
+typedef struct load_content_s load_content_ctx;
+
+/**
+ * Starts reading the content file for the core on a worker thread. Plain files
+ * are mapped into memory and read by calculating their CRC-32, and archives
+ * are decompressed. Nothing is read if the core reads the content itself.
+ * The core must be loaded with load_libretro_core() first, such that its
+ * supported extensions are known.
+ *
+ * \param ctx	Libretro core context. Sets ctx->content_load.
+ * \return	0 on success, else failure. Use SDL_GetError().
+ */
+int load_content_begin(struct core_ctx_s *ctx);
+
+/**
+ * Obtains the percentage of content that has been read.
+ */
+int load_content_progress(const load_content_ctx *lc);
+
+/**
+ * Checks whether the content has been read, or reading failed.
+ */
+SDL_bool load_content_done(const load_content_ctx *lc);
+
+/**
+ * Cancels reading content, waits for the worker to stop, and frees it. Used
+ * when the content is not given to the core. Does nothing if lc is NULL.
+ */
+void load_content_free(load_content_ctx *lc);
+
 /**
- * Loads a file for the libretro core.
+ * Loads a file for the libretro core. Waits for content started with
+ * load_content_begin(), or reads it if it was not started.
  *
  * \param file	File path of file.
  * \param ctx	Libretro core context.
@@ -40,6 +78,16 @@ int load_libretro_core(const char *so_file, struct core_ctx_s *ctx);
  *
  * \param ctx	Libretro core context.
  */
+/**
+ * Saves SRAM in the background if it has changed. Checks for changes every
+ * SRAM_AUTOSAVE_FRAMES frames, and must therefore be called once per frame.
+ * The file is replaced atomically, such that an interrupted save does not
+ * lose the previous save.
+ *
+ * \param ctx	Core context.
+ */
+void autosave_sram(struct core_ctx_s *ctx);
+
 void unload_libretro_file(struct core_ctx_s *ctx);
 
 /**
@@ -50,3 +98,17 @@ void unload_libretro_file(struct core_ctx_s *ctx);
  * \param ctx Libretro core context to unload.
  */
 void unload_libretro_core(struct core_ctx_s *ctx);
+
+/**
+ * Scans a directory for libretro cores, and adds their information to the
+ * cache. Where supported, cores are probed in parallel by child processes,
+ * such that a core that crashes or hangs does not stop the scan. Cores that
+ * are unchanged since they were cached are not probed again.
+ *
+ * Must be called before other threads are started.
+ *
+ * \param dir	Directory containing libretro cores.
+ * \param ci	Cache to add information of cores to.
+ * \return	0 on success, else failure. Use SDL_GetError().
+ */
+int load_scan_cores(const char *dir, coreinfo_ctx *ci);
@@ -0,0 +1,54 @@
+/**
+ * Fast LZ77 compression in the LZ4 block format.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#pragma once
+
+#include <SDL.h>
+
+/**
+ * Data is compressed into a single LZ4 block without a frame, favouring speed
+ * over ratio, such that saving states does not delay frames. Blocks may be
+ * decompressed by other LZ4 implementations.
+ */
+
+/* Greatest size of compressed data for len bytes of input. */
+#define LZ_BOUND(len)	((len) + (len) / 255 + 16)
+
+/* Greatest size of input that may be compressed. */
+#define LZ_MAX_INPUT	0x7E000000
+
+/**
+ * Compress data.
+ *
+ * \param src	Data to compress.
+ * \param len	Length of data, which must not exceed LZ_MAX_INPUT.
+ * \param dst	Output of at least LZ_BOUND(len) bytes.
+ * \return	Length of compressed data.
+ */
+size_t lz_compress(const void *src, size_t len, void *dst);
+
+/**
+ * Decompress data. Malformed data is detected, and never causes reads or
+ * writes outside of the given buffers.
+ *
+ * \param src		Compressed data.
+ * \param src_len	Length of compressed data.
+ * \param dst		Output.
+ * \param dst_len	Size of output. Set to the length of the decompressed
+ *			data on success.
+ * \return		0 on success, or -1 if the data is malformed or does
+ *			not fit within the output.
+ */
+int lz_decompress(const void *src, size_t src_len, void *dst,
+		  size_t *dst_len);
@@ -38,10 +38,14 @@ void play_frame(struct core_ctx_s *ctx);
 /**
  * Initialise the audio and video contexts for libretro core.
  *
- * \param ctx	Libretro core context.
- * \returns	0 on success, else failure. Use SDL_GetError().
+ * \param ctx		Libretro core context.
+ * \param rend		Renderer to create the core texture with.
+ * \param latency_ms	Target audio latency in milliseconds. 0 for default.
+ * \param quality	Quality of audio sample rate conversion.
+ * \returns		0 on success, else failure. Use SDL_GetError().
  */
-int play_init_av(struct core_ctx_s *ctx, SDL_Renderer *rend);
+int play_init_av(struct core_ctx_s *ctx, SDL_Renderer *rend,
+		 Uint32 latency_ms, resample_quality_e quality);
 
 /**
  * Free audio and video contexts for libretro core.
@@ -25,6 +25,9 @@ typedef struct rec_s rec_ctx;
  * Audio is encoded with Wavpack. This is primarily due to supporting any input
  * sample rate.
  * These files are not merged into a container format.
+ * Duplicate frames are not encoded. Instead, the timestamp of each frame is
+ * written to a timecode file (format v2) that may be used when muxing the
+ * video into a container.
  *
  * Software encoding is used for both audio and video. This will consume
  * significant CPU time.
@@ -36,10 +39,11 @@ typedef struct rec_s rec_ctx;
  * \param height	Height of video.
  * \param fps		Frames per second.
  * \param sample_rate	Sample rate of audio.
+ * \param direct_io	Bypass the page cache when writing the output files.
  * \return		Valid context used for recording, or NULL on error.
  */
 rec_ctx *rec_init(const char *fileout, int width, int height, double fps,
-		      Sint32 sample_rate);
+		      Sint32 sample_rate, Uint8 direct_io);
 
 /**
  * Encode given surface as a new frame of video.
@@ -48,6 +52,12 @@ rec_ctx *rec_init(const char *fileout, int width, int height, double fps,
  */
 void rec_enc_video(rec_ctx *ctx, SDL_Surface *surf);
 
+/**
+ * Extend the display time of the last encoded frame by one frame, instead of
+ * encoding an identical frame.
+ */
+void rec_dupe_frame(rec_ctx *ctx);
+
 /**
  * Encode a given number of audio frames.
  */
@@ -0,0 +1,84 @@
+/**
+ * Stream raw video and audio to an external encoder.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#pragma once
+
+#include <SDL.h>
+
+/**
+ * Video is written in YUV4MPEG2 format with 4:4:4 chroma. Audio is written as
+ * raw signed 16-bit little endian stereo PCM at the sample rate of the core.
+ * Each output may be a file, a named pipe, or a file descriptor given as
+ * "fd:N", such that an encoder such as ffmpeg may run in its own process.
+ *
+ * Frames and audio are never waited upon. If the reader of an output does
+ * not keep up, new data is dropped and counted instead.
+ */
+typedef struct recpipe_s recpipe_ctx;
+
+struct recpipe_stats_s {
+	/* Number of video frames written and dropped. */
+	Uint32 frames;
+	Uint32 frames_dropped;
+
+	/* Number of frames that were unchanged, and so were not read back. */
+	Uint32 frames_duped;
+
+	/* Number of audio frames written and dropped. */
+	Uint64 samples;
+	Uint64 samples_dropped;
+};
+
+/**
+ * Initialise raw recording.
+ *
+ * \param vid_path	Output for video, or NULL to not output video.
+ * \param aud_path	Output for audio, or NULL to not output audio.
+ * \param width		Width of video.
+ * \param height	Height of video.
+ * \param fps		Frames per second.
+ * \param sample_rate	Sample rate of audio.
+ * \return		Recording context, or NULL on error.
+ */
+recpipe_ctx *recpipe_init(const char *vid_path, const char *aud_path,
+			  int width, int height, double fps,
+			  double sample_rate);
+
+/**
+ * Read back the given texture, and write it as the next video frame. The
+ * frame is converted directly into the output buffer.
+ */
+void recpipe_video(recpipe_ctx *ctx, SDL_Renderer *rend, SDL_Texture *tex,
+		   const SDL_Rect *src, SDL_RendererFlip flip);
+
+/**
+ * Write the last video frame again, without reading it back from the
+ * renderer. This is used when the core has not changed the frame.
+ */
+void recpipe_dupe_frame(recpipe_ctx *ctx);
+
+/**
+ * Write interleaved stereo audio frames.
+ */
+void recpipe_audio(recpipe_ctx *ctx, const Sint16 *data, Uint32 frames);
+
+/**
+ * Obtain the number of frames written and dropped.
+ */
+void recpipe_get_stats(recpipe_ctx *ctx, struct recpipe_stats_s *stats);
+
+/**
+ * Flush and close all outputs. The context is free'd and set to NULL.
+ */
+void recpipe_end(recpipe_ctx **ctxp);
@@ -0,0 +1,80 @@
+/**
+ * Audio sample rate converter.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#pragma once
+
+#include <SDL.h>
+
+/**
+ * Converts stereo signed 16-bit audio between arbitrary sample rates, such as
+ * from the 32040.5 Hz output of a core to the 48000 Hz native rate of an audio
+ * device. A polyphase windowed-sinc filter is used, with linear interpolation
+ * between phases. The filter is executed with AVX2, SSE2 or NEON where
+ * available.
+ */
+typedef struct resample_s resample_ctx;
+
+typedef enum {
+	/* 16 taps. Suitable for slow machines. */
+	RESAMPLE_QUALITY_LOW = 0,
+
+	/* 32 taps. */
+	RESAMPLE_QUALITY_MEDIUM,
+
+	/* 64 taps. */
+	RESAMPLE_QUALITY_HIGH,
+
+	RESAMPLE_QUALITY_MAX
+} resample_quality_e;
+
+/**
+ * Initialise a sample rate converter.
+ *
+ * \param in_rate	Sample rate of input in Hz.
+ * \param out_rate	Sample rate of output in Hz.
+ * \param quality	Quality of filter.
+ * \return		Context, or NULL on error. Use SDL_GetError().
+ */
+resample_ctx *resample_init(double in_rate, double out_rate,
+			    resample_quality_e quality);
+
+/**
+ * Obtain the maximum number of frames output for the given number of input
+ * frames.
+ */
+Uint32 resample_max_output(const resample_ctx *ctx, Uint32 in_frames);
+
+/**
+ * Convert interleaved stereo frames. All input frames are consumed. Frames
+ * are delayed by half the length of the filter.
+ *
+ * \param ctx		Context.
+ * \param in		Input frames.
+ * \param in_frames	Number of input frames.
+ * \param out		Output frames. Must hold at least
+ *			resample_max_output(ctx, in_frames) frames.
+ * \return		Number of frames output.
+ */
+Uint32 resample_process(resample_ctx *ctx, const Sint16 *in, Uint32 in_frames,
+			Sint16 *out);
+
+/**
+ * Obtain the name of the instruction set used by the filter.
+ */
+const char *resample_get_isa(const resample_ctx *ctx);
+
+/**
+ * Free the context. Does nothing if ctx is NULL.
+ */
+void resample_exit(resample_ctx *ctx);
@@ -0,0 +1,111 @@
+/**
+ * Rewind buffer of serialised core states.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#pragma once
+
+#include <SDL.h>
+
+struct core_ctx_s;
+
+/**
+ * The state of the core is serialised every few frames. Only the newest state
+ * is kept in full. Each older state is stored in a ring buffer as the XOR of
+ * itself and the state that followed it, compressed with lz_compress(). As
+ * consecutive states differ in few bytes, the XOR is mostly zero and
+ * compresses well. Stepping backwards decompresses the newest difference and
+ * applies it to the newest state. The oldest differences are dropped once the
+ * ring buffer is full. The XOR is executed with AVX2, SSE2 or NEON where
+ * available.
+ */
+typedef struct rewind_s rewind_ctx;
+
+struct rewind_stats_s
+{
+	/* Number of states that may be stepped back to. */
+	Uint32 states;
+
+	/* Seconds of play covered by those states. */
+	float seconds;
+
+	/* Bytes of the ring buffer used, and its size. */
+	size_t used;
+	size_t size;
+
+	/* Bytes of a serialised state. Four buffers of about this size are
+	 * allocated in addition to the ring buffer. */
+	size_t state_len;
+
+	/* Frames played, and states captured whilst playing them. */
+	Uint64 frames;
+	Uint64 captures;
+
+	/* Total time taken to capture states, in microseconds. */
+	Uint64 capture_us;
+};
+
+/**
+ * Initialise a rewind buffer for the loaded content. Buffers for the states
+ * themselves are allocated by the first capture, once the core reports the
+ * size of its state.
+ *
+ * \param core		Libretro core context. Must remain valid until
+ *			rewind_free().
+ * \param size		Size of the ring buffer in bytes.
+ * \param interval	Number of frames between each state. 0 is treated as
+ *			1.
+ * \return		Rewind context, or NULL on failure. Use
+ *			SDL_GetError().
+ */
+rewind_ctx *rewind_init(struct core_ctx_s *core, size_t size,
+			unsigned interval);
+
+/**
+ * Count a frame that has been played, and capture the state of the core if
+ * the interval has elapsed. Must not be called whilst the core may be called
+ * by another thread.
+ *
+ * \param ctx	Rewind context.
+ */
+void rewind_frame(rewind_ctx *ctx);
+
+/**
+ * Restore the state captured before the newest state, and drop the newest
+ * state. Once the oldest state is reached, it is restored on each call.
+ *
+ * \param ctx	Rewind context.
+ * \return	0 on success, 1 if the oldest state was restored, or -1 on
+ *		failure. Use SDL_GetError().
+ */
+int rewind_step(rewind_ctx *ctx);
+
+/**
+ * Obtain statistics of the rewind buffer.
+ *
+ * \param ctx	Rewind context.
+ * \param st	Structure to fill.
+ */
+void rewind_get_stats(const rewind_ctx *ctx, struct rewind_stats_s *st);
+
+/**
+ * Log statistics of the rewind buffer, including the time taken per frame and
+ * the number of seconds held per MiB.
+ *
+ * \param ctx	Rewind context.
+ */
+void rewind_log_stats(const rewind_ctx *ctx);
+
+/**
+ * Log statistics and free the rewind buffer. Does nothing if ctx is NULL.
+ */
+void rewind_free(rewind_ctx *ctx);
@@ -0,0 +1,70 @@
+/**
+ * Save states of libretro cores.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#pragma once
+
+#include <SDL.h>
+
+struct core_ctx_s;
+
+/**
+ * States are serialised into a buffer that is allocated on the first save or
+ * load, as some cores only report the size of their state once they have run.
+ * States are compressed and written to file by a worker thread, such that
+ * saving does not delay the next frame. A quick slot keeps a single
+ * uncompressed state in memory.
+ */
+typedef struct state_s state_ctx;
+
+/* Number of save state slots that are written to file. */
+#define STATE_SLOTS	10
+
+/**
+ * Save the state of the core to a slot. The state is serialised immediately,
+ * and written to file in the background. Sets ctx->state on first use.
+ *
+ * \param ctx	Libretro core context.
+ * \param slot	Slot number, less than STATE_SLOTS.
+ * \return	0 on success, else failure. Use SDL_GetError().
+ */
+int state_save(struct core_ctx_s *ctx, unsigned slot);
+
+/**
+ * Restore the state of the core from a slot. Sets ctx->state on first use.
+ *
+ * \param ctx	Libretro core context.
+ * \param slot	Slot number, less than STATE_SLOTS.
+ * \return	0 on success, else failure. Use SDL_GetError().
+ */
+int state_load(struct core_ctx_s *ctx, unsigned slot);
+
+/**
+ * Save the state of the core to the quick slot in memory.
+ *
+ * \return	0 on success, else failure. Use SDL_GetError().
+ */
+int state_quick_save(struct core_ctx_s *ctx);
+
+/**
+ * Restore the state of the core from the quick slot.
+ *
+ * \return	0 on success, else failure. Use SDL_GetError().
+ */
+int state_quick_load(struct core_ctx_s *ctx);
+
+/**
+ * Wait for states to be written, and free the buffers. Does nothing if no
+ * state was saved or loaded.
+ */
+void state_free(struct core_ctx_s *ctx);
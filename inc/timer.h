@@ -34,6 +34,15 @@ struct timer_ctx_s
 	Uint64 busy_acu_ms;
 	Uint8 busy_samples;
 	SDL_atomic_t status_atomic;
+
+	/* Time in milliseconds to wait after VSYNC before running the core,
+	 * such that input is read closer to the next VSYNC. When automatic,
+	 * the delay is tuned to the slowest frame seen recently. */
+	int frame_delay_ms;
+	Uint8 frame_delay_auto;
+	Uint8 work_samples;
+	Uint32 work_max_us;
+	Uint64 work_start;
 };
 
 /* TODO: use Uint64 instead of double. */
@@ -59,3 +68,25 @@ void timer_profile_start(struct timer_ctx_s *const tim);
  * \returns	Negative for skip frame, 0 for no delay, else time to delay for.
  */
 int timer_profile_end(struct timer_ctx_s *const tim);
+
+/**
+ * Sets the frame delay. Must be called after timer_init().
+ *
+ * \param tim		Timer context.
+ * \param delay_ms	Milliseconds to wait before running each frame. Set to
+ *			0 to disable, or a negative value to tune the delay
+ *			automatically.
+ */
+void timer_set_frame_delay(struct timer_ctx_s *const tim, int delay_ms);
+
+/**
+ * Waits for the frame delay, if set. Must be called after VSYNC and before
+ * input is read and the core is run.
+ */
+void timer_frame_delay(struct timer_ctx_s *const tim);
+
+/**
+ * Marks the end of the work of the frame, before the frame is presented.
+ * Used to tune the automatic frame delay.
+ */
+void timer_frame_work_end(struct timer_ctx_s *const tim);
@@ -37,7 +37,8 @@ extern "C" {
 typedef enum {
 	TINF_OK         = 0,  /**< Success */
 	TINF_DATA_ERROR = 1, /**< Input error */
-	TINF_BUF_ERROR  = 2  /**< Not enough room for output */
+	TINF_BUF_ERROR  = 2, /**< Not enough room for output */
+	TINF_DONE       = 3  /**< End of stream reached */
 } tinf_error_code;
 
 /**
@@ -58,6 +59,60 @@ typedef enum {
 tinf_error_code tinf_uncompress(void *dest, unsigned long *destLen,
 		const void *source, unsigned long sourceLen);
 
+/**
+ * State of a streaming decompression.
+ *
+ * Holds the last 32 KiB of output, so that compressed data may be consumed and
+ * decompressed data produced in chunks of any size.
+ */
+struct tinf_stream;
+
+/**
+ * Allocate and initialise the state of a streaming decompression.
+ *
+ * @return pointer to state, or NULL if out of memory
+ */
+struct tinf_stream *tinf_stream_init(void);
+
+/**
+ * Reset `s` to begin decompressing a new deflate stream.
+ *
+ * @param s pointer to state
+ */
+void tinf_stream_reset(struct tinf_stream *s);
+
+/**
+ * Free the state of a streaming decompression. Does nothing if `s` is NULL.
+ *
+ * @param s pointer to state
+ */
+void tinf_stream_free(struct tinf_stream *s);
+
+/**
+ * Decompress up to `*sourceLen` bytes of deflate data from `source` to `dest`.
+ *
+ * The variables `destLen` and `sourceLen` point to must contain the size of
+ * `dest` and `source` on entry, and will be set to the number of bytes
+ * written to `dest` and read from `source` respectively.
+ *
+ * Decompression stops when either all of `source` has been read, or `dest`
+ * is full. The function is then called again with the remaining input, more
+ * input, or more space for output. Once the end of the deflate stream is
+ * reached, `*sourceLen` excludes any data that follows it.
+ *
+ * @param s pointer to state
+ * @param dest pointer to where to place decompressed data
+ * @param destLen pointer to variable containing size of `dest`
+ * @param source pointer to compressed data
+ * @param sourceLen pointer to variable containing size of `source`
+ * @return `TINF_DONE` once the end of the stream has been reached and all
+ * decompressed data has been written, `TINF_OK` if more input or output space
+ * is required, error code on error
+ */
+tinf_error_code tinf_stream_uncompress(struct tinf_stream *s,
+		void *dest, unsigned long *destLen,
+		const void *source, unsigned long *sourceLen);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -53,7 +53,9 @@ typedef struct ui_overlay_item ui_overlay_ctx;
  * 			acquired from the get_new_str function.
  * 			String must be null terminated.
  * \param timeout_ms	Number of milliseconds to show the overlay for. Set to
- * 			0 for no automatic deletion.
+ * 			0 for no automatic deletion. Overlays expire as the
+ * 			timer wheel is advanced by the main loop, so overlays
+ * 			must only be used on the main thread.
  * \param get_new_str	The function to call to obtain new text on each render.
  * 			If get_new_str returns NULL, the overlay is deleted.
  * 			This function pointer must be NULL for static text.
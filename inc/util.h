@@ -34,21 +34,91 @@ void gen_filename(char filename[atleast 64], const char *core_name,
 		  const char fmt[atleast 3]);
 
 /**
- * Modify an atomic variable to a value after a given time.
+ * Modify an atomic variable to a value after a given time. The atomic variable
+ * must have static storage duration. The variable is modified by the main
+ * loop as it advances the timer wheel, so this must be called from the main
+ * thread.
  *
  * \param timeout_ms	Time to wait in ms before modifying atomic variable.
  * \param atomic	The atomic variable to modify.
  * \param setval	The value to set the atomic variable to after timeout.
- * \param name		The name of the thread. Can be set to NULL.
  */
-void set_atomic_timeout(Uint32 timeout_ms, SDL_atomic_t *atomic, int setval,
-	const char *name);
+void set_atomic_timeout(Uint32 timeout_ms, SDL_atomic_t *atomic, int setval);
 
 /**
- * Makes sure that delayed threads no longer attempt to modify data that may
- * now be out of scope.
+ * Calculates a fast non-cryptographic 64-bit hash of the given data. This is
+ * intended for detecting changes in large buffers, such as video frames.
+ *
+ * \param data		Data to hash.
+ * \param len		Length of data in bytes.
+ * \param seed		Initial value. The hash of a previous buffer may be
+ *			given to hash discontiguous data, such as rows of a
+ *			frame.
+ * \return		Hash of data.
+ */
+Uint64 util_hash(const void *data, size_t len, Uint64 seed);
+
+/**
+ * Calculates the CRC-32 of the given data, as used by zip and gzip files.
+ *
+ * \param data		Data to checksum.
+ * \param len		Length of data in bytes.
+ * \param crc		Initial value. Set to 0, or the CRC-32 of the preceding
+ *			data to checksum discontiguous data.
+ * \return		CRC-32 of data.
+ */
+Uint32 util_crc32(const void *data, size_t len, Uint32 crc);
+
+/**
+ * Checks whether the extension of a filename is one of the given extensions.
+ * The comparison is case insensitive.
+ *
+ * \param filename	Filename to check.
+ * \param exts		Extensions without a leading dot, separated by '|'.
+ *			For example, "zip|gz". May be NULL.
+ * \return		SDL_TRUE if the extension of filename is in exts.
+ */
+SDL_bool util_has_ext(const char *filename, const char *exts);
+
+/**
+ * Replaces the extension of a filename. The extension is added if the
+ * filename does not have one.
+ *
+ * \param filename	Filename to change.
+ * \param ext		New extension, including its leading dot.
+ * \return		Allocated filename to be freed with SDL_free(), or NULL
+ *			on error.
+ */
+char *util_replace_ext(const char *filename, const char *ext);
+
+/**
+ * Writes data to a file by writing to a temporary file beside it, which then
+ * replaces the file. The file therefore always holds either the previous or
+ * the new data, even if writing is interrupted.
+ *
+ * \param filename	File to write.
+ * \param data		Data to write.
+ * \param len		Length of data in bytes.
+ * \return		0 on success, else failure. Use SDL_GetError().
+ */
+int util_write_file(const char *filename, const void *data, size_t len);
+
+/**
+ * Reads the pixels of a texture into memory by drawing the given texture onto
+ * the renderer, and reading the pixels back.
+ *
+ * \param rend		Renderer associated with the given texture.
+ * \param tex		Texture to read.
+ * \param src		Area of texture to read.
+ * \param flip		Whether to flip the texture whilst reading.
+ * \param fmt		Pixel format to read the texture as.
+ * \param pixels	Memory of at least pitch * src->h bytes.
+ * \param pitch		Length of a row of pixels in bytes.
+ * \return		0 on success, else failure. Use SDL_GetError().
  */
-void util_exit_all(void);
+int util_tex_read(SDL_Renderer *rend, SDL_Texture *tex,
+		  const SDL_Rect *const src, const SDL_RendererFlip flip,
+		  Uint32 fmt, void *pixels, int pitch);
 
 /**
  * Converts SDL_Texture to SDL_Surface by drawing the given texture onto the
@@ -0,0 +1,95 @@
+/**
+ * Libretro virtual file system interface.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#pragma once
+
+#include <SDL.h>
+#include <libretro.h>
+
+/**
+ * Regular files opened by cores through the VFS interface are mapped into
+ * memory when only opened for reading. Otherwise, reads are served from a
+ * read-ahead cache of each file, so that the many small reads made by some
+ * cores do not each wait on the disk.
+ */
+
+/* Version of the libretro VFS interface that is provided. */
+#define VFS_INTERFACE_VERSION	3
+
+/* Size of the read-ahead cache of each file that is not mapped. */
+#define VFS_CACHE_SIZE		(64 * 1024)
+
+/* Number of buckets in the read latency histogram. Bucket n counts reads that
+ * took less than 2^n microseconds, and the last bucket counts slower reads. */
+#define VFS_LATENCY_BUCKETS	16
+
+/* Reads that take longer than this many microseconds are likely to delay a
+ * frame, and are reported when the file is closed. */
+#define VFS_SLOW_READ_US	2000
+
+struct vfs_stats_s
+{
+	Uint64 reads;
+	Uint64 read_bytes;
+
+	/* Reads that were not served from the read-ahead cache. Reads of
+	 * mapped files are never counted, but may still wait for the disk,
+	 * which is shown in their latency. */
+	Uint64 misses;
+
+	Uint64 writes;
+	Uint64 write_bytes;
+
+	/* Total and greatest time taken by reads in microseconds. */
+	Uint64 read_us;
+	Uint32 max_read_us;
+
+	/* Number of reads that took longer than VFS_SLOW_READ_US. */
+	Uint32 slow_reads;
+
+	Uint32 latency[VFS_LATENCY_BUCKETS];
+};
+
+/**
+ * Give the VFS interface to a core.
+ *
+ * \param info	VFS interface information given by the core.
+ * \return	0 on success, or -1 if the core requires a newer version of
+ *		the interface.
+ */
+int vfs_get_interface(struct retro_vfs_interface_info *info);
+
+/**
+ * Obtain the statistics of a file that is open.
+ *
+ * \param stream	File handle given to the core.
+ * \param st		Statistics of the file.
+ */
+void vfs_get_file_stats(const struct retro_vfs_file_handle *stream,
+			struct vfs_stats_s *st);
+
+/**
+ * Obtain the combined statistics of all files that have been closed.
+ *
+ * \param st	Statistics of all closed files.
+ */
+void vfs_get_stats(struct vfs_stats_s *st);
+
+/**
+ * Log statistics, including the histogram of read latency.
+ *
+ * \param name	Name of file or files that the statistics are of.
+ * \param st	Statistics to log.
+ */
+void vfs_log_stats(const char *name, const struct vfs_stats_s *st);
@@ -0,0 +1,69 @@
+/**
+ * Hierarchical timer wheel.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#pragma once
+
+#include <SDL.h>
+
+/**
+ * Timeouts that are serviced by the main loop. The wheel is advanced with
+ * wheel_advance(), which executes the callback of each expired timer on the
+ * calling thread. No locks are used, so all functions in this file must be
+ * called from the main thread.
+ *
+ * Timers are stored in the structure of the caller, so adding and cancelling
+ * a timer does not allocate memory and takes constant time.
+ */
+typedef void (*wheel_cb)(void *priv);
+
+struct wheel_timer_s {
+	/* Private members. A timer must be initialised to zero before use. */
+	struct wheel_timer_s *next;
+	struct wheel_timer_s **pprev;
+	Uint64 expire;
+	wheel_cb cb;
+	void *priv;
+};
+
+/**
+ * Start a timer. If the timer is already pending, it is restarted.
+ *
+ * \param t		Timer. Must remain valid until the timer has expired or
+ *			has been cancelled.
+ * \param timeout_ms	Time in milliseconds until the callback is executed.
+ * \param cb		Function to call on expiry.
+ * \param priv		Private pointer given to the callback.
+ */
+void wheel_add(struct wheel_timer_s *t, Uint32 timeout_ms, wheel_cb cb,
+	       void *priv);
+
+/**
+ * Stop a timer without executing its callback. Has no effect if the timer is
+ * not pending.
+ */
+void wheel_cancel(struct wheel_timer_s *t);
+
+/**
+ * Returns SDL_TRUE if the timer has been started and has not yet expired or
+ * been cancelled.
+ */
+SDL_bool wheel_pending(const struct wheel_timer_s *t);
+
+/**
+ * Advance the wheel to the given time, executing the callbacks of all timers
+ * that expire up to and including that time. Time must not go backwards.
+ *
+ * \param now_ms	Current time in milliseconds.
+ */
+void wheel_advance(Uint64 now_ms);
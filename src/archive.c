@@ -0,0 +1,674 @@
+/**
+ * Reads content from zip archives and gzip files.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#include <string.h>
+
+#include <SDL.h>
+#include <archive.h>
+#include <fmap.h>
+#include <job.h>
+#include <tinf.h>
+#include <util.h>
+
+/* Compression methods of entries. */
+#define ARCHIVE_STORED		0
+#define ARCHIVE_DEFLATE		8
+
+/* Signatures and sizes of the fixed fields of zip records. */
+#define ZIP_LOCAL_SIG		0x04034B50
+#define ZIP_LOCAL_SZ		30
+#define ZIP_CDIR_SIG		0x02014B50
+#define ZIP_CDIR_SZ		46
+#define ZIP_EOCD_SIG		0x06054B50
+#define ZIP_EOCD_SZ		22
+#define ZIP_COMMENT_MAX		0xFFFF
+
+/* Flags of zip entries. */
+#define ZIP_FLAG_ENCRYPTED	(1 << 0)
+
+/* Size of the fixed header and trailer of gzip files. */
+#define GZ_HEADER_SZ		10
+#define GZ_TRAILER_SZ		8
+
+/* Flags of gzip headers. */
+#define GZ_FLAG_HCRC		(1 << 1)
+#define GZ_FLAG_EXTRA		(1 << 2)
+#define GZ_FLAG_NAME		(1 << 3)
+#define GZ_FLAG_COMMENT		(1 << 4)
+
+/* Entries are decompressed and verified in steps of this many bytes. */
+#define ARCHIVE_STEP		(1024 * 1024)
+
+struct archive_entry_s {
+	char *name;
+
+	/* Compressed data within the mapped file. */
+	const Uint8 *data;
+	size_t csize;
+
+	size_t size;
+	Uint32 crc;
+	Uint16 method;
+	Uint16 flags;
+};
+
+struct archive_s {
+	fmap_ctx *map;
+	unsigned count;
+	struct archive_entry_s *entries;
+};
+
+struct archive_job_s {
+	const struct archive_entry_s *e;
+	void *dst;
+
+	/* Errors are set by worker threads, so are copied to the caller. */
+	int ret;
+	char err[128];
+};
+
+/* Entries being decompressed by archive_extract(). Entries are claimed in
+ * order by the calling thread and by helper jobs, so the calling thread never
+ * waits for an entry that no worker has started. As a helper may not start
+ * until all entries are decompressed, this is freed by whichever of the
+ * calling thread and the helpers releases it last. */
+struct archive_extract_s {
+	unsigned n;
+	SDL_atomic_t next;
+	SDL_atomic_t refs;
+
+	/* Posted once for each entry decompressed by a helper. */
+	SDL_sem *done;
+
+	/* Steps decompressed of all entries, reported to the callback. */
+	archive_progress_fn progress;
+	void *priv;
+	Uint64 total;
+	SDL_atomic_t steps;
+	SDL_atomic_t cancel;
+
+	struct archive_job_s jobs[];
+};
+
+static Uint16 archive_read16(const Uint8 *p)
+{
+	return (Uint16)(p[0] | (p[1] << 8));
+}
+
+static Uint32 archive_read32(const Uint8 *p)
+{
+	return (Uint32)p[0] | ((Uint32)p[1] << 8) | ((Uint32)p[2] << 16) |
+		((Uint32)p[3] << 24);
+}
+
+static char *archive_strndup(const char *str, size_t len)
+{
+	char *s = SDL_malloc(len + 1);
+
+	if(s == NULL)
+		return NULL;
+
+	SDL_memcpy(s, str, len);
+	s[len] = '\0';
+	return s;
+}
+
+static int archive_open_gz(archive_ctx *ctx, const char *filename)
+{
+	const Uint8 *base = fmap_data(ctx->map);
+	const Uint8 *p = base + GZ_HEADER_SZ;
+	const Uint8 *end = base + fmap_size(ctx->map) - GZ_TRAILER_SZ;
+	struct archive_entry_s *e;
+	const char *name = NULL;
+	size_t name_len = 0;
+	Uint8 flags = base[3];
+
+	if(base[2] != ARCHIVE_DEFLATE)
+		goto corrupt;
+
+	if(flags & GZ_FLAG_EXTRA)
+	{
+		if(end - p < 2 || end - p - 2 < archive_read16(p))
+			goto corrupt;
+
+		p += 2 + archive_read16(p);
+	}
+
+	if(flags & GZ_FLAG_NAME)
+	{
+		const Uint8 *nul = memchr(p, '\0', end - p);
+
+		if(nul == NULL)
+			goto corrupt;
+
+		name = (const char *)p;
+		name_len = nul - p;
+		p = nul + 1;
+	}
+
+	if(flags & GZ_FLAG_COMMENT)
+	{
+		const Uint8 *nul = memchr(p, '\0', end - p);
+
+		if(nul == NULL)
+			goto corrupt;
+
+		p = nul + 1;
+	}
+
+	if(flags & GZ_FLAG_HCRC)
+	{
+		if(end - p < 2)
+			goto corrupt;
+
+		p += 2;
+	}
+
+	/* Without a stored name, the name is that of the gzip file without
+	 * its extension. */
+	if(name == NULL || name_len == 0)
+	{
+		const char *ext;
+
+		name = SDL_strrchr(filename, '/');
+		name = name != NULL ? name + 1 : filename;
+#ifdef _WIN32
+		if(SDL_strrchr(name, '\\') != NULL)
+			name = SDL_strrchr(name, '\\') + 1;
+#endif
+		ext = SDL_strrchr(name, '.');
+		name_len = ext != NULL ? (size_t)(ext - name) :
+			SDL_strlen(name);
+	}
+
+	ctx->entries = SDL_calloc(1, sizeof(struct archive_entry_s));
+	if(ctx->entries == NULL)
+		goto oom;
+
+	e = &ctx->entries[0];
+	e->name = archive_strndup(name, name_len);
+	if(e->name == NULL)
+		goto oom;
+
+	e->data = p;
+	e->csize = end - p;
+	e->crc = archive_read32(end);
+
+	/* The size is stored modulo 2^32. */
+	e->size = archive_read32(end + 4);
+	e->method = ARCHIVE_DEFLATE;
+	ctx->count = 1;
+
+	return 0;
+
+corrupt:
+	SDL_SetError("Corrupt gzip file %s", filename);
+	return -1;
+
+oom:
+	SDL_OutOfMemory();
+	return -1;
+}
+
+static int archive_open_zip(archive_ctx *ctx, const char *filename)
+{
+	const Uint8 *base = fmap_data(ctx->map);
+	size_t sz = fmap_size(ctx->map);
+	const Uint8 *eocd = NULL;
+	const Uint8 *p, *end;
+	size_t cdir_off, cdir_sz;
+	unsigned total, i;
+
+	/* The end of central directory record is at the end of the file,
+	 * followed only by a comment. */
+	for(i = 0; i <= ZIP_COMMENT_MAX && i <= sz - ZIP_EOCD_SZ; i++)
+	{
+		const Uint8 *rec = base + sz - ZIP_EOCD_SZ - i;
+
+		if(archive_read32(rec) == ZIP_EOCD_SIG &&
+		   archive_read16(rec + 20) == i)
+		{
+			eocd = rec;
+			break;
+		}
+	}
+
+	if(eocd == NULL)
+	{
+		SDL_SetError("%s is not a zip archive", filename);
+		return -1;
+	}
+
+	total = archive_read16(eocd + 10);
+	cdir_sz = archive_read32(eocd + 12);
+	cdir_off = archive_read32(eocd + 16);
+
+	if(total == 0xFFFF || cdir_off == 0xFFFFFFFF)
+	{
+		SDL_SetError("Zip64 archives are not supported");
+		return -1;
+	}
+
+	if(cdir_off > sz || cdir_sz > sz - cdir_off)
+		goto corrupt;
+
+	ctx->entries = SDL_calloc(total + 1, sizeof(struct archive_entry_s));
+	if(ctx->entries == NULL)
+	{
+		SDL_OutOfMemory();
+		return -1;
+	}
+
+	p = base + cdir_off;
+	end = p + cdir_sz;
+	for(i = 0; i < total; i++)
+	{
+		struct archive_entry_s *e = &ctx->entries[ctx->count];
+		const Uint8 *local;
+		size_t name_len, local_off, data_off, skip;
+
+		if(end - p < ZIP_CDIR_SZ || archive_read32(p) != ZIP_CDIR_SIG)
+			goto corrupt;
+
+		name_len = archive_read16(p + 28);
+		skip = ZIP_CDIR_SZ + name_len + archive_read16(p + 30) +
+			archive_read16(p + 32);
+		if((size_t)(end - p) < skip)
+			goto corrupt;
+
+		/* Directories are not included. */
+		if(name_len == 0 || p[ZIP_CDIR_SZ + name_len - 1] == '/')
+		{
+			p += skip;
+			continue;
+		}
+
+		e->flags = archive_read16(p + 8);
+		e->method = archive_read16(p + 10);
+		e->crc = archive_read32(p + 16);
+		e->csize = archive_read32(p + 20);
+		e->size = archive_read32(p + 24);
+
+		/* The local header may have an extra field of a different
+		 * length to that in the central directory. */
+		local_off = archive_read32(p + 42);
+		if(local_off > sz || sz - local_off < ZIP_LOCAL_SZ)
+			goto corrupt;
+
+		local = base + local_off;
+		if(archive_read32(local) != ZIP_LOCAL_SIG)
+			goto corrupt;
+
+		data_off = local_off + ZIP_LOCAL_SZ + archive_read16(local + 26) +
+			archive_read16(local + 28);
+		if(data_off > sz || sz - data_off < e->csize)
+			goto corrupt;
+
+		e->data = base + data_off;
+		e->name = archive_strndup((const char *)p + ZIP_CDIR_SZ,
+					  name_len);
+		if(e->name == NULL)
+		{
+			SDL_OutOfMemory();
+			return -1;
+		}
+
+		ctx->count++;
+		p += skip;
+	}
+
+	return 0;
+
+corrupt:
+	SDL_SetError("Corrupt zip archive %s", filename);
+	return -1;
+}
+
+archive_ctx *archive_open(const char *filename)
+{
+	archive_ctx *ctx;
+	const Uint8 *base;
+	size_t sz;
+	int ret;
+
+	ctx = SDL_calloc(1, sizeof(archive_ctx));
+	if(ctx == NULL)
+	{
+		SDL_OutOfMemory();
+		return NULL;
+	}
+
+	/* Most of the archive is usually read, so reading begins in the
+	 * background whilst the central directory is parsed. */
+	ctx->map = fmap_open(filename, FMAP_FLAG_WILLNEED);
+	if(ctx->map == NULL)
+		goto err;
+
+	base = fmap_data(ctx->map);
+	sz = fmap_size(ctx->map);
+
+	if(sz >= GZ_HEADER_SZ + GZ_TRAILER_SZ &&
+	   base[0] == 0x1F && base[1] == 0x8B)
+		ret = archive_open_gz(ctx, filename);
+	else if(sz >= ZIP_EOCD_SZ)
+		ret = archive_open_zip(ctx, filename);
+	else
+		ret = SDL_SetError("%s is not an archive", filename);
+
+	if(ret != 0)
+		goto err;
+
+	return ctx;
+
+err:
+	archive_close(ctx);
+	return NULL;
+}
+
+unsigned archive_count(const archive_ctx *ctx)
+{
+	return ctx->count;
+}
+
+const char *archive_name(const archive_ctx *ctx, unsigned entry)
+{
+	SDL_assert(entry < ctx->count);
+	return ctx->entries[entry].name;
+}
+
+size_t archive_size(const archive_ctx *ctx, unsigned entry)
+{
+	SDL_assert(entry < ctx->count);
+	return ctx->entries[entry].size;
+}
+
+Uint32 archive_crc(const archive_ctx *ctx, unsigned entry)
+{
+	SDL_assert(entry < ctx->count);
+	return ctx->entries[entry].crc;
+}
+
+int archive_find(const archive_ctx *ctx, const char *exts)
+{
+	unsigned i;
+
+	for(i = 0; i < ctx->count; i++)
+	{
+		if(exts == NULL || util_has_ext(ctx->entries[i].name, exts))
+			return (int)i;
+	}
+
+	return -1;
+}
+
+/**
+ * Count a step as decompressed, and report the progress of the extraction.
+ *
+ * \return	0 to continue, or -1 if the extraction was cancelled.
+ */
+static int archive_step(struct archive_extract_s *x)
+{
+	Uint64 steps = (Uint64)SDL_AtomicAdd(&x->steps, 1) + 1;
+
+	if(x->progress != NULL &&
+	   x->progress(x->priv, (unsigned)(steps * 100 / x->total)) != 0)
+		SDL_AtomicSet(&x->cancel, 1);
+
+	return SDL_AtomicGet(&x->cancel) != 0 ? -1 : 0;
+}
+
+/**
+ * Decompress a deflate compressed entry with the streaming decoder, one step
+ * at a time, calculating the CRC-32 of each step whilst it remains in the
+ * cache.
+ */
+static tinf_error_code archive_inflate(struct archive_extract_s *x,
+				       struct tinf_stream *s,
+				       const struct archive_entry_s *e,
+				       Uint8 *dst, Uint32 *crc)
+{
+	tinf_error_code res;
+	size_t in = 0, out = 0;
+
+	do
+	{
+		unsigned long out_len, in_len;
+
+		out_len = (unsigned long)SDL_min(ARCHIVE_STEP, e->size - out);
+		in_len = (unsigned long)(e->csize - in);
+		res = tinf_stream_uncompress(s, dst + out, &out_len,
+					     e->data + in, &in_len);
+
+		*crc = util_crc32(dst + out, out_len, *crc);
+		out += out_len;
+		in += in_len;
+
+		/* The input is truncated, or the output is larger than the
+		 * size given in the header. */
+		if(res == TINF_OK && out_len == 0 && in_len == 0)
+			res = TINF_DATA_ERROR;
+		else if(out_len > 0 && archive_step(x) != 0)
+			break;
+	}
+	while(res == TINF_OK);
+
+	if(res == TINF_DONE && out == e->size)
+		res = TINF_OK;
+	else if(res == TINF_DONE || res == TINF_OK)
+		res = TINF_DATA_ERROR;
+
+	return res;
+}
+
+static int archive_decompress(struct archive_extract_s *x,
+			      struct archive_job_s *job)
+{
+	const struct archive_entry_s *e = job->e;
+	Uint8 *dst = job->dst;
+	char *err = job->err;
+	const size_t err_len = sizeof(job->err);
+	struct tinf_stream *s;
+	tinf_error_code res;
+	Uint32 crc = 0;
+	size_t i;
+
+	if(SDL_AtomicGet(&x->cancel) != 0)
+		goto corrupt;
+
+	if(e->flags & ZIP_FLAG_ENCRYPTED)
+	{
+		SDL_snprintf(err, err_len, "%s is encrypted", e->name);
+		return -1;
+	}
+
+	switch(e->method)
+	{
+	case ARCHIVE_STORED:
+		if(e->csize != e->size)
+			goto corrupt;
+
+		for(i = 0; i < e->size; i += ARCHIVE_STEP)
+		{
+			size_t len = SDL_min(ARCHIVE_STEP, e->size - i);
+
+			memcpy(dst + i, e->data + i, len);
+			crc = util_crc32(dst + i, len, crc);
+
+			if(archive_step(x) != 0)
+				goto corrupt;
+		}
+
+		break;
+
+	case ARCHIVE_DEFLATE:
+		s = tinf_stream_init();
+		if(s == NULL)
+		{
+			SDL_snprintf(err, err_len, "Out of memory");
+			return -1;
+		}
+
+		res = archive_inflate(x, s, e, dst, &crc);
+		tinf_stream_free(s);
+		if(res != TINF_OK)
+			goto corrupt;
+
+		break;
+
+	default:
+		SDL_snprintf(err, err_len,
+			     "%s uses unsupported compression method %u",
+			     e->name, e->method);
+		return -1;
+	}
+
+	if(crc != e->crc)
+		goto corrupt;
+
+	return 0;
+
+corrupt:
+	if(SDL_AtomicGet(&x->cancel) != 0)
+		SDL_snprintf(err, err_len, "Extraction was cancelled");
+	else
+		SDL_snprintf(err, err_len, "%s is corrupt", e->name);
+
+	return -1;
+}
+
+/**
+ * Claim the next entry that has not been decompressed, and decompress it.
+ *
+ * \return	0 if an entry was decompressed, or -1 if none remain.
+ */
+static int archive_claim(struct archive_extract_s *x)
+{
+	struct archive_job_s *job;
+	int i = SDL_AtomicAdd(&x->next, 1);
+
+	if(i >= (int)x->n)
+		return -1;
+
+	job = &x->jobs[i];
+	job->ret = archive_decompress(x, job);
+	return 0;
+}
+
+static void archive_release(struct archive_extract_s *x)
+{
+	if(SDL_AtomicDecRef(&x->refs) == SDL_FALSE)
+		return;
+
+	if(x->done != NULL)
+		SDL_DestroySemaphore(x->done);
+
+	SDL_free(x);
+}
+
+static void archive_job(void *arg)
+{
+	struct archive_extract_s *x = arg;
+
+	while(archive_claim(x) == 0)
+		SDL_SemPost(x->done);
+
+	archive_release(x);
+}
+
+int archive_extract(archive_ctx *ctx, unsigned n, const unsigned *entries,
+		    void *const *dst, archive_progress_fn progress, void *priv)
+{
+	struct archive_extract_s *x;
+	unsigned i, waits;
+	int ret = 0;
+
+	if(n == 0)
+		return 0;
+
+	x = SDL_calloc(1, sizeof(*x) + n * sizeof(struct archive_job_s));
+	if(x == NULL)
+		return SDL_OutOfMemory();
+
+	if(n > 1)
+	{
+		x->done = SDL_CreateSemaphore(0);
+		if(x->done == NULL)
+		{
+			SDL_free(x);
+			return -1;
+		}
+	}
+
+	x->n = n;
+	x->progress = progress;
+	x->priv = priv;
+	SDL_AtomicSet(&x->next, 0);
+	SDL_AtomicSet(&x->refs, (int)n);
+	SDL_AtomicSet(&x->steps, 0);
+	SDL_AtomicSet(&x->cancel, 0);
+
+	for(i = 0; i < n; i++)
+	{
+		SDL_assert(entries[i] < ctx->count);
+		x->jobs[i].e = &ctx->entries[entries[i]];
+		x->jobs[i].dst = dst[i];
+		x->total += (ctx->entries[entries[i]].size + ARCHIVE_STEP - 1) /
+			ARCHIVE_STEP;
+	}
+
+	/* Helpers decompress entries in parallel with the calling thread,
+	 * which also decompresses entries until none remain. This completes
+	 * even if no worker is free, such as when called by a worker. */
+	for(i = 1; i < n; i++)
+		job_submit(JOB_PRIO_HIGH, archive_job, x);
+
+	waits = n;
+	while(archive_claim(x) == 0)
+		waits--;
+
+	/* Wait for the entries still being decompressed by helpers. */
+	while(waits-- > 0)
+		SDL_SemWait(x->done);
+
+	for(i = 0; i < n; i++)
+	{
+		if(x->jobs[i].ret != 0)
+		{
+			ret = SDL_SetError("%s", x->jobs[i].err);
+			break;
+		}
+	}
+
+	archive_release(x);
+	return ret;
+}
+
+void archive_close(archive_ctx *ctx)
+{
+	unsigned i;
+
+	if(ctx == NULL)
+		return;
+
+	if(ctx->entries != NULL)
+	{
+		for(i = 0; i < ctx->count; i++)
+			SDL_free(ctx->entries[i].name);
+
+		SDL_free(ctx->entries);
+	}
+
+	fmap_close(ctx->map);
+	SDL_free(ctx);
+}
@@ -0,0 +1,501 @@
+/**
+ * Audio output for libretro cores.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#include <SDL.h>
+#include <audio.h>
+#include <resample.h>
+
+/* Size of a stereo signed 16-bit frame in bytes. */
+#define AUDIO_FRAME_SZ		(2 * sizeof(Sint16))
+
+/* Number of core frames resampled at a time. */
+#define AUDIO_RESAMPLE_CHUNK	1024
+
+/* Sample rate used if the native rate of the device is unknown. */
+#define AUDIO_FALLBACK_RATE	48000
+
+/* Limits of the number of frames requested by each device callback. */
+#define AUDIO_MIN_DEV_SAMPLES	128
+#define AUDIO_MAX_DEV_SAMPLES	4096
+
+struct audio_s {
+	SDL_AudioDeviceID dev;
+	Uint8 silence;
+	Uint8 playing;
+
+	/* Sample rate of the device in Hz. */
+	Uint32 rate;
+
+	/* Maximum number of frames queued. The target may be raised above the
+	 * initial target by audio_set_min_latency(), up to the capacity of
+	 * the ring buffer. */
+	SDL_atomic_t target;
+	Uint32 init_target;
+
+	/* Converts audio from the core to the rate of the device. NULL if the
+	 * rates are identical. */
+	resample_ctx *rs;
+	Sint16 *rs_buf;
+
+	/* Ring buffer of interleaved stereo frames. The capacity is a power of
+	 * two, such that the free running indexes may be masked. The write
+	 * index is only modified by audio_write(), and the read index is only
+	 * modified by the device callback. */
+	Sint16 *ring;
+	Uint32 mask;
+	SDL_atomic_t wr;
+	SDL_atomic_t rd;
+
+	/* Modified by the device callback. Read with the device locked. */
+	struct audio_stats_s st;
+
+	/* Thread that asks the core for audio as space becomes available.
+	 * The mutex is held whilst the core is writing audio, such that other
+	 * threads may exclude the producer. */
+	struct {
+		SDL_Thread *th;
+		SDL_threadID tid;
+		SDL_mutex *mtx;
+		SDL_sem *sem;
+		SDL_atomic_t quit;
+
+		audio_produce_fn produce;
+		audio_state_fn state;
+		void *priv;
+	} prod;
+};
+
+static Uint32 audio_pow2_ceil(Uint32 x)
+{
+	Uint32 p = 1;
+
+	while(p < x)
+		p <<= 1;
+
+	return p;
+}
+
+static void SDLCALL audio_callback(void *userdata, Uint8 *stream, int len)
+{
+	audio_ctx *ctx = userdata;
+	Uint32 want = (Uint32)len / AUDIO_FRAME_SZ;
+	Uint32 rd = (Uint32)SDL_AtomicGet(&ctx->rd);
+	Uint32 avail = (Uint32)SDL_AtomicGet(&ctx->wr) - rd;
+	Uint32 n = avail < want ? avail : want;
+	Uint32 pos = rd & ctx->mask;
+	Uint32 first = ctx->mask + 1 - pos;
+
+	/* Do not read frames before they have been fully written. */
+	SDL_MemoryBarrierAcquire();
+
+	if(first > n)
+		first = n;
+
+	SDL_memcpy(stream, ctx->ring + (pos * 2), first * AUDIO_FRAME_SZ);
+	SDL_memcpy(stream + (first * AUDIO_FRAME_SZ), ctx->ring,
+		   (n - first) * AUDIO_FRAME_SZ);
+
+	/* Free the frames only once they have been read. */
+	SDL_MemoryBarrierRelease();
+	SDL_AtomicSet(&ctx->rd, (int)(rd + n));
+
+	/* Wake the producer, if it is waiting for space. */
+	if(ctx->prod.sem != NULL && SDL_SemValue(ctx->prod.sem) == 0)
+		SDL_SemPost(ctx->prod.sem);
+
+	ctx->st.frames_played += n;
+	if(n == want)
+		return;
+
+	SDL_memset(stream + (n * AUDIO_FRAME_SZ), ctx->silence,
+		   (want - n) * AUDIO_FRAME_SZ);
+	ctx->st.underruns++;
+	ctx->st.frames_silence += want - n;
+}
+
+/**
+ * Obtain the native sample rate of the default audio device.
+ */
+static int audio_native_rate(void)
+{
+#if SDL_VERSION_ATLEAST(2, 24, 0)
+	SDL_AudioSpec spec;
+
+	if(SDL_GetDefaultAudioInfo(NULL, &spec, 0) == 0 && spec.freq > 0)
+		return spec.freq;
+#endif
+
+	return AUDIO_FALLBACK_RATE;
+}
+
+audio_ctx *audio_init(double sample_rate, Uint32 latency_ms,
+		      resample_quality_e quality)
+{
+	audio_ctx *ctx;
+	SDL_AudioSpec want = { 0 };
+	SDL_AudioSpec have;
+	Uint32 target, dev_samples, ring;
+	int rate;
+
+	if(sample_rate < 1.0)
+	{
+		SDL_SetError("Invalid sample rate %.1f Hz", sample_rate);
+		return NULL;
+	}
+
+	if(latency_ms == 0)
+		latency_ms = AUDIO_DEFAULT_LATENCY_MS;
+
+	rate = audio_native_rate();
+	target = (Uint32)(((double)rate * latency_ms) / 1000.0);
+
+	/* The device requests a quarter of the target latency at a time, so
+	 * that the ring buffer is refilled several times before it runs
+	 * out. */
+	dev_samples = audio_pow2_ceil(target / 4 + 1) >> 1;
+	if(dev_samples < AUDIO_MIN_DEV_SAMPLES)
+		dev_samples = AUDIO_MIN_DEV_SAMPLES;
+	else if(dev_samples > AUDIO_MAX_DEV_SAMPLES)
+		dev_samples = AUDIO_MAX_DEV_SAMPLES;
+
+	ctx = SDL_calloc(1, sizeof(audio_ctx));
+	if(ctx == NULL)
+		goto err;
+
+	want.freq = rate;
+	want.format = AUDIO_S16SYS;
+	want.channels = 2;
+	want.samples = (Uint16)dev_samples;
+	want.callback = audio_callback;
+	want.userdata = ctx;
+
+	/* Conversion is performed by the resampler instead of SDL, so the
+	 * device may be opened at any rate. */
+	ctx->dev = SDL_OpenAudioDevice(NULL, 0, &want, &have,
+				       SDL_AUDIO_ALLOW_FREQUENCY_CHANGE);
+	if(ctx->dev == 0)
+		goto err;
+
+	if(have.freq != rate)
+	{
+		rate = have.freq;
+		target = (Uint32)(((double)rate * latency_ms) / 1000.0);
+	}
+
+	if(target < (Uint32)have.samples * 2)
+		target = (Uint32)have.samples * 2;
+
+	ctx->silence = have.silence;
+	ctx->rate = (Uint32)rate;
+	ctx->init_target = target;
+	SDL_AtomicSet(&ctx->target, (int)target);
+
+	/* Leave room in the ring buffer for the largest latency that may be
+	 * requested by the core. */
+	ring = (Uint32)(((double)rate * AUDIO_MAX_LATENCY_MS) / 1000.0);
+	if(ring < target)
+		ring = target;
+
+	ctx->mask = audio_pow2_ceil(ring) - 1;
+	ctx->ring = SDL_malloc((ctx->mask + 1) * AUDIO_FRAME_SZ);
+	if(ctx->ring == NULL)
+		goto err;
+
+	if(sample_rate != (double)rate)
+	{
+		ctx->rs = resample_init(sample_rate, rate, quality);
+		if(ctx->rs == NULL)
+			goto err;
+
+		ctx->rs_buf = SDL_malloc(resample_max_output(ctx->rs,
+				AUDIO_RESAMPLE_CHUNK) * AUDIO_FRAME_SZ);
+		if(ctx->rs_buf == NULL)
+			goto err;
+
+		SDL_LogVerbose(SDL_LOG_CATEGORY_AUDIO,
+			       "Resampling audio from %.1f Hz to %d Hz with %s",
+			       sample_rate, rate, resample_get_isa(ctx->rs));
+	}
+
+	SDL_LogVerbose(SDL_LOG_CATEGORY_AUDIO,
+		       "Opened audio device at %d Hz with %u sample buffers "
+		       "and a target latency of %" SDL_PRIu32 " frames",
+		       rate, have.samples, target);
+
+	return ctx;
+
+err:
+	audio_exit(ctx);
+	return NULL;
+}
+
+static Uint32 audio_write_ring(audio_ctx *ctx, const Sint16 *data,
+			       Uint32 frames)
+{
+	Uint32 wr = (Uint32)SDL_AtomicGet(&ctx->wr);
+	Uint32 queued = wr - (Uint32)SDL_AtomicGet(&ctx->rd);
+	Uint32 target = (Uint32)SDL_AtomicGet(&ctx->target);
+	Uint32 space = target > queued ? target - queued : 0;
+	Uint32 n = frames < space ? frames : space;
+	Uint32 pos = wr & ctx->mask;
+	Uint32 first = ctx->mask + 1 - pos;
+
+	/* Do not overwrite frames before they have been read. */
+	SDL_MemoryBarrierAcquire();
+
+	if(first > n)
+		first = n;
+
+	SDL_memcpy(ctx->ring + (pos * 2), data, first * AUDIO_FRAME_SZ);
+	SDL_memcpy(ctx->ring, data + (first * 2), (n - first) * AUDIO_FRAME_SZ);
+
+	/* Publish the frames to the device callback. */
+	SDL_MemoryBarrierRelease();
+	SDL_AtomicSet(&ctx->wr, (int)(wr + n));
+
+	if(n < frames)
+	{
+		/* Only modified by this thread, so the device does not need
+		 * to be locked. */
+		ctx->st.overruns++;
+		ctx->st.frames_dropped += frames - n;
+	}
+
+	/* Start playback with some frames queued, such that the device does
+	 * not immediately underrun. */
+	if(ctx->playing == 0 && queued + n >= target / 2)
+	{
+		SDL_PauseAudioDevice(ctx->dev, 0);
+		ctx->playing = 1;
+	}
+
+	return n;
+}
+
+static void audio_write_locked(audio_ctx *ctx, const Sint16 *data,
+			       Uint32 frames)
+{
+	Uint32 done = 0;
+
+	if(ctx->rs == NULL)
+	{
+		audio_write_ring(ctx, data, frames);
+		return;
+	}
+
+	while(done < frames)
+	{
+		Uint32 n = frames - done;
+		Uint32 out;
+
+		if(n > AUDIO_RESAMPLE_CHUNK)
+			n = AUDIO_RESAMPLE_CHUNK;
+
+		out = resample_process(ctx->rs, data + (done * 2), n,
+				       ctx->rs_buf);
+		audio_write_ring(ctx, ctx->rs_buf, out);
+		done += n;
+	}
+}
+
+void audio_write(audio_ctx *ctx, const Sint16 *data, Uint32 frames)
+{
+	/* The ring buffer only supports a single producer. Audio written by
+	 * another thread whilst the producer thread is running must not
+	 * interleave with it. */
+	if(ctx->prod.th != NULL && SDL_ThreadID() != ctx->prod.tid)
+	{
+		SDL_LockMutex(ctx->prod.mtx);
+		audio_write_locked(ctx, data, frames);
+		SDL_UnlockMutex(ctx->prod.mtx);
+		return;
+	}
+
+	audio_write_locked(ctx, data, frames);
+}
+
+static int audio_producer(void *param)
+{
+	audio_ctx *ctx = param;
+
+	SDL_SetThreadPriority(SDL_THREAD_PRIORITY_HIGH);
+
+	if(ctx->prod.state != NULL)
+		ctx->prod.state(ctx->prod.priv, SDL_TRUE);
+
+	while(SDL_AtomicGet(&ctx->prod.quit) == 0)
+	{
+		Uint32 before = audio_queued(ctx);
+
+		/* Wait until a device callback has freed some space. */
+		if(before >= audio_target(ctx))
+		{
+			SDL_SemWaitTimeout(ctx->prod.sem, 10);
+			continue;
+		}
+
+		SDL_LockMutex(ctx->prod.mtx);
+		ctx->prod.produce(ctx->prod.priv);
+		SDL_UnlockMutex(ctx->prod.mtx);
+
+		/* Do not spin if the core had nothing to write. */
+		if(audio_queued(ctx) <= before)
+			SDL_SemWaitTimeout(ctx->prod.sem, 10);
+	}
+
+	if(ctx->prod.state != NULL)
+		ctx->prod.state(ctx->prod.priv, SDL_FALSE);
+
+	return 0;
+}
+
+int audio_start_producer(audio_ctx *ctx, audio_produce_fn produce,
+			 audio_state_fn state, void *priv)
+{
+	SDL_assert(ctx->prod.th == NULL);
+
+	ctx->prod.produce = produce;
+	ctx->prod.state = state;
+	ctx->prod.priv = priv;
+	SDL_AtomicSet(&ctx->prod.quit, 0);
+
+	ctx->prod.mtx = SDL_CreateMutex();
+	ctx->prod.sem = SDL_CreateSemaphore(0);
+	if(ctx->prod.mtx == NULL || ctx->prod.sem == NULL)
+		goto err;
+
+	/* The producer waits on the mutex before it first writes audio, by
+	 * which time its thread ID is known. */
+	SDL_LockMutex(ctx->prod.mtx);
+	ctx->prod.th = SDL_CreateThread(audio_producer, "Audio Producer", ctx);
+	if(ctx->prod.th != NULL)
+		ctx->prod.tid = SDL_GetThreadID(ctx->prod.th);
+	SDL_UnlockMutex(ctx->prod.mtx);
+
+	if(ctx->prod.th == NULL)
+		goto err;
+
+	return 0;
+
+err:
+	audio_stop_producer(ctx);
+	return -1;
+}
+
+void audio_stop_producer(audio_ctx *ctx)
+{
+	if(ctx == NULL)
+		return;
+
+	if(ctx->prod.th != NULL)
+	{
+		SDL_AtomicSet(&ctx->prod.quit, 1);
+		SDL_SemPost(ctx->prod.sem);
+		SDL_WaitThread(ctx->prod.th, NULL);
+		ctx->prod.th = NULL;
+	}
+
+	if(ctx->prod.sem != NULL)
+	{
+		/* The device callback must not post a destroyed semaphore. */
+		SDL_LockAudioDevice(ctx->dev);
+		SDL_DestroySemaphore(ctx->prod.sem);
+		ctx->prod.sem = NULL;
+		SDL_UnlockAudioDevice(ctx->dev);
+	}
+
+	SDL_DestroyMutex(ctx->prod.mtx);
+	ctx->prod.mtx = NULL;
+}
+
+void audio_lock_producer(audio_ctx *ctx)
+{
+	if(ctx != NULL && ctx->prod.th != NULL)
+		SDL_LockMutex(ctx->prod.mtx);
+}
+
+void audio_unlock_producer(audio_ctx *ctx)
+{
+	if(ctx != NULL && ctx->prod.th != NULL)
+		SDL_UnlockMutex(ctx->prod.mtx);
+}
+
+Uint32 audio_queued(audio_ctx *ctx)
+{
+	return (Uint32)SDL_AtomicGet(&ctx->wr) - (Uint32)SDL_AtomicGet(&ctx->rd);
+}
+
+Uint32 audio_target(audio_ctx *ctx)
+{
+	return (Uint32)SDL_AtomicGet(&ctx->target);
+}
+
+Uint32 audio_rate(const audio_ctx *ctx)
+{
+	return ctx->rate;
+}
+
+void audio_set_min_latency(audio_ctx *ctx, Uint32 latency_ms)
+{
+	Uint32 target;
+
+	if(latency_ms > AUDIO_MAX_LATENCY_MS)
+		latency_ms = AUDIO_MAX_LATENCY_MS;
+
+	target = (Uint32)(((double)ctx->rate * latency_ms) / 1000.0);
+
+	/* The latency is never reduced below that given to audio_init(). */
+	if(target < ctx->init_target)
+		target = ctx->init_target;
+
+	if(target > ctx->mask + 1)
+		target = ctx->mask + 1;
+
+	SDL_AtomicSet(&ctx->target, (int)target);
+	SDL_LogVerbose(SDL_LOG_CATEGORY_AUDIO,
+		       "Target latency set to %" SDL_PRIu32 " frames", target);
+}
+
+void audio_get_stats(audio_ctx *ctx, struct audio_stats_s *stats)
+{
+	SDL_LockAudioDevice(ctx->dev);
+	*stats = ctx->st;
+	SDL_UnlockAudioDevice(ctx->dev);
+}
+
+void audio_exit(audio_ctx *ctx)
+{
+	if(ctx == NULL)
+		return;
+
+	audio_stop_producer(ctx);
+
+	if(ctx->dev != 0)
+	{
+		SDL_CloseAudioDevice(ctx->dev);
+		SDL_LogVerbose(SDL_LOG_CATEGORY_AUDIO,
+			       "Audio played %" SDL_PRIu64 " frames; %"
+			       SDL_PRIu32 " underruns of %" SDL_PRIu64
+			       " frames; %" SDL_PRIu32 " overruns of %"
+			       SDL_PRIu64 " frames",
+			       ctx->st.frames_played, ctx->st.underruns,
+			       ctx->st.frames_silence, ctx->st.overruns,
+			       ctx->st.frames_dropped);
+	}
+
+	resample_exit(ctx->rs);
+	SDL_free(ctx->rs_buf);
+	SDL_free(ctx->ring);
+	SDL_free(ctx);
+}
@@ -0,0 +1,591 @@
+/**
+ * Cache of information obtained from libretro cores.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <SDL.h>
+#include <coreinfo.h>
+#include <util.h>
+
+/* First line of the cache file. The cache is discarded if this differs, such
+ * that the format may be changed. */
+#define COREINFO_MAGIC	"haiyajan-coreinfo 2"
+
+/* Each core is stored on a line of tab separated fields, in the order that
+ * they are in struct coreinfo_entry_s. */
+#define COREINFO_FIELDS	15
+
+/* Extension supported by a core, pointing within its valid_extensions. */
+struct coreinfo_ext_s
+{
+	const char *ext;
+	size_t len;
+	unsigned entry;
+};
+
+struct coreinfo_s
+{
+	char *filename;
+	struct coreinfo_entry_s *e;
+	unsigned n;
+
+	/* Extensions of all cores sorted by extension and then by core path.
+	 * Built when first required, and freed when an entry changes. */
+	struct coreinfo_ext_s *idx;
+	unsigned idx_n;
+
+	/* Set when the cache differs from its file. */
+	SDL_bool dirty;
+};
+
+static int coreinfo_stat(const char *path, Uint64 *size, Sint64 *mtime)
+{
+	struct stat st;
+
+	if(stat(path, &st) != 0)
+		return SDL_SetError("Unable to obtain status of %s", path);
+
+	*size = (Uint64)st.st_size;
+	*mtime = (Sint64)st.st_mtime;
+	return 0;
+}
+
+/**
+ * Duplicate a string given by a core. Tabs and new lines are replaced, such
+ * that the string may be stored as a field.
+ */
+static char *coreinfo_strdup(const char *str)
+{
+	char *ret, *c;
+
+	ret = SDL_strdup(str != NULL ? str : "");
+	if(ret == NULL)
+		return NULL;
+
+	for(c = ret; *c != '\0'; c++)
+	{
+		if(*c == '\t' || *c == '\n' || *c == '\r')
+			*c = ' ';
+	}
+
+	return ret;
+}
+
+/**
+ * Check whether a string given by the file system may be stored as a field.
+ */
+static SDL_bool coreinfo_is_field(const char *str)
+{
+	for(; *str != '\0'; str++)
+	{
+		if(*str == '\t' || *str == '\n' || *str == '\r')
+			return SDL_FALSE;
+	}
+
+	return SDL_TRUE;
+}
+
+static void coreinfo_free_entry(struct coreinfo_entry_s *e)
+{
+	SDL_free(e->path);
+	SDL_free(e->library_name);
+	SDL_free(e->library_version);
+	SDL_free(e->valid_extensions);
+	SDL_free(e->license);
+}
+
+static void coreinfo_changed(coreinfo_ctx *ctx)
+{
+	SDL_free(ctx->idx);
+	ctx->idx = NULL;
+	ctx->idx_n = 0;
+	ctx->dirty = SDL_TRUE;
+}
+
+static int coreinfo_add(coreinfo_ctx *ctx, const struct coreinfo_entry_s *e)
+{
+	struct coreinfo_entry_s *tmp;
+
+	tmp = SDL_realloc(ctx->e, (ctx->n + 1) * sizeof(*tmp));
+	if(tmp == NULL)
+		return SDL_OutOfMemory();
+
+	ctx->e = tmp;
+	ctx->e[ctx->n++] = *e;
+	return 0;
+}
+
+/**
+ * Parse a line of the cache file. The line is modified.
+ */
+static int coreinfo_parse(coreinfo_ctx *ctx, char *line)
+{
+	struct coreinfo_entry_s e;
+	char *f[COREINFO_FIELDS];
+	unsigned i;
+
+	for(i = 0; i < COREINFO_FIELDS; i++)
+	{
+		char *tab = SDL_strchr(line, '\t');
+
+		f[i] = line;
+		if(tab == NULL)
+			break;
+
+		*tab = '\0';
+		line = tab + 1;
+	}
+
+	/* Lines with too few or too many fields are ignored. */
+	if(i != COREINFO_FIELDS - 1)
+		return 0;
+
+	SDL_zero(e);
+	e.size = SDL_strtoull(f[1], NULL, 10);
+	e.mtime = SDL_strtoll(f[2], NULL, 10);
+	e.need_fullpath = SDL_atoi(f[6]) != 0 ? SDL_TRUE : SDL_FALSE;
+	e.av_info.geometry.base_width = (unsigned)SDL_strtoul(f[8], NULL, 10);
+	e.av_info.geometry.base_height = (unsigned)SDL_strtoul(f[9], NULL, 10);
+	e.av_info.geometry.max_width = (unsigned)SDL_strtoul(f[10], NULL, 10);
+	e.av_info.geometry.max_height = (unsigned)SDL_strtoul(f[11], NULL, 10);
+	e.av_info.geometry.aspect_ratio = (float)SDL_strtod(f[12], NULL);
+	e.av_info.timing.fps = SDL_strtod(f[13], NULL);
+	e.av_info.timing.sample_rate = SDL_strtod(f[14], NULL);
+
+	e.path = SDL_strdup(f[0]);
+	e.library_name = SDL_strdup(f[3]);
+	e.library_version = SDL_strdup(f[4]);
+	e.valid_extensions = SDL_strdup(f[5]);
+	e.license = SDL_strdup(f[7]);
+
+	if(e.path == NULL || e.library_name == NULL ||
+		e.library_version == NULL || e.valid_extensions == NULL ||
+		e.license == NULL || coreinfo_add(ctx, &e) != 0)
+	{
+		coreinfo_free_entry(&e);
+		return SDL_OutOfMemory();
+	}
+
+	return 0;
+}
+
+coreinfo_ctx *coreinfo_open(const char *filename)
+{
+	coreinfo_ctx *ctx;
+	char *dat, *line;
+	size_t len;
+
+	ctx = SDL_calloc(1, sizeof(coreinfo_ctx));
+	if(ctx == NULL)
+	{
+		SDL_OutOfMemory();
+		return NULL;
+	}
+
+	ctx->filename = SDL_strdup(filename);
+	if(ctx->filename == NULL)
+	{
+		SDL_OutOfMemory();
+		goto err;
+	}
+
+	/* The cache is empty until saved for the first time. */
+	dat = SDL_LoadFile(filename, &len);
+	if(dat == NULL)
+		return ctx;
+
+	line = dat;
+	while(line < dat + len)
+	{
+		char *end = SDL_strchr(line, '\n');
+
+		if(end != NULL)
+			*end = '\0';
+
+		if(line == dat)
+		{
+			if(SDL_strcmp(line, COREINFO_MAGIC) != 0)
+			{
+				SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+					    "Ignoring incompatible core "
+					    "information cache %s", filename);
+				break;
+			}
+		}
+		else if(coreinfo_parse(ctx, line) != 0)
+		{
+			SDL_free(dat);
+			goto err;
+		}
+
+		if(end == NULL)
+			break;
+
+		line = end + 1;
+	}
+
+	SDL_free(dat);
+	return ctx;
+
+err:
+	coreinfo_close(ctx);
+	return NULL;
+}
+
+static struct coreinfo_entry_s *coreinfo_lookup(const coreinfo_ctx *ctx,
+		const char *core_path)
+{
+	unsigned i;
+
+	for(i = 0; i < ctx->n; i++)
+	{
+		if(SDL_strcmp(ctx->e[i].path, core_path) == 0)
+			return &ctx->e[i];
+	}
+
+	return NULL;
+}
+
+/**
+ * Check that a core has not changed since its information was cached.
+ */
+static SDL_bool coreinfo_valid(const struct coreinfo_entry_s *e)
+{
+	Uint64 size;
+	Sint64 mtime;
+
+	if(coreinfo_stat(e->path, &size, &mtime) != 0)
+		return SDL_FALSE;
+
+	return size == e->size && mtime == e->mtime;
+}
+
+const struct coreinfo_entry_s *coreinfo_find(const coreinfo_ctx *ctx,
+		const char *core_path)
+{
+	const struct coreinfo_entry_s *e;
+
+	if(ctx == NULL || core_path == NULL)
+		return NULL;
+
+	e = coreinfo_lookup(ctx, core_path);
+	if(e == NULL || coreinfo_valid(e) == SDL_FALSE)
+		return NULL;
+
+	return e;
+}
+
+static int coreinfo_ext_cmp(const char *a, size_t a_len, const char *b,
+		size_t b_len)
+{
+	int r = SDL_strncasecmp(a, b, SDL_min(a_len, b_len));
+
+	if(r != 0)
+		return r;
+
+	return (a_len > b_len) - (a_len < b_len);
+}
+
+/* Path of each entry compared whilst sorting the index. */
+static const struct coreinfo_entry_s *coreinfo_sort_e;
+
+static int coreinfo_idx_cmp(const void *a, const void *b)
+{
+	const struct coreinfo_ext_s *x = a, *y = b;
+	int r = coreinfo_ext_cmp(x->ext, x->len, y->ext, y->len);
+
+	if(r != 0)
+		return r;
+
+	return SDL_strcmp(coreinfo_sort_e[x->entry].path,
+			  coreinfo_sort_e[y->entry].path);
+}
+
+static int coreinfo_build_idx(coreinfo_ctx *ctx)
+{
+	unsigned i, n = 0;
+
+	for(i = 0; i < ctx->n; i++)
+	{
+		const char *c;
+
+		for(c = ctx->e[i].valid_extensions; *c != '\0'; c++)
+			n += *c == '|';
+
+		n++;
+	}
+
+	ctx->idx = SDL_malloc(n * sizeof(*ctx->idx) + 1);
+	if(ctx->idx == NULL)
+		return SDL_OutOfMemory();
+
+	ctx->idx_n = 0;
+	for(i = 0; i < ctx->n; i++)
+	{
+		const char *exts = ctx->e[i].valid_extensions;
+
+		while(*exts != '\0')
+		{
+			const char *end = SDL_strchr(exts, '|');
+			size_t len = end != NULL ? (size_t)(end - exts) :
+				SDL_strlen(exts);
+
+			if(len != 0)
+			{
+				struct coreinfo_ext_s *x = &ctx->idx[ctx->idx_n++];
+
+				x->ext = exts;
+				x->len = len;
+				x->entry = i;
+			}
+
+			if(end == NULL)
+				break;
+
+			exts = end + 1;
+		}
+	}
+
+	coreinfo_sort_e = ctx->e;
+	SDL_qsort(ctx->idx, ctx->idx_n, sizeof(*ctx->idx), coreinfo_idx_cmp);
+	coreinfo_sort_e = NULL;
+
+	return 0;
+}
+
+const struct coreinfo_entry_s *coreinfo_find_ext(coreinfo_ctx *ctx,
+		const char *content)
+{
+	const char *ext;
+	size_t ext_len;
+	unsigned lo, hi;
+
+	if(ctx == NULL || content == NULL)
+		return NULL;
+
+	ext = SDL_strrchr(content, '.');
+	if(ext == NULL || SDL_strchr(ext, '/') != NULL ||
+	   SDL_strchr(ext, '\\') != NULL)
+		return NULL;
+
+	ext++;
+	ext_len = SDL_strlen(ext);
+
+	if(ctx->idx == NULL && coreinfo_build_idx(ctx) != 0)
+		return NULL;
+
+	/* Find the first core supporting the extension. */
+	lo = 0;
+	hi = ctx->idx_n;
+	while(lo < hi)
+	{
+		unsigned mid = lo + (hi - lo) / 2;
+		const struct coreinfo_ext_s *x = &ctx->idx[mid];
+
+		if(coreinfo_ext_cmp(x->ext, x->len, ext, ext_len) < 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	for(; lo < ctx->idx_n; lo++)
+	{
+		const struct coreinfo_ext_s *x = &ctx->idx[lo];
+
+		if(coreinfo_ext_cmp(x->ext, x->len, ext, ext_len) != 0)
+			break;
+
+		if(coreinfo_valid(&ctx->e[x->entry]))
+			return &ctx->e[x->entry];
+	}
+
+	return NULL;
+}
+
+static SDL_bool coreinfo_equal(const struct coreinfo_entry_s *a,
+		const struct coreinfo_entry_s *b)
+{
+	const struct retro_game_geometry *ag = &a->av_info.geometry;
+	const struct retro_game_geometry *bg = &b->av_info.geometry;
+
+	return a->size == b->size && a->mtime == b->mtime &&
+		a->need_fullpath == b->need_fullpath &&
+		SDL_strcmp(a->library_name, b->library_name) == 0 &&
+		SDL_strcmp(a->library_version, b->library_version) == 0 &&
+		SDL_strcmp(a->valid_extensions, b->valid_extensions) == 0 &&
+		SDL_strcmp(a->license, b->license) == 0 &&
+		ag->base_width == bg->base_width &&
+		ag->base_height == bg->base_height &&
+		ag->max_width == bg->max_width &&
+		ag->max_height == bg->max_height &&
+		ag->aspect_ratio == bg->aspect_ratio &&
+		a->av_info.timing.fps == b->av_info.timing.fps &&
+		a->av_info.timing.sample_rate == b->av_info.timing.sample_rate;
+}
+
+int coreinfo_set(coreinfo_ctx *ctx, const char *core_path,
+		 const struct retro_system_info *sys,
+		 const struct retro_system_av_info *av, const char *license)
+{
+	struct coreinfo_entry_s e;
+	struct coreinfo_entry_s *old;
+
+	SDL_zero(e);
+	if(coreinfo_stat(core_path, &e.size, &e.mtime) != 0)
+		return -1;
+
+	old = coreinfo_lookup(ctx, core_path);
+	e.need_fullpath = sys->need_fullpath ? SDL_TRUE : SDL_FALSE;
+
+	/* Information of a core that has since changed is not kept. */
+	if(av != NULL)
+		e.av_info = *av;
+	else if(old != NULL && old->size == e.size && old->mtime == e.mtime)
+		e.av_info = old->av_info;
+
+	e.path = SDL_strdup(core_path);
+	e.library_name = coreinfo_strdup(sys->library_name);
+	e.library_version = coreinfo_strdup(sys->library_version);
+	e.valid_extensions = coreinfo_strdup(sys->valid_extensions);
+	e.license = coreinfo_strdup(license);
+
+	if(e.path == NULL || e.library_name == NULL ||
+		e.library_version == NULL || e.valid_extensions == NULL ||
+		e.license == NULL)
+	{
+		coreinfo_free_entry(&e);
+		return SDL_OutOfMemory();
+	}
+
+	if(old != NULL)
+	{
+		if(coreinfo_equal(old, &e))
+		{
+			coreinfo_free_entry(&e);
+			return 0;
+		}
+
+		coreinfo_free_entry(old);
+		*old = e;
+	}
+	else if(coreinfo_add(ctx, &e) != 0)
+	{
+		coreinfo_free_entry(&e);
+		return -1;
+	}
+
+	coreinfo_changed(ctx);
+	return 0;
+}
+
+unsigned coreinfo_prune(coreinfo_ctx *ctx)
+{
+	unsigned i = 0, removed = 0;
+	Uint64 size;
+	Sint64 mtime;
+
+	while(i < ctx->n)
+	{
+		if(coreinfo_stat(ctx->e[i].path, &size, &mtime) == 0)
+		{
+			i++;
+			continue;
+		}
+
+		coreinfo_free_entry(&ctx->e[i]);
+		SDL_memmove(&ctx->e[i], &ctx->e[i + 1],
+			    (ctx->n - i - 1) * sizeof(*ctx->e));
+		ctx->n--;
+		removed++;
+	}
+
+	if(removed != 0)
+		coreinfo_changed(ctx);
+
+	return removed;
+}
+
+int coreinfo_save(coreinfo_ctx *ctx)
+{
+	char *buf;
+	size_t cap = sizeof(COREINFO_MAGIC "\n");
+	size_t len = 0;
+	unsigned i;
+	int ret;
+
+	if(ctx->dirty == SDL_FALSE)
+		return 0;
+
+	/* Numeric fields are at most 32 characters each. */
+	for(i = 0; i < ctx->n; i++)
+	{
+		const struct coreinfo_entry_s *e = &ctx->e[i];
+
+		cap += SDL_strlen(e->path) + SDL_strlen(e->library_name) +
+			SDL_strlen(e->library_version) +
+			SDL_strlen(e->valid_extensions) +
+			SDL_strlen(e->license) +
+			(COREINFO_FIELDS - 5) * 32 + COREINFO_FIELDS;
+	}
+
+	buf = SDL_malloc(cap);
+	if(buf == NULL)
+		return SDL_OutOfMemory();
+
+	len += SDL_snprintf(buf, cap, "%s\n", COREINFO_MAGIC);
+	for(i = 0; i < ctx->n; i++)
+	{
+		const struct coreinfo_entry_s *e = &ctx->e[i];
+		const struct retro_game_geometry *g = &e->av_info.geometry;
+
+		/* A core whose path cannot be stored is probed again on the
+		 * next start instead. */
+		if(coreinfo_is_field(e->path) == SDL_FALSE)
+			continue;
+
+		len += SDL_snprintf(buf + len, cap - len,
+			"%s\t%" SDL_PRIu64 "\t%" SDL_PRIs64 "\t%s\t%s\t%s\t%d"
+			"\t%s\t%u\t%u\t%u\t%u\t%.9g\t%.17g\t%.17g\n",
+			e->path, e->size, e->mtime, e->library_name,
+			e->library_version, e->valid_extensions,
+			e->need_fullpath == SDL_TRUE, e->license, g->base_width,
+			g->base_height, g->max_width, g->max_height,
+			(double)g->aspect_ratio, e->av_info.timing.fps,
+			e->av_info.timing.sample_rate);
+	}
+
+	ret = util_write_file(ctx->filename, buf, len);
+	if(ret == 0)
+		ctx->dirty = SDL_FALSE;
+
+	SDL_free(buf);
+	return ret;
+}
+
+void coreinfo_close(coreinfo_ctx *ctx)
+{
+	unsigned i;
+
+	if(ctx == NULL)
+		return;
+
+	for(i = 0; i < ctx->n; i++)
+		coreinfo_free_entry(&ctx->e[i]);
+
+	SDL_free(ctx->e);
+	SDL_free(ctx->idx);
+	SDL_free(ctx->filename);
+	SDL_free(ctx);
+}
@@ -0,0 +1,366 @@
+/**
+ * Disk control of libretro cores that play content spanning multiple images.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#include <SDL.h>
+
+#include <disk.h>
+#include <fmap.h>
+#include <haiyajan.h>
+#include <job.h>
+#include <libretro.h>
+
+struct disk_s
+{
+	char **paths;
+	unsigned n;
+};
+
+/**
+ * Check whether a path within a playlist is absolute.
+ */
+static SDL_bool disk_is_absolute(const char *path)
+{
+	if(path[0] == '/' || path[0] == '\\')
+		return SDL_TRUE;
+
+	/* Drive letter on Windows. */
+	if(path[0] != '\0' && path[1] == ':')
+		return SDL_TRUE;
+
+	return SDL_FALSE;
+}
+
+/**
+ * Add an image to the playlist, relative to the directory of the playlist
+ * given by the first dir_len characters of dir.
+ */
+static int disk_add(disk_ctx *ctx, const char *dir, size_t dir_len,
+		    const char *path)
+{
+	char **paths;
+	char *p;
+	size_t len;
+
+	if(disk_is_absolute(path))
+		dir_len = 0;
+
+	paths = SDL_realloc(ctx->paths, (ctx->n + 1) * sizeof(*paths));
+	if(paths == NULL)
+		return SDL_OutOfMemory();
+
+	ctx->paths = paths;
+
+	len = dir_len + SDL_strlen(path) + 1;
+	p = SDL_malloc(len);
+	if(p == NULL)
+		return SDL_OutOfMemory();
+
+	SDL_memcpy(p, dir, dir_len);
+	SDL_strlcpy(p + dir_len, path, len - dir_len);
+	ctx->paths[ctx->n++] = p;
+
+	return 0;
+}
+
+disk_ctx *disk_open_m3u(const char *filename)
+{
+	disk_ctx *ctx;
+	char *m3u, *line;
+	size_t len, dir_len;
+	const char *sep;
+
+	m3u = SDL_LoadFile(filename, &len);
+	if(m3u == NULL)
+		return NULL;
+
+	ctx = SDL_calloc(1, sizeof(*ctx));
+	if(ctx == NULL)
+	{
+		SDL_OutOfMemory();
+		goto err;
+	}
+
+	/* Images are relative to the directory of the playlist. */
+	sep = SDL_strrchr(filename, '/');
+#ifdef _WIN32
+	if(SDL_strrchr(filename, '\\') > sep)
+		sep = SDL_strrchr(filename, '\\');
+#endif
+	dir_len = sep != NULL ? (size_t)(sep - filename) + 1 : 0;
+
+	/* SDL_LoadFile() terminates the file with a null character. */
+	for(line = m3u; line != NULL && *line != '\0';)
+	{
+		char *end = SDL_strchr(line, '\n');
+		char *label;
+		size_t line_len;
+
+		if(end != NULL)
+			*end++ = '\0';
+
+		/* Labels are not used. */
+		label = SDL_strchr(line, '|');
+		if(label != NULL)
+			*label = '\0';
+
+		/* Remove carriage returns and trailing spaces. */
+		line_len = SDL_strlen(line);
+		while(line_len > 0 && (line[line_len - 1] == '\r' ||
+				line[line_len - 1] == ' ' ||
+				line[line_len - 1] == '\t'))
+		{
+			line[--line_len] = '\0';
+		}
+
+		if(line_len > 0 && line[0] != '#' &&
+			disk_add(ctx, filename, dir_len, line) != 0)
+		{
+			goto err;
+		}
+
+		line = end;
+	}
+
+	if(ctx->n == 0)
+	{
+		SDL_SetError("No disk images were found within %s", filename);
+		goto err;
+	}
+
+	SDL_free(m3u);
+	return ctx;
+
+err:
+	SDL_free(m3u);
+	disk_close(ctx);
+	return NULL;
+}
+
+unsigned disk_count(const disk_ctx *ctx)
+{
+	return ctx->n;
+}
+
+const char *disk_path(const disk_ctx *ctx, unsigned index)
+{
+	if(index >= ctx->n)
+		return NULL;
+
+	return ctx->paths[index];
+}
+
+void disk_close(disk_ctx *ctx)
+{
+	unsigned i;
+
+	if(ctx == NULL)
+		return;
+
+	for(i = 0; i < ctx->n; i++)
+		SDL_free(ctx->paths[i]);
+
+	SDL_free(ctx->paths);
+	SDL_free(ctx);
+}
+
+static void disk_prefetch_job(void *arg)
+{
+	char *path = arg;
+	Uint32 ticks = SDL_GetTicks();
+
+	if(fmap_prefetch(path) != 0)
+	{
+		SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+			    "Unable to prefetch disk image: %s",
+			    SDL_GetError());
+	}
+	else
+	{
+		SDL_LogVerbose(SDL_LOG_CATEGORY_APPLICATION,
+			       "Prefetched %s in %u ms", path,
+			       SDL_GetTicks() - ticks);
+	}
+
+	SDL_free(path);
+}
+
+void disk_prefetch(const char *path)
+{
+	char *arg = SDL_strdup(path);
+
+	if(arg == NULL)
+		return;
+
+	job_submit(JOB_PRIO_LOW, disk_prefetch_job, arg);
+}
+
+/**
+ * Check whether the core has set a disk control interface.
+ */
+static SDL_bool disk_supported(const struct core_ctx_s *ctx)
+{
+	const struct retro_disk_control_ext_callback *cb = &ctx->env.disk_cb;
+
+	return cb->set_eject_state != NULL && cb->get_eject_state != NULL &&
+		cb->get_image_index != NULL && cb->set_image_index != NULL &&
+		cb->get_num_images != NULL;
+}
+
+unsigned disk_num_images(const struct core_ctx_s *ctx)
+{
+	if(!disk_supported(ctx))
+		return 0;
+
+	return ctx->env.disk_cb.get_num_images();
+}
+
+/**
+ * Start reading the image that follows the given image, such that it is in
+ * the page cache before the user swaps to it.
+ */
+static void disk_prefetch_next(const struct core_ctx_s *ctx, unsigned index)
+{
+	const struct retro_disk_control_ext_callback *cb = &ctx->env.disk_cb;
+	unsigned num = cb->get_num_images();
+	char path[1024];
+
+	if(num < 2)
+		return;
+
+	index = (index + 1) % num;
+
+	/* The path is obtained from the core where possible, as the core may
+	 * have read the playlist itself. */
+	if(cb->get_image_path != NULL &&
+		cb->get_image_path(index, path, sizeof(path)) &&
+		path[0] != '\0')
+	{
+		disk_prefetch(path);
+	}
+	else if(ctx->disks != NULL && disk_path(ctx->disks, index) != NULL)
+	{
+		disk_prefetch(disk_path(ctx->disks, index));
+	}
+}
+
+void disk_load(struct core_ctx_s *ctx)
+{
+	const struct retro_disk_control_ext_callback *cb = &ctx->env.disk_cb;
+	unsigned num, i;
+
+	if(!disk_supported(ctx))
+	{
+		if(ctx->disks != NULL && disk_count(ctx->disks) > 1)
+		{
+			SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+				    "This core does not support changing "
+				    "disks; only the first disk is used");
+		}
+
+		return;
+	}
+
+	num = cb->get_num_images();
+
+	/* Images are only given by path, so cores that must be given the
+	 * content in memory are not given the other images. */
+	if(ctx->disks != NULL && num < disk_count(ctx->disks) &&
+		cb->add_image_index != NULL &&
+		cb->replace_image_index != NULL &&
+		ctx->sys_info.need_fullpath)
+	{
+		cb->set_eject_state(true);
+
+		for(i = num; i < disk_count(ctx->disks); i++)
+		{
+			struct retro_game_info info = { 0 };
+
+			info.path = disk_path(ctx->disks, i);
+			if(!cb->add_image_index() ||
+				!cb->replace_image_index(i, &info))
+			{
+				SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+					    "Core did not accept disk %s",
+					    info.path);
+				break;
+			}
+		}
+
+		cb->set_eject_state(false);
+	}
+
+	SDL_LogVerbose(SDL_LOG_CATEGORY_APPLICATION,
+		       "Core has %u disk images", cb->get_num_images());
+	disk_prefetch_next(ctx, cb->get_image_index());
+}
+
+int disk_toggle_eject(struct core_ctx_s *ctx)
+{
+	const struct retro_disk_control_ext_callback *cb = &ctx->env.disk_cb;
+	bool eject;
+
+	if(!disk_supported(ctx))
+	{
+		return SDL_SetError("This core does not support changing "
+				    "disks");
+	}
+
+	eject = !cb->get_eject_state();
+	if(!cb->set_eject_state(eject))
+	{
+		return SDL_SetError("Core was unable to %s the disk tray",
+				    eject ? "open" : "close");
+	}
+
+	return eject ? 1 : 0;
+}
+
+int disk_next(struct core_ctx_s *ctx)
+{
+	const struct retro_disk_control_ext_callback *cb = &ctx->env.disk_cb;
+	unsigned num, index;
+	bool ejected;
+
+	if(!disk_supported(ctx))
+	{
+		return SDL_SetError("This core does not support changing "
+				    "disks");
+	}
+
+	num = cb->get_num_images();
+	if(num < 2)
+		return SDL_SetError("There are no other disks to change to");
+
+	index = (cb->get_image_index() + 1) % num;
+
+	/* The image may only be changed whilst the tray is open. */
+	ejected = cb->get_eject_state();
+	if(!ejected && !cb->set_eject_state(true))
+		return SDL_SetError("Core was unable to open the disk tray");
+
+	if(!cb->set_image_index(index))
+	{
+		SDL_SetError("Core was unable to change to disk %u", index + 1);
+		index = (unsigned)-1;
+	}
+
+	if(!ejected)
+		cb->set_eject_state(false);
+
+	if(index == (unsigned)-1)
+		return -1;
+
+	disk_prefetch_next(ctx, index);
+	return (int)index;
+}
@@ -0,0 +1,216 @@
+/**
+ * Read-only mapping of files into memory.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#if defined(__linux__)
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define FMAP_USE_MMAP	1
+#else
+#define FMAP_USE_MMAP	0
+#endif
+
+#include <SDL.h>
+#include <fmap.h>
+
+struct fmap_s {
+	Uint8 *data;
+	size_t size;
+};
+
+fmap_ctx *fmap_open(const char *filename, unsigned flags)
+{
+	fmap_ctx *ctx;
+#if FMAP_USE_MMAP
+	struct stat st;
+	int mflags = MAP_PRIVATE;
+	int fd;
+#endif
+
+	ctx = SDL_calloc(1, sizeof(fmap_ctx));
+	if(ctx == NULL)
+	{
+		SDL_OutOfMemory();
+		return NULL;
+	}
+
+#if FMAP_USE_MMAP
+	fd = open(filename, O_RDONLY | O_CLOEXEC);
+	if(fd == -1)
+	{
+		SDL_SetError("Unable to open %s: %s", filename,
+			     strerror(errno));
+		goto err;
+	}
+
+	if(fstat(fd, &st) != 0)
+	{
+		SDL_SetError("Unable to obtain size of %s: %s", filename,
+			     strerror(errno));
+		close(fd);
+		goto err;
+	}
+
+	/* The size of other files, such as those of procfs, devices and
+	 * pipes, is not known, so they would appear to be empty. */
+	if(!S_ISREG(st.st_mode))
+	{
+		SDL_SetError("Unable to map %s: not a regular file", filename);
+		close(fd);
+		goto err;
+	}
+
+	ctx->size = (size_t)st.st_size;
+
+	if(flags & FMAP_FLAG_POPULATE)
+		mflags |= MAP_POPULATE;
+
+	/* Empty files cannot be mapped. */
+	if(ctx->size != 0)
+	{
+		void *m = mmap(NULL, ctx->size, PROT_READ, mflags, fd, 0);
+
+		if(m == MAP_FAILED)
+		{
+			SDL_SetError("Unable to map %s: %s", filename,
+				     strerror(errno));
+			close(fd);
+			goto err;
+		}
+
+		ctx->data = m;
+
+		/* Write access is added afterwards, as populating a writable
+		 * private mapping would copy every page. */
+		if((flags & FMAP_FLAG_WRITE) &&
+		   mprotect(m, ctx->size, PROT_READ | PROT_WRITE) != 0)
+		{
+			SDL_SetError("Unable to map %s: %s", filename,
+				     strerror(errno));
+			close(fd);
+			goto err;
+		}
+
+		/* Advice is only a hint, so failures are ignored. Huge
+		 * pages are requested first, so that read ahead may use
+		 * them. */
+#ifdef MADV_HUGEPAGE
+		if(flags & FMAP_FLAG_HUGEPAGE)
+			madvise(m, ctx->size, MADV_HUGEPAGE);
+#endif
+
+		if(flags & FMAP_FLAG_SEQUENTIAL)
+			madvise(m, ctx->size, MADV_SEQUENTIAL);
+
+		if(flags & FMAP_FLAG_WILLNEED)
+			madvise(m, ctx->size, MADV_WILLNEED);
+	}
+
+	/* The mapping remains valid after the file is closed. */
+	close(fd);
+#else
+	if(flags & FMAP_FLAG_MAP_ONLY)
+	{
+		SDL_SetError("Mapping files is not supported on this platform");
+		goto err;
+	}
+
+	ctx->data = SDL_LoadFile(filename, &ctx->size);
+	if(ctx->data == NULL)
+		goto err;
+#endif
+
+	return ctx;
+
+err:
+	fmap_close(ctx);
+	return NULL;
+}
+
+const Uint8 *fmap_data(const fmap_ctx *ctx)
+{
+	return ctx->data;
+}
+
+size_t fmap_size(const fmap_ctx *ctx)
+{
+	return ctx->size;
+}
+
+void fmap_close(fmap_ctx *ctx)
+{
+	if(ctx == NULL)
+		return;
+
+#if FMAP_USE_MMAP
+	if(ctx->data != NULL)
+		munmap(ctx->data, ctx->size);
+#else
+	SDL_free(ctx->data);
+#endif
+
+	SDL_free(ctx);
+}
+
+int fmap_prefetch(const char *filename)
+{
+#if FMAP_USE_MMAP
+	int fd;
+	int err;
+
+	fd = open(filename, O_RDONLY | O_CLOEXEC);
+	if(fd == -1)
+	{
+		return SDL_SetError("Unable to open %s: %s", filename,
+				    strerror(errno));
+	}
+
+	/* The kernel reads the file in the background. */
+	err = posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+	close(fd);
+
+	if(err != 0)
+	{
+		return SDL_SetError("Unable to read ahead %s: %s", filename,
+				    strerror(err));
+	}
+
+	return 0;
+#else
+	SDL_RWops *f;
+	Uint8 *buf;
+	const size_t len = 64 * 1024;
+
+	f = SDL_RWFromFile(filename, "rb");
+	if(f == NULL)
+		return -1;
+
+	buf = SDL_malloc(len);
+	if(buf == NULL)
+	{
+		SDL_RWclose(f);
+		return SDL_OutOfMemory();
+	}
+
+	while(SDL_RWread(f, buf, 1, len) != 0);
+
+	SDL_free(buf);
+	SDL_RWclose(f);
+	return 0;
+#endif
+}
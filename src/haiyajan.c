@@ -24,15 +24,21 @@
 #include <optparse.h>
 
 #include <haiyajan.h>
+#include <disk.h>
 #include <font.h>
 #include <input.h>
+#include <job.h>
 #include <load.h>
 #include <play.h>
 #include <rec.h>
+#include <rewind.h>
 #include <sig.h>
+#include <state.h>
 #include <timer.h>
 #include <ui.h>
 #include <util.h>
+#include <vfs.h>
+#include <wheel.h>
 
 #define PROG_NAME       "Haiyajan"
 
@@ -126,17 +132,33 @@ static void print_help(void)
 	int i;
 	char str[512];
 
-	SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Usage: haiyajan [OPTIONS] -L CORE [FILE]\n"
+	SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Usage: haiyajan [OPTIONS] [-L CORE] [FILE]\n"
 			"Options:\n"
 			"  -h, --help       Show this help message.\n"
 			"      --version    Print version information.\n"
-			"  -L, --libretro   Path to libretro core.\n"
+			"  -L, --libretro   Path to libretro core. If not given, a "
+			"previously used core\n"
+			"                   that supports FILE is used.\n"
 			"  -b, --benchmark  Benchmark and print average frames per second.\n"
 			"  -v, --verbose    Print verbose log messages.\n"
 			"  -V, --video      Video driver to use\n"
 			"  -R, --render     Render driver to use\n"
 			"      --tai-record Record a new tool assist input file\n"
-			"      --tai-play   Play a tool assist input file\n");
+			"      --tai-play   Play a tool assist input file\n"
+			"      --rec-direct-io Bypass the page cache when recording\n"
+			"      --record-y4m Record raw video to a file, pipe or fd:N\n"
+			"      --record-pcm Record raw audio to a file, pipe or fd:N\n"
+			"      --audio-latency Target audio latency in ms\n"
+			"      --audio-quality Resampling quality: low, medium or high\n"
+			"      --frame-delay Wait N ms after VSYNC before running "
+			"a frame, or auto\n"
+			"      --preload    Read all content into memory before "
+			"starting\n"
+			"      --scan-cores Find the cores in a directory, so that "
+			"-L may be omitted\n"
+			"      --rewind     Keep N MiB of states for rewinding\n"
+			"      --rewind-interval Frames between each rewind "
+			"state. Default 1\n");
 
 	str[0] = '\0';
 	for(i = 0; i < num_drivers; i++)
@@ -194,6 +216,30 @@ static void free_settings(struct core_ctx_s *ctx)
 	}
 }
 
+/* Options accepted on the command line. */
+static const struct optparse_long longopts[] = {
+	{"libretro",  'L', OPTPARSE_REQUIRED},
+	{"verbose",   'v', OPTPARSE_NONE},
+	{"video",     'V', OPTPARSE_REQUIRED},
+	{"render",    'R', OPTPARSE_REQUIRED},
+	{"version",   1,   OPTPARSE_NONE},
+	{"benchmark", 'b', OPTPARSE_OPTIONAL},
+	{"help",      'h', OPTPARSE_NONE},
+	{"tai-play",   2,  OPTPARSE_REQUIRED},
+	{"tai-record", 3,  OPTPARSE_REQUIRED},
+	{"rec-direct-io", 4, OPTPARSE_NONE},
+	{"record-y4m", 5,  OPTPARSE_REQUIRED},
+	{"record-pcm", 6,  OPTPARSE_REQUIRED},
+	{"audio-latency", 7, OPTPARSE_REQUIRED},
+	{"audio-quality", 8, OPTPARSE_REQUIRED},
+	{"frame-delay", 9, OPTPARSE_REQUIRED},
+	{"preload",   10,  OPTPARSE_NONE},
+	{"scan-cores", 11, OPTPARSE_REQUIRED},
+	{"rewind",    12,  OPTPARSE_REQUIRED},
+	{"rewind-interval", 13, OPTPARSE_REQUIRED},
+	{0}
+};
+
 /**
  * Apply settings based on command-line arguments.
  * \return -1 if an error occured, 1 if the program should successfully exit, 0
@@ -201,18 +247,6 @@ static void free_settings(struct core_ctx_s *ctx)
  */
 static int apply_settings(char **argv, struct haiyajan_ctx_s *h)
 {
-	const struct optparse_long longopts[] = {
-			{"libretro",  'L', OPTPARSE_REQUIRED},
-			{"verbose",   'v', OPTPARSE_NONE},
-			{"video",     'V', OPTPARSE_REQUIRED},
-			{"render",    'R', OPTPARSE_REQUIRED},
-			{"version",   1,   OPTPARSE_NONE},
-			{"benchmark", 'b', OPTPARSE_OPTIONAL},
-			{"help",      'h', OPTPARSE_NONE},
-			{"tai-play",   2,  OPTPARSE_REQUIRED},
-			{"tai-record", 3,  OPTPARSE_REQUIRED},
-			{0}
-		};
 	int option;
 	struct optparse options;
 	char *rem_arg;
@@ -220,6 +254,7 @@ static int apply_settings(char **argv, struct haiyajan_ctx_s *h)
 	struct settings_s *cfg = &h->stngs;
 
 	optparse_init(&options, argv);
+	cfg->audio_quality = RESAMPLE_QUALITY_MEDIUM;
 
 	while((option = optparse_long(&options, longopts, NULL)) != -1)
 	{
@@ -297,6 +332,71 @@ static int apply_settings(char **argv, struct haiyajan_ctx_s *h)
 			/* Version information has already been printed. */
 			return 1;
 
+		case 4:
+			cfg->rec_direct_io = 1;
+			break;
+
+		case 5:
+			cfg->rec_y4m_path = options.optarg;
+			break;
+
+		case 6:
+			cfg->rec_pcm_path = options.optarg;
+			break;
+
+		case 7:
+			cfg->audio_latency_ms = SDL_atoi(options.optarg);
+			break;
+
+		case 8:
+		{
+			const char *const q[RESAMPLE_QUALITY_MAX] = {
+				"low", "medium", "high"
+			};
+			int i;
+
+			for(i = 0; i < RESAMPLE_QUALITY_MAX; i++)
+			{
+				if(SDL_strcmp(options.optarg, q[i]) == 0)
+					break;
+			}
+
+			if(i == RESAMPLE_QUALITY_MAX)
+			{
+				SDL_LogWarn(SDL_LOG_CATEGORY_AUDIO,
+					    "Unknown audio quality %s",
+					    options.optarg);
+				break;
+			}
+
+			cfg->audio_quality = (resample_quality_e)i;
+			break;
+		}
+
+		case 9:
+			if(SDL_strcmp(options.optarg, "auto") == 0)
+				cfg->frame_delay_ms = -1;
+			else
+				cfg->frame_delay_ms = SDL_atoi(options.optarg);
+
+			break;
+
+		case 10:
+			cfg->preload = 1;
+			break;
+
+		case 11:
+			cfg->scan_dir = options.optarg;
+			break;
+
+		case 12:
+			cfg->rewind_mib = SDL_atoi(options.optarg);
+			break;
+
+		case 13:
+			cfg->rewind_interval = SDL_atoi(options.optarg);
+			break;
+
 		case 'b':
 			cfg->benchmark = 1;
 			if(options.optarg != 0)
@@ -329,16 +429,18 @@ static int apply_settings(char **argv, struct haiyajan_ctx_s *h)
 	/* Print remaining arguments. */
 	rem_arg = optparse_arg(&options);
 
-	if (cfg->core_filename == NULL)
+	if(rem_arg != NULL)
+		cfg->content_filename = SDL_strdup(rem_arg);
+
+	/* The core may be selected by the extension of the content. */
+	if (cfg->core_filename == NULL && cfg->content_filename == NULL &&
+		cfg->scan_dir == NULL)
 	{
 		SDL_LogCritical(SDL_LOG_CATEGORY_APPLICATION,
 				"The path to a libretro core was not given");
 		goto err;
 	}
 
-	if(rem_arg != NULL)
-		cfg->content_filename = SDL_strdup(rem_arg);
-
 	/* Initialise default video driver if not done so already. */
 	if(video_init == 0 && SDL_VideoInit(NULL) != 0)
 	{
@@ -421,7 +523,7 @@ static void take_screenshot(SDL_Renderer *rend, struct core_ctx_s *const ctx)
 		return;
 
 	SDL_AtomicSet(&screenshot_timeout, 1);
-	set_atomic_timeout(1024, &screenshot_timeout, 0, "Enable Screenshot");
+	set_atomic_timeout(1024, &screenshot_timeout, 0);
 
 	surf = util_tex_to_surf(rend, ctx->sdl.core_tex,
 				&ctx->sdl.game_frame_res, ctx->env.flip);
@@ -465,11 +567,15 @@ static void handle_rec_toggle(struct haiyajan_ctx_s *ctx)
 		/* FIXME: add double to Sint32 sample
 		 * compensation should the sample rate
 		 * not be an integer. */
+		/* Ensure that the first frame is not considered a
+		 * duplicate. */
+		ctx->core.env.frame_hash = 0;
 		ctx->core.vid = rec_init(vidfile,
 				ctx->core.sdl.game_frame_res.w,
 				ctx->core.sdl.game_frame_res.h,
 				ctx->core.av_info.timing.fps,
-				SDL_ceil(ctx->core.av_info.timing.sample_rate));
+				SDL_ceil(ctx->core.av_info.timing.sample_rate),
+				ctx->stngs.rec_direct_io);
 		if(ctx->core.vid == NULL)
 		{
 			SDL_LogWarn(SDL_LOG_CATEGORY_VIDEO,
@@ -507,6 +613,270 @@ out:
 }
 #endif
 
+static char *get_recpipe_txt(void *priv)
+{
+	recpipe_ctx **pipe = priv;
+	struct recpipe_stats_s st;
+	static char str[32];
+
+	/* Delete overlay once recording has finished. */
+	if(*pipe == NULL)
+		return NULL;
+
+	recpipe_get_stats(*pipe, &st);
+	SDL_snprintf(str, sizeof(str), "REC RAW %u dropped",
+		     st.frames_dropped);
+
+	return str;
+}
+
+static int haiyajan_recpipe_is_fd(const char *path)
+{
+	return path != NULL && SDL_strncmp(path, "fd:", 3) == 0;
+}
+
+static void handle_recpipe_toggle(struct haiyajan_ctx_s *ctx)
+{
+	SDL_Colour c = { 0x00, 0xFF, 0x00, SDL_ALPHA_OPAQUE };
+
+	if(ctx->core.pipe != NULL)
+	{
+		recpipe_end(&ctx->core.pipe);
+		if(haiyajan_recpipe_is_fd(ctx->stngs.rec_y4m_path) ||
+			haiyajan_recpipe_is_fd(ctx->stngs.rec_pcm_path))
+		{
+			ctx->recpipe_fd_ended = 1;
+		}
+
+		ui_add_overlay(&ctx->ui_overlay, c, ui_overlay_bot_right,
+				"Recording Saved",
+				NOTIF_TIMEOUT_MS, NULL, NULL, 0);
+		return;
+	}
+
+	if(ctx->core.env.status.bits.valid_frame == 0)
+		return;
+
+	/* Ensure that the first frame is not considered a duplicate. */
+	ctx->core.env.frame_hash = 0;
+
+	/* A second recording would be appended to the first within the same
+	 * stream, and the reader would never see the end of the first. */
+	if(ctx->recpipe_fd_ended)
+	{
+		SDL_SetError("A file descriptor may only be recorded to once");
+		ctx->core.pipe = NULL;
+	}
+	else
+	{
+		ctx->core.pipe = recpipe_init(ctx->stngs.rec_y4m_path,
+				ctx->stngs.rec_pcm_path,
+				ctx->core.sdl.game_frame_res.w,
+				ctx->core.sdl.game_frame_res.h,
+				ctx->core.av_info.timing.fps,
+				ctx->core.av_info.timing.sample_rate);
+	}
+
+	if(ctx->core.pipe == NULL)
+	{
+		SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+				"Unable to start raw recording: %s",
+				SDL_GetError());
+		c.r = 0xFF;
+		c.g = 0x00;
+		ui_add_overlay(&ctx->ui_overlay, c, ui_overlay_bot_right,
+				"Unable to start recording",
+				NOTIF_TIMEOUT_MS, NULL, NULL, 0);
+		return;
+	}
+
+	ui_add_overlay(&ctx->ui_overlay, c, ui_overlay_bot_right, NULL,
+			0, get_recpipe_txt, &ctx->core.pipe, 0);
+}
+
+static void handle_disk_event(struct haiyajan_ctx_s *ctx, Sint32 code)
+{
+	SDL_Colour c = { 0x00, 0xFF, 0x00, SDL_ALPHA_OPAQUE };
+	char *buf;
+	int ret;
+
+	if(code == INPUT_EVENT_DISK_EJECT_TOGGLE)
+		ret = disk_toggle_eject(&ctx->core);
+	else
+		ret = disk_next(&ctx->core);
+
+	if(ret < 0)
+	{
+		SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "%s",
+			    SDL_GetError());
+		c.r = 0xFF;
+		c.g = 0x00;
+		ui_add_overlay(&ctx->ui_overlay, c, ui_overlay_top_right,
+				"Unable to change disk", NOTIF_TIMEOUT_MS,
+				NULL, NULL, 0);
+		return;
+	}
+
+	buf = SDL_malloc(32);
+	if(buf == NULL)
+		return;
+
+	if(code == INPUT_EVENT_DISK_EJECT_TOGGLE)
+	{
+		SDL_strlcpy(buf, ret ? "Disk tray open" : "Disk tray closed",
+			    32);
+	}
+	else
+	{
+		SDL_snprintf(buf, 32, "Disk %d of %u", ret + 1,
+			     disk_num_images(&ctx->core));
+	}
+
+	ui_add_overlay(&ctx->ui_overlay, c, ui_overlay_top_right, buf,
+			NOTIF_TIMEOUT_MS, NULL, NULL, 1);
+}
+
+static void handle_state_event(struct haiyajan_ctx_s *ctx, Sint32 code)
+{
+	SDL_Colour c = { 0x00, 0xFF, 0x00, SDL_ALPHA_OPAQUE };
+	unsigned slot = ctx->state_slot;
+	char *msg;
+	char *buf;
+	int ret = 0;
+
+	switch(code)
+	{
+	case INPUT_EVENT_STATE_SAVE:
+		ret = state_save(&ctx->core, slot);
+		msg = "saved";
+		break;
+
+	case INPUT_EVENT_STATE_LOAD:
+		ret = state_load(&ctx->core, slot);
+		msg = "loaded";
+		break;
+
+	case INPUT_EVENT_STATE_SLOT_PREV:
+		slot = (slot + STATE_SLOTS - 1) % STATE_SLOTS;
+		ctx->state_slot = slot;
+		msg = "selected";
+		break;
+
+	case INPUT_EVENT_STATE_SLOT_NEXT:
+		slot = (slot + 1) % STATE_SLOTS;
+		ctx->state_slot = slot;
+		msg = "selected";
+		break;
+
+	case INPUT_EVENT_STATE_QUICK_SAVE:
+		ret = state_quick_save(&ctx->core);
+		msg = "Quick state saved";
+		break;
+
+	case INPUT_EVENT_STATE_QUICK_LOAD:
+	default:
+		ret = state_quick_load(&ctx->core);
+		msg = "Quick state loaded";
+		break;
+	}
+
+	if(ret != 0)
+	{
+		SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "%s",
+			    SDL_GetError());
+		c.r = 0xFF;
+		c.g = 0x00;
+		ui_add_overlay(&ctx->ui_overlay, c, ui_overlay_top_right,
+				"Unable to use save state", NOTIF_TIMEOUT_MS,
+				NULL, NULL, 0);
+		return;
+	}
+
+	if(code == INPUT_EVENT_STATE_QUICK_SAVE ||
+		code == INPUT_EVENT_STATE_QUICK_LOAD)
+	{
+		ui_add_overlay(&ctx->ui_overlay, c, ui_overlay_top_right,
+				msg, NOTIF_TIMEOUT_MS, NULL, NULL, 0);
+		return;
+	}
+
+	buf = SDL_malloc(32);
+	if(buf == NULL)
+		return;
+
+	SDL_snprintf(buf, 32, "State %u %s", slot, msg);
+	ui_add_overlay(&ctx->ui_overlay, c, ui_overlay_top_right, buf,
+			NOTIF_TIMEOUT_MS, NULL, NULL, 1);
+}
+
+static char *get_rewind_txt(void *priv)
+{
+	const struct haiyajan_ctx_s *ctx = priv;
+	struct rewind_stats_s st;
+	static char str[32];
+
+	/* Delete overlay once the rewind button is released. */
+	if(!ctx->rewinding)
+		return NULL;
+
+	rewind_get_stats(ctx->rewind, &st);
+	SDL_snprintf(str, sizeof(str), "REWIND %.1f s", st.seconds);
+	return str;
+}
+
+static void handle_rewind_event(struct haiyajan_ctx_s *ctx, Sint32 code)
+{
+	SDL_Colour c = { 0xF3, 0x9C, 0x12, SDL_ALPHA_OPAQUE };
+
+	if(code == INPUT_EVENT_REWIND_RELEASE)
+	{
+		ctx->rewinding = 0;
+		return;
+	}
+
+	/* Held keys are repeated. */
+	if(ctx->rewinding)
+		return;
+
+	if(ctx->rewind == NULL)
+	{
+		c.r = 0xFF;
+		c.g = 0x00;
+		c.b = 0x00;
+		ui_add_overlay(&ctx->ui_overlay, c, ui_overlay_top_right,
+				"Rewind is disabled", NOTIF_TIMEOUT_MS,
+				NULL, NULL, 0);
+		return;
+	}
+
+	ctx->rewinding = 1;
+	ui_add_overlay(&ctx->ui_overlay, c, ui_overlay_top_right, NULL, 0,
+			get_rewind_txt, ctx, 0);
+}
+
+/**
+ * Restore an earlier state of the core before each frame whilst rewinding,
+ * otherwise capture the state after each frame.
+ */
+static void rewind_core(struct haiyajan_ctx_s *ctx, Uint8 before_frame)
+{
+	if(ctx->rewind == NULL || ctx->rewinding != before_frame)
+		return;
+
+	/* The producer thread calls the core to generate audio. */
+	audio_lock_producer(ctx->core.sdl.audio);
+	if(!before_frame)
+	{
+		rewind_frame(ctx->rewind);
+	}
+	else if(rewind_step(ctx->rewind) < 0)
+	{
+		SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+			    "Unable to rewind: %s", SDL_GetError());
+	}
+	audio_unlock_producer(ctx->core.sdl.audio);
+}
+
 static void process_events(struct haiyajan_ctx_s *ctx)
 {
 	SDL_Event ev;
@@ -579,11 +949,46 @@ static void process_events(struct haiyajan_ctx_s *ctx)
 						NULL, NULL, 0);
 				break;
 			}
-#if ENABLE_VIDEO_RECORDING == 1
 			case INPUT_EVENT_RECORD_VIDEO_TOGGLE:
-				handle_rec_toggle(ctx);
-				break;
+				/* Audio may be recorded by the producer
+				 * thread. */
+				audio_lock_producer(ctx->core.sdl.audio);
+				if(ctx->stngs.rec_y4m_path != NULL ||
+					ctx->stngs.rec_pcm_path != NULL)
+				{
+					handle_recpipe_toggle(ctx);
+				}
+#if ENABLE_VIDEO_RECORDING == 1
+				else
+				{
+					handle_rec_toggle(ctx);
+				}
 #endif
+				audio_unlock_producer(ctx->core.sdl.audio);
+				break;
+
+			case INPUT_EVENT_DISK_EJECT_TOGGLE:
+			case INPUT_EVENT_DISK_NEXT:
+				handle_disk_event(ctx, ev.user.code);
+				break;
+
+			case INPUT_EVENT_STATE_SAVE:
+			case INPUT_EVENT_STATE_LOAD:
+			case INPUT_EVENT_STATE_SLOT_PREV:
+			case INPUT_EVENT_STATE_SLOT_NEXT:
+			case INPUT_EVENT_STATE_QUICK_SAVE:
+			case INPUT_EVENT_STATE_QUICK_LOAD:
+				/* The producer thread calls the core to
+				 * generate audio. */
+				audio_lock_producer(ctx->core.sdl.audio);
+				handle_state_event(ctx, ev.user.code);
+				audio_unlock_producer(ctx->core.sdl.audio);
+				break;
+
+			case INPUT_EVENT_REWIND:
+			case INPUT_EVENT_REWIND_RELEASE:
+				handle_rewind_event(ctx, ev.user.code);
+				break;
 		}
 		}
 		else if(ev.type == ctx->core.tim.timer_event)
@@ -621,6 +1026,43 @@ static void process_events(struct haiyajan_ctx_s *ctx)
 	}
 }
 
+/**
+ * Advance the timer wheel. When input is tool assisted, time is derived from
+ * the number of frames played, so that timeouts occur on the same frame on
+ * each replay.
+ */
+static void advance_timers(const struct haiyajan_ctx_s *ctx)
+{
+	static Uint64 perf_beg = 0;
+	static Uint64 last_ms = 0;
+	Uint64 now_ms;
+
+	if(ctx->tai != NULL)
+	{
+		double fps = ctx->core.av_info.timing.fps;
+
+		if(fps <= 0.0)
+			fps = 60.0;
+
+		now_ms = (Uint64)(ctx->core.env.frames * 1000.0 / fps);
+	}
+	else
+	{
+		Uint64 now = SDL_GetPerformanceCounter();
+
+		if(perf_beg == 0)
+			perf_beg = now;
+
+		now_ms = ((now - perf_beg) * 1000) / SDL_GetPerformanceFrequency();
+	}
+
+	if(now_ms < last_ms)
+		now_ms = last_ms;
+
+	last_ms = now_ms;
+	wheel_advance(now_ms);
+}
+
 struct benchmark_txt_priv {
 	Uint32 fps;
 	char str[64];
@@ -633,23 +1075,193 @@ char *get_benchmark_txt(void *priv)
 	return btxt->str;
 }
 
-int haiyajan_get_available_file_types(struct core_ctx_s *ctx)
+/**
+ * Open the cache of core information. Startup continues without the cache if
+ * it cannot be opened.
+ */
+static void haiyajan_open_coreinfo(struct haiyajan_ctx_s *h)
+{
+	char *pref;
+	char *path;
+	size_t len;
+
+	pref = SDL_GetPrefPath("deltabeard", PROG_NAME);
+	if(pref == NULL)
+		goto err;
+
+	len = SDL_strlen(pref) + sizeof("coreinfo.txt");
+	path = SDL_malloc(len);
+	if(path == NULL)
+	{
+		SDL_free(pref);
+		SDL_OutOfMemory();
+		goto err;
+	}
+
+	SDL_snprintf(path, len, "%scoreinfo.txt", pref);
+	h->coreinfo = coreinfo_open(path);
+	SDL_free(path);
+	SDL_free(pref);
+
+	if(h->coreinfo == NULL)
+		goto err;
+
+	return;
+
+err:
+	SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+		    "Unable to open core information cache: %s",
+		    SDL_GetError());
+}
+
+/**
+ * Scan a directory for cores if --scan-cores was given. Cores are probed by
+ * child processes, and so this must be called before SDL is initialised, as
+ * SDL may start threads that hold locks that the child processes then wait
+ * for forever.
+ *
+ * \return -1 if an error occured, 1 if the program should successfully exit as
+ *		no content was given, 0 if the program should continue.
+ */
+static int haiyajan_scan_cores(char **argv, struct haiyajan_ctx_s *h)
 {
-	(void) ctx;
+	struct optparse options;
+	const char *dir = NULL;
+	int option;
+
+	/* Invalid options are reported by apply_settings(). */
+	optparse_init(&options, argv);
+	while((option = optparse_long(&options, longopts, NULL)) != -1)
+	{
+		if(option == 11)
+			dir = options.optarg;
+		else if(option == 'v')
+			SDL_LogSetAllPriority(SDL_LOG_PRIORITY_VERBOSE);
+	}
+
+	if(dir == NULL)
+		return 0;
+
+	haiyajan_open_coreinfo(h);
+	if(h->coreinfo == NULL || load_scan_cores(dir, h->coreinfo) != 0)
+		return -1;
+
+	coreinfo_prune(h->coreinfo);
+	if(coreinfo_save(h->coreinfo) != 0)
+		return -1;
+
+	/* Play content if it was also given. */
+	return optparse_arg(&options) != NULL ? 0 : 1;
+}
+
+/**
+ * Store the information of the running core, so that the next launch may
+ * start without loading the core first.
+ */
+static void haiyajan_update_coreinfo(struct haiyajan_ctx_s *h)
+{
+	const char *license = NULL;
+
+	if(h->coreinfo == NULL)
+		return;
+
+	if(h->core.ext_fn.re_core_get_license_info != NULL)
+	{
+		const struct license_info_s *l =
+			h->core.ext_fn.re_core_get_license_info();
+
+		if(l != NULL)
+			license = l->license_spdx;
+	}
+
+	if(coreinfo_set(h->coreinfo, h->core.core_filename,
+			&h->core.sys_info, &h->core.av_info, license) != 0 ||
+		coreinfo_save(h->coreinfo) != 0)
+	{
+		SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+			    "Unable to update core information cache: %s",
+			    SDL_GetError());
+	}
+}
+
+/**
+ * Select a core for the content if one was not given.
+ */
+static int haiyajan_select_core(struct haiyajan_ctx_s *h)
+{
+	const struct coreinfo_entry_s *e;
+
+	if(h->stngs.core_filename != NULL)
+		return 0;
+
+	e = coreinfo_find_ext(h->coreinfo, h->stngs.content_filename);
+
+	/* A playlist may be played by a core that supports its images. */
+	if(e == NULL && util_has_ext(h->stngs.content_filename,
+				DISK_PLAYLIST_EXTS))
+	{
+		disk_ctx *d = disk_open_m3u(h->stngs.content_filename);
+
+		if(d != NULL)
+		{
+			e = coreinfo_find_ext(h->coreinfo, disk_path(d, 0));
+			disk_close(d);
+		}
+	}
+
+	if(e == NULL)
+	{
+		return SDL_SetError("No previously used core supports %s; "
+				    "give the path to a core with -L",
+				    h->stngs.content_filename);
+	}
+
+	h->stngs.core_filename = SDL_strdup(e->path);
+	if(h->stngs.core_filename == NULL)
+		return SDL_OutOfMemory();
+
+	SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Using core %s for %s",
+		    e->library_name, h->stngs.content_filename);
+
 	return 0;
 }
 
-static int haiyajan_init_core(struct haiyajan_ctx_s *h, char *core_filename,
+/**
+ * Load the core, and start reading the content in the background whilst the
+ * window, renderer and core are initialised.
+ */
+static int haiyajan_load_core(struct haiyajan_ctx_s *h, char *core_filename,
 		char *content_filename)
 {
 	struct core_ctx_s *ctx = &h->core;
-	SDL_Colour c = { 0xF3, 0x9C, 0x12, SDL_ALPHA_OPAQUE };
+	const struct coreinfo_entry_s *e;
 
 	ctx->core_filename = core_filename;
 	ctx->content_filename = content_filename;
 
+	/* Content is read in the background whilst the core starts. If
+	 * preloading, it is read entirely before the core is given it. */
+	ctx->content_map_flags = FMAP_FLAG_WRITE;
+	if(h->stngs.preload)
+		ctx->content_map_flags |= FMAP_FLAG_POPULATE |
+			FMAP_FLAG_HUGEPAGE;
+	else
+		ctx->content_map_flags |= FMAP_FLAG_WILLNEED;
+
+	/* If the core is cached, content is read whilst the core is loaded
+	 * too. */
+	e = coreinfo_find(h->coreinfo, ctx->core_filename);
+	if(e != NULL)
+	{
+		ctx->sys_info.valid_extensions = e->valid_extensions;
+		ctx->sys_info.need_fullpath = e->need_fullpath;
+
+		if(load_content_begin(ctx) != 0)
+			return -1;
+	}
+
 	if(load_libretro_core(ctx->core_filename, ctx))
-		goto err;
+		return -1;
 
 	/* TODO:
 	 * - Check that input file is supported by core
@@ -662,13 +1274,101 @@ static int haiyajan_init_core(struct haiyajan_ctx_s *h, char *core_filename,
 	SDL_SetHint(SDL_HINT_AUDIO_DEVICE_STREAM_NAME, ctx->sys_info.library_name);
 #endif
 
+	if(ctx->content_load != NULL)
+		return 0;
+
+	return load_content_begin(ctx);
+}
+
+static char *get_load_txt(void *priv)
+{
+	struct core_ctx_s *ctx = priv;
+	static char str[32];
+
+	/* Delete overlay once content has been given to the core. */
+	if(ctx->content_load == NULL)
+		return NULL;
+
+	SDL_snprintf(str, sizeof(str), "Loading %d%%",
+		     load_content_progress(ctx->content_load));
+
+	return str;
+}
+
+/**
+ * Show the progress of reading content until it has been read, or until the
+ * user quits. Content that is still being read once the user quits is
+ * cancelled by load_content_free().
+ */
+static void haiyajan_wait_content(struct haiyajan_ctx_s *h)
+{
+	SDL_Colour c = { 0xF3, 0x9C, 0x12, SDL_ALPHA_OPAQUE };
+	ui_overlay_item_s *item;
+
+	if(h->core.content_load == NULL ||
+		load_content_done(h->core.content_load))
+		return;
+
+	item = ui_add_overlay(&h->ui_overlay, c, ui_overlay_bot_left, NULL,
+			0, get_load_txt, &h->core, 0);
+
+	while(!load_content_done(h->core.content_load))
+	{
+		SDL_Event ev;
+
+		/* The window remains responsive whilst waiting. Only quit
+		 * events are removed, such that other events, such as
+		 * controllers attached at startup, are processed once the
+		 * core runs. */
+		SDL_PumpEvents();
+		if(SDL_PeepEvents(&ev, 1, SDL_GETEVENT, SDL_QUIT,
+				  SDL_QUIT) > 0)
+		{
+			h->quit = 1;
+			break;
+		}
+
+		SDL_Delay(16);
+
+		SDL_SetRenderDrawColor(h->rend, 0x00, 0x00, 0x00, 0x00);
+		SDL_RenderClear(h->rend);
+		ui_overlay_render(&h->ui_overlay, h->rend, h->font);
+		SDL_RenderPresent(h->rend);
+	}
+
+	if(item != NULL)
+		ui_overlay_delete(&h->ui_overlay, item);
+}
+
+static int haiyajan_init_core(struct haiyajan_ctx_s *h)
+{
+	struct core_ctx_s *ctx = &h->core;
+	SDL_Colour c = { 0xF3, 0x9C, 0x12, SDL_ALPHA_OPAQUE };
+
 	play_init_cb(ctx);
 	ctx->sdl.gl = gl_prepare(h->rend);
+	haiyajan_wait_content(h);
+	if(h->quit)
+		return 0;
 
 	if(load_libretro_file(ctx) != 0)
 		goto err;
 
-	if(play_init_av(ctx, h->rend) != 0)
+	if(h->stngs.rewind_mib > 0)
+	{
+		h->rewind = rewind_init(ctx,
+				(size_t)h->stngs.rewind_mib * 1024 * 1024,
+				h->stngs.rewind_interval);
+		if(h->rewind == NULL)
+		{
+			SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+				    "Rewinding is unavailable: %s",
+				    SDL_GetError());
+		}
+	}
+
+	if(play_init_av(ctx, h->rend, h->stngs.audio_latency_ms,
+			h->stngs.audio_quality) != 0)
 		goto err;
 
 	if(ctx->env.status.bits.opengl_required)
@@ -717,6 +1417,7 @@ int main(int argc, char *argv[])
 {
 	int ret = EXIT_FAILURE;
 	struct haiyajan_ctx_s h = {0};
+	int win_w = 320, win_h = 240;
 
 	/* Ignore argc being unused warning. */
 	(void)argc;
@@ -738,6 +1439,22 @@ int main(int argc, char *argv[])
 	if(prerun_checks() != 0)
 		return EXIT_FAILURE;
 
+	{
+		int scan_ret = haiyajan_scan_cores(argv, &h);
+		if(scan_ret != 0)
+		{
+			if(scan_ret < 0)
+			{
+				SDL_LogCritical(SDL_LOG_CATEGORY_APPLICATION,
+						"Unable to scan cores: %s",
+						SDL_GetError());
+			}
+
+			coreinfo_close(h.coreinfo);
+			return scan_ret < 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+		}
+	}
+
 #if SDL_VERSION_ATLEAST(2, 0, 13)
 	SDL_SetHint(SDL_HINT_AUDIO_DEVICE_APP_NAME, PROG_NAME);
 #endif
@@ -759,8 +1476,43 @@ int main(int argc, char *argv[])
 			return EXIT_SUCCESS;
 	}
 
+	/* The cache was already opened if cores were scanned. */
+	if(h.coreinfo == NULL)
+		haiyajan_open_coreinfo(&h);
+
+	if(haiyajan_select_core(&h) != 0)
+		goto err;
+
+	/* Background jobs are executed on the calling thread if the worker
+	 * threads could not be started. */
+	if(job_init() != 0)
+	{
+		SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+			    "Unable to start worker threads: %s",
+			    SDL_GetError());
+	}
+
+	/* The window is created at the size last used by the core. */
+	{
+		const struct coreinfo_entry_s *e;
+
+		e = coreinfo_find(h.coreinfo, h.stngs.core_filename);
+		if(e != NULL && e->av_info.geometry.max_width != 0)
+		{
+			win_w = (int)e->av_info.geometry.max_width;
+			win_h = (int)e->av_info.geometry.max_height;
+		}
+	}
+
+	/* Content is read whilst the window and renderer are created. */
+	if(haiyajan_load_core(&h, h.stngs.core_filename,
+				h.stngs.content_filename) != 0)
+	{
+		goto err;
+	}
+
 	h.win = SDL_CreateWindow(PROG_NAME, SDL_WINDOWPOS_UNDEFINED,
-				   SDL_WINDOWPOS_UNDEFINED, 320, 240,
+				   SDL_WINDOWPOS_UNDEFINED, win_w, win_h,
 				   SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE);
 	if(h.win == NULL)
 		goto err;
@@ -800,12 +1552,18 @@ int main(int argc, char *argv[])
 		goto err;
 	}
 
-	if(haiyajan_init_core(&h, h.stngs.core_filename,
-				h.stngs.content_filename) != 0)
-	{
+	if(haiyajan_init_core(&h) != 0)
 		goto err;
+
+	/* The user quit whilst content was being read. */
+	if(h.quit)
+	{
+		ret = EXIT_SUCCESS;
+		goto out;
 	}
 
+	haiyajan_update_coreinfo(&h);
+
 	{
 		char title[64];
 		SDL_snprintf(title, sizeof(title), "%s: %s", PROG_NAME,
@@ -828,6 +1586,11 @@ int main(int argc, char *argv[])
 	input_init(&h.core.inp);
 	/* TODO: Add return check. */
 	timer_init(&h.core.tim, h.core.av_info.timing.fps);
+	timer_set_frame_delay(&h.core.tim, h.stngs.frame_delay_ms);
+
+	/* Tool assisted input must see every input event, so input is only
+	 * read once per frame whilst it is used. */
+	h.core.env.status.bits.late_input = h.tai == NULL;
 
 #if _WIN32
 	/* This is a workaround to an issue whereby the screen remains blank
@@ -852,6 +1615,7 @@ int main(int argc, char *argv[])
 #if ENABLE_VIDEO_RECORDING == 1
 				&& h.core.vid == NULL
 #endif
+				&& h.core.pipe == NULL
 		       )
 		{
 			/* Disable video for the skipped frame to improve
@@ -870,25 +1634,51 @@ int main(int argc, char *argv[])
 		if(h.tai != NULL)
 			tai_next_frame(h.tai);
 
+		/* Only delay frames that are paced by VSYNC. */
+		if(tim_cmd == 0 && !h.stngs.benchmark)
+			timer_frame_delay(&h.core.tim);
+
+		advance_timers(&h);
 		process_events(&h);
+		rewind_core(&h, 1);
 		SDL_SetRenderDrawColor(h.rend, 0x00, 0x00, 0x00, 0x00);
 		SDL_RenderClear(h.rend);
 		play_frame(&h.core);
+		rewind_core(&h, 0);
+		autosave_sram(&h.core);
 		SDL_RenderCopyEx(h.rend, h.core.sdl.core_tex,
 				 &h.core.sdl.game_frame_res,
 				 &h.core_tex_targ, 0.0, NULL,
 				 h.core.env.flip);
 
 #if ENABLE_VIDEO_RECORDING == 1
-		if(h.core.vid != NULL)
+		/* Unchanged frames are not read back from the renderer. */
+		if(h.core.vid != NULL && h.core.env.status.bits.dupe_frame)
+		{
+			rec_dupe_frame(h.core.vid);
+		}
+		else if(h.core.vid != NULL)
 		{
 			cap_frame(h.core.vid, h.rend, h.core.sdl.core_tex,
 				  &h.core.sdl.game_frame_res, h.core.env.flip);
 		}
 #endif
+		if(h.core.pipe != NULL && h.core.env.status.bits.dupe_frame)
+		{
+			recpipe_dupe_frame(h.core.pipe);
+		}
+		else if(h.core.pipe != NULL)
+		{
+			recpipe_video(h.core.pipe, h.rend, h.core.sdl.core_tex,
+				      &h.core.sdl.game_frame_res,
+				      h.core.env.flip);
+		}
+
 		SDL_SetRenderTarget(h.rend, NULL);
 		ui_overlay_render(&h.ui_overlay, h.rend, h.font);
 
+		timer_frame_work_end(&h.core.tim);
+
 		/* Only draw to screen if we're not falling behind. */
 		if(tim_cmd >= 0 || frames_skipped == 0)
 			SDL_RenderPresent(h.rend);
@@ -930,20 +1720,38 @@ int main(int argc, char *argv[])
 		}
 	}
 
+	/* The producer thread may be writing to the recording outputs. */
+	audio_stop_producer(h.core.sdl.audio);
+
 #if ENABLE_VIDEO_RECORDING == 1
 	rec_end(&h.core.vid);
 #endif
+	recpipe_end(&h.core.pipe);
 	while(h.ui_overlay != NULL)
 		ui_overlay_delete_all(&h.ui_overlay);
 
 	tai_exit(h.tai);
-	util_exit_all();
 	FontExit(h.font);
 	ret = EXIT_SUCCESS;
 
 out:
 	/* TODO: Free UI.*/
 
+	/* Stop calling the audio callback of the core, and complete
+	 * background jobs, such as saving screenshots, before the core is
+	 * unloaded. */
+	audio_stop_producer(h.core.sdl.audio);
+
+	/* Content that is still being read is cancelled first, as the
+	 * workers otherwise complete it before they exit. */
+	load_content_free(h.core.content_load);
+	h.core.content_load = NULL;
+	job_exit();
+	state_free(&h.core);
+	rewind_free(h.rewind);
+	h.rewind = NULL;
+	coreinfo_close(h.coreinfo);
+
 	if(h.core.env.status.bits.game_loaded)
 		unload_libretro_file(&h.core);
 
@@ -953,6 +1761,18 @@ out:
 		play_deinit_cb(&h.core);
 	}
 
+	/* Disk images remain if content failed to load. */
+	disk_close(h.core.disks);
+	h.core.disks = NULL;
+
+	/* Files opened by the core through the VFS interface. */
+	do {
+		struct vfs_stats_s st;
+
+		vfs_get_stats(&st);
+		vfs_log_stats("total", &st);
+	} while(0);
+
 	if(h.rend != NULL)
 		SDL_DestroyRenderer(h.rend);
 
@@ -33,8 +33,11 @@ static const char *const input_type_str[] = {
 
 static struct keymap_info_s keymap[512] = { 0 };
 
-void input_init(struct input_ctx_s *in_ctx)
-{
+/* Position beyond which an analogue trigger is reported as pressed. */
+#define INPUT_TRIGGER_THRESHOLD	0x4000
+
+/* Game controller database. Mappings are sorted by GUID, and chunks are
+ * sorted by the GUID of the first mapping within them. */
 #if defined(__linux__)
 	#include <gcdb_bin_linux.h>
 #elif defined(_WIN32)
@@ -42,10 +45,120 @@ void input_init(struct input_ctx_s *in_ctx)
 #else
 	#include <gcdb_bin_all.h>
 #endif
-	SDL_RWops *gcdb_rw;
-	Uint8 *gcdb_txt;
-	unsigned long gcdb_txt_len_act = gcdb_txt_len;
-	tinf_error_code tinf;
+
+/**
+ * Obtain the chunk of the database that would hold the given GUID.
+ *
+ * \return Index of chunk, or -1 if the GUID is before the first chunk.
+ */
+static int input_gcdb_find(const char *guid)
+{
+	int lo = 0, hi = (int)SDL_arraysize(gcdb_chunks) - 1;
+	int found = -1;
+
+	while(lo <= hi)
+	{
+		int mid = lo + (hi - lo) / 2;
+
+		if(SDL_strcmp(gcdb_chunks[mid].first_guid, guid) <= 0)
+		{
+			found = mid;
+			lo = mid + 1;
+		}
+		else
+			hi = mid - 1;
+	}
+
+	return found;
+}
+
+/**
+ * Add the mappings for the given GUID from the database.
+ *
+ * \return Number of mappings added.
+ */
+static int input_gcdb_add_guid(const char *guid)
+{
+	const struct gcdb_chunk_s *chunk;
+	const char *const platform = SDL_GetPlatform();
+	unsigned long txt_len;
+	char *txt, *line;
+	int i, added = 0;
+
+	i = input_gcdb_find(guid);
+	if(i < 0)
+		return 0;
+
+	chunk = &gcdb_chunks[i];
+	txt_len = chunk->txt_len;
+	txt = SDL_malloc(txt_len + 1);
+	if(txt == NULL)
+		return 0;
+
+	if(tinf_uncompress(txt, &txt_len, gcdb_bin + chunk->offset,
+			chunk->len) != TINF_OK)
+	{
+		SDL_LogWarn(SDL_LOG_CATEGORY_INPUT,
+			    "Controller database is corrupt");
+		goto out;
+	}
+
+	txt[txt_len] = '\0';
+	for(line = txt; *line != '\0';)
+	{
+		char *end = SDL_strchr(line, '\n');
+		const char *plat;
+
+		if(end != NULL)
+			*end = '\0';
+
+		/* Mappings for other platforms are only within the database
+		 * used for unknown platforms. */
+		plat = SDL_strstr(line, "platform:");
+		if(SDL_strncmp(line, guid, 32) == 0 && (plat == NULL ||
+			SDL_strncmp(plat + 9, platform,
+				    SDL_strlen(platform)) == 0))
+		{
+			if(SDL_GameControllerAddMapping(line) >= 0)
+				added++;
+		}
+
+		if(end == NULL)
+			break;
+
+		line = end + 1;
+	}
+
+out:
+	SDL_free(txt);
+	return added;
+}
+
+/**
+ * Add the mappings for a joystick from the database, such that the database
+ * does not need to be decompressed and parsed in full on startup.
+ *
+ * \return Number of mappings added.
+ */
+static int input_gcdb_add(Sint32 joy_ind)
+{
+	char guid[33];
+	int added;
+
+	SDL_JoystickGetGUIDString(SDL_JoystickGetDeviceGUID(joy_ind), guid,
+				  sizeof(guid));
+	added = input_gcdb_add_guid(guid);
+	if(added > 0)
+		return added;
+
+	/* Newer versions of SDL store a CRC of the device name within the
+	 * GUID, which is zero within the database. */
+	SDL_memset(guid + 4, '0', 4);
+	return input_gcdb_add_guid(guid);
+}
+
+void input_init(struct input_ctx_s *in_ctx)
+{
 	static const struct
 	{
 		SDL_Scancode sc;
@@ -81,26 +194,23 @@ void input_init(struct input_ctx_s *in_ctx)
 		{ SDL_SCANCODE_I,	{ INPUT_CMD_EVENT, INPUT_EVENT_TOGGLE_INFO }},
 		{ SDL_SCANCODE_F,	{ INPUT_CMD_EVENT, INPUT_EVENT_TOGGLE_FULLSCREEN }},
 		{ SDL_SCANCODE_P,	{ INPUT_CMD_EVENT, INPUT_EVENT_TAKE_SCREENSHOT }},
-		{ SDL_SCANCODE_V,	{ INPUT_CMD_EVENT, INPUT_EVENT_RECORD_VIDEO_TOGGLE }}
+		{ SDL_SCANCODE_V,	{ INPUT_CMD_EVENT, INPUT_EVENT_RECORD_VIDEO_TOGGLE }},
+		{ SDL_SCANCODE_O,	{ INPUT_CMD_EVENT, INPUT_EVENT_DISK_EJECT_TOGGLE }},
+		{ SDL_SCANCODE_N,	{ INPUT_CMD_EVENT, INPUT_EVENT_DISK_NEXT }},
+		{ SDL_SCANCODE_F2,	{ INPUT_CMD_EVENT, INPUT_EVENT_STATE_SAVE }},
+		{ SDL_SCANCODE_F4,	{ INPUT_CMD_EVENT, INPUT_EVENT_STATE_LOAD }},
+		{ SDL_SCANCODE_F6,	{ INPUT_CMD_EVENT, INPUT_EVENT_STATE_SLOT_PREV }},
+		{ SDL_SCANCODE_F7,	{ INPUT_CMD_EVENT, INPUT_EVENT_STATE_SLOT_NEXT }},
+		{ SDL_SCANCODE_F5,	{ INPUT_CMD_EVENT, INPUT_EVENT_STATE_QUICK_SAVE }},
+		{ SDL_SCANCODE_F9,	{ INPUT_CMD_EVENT, INPUT_EVENT_STATE_QUICK_LOAD }},
+		{ SDL_SCANCODE_T,	{ INPUT_CMD_EVENT, INPUT_EVENT_REWIND }}
 	};
 	unsigned i;
 
 	SDL_zerop(in_ctx);
 
-	gcdb_txt = SDL_malloc(gcdb_txt_len);
-	if(gcdb_txt == NULL)
-		goto err;
-
-	tinf = tinf_uncompress(gcdb_txt, &gcdb_txt_len_act, gcdb_bin, gcdb_bin_len);
-	if(tinf != TINF_OK)
-		goto err;
-
-	gcdb_rw = SDL_RWFromConstMem(gcdb_txt, gcdb_txt_len_act);
-	if(SDL_GameControllerAddMappingsFromRW(gcdb_rw, SDL_TRUE) == -1)
-		goto err;
-
-	SDL_free(gcdb_txt);
-
+	/* Controller mappings are added from the database as each joystick is
+	 * attached. */
 	if((in_ctx->input_cmd_event = SDL_RegisterEvents(1)) == (Uint32)-1)
 	{
 		SDL_LogWarn(SDL_LOG_CATEGORY_INPUT,
@@ -115,12 +225,6 @@ void input_init(struct input_ctx_s *in_ctx)
 
 	SDL_LogVerbose(SDL_LOG_CATEGORY_INPUT, "Initialised keyboard input");
 	return;
-
-err:
-	SDL_free(gcdb_txt);
-	SDL_LogWarn(SDL_LOG_CATEGORY_INPUT,
-		    "Unable to initialise input system: %s", SDL_GetError());
-	return;
 }
 
 static SDL_bool input_is_analogue(SDL_GameController *gc)
@@ -193,6 +297,16 @@ static void input_set_keyboard(input_device_s *dev, const SDL_Scancode sc,
 		event.user.code = keymap[sc].cmd;
 		SDL_PushEvent(&event);
 	}
+	else if(keymap[sc].cmd_type == INPUT_CMD_EVENT &&
+			keymap[sc].cmd == INPUT_EVENT_REWIND &&
+			input_cmd_event != ((Uint32) - 1))
+	{
+		/* Rewinding continues whilst the button is held. */
+		SDL_Event event;
+		event.type = input_cmd_event;
+		event.user.code = INPUT_EVENT_REWIND_RELEASE;
+		SDL_PushEvent(&event);
+	}
 }
 
 void input_handle_event(struct input_ctx_s *const in_ctx, const SDL_Event *ev)
@@ -207,6 +321,26 @@ void input_handle_event(struct input_ctx_s *const in_ctx, const SDL_Event *ev)
 		input_set_keyboard(&in_ctx->player[0], ev->key.keysym.scancode,
 			  SDL_RELEASED, in_ctx->input_cmd_event);
 	}
+	else if(ev->type == SDL_JOYDEVICEADDED)
+	{
+		const Sint32 joy_ind = ev->jdevice.which;
+		const SDL_bool was_gc = SDL_IsGameController(joy_ind);
+
+		if(input_gcdb_add(joy_ind) == 0)
+			return;
+
+		/* SDL only announces joysticks with a mapping as game
+		 * controllers, so the joystick is announced again now that it
+		 * has one. */
+		if(was_gc == SDL_FALSE && SDL_IsGameController(joy_ind))
+		{
+			SDL_Event event = { 0 };
+
+			event.type = SDL_CONTROLLERDEVICEADDED;
+			event.cdevice.which = joy_ind;
+			SDL_PushEvent(&event);
+		}
+	}
 	else if(ev->type == SDL_CONTROLLERDEVICEADDED)
 	{
 		SDL_GameController *gc;
@@ -303,11 +437,9 @@ void input_add_controller(struct input_ctx_s *ctx, unsigned port,
 	return;
 }
 
-Sint16 input_get(const struct input_ctx_s *const in_ctx,
-				 unsigned port, unsigned device, unsigned index,
-				 unsigned id)
+void input_poll(struct input_ctx_s *const in_ctx)
 {
-	static SDL_GameControllerButton lr_to_gcb[] =
+	static const SDL_GameControllerButton lr_to_gcb[] =
 	{
 		SDL_CONTROLLER_BUTTON_B,
 		SDL_CONTROLLER_BUTTON_Y,
@@ -321,20 +453,72 @@ Sint16 input_get(const struct input_ctx_s *const in_ctx,
 		SDL_CONTROLLER_BUTTON_X,
 		SDL_CONTROLLER_BUTTON_LEFTSHOULDER,
 		SDL_CONTROLLER_BUTTON_RIGHTSHOULDER,
-		-1, /* L2 */
-		-1, /* R2 */
+		SDL_CONTROLLER_BUTTON_INVALID, /* L2 */
+		SDL_CONTROLLER_BUTTON_INVALID, /* R2 */
 		SDL_CONTROLLER_BUTTON_LEFTSTICK,
 		SDL_CONTROLLER_BUTTON_RIGHTSTICK
 	};
-	const SDL_GameControllerAxis lr_to_gcax[2][2] = {
-		{ SDL_CONTROLLER_AXIS_LEFTX, SDL_CONTROLLER_AXIS_LEFTY },
-		{ SDL_CONTROLLER_AXIS_RIGHTX, SDL_CONTROLLER_AXIS_RIGHTY }
-	};
+	unsigned port;
+
+	for(port = 0; port < MAX_PLAYERS; port++)
+	{
+		input_device_s *d = &in_ctx->player[port];
+		SDL_GameController *gc;
+		Uint16 btns = 0;
+		unsigned id;
+
+		if(d->hai_type != RETRO_INPUT_JOYPAD &&
+				d->hai_type != RETRO_INPUT_ANALOG)
+			continue;
+
+		gc = d->type.pad.ctx;
+		if(gc == NULL)
+			continue;
+
+		for(id = 0; id < SDL_arraysize(lr_to_gcb); id++)
+		{
+			if(lr_to_gcb[id] == SDL_CONTROLLER_BUTTON_INVALID)
+				continue;
+
+			btns |= (Uint16)(SDL_GameControllerGetButton(gc,
+					lr_to_gcb[id]) << id);
+		}
+
+		d->type.pad.left_x = SDL_GameControllerGetAxis(gc,
+				SDL_CONTROLLER_AXIS_LEFTX);
+		d->type.pad.left_y = SDL_GameControllerGetAxis(gc,
+				SDL_CONTROLLER_AXIS_LEFTY);
+		d->type.pad.right_x = SDL_GameControllerGetAxis(gc,
+				SDL_CONTROLLER_AXIS_RIGHTX);
+		d->type.pad.right_y = SDL_GameControllerGetAxis(gc,
+				SDL_CONTROLLER_AXIS_RIGHTY);
+		d->type.pad.l2_x = SDL_GameControllerGetAxis(gc,
+				SDL_CONTROLLER_AXIS_TRIGGERLEFT);
+		d->type.pad.r2_x = SDL_GameControllerGetAxis(gc,
+				SDL_CONTROLLER_AXIS_TRIGGERRIGHT);
+
+		/* Triggers are also digital buttons. */
+		if(d->type.pad.l2_x > INPUT_TRIGGER_THRESHOLD)
+			btns |= 1 << RETRO_DEVICE_ID_JOYPAD_L2;
+
+		if(d->type.pad.r2_x > INPUT_TRIGGER_THRESHOLD)
+			btns |= 1 << RETRO_DEVICE_ID_JOYPAD_R2;
+
+		d->type.pad.btns.all = btns;
+	}
+}
+
+Sint16 input_get(const struct input_ctx_s *const in_ctx,
+				 unsigned port, unsigned device, unsigned index,
+				 unsigned id)
+{
+	const input_device_s *d;
 
 	if(port >= MAX_PLAYERS)
 		return 0;
 
-	if(in_ctx->player[port].hai_type != (input_type_e)device)
+	d = &in_ctx->player[port];
+	if(d->hai_type != (input_type_e)device)
 	{
 		static Uint8 log_lim = 0;
 		if(((log_lim >> port) & 1) == 0)
@@ -342,7 +526,7 @@ Sint16 input_get(const struct input_ctx_s *const in_ctx,
 			SDL_LogVerbose(SDL_LOG_CATEGORY_INPUT,
 				"Core has misidentified device %s on player %u "
 				"as %s",
-				input_type_str[in_ctx->player[port].hai_type], port,
+				input_type_str[d->hai_type], port,
 				input_type_str[device]);
 			SDL_LogVerbose(SDL_LOG_CATEGORY_INPUT,
 				"This error will no longer appear for player "
@@ -351,7 +535,7 @@ Sint16 input_get(const struct input_ctx_s *const in_ctx,
 		log_lim |= 1 << port;
 	}
 
-	switch(in_ctx->player[port].hai_type)
+	switch(d->hai_type)
 	{
 	case RETRO_INPUT_KEYBOARD:
 		switch(device)
@@ -361,22 +545,27 @@ Sint16 input_get(const struct input_ctx_s *const in_ctx,
 			if(id == RETRO_DEVICE_ID_ANALOG_X)
 			{
 				if(index == RETRO_DEVICE_INDEX_ANALOG_LEFT)
-					return in_ctx->player[port].type.keyboard.left_x;
+					return d->type.keyboard.left_x;
 				else if(index == RETRO_DEVICE_INDEX_ANALOG_RIGHT)
-					return in_ctx->player[port].type.keyboard.right_x;
+					return d->type.keyboard.right_x;
 			}
 			else if(id == RETRO_DEVICE_ID_ANALOG_Y)
 			{
 				if(index == RETRO_DEVICE_INDEX_ANALOG_LEFT)
-					return in_ctx->player[port].type.keyboard.left_y;
+					return d->type.keyboard.left_y;
 				else if(index == RETRO_DEVICE_INDEX_ANALOG_RIGHT)
-					return in_ctx->player[port].type.keyboard.right_y;
+					return d->type.keyboard.right_y;
 			}
 
 			return 0;
 		}
 		case RETRO_INPUT_JOYPAD:
-			return (in_ctx->player[port].type.keyboard.btns.all >> id) & 1;
+			if(id == RETRO_DEVICE_ID_JOYPAD_MASK)
+				return (Sint16)d->type.keyboard.btns.all;
+			else if(id > RETRO_DEVICE_ID_JOYPAD_R3)
+				return 0;
+
+			return (d->type.keyboard.btns.all >> id) & 1;
 		}
 		break;
 
@@ -389,25 +578,28 @@ Sint16 input_get(const struct input_ctx_s *const in_ctx,
 		case RETRO_INPUT_ANALOG:
 			/* Only analogue input devices are supported by libretro analog
 			* inputs. */
-
-			if(index < RETRO_DEVICE_INDEX_ANALOG_BUTTON)
+			if(index == RETRO_DEVICE_INDEX_ANALOG_LEFT)
 			{
-				return SDL_GameControllerGetAxis(in_ctx->player[port].type.pad.ctx,
-				                                 lr_to_gcax[index][id]);
+				return id == RETRO_DEVICE_ID_ANALOG_X ?
+					d->type.pad.left_x : d->type.pad.left_y;
+			}
+			else if(index == RETRO_DEVICE_INDEX_ANALOG_RIGHT)
+			{
+				return id == RETRO_DEVICE_ID_ANALOG_X ?
+					d->type.pad.right_x : d->type.pad.right_y;
 			}
-		/* Fall-through */
-		case RETRO_INPUT_JOYPAD:
-		{
-			SDL_GameControllerButton btn = lr_to_gcb[id];
-			if(btn != -1)
-				return SDL_GameControllerGetButton(in_ctx->player[port].type.pad.ctx, btn);
 			else if(id == RETRO_DEVICE_ID_JOYPAD_L2)
-				return SDL_GameControllerGetAxis(in_ctx->player[port].type.pad.ctx, SDL_CONTROLLER_AXIS_TRIGGERLEFT);
+				return d->type.pad.l2_x;
 			else if(id == RETRO_DEVICE_ID_JOYPAD_R2)
-				return SDL_GameControllerGetAxis(in_ctx->player[port].type.pad.ctx, SDL_CONTROLLER_AXIS_TRIGGERRIGHT);
+				return d->type.pad.r2_x;
+		/* Fall-through */
+		case RETRO_INPUT_JOYPAD:
+			if(id == RETRO_DEVICE_ID_JOYPAD_MASK)
+				return (Sint16)d->type.pad.btns.all;
+			else if(id > RETRO_DEVICE_ID_JOYPAD_R3)
+				return 0;
 
-			break;
-		}
+			return (d->type.pad.btns.all >> id) & 1;
 		}
 	}
 	default:
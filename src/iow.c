@@ -0,0 +1,631 @@
+/**
+ * Buffered asynchronous file writer.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#if defined(__linux__)
+/* Required for O_DIRECT and sync_file_range(). */
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <string.h>
+#include <unistd.h>
+#define IOW_USE_FD	1
+#else
+#define IOW_USE_FD	0
+#endif
+
+#include <SDL.h>
+#include <iow.h>
+
+/* Alignment of buffers and buffer sizes, as required by O_DIRECT. */
+#define IOW_ALIGN	4096
+
+struct iow_buf_s {
+	Uint8 *mem;
+	size_t len;
+};
+
+struct iow_s {
+#if IOW_USE_FD
+	int fd;
+	Uint8 direct;
+
+	/* Offset of the file written to by the background thread. */
+	Sint64 file_pos;
+#else
+	SDL_RWops *rw;
+#endif
+	unsigned flags;
+
+	/* Unaligned allocation that holds all buffers. */
+	void *alloc;
+	size_t buf_sz;
+	Uint8 nbufs;
+
+	/* The buffer being filled by the caller, and whether it has been
+	 * written by the background thread. */
+	Uint8 fill;
+	Uint8 fill_ready;
+
+	/* The oldest buffer waiting to be written, and the number of buffers
+	 * waiting to be written. Protected by mtx. */
+	Uint8 head;
+	Uint8 queued;
+	Uint8 quit;
+	Uint8 err;
+	char errstr[128];
+
+	SDL_Thread *th;
+	SDL_mutex *mtx;
+	SDL_cond *cond_work;
+	SDL_cond *cond_free;
+
+	/* Protected by mtx. */
+	struct iow_stats_s st;
+
+	struct iow_buf_s bufs[];
+};
+
+static Uint64 iow_elapsed_us(Uint64 start)
+{
+	Uint64 ticks = SDL_GetPerformanceCounter() - start;
+	return (ticks * 1000000) / SDL_GetPerformanceFrequency();
+}
+
+static int iow_backend_write(iow_ctx *ctx, const Uint8 *data, size_t len)
+{
+#if IOW_USE_FD
+	/* O_DIRECT requires the length to be aligned. This only happens for
+	 * the last buffer, so the remaining data uses the page cache. */
+	if(ctx->direct && (len % IOW_ALIGN) != 0)
+	{
+		int fl = fcntl(ctx->fd, F_GETFL);
+		if(fl != -1)
+			fcntl(ctx->fd, F_SETFL, fl & ~O_DIRECT);
+
+		ctx->direct = 0;
+	}
+
+	while(len > 0)
+	{
+		ssize_t ret = write(ctx->fd, data, len);
+
+		if(ret < 0)
+		{
+			if(errno == EINTR)
+				continue;
+
+			return SDL_SetError("Unable to write to file: %s",
+					    strerror(errno));
+		}
+
+		data += ret;
+		len -= (size_t)ret;
+		ctx->file_pos += ret;
+	}
+
+	return 0;
+#else
+	if(SDL_RWwrite(ctx->rw, data, len, 1) != 1)
+		return -1;
+
+	return 0;
+#endif
+}
+
+#if IOW_USE_FD
+static void iow_backend_nocache(iow_ctx *ctx, size_t len)
+{
+	Sint64 off = ctx->file_pos - (Sint64)len;
+
+	if(ctx->direct || (ctx->flags & IOW_FLAG_NOCACHE) == 0)
+		return;
+
+	/* Start write back of the buffer just written, and drop the previous
+	 * buffer from the page cache; its write back should be complete by
+	 * now. Dirty pages are not dropped by posix_fadvise(). */
+	sync_file_range(ctx->fd, off, (off_t)len, SYNC_FILE_RANGE_WRITE);
+
+	if(off >= (Sint64)ctx->buf_sz)
+	{
+		posix_fadvise(ctx->fd, off - (Sint64)ctx->buf_sz,
+			      (off_t)ctx->buf_sz, POSIX_FADV_DONTNEED);
+	}
+}
+#endif
+
+static int iow_thread(void *param)
+{
+	iow_ctx *ctx = param;
+
+	SDL_LockMutex(ctx->mtx);
+	while(1)
+	{
+		struct iow_buf_s *buf;
+		Uint64 start;
+		Uint64 us;
+		int ret = 0;
+
+		while(ctx->queued == 0 && ctx->quit == 0)
+			SDL_CondWait(ctx->cond_work, ctx->mtx);
+
+		if(ctx->queued == 0)
+			break;
+
+		buf = &ctx->bufs[ctx->head];
+		SDL_UnlockMutex(ctx->mtx);
+
+		/* Discard remaining data after an error. */
+		start = SDL_GetPerformanceCounter();
+		if(ctx->err == 0)
+		{
+			ret = iow_backend_write(ctx, buf->mem, buf->len);
+#if IOW_USE_FD
+			if(ret == 0)
+				iow_backend_nocache(ctx, buf->len);
+#endif
+		}
+		us = iow_elapsed_us(start);
+
+		SDL_LockMutex(ctx->mtx);
+		if(ret != 0)
+		{
+			SDL_strlcpy(ctx->errstr, SDL_GetError(),
+				    sizeof(ctx->errstr));
+			ctx->err = 1;
+		}
+		else
+		{
+			ctx->st.bytes_written += buf->len;
+		}
+
+		ctx->st.flushes++;
+		ctx->st.flush_us += us;
+		ctx->head = (ctx->head + 1) % ctx->nbufs;
+		ctx->queued--;
+		SDL_CondSignal(ctx->cond_free);
+	}
+	SDL_UnlockMutex(ctx->mtx);
+
+	return 0;
+}
+
+/**
+ * Hand the buffer being filled to the background thread, and obtain the next
+ * buffer. If wait_all is set, wait until all buffers have been written.
+ * Otherwise, wait for the next buffer to be free unless IOW_FLAG_NONBLOCK is
+ * set.
+ */
+static int iow_submit(iow_ctx *ctx, SDL_bool wait_all)
+{
+	int ret = 0;
+	SDL_bool ready;
+
+	SDL_LockMutex(ctx->mtx);
+	if(ctx->fill_ready && ctx->bufs[ctx->fill].len > 0)
+	{
+		ctx->queued++;
+		ctx->fill = (ctx->fill + 1) % ctx->nbufs;
+		ctx->fill_ready = 0;
+		SDL_CondSignal(ctx->cond_work);
+	}
+
+	if(wait_all)
+	{
+		while(ctx->queued > 0)
+			SDL_CondWait(ctx->cond_free, ctx->mtx);
+	}
+	else if(ctx->queued == ctx->nbufs &&
+		(ctx->flags & IOW_FLAG_NONBLOCK) == 0)
+	{
+		Uint64 start = SDL_GetPerformanceCounter();
+
+		while(ctx->queued == ctx->nbufs)
+			SDL_CondWait(ctx->cond_free, ctx->mtx);
+
+		ctx->st.stalls++;
+		ctx->st.stall_us += iow_elapsed_us(start);
+	}
+
+	ready = ctx->queued < ctx->nbufs;
+	if(ctx->err)
+		ret = SDL_SetError("%s", ctx->errstr);
+	SDL_UnlockMutex(ctx->mtx);
+
+	/* The new buffer has already been written. */
+	if(ready && ctx->fill_ready == 0)
+	{
+		ctx->bufs[ctx->fill].len = 0;
+		ctx->fill_ready = 1;
+	}
+
+	return ret;
+}
+
+/**
+ * Checks whether the buffer being filled has been written by the background
+ * thread. This is only ever false with IOW_FLAG_NONBLOCK.
+ */
+static SDL_bool iow_fill_ready(iow_ctx *ctx)
+{
+	SDL_bool ready;
+
+	if(ctx->fill_ready)
+		return SDL_TRUE;
+
+	SDL_LockMutex(ctx->mtx);
+	ready = ctx->queued < ctx->nbufs;
+	SDL_UnlockMutex(ctx->mtx);
+
+	if(ready)
+	{
+		ctx->bufs[ctx->fill].len = 0;
+		ctx->fill_ready = 1;
+	}
+
+	return ready;
+}
+
+static void iow_drop(iow_ctx *ctx, size_t len)
+{
+	SDL_LockMutex(ctx->mtx);
+	ctx->st.drops++;
+	ctx->st.bytes_dropped += len;
+	SDL_UnlockMutex(ctx->mtx);
+}
+
+iow_ctx *iow_open(const char *filename, size_t buf_sz, Uint8 nbufs,
+		  unsigned flags)
+{
+	iow_ctx *ctx;
+	Uint8 *aligned;
+	Uint8 i;
+
+	SDL_assert(nbufs >= 2);
+
+	buf_sz = (buf_sz + IOW_ALIGN - 1) & ~(size_t)(IOW_ALIGN - 1);
+	ctx = SDL_calloc(1, sizeof(iow_ctx) + nbufs * sizeof(struct iow_buf_s));
+	if(ctx == NULL)
+	{
+		SDL_OutOfMemory();
+		return NULL;
+	}
+
+	ctx->buf_sz = buf_sz;
+	ctx->nbufs = nbufs;
+	ctx->flags = flags;
+	ctx->fill_ready = 1;
+#if IOW_USE_FD
+	ctx->fd = -1;
+#endif
+
+	ctx->alloc = SDL_malloc(buf_sz * nbufs + IOW_ALIGN);
+	if(ctx->alloc == NULL)
+	{
+		SDL_OutOfMemory();
+		goto err;
+	}
+
+	aligned = (Uint8 *)(((uintptr_t)ctx->alloc + IOW_ALIGN - 1) &
+			    ~(uintptr_t)(IOW_ALIGN - 1));
+	for(i = 0; i < nbufs; i++)
+		ctx->bufs[i].mem = aligned + (buf_sz * i);
+
+#if IOW_USE_FD
+	if(SDL_strncmp(filename, "fd:", 3) == 0)
+	{
+		char *end;
+		long fd = SDL_strtol(filename + 3, &end, 10);
+
+		/* The descriptor is duplicated, so that closing the writer
+		 * leaves the inherited descriptor open for the next
+		 * recording, and never closes stdout. */
+		if(end == filename + 3 || *end != '\0' || fd < 0 ||
+		   fd > INT_MAX ||
+		   (ctx->fd = fcntl((int)fd, F_DUPFD_CLOEXEC, 0)) == -1)
+		{
+			SDL_SetError("Invalid file descriptor %s", filename);
+			goto err;
+		}
+	}
+	else
+	{
+		/* Files are opened without blocking, so that opening a named
+		 * pipe that has no reader fails rather than waiting for one. */
+		if(flags & IOW_FLAG_DIRECT)
+		{
+			ctx->fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC |
+					O_CLOEXEC | O_NONBLOCK | O_DIRECT,
+					0666);
+			ctx->direct = ctx->fd != -1;
+		}
+
+		/* The filesystem may not support O_DIRECT. */
+		if(ctx->fd == -1)
+		{
+			ctx->fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC |
+					O_CLOEXEC | O_NONBLOCK, 0666);
+		}
+
+		if(ctx->fd == -1 && errno == ENXIO)
+		{
+			SDL_SetError("Unable to open %s: the pipe has no "
+				     "reader", filename);
+			goto err;
+		}
+
+		/* Writes by the background thread may block. */
+		if(ctx->fd == -1 || fcntl(ctx->fd, F_SETFL,
+				fcntl(ctx->fd, F_GETFL) & ~O_NONBLOCK) == -1)
+		{
+			SDL_SetError("Unable to open %s: %s", filename,
+				     strerror(errno));
+			goto err;
+		}
+	}
+#else
+	ctx->rw = SDL_RWFromFile(filename, "wb");
+	if(ctx->rw == NULL)
+		goto err;
+#endif
+
+	ctx->mtx = SDL_CreateMutex();
+	ctx->cond_work = SDL_CreateCond();
+	ctx->cond_free = SDL_CreateCond();
+	if(ctx->mtx == NULL || ctx->cond_work == NULL ||
+	   ctx->cond_free == NULL)
+		goto err;
+
+	ctx->th = SDL_CreateThread(iow_thread, "Writer", ctx);
+	if(ctx->th == NULL)
+		goto err;
+
+	return ctx;
+
+err:
+#if IOW_USE_FD
+	if(ctx->fd != -1)
+		close(ctx->fd);
+#else
+	if(ctx->rw != NULL)
+		SDL_RWclose(ctx->rw);
+#endif
+	SDL_DestroyCond(ctx->cond_free);
+	SDL_DestroyCond(ctx->cond_work);
+	SDL_DestroyMutex(ctx->mtx);
+	SDL_free(ctx->alloc);
+	SDL_free(ctx);
+	return NULL;
+}
+
+int iow_write(iow_ctx *ctx, const void *data, size_t len)
+{
+	const Uint8 *src = data;
+
+	if(ctx->flags & IOW_FLAG_NONBLOCK)
+	{
+		size_t avail = 0;
+
+		/* Only accept the write if it can be completed without
+		 * waiting, so that partial writes are not made. */
+		if(iow_fill_ready(ctx))
+		{
+			Uint8 free_bufs;
+
+			SDL_LockMutex(ctx->mtx);
+			free_bufs = ctx->nbufs - ctx->queued - 1;
+			SDL_UnlockMutex(ctx->mtx);
+
+			avail = ctx->buf_sz - ctx->bufs[ctx->fill].len +
+				free_bufs * ctx->buf_sz;
+		}
+
+		if(len > avail)
+		{
+			iow_drop(ctx, len);
+			return 0;
+		}
+	}
+
+	SDL_LockMutex(ctx->mtx);
+	ctx->st.bytes_queued += len;
+	SDL_UnlockMutex(ctx->mtx);
+
+	while(len > 0)
+	{
+		struct iow_buf_s *buf = &ctx->bufs[ctx->fill];
+		size_t cpy = ctx->buf_sz - buf->len;
+
+		if(cpy > len)
+			cpy = len;
+
+		SDL_memcpy(buf->mem + buf->len, src, cpy);
+		buf->len += cpy;
+		src += cpy;
+		len -= cpy;
+
+		if(buf->len == ctx->buf_sz && iow_submit(ctx, SDL_FALSE) != 0)
+			return -1;
+	}
+
+	return 0;
+}
+
+void *iow_reserve(iow_ctx *ctx, size_t len)
+{
+	if(len > ctx->buf_sz)
+	{
+		SDL_SetError("Reservation of %lu bytes exceeds buffer size",
+			     (unsigned long)len);
+		return NULL;
+	}
+
+	if(iow_fill_ready(ctx) &&
+	   ctx->buf_sz - ctx->bufs[ctx->fill].len < len &&
+	   iow_submit(ctx, SDL_FALSE) != 0)
+		return NULL;
+
+	if(iow_fill_ready(ctx) == SDL_FALSE)
+	{
+		iow_drop(ctx, len);
+		return NULL;
+	}
+
+	return ctx->bufs[ctx->fill].mem + ctx->bufs[ctx->fill].len;
+}
+
+int iow_commit(iow_ctx *ctx, size_t len)
+{
+	struct iow_buf_s *buf = &ctx->bufs[ctx->fill];
+
+	SDL_assert(ctx->fill_ready);
+	SDL_assert(buf->len + len <= ctx->buf_sz);
+
+	buf->len += len;
+
+	SDL_LockMutex(ctx->mtx);
+	ctx->st.bytes_queued += len;
+	SDL_UnlockMutex(ctx->mtx);
+
+	if(buf->len == ctx->buf_sz)
+		return iow_submit(ctx, SDL_FALSE);
+
+	return 0;
+}
+
+int iow_pwrite(iow_ctx *ctx, Sint64 offset, const void *data, size_t len)
+{
+	if(iow_submit(ctx, SDL_TRUE) != 0)
+		return -1;
+
+#if IOW_USE_FD
+	{
+		const Uint8 *src = data;
+
+		if(ctx->direct)
+		{
+			int fl = fcntl(ctx->fd, F_GETFL);
+			if(fl != -1)
+				fcntl(ctx->fd, F_SETFL, fl & ~O_DIRECT);
+
+			ctx->direct = 0;
+		}
+
+		while(len > 0)
+		{
+			ssize_t ret = pwrite(ctx->fd, src, len, offset);
+
+			if(ret < 0)
+			{
+				if(errno == EINTR)
+					continue;
+
+				return SDL_SetError("Unable to write to file: "
+						    "%s", strerror(errno));
+			}
+
+			src += ret;
+			len -= (size_t)ret;
+			offset += ret;
+		}
+	}
+#else
+	if(SDL_RWseek(ctx->rw, offset, RW_SEEK_SET) < 0)
+		return -1;
+
+	if(SDL_RWwrite(ctx->rw, data, len, 1) != 1)
+		return -1;
+
+	if(SDL_RWseek(ctx->rw, 0, RW_SEEK_END) < 0)
+		return -1;
+#endif
+
+	return 0;
+}
+
+Sint64 iow_tell(iow_ctx *ctx)
+{
+	Sint64 pos;
+
+	SDL_LockMutex(ctx->mtx);
+	pos = (Sint64)ctx->st.bytes_queued;
+	SDL_UnlockMutex(ctx->mtx);
+
+	return pos;
+}
+
+void iow_get_stats(iow_ctx *ctx, struct iow_stats_s *stats)
+{
+	SDL_LockMutex(ctx->mtx);
+	*stats = ctx->st;
+	SDL_UnlockMutex(ctx->mtx);
+}
+
+int iow_close(iow_ctx *ctx)
+{
+	int ret;
+
+	if(ctx == NULL)
+		return 0;
+
+	ret = iow_submit(ctx, SDL_TRUE);
+
+	SDL_LockMutex(ctx->mtx);
+	ctx->quit = 1;
+	SDL_CondSignal(ctx->cond_work);
+	SDL_UnlockMutex(ctx->mtx);
+	SDL_WaitThread(ctx->th, NULL);
+
+#if IOW_USE_FD
+	if(close(ctx->fd) != 0 && ret == 0)
+		ret = SDL_SetError("Unable to close file: %s", strerror(errno));
+#else
+	if(SDL_RWclose(ctx->rw) != 0 && ret == 0)
+		ret = -1;
+#endif
+
+	{
+		const struct iow_stats_s *st = &ctx->st;
+		double mibps = 0.0;
+
+		if(st->flush_us > 0)
+		{
+			mibps = ((double)st->bytes_written / (1024.0 * 1024.0)) /
+				((double)st->flush_us / 1000000.0);
+		}
+
+		SDL_LogVerbose(SDL_LOG_CATEGORY_SYSTEM,
+			       "Wrote %" SDL_PRIu64 " KiB in %u flushes at "
+			       "%.1f MiB/s; writer stalled %u times for %"
+			       SDL_PRIu64 " ms",
+			       st->bytes_written / 1024, st->flushes, mibps,
+			       st->stalls, st->stall_us / 1000);
+
+		if(st->drops > 0)
+		{
+			SDL_LogWarn(SDL_LOG_CATEGORY_SYSTEM,
+				    "Writer dropped %u writes totalling %"
+				    SDL_PRIu64 " KiB", st->drops,
+				    st->bytes_dropped / 1024);
+		}
+	}
+
+	SDL_DestroyCond(ctx->cond_free);
+	SDL_DestroyCond(ctx->cond_work);
+	SDL_DestroyMutex(ctx->mtx);
+	SDL_free(ctx->alloc);
+	SDL_free(ctx);
+
+	return ret;
+}
@@ -0,0 +1,251 @@
+/**
+ * Pool of worker threads for background jobs.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#include <SDL.h>
+#include <job.h>
+
+/* Number of jobs that may be queued per priority. Must be a power of two. */
+#define JOB_QUEUE_SZ	64
+#define JOB_QUEUE_MASK	(JOB_QUEUE_SZ - 1)
+#define JOB_MAX_WORKERS	4
+
+struct job_cell_s {
+	/* Sequence number used to determine whether the cell is free to be
+	 * written to, or ready to be read from. */
+	SDL_atomic_t seq;
+	job_fn fn;
+	void *arg;
+};
+
+/* Bounded multi-producer multi-consumer queue. */
+struct job_queue_s {
+	struct job_cell_s cells[JOB_QUEUE_SZ];
+	SDL_atomic_t enq;
+	SDL_atomic_t deq;
+};
+
+static struct {
+	struct job_queue_s q[JOB_PRIO_MAX];
+
+	/* Counts the number of queued jobs, plus a wake up per worker on
+	 * exit. */
+	SDL_sem *sem;
+	SDL_Thread *workers[JOB_MAX_WORKERS];
+	unsigned nworkers;
+
+	SDL_atomic_t running;
+	SDL_atomic_t quit;
+	SDL_atomic_t jobs_run;
+	SDL_atomic_t jobs_inline;
+} pool;
+
+/* Difference of two sequence numbers, allowing for wrap around. */
+static int job_seq_diff(int a, int b)
+{
+	return (int)((unsigned)a - (unsigned)b);
+}
+
+static SDL_bool job_push(struct job_queue_s *q, job_fn fn, void *arg)
+{
+	struct job_cell_s *cell;
+	int pos = SDL_AtomicGet(&q->enq);
+
+	while(1)
+	{
+		int dif;
+
+		cell = &q->cells[(unsigned)pos & JOB_QUEUE_MASK];
+		dif = job_seq_diff(SDL_AtomicGet(&cell->seq), pos);
+
+		if(dif == 0 && SDL_AtomicCAS(&q->enq, pos, pos + 1))
+			break;
+		else if(dif < 0)
+			return SDL_FALSE;
+
+		pos = SDL_AtomicGet(&q->enq);
+	}
+
+	cell->fn = fn;
+	cell->arg = arg;
+
+	/* Publish the job to consumers. */
+	SDL_AtomicSet(&cell->seq, pos + 1);
+	return SDL_TRUE;
+}
+
+static SDL_bool job_pop(struct job_queue_s *q, job_fn *fn, void **arg)
+{
+	struct job_cell_s *cell;
+	int pos = SDL_AtomicGet(&q->deq);
+
+	while(1)
+	{
+		int dif;
+
+		cell = &q->cells[(unsigned)pos & JOB_QUEUE_MASK];
+		dif = job_seq_diff(SDL_AtomicGet(&cell->seq), pos + 1);
+
+		if(dif == 0 && SDL_AtomicCAS(&q->deq, pos, pos + 1))
+			break;
+		else if(dif < 0)
+			return SDL_FALSE;
+
+		pos = SDL_AtomicGet(&q->deq);
+	}
+
+	*fn = cell->fn;
+	*arg = cell->arg;
+
+	/* Free the cell for the next lap of producers. */
+	SDL_AtomicSet(&cell->seq, pos + JOB_QUEUE_SZ);
+	return SDL_TRUE;
+}
+
+static int job_worker(void *param)
+{
+	(void)param;
+
+	SDL_SetThreadPriority(SDL_THREAD_PRIORITY_LOW);
+
+	while(1)
+	{
+		job_fn fn = NULL;
+		void *arg = NULL;
+		unsigned p;
+
+		SDL_SemWait(pool.sem);
+
+		for(p = 0; p < JOB_PRIO_MAX; p++)
+		{
+			if(job_pop(&pool.q[p], &fn, &arg))
+				break;
+		}
+
+		/* Only exit once all queued jobs have been executed. */
+		if(fn == NULL)
+		{
+			if(SDL_AtomicGet(&pool.quit))
+				break;
+
+			continue;
+		}
+
+		fn(arg);
+		SDL_AtomicIncRef(&pool.jobs_run);
+	}
+
+	return 0;
+}
+
+int job_init(void)
+{
+	int cpus = SDL_GetCPUCount();
+	unsigned p, i;
+
+	SDL_assert(SDL_AtomicGet(&pool.running) == 0);
+
+	for(p = 0; p < JOB_PRIO_MAX; p++)
+	{
+		struct job_queue_s *q = &pool.q[p];
+
+		for(i = 0; i < JOB_QUEUE_SZ; i++)
+			SDL_AtomicSet(&q->cells[i].seq, (int)i);
+
+		SDL_AtomicSet(&q->enq, 0);
+		SDL_AtomicSet(&q->deq, 0);
+	}
+
+	SDL_AtomicSet(&pool.quit, 0);
+	pool.sem = SDL_CreateSemaphore(0);
+	if(pool.sem == NULL)
+		return -1;
+
+	/* Leave a CPU for the main thread. */
+	pool.nworkers = cpus > 2 ? (unsigned)(cpus - 1) : 1;
+	if(pool.nworkers > JOB_MAX_WORKERS)
+		pool.nworkers = JOB_MAX_WORKERS;
+
+	for(i = 0; i < pool.nworkers; i++)
+	{
+		pool.workers[i] = SDL_CreateThread(job_worker, "Worker", NULL);
+		if(pool.workers[i] == NULL)
+			break;
+	}
+
+	if(i == 0)
+	{
+		SDL_DestroySemaphore(pool.sem);
+		pool.sem = NULL;
+		return -1;
+	}
+
+	pool.nworkers = i;
+	SDL_AtomicSet(&pool.running, 1);
+	SDL_LogVerbose(SDL_LOG_CATEGORY_SYSTEM, "Started %u worker threads",
+		       pool.nworkers);
+
+	return 0;
+}
+
+void job_submit(job_prio_e prio, job_fn fn, void *arg)
+{
+	SDL_assert(prio < JOB_PRIO_MAX);
+
+	if(SDL_AtomicGet(&pool.running) && SDL_AtomicGet(&pool.quit) == 0 &&
+	   job_push(&pool.q[prio], fn, arg))
+	{
+		SDL_SemPost(pool.sem);
+		return;
+	}
+
+	SDL_AtomicIncRef(&pool.jobs_inline);
+	fn(arg);
+}
+
+void job_exit(void)
+{
+	unsigned i;
+
+	if(SDL_AtomicGet(&pool.running) == 0)
+		return;
+
+	SDL_AtomicSet(&pool.quit, 1);
+	for(i = 0; i < pool.nworkers; i++)
+		SDL_SemPost(pool.sem);
+
+	for(i = 0; i < pool.nworkers; i++)
+		SDL_WaitThread(pool.workers[i], NULL);
+
+	/* Execute jobs that were queued whilst the workers were exiting. */
+	for(i = 0; i < JOB_PRIO_MAX; i++)
+	{
+		job_fn fn;
+		void *arg;
+
+		while(job_pop(&pool.q[i], &fn, &arg))
+		{
+			fn(arg);
+			SDL_AtomicIncRef(&pool.jobs_inline);
+		}
+	}
+
+	SDL_DestroySemaphore(pool.sem);
+	pool.sem = NULL;
+	SDL_AtomicSet(&pool.running, 0);
+
+	SDL_LogVerbose(SDL_LOG_CATEGORY_SYSTEM,
+		       "Worker threads executed %d jobs; %d jobs executed "
+		       "without a worker", SDL_AtomicGet(&pool.jobs_run),
+		       SDL_AtomicGet(&pool.jobs_inline));
+}
@@ -13,30 +13,165 @@
  */
 
 #include <SDL.h>
+#include <string.h>
 
+#ifdef _WIN32
+#include <windows.h>
+#define LOAD_SCAN_FORK	0
+#else
+#include <dirent.h>
+#include <errno.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define LOAD_SCAN_FORK	1
+#endif
+
+#include <archive.h>
+#include <coreinfo.h>
+#include <disk.h>
+#include <fmap.h>
 #include <haiyajan.h>
+#include <job.h>
 #include <libretro.h>
 #include <load.h>
+#include <util.h>
+
+/* Extensions of files that may be libretro cores. */
+#define LOAD_CORE_EXTS		"so|dll|dylib"
+
+/* Maximum number of cores probed at once. */
+#define LOAD_SCAN_PROCS_MAX	32
+
+/* Seconds that a core may take to be probed before it is killed. */
+#define LOAD_SCAN_TIMEOUT_S	10
+
+/* Maximum size of the information obtained from each core. */
+#define LOAD_SCAN_INFO_MAX	4096
+
+/* A copy of SRAM to be written to file by a worker thread. */
+struct sram_job_s
+{
+	char *filename;
+	SDL_atomic_t *saving;
+
+	/* Hash of data, stored to saved_hash once it has been written. */
+	Uint64 hash;
+	Uint64 *saved_hash;
+
+	size_t len;
+	Uint8 data[];
+};
+
+static void sram_job(void *arg)
+{
+	struct sram_job_s *job = arg;
+
+	if(util_write_file(job->filename, job->data, job->len) != 0)
+	{
+		SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+			    "Unable to save SRAM: %s", SDL_GetError());
+	}
+	else
+	{
+		/* The hash is only updated once the save succeeds, so that
+		 * a failed save is attempted again. It is read by the main
+		 * thread only once saving is cleared. */
+		*job->saved_hash = job->hash;
+		SDL_MemoryBarrierRelease();
+		SDL_LogVerbose(SDL_LOG_CATEGORY_APPLICATION,
+			       "Saved SRAM file in background.");
+	}
+
+	SDL_AtomicSet(job->saving, 0);
+	SDL_free(job->filename);
+	SDL_free(job);
+}
+
+void autosave_sram(struct core_ctx_s *ctx)
+{
+	struct sram_job_s *job;
+	size_t sram_size;
+	void *sram_dat;
+	Uint64 hash;
+
+	if(ctx->sram_filename == NULL ||
+		ctx->env.frames % SRAM_AUTOSAVE_FRAMES != 0)
+		return;
+
+	sram_size = ctx->fn.retro_get_memory_size(RETRO_MEMORY_SAVE_RAM);
+	sram_dat = ctx->fn.retro_get_memory_data(RETRO_MEMORY_SAVE_RAM);
+	if(sram_dat == NULL || sram_size == 0)
+		return;
+
+	/* Try again on the next check if the previous save is unfinished.
+	 * Until then, the hash may be written by the worker. */
+	if(SDL_AtomicGet(&ctx->sram_saving) != 0)
+		return;
+
+	SDL_MemoryBarrierAcquire();
+	hash = util_hash(sram_dat, sram_size, 0);
+	if(hash == ctx->sram_hash)
+		return;
+
+	SDL_AtomicSet(&ctx->sram_saving, 1);
+
+	/* SRAM is copied so that the core may continue to modify it whilst it
+	 * is being written. */
+	job = SDL_malloc(sizeof(*job) + sram_size);
+	if(job == NULL)
+		goto err;
+
+	job->filename = SDL_strdup(ctx->sram_filename);
+	if(job->filename == NULL)
+	{
+		SDL_free(job);
+		goto err;
+	}
+
+	job->saving = &ctx->sram_saving;
+	job->hash = hash;
+	job->saved_hash = &ctx->sram_hash;
+	job->len = sram_size;
+	SDL_memcpy(job->data, sram_dat, sram_size);
+	job_submit(JOB_PRIO_HIGH, sram_job, job);
+	return;
+
+err:
+	SDL_AtomicSet(&ctx->sram_saving, 0);
+	return;
+}
 
 static void save_sram_file(struct core_ctx_s *ctx)
 {
-	SDL_RWops *sram_rw;
 	size_t sram_size;
 	void *sram_dat;
 
 	if(ctx->sram_filename == NULL)
 		goto out;
 
-	sram_rw = SDL_RWFromFile(ctx->sram_filename, "wb");
-	if(sram_rw == NULL)
-		goto out;
+	/* Wait for a background save to finish before it is replaced. */
+	while(SDL_AtomicGet(&ctx->sram_saving) != 0)
+		SDL_Delay(1);
 
+	SDL_MemoryBarrierAcquire();
 	sram_size = ctx->fn.retro_get_memory_size(RETRO_MEMORY_SAVE_RAM);
 	sram_dat = ctx->fn.retro_get_memory_data(RETRO_MEMORY_SAVE_RAM);
-	if(sram_dat != NULL)
-		SDL_RWwrite(sram_rw, sram_dat, sram_size, 1);
+	if(sram_dat == NULL || sram_size == 0)
+		goto out;
+
+	/* Avoid rewriting a save that has not changed. */
+	if(util_hash(sram_dat, sram_size, 0) == ctx->sram_hash)
+		goto out;
+
+	if(util_write_file(ctx->sram_filename, sram_dat, sram_size) != 0)
+	{
+		SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+			    "Unable to save SRAM: %s", SDL_GetError());
+		goto out;
+	}
 
-	SDL_RWclose(sram_rw);
 	SDL_LogVerbose(SDL_LOG_CATEGORY_APPLICATION, "Saved SRAM file.");
 
 out:
@@ -51,60 +186,304 @@ static void load_sram_file(struct core_ctx_s *ctx)
 	SDL_RWops *sram_rw;
 	size_t sram_size;
 	size_t sram_size_exp;
-	size_t sram_len;
 	void *sram_dat;
 
 	if(ctx->content_filename == NULL)
 		goto out;
 
-	ctx->sram_filename = SDL_strdup(ctx->content_filename);
+	ctx->sram_filename = util_replace_ext(ctx->content_filename, ".srm");
 	if(ctx->sram_filename == NULL)
 		goto out;
 
-	sram_len = SDL_strlen(ctx->sram_filename) - 1;
-	*(ctx->sram_filename + sram_len--) = 'm';
-	*(ctx->sram_filename + sram_len--) = 'r';
-	*(ctx->sram_filename + sram_len--) = 's';
-	*(ctx->sram_filename + sram_len--) = '.';
+	sram_size_exp =
+		ctx->fn.retro_get_memory_size(RETRO_MEMORY_SAVE_RAM);
+	sram_dat = ctx->fn.retro_get_memory_data(RETRO_MEMORY_SAVE_RAM);
+	SDL_AtomicSet(&ctx->sram_saving, 0);
 
 	sram_rw = SDL_RWFromFile(ctx->sram_filename, "rb");
 	if(sram_rw == NULL)
 	{
 		SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
-			    "Save file not found; a new one will be created.");
-		goto out;
+			    "Save file not found; one will be created once "
+			    "SRAM is modified.");
+		goto hash;
 	}
 
 	sram_size = SDL_RWsize(sram_rw);
-	sram_size_exp =
-		ctx->fn.retro_get_memory_size(RETRO_MEMORY_SAVE_RAM);
 	sram_size = sram_size > sram_size_exp ? sram_size_exp : sram_size;
-	sram_dat = ctx->fn.retro_get_memory_data(RETRO_MEMORY_SAVE_RAM);
 	if(sram_dat != NULL)
 		SDL_RWread(sram_rw, sram_dat, sram_size, 1);
 
 	SDL_LogVerbose(SDL_LOG_CATEGORY_APPLICATION, "Read SRAM file.");
 	SDL_RWclose(sram_rw);
 
+hash:
+	/* SRAM is only saved once it differs from what was loaded. */
+	if(sram_dat != NULL)
+		ctx->sram_hash = util_hash(sram_dat, sram_size_exp, 0);
+
 out:
 	return;
 }
 
+/* Content read into memory by a worker thread whilst the core starts. */
+struct load_content_s
+{
+	const char *filename;
+	const char *exts;
+	unsigned map_flags;
+
+	/* Percentage of content read. */
+	SDL_atomic_t progress;
+
+	/* Set to stop reading content that will not be used. */
+	SDL_atomic_t cancel;
+
+	/* Set once the job has finished. */
+	SDL_atomic_t done;
+
+	/* Results, owned by this context until taken by
+	 * load_libretro_file(). */
+	int ret;
+	char err[128];
+	fmap_ctx *map;
+	Uint8 *data;
+	size_t size;
+	char *path;
+	Uint32 crc;
+};
+
+static int load_archive_progress(void *priv, unsigned percent)
+{
+	struct load_content_s *lc = priv;
+
+	SDL_AtomicSet(&lc->progress, (int)percent);
+	return SDL_AtomicGet(&lc->cancel);
+}
+
+/**
+ * Decompress content from a zip archive or gzip file into memory. The first
+ * entry with an extension supported by the core is used.
+ */
+static int load_archive_file(struct load_content_s *lc)
+{
+	archive_ctx *arc;
+	unsigned entry;
+	void *dst;
+	size_t path_len;
+	int found;
+	int ret = 1;
+
+	arc = archive_open(lc->filename);
+	if(arc == NULL)
+		return 1;
+
+	found = archive_find(arc, lc->exts);
+	if(found < 0)
+	{
+		SDL_SetError("No content supported by this core was found "
+			     "within %s", lc->filename);
+		goto out;
+	}
+
+	entry = (unsigned)found;
+	lc->size = archive_size(arc, entry);
+
+	/* Allocate at least one byte so that empty content is not NULL. */
+	lc->data = SDL_malloc(lc->size + 1);
+	if(lc->data == NULL)
+	{
+		SDL_OutOfMemory();
+		goto out;
+	}
+
+	/* Entries are verified with their CRC-32 during extraction, so it
+	 * need not be calculated again. */
+	dst = lc->data;
+	if(archive_extract(arc, 1, &entry, &dst, load_archive_progress,
+			   lc) != 0)
+		goto out;
+
+	lc->crc = archive_crc(arc, entry);
+
+	/* The path of the entry is given as "archive#entry". */
+	path_len = SDL_strlen(lc->filename) +
+		SDL_strlen(archive_name(arc, entry)) + 2;
+	lc->path = SDL_malloc(path_len);
+	if(lc->path == NULL)
+	{
+		SDL_OutOfMemory();
+		goto out;
+	}
+
+	SDL_snprintf(lc->path, path_len, "%s#%s", lc->filename,
+		     archive_name(arc, entry));
+	ret = 0;
+
+out:
+	if(ret != 0)
+	{
+		SDL_free(lc->data);
+		lc->data = NULL;
+	}
+
+	archive_close(arc);
+	return ret;
+}
+
+/**
+ * Map content into memory, and read it by calculating its CRC-32, so that the
+ * core does not wait for the disk once it starts.
+ */
+static int load_mapped_file(struct load_content_s *lc)
+{
+	/* Progress is updated after each step. */
+	const size_t step = 1024 * 1024;
+	const Uint8 *data;
+	size_t done;
+
+	lc->map = fmap_open(lc->filename, lc->map_flags);
+	if(lc->map == NULL)
+		return 1;
+
+	data = fmap_data(lc->map);
+	lc->size = fmap_size(lc->map);
+
+	for(done = 0; done < lc->size; done += step)
+	{
+		size_t len = SDL_min(step, lc->size - done);
+
+		if(SDL_AtomicGet(&lc->cancel) != 0)
+			return SDL_SetError("Reading content was cancelled");
+
+		lc->crc = util_crc32(data + done, len, lc->crc);
+		SDL_AtomicSet(&lc->progress,
+			      (int)((Uint64)(done + len) * 100 / lc->size));
+	}
+
+	return 0;
+}
+
+static void load_content_job(void *arg)
+{
+	struct load_content_s *lc = arg;
+	Uint32 ticks = SDL_GetTicks();
+
+	/* Archives are only decompressed for cores that do not support
+	 * them. */
+	if(util_has_ext(lc->filename, ARCHIVE_EXTS) &&
+		!util_has_ext(lc->filename, lc->exts))
+		lc->ret = load_archive_file(lc);
+	else
+		lc->ret = load_mapped_file(lc);
+
+	if(lc->ret != 0)
+	{
+		SDL_strlcpy(lc->err, SDL_GetError(), sizeof(lc->err));
+	}
+	else
+	{
+		SDL_LogVerbose(SDL_LOG_CATEGORY_APPLICATION,
+			       "Read %s (%lu bytes, CRC32 %08X) in %u ms",
+			       lc->path != NULL ? lc->path : lc->filename,
+			       (unsigned long)lc->size, lc->crc,
+			       SDL_GetTicks() - ticks);
+	}
+
+	SDL_AtomicSet(&lc->progress, 100);
+	SDL_AtomicSet(&lc->done, 1);
+}
+
+/**
+ * Obtain the path of the content given to the core. For playlists that the
+ * core does not support, this is the first image of the playlist.
+ */
+static const char *load_content_path(const struct core_ctx_s *ctx)
+{
+	if(ctx->disks != NULL)
+		return disk_path(ctx->disks, 0);
+
+	return ctx->content_filename;
+}
+
+int load_content_begin(struct core_ctx_s *ctx)
+{
+	struct load_content_s *lc;
+
+	SDL_assert(ctx->content_load == NULL);
+
+	/* The content filename remains that of the playlist, such that SRAM
+	 * is shared between its images. */
+	if(ctx->disks == NULL &&
+		util_has_ext(ctx->content_filename, DISK_PLAYLIST_EXTS) &&
+		!util_has_ext(ctx->content_filename,
+			ctx->sys_info.valid_extensions))
+	{
+		ctx->disks = disk_open_m3u(ctx->content_filename);
+		if(ctx->disks == NULL)
+			return -1;
+	}
+
+	/* Cores that read content themselves are given its path. */
+	if(ctx->content_filename == NULL ||
+		ctx->sys_info.need_fullpath == true)
+		return 0;
+
+	lc = SDL_calloc(1, sizeof(*lc));
+	if(lc == NULL)
+	{
+		SDL_OutOfMemory();
+		return -1;
+	}
+
+	lc->filename = load_content_path(ctx);
+	lc->exts = ctx->sys_info.valid_extensions;
+	lc->map_flags = ctx->content_map_flags;
+	ctx->content_load = lc;
+	job_submit(JOB_PRIO_HIGH, load_content_job, lc);
+
+	return 0;
+}
+
+int load_content_progress(const load_content_ctx *lc)
+{
+	return SDL_AtomicGet((SDL_atomic_t *)&lc->progress);
+}
+
+SDL_bool load_content_done(const load_content_ctx *lc)
+{
+	return SDL_AtomicGet((SDL_atomic_t *)&lc->done) != 0;
+}
+
+static void load_content_wait(load_content_ctx *lc)
+{
+	while(SDL_AtomicGet(&lc->done) == 0)
+		SDL_Delay(1);
+}
+
+void load_content_free(load_content_ctx *lc)
+{
+	if(lc == NULL)
+		return;
+
+	SDL_AtomicSet(&lc->cancel, 1);
+	load_content_wait(lc);
+	fmap_close(lc->map);
+	SDL_free(lc->data);
+	SDL_free(lc->path);
+	SDL_free(lc);
+}
+
 int load_libretro_file(struct core_ctx_s *ctx)
 {
-	/* TODO:
-	 * - Check whether file must be loaded into RAM, or is read straight
-	 * from disk.
-	 * - Read file.
-	 *
-	 * If need_fullpath in retro_system_info is true, then don't load the
-	 * ROM into memory. If false, then Haiyajan must load the ROM image into
-	 * memory.
-	 */
 	struct retro_game_info game;
 	struct retro_game_info *gamep = &game;
+	load_content_ctx *lc;
+	char *game_path = NULL;
+	bool loaded;
 
-	game.path = ctx->content_filename;
+	game.data = NULL;
+	game.size = 0;
 	game.meta = NULL;
 
 	SDL_assert_paranoid(ctx != NULL);
@@ -121,28 +500,55 @@ int load_libretro_file(struct core_ctx_s *ctx)
 	{
 		gamep = NULL;
 	}
-	else if(ctx->sys_info.need_fullpath == true)
-	{
-		ctx->sdl.game_data = NULL;
-		game.data = NULL;
-	}
-	else
+
+	/* Content is read now if it was not started in advance. */
+	if(ctx->content_load == NULL && load_content_begin(ctx) != 0)
+		return 1;
+
+	game.path = load_content_path(ctx);
+
+	lc = ctx->content_load;
+	if(lc != NULL)
 	{
-		ctx->sdl.game_data = SDL_LoadFile(ctx->content_filename, &game.size);
+		int ret;
 
-		if(ctx->sdl.game_data == NULL)
-			return 1;
+		load_content_wait(lc);
+		ret = lc->ret;
+		if(ret != 0)
+			SDL_SetError("%s", lc->err);
+
+		/* Take ownership of the content. */
+		ctx->sdl.game_map = lc->map;
+		ctx->sdl.game_data = lc->data;
+		game_path = lc->path;
+		lc->map = NULL;
+		lc->data = NULL;
+		lc->path = NULL;
+
+		game.data = ctx->sdl.game_map != NULL ?
+			fmap_data(ctx->sdl.game_map) : ctx->sdl.game_data;
+		game.size = lc->size;
+		if(game_path != NULL)
+			game.path = game_path;
 
-		game.data = ctx->sdl.game_data;
+		load_content_free(lc);
+		ctx->content_load = NULL;
+
+		if(ret != 0)
+			return 1;
 	}
 
-	if(ctx->fn.retro_load_game(gamep) == false)
+	loaded = ctx->fn.retro_load_game(gamep);
+	SDL_free(game_path);
+
+	if(loaded == false)
 	{
 		SDL_SetError("Libretro core failed to load content");
 		return 1;
 	}
 
 	load_sram_file(ctx);
+	disk_load(ctx);
 	ctx->env.status.bits.game_loaded = 1;
 	ctx->env.status.bits.shutdown = 0;
 
@@ -286,6 +692,12 @@ void unload_libretro_file(struct core_ctx_s *ctx)
 		ctx->sdl.game_data = NULL;
 	}
 
+	fmap_close(ctx->sdl.game_map);
+	ctx->sdl.game_map = NULL;
+
+	disk_close(ctx->disks);
+	ctx->disks = NULL;
+
 	ctx->env.status.bits.game_loaded = 0;
 }
 
@@ -306,4 +718,426 @@ void unload_libretro_core(struct core_ctx_s *ctx)
 	}
 
 	SDL_zero(ctx->fn);
+	SDL_zero(ctx->env.disk_cb);
+}
+
+/**
+ * Obtain the information of a core without initialising it. The name,
+ * version, extensions, need_fullpath and license of the core are written to
+ * buf, each terminated by a null character.
+ *
+ * \return	Number of bytes written to buf, or 0 on error.
+ */
+static size_t load_probe_core(const char *path, char *buf, size_t len)
+{
+	struct core_ctx_s *ctx;
+	const char *license = NULL;
+	const char *f[5];
+	size_t ret = 0;
+	unsigned i;
+
+	ctx = SDL_calloc(1, sizeof(*ctx));
+	if(ctx == NULL)
+		return 0;
+
+	if(load_libretro_core(path, ctx) != 0)
+		goto out;
+
+	if(ctx->ext_fn.re_core_get_license_info != NULL)
+	{
+		const struct license_info_s *l =
+			ctx->ext_fn.re_core_get_license_info();
+
+		if(l != NULL)
+			license = l->license_spdx;
+	}
+
+	f[0] = ctx->sys_info.library_name;
+	f[1] = ctx->sys_info.library_version;
+	f[2] = ctx->sys_info.valid_extensions;
+	f[3] = ctx->sys_info.need_fullpath ? "1" : "0";
+	f[4] = license;
+
+	for(i = 0; i < SDL_arraysize(f); i++)
+	{
+		const char *str = f[i] != NULL ? f[i] : "";
+		size_t l = SDL_strlen(str) + 1;
+
+		/* Information that does not fit is not used. */
+		if(ret + l > len)
+		{
+			ret = 0;
+			break;
+		}
+
+		SDL_memcpy(buf + ret, str, l);
+		ret += l;
+	}
+
+out:
+	if(ctx->sdl.handle != NULL)
+		SDL_UnloadObject(ctx->sdl.handle);
+
+	SDL_free(ctx);
+	return ret;
+}
+
+/**
+ * Add the information written by load_probe_core() to the cache.
+ */
+static int load_add_probed(coreinfo_ctx *ci, const char *path,
+		const char *buf, size_t len)
+{
+	struct retro_system_info sys;
+	const char *f[5];
+	const char *end = buf + len;
+	unsigned i;
+
+	for(i = 0; i < SDL_arraysize(f); i++)
+	{
+		const char *nul;
+
+		if(buf >= end)
+			return SDL_SetError("Incomplete information");
+
+		nul = memchr(buf, '\0', (size_t)(end - buf));
+		if(nul == NULL)
+			return SDL_SetError("Incomplete information");
+
+		f[i] = buf;
+		buf = nul + 1;
+	}
+
+	SDL_zero(sys);
+	sys.library_name = f[0];
+	sys.library_version = f[1];
+	sys.valid_extensions = f[2];
+	sys.need_fullpath = SDL_atoi(f[3]) != 0;
+
+	return coreinfo_set(ci, path, &sys, NULL, f[4]);
+}
+
+/**
+ * List the files in a directory that may be libretro cores.
+ *
+ * \return	Array of paths, or NULL on error. Use SDL_GetError().
+ */
+static char **load_list_cores(const char *dir, unsigned *n)
+{
+	char **list = NULL;
+	unsigned cap = 0;
+	const char *sep = "/";
+#ifdef _WIN32
+	WIN32_FIND_DATAA fd;
+	HANDLE find;
+	char pattern[MAX_PATH];
+#else
+	DIR *d;
+	struct dirent *de;
+#endif
+
+	*n = 0;
+
+	if(dir[0] != '\0' && (dir[SDL_strlen(dir) - 1] == '/' ||
+		dir[SDL_strlen(dir) - 1] == '\\'))
+		sep = "";
+
+#ifdef _WIN32
+	SDL_snprintf(pattern, sizeof(pattern), "%s%s*", dir, sep);
+	find = FindFirstFileA(pattern, &fd);
+	if(find == INVALID_HANDLE_VALUE)
+	{
+		SDL_SetError("Unable to open directory %s", dir);
+		return NULL;
+	}
+
+	do
+	{
+		const char *name = fd.cFileName;
+
+		if(fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+			continue;
+#else
+	d = opendir(dir);
+	if(d == NULL)
+	{
+		SDL_SetError("Unable to open directory %s: %s", dir,
+			     strerror(errno));
+		return NULL;
+	}
+
+	while((de = readdir(d)) != NULL)
+	{
+		const char *name = de->d_name;
+#endif
+		size_t len;
+		char *path;
+
+		if(!util_has_ext(name, LOAD_CORE_EXTS))
+			continue;
+
+		if(*n == cap)
+		{
+			char **tmp;
+
+			cap = cap == 0 ? 64 : cap * 2;
+			tmp = SDL_realloc(list, cap * sizeof(*list));
+			if(tmp == NULL)
+				break;
+
+			list = tmp;
+		}
+
+		len = SDL_strlen(dir) + SDL_strlen(sep) + SDL_strlen(name) + 1;
+		path = SDL_malloc(len);
+		if(path == NULL)
+			break;
+
+		SDL_snprintf(path, len, "%s%s%s", dir, sep, name);
+		list[(*n)++] = path;
+#ifdef _WIN32
+	} while(FindNextFileA(find, &fd));
+
+	FindClose(find);
+#else
+	}
+
+	closedir(d);
+#endif
+
+	/* An empty directory is not an error. */
+	if(list == NULL)
+		list = SDL_malloc(sizeof(*list));
+
+	if(list == NULL)
+		SDL_OutOfMemory();
+
+	return list;
+}
+
+#if LOAD_SCAN_FORK
+/* A core being probed by a child process. */
+struct load_scan_slot_s
+{
+	pid_t pid;
+	int fd;
+	const char *path;
+};
+
+/**
+ * Probe a core in a child process. The child writes the information of the
+ * core to a pipe and exits, or is killed if it takes too long.
+ */
+static int load_scan_spawn(struct load_scan_slot_s *slot, const char *path)
+{
+	int fd[2];
+
+	if(pipe(fd) != 0)
+	{
+		return SDL_SetError("Unable to create pipe: %s",
+				    strerror(errno));
+	}
+
+	slot->pid = fork();
+	if(slot->pid == -1)
+	{
+		close(fd[0]);
+		close(fd[1]);
+		return SDL_SetError("Unable to create process: %s",
+				    strerror(errno));
+	}
+
+	if(slot->pid == 0)
+	{
+		char buf[LOAD_SCAN_INFO_MAX];
+		size_t len;
+
+		close(fd[0]);
+
+		/* The handlers inherited from init_sig() would report a crash
+		 * of a core that is only being probed as a crash of Haiyajan.
+		 * The child is killed by the alarm if the core hangs. */
+		signal(SIGSEGV, SIG_DFL);
+		signal(SIGABRT, SIG_DFL);
+		signal(SIGFPE, SIG_DFL);
+		signal(SIGILL, SIG_DFL);
+		signal(SIGALRM, SIG_DFL);
+		alarm(LOAD_SCAN_TIMEOUT_S);
+
+		len = load_probe_core(path, buf, sizeof(buf));
+		if(len == 0 || write(fd[1], buf, len) != (ssize_t)len)
+			_exit(EXIT_FAILURE);
+
+		_exit(EXIT_SUCCESS);
+	}
+
+	close(fd[1]);
+	slot->fd = fd[0];
+	slot->path = path;
+	return 0;
+}
+
+/**
+ * Read the information written by a child process that has exited.
+ */
+static size_t load_scan_read(int fd, char *buf, size_t len)
+{
+	size_t got = 0;
+
+	while(got < len)
+	{
+		ssize_t r = read(fd, buf + got, len - got);
+
+		if(r < 0 && errno == EINTR)
+			continue;
+
+		if(r <= 0)
+			break;
+
+		got += (size_t)r;
+	}
+
+	return got;
+}
+#endif
+
+int load_scan_cores(const char *dir, coreinfo_ctx *ci)
+{
+	char **cores;
+	unsigned n, i;
+	unsigned probed = 0, unchanged = 0, failed = 0;
+	Uint32 ticks = SDL_GetTicks();
+#if LOAD_SCAN_FORK
+	struct load_scan_slot_s slots[LOAD_SCAN_PROCS_MAX];
+	unsigned running = 0;
+	unsigned max_procs;
+#endif
+
+	cores = load_list_cores(dir, &n);
+	if(cores == NULL)
+		return -1;
+
+#if LOAD_SCAN_FORK
+	max_procs = (unsigned)SDL_max(SDL_GetCPUCount(), 1);
+	max_procs = SDL_min(max_procs, LOAD_SCAN_PROCS_MAX);
+#endif
+
+	i = 0;
+	for(;;)
+	{
+#if LOAD_SCAN_FORK
+		char buf[LOAD_SCAN_INFO_MAX];
+		size_t len;
+		int status;
+		pid_t pid;
+		unsigned s;
+
+		/* Keep every process busy whilst cores remain. */
+		while(running < max_procs && i < n)
+		{
+			const char *path = cores[i++];
+
+			/* Unchanged cores are not probed again. */
+			if(coreinfo_find(ci, path) != NULL)
+			{
+				unchanged++;
+				continue;
+			}
+
+			if(load_scan_spawn(&slots[running], path) != 0)
+			{
+				SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+					    "Unable to probe %s: %s", path,
+					    SDL_GetError());
+				failed++;
+				continue;
+			}
+
+			running++;
+		}
+
+		if(running == 0)
+			break;
+
+		pid = waitpid(-1, &status, 0);
+		if(pid == -1)
+		{
+			if(errno == EINTR)
+				continue;
+
+			break;
+		}
+
+		for(s = 0; s < running; s++)
+		{
+			if(slots[s].pid == pid)
+				break;
+		}
+
+		/* Not a child of this scan. */
+		if(s == running)
+			continue;
+
+		len = load_scan_read(slots[s].fd, buf, sizeof(buf));
+		close(slots[s].fd);
+
+		if(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS &&
+			load_add_probed(ci, slots[s].path, buf, len) == 0)
+		{
+			probed++;
+		}
+		else
+		{
+			SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+				    "%s is not a usable libretro core%s",
+				    slots[s].path, WIFSIGNALED(status) ?
+				    "; it crashed whilst being probed" : "");
+			failed++;
+		}
+
+		slots[s] = slots[--running];
+#else
+		char buf[LOAD_SCAN_INFO_MAX];
+		size_t len;
+
+		if(i == n)
+			break;
+
+		if(coreinfo_find(ci, cores[i]) != NULL)
+		{
+			unchanged++;
+			i++;
+			continue;
+		}
+
+		/* Cores are probed within this process, so a core that
+		 * crashes stops the scan. */
+		len = load_probe_core(cores[i], buf, sizeof(buf));
+		if(len != 0 && load_add_probed(ci, cores[i], buf, len) == 0)
+		{
+			probed++;
+		}
+		else
+		{
+			SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+				    "%s is not a usable libretro core",
+				    cores[i]);
+			failed++;
+		}
+
+		i++;
+#endif
+	}
+
+	for(i = 0; i < n; i++)
+		SDL_free(cores[i]);
+
+	SDL_free(cores);
+
+	SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+		    "Scanned %u cores in %s within %u ms: %u probed, "
+		    "%u unchanged, %u unusable", n, dir,
+		    SDL_GetTicks() - ticks, probed, unchanged, failed);
+
+	return 0;
 }
@@ -0,0 +1,257 @@
+/**
+ * Fast LZ77 compression in the LZ4 block format.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#include <SDL.h>
+#include <string.h>
+
+#include <lz.h>
+
+/* Shortest match that is encoded. */
+#define LZ_MIN_MATCH	4
+
+/* Farthest distance of a match. */
+#define LZ_MAX_OFFSET	65535
+
+/* The last match must start at least this many bytes before the end of the
+ * input, and the last bytes are always literals. Required by the format. */
+#define LZ_MFLIMIT	12
+#define LZ_LAST_LITERALS 5
+
+/* Size of the table of previous positions of each hashed sequence. 4096
+ * entries fit within the L1 cache. */
+#define LZ_HASH_LOG	12
+
+/* memcpy() is used instead of SDL_memcpy() where the length is constant or
+ * small, such that the compiler may inline it. */
+
+static Uint32 lz_read32(const Uint8 *p)
+{
+	Uint32 v;
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static Uint64 lz_read64(const Uint8 *p)
+{
+	Uint64 v;
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static unsigned lz_hash(Uint32 seq)
+{
+	return (unsigned)((seq * 2654435761U) >> (32 - LZ_HASH_LOG));
+}
+
+/**
+ * Write the remainder of a length that did not fit within the token.
+ */
+static Uint8 *lz_put_len(Uint8 *op, size_t len)
+{
+	while(len >= 255)
+	{
+		*op++ = 255;
+		len -= 255;
+	}
+
+	*op++ = (Uint8)len;
+	return op;
+}
+
+static Uint8 *lz_put_literals(Uint8 *op, Uint8 *token, const Uint8 *lit,
+			      size_t len)
+{
+	if(len >= 15)
+	{
+		*token = 15 << 4;
+		op = lz_put_len(op, len - 15);
+	}
+	else
+	{
+		*token = (Uint8)(len << 4);
+	}
+
+	memcpy(op, lit, len);
+	return op + len;
+}
+
+size_t lz_compress(const void *src_v, size_t len, void *dst_v)
+{
+	const Uint8 *src = src_v;
+	Uint8 *dst = dst_v;
+	Uint8 *op = dst;
+	Uint32 table[1 << LZ_HASH_LOG];
+	size_t ip = 0, anchor = 0;
+
+	SDL_assert(len <= LZ_MAX_INPUT);
+	SDL_zero(table);
+
+	while(len > LZ_MFLIMIT && ip < len - LZ_MFLIMIT)
+	{
+		const Uint32 seq = lz_read32(src + ip);
+		const unsigned h = lz_hash(seq);
+		size_t ref = table[h];
+		size_t mlen = LZ_MIN_MATCH;
+		Uint8 *token;
+
+		table[h] = (Uint32)ip;
+
+		if(ref >= ip || ip - ref > LZ_MAX_OFFSET ||
+			lz_read32(src + ref) != seq)
+		{
+			/* Skip through incompressible data faster the longer
+			 * that no match is found. */
+			ip += 1 + ((ip - anchor) >> 6);
+			continue;
+		}
+
+		/* Extend the match backwards over pending literals. */
+		while(ip > anchor && ref > 0 && src[ip - 1] == src[ref - 1])
+		{
+			ip--;
+			ref--;
+			mlen++;
+		}
+
+		/* Extend the match forwards, eight bytes at a time. */
+		while(ip + mlen + 8 <= len - LZ_LAST_LITERALS &&
+			lz_read64(src + ip + mlen) ==
+				lz_read64(src + ref + mlen))
+		{
+			mlen += 8;
+		}
+
+		while(ip + mlen < len - LZ_LAST_LITERALS &&
+			src[ip + mlen] == src[ref + mlen])
+		{
+			mlen++;
+		}
+
+		token = op++;
+		op = lz_put_literals(op, token, src + anchor, ip - anchor);
+
+		*op++ = (Uint8)(ip - ref);
+		*op++ = (Uint8)((ip - ref) >> 8);
+
+		if(mlen - LZ_MIN_MATCH >= 15)
+		{
+			*token |= 15;
+			op = lz_put_len(op, mlen - LZ_MIN_MATCH - 15);
+		}
+		else
+		{
+			*token |= (Uint8)(mlen - LZ_MIN_MATCH);
+		}
+
+		ip += mlen;
+		anchor = ip;
+
+		/* Record a position within the match, which improves the
+		 * ratio of repetitive data at little cost. */
+		if(ip - 2 < len - LZ_MFLIMIT)
+		{
+			table[lz_hash(lz_read32(src + ip - 2))] =
+				(Uint32)(ip - 2);
+		}
+	}
+
+	op = lz_put_literals(op + 1, op, src + anchor, len - anchor);
+	return (size_t)(op - dst);
+}
+
+/**
+ * Read the remainder of a length that did not fit within the token.
+ */
+static int lz_get_len(const Uint8 **ip, const Uint8 *iend, size_t *len)
+{
+	Uint8 b;
+
+	do
+	{
+		if(*ip >= iend)
+			return -1;
+
+		b = *(*ip)++;
+		*len += b;
+	} while(b == 255);
+
+	return 0;
+}
+
+int lz_decompress(const void *src, size_t src_len, void *dst,
+		  size_t *dst_len)
+{
+	const Uint8 *ip = src;
+	const Uint8 *const iend = ip + src_len;
+	Uint8 *op = dst;
+	Uint8 *const oend = op + *dst_len;
+
+	for(;;)
+	{
+		const Uint8 *match;
+		size_t lit, mlen, off;
+		Uint8 token;
+
+		if(ip >= iend)
+			return -1;
+
+		token = *ip++;
+		lit = token >> 4;
+		if(lit == 15 && lz_get_len(&ip, iend, &lit) != 0)
+			return -1;
+
+		if(lit > (size_t)(iend - ip) || lit > (size_t)(oend - op))
+			return -1;
+
+		memcpy(op, ip, lit);
+		op += lit;
+		ip += lit;
+
+		/* The last sequence has no match. */
+		if(ip == iend)
+			break;
+
+		if(iend - ip < 2)
+			return -1;
+
+		off = (size_t)ip[0] | ((size_t)ip[1] << 8);
+		ip += 2;
+		if(off == 0 || off > (size_t)(op - (Uint8 *)dst))
+			return -1;
+
+		mlen = token & 15;
+		if(mlen == 15 && lz_get_len(&ip, iend, &mlen) != 0)
+			return -1;
+
+		mlen += LZ_MIN_MATCH;
+		if(mlen > (size_t)(oend - op))
+			return -1;
+
+		match = op - off;
+		if(off >= mlen)
+		{
+			memcpy(op, match, mlen);
+			op += mlen;
+		}
+		else
+		{
+			/* Overlapping matches repeat the preceding bytes. */
+			while(mlen-- > 0)
+				*op++ = *match++;
+		}
+	}
+
+	*dst_len = (size_t)(op - (Uint8 *)dst);
+	return 0;
+}
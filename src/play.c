@@ -15,15 +15,66 @@
 #include <SDL.h>
 
 #include <libretro.h>
+#include <audio.h>
 #include <haiyajan.h>
 #include <play.h>
 #include <input.h>
 #include <rec.h>
+#include <util.h>
+#include <vfs.h>
 
 #define NUM_ELEMS(x) (sizeof(x) / sizeof(*x))
 
 static struct core_ctx_s *ctx_retro = NULL;
 
+/* Audio frames given one at a time by cb_retro_audio_sample() are staged and
+ * then written once per frame, or whenever the staging buffer is full. */
+#define PLAY_AUDIO_STAGE_FRAMES	2048
+static struct {
+	Sint16 buf[PLAY_AUDIO_STAGE_FRAMES * 2];
+	Uint32 frames;
+} audio_stage;
+
+static void play_write_audio(const Sint16 *data, Uint32 frames);
+
+static void play_flush_audio_stage(void)
+{
+	if(audio_stage.frames == 0)
+		return;
+
+	play_write_audio(audio_stage.buf, audio_stage.frames);
+	audio_stage.frames = 0;
+}
+
+/**
+ * Reports the occupancy of the audio buffer to the core, such that the core
+ * may skip frames when audio is about to underrun.
+ */
+static void play_audio_status(struct core_ctx_s *ctx)
+{
+	Uint32 queued, target, per_frame;
+	unsigned occupancy;
+	double fps = ctx->av_info.timing.fps;
+
+	if(ctx->sdl.audio == NULL)
+	{
+		ctx->env.audio_status_cb(false, 0, false);
+		return;
+	}
+
+	queued = audio_queued(ctx->sdl.audio);
+	target = audio_target(ctx->sdl.audio);
+	occupancy = queued >= target ? 100 : (unsigned)((queued * 100) / target);
+
+	/* An underrun is likely if fewer frames are queued than will be
+	 * played before the next frame is run. */
+	if(fps <= 0.0)
+		fps = 60.0;
+
+	per_frame = (Uint32)(audio_rate(ctx->sdl.audio) / fps);
+	ctx->env.audio_status_cb(true, occupancy, queued < per_frame);
+}
+
 void play_frame(struct core_ctx_s *ctx)
 {
 	if(ctx->env.status.bits.opengl_required != 0)
@@ -32,10 +83,28 @@ void play_frame(struct core_ctx_s *ctx)
 	if(ctx->env.ftcb != NULL)
 		ctx->env.ftcb(ctx->env.ftref);
 
+	if(ctx->env.audio_status_cb != NULL)
+		play_audio_status(ctx);
+
+	/* A core that does not call the video callback is treated as having
+	 * duplicated the last frame. */
+	ctx->env.status.bits.dupe_frame = 1;
+
 	ctx->env.status.bits.playing = 1;
 	ctx->fn.retro_run();
 	ctx->env.status.bits.playing = 0;
 
+	/* If the audio callback could not be called by the audio producer
+	 * thread, call it once per frame instead. Otherwise the staging buffer
+	 * is owned by the producer thread. */
+	if(ctx->env.status.bits.audio_thread == 0)
+	{
+		if(ctx->env.audio_cb.callback != NULL)
+			ctx->env.audio_cb.callback();
+
+		play_flush_audio_stage();
+	}
+
 	if(ctx->env.status.bits.opengl_required != 0)
 		gl_postrun(ctx->sdl.gl);
 }
@@ -155,16 +224,52 @@ bool cb_retro_environment(unsigned cmd, void *data)
 		break;
 	}
 
-#if 0
-
 	case RETRO_ENVIRONMENT_SET_AUDIO_CALLBACK:
 	{
-		struct retro_audio_callback *audio_cb = data;
+		const struct retro_audio_callback *audio_cb = data;
+
+		/* Must be set before retro_get_system_av_info(). */
+		if(ctx_retro->env.status.bits.av_init == 1)
+			return false;
+
+		if(audio_cb == NULL || audio_cb->callback == NULL)
+		{
+			ctx_retro->env.audio_cb.callback = NULL;
+			ctx_retro->env.audio_cb.set_state = NULL;
+			break;
+		}
+
 		ctx_retro->env.audio_cb = *audio_cb;
+		SDL_LogVerbose(SDL_LOG_CATEGORY_AUDIO,
+			"Core requested asynchronous audio callback");
+		break;
+	}
+
+	/* The experimental flag is masked out of cmd above. */
+	case RETRO_ENVIRONMENT_GET_INPUT_BITMASKS & 0xFF:
+		/* RETRO_DEVICE_ID_JOYPAD_MASK is supported by input_get(). */
+		break;
+
+	case RETRO_ENVIRONMENT_SET_AUDIO_BUFFER_STATUS_CALLBACK:
+	{
+		const struct retro_audio_buffer_status_callback *cb = data;
+
+		ctx_retro->env.audio_status_cb = cb != NULL ?
+			cb->callback : NULL;
+		break;
+	}
+
+	case RETRO_ENVIRONMENT_SET_MINIMUM_AUDIO_LATENCY:
+	{
+		const unsigned *latency_ms = data;
+
+		if(ctx_retro->sdl.audio == NULL || latency_ms == NULL)
+			return false;
+
+		audio_set_min_latency(ctx_retro->sdl.audio, *latency_ms);
 		break;
 	}
 
-#endif
 	case RETRO_ENVIRONMENT_SET_HW_RENDER:
 	{
 		struct retro_hw_render_callback *hw_cb = data;
@@ -352,6 +457,16 @@ bool cb_retro_environment(unsigned cmd, void *data)
 			geo->aspect_ratio);
 		break;
 	}
+	case (RETRO_ENVIRONMENT_GET_VFS_INTERFACE & 0xFF):
+	{
+		struct retro_vfs_interface_info *vfs = data;
+
+		if(vfs_get_interface(vfs) != 0)
+			return false;
+
+		break;
+	}
+
 	case (RETRO_ENVIRONMENT_GET_AUDIO_VIDEO_ENABLE & 0xFF):
 	{
 		/* An unsigned integer is a better choice than signed for bit
@@ -374,6 +489,30 @@ bool cb_retro_environment(unsigned cmd, void *data)
 		break;
 	}
 
+	case RETRO_ENVIRONMENT_SET_DISK_CONTROL_INTERFACE:
+	{
+		const struct retro_disk_control_callback *cb = data;
+
+		/* The extended interface begins with the same functions. */
+		SDL_zero(ctx_retro->env.disk_cb);
+		SDL_memcpy(&ctx_retro->env.disk_cb, cb, sizeof(*cb));
+		break;
+	}
+
+	case RETRO_ENVIRONMENT_GET_DISK_CONTROL_INTERFACE_VERSION:
+	{
+		unsigned *ver = data;
+		*ver = 1;
+		break;
+	}
+
+	case RETRO_ENVIRONMENT_SET_DISK_CONTROL_EXT_INTERFACE:
+	{
+		const struct retro_disk_control_ext_callback *cb = data;
+		ctx_retro->env.disk_cb = *cb;
+		break;
+	}
+
 	case RETRO_ENVIRONMENT_GET_PREFERRED_HW_RENDER:
 	{
 		unsigned *pref = data;
@@ -416,10 +555,42 @@ void cb_retro_video_refresh(const void *data, unsigned width, unsigned height,
 	}
 
 	ctx_retro->env.status.bits.valid_frame = 1;
+	ctx_retro->env.status.bits.dupe_frame = 0;
 
 	if(data == RETRO_HW_FRAME_BUFFER_VALID)
 		return;
 
+	/* Detect frames that have not changed, so that recordings do not read
+	 * back and encode them again. */
+	if(
+#if ENABLE_VIDEO_RECORDING == 1
+		ctx_retro->vid != NULL ||
+#endif
+		ctx_retro->pipe != NULL)
+	{
+		const size_t row_sz = (size_t)width *
+				      SDL_BYTESPERPIXEL(ctx_retro->env.pixel_fmt);
+		const Uint8 *row = data;
+		Uint64 hash = ((Uint64)width << 32) | height;
+
+		if(pitch == row_sz)
+		{
+			hash = util_hash(row, row_sz * height, hash);
+		}
+		else
+		{
+			for(unsigned y = 0; y < height; y++)
+			{
+				hash = util_hash(row, row_sz, hash);
+				row += pitch;
+			}
+		}
+
+		ctx_retro->env.status.bits.dupe_frame =
+			hash == ctx_retro->env.frame_hash;
+		ctx_retro->env.frame_hash = hash;
+	}
+
 	SDL_assert(width <= ctx_retro->av_info.geometry.max_width);
 	SDL_assert(height <= ctx_retro->av_info.geometry.max_height);
 
@@ -445,20 +616,22 @@ void cb_retro_video_refresh(const void *data, unsigned width, unsigned height,
 
 void cb_retro_audio_sample(int16_t left, int16_t right)
 {
-	(void)left;
-	(void)right;
-	return;
+	/* A core using the audio callback may still write audio from
+	 * retro_run() on the main thread, whilst the producer thread uses the
+	 * staging buffer. */
+	audio_lock_producer(ctx_retro->sdl.audio);
+	audio_stage.buf[audio_stage.frames * 2] = left;
+	audio_stage.buf[(audio_stage.frames * 2) + 1] = right;
+	audio_stage.frames++;
+
+	if(audio_stage.frames == PLAY_AUDIO_STAGE_FRAMES)
+		play_flush_audio_stage();
+
+	audio_unlock_producer(ctx_retro->sdl.audio);
 }
 
-size_t cb_retro_audio_sample_batch(const int16_t *data, size_t frames)
+static void play_write_audio(const Sint16 *data, Uint32 frames)
 {
-	if(ctx_retro->sdl.audio_dev == 0)
-		goto out;
-
-	/* If the audio driver is lagging too far behind, reset the queue. */
-	if(SDL_GetQueuedAudioSize(ctx_retro->sdl.audio_dev) >= 32768UL)
-		SDL_ClearQueuedAudio(ctx_retro->sdl.audio_dev);
-
 #if ENABLE_VIDEO_RECORDING == 1
 	if(ctx_retro->vid != NULL)
 	{
@@ -466,15 +639,48 @@ size_t cb_retro_audio_sample_batch(const int16_t *data, size_t frames)
 	}
 #endif
 
-	SDL_QueueAudio(ctx_retro->sdl.audio_dev, data, (Uint32)frames * sizeof(Uint16) * 2);
+	if(ctx_retro->pipe != NULL)
+		recpipe_audio(ctx_retro->pipe, data, frames);
 
-out:
+	if(ctx_retro->sdl.audio != NULL)
+		audio_write(ctx_retro->sdl.audio, data, frames);
+}
+
+size_t cb_retro_audio_sample_batch(const int16_t *data, size_t frames)
+{
+	/* Keep audio in order for cores that use both callbacks. */
+	audio_lock_producer(ctx_retro->sdl.audio);
+	play_flush_audio_stage();
+	play_write_audio(data, (Uint32)frames);
+	audio_unlock_producer(ctx_retro->sdl.audio);
 	return frames;
 }
 
 void cb_retro_input_poll(void)
 {
-	return;
+	SDL_Event ev[16];
+	int n;
+
+	/* Input that arrived whilst the core was running is read now, instead
+	 * of waiting for the next frame. Other events are left in the queue
+	 * to be handled after the frame. */
+	if(ctx_retro->env.status.bits.late_input == 0)
+		goto out;
+
+	SDL_PumpEvents();
+	while((n = SDL_PeepEvents(ev, (int)NUM_ELEMS(ev), SDL_GETEVENT,
+			INPUT_EVENT_MIN, INPUT_EVENT_MAX)) > 0)
+	{
+		int i;
+
+		for(i = 0; i < n; i++)
+			input_handle_event(&ctx_retro->inp, &ev[i]);
+	}
+
+out:
+	/* Controller state is captured once here, instead of on each call to
+	 * cb_retro_input_state(). */
+	input_poll(&ctx_retro->inp);
 }
 
 int16_t cb_retro_input_state(unsigned port, unsigned device, unsigned index,
@@ -532,10 +738,25 @@ static int play_reinit_texture(struct core_ctx_s *ctx,
 	return 0;
 }
 
-int play_init_av(struct core_ctx_s *ctx, SDL_Renderer *rend)
+static void play_audio_produce(void *priv)
+{
+	struct core_ctx_s *ctx = priv;
+
+	ctx->env.audio_cb.callback();
+	play_flush_audio_stage();
+}
+
+static void play_audio_state(void *priv, SDL_bool enabled)
 {
-	SDL_AudioSpec want = { 0 };
+	struct core_ctx_s *ctx = priv;
+
+	if(ctx->env.audio_cb.set_state != NULL)
+		ctx->env.audio_cb.set_state(enabled == SDL_TRUE);
+}
 
+int play_init_av(struct core_ctx_s *ctx, SDL_Renderer *rend,
+		 Uint32 latency_ms, resample_quality_e quality)
+{
 	SDL_assert(ctx->env.status.bits.core_init == 1);
 	SDL_assert(ctx->env.status.bits.shutdown == 0);
 	SDL_assert(ctx->env.status.bits.game_loaded == 1);
@@ -564,15 +785,9 @@ int play_init_av(struct core_ctx_s *ctx, SDL_Renderer *rend)
 	if(ctx->env.pixel_fmt == 0)
 		ctx->env.pixel_fmt = SDL_PIXELFORMAT_RGB888;
 
-	want.freq = (int)ctx->av_info.timing.sample_rate;
-	want.format = AUDIO_S16SYS;
-	want.channels = 2;
-	want.samples = 512;
-	want.callback = NULL;
-
-	ctx->sdl.audio_dev = SDL_OpenAudioDevice(NULL, 0, &want, NULL, 0);
-
-	if(ctx->sdl.audio_dev == 0)
+	ctx->sdl.audio = audio_init(ctx->av_info.timing.sample_rate,
+				    latency_ms, quality);
+	if(ctx->sdl.audio == NULL)
 	{
 		SDL_LogWarn(SDL_LOG_CATEGORY_AUDIO, "Failed to open audio: %s",
 			SDL_GetError());
@@ -582,7 +797,22 @@ int play_init_av(struct core_ctx_s *ctx, SDL_Renderer *rend)
 		SDL_LogInfo(SDL_LOG_CATEGORY_AUDIO,
 			"Audio driver %s initialised",
 			SDL_GetCurrentAudioDriver());
-		SDL_PauseAudioDevice(ctx->sdl.audio_dev, 0);
+	}
+
+	if(ctx->sdl.audio != NULL && ctx->env.audio_cb.callback != NULL)
+	{
+		if(audio_start_producer(ctx->sdl.audio, play_audio_produce,
+				play_audio_state, ctx) == 0)
+		{
+			ctx->env.status.bits.audio_thread = 1;
+		}
+		else
+		{
+			SDL_LogWarn(SDL_LOG_CATEGORY_AUDIO,
+				"Unable to start audio producer thread; "
+				"the audio callback will be called once "
+				"per frame: %s", SDL_GetError());
+		}
 	}
 
 	ctx->fn.retro_set_controller_port_device(0, RETRO_DEVICE_JOYPAD);
@@ -659,7 +889,11 @@ void play_deinit_cb(struct core_ctx_s *ctx)
 		ctx->sdl.core_tex = NULL;
 	}
 
-	SDL_CloseAudioDevice(ctx->sdl.audio_dev);
+	/* Stops the producer thread before the staging buffer is reset. */
+	audio_exit(ctx->sdl.audio);
+	ctx->sdl.audio = NULL;
+	ctx->env.status.bits.audio_thread = 0;
+	audio_stage.frames = 0;
 	ctx_retro = NULL;
 }
 
@@ -13,6 +13,8 @@
  */
 
 #include <SDL.h>
+#include <iow.h>
+#include <job.h>
 #include <rec.h>
 #include <util.h>
 
@@ -34,14 +36,27 @@ enum vid_thread_cmd {
 struct venc_stor_s {
 	enum vid_thread_cmd cmd;
 
-	union {
+	struct {
 		SDL_Surface *pixels;
+
+		/* Presentation time in frames since the start of the
+		 * recording. */
+		Sint64 pts;
 	} dat;
 };
 
+/* Encoded output is batched into large buffers, and written to disk by a
+ * background thread so that a slow disk does not stall the encoder. */
+#define REC_VIDEO_BUF_SZ	(1024 * 1024)
+#define REC_VIDEO_BUF_NUM	4
+#define REC_AUDIO_BUF_SZ	(256 * 1024)
+#define REC_AUDIO_BUF_NUM	2
+#define REC_TC_BUF_SZ		(64 * 1024)
+#define REC_TC_BUF_NUM		2
+
 struct rec_s {
 	/* Audio */
-	SDL_RWops *fa;
+	iow_ctx *fa;
 	WavpackContext *wpc;
 	void *first_block;
 	Sint32 first_block_sz;
@@ -49,10 +64,21 @@ struct rec_s {
 	Uint64 samples_sz;
 
 	/* Video */
-	SDL_RWops *fv;
+	iow_ctx *fv;
 	x264_t *h;
 	x264_param_t param;
 
+	/* Duplicate frames are not encoded, so the video has a variable frame
+	 * rate. The timestamp of each encoded frame is written to a timecode
+	 * file, as the raw H264 stream does not store timestamps. */
+	iow_ctx *ftc;
+	double ms_per_frame;
+
+	/* Presentation time of the next frame, and the number of duplicate
+	 * frames that were skipped. Only accessed by the caller thread. */
+	Sint64 pts;
+	Uint32 dupes;
+
 	/* Preset value pointing to x264_preset_names[] */
 	Uint8 preset;
 	SDL_Thread *venc_th;
@@ -99,7 +125,7 @@ static int wav_pack_write_file(void *priv, void *data, int32_t bcount)
 		ctx->first_block_sz = bcount;
 	}
 
-	return SDL_RWwrite(ctx->fa, data, bcount, 1) > 0 ? SDL_TRUE : SDL_FALSE;
+	return iow_write(ctx->fa, data, bcount) == 0 ? SDL_TRUE : SDL_FALSE;
 }
 
 static int vid_thread_cmd(void *data)
@@ -118,8 +144,8 @@ static int vid_thread_cmd(void *data)
 
 		for(int i = 0; i < nnal; i++)
 		{
-			if(SDL_RWwrite(ctx->fv, nal[i].p_payload,
-				       nal[i].i_payload, 1) == 0)
+			if(iow_write(ctx->fv, nal[i].p_payload,
+				     nal[i].i_payload) != 0)
 				goto end;
 		}
 	}
@@ -157,23 +183,34 @@ static int vid_thread_cmd(void *data)
 			pic.img.plane[0] = ctx->venc_stor.dat.pixels->pixels;
 
 			pic.i_type = X264_TYPE_AUTO;
+			pic.i_pts = ctx->venc_stor.dat.pts;
 
 			i_frame_size = x264_encoder_encode(ctx->h, &nal, &i_nal,
 							   &pic, &pic_out);
+
+			/* The picture is copied by x264, so it is no longer
+			 * required even if the frame is delayed. */
+			SDL_FreeSurface(ctx->venc_stor.dat.pixels);
+
 			if(i_frame_size < 0)
 				break;
 
-			if(i_frame_size == 0)
-				break;
+			/* Timecodes are in presentation order, which is the
+			 * order in which frames are given to the encoder. */
+			{
+				char tc[32];
+				int tc_len = SDL_snprintf(tc, sizeof(tc),
+						"%.3f\n", (double)pic.i_pts *
+						ctx->ms_per_frame);
+				iow_write(ctx->ftc, tc, tc_len);
+			}
 
 			for(int i = 0; i < i_nal; i++)
 			{
-				SDL_RWwrite(ctx->fv, nal[i].p_payload,
-					    nal[i].i_payload, 1);
+				iow_write(ctx->fv, nal[i].p_payload,
+					  nal[i].i_payload);
 			}
 
-			SDL_FreeSurface(ctx->venc_stor.dat.pixels);
-
 			break;
 		}
 
@@ -196,8 +233,8 @@ static int vid_thread_cmd(void *data)
 
 				for(int i = 0; i < i_nal; i++)
 				{
-					SDL_RWwrite(ctx->fv, nal[i].p_payload,
-						    nal[i].i_payload, 1);
+					iow_write(ctx->fv, nal[i].p_payload,
+						  nal[i].i_payload);
 				}
 			}
 
@@ -219,14 +256,22 @@ end:
 	if(ctx->first_block != NULL)
 	{
 		WavpackUpdateNumSamples(ctx->wpc, ctx->first_block);
-		SDL_RWseek(ctx->fa, 0, RW_SEEK_SET);
-		SDL_RWwrite(ctx->fa, ctx->first_block, ctx->first_block_sz, 1);
+		iow_pwrite(ctx->fa, 0, ctx->first_block, ctx->first_block_sz);
+		SDL_free(ctx->first_block);
 	}
 
 	WavpackCloseFile(ctx->wpc);
 
-	SDL_RWclose(ctx->fv);
-	SDL_RWclose(ctx->fa);
+	if((iow_close(ctx->fv) | iow_close(ctx->fa) |
+	    iow_close(ctx->ftc)) != 0)
+	{
+		SDL_LogWarn(SDL_LOG_CATEGORY_VIDEO,
+			    "Recording may be incomplete: %s", SDL_GetError());
+	}
+
+	SDL_LogVerbose(SDL_LOG_CATEGORY_VIDEO,
+		       "Skipped encoding %u duplicate frames of %" SDL_PRIs64,
+		       ctx->dupes, ctx->pts);
 
 	SDL_free(ctx);
 
@@ -234,9 +279,13 @@ end:
 }
 
 rec_ctx *rec_init(const char *fileout, int width, int height, double fps,
-	      Sint32 sample_rate)
+	      Sint32 sample_rate, Uint8 direct_io)
 {
 	rec_ctx *ctx = SDL_calloc(1, sizeof(rec_ctx));
+	/* Recordings are not read back, so they should not fill the page
+	 * cache. */
+	const unsigned iow_flags = IOW_FLAG_NOCACHE |
+		(direct_io ? IOW_FLAG_DIRECT : IOW_FLAG_NONE);
 
 	if(ctx == NULL)
 		goto out;
@@ -255,16 +304,38 @@ rec_ctx *rec_init(const char *fileout, int width, int height, double fps,
 		*(++dot_loc) = 'w';
 		*(++dot_loc) = 'v';
 		*(++dot_loc) = '\0';
-		ctx->fa = SDL_RWFromFile(fileout_wav, "wb");
+		ctx->fa = iow_open(fileout_wav, REC_AUDIO_BUF_SZ,
+				   REC_AUDIO_BUF_NUM, iow_flags);
 		SDL_free(fileout_wav);
 	}
 	if(ctx->fa == NULL)
 		goto err;
 
-	ctx->fv = SDL_RWFromFile(fileout, "wb");
+	ctx->fv = iow_open(fileout, REC_VIDEO_BUF_SZ, REC_VIDEO_BUF_NUM,
+			   iow_flags);
 	if(ctx->fv == NULL)
 		goto err;
 
+	{
+		const char tc_hdr[] = "# timecode format v2\n";
+		size_t tc_len = SDL_strlen(fileout) + sizeof("-timecodes.txt");
+		char *fileout_tc = SDL_malloc(tc_len);
+
+		if(fileout_tc == NULL)
+			goto err;
+
+		SDL_snprintf(fileout_tc, tc_len, "%.*s-timecodes.txt",
+			     (int)(SDL_strrchr(fileout, '.') - fileout),
+			     fileout);
+		ctx->ftc = iow_open(fileout_tc, REC_TC_BUF_SZ, REC_TC_BUF_NUM,
+				    IOW_FLAG_NONE);
+		SDL_free(fileout_tc);
+
+		if(ctx->ftc == NULL ||
+		   iow_write(ctx->ftc, tc_hdr, sizeof(tc_hdr) - 1) != 0)
+			goto err;
+	}
+
 	ctx->wpc = WavpackOpenFileOutput(wav_pack_write_file, ctx, NULL);
 	WavpackConfig config = {
 		.bitrate = 192.0F,
@@ -298,7 +369,7 @@ rec_ctx *rec_init(const char *fileout, int width, int height, double fps,
 	ctx->param.pf_log = x264_log;
 	ctx->param.i_csp = X264_CSP_RGB;
 	ctx->param.i_bitdepth = 8;
-	ctx->param.b_vfr_input = 0;
+	ctx->param.b_vfr_input = 1;
 	ctx->param.rc.i_rc_method = X264_RC_CRF;
 	ctx->param.rc.f_rf_constant = 18;
 	ctx->param.b_opencl = 1;
@@ -316,6 +387,11 @@ rec_ctx *rec_init(const char *fileout, int width, int height, double fps,
 	SDL_assert(fps < 256.0);
 	ctx->param.i_fps_num = (uint32_t)(fps * 16777216.0);
 	ctx->param.i_fps_den = 16777216;
+
+	/* Timestamps are counted in frames. */
+	ctx->param.i_timebase_num = ctx->param.i_fps_den;
+	ctx->param.i_timebase_den = ctx->param.i_fps_num;
+	ctx->ms_per_frame = 1000.0 / fps;
 	SDL_LogVerbose(SDL_LOG_CATEGORY_VIDEO, "Requested video FPS: %.1f",
 		       ((float)ctx->param.i_fps_num / ctx->param.i_fps_den));
 
@@ -331,6 +407,9 @@ out:
 	return ctx;
 
 err:
+	iow_close(ctx->ftc);
+	iow_close(ctx->fv);
+	iow_close(ctx->fa);
 	SDL_free(ctx);
 	ctx = NULL;
 	goto out;
@@ -344,6 +423,7 @@ void rec_enc_video(rec_ctx *ctx, SDL_Surface *surf)
 
 	SDL_AtomicLock(&ctx->venc_slk);
 	ctx->venc_stor.dat.pixels = surf;
+	ctx->venc_stor.dat.pts = ctx->pts++;
 	ctx->venc_stor.cmd = VID_CMD_ENCODE_FRAME;
 
 	SDL_LockMutex(ctx->venc_mtx);
@@ -351,6 +431,16 @@ void rec_enc_video(rec_ctx *ctx, SDL_Surface *surf)
 	SDL_UnlockMutex(ctx->venc_mtx);
 }
 
+void rec_dupe_frame(rec_ctx *ctx)
+{
+	/* The recording starts at the first encoded frame. */
+	if(ctx == NULL || ctx->pts == 0)
+		return;
+
+	ctx->pts++;
+	ctx->dupes++;
+}
+
 static void apply_preset(rec_ctx *ctx)
 {
 	float crf = ctx->param.rc.f_rf_constant;
@@ -449,7 +539,7 @@ Sint64 rec_video_size(rec_ctx *ctx)
 	if(ctx == NULL || ctx->venc_stor.cmd == VID_CMD_ENCODE_FINISH)
 		return -1;
 
-	return SDL_RWtell(ctx->fv);
+	return iow_tell(ctx->fv);
 }
 
 Sint64 rec_audio_size(rec_ctx *ctx)
@@ -457,7 +547,7 @@ Sint64 rec_audio_size(rec_ctx *ctx)
 	if(ctx == NULL || ctx->venc_stor.cmd == VID_CMD_ENCODE_FINISH)
 		return -1;
 
-	return SDL_RWtell(ctx->fa);
+	return iow_tell(ctx->fa);
 }
 
 void rec_end(rec_ctx **ctxp)
@@ -487,7 +577,7 @@ struct img_stor_s {
 /**
  * Saves the SDL Surface to a WEBP or BMP image on the filesystem.
  */
-static int rec_single_img_thread(void *param)
+static void rec_single_img_job(void *param)
 {
 	struct img_stor_s *img = param;
 	SDL_Surface *surf;
@@ -500,11 +590,6 @@ static int rec_single_img_thread(void *param)
 	const char fmt[] = "bmp";
 #endif
 
-	SDL_SetThreadPriority(SDL_THREAD_PRIORITY_LOW);
-
-	if(param == NULL)
-		return -1;
-
 	surf = img->surf;
 	gen_filename(filename, img->core_name, fmt);
 
@@ -531,17 +616,20 @@ static int rec_single_img_thread(void *param)
 out:
 	SDL_FreeSurface(surf);
 	SDL_free(param);
-	return 0;
 }
 
 void rec_single_img(SDL_Surface *surf, const char *core_name)
 {
-	SDL_Thread *thread;
 	struct img_stor_s *img;
 
 	img = SDL_malloc(sizeof(struct img_stor_s));
+	if(img == NULL)
+	{
+		SDL_FreeSurface(surf);
+		return;
+	}
+
 	img->surf = surf;
 	SDL_strlcpy(img->core_name, core_name, SDL_arraysize(img->core_name));
-	thread = SDL_CreateThread(rec_single_img_thread, "Screenshot", img);
-	SDL_DetachThread(thread);
+	job_submit(JOB_PRIO_LOW, rec_single_img_job, img);
 }
@@ -0,0 +1,377 @@
+/**
+ * Stream raw video and audio to an external encoder.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#include <SDL.h>
+#include <iow.h>
+#include <recpipe.h>
+#include <util.h>
+
+/* Number of frames that may be waiting to be read by the encoder before
+ * frames are dropped. */
+#define RECPIPE_VIDEO_BUF_NUM	8
+#define RECPIPE_AUDIO_BUF_SZ	(16 * 1024)
+#define RECPIPE_AUDIO_BUF_NUM	8
+
+static const char y4m_frame_hdr[] = "FRAME\n";
+
+struct recpipe_s {
+	iow_ctx *fv;
+	iow_ctx *fa;
+
+	int w;
+	int h;
+	size_t frame_sz;
+
+	/* Frame read back from the renderer. Reused for every frame. */
+	Uint8 *rgb;
+
+	/* Number of dropped frames that have not been replaced by a
+	 * repeated frame yet. */
+	Uint32 repeat;
+
+	/* Number of dropped audio frames that have not been replaced by
+	 * silence yet. */
+	Uint64 silence;
+
+	/* Set once a frame has been read back into rgb. */
+	Uint8 have_frame;
+
+	struct recpipe_stats_s st;
+};
+
+/**
+ * Convert RGB24 pixels to planar Y'CbCr 4:4:4 with BT.601 limited range
+ * coefficients.
+ */
+static void rgb24_to_i444(const Uint8 *rgb, int w, int h, Uint8 *y,
+			  Uint8 *cb, Uint8 *cr)
+{
+	const size_t px = (size_t)w * (size_t)h;
+
+	for(size_t i = 0; i < px; i++)
+	{
+		const int r = rgb[0];
+		const int g = rgb[1];
+		const int b = rgb[2];
+
+		/* The chroma offset is added before the shift so that the
+		 * shifted value is never negative. */
+		y[i] = (Uint8)(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+		cb[i] = (Uint8)((-38 * r - 74 * g + 112 * b + 128 + (128 << 8))
+				>> 8);
+		cr[i] = (Uint8)((112 * r - 94 * g - 18 * b + 128 + (128 << 8))
+				>> 8);
+		rgb += 3;
+	}
+}
+
+static void recpipe_write_frame(recpipe_ctx *ctx, Uint8 *frame)
+{
+	const size_t plane = (size_t)ctx->w * (size_t)ctx->h;
+	Uint8 *y = frame + (sizeof(y4m_frame_hdr) - 1);
+
+	SDL_memcpy(frame, y4m_frame_hdr, sizeof(y4m_frame_hdr) - 1);
+	rgb24_to_i444(ctx->rgb, ctx->w, ctx->h, y, y + plane, y + plane * 2);
+}
+
+/**
+ * Stop writing to an output after an error, such as the reader closing the
+ * pipe.
+ */
+static void recpipe_fail(iow_ctx **out, const char *name)
+{
+	SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+		    "Stopped writing raw %s: %s", name, SDL_GetError());
+	iow_close(*out);
+	*out = NULL;
+}
+
+recpipe_ctx *recpipe_init(const char *vid_path, const char *aud_path,
+			  int width, int height, double fps,
+			  double sample_rate)
+{
+	recpipe_ctx *ctx;
+
+	SDL_assert(vid_path != NULL || aud_path != NULL);
+
+	ctx = SDL_calloc(1, sizeof(recpipe_ctx));
+	if(ctx == NULL)
+	{
+		SDL_OutOfMemory();
+		return NULL;
+	}
+
+	ctx->w = width;
+	ctx->h = height;
+
+	if(vid_path != NULL)
+	{
+		char hdr[96];
+		int hdr_len;
+
+		if(width <= 0 || height <= 0)
+		{
+			SDL_SetError("Invalid video resolution %dx%d", width,
+				     height);
+			goto err;
+		}
+
+		if(fps < 1.0)
+			fps = 1.0;
+
+		ctx->frame_sz = (sizeof(y4m_frame_hdr) - 1) +
+				((size_t)width * (size_t)height * 3);
+		ctx->rgb = SDL_malloc((size_t)width * (size_t)height * 3);
+		if(ctx->rgb == NULL)
+		{
+			SDL_OutOfMemory();
+			goto err;
+		}
+
+		/* Each buffer holds a single frame. */
+		ctx->fv = iow_open(vid_path, ctx->frame_sz,
+				   RECPIPE_VIDEO_BUF_NUM, IOW_FLAG_NONBLOCK);
+		if(ctx->fv == NULL)
+			goto err;
+
+		hdr_len = SDL_snprintf(hdr, sizeof(hdr),
+				       "YUV4MPEG2 W%d H%d F%u:1000 Ip A1:1 "
+				       "C444 XCOLORRANGE=LIMITED\n",
+				       width, height,
+				       (unsigned)((fps * 1000.0) + 0.5));
+		if(iow_write(ctx->fv, hdr, hdr_len) != 0)
+			goto err;
+
+		SDL_LogInfo(SDL_LOG_CATEGORY_VIDEO,
+			    "Writing YUV4MPEG2 video to %s", vid_path);
+	}
+
+	if(aud_path != NULL)
+	{
+		ctx->fa = iow_open(aud_path, RECPIPE_AUDIO_BUF_SZ,
+				   RECPIPE_AUDIO_BUF_NUM, IOW_FLAG_NONBLOCK);
+		if(ctx->fa == NULL)
+			goto err;
+
+		SDL_LogInfo(SDL_LOG_CATEGORY_AUDIO,
+			    "Writing raw audio to %s as signed 16-bit little "
+			    "endian stereo PCM at %.0f Hz", aud_path,
+			    SDL_ceil(sample_rate));
+	}
+
+	return ctx;
+
+err:
+	iow_close(ctx->fv);
+	iow_close(ctx->fa);
+	SDL_free(ctx->rgb);
+	SDL_free(ctx);
+	return NULL;
+}
+
+/**
+ * Write the frame held in the read back buffer, repeating it to replace
+ * previously dropped frames whilst there is space, so that the video remains
+ * in sync with the audio.
+ */
+static void recpipe_write_frames(recpipe_ctx *ctx, Uint8 *frame)
+{
+	while(1)
+	{
+		recpipe_write_frame(ctx, frame);
+		if(iow_commit(ctx->fv, ctx->frame_sz) != 0)
+		{
+			recpipe_fail(&ctx->fv, "video");
+			return;
+		}
+
+		ctx->st.frames++;
+		if(ctx->repeat == 0)
+			break;
+
+		frame = iow_reserve(ctx->fv, ctx->frame_sz);
+		if(frame == NULL)
+			break;
+
+		ctx->repeat--;
+	}
+}
+
+void recpipe_video(recpipe_ctx *ctx, SDL_Renderer *rend, SDL_Texture *tex,
+		   const SDL_Rect *src, SDL_RendererFlip flip)
+{
+	Uint8 *frame;
+
+	if(ctx == NULL || ctx->fv == NULL)
+		return;
+
+	/* YUV4MPEG2 does not support changing the resolution. */
+	if(src->w != ctx->w || src->h != ctx->h)
+	{
+		ctx->st.frames_dropped++;
+		return;
+	}
+
+	/* Obtain space for the frame before reading it back, so that no
+	 * time is spent on a frame that will be dropped. */
+	frame = iow_reserve(ctx->fv, ctx->frame_sz);
+	if(frame == NULL)
+	{
+		ctx->st.frames_dropped++;
+		ctx->repeat++;
+		return;
+	}
+
+	if(util_tex_read(rend, tex, src, flip, SDL_PIXELFORMAT_RGB24, ctx->rgb,
+			 ctx->w * 3) != 0)
+	{
+		ctx->st.frames_dropped++;
+		ctx->repeat++;
+		return;
+	}
+
+	ctx->have_frame = 1;
+	recpipe_write_frames(ctx, frame);
+}
+
+void recpipe_dupe_frame(recpipe_ctx *ctx)
+{
+	Uint8 *frame;
+
+	/* The recording starts at the first frame read back. */
+	if(ctx == NULL || ctx->fv == NULL || ctx->have_frame == 0)
+		return;
+
+	frame = iow_reserve(ctx->fv, ctx->frame_sz);
+	if(frame == NULL)
+	{
+		ctx->st.frames_dropped++;
+		ctx->repeat++;
+		return;
+	}
+
+	ctx->st.frames_duped++;
+	recpipe_write_frames(ctx, frame);
+}
+
+/**
+ * Write silence in place of previously dropped audio whilst there is space,
+ * so that the audio remains in sync with the video.
+ *
+ * eturn	0 if all dropped audio has been replaced, else non-zero.
+ */
+static int recpipe_write_silence(recpipe_ctx *ctx, Uint32 max_frames)
+{
+	while(ctx->silence > 0)
+	{
+		Uint32 chunk = ctx->silence < max_frames ?
+			       (Uint32)ctx->silence : max_frames;
+		size_t len = chunk * 2 * sizeof(Sint16);
+		void *out = iow_reserve(ctx->fa, len);
+
+		if(out == NULL)
+			return 1;
+
+		SDL_memset(out, 0, len);
+		if(iow_commit(ctx->fa, len) != 0)
+		{
+			recpipe_fail(&ctx->fa, "audio");
+			return 1;
+		}
+
+		ctx->silence -= chunk;
+	}
+
+	return 0;
+}
+
+void recpipe_audio(recpipe_ctx *ctx, const Sint16 *data, Uint32 frames)
+{
+	/* Size of a buffer in stereo frames. */
+	const Uint32 max_frames = RECPIPE_AUDIO_BUF_SZ / (2 * sizeof(Sint16));
+
+	if(ctx == NULL || ctx->fa == NULL)
+		return;
+
+	while(frames > 0)
+	{
+		Uint32 chunk = frames < max_frames ? frames : max_frames;
+		size_t len = chunk * 2 * sizeof(Sint16);
+		Sint16 *out = NULL;
+
+		/* Dropped audio is replaced first, such that the samples that
+		 * follow are written at the correct time. */
+		if(recpipe_write_silence(ctx, max_frames) == 0)
+			out = iow_reserve(ctx->fa, len);
+
+		if(ctx->fa == NULL)
+			return;
+
+		if(out == NULL)
+		{
+			ctx->st.samples_dropped += chunk;
+			ctx->silence += chunk;
+		}
+		else
+		{
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+			for(Uint32 i = 0; i < chunk * 2; i++)
+				out[i] = SDL_SwapLE16(data[i]);
+#else
+			SDL_memcpy(out, data, len);
+#endif
+			if(iow_commit(ctx->fa, len) != 0)
+			{
+				recpipe_fail(&ctx->fa, "audio");
+				return;
+			}
+
+			ctx->st.samples += chunk;
+		}
+
+		data += chunk * 2;
+		frames -= chunk;
+	}
+}
+
+void recpipe_get_stats(recpipe_ctx *ctx, struct recpipe_stats_s *stats)
+{
+	*stats = ctx->st;
+}
+
+void recpipe_end(recpipe_ctx **ctxp)
+{
+	recpipe_ctx *ctx = *ctxp;
+
+	if(ctx == NULL)
+		return;
+
+	if((iow_close(ctx->fv) | iow_close(ctx->fa)) != 0)
+	{
+		SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+			    "Raw recording may be incomplete: %s",
+			    SDL_GetError());
+	}
+
+	SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+		    "Raw recording finished: %u frames written, %u dropped, "
+		    "%u unchanged; %" SDL_PRIu64 " audio frames written, %"
+		    SDL_PRIu64 " dropped", ctx->st.frames,
+		    ctx->st.frames_dropped, ctx->st.frames_duped,
+		    ctx->st.samples, ctx->st.samples_dropped);
+
+	SDL_free(ctx->rgb);
+	SDL_free(ctx);
+	*ctxp = NULL;
+}
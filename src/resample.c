@@ -0,0 +1,435 @@
+/**
+ * Audio sample rate converter.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#include <SDL.h>
+#include <resample.h>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || \
+	defined(_M_IX86)
+#define RESAMPLE_X86	1
+#include <immintrin.h>
+#else
+#define RESAMPLE_X86	0
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define RESAMPLE_NEON	1
+#include <arm_neon.h>
+#else
+#define RESAMPLE_NEON	0
+#endif
+
+/* Allow the use of instructions that the compiler was not told to use
+ * globally. These functions are only called if the CPU supports them. */
+#if defined(__GNUC__)
+#define RESAMPLE_TARGET(isa)	__attribute__((target(isa)))
+#else
+#define RESAMPLE_TARGET(isa)
+#endif
+
+/* Number of filter phases between two input frames. Coefficients for a
+ * position between two phases are linearly interpolated. */
+#define RESAMPLE_PHASES		256
+
+/* Number of input frames converted per pass. */
+#define RESAMPLE_CHUNK		1024
+
+/* Filter length must be a multiple of 8 for the AVX2 filter. */
+static const struct {
+	unsigned taps;
+	double beta;
+	double cutoff;
+} quality_params[RESAMPLE_QUALITY_MAX] = {
+	{ 16, 5.0, 0.85 },
+	{ 32, 7.0, 0.91 },
+	{ 64, 9.0, 0.95 }
+};
+
+/**
+ * Calculates the dot product of the left and right input channels with two
+ * adjacent filter phases. The results are stored in the order left with c0,
+ * right with c0, left with c1, right with c1.
+ */
+typedef void (*resample_dot_fn)(const float *l, const float *r,
+				const float *c0, const float *c1,
+				unsigned taps, float acc[4]);
+
+struct resample_s {
+	resample_dot_fn dot;
+	const char *isa;
+
+	unsigned taps;
+	double step;
+
+	/* Position of the first filter tap within the input buffer. */
+	double pos;
+
+	/* Deinterleaved input frames. */
+	float *buf_l;
+	float *buf_r;
+	Uint32 filled;
+	Uint32 cap;
+
+	/* RESAMPLE_PHASES + 1 rows of taps coefficients. */
+	float *coeff;
+};
+
+static void resample_dot_c(const float *l, const float *r, const float *c0,
+			   const float *c1, unsigned taps, float acc[4])
+{
+	float l0 = 0.0f, r0 = 0.0f, l1 = 0.0f, r1 = 0.0f;
+	unsigned k;
+
+	for(k = 0; k < taps; k++)
+	{
+		l0 += l[k] * c0[k];
+		r0 += r[k] * c0[k];
+		l1 += l[k] * c1[k];
+		r1 += r[k] * c1[k];
+	}
+
+	acc[0] = l0;
+	acc[1] = r0;
+	acc[2] = l1;
+	acc[3] = r1;
+}
+
+#if RESAMPLE_X86
+RESAMPLE_TARGET("sse2")
+static void resample_dot_sse2(const float *l, const float *r, const float *c0,
+			      const float *c1, unsigned taps, float acc[4])
+{
+	__m128 l0 = _mm_setzero_ps();
+	__m128 r0 = _mm_setzero_ps();
+	__m128 l1 = _mm_setzero_ps();
+	__m128 r1 = _mm_setzero_ps();
+	unsigned k;
+
+	for(k = 0; k < taps; k += 4)
+	{
+		__m128 xl = _mm_loadu_ps(l + k);
+		__m128 xr = _mm_loadu_ps(r + k);
+		__m128 a = _mm_loadu_ps(c0 + k);
+		__m128 b = _mm_loadu_ps(c1 + k);
+
+		l0 = _mm_add_ps(l0, _mm_mul_ps(xl, a));
+		r0 = _mm_add_ps(r0, _mm_mul_ps(xr, a));
+		l1 = _mm_add_ps(l1, _mm_mul_ps(xl, b));
+		r1 = _mm_add_ps(r1, _mm_mul_ps(xr, b));
+	}
+
+	/* Sum each accumulator into a lane of the result. */
+	_MM_TRANSPOSE4_PS(l0, r0, l1, r1);
+	_mm_storeu_ps(acc, _mm_add_ps(_mm_add_ps(l0, r0), _mm_add_ps(l1, r1)));
+}
+
+RESAMPLE_TARGET("avx2")
+static void resample_dot_avx2(const float *l, const float *r, const float *c0,
+			      const float *c1, unsigned taps, float acc[4])
+{
+	__m256 l0 = _mm256_setzero_ps();
+	__m256 r0 = _mm256_setzero_ps();
+	__m256 l1 = _mm256_setzero_ps();
+	__m256 r1 = _mm256_setzero_ps();
+	__m128 sl0, sr0, sl1, sr1;
+	unsigned k;
+
+	for(k = 0; k < taps; k += 8)
+	{
+		__m256 xl = _mm256_loadu_ps(l + k);
+		__m256 xr = _mm256_loadu_ps(r + k);
+		__m256 a = _mm256_loadu_ps(c0 + k);
+		__m256 b = _mm256_loadu_ps(c1 + k);
+
+		l0 = _mm256_add_ps(l0, _mm256_mul_ps(xl, a));
+		r0 = _mm256_add_ps(r0, _mm256_mul_ps(xr, a));
+		l1 = _mm256_add_ps(l1, _mm256_mul_ps(xl, b));
+		r1 = _mm256_add_ps(r1, _mm256_mul_ps(xr, b));
+	}
+
+	sl0 = _mm_add_ps(_mm256_castps256_ps128(l0),
+			 _mm256_extractf128_ps(l0, 1));
+	sr0 = _mm_add_ps(_mm256_castps256_ps128(r0),
+			 _mm256_extractf128_ps(r0, 1));
+	sl1 = _mm_add_ps(_mm256_castps256_ps128(l1),
+			 _mm256_extractf128_ps(l1, 1));
+	sr1 = _mm_add_ps(_mm256_castps256_ps128(r1),
+			 _mm256_extractf128_ps(r1, 1));
+
+	sl0 = _mm_hadd_ps(sl0, sr0);
+	sl1 = _mm_hadd_ps(sl1, sr1);
+	_mm_storeu_ps(acc, _mm_hadd_ps(sl0, sl1));
+}
+#endif
+
+#if RESAMPLE_NEON
+static float resample_hsum_neon(float32x4_t v)
+{
+	float32x2_t s = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+	return vget_lane_f32(vpadd_f32(s, s), 0);
+}
+
+static void resample_dot_neon(const float *l, const float *r, const float *c0,
+			      const float *c1, unsigned taps, float acc[4])
+{
+	float32x4_t l0 = vdupq_n_f32(0.0f);
+	float32x4_t r0 = vdupq_n_f32(0.0f);
+	float32x4_t l1 = vdupq_n_f32(0.0f);
+	float32x4_t r1 = vdupq_n_f32(0.0f);
+	unsigned k;
+
+	for(k = 0; k < taps; k += 4)
+	{
+		float32x4_t xl = vld1q_f32(l + k);
+		float32x4_t xr = vld1q_f32(r + k);
+		float32x4_t a = vld1q_f32(c0 + k);
+		float32x4_t b = vld1q_f32(c1 + k);
+
+		l0 = vmlaq_f32(l0, xl, a);
+		r0 = vmlaq_f32(r0, xr, a);
+		l1 = vmlaq_f32(l1, xl, b);
+		r1 = vmlaq_f32(r1, xr, b);
+	}
+
+	acc[0] = resample_hsum_neon(l0);
+	acc[1] = resample_hsum_neon(r0);
+	acc[2] = resample_hsum_neon(l1);
+	acc[3] = resample_hsum_neon(r1);
+}
+#endif
+
+/* Modified Bessel function of the first kind, order zero. */
+static double resample_bessel_i0(double x)
+{
+	double sum = 1.0;
+	double term = 1.0;
+	unsigned k;
+
+	for(k = 1; k < 64; k++)
+	{
+		double f = x / (2.0 * k);
+
+		term *= f * f;
+		sum += term;
+		if(term < sum * 1e-12)
+			break;
+	}
+
+	return sum;
+}
+
+/**
+ * Calculate the Kaiser windowed-sinc filter for each phase. Each phase is
+ * normalised to unity gain.
+ */
+static void resample_gen_coeff(resample_ctx *ctx, double fc, double beta)
+{
+	const double half = ctx->taps / 2;
+	const double i0_beta = resample_bessel_i0(beta);
+	unsigned p, k;
+
+	for(p = 0; p <= RESAMPLE_PHASES; p++)
+	{
+		float *row = ctx->coeff + (p * ctx->taps);
+		double frac = (double)p / RESAMPLE_PHASES;
+		double h[64];
+		double sum = 0.0;
+
+		for(k = 0; k < ctx->taps; k++)
+		{
+			/* Distance of tap from output position. */
+			double t = (half - 1.0) + frac - k;
+			double x = 2.0 * fc * t;
+			double sinc, win, r;
+
+			sinc = (x == 0.0) ? 1.0 : SDL_sin(M_PI * x) / (M_PI * x);
+
+			r = t / half;
+			win = (r <= -1.0 || r >= 1.0) ? 0.0 :
+				resample_bessel_i0(beta * SDL_sqrt(1.0 - r * r)) /
+				i0_beta;
+
+			h[k] = sinc * win;
+			sum += h[k];
+		}
+
+		for(k = 0; k < ctx->taps; k++)
+			row[k] = (float)(h[k] / sum);
+	}
+}
+
+resample_ctx *resample_init(double in_rate, double out_rate,
+			    resample_quality_e quality)
+{
+	resample_ctx *ctx;
+	double fc;
+
+	if(in_rate < 1.0 || out_rate < 1.0 || quality >= RESAMPLE_QUALITY_MAX)
+	{
+		SDL_SetError("Invalid resampler parameters");
+		return NULL;
+	}
+
+	ctx = SDL_calloc(1, sizeof(resample_ctx));
+	if(ctx == NULL)
+	{
+		SDL_OutOfMemory();
+		return NULL;
+	}
+
+	ctx->taps = quality_params[quality].taps;
+	ctx->step = in_rate / out_rate;
+	ctx->cap = RESAMPLE_CHUNK + ctx->taps;
+	ctx->buf_l = SDL_calloc(ctx->cap, sizeof(float));
+	ctx->buf_r = SDL_calloc(ctx->cap, sizeof(float));
+	ctx->coeff = SDL_malloc((RESAMPLE_PHASES + 1) * ctx->taps *
+				sizeof(float));
+	if(ctx->buf_l == NULL || ctx->buf_r == NULL || ctx->coeff == NULL)
+	{
+		resample_exit(ctx);
+		SDL_OutOfMemory();
+		return NULL;
+	}
+
+	/* Remove frequencies that the output can not represent when reducing
+	 * the sample rate. */
+	fc = 0.5 * quality_params[quality].cutoff;
+	if(out_rate < in_rate)
+		fc *= out_rate / in_rate;
+
+	resample_gen_coeff(ctx, fc, quality_params[quality].beta);
+
+	/* Start with silence in the first half of the filter. */
+	ctx->filled = ctx->taps / 2;
+
+	ctx->dot = resample_dot_c;
+	ctx->isa = "C";
+#if RESAMPLE_X86
+	if(SDL_HasAVX2())
+	{
+		ctx->dot = resample_dot_avx2;
+		ctx->isa = "AVX2";
+	}
+	else if(SDL_HasSSE2())
+	{
+		ctx->dot = resample_dot_sse2;
+		ctx->isa = "SSE2";
+	}
+#endif
+#if RESAMPLE_NEON
+	if(SDL_HasNEON())
+	{
+		ctx->dot = resample_dot_neon;
+		ctx->isa = "NEON";
+	}
+#endif
+
+	return ctx;
+}
+
+Uint32 resample_max_output(const resample_ctx *ctx, Uint32 in_frames)
+{
+	return (Uint32)SDL_ceil(in_frames / ctx->step) + 2;
+}
+
+static Sint16 resample_to_s16(float x)
+{
+	x *= 32768.0f;
+
+	if(x >= 32767.0f)
+		return SDL_MAX_SINT16;
+	else if(x <= -32768.0f)
+		return SDL_MIN_SINT16;
+
+	return (Sint16)(x >= 0.0f ? x + 0.5f : x - 0.5f);
+}
+
+Uint32 resample_process(resample_ctx *ctx, const Sint16 *in, Uint32 in_frames,
+			Sint16 *out)
+{
+	Uint32 produced = 0;
+
+	while(1)
+	{
+		Uint32 s, n, i;
+
+		/* Output frames whilst the whole filter is within the
+		 * buffered input. */
+		while((s = (Uint32)ctx->pos) + ctx->taps <= ctx->filled)
+		{
+			double fp = (ctx->pos - s) * RESAMPLE_PHASES;
+			unsigned p = (unsigned)fp;
+			float w = (float)(fp - p);
+			const float *c0 = ctx->coeff + (p * ctx->taps);
+			float acc[4];
+
+			ctx->dot(ctx->buf_l + s, ctx->buf_r + s, c0,
+				 c0 + ctx->taps, ctx->taps, acc);
+
+			out[produced * 2] =
+				resample_to_s16(acc[0] + w * (acc[2] - acc[0]));
+			out[(produced * 2) + 1] =
+				resample_to_s16(acc[1] + w * (acc[3] - acc[1]));
+			produced++;
+			ctx->pos += ctx->step;
+		}
+
+		/* Discard input that will not be used again. */
+		if(s > ctx->filled)
+			s = ctx->filled;
+
+		SDL_memmove(ctx->buf_l, ctx->buf_l + s,
+			    (ctx->filled - s) * sizeof(float));
+		SDL_memmove(ctx->buf_r, ctx->buf_r + s,
+			    (ctx->filled - s) * sizeof(float));
+		ctx->filled -= s;
+		ctx->pos -= s;
+
+		if(in_frames == 0)
+			break;
+
+		n = ctx->cap - ctx->filled;
+		if(n > in_frames)
+			n = in_frames;
+
+		for(i = 0; i < n; i++)
+		{
+			ctx->buf_l[ctx->filled + i] = in[i * 2] * (1.0f / 32768.0f);
+			ctx->buf_r[ctx->filled + i] =
+				in[(i * 2) + 1] * (1.0f / 32768.0f);
+		}
+
+		ctx->filled += n;
+		in += n * 2;
+		in_frames -= n;
+	}
+
+	return produced;
+}
+
+const char *resample_get_isa(const resample_ctx *ctx)
+{
+	return ctx->isa;
+}
+
+void resample_exit(resample_ctx *ctx)
+{
+	if(ctx == NULL)
+		return;
+
+	SDL_free(ctx->buf_l);
+	SDL_free(ctx->buf_r);
+	SDL_free(ctx->coeff);
+	SDL_free(ctx);
+}
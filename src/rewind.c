@@ -0,0 +1,571 @@
+/**
+ * Rewind buffer of serialised core states.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#include <SDL.h>
+#include <string.h>
+
+#include <haiyajan.h>
+#include <lz.h>
+#include <rewind.h>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || \
+	defined(_M_IX86)
+#define REWIND_X86	1
+#include <immintrin.h>
+#else
+#define REWIND_X86	0
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define REWIND_NEON	1
+#include <arm_neon.h>
+#else
+#define REWIND_NEON	0
+#endif
+
+/* Allow the use of instructions that the compiler was not told to use
+ * globally. These functions are only called if the CPU supports them. */
+#if defined(__GNUC__)
+#define REWIND_TARGET(isa)	__attribute__((target(isa)))
+#else
+#define REWIND_TARGET(isa)
+#endif
+
+/* Initial number of entries in the index of the ring buffer. */
+#define REWIND_ENTRIES	256
+
+typedef void (*rewind_xor_fn)(Uint8 *dst, const Uint8 *a, const Uint8 *b,
+			      size_t len);
+
+/* Compressed difference within the ring buffer. */
+struct rewind_entry_s
+{
+	size_t off;
+	size_t len;
+};
+
+struct rewind_s
+{
+	struct core_ctx_s *core;
+	rewind_xor_fn xor_fn;
+	const char *isa;
+
+	/* The newest state, the state being captured, the difference between
+	 * them, and the compressed difference. */
+	Uint8 *prev;
+	Uint8 *cur;
+	Uint8 *delta;
+	Uint8 *comp;
+	size_t len;
+	Uint8 have_prev;
+
+	/* Set once a capture was skipped as the core reported a state size of
+	 * zero. */
+	Uint8 unsupported_logged;
+
+	/* Compressed differences, from the oldest at ring + entries[first].off
+	 * to the newest, which ends at ring + head. An entry that does not
+	 * fit before the end of the ring is written at the start. */
+	Uint8 *ring;
+	size_t size;
+	size_t head;
+	size_t used;
+
+	/* Index of the ring buffer, itself a ring of entries_size entries. */
+	struct rewind_entry_s *entries;
+	Uint32 entries_size;
+	Uint32 first;
+	Uint32 count;
+
+	unsigned interval;
+	unsigned countdown;
+	Uint8 full_logged;
+
+	Uint64 frames;
+	Uint64 captures;
+	Uint64 capture_us;
+};
+
+static void rewind_xor_c(Uint8 *dst, const Uint8 *a, const Uint8 *b,
+			 size_t len)
+{
+	size_t i;
+
+	for(i = 0; i + 8 <= len; i += 8)
+	{
+		Uint64 x, y;
+
+		memcpy(&x, a + i, sizeof(x));
+		memcpy(&y, b + i, sizeof(y));
+		x ^= y;
+		memcpy(dst + i, &x, sizeof(x));
+	}
+
+	for(; i < len; i++)
+		dst[i] = a[i] ^ b[i];
+}
+
+#if REWIND_X86
+REWIND_TARGET("sse2")
+static void rewind_xor_sse2(Uint8 *dst, const Uint8 *a, const Uint8 *b,
+			    size_t len)
+{
+	size_t i;
+
+	for(i = 0; i + 32 <= len; i += 32)
+	{
+		__m128i a0 = _mm_loadu_si128((const __m128i *)(a + i));
+		__m128i a1 = _mm_loadu_si128((const __m128i *)(a + i + 16));
+		__m128i b0 = _mm_loadu_si128((const __m128i *)(b + i));
+		__m128i b1 = _mm_loadu_si128((const __m128i *)(b + i + 16));
+
+		_mm_storeu_si128((__m128i *)(dst + i), _mm_xor_si128(a0, b0));
+		_mm_storeu_si128((__m128i *)(dst + i + 16),
+				 _mm_xor_si128(a1, b1));
+	}
+
+	rewind_xor_c(dst + i, a + i, b + i, len - i);
+}
+
+REWIND_TARGET("avx2")
+static void rewind_xor_avx2(Uint8 *dst, const Uint8 *a, const Uint8 *b,
+			    size_t len)
+{
+	size_t i;
+
+	for(i = 0; i + 64 <= len; i += 64)
+	{
+		__m256i a0 = _mm256_loadu_si256((const __m256i *)(a + i));
+		__m256i a1 = _mm256_loadu_si256((const __m256i *)(a + i + 32));
+		__m256i b0 = _mm256_loadu_si256((const __m256i *)(b + i));
+		__m256i b1 = _mm256_loadu_si256((const __m256i *)(b + i + 32));
+
+		_mm256_storeu_si256((__m256i *)(dst + i),
+				    _mm256_xor_si256(a0, b0));
+		_mm256_storeu_si256((__m256i *)(dst + i + 32),
+				    _mm256_xor_si256(a1, b1));
+	}
+
+	rewind_xor_c(dst + i, a + i, b + i, len - i);
+}
+#endif
+
+#if REWIND_NEON
+static void rewind_xor_neon(Uint8 *dst, const Uint8 *a, const Uint8 *b,
+			    size_t len)
+{
+	size_t i;
+
+	for(i = 0; i + 32 <= len; i += 32)
+	{
+		uint8x16_t a0 = vld1q_u8(a + i);
+		uint8x16_t a1 = vld1q_u8(a + i + 16);
+		uint8x16_t b0 = vld1q_u8(b + i);
+		uint8x16_t b1 = vld1q_u8(b + i + 16);
+
+		vst1q_u8(dst + i, veorq_u8(a0, b0));
+		vst1q_u8(dst + i + 16, veorq_u8(a1, b1));
+	}
+
+	rewind_xor_c(dst + i, a + i, b + i, len - i);
+}
+#endif
+
+static Uint64 rewind_us(Uint64 beg, Uint64 end)
+{
+	return (end - beg) * 1000000 / SDL_GetPerformanceFrequency();
+}
+
+/**
+ * Drop all states, such that the next capture starts a new history.
+ */
+static void rewind_clear(struct rewind_s *ctx)
+{
+	ctx->first = 0;
+	ctx->count = 0;
+	ctx->head = 0;
+	ctx->used = 0;
+}
+
+/**
+ * Allocate buffers for states of the given length. Drops all states.
+ */
+static int rewind_set_len(struct rewind_s *ctx, size_t len)
+{
+	Uint8 *prev, *cur, *delta, *comp;
+
+	if(len > LZ_MAX_INPUT)
+		return SDL_SetError("States of this core are too large "
+				    "to rewind");
+
+	prev = SDL_malloc(len);
+	cur = SDL_malloc(len);
+	delta = SDL_malloc(len);
+	comp = SDL_malloc(LZ_BOUND(len));
+	if(prev == NULL || cur == NULL || delta == NULL || comp == NULL)
+	{
+		SDL_free(prev);
+		SDL_free(cur);
+		SDL_free(delta);
+		SDL_free(comp);
+		return SDL_OutOfMemory();
+	}
+
+	SDL_free(ctx->prev);
+	SDL_free(ctx->cur);
+	SDL_free(ctx->delta);
+	SDL_free(ctx->comp);
+	ctx->prev = prev;
+	ctx->cur = cur;
+	ctx->delta = delta;
+	ctx->comp = comp;
+	ctx->len = len;
+	ctx->have_prev = 0;
+	rewind_clear(ctx);
+	SDL_LogVerbose(SDL_LOG_CATEGORY_APPLICATION,
+		       "Capturing %lu KiB states for rewinding",
+		       (unsigned long)(len / 1024));
+	return 0;
+}
+
+static struct rewind_entry_s *rewind_entry(const struct rewind_s *ctx,
+					   Uint32 i)
+{
+	return &ctx->entries[(ctx->first + i) % ctx->entries_size];
+}
+
+static void rewind_drop_oldest(struct rewind_s *ctx)
+{
+	ctx->used -= rewind_entry(ctx, 0)->len;
+	ctx->first = (ctx->first + 1) % ctx->entries_size;
+	ctx->count--;
+
+	if(ctx->count == 0)
+		rewind_clear(ctx);
+}
+
+/**
+ * Obtain the offset at which an entry of the given length is written,
+ * dropping the oldest entries until it fits.
+ */
+static size_t rewind_reserve(struct rewind_s *ctx, size_t len)
+{
+	while(ctx->count > 0)
+	{
+		const size_t tail = rewind_entry(ctx, 0)->off;
+		const size_t newest = rewind_entry(ctx, ctx->count - 1)->off;
+
+		if(newest >= tail)
+		{
+			/* Entries are contiguous, so there is space both
+			 * after the newest entry and before the oldest. */
+			if(ctx->head + len <= ctx->size)
+				return ctx->head;
+
+			if(len <= tail)
+				return 0;
+		}
+		else if(ctx->head + len <= tail)
+		{
+			return ctx->head;
+		}
+
+		if(!ctx->full_logged)
+		{
+			ctx->full_logged = 1;
+			SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+				    "Rewind buffer is full, so the oldest "
+				    "states will be dropped");
+			rewind_log_stats(ctx);
+		}
+
+		rewind_drop_oldest(ctx);
+	}
+
+	return 0;
+}
+
+/**
+ * Append a compressed difference to the ring buffer. On failure, the ring
+ * buffer is unchanged, and must be cleared by the caller.
+ */
+static int rewind_push(struct rewind_s *ctx, const Uint8 *data, size_t len)
+{
+	struct rewind_entry_s *e;
+	size_t off;
+
+	if(len > ctx->size)
+	{
+		return SDL_SetError("State difference of %lu bytes does not "
+				    "fit within the rewind buffer",
+				    (unsigned long)len);
+	}
+
+	if(ctx->count == ctx->entries_size)
+	{
+		const Uint32 sz = ctx->entries_size * 2;
+		struct rewind_entry_s *tmp;
+		Uint32 i;
+
+		tmp = SDL_malloc(sz * sizeof(*tmp));
+		if(tmp == NULL)
+			return SDL_OutOfMemory();
+
+		for(i = 0; i < ctx->count; i++)
+			tmp[i] = *rewind_entry(ctx, i);
+
+		SDL_free(ctx->entries);
+		ctx->entries = tmp;
+		ctx->entries_size = sz;
+		ctx->first = 0;
+	}
+
+	off = rewind_reserve(ctx, len);
+	e = rewind_entry(ctx, ctx->count);
+	e->off = off;
+	e->len = len;
+
+	SDL_memcpy(ctx->ring + e->off, data, len);
+	ctx->head = e->off + len;
+	ctx->used += len;
+	ctx->count++;
+	return 0;
+}
+
+rewind_ctx *rewind_init(struct core_ctx_s *core, size_t size,
+			unsigned interval)
+{
+	struct rewind_s *ctx;
+
+	ctx = SDL_calloc(1, sizeof(*ctx));
+	if(ctx == NULL)
+	{
+		SDL_OutOfMemory();
+		return NULL;
+	}
+
+	ctx->core = core;
+	ctx->size = size;
+	ctx->interval = interval > 0 ? interval : 1;
+	ctx->countdown = ctx->interval;
+	ctx->entries_size = REWIND_ENTRIES;
+	ctx->ring = SDL_malloc(size);
+	ctx->entries = SDL_malloc(REWIND_ENTRIES * sizeof(*ctx->entries));
+	if(ctx->ring == NULL || ctx->entries == NULL)
+	{
+		SDL_OutOfMemory();
+		goto err;
+	}
+
+	ctx->xor_fn = rewind_xor_c;
+	ctx->isa = "C";
+#if REWIND_X86
+	if(SDL_HasAVX2())
+	{
+		ctx->xor_fn = rewind_xor_avx2;
+		ctx->isa = "AVX2";
+	}
+	else if(SDL_HasSSE2())
+	{
+		ctx->xor_fn = rewind_xor_sse2;
+		ctx->isa = "SSE2";
+	}
+#endif
+#if REWIND_NEON
+	if(SDL_HasNEON())
+	{
+		ctx->xor_fn = rewind_xor_neon;
+		ctx->isa = "NEON";
+	}
+#endif
+
+	SDL_LogVerbose(SDL_LOG_CATEGORY_APPLICATION,
+		       "Rewinding with a %lu KiB buffer, capturing states "
+		       "every %u frames with %s",
+		       (unsigned long)(size / 1024), ctx->interval,
+		       ctx->isa);
+	return ctx;
+
+err:
+	rewind_free(ctx);
+	return NULL;
+}
+
+void rewind_frame(rewind_ctx *ctx)
+{
+	const struct core_ctx_s *core = ctx->core;
+	Uint64 beg;
+	size_t len;
+
+	ctx->frames++;
+	if(--ctx->countdown > 0)
+		return;
+
+	ctx->countdown = ctx->interval;
+	beg = SDL_GetPerformanceCounter();
+
+	/* Some cores only report the size of their state once they have run,
+	 * so buffers are allocated by the first capture. */
+	len = core->fn.retro_serialize_size();
+	if(len == 0)
+	{
+		if(!ctx->unsupported_logged)
+		{
+			ctx->unsupported_logged = 1;
+			SDL_LogVerbose(SDL_LOG_CATEGORY_APPLICATION,
+				       "Core does not support save states "
+				       "yet, so rewinding is unavailable");
+		}
+
+		return;
+	}
+
+	/* The size of the state may change whilst playing, in which case
+	 * older states can no longer be restored. */
+	if(len != ctx->len && rewind_set_len(ctx, len) != 0)
+		goto err;
+
+	if(!core->fn.retro_serialize(ctx->cur, len))
+	{
+		SDL_SetError("Core was unable to save its state");
+		goto err;
+	}
+
+	if(ctx->have_prev)
+	{
+		size_t comp_len;
+
+		ctx->xor_fn(ctx->delta, ctx->cur, ctx->prev, len);
+		comp_len = lz_compress(ctx->delta, len, ctx->comp);
+		/* Without the difference, the newest entry could no longer
+		 * be applied to the captured state, so the history restarts
+		 * from it. */
+		if(rewind_push(ctx, ctx->comp, comp_len) != 0)
+		{
+			rewind_clear(ctx);
+			SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "%s",
+				    SDL_GetError());
+		}
+	}
+
+	/* The captured state becomes the newest. */
+	do {
+		Uint8 *tmp = ctx->prev;
+		ctx->prev = ctx->cur;
+		ctx->cur = tmp;
+	} while(0);
+
+	ctx->have_prev = 1;
+	ctx->captures++;
+	ctx->capture_us += rewind_us(beg, SDL_GetPerformanceCounter());
+	return;
+
+err:
+	SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "Unable to capture state "
+		    "for rewinding: %s", SDL_GetError());
+}
+
+int rewind_step(rewind_ctx *ctx)
+{
+	const struct core_ctx_s *core = ctx->core;
+
+	if(!ctx->have_prev)
+		return 1;
+
+	if(ctx->count > 0)
+	{
+		const struct rewind_entry_s *e =
+			rewind_entry(ctx, ctx->count - 1);
+		size_t len = ctx->len;
+
+		if(lz_decompress(ctx->ring + e->off, e->len, ctx->delta,
+				 &len) != 0 || len != ctx->len)
+		{
+			rewind_clear(ctx);
+			return SDL_SetError("Rewind buffer is corrupt");
+		}
+
+		ctx->xor_fn(ctx->prev, ctx->prev, ctx->delta, len);
+		ctx->used -= e->len;
+		ctx->count--;
+
+		if(ctx->count == 0)
+		{
+			rewind_clear(ctx);
+		}
+		else
+		{
+			e = rewind_entry(ctx, ctx->count - 1);
+			ctx->head = e->off + e->len;
+		}
+	}
+
+	if(!core->fn.retro_unserialize(ctx->prev, ctx->len))
+		return SDL_SetError("Core was unable to load its state");
+
+	/* Capture the next state a full interval after the restored one. */
+	ctx->countdown = ctx->interval;
+	return ctx->count == 0 ? 1 : 0;
+}
+
+void rewind_get_stats(const rewind_ctx *ctx, struct rewind_stats_s *st)
+{
+	const double fps = ctx->core->av_info.timing.fps;
+
+	st->states = ctx->count;
+	st->seconds = fps > 0.0 ?
+		(float)((double)ctx->count * ctx->interval / fps) : 0.0f;
+	st->used = ctx->used;
+	st->size = ctx->size;
+	st->state_len = ctx->len;
+	st->frames = ctx->frames;
+	st->captures = ctx->captures;
+	st->capture_us = ctx->capture_us;
+}
+
+void rewind_log_stats(const rewind_ctx *ctx)
+{
+	struct rewind_stats_s st;
+	const double mib = 1024.0 * 1024.0;
+
+	rewind_get_stats(ctx, &st);
+	if(st.captures == 0)
+		return;
+
+	SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+		    "Rewind: %u states covering %.1f s in %.2f of %.2f MiB, "
+		    "%.1f s per MiB",
+		    (unsigned)st.states, st.seconds, st.used / mib,
+		    st.size / mib,
+		    st.used > 0 ? st.seconds / (st.used / mib) : 0.0);
+	SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+		    "Rewind: %lu us per capture, %.1f us per frame",
+		    (unsigned long)(st.capture_us / st.captures),
+		    (double)st.capture_us / (double)st.frames);
+}
+
+void rewind_free(rewind_ctx *ctx)
+{
+	if(ctx == NULL)
+		return;
+
+	rewind_log_stats(ctx);
+	SDL_free(ctx->prev);
+	SDL_free(ctx->cur);
+	SDL_free(ctx->delta);
+	SDL_free(ctx->comp);
+	SDL_free(ctx->entries);
+	SDL_free(ctx->ring);
+	SDL_free(ctx);
+}
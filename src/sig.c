@@ -117,4 +117,10 @@ void init_sig(struct haiyajan_ctx_s *c)
 	signal(SIGFPE, sig_handler);
 	signal(SIGILL, sig_handler);
 	signal(SIGSEGV, sig_handler);
+
+#ifdef SIGPIPE
+	/* Writing to a pipe whose reader has exited, such as an external
+	 * encoder, must return an error instead of terminating Haiyajan. */
+	signal(SIGPIPE, SIG_IGN);
+#endif
 }
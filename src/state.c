@@ -0,0 +1,367 @@
+/**
+ * Save states of libretro cores.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#include <SDL.h>
+
+#include <haiyajan.h>
+#include <job.h>
+#include <lz.h>
+#include <state.h>
+#include <util.h>
+
+/* Files begin with the magic, followed by the length and CRC-32 of the
+ * serialised state as little endian integers, and then the state compressed
+ * as an LZ4 block. */
+#define STATE_MAGIC		"HAIYAST\x01"
+#define STATE_MAGIC_LEN		8
+#define STATE_HEADER_LEN	(STATE_MAGIC_LEN + 8)
+
+struct state_s
+{
+	/* Serialised state, reused by each save and load. */
+	Uint8 *buf;
+	size_t buf_size;
+	size_t len;
+
+	/* Header and compressed state written by a worker. */
+	Uint8 *out;
+	size_t out_size;
+
+	/* Quick slot. Empty whilst quick_len is zero. */
+	Uint8 *quick;
+	size_t quick_size;
+	size_t quick_len;
+
+	/* File and slot of the state being written, and the time taken to
+	 * serialise it. */
+	char *path;
+	unsigned slot;
+	Uint64 serialise_us;
+
+	/* Set whilst a worker is writing the state within buf. */
+	SDL_atomic_t busy;
+};
+
+static Uint64 state_us(Uint64 beg, Uint64 end)
+{
+	return (end - beg) * 1000000 / SDL_GetPerformanceFrequency();
+}
+
+static void state_wait(struct state_s *st)
+{
+	while(SDL_AtomicGet(&st->busy) != 0)
+		SDL_Delay(1);
+
+	SDL_MemoryBarrierAcquire();
+}
+
+/**
+ * Grow a buffer to at least the given size.
+ */
+static int state_reserve(Uint8 **buf, size_t *size, size_t len)
+{
+	Uint8 *tmp;
+
+	if(len <= *size)
+		return 0;
+
+	tmp = SDL_realloc(*buf, len);
+	if(tmp == NULL)
+		return SDL_OutOfMemory();
+
+	*buf = tmp;
+	*size = len;
+	return 0;
+}
+
+/**
+ * Reserve space for a serialised state of the given length, and for its
+ * compressed copy.
+ */
+static int state_reserve_len(struct state_s *st, size_t len)
+{
+	if(len > LZ_MAX_INPUT)
+		return SDL_SetError("State is too large to save");
+
+	if(state_reserve(&st->buf, &st->buf_size, len) != 0 ||
+		state_reserve(&st->out, &st->out_size,
+			      STATE_HEADER_LEN + LZ_BOUND(len)) != 0)
+		return -1;
+
+	return 0;
+}
+
+static char *state_path(const struct core_ctx_s *ctx, unsigned slot)
+{
+	char ext[16];
+
+	if(ctx->content_filename == NULL)
+	{
+		SDL_SetError("Save states require content");
+		return NULL;
+	}
+
+	SDL_snprintf(ext, sizeof(ext), ".state%u", slot);
+	return util_replace_ext(ctx->content_filename, ext);
+}
+
+/**
+ * Obtain the save state context, allocating it on first use. Some cores only
+ * report the size of their state once they have run a frame, so nothing is
+ * allocated when content is loaded. Buffers are grown by each save and load.
+ */
+static struct state_s *state_get(struct core_ctx_s *ctx)
+{
+	if(ctx->state != NULL)
+		return ctx->state;
+
+	ctx->state = SDL_calloc(1, sizeof(struct state_s));
+	if(ctx->state == NULL)
+		SDL_OutOfMemory();
+
+	return ctx->state;
+}
+
+/**
+ * Obtain the size of the state of the core.
+ *
+ * \return	Size in bytes, or 0 if the core does not support save states.
+ */
+static size_t state_size(struct core_ctx_s *ctx)
+{
+	size_t len = ctx->fn.retro_serialize_size();
+
+	if(len == 0)
+		SDL_SetError("This core does not support save states");
+
+	return len;
+}
+
+static void state_job(void *arg)
+{
+	struct state_s *st = arg;
+	Uint64 beg, mid, end;
+	size_t len;
+	Uint32 v;
+
+	beg = SDL_GetPerformanceCounter();
+	SDL_memcpy(st->out, STATE_MAGIC, STATE_MAGIC_LEN);
+	v = SDL_SwapLE32((Uint32)st->len);
+	SDL_memcpy(st->out + STATE_MAGIC_LEN, &v, sizeof(v));
+	v = SDL_SwapLE32(util_crc32(st->buf, st->len, 0));
+	SDL_memcpy(st->out + STATE_MAGIC_LEN + 4, &v, sizeof(v));
+	len = STATE_HEADER_LEN +
+		lz_compress(st->buf, st->len, st->out + STATE_HEADER_LEN);
+
+	mid = SDL_GetPerformanceCounter();
+	if(util_write_file(st->path, st->out, len) != 0)
+	{
+		SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+			    "Unable to save state %u: %s", st->slot,
+			    SDL_GetError());
+		goto out;
+	}
+
+	end = SDL_GetPerformanceCounter();
+	SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+		    "Saved state %u (%lu KiB compressed to %lu KiB): "
+		    "serialise %lu us, compress %lu us, write %lu us",
+		    st->slot, (unsigned long)(st->len / 1024),
+		    (unsigned long)(len / 1024),
+		    (unsigned long)st->serialise_us,
+		    (unsigned long)state_us(beg, mid),
+		    (unsigned long)state_us(mid, end));
+
+out:
+	/* The buffers are reused by the main thread once busy is cleared. */
+	SDL_MemoryBarrierRelease();
+	SDL_AtomicSet(&st->busy, 0);
+}
+
+int state_save(struct core_ctx_s *ctx, unsigned slot)
+{
+	struct state_s *st = state_get(ctx);
+	Uint64 beg;
+	size_t len;
+	char *path;
+
+	if(st == NULL)
+		return -1;
+
+	/* The size of the state may change whilst playing. */
+	len = state_size(ctx);
+	if(len == 0)
+		return -1;
+
+	path = state_path(ctx, slot);
+	if(path == NULL)
+		return -1;
+
+	/* The buffer is in use until the previous state is written. */
+	state_wait(st);
+	SDL_free(st->path);
+	st->path = path;
+	st->slot = slot;
+
+	if(state_reserve_len(st, len) != 0)
+		return -1;
+
+	beg = SDL_GetPerformanceCounter();
+	if(!ctx->fn.retro_serialize(st->buf, len))
+		return SDL_SetError("Core was unable to save its state");
+
+	st->serialise_us = state_us(beg, SDL_GetPerformanceCounter());
+	st->len = len;
+
+	SDL_AtomicSet(&st->busy, 1);
+	job_submit(JOB_PRIO_NORMAL, state_job, st);
+	return 0;
+}
+
+int state_load(struct core_ctx_s *ctx, unsigned slot)
+{
+	struct state_s *st = state_get(ctx);
+	Uint64 beg, read, dec, end;
+	Uint8 *file = NULL;
+	size_t file_len, len;
+	Uint32 v, crc;
+	char *path;
+	int ret = -1;
+
+	if(st == NULL)
+		return -1;
+
+	path = state_path(ctx, slot);
+	if(path == NULL)
+		return -1;
+
+	state_wait(st);
+
+	beg = SDL_GetPerformanceCounter();
+	file = SDL_LoadFile(path, &file_len);
+	SDL_free(path);
+	if(file == NULL)
+		return SDL_SetError("State %u has not been saved", slot);
+
+	read = SDL_GetPerformanceCounter();
+	if(file_len < STATE_HEADER_LEN ||
+		SDL_memcmp(file, STATE_MAGIC, STATE_MAGIC_LEN) != 0)
+	{
+		SDL_SetError("State %u is not a valid save state", slot);
+		goto out;
+	}
+
+	SDL_memcpy(&v, file + STATE_MAGIC_LEN, sizeof(v));
+	len = SDL_SwapLE32(v);
+	SDL_memcpy(&v, file + STATE_MAGIC_LEN + 4, sizeof(v));
+	crc = SDL_SwapLE32(v);
+
+	if(state_reserve_len(st, len) != 0)
+		goto out;
+
+	st->len = len;
+	if(lz_decompress(file + STATE_HEADER_LEN, file_len - STATE_HEADER_LEN,
+			 st->buf, &st->len) != 0 || st->len != len ||
+		util_crc32(st->buf, len, 0) != crc)
+	{
+		SDL_SetError("State %u is corrupt", slot);
+		goto out;
+	}
+
+	dec = SDL_GetPerformanceCounter();
+	if(!ctx->fn.retro_unserialize(st->buf, len))
+	{
+		SDL_SetError("Core was unable to load state %u", slot);
+		goto out;
+	}
+
+	end = SDL_GetPerformanceCounter();
+	SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION,
+		    "Loaded state %u: read %lu us, decompress %lu us, "
+		    "unserialise %lu us", slot,
+		    (unsigned long)state_us(beg, read),
+		    (unsigned long)state_us(read, dec),
+		    (unsigned long)state_us(dec, end));
+	ret = 0;
+
+out:
+	SDL_free(file);
+	return ret;
+}
+
+int state_quick_save(struct core_ctx_s *ctx)
+{
+	struct state_s *st = state_get(ctx);
+	Uint64 beg;
+	size_t len;
+
+	if(st == NULL)
+		return -1;
+
+	len = state_size(ctx);
+	if(len == 0)
+		return -1;
+
+	if(state_reserve(&st->quick, &st->quick_size, len) != 0)
+		return -1;
+
+	beg = SDL_GetPerformanceCounter();
+	if(!ctx->fn.retro_serialize(st->quick, len))
+	{
+		st->quick_len = 0;
+		return SDL_SetError("Core was unable to save its state");
+	}
+
+	st->quick_len = len;
+	SDL_LogVerbose(SDL_LOG_CATEGORY_APPLICATION,
+		       "Saved quick state: serialise %lu us",
+		       (unsigned long)state_us(beg,
+					       SDL_GetPerformanceCounter()));
+	return 0;
+}
+
+int state_quick_load(struct core_ctx_s *ctx)
+{
+	struct state_s *st = ctx->state;
+	Uint64 beg;
+
+	if(st == NULL || st->quick_len == 0)
+		return SDL_SetError("Quick state has not been saved");
+
+	beg = SDL_GetPerformanceCounter();
+	if(!ctx->fn.retro_unserialize(st->quick, st->quick_len))
+		return SDL_SetError("Core was unable to load quick state");
+
+	SDL_LogVerbose(SDL_LOG_CATEGORY_APPLICATION,
+		       "Loaded quick state: unserialise %lu us",
+		       (unsigned long)state_us(beg,
+					       SDL_GetPerformanceCounter()));
+	return 0;
+}
+
+void state_free(struct core_ctx_s *ctx)
+{
+	struct state_s *st = ctx->state;
+
+	if(st == NULL)
+		return;
+
+	state_wait(st);
+	SDL_free(st->buf);
+	SDL_free(st->out);
+	SDL_free(st->quick);
+	SDL_free(st->path);
+	SDL_free(st);
+	ctx->state = NULL;
+}
@@ -16,6 +16,13 @@
 
 #include <timer.h>
 
+/* Time kept free before VSYNC when tuning the frame delay, to absorb the
+ * inaccuracy of SDL_Delay() and variance in the time taken by the core. */
+#define TIMER_FRAME_DELAY_MARGIN_US	2000
+
+/* Number of frames to observe before the automatic frame delay is raised. */
+#define TIMER_FRAME_DELAY_SAMPLES	64
+
 int timer_init(struct timer_ctx_s *const tim, double emulated_rate)
 {
 	int ret = 0;
@@ -26,6 +33,11 @@ int timer_init(struct timer_ctx_s *const tim, double emulated_rate)
 	tim->timer_event = SDL_RegisterEvents(1);
 	tim->busy_acu_ms = 0;
 	tim->busy_samples = 0;
+	tim->frame_delay_ms = 0;
+	tim->frame_delay_auto = 0;
+	tim->work_samples = 0;
+	tim->work_max_us = 0;
+	tim->work_start = 0;
 
 	if(tim->timer_event == (Uint32)-1)
 		ret = -1;
@@ -100,3 +112,72 @@ int timer_profile_end(struct timer_ctx_s *const tim)
 	/* Play the next frame on the next VSYNC call as normal. */
 	return 0;
 }
+
+void timer_set_frame_delay(struct timer_ctx_s *const tim, int delay_ms)
+{
+	/* The delay must leave some time to run the core. */
+	const int max_ms = (int)tim->core_ms - 1;
+
+	tim->frame_delay_auto = delay_ms < 0;
+	tim->work_samples = 0;
+	tim->work_max_us = 0;
+
+	if(delay_ms < 0)
+		delay_ms = 0;
+	else if(delay_ms > max_ms)
+		delay_ms = max_ms > 0 ? max_ms : 0;
+
+	tim->frame_delay_ms = delay_ms;
+}
+
+void timer_frame_delay(struct timer_ctx_s *const tim)
+{
+	if(tim->frame_delay_ms > 0)
+		SDL_Delay((Uint32)tim->frame_delay_ms);
+
+	tim->work_start = SDL_GetPerformanceCounter();
+}
+
+void timer_frame_work_end(struct timer_ctx_s *const tim)
+{
+	const Uint32 frame_us = (Uint32)(tim->core_ms * 1000.0);
+	Uint32 budget_us, work_us;
+	Uint64 elapsed;
+
+	if(tim->frame_delay_auto == 0 || tim->work_start == 0)
+		return;
+
+	elapsed = SDL_GetPerformanceCounter() - tim->work_start;
+	tim->work_start = 0;
+	work_us = (Uint32)((elapsed * 1000000) / SDL_GetPerformanceFrequency());
+	if(work_us > tim->work_max_us)
+		tim->work_max_us = work_us;
+
+	budget_us = frame_us > TIMER_FRAME_DELAY_MARGIN_US ?
+		frame_us - TIMER_FRAME_DELAY_MARGIN_US : 0;
+
+	/* Back off immediately if this frame came close to missing VSYNC. */
+	if((Uint32)tim->frame_delay_ms * 1000 + work_us > budget_us)
+	{
+		if(tim->frame_delay_ms > 0)
+			tim->frame_delay_ms--;
+
+		tim->work_samples = 0;
+		tim->work_max_us = 0;
+		return;
+	}
+
+	if(++tim->work_samples < TIMER_FRAME_DELAY_SAMPLES)
+		return;
+
+	/* Raise the delay slowly whilst the slowest recent frame would still
+	 * finish within the budget. */
+	if((Uint32)(tim->frame_delay_ms + 1) * 1000 + tim->work_max_us <=
+			budget_us)
+	{
+		tim->frame_delay_ms++;
+	}
+
+	tim->work_samples = 0;
+	tim->work_max_us = 0;
+}
@@ -28,23 +28,50 @@
 #include <assert.h>
 #include <limits.h>
 #include <stddef.h>
+#include <string.h>
 
-#include <SDL_assert.h>
+#include <SDL_endian.h>
+#include <SDL_stdinc.h>
 
 /* -- Internal data structures -- */
 
+/*
+ * Number of bits decoded by a single lookup. Codes that are longer than this
+ * are rare, and are decoded by continuing the canonical decode from the state
+ * stored in the table.
+ */
+#define TINF_TABLE_BITS 10
+#define TINF_TABLE_SIZE (1 << TINF_TABLE_BITS)
+
+/*
+ * Table entries either hold a symbol and its code length, or for codes longer
+ * than TINF_TABLE_BITS, the state of the canonical decode after
+ * TINF_TABLE_BITS bits.
+ */
+#define TINF_ENTRY_LONG 0x80000000UL
+#define TINF_ENTRY(sym, len) (((unsigned long) (sym) << 8) | (len))
+#define TINF_ENTRY_STATE(base, offs) \
+	(TINF_ENTRY_LONG | ((unsigned long) (base) << 12) | (offs))
+
 struct tinf_tree {
 	unsigned short counts[16]; /* Number of codes with a given length */
 	unsigned short symbols[288]; /* Symbols sorted by code */
 	int max_sym;
+	Uint32 table[TINF_TABLE_SIZE]; /* Indexed by the next input bits */
 };
 
 struct tinf_data {
 	const unsigned char *source;
 	const unsigned char *source_end;
-	unsigned long tag;
+	Uint64 tag;
 	int bitcount;
-	int overflow;
+
+	/*
+	 * Number of zero bits appended to tag after the end of the source.
+	 * If fewer bits than this remain in tag, the decoder has read past
+	 * the end of the source.
+	 */
+	int padding;
 
 	unsigned char *dest_start;
 	unsigned char *dest;
@@ -54,6 +81,162 @@ struct tinf_data {
 	struct tinf_tree dtree; /* Distance tree */
 };
 
+/* Size of the history required by matches */
+#define TINF_WINDOW_SIZE 32768UL
+#define TINF_WINDOW_MASK (TINF_WINDOW_SIZE - 1)
+
+/* Longest output of a single symbol */
+#define TINF_MAX_MATCH 258
+
+enum tinf_mode {
+	TINF_MODE_HEADER,   /* Block header */
+	TINF_MODE_STORED,   /* Length of stored block */
+	TINF_MODE_COPY,     /* Data of stored block */
+	TINF_MODE_TREES,    /* Sizes of dynamic trees */
+	TINF_MODE_CODELENS, /* Code length code lengths */
+	TINF_MODE_LENS,     /* Literal/length and distance code lengths */
+	TINF_MODE_CODES,    /* Compressed data */
+	TINF_MODE_DONE
+};
+
+struct tinf_stream {
+	Uint64 tag;
+	int bitcount;
+
+	enum tinf_mode mode;
+	int bfinal;
+
+	unsigned long stored_left; /* Bytes of stored block remaining */
+
+	unsigned hlit, hdist, hclen;
+	unsigned num; /* Number of code lengths read */
+	unsigned char lengths[288 + 32];
+
+	/*
+	 * Output is written to window, and copied to the destination given
+	 * by the caller. The number of bytes not yet copied is kept in
+	 * pending, and is never more than TINF_WINDOW_SIZE.
+	 */
+	unsigned long wpos; /* Position of next byte written to window */
+	unsigned long pending;
+	unsigned long have; /* Bytes of history in window */
+
+	struct tinf_tree ltree; /* Literal/length tree */
+	struct tinf_tree dtree; /* Distance tree */
+
+	unsigned char window[TINF_WINDOW_SIZE];
+};
+
+/* Special ordering of code length codes */
+static const unsigned char clcidx[19] = {
+	16, 17, 18, 0,  8, 7,  9, 6, 10, 5,
+	11,  4, 12, 3, 13, 2, 14, 1, 15
+};
+
+/* Extra bits and base tables for length codes */
+static const unsigned char length_bits[30] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+	1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+	4, 4, 4, 4, 5, 5, 5, 5, 0, 127
+};
+
+static const unsigned short length_base[30] = {
+	 3,  4,  5,   6,   7,   8,   9,  10,  11,  13,
+	15, 17, 19,  23,  27,  31,  35,  43,  51,  59,
+	67, 83, 99, 115, 131, 163, 195, 227, 258,   0
+};
+
+/* Extra bits and base tables for distance codes */
+static const unsigned char dist_bits[30] = {
+	0, 0,  0,  0,  1,  1,  2,  2,  3,  3,
+	4, 4,  5,  5,  6,  6,  7,  7,  8,  8,
+	9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+static const unsigned short dist_base[30] = {
+	   1,    2,    3,    4,    5,    7,    9,    13,    17,    25,
+	  33,   49,   65,   97,  129,  193,  257,   385,   513,   769,
+	1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+
+/*
+ * Fill the lookup table by running the canonical decode for every possible
+ * sequence of TINF_TABLE_BITS bits. The first bit read is the least
+ * significant bit of the index.
+ */
+static void tinf_build_table(struct tinf_tree *t)
+{
+	unsigned long i;
+
+	for (i = 0; i < TINF_TABLE_SIZE; ++i) {
+		int base = 0, index = 0;
+		int len;
+
+		for (len = 1; len <= TINF_TABLE_BITS; ++len) {
+			index = 2 * index + ((i >> (len - 1)) & 1);
+
+			if (index < t->counts[len]) {
+				break;
+			}
+
+			base += t->counts[len];
+			index -= t->counts[len];
+		}
+
+		if (len <= TINF_TABLE_BITS) {
+			t->table[i] = TINF_ENTRY(t->symbols[base + index], len);
+		}
+		else {
+			t->table[i] = TINF_ENTRY_STATE(base, index);
+		}
+	}
+}
+
+/* Build fixed Huffman trees */
+static void tinf_build_fixed_trees(struct tinf_tree *lt, struct tinf_tree *dt)
+{
+	int i;
+
+	/* Build fixed literal/length tree */
+	for (i = 0; i < 16; ++i) {
+		lt->counts[i] = 0;
+	}
+
+	lt->counts[7] = 24;
+	lt->counts[8] = 152;
+	lt->counts[9] = 112;
+
+	for (i = 0; i < 24; ++i) {
+		lt->symbols[i] = 256 + i;
+	}
+	for (i = 0; i < 144; ++i) {
+		lt->symbols[24 + i] = i;
+	}
+	for (i = 0; i < 8; ++i) {
+		lt->symbols[24 + 144 + i] = 280 + i;
+	}
+	for (i = 0; i < 112; ++i) {
+		lt->symbols[24 + 144 + 8 + i] = 144 + i;
+	}
+
+	lt->max_sym = 285;
+	tinf_build_table(lt);
+
+	/* Build fixed distance tree */
+	for (i = 0; i < 16; ++i) {
+		dt->counts[i] = 0;
+	}
+
+	dt->counts[5] = 32;
+
+	for (i = 0; i < 32; ++i) {
+		dt->symbols[i] = i;
+	}
+
+	dt->max_sym = 29;
+	tinf_build_table(dt);
+}
+
 /* Given an array of code lengths, build a tree */
 static tinf_error_code tinf_build_tree(struct tinf_tree *t,
 		const unsigned char *lengths, unsigned num)
@@ -119,27 +302,52 @@ static tinf_error_code tinf_build_tree(struct tinf_tree *t,
 		t->symbols[1] = t->max_sym + 1;
 	}
 
+	/* Empty trees are never decoded, so have no table */
+	if (t->max_sym != -1) {
+		tinf_build_table(t);
+	}
+
 	return TINF_OK;
 }
 
 /* -- Decode functions -- */
 
-static void tinf_refill(struct tinf_data *d, unsigned char num)
+/*
+ * Fill tag with at least 56 bits. Once the source is exhausted, zero bits are
+ * appended and counted in padding.
+ */
+static void tinf_refill(struct tinf_data *d)
 {
-	assert(num <= 32);
+	/*
+	 * Read 8 bytes at once whilst possible. Bits above bitcount are
+	 * overwritten with the same bytes by the next refill, so only the
+	 * whole bytes that fit are counted.
+	 */
+	if (d->source_end - d->source >= 8) {
+		Uint64 v;
+
+		memcpy(&v, d->source, sizeof(v));
+		d->tag |= SDL_SwapLE64(v) << d->bitcount;
+		d->source += (63 - d->bitcount) >> 3;
+		d->bitcount |= 56;
+		return;
+	}
 
-	/* Read bytes until at least num bits available */
-	while (d->bitcount < num) {
+	while (d->bitcount < 56) {
 		if (d->source != d->source_end) {
-			d->tag |= (unsigned long) *d->source++ << d->bitcount;
+			d->tag |= (Uint64) *d->source++ << d->bitcount;
 		}
 		else {
-			d->overflow = 1;
+			d->padding += 8;
 		}
 		d->bitcount += 8;
 	}
+}
 
-	assert(d->bitcount <= 32);
+/* Check whether bits were read beyond the end of the source */
+static int tinf_overflow(const struct tinf_data *d)
+{
+	return d->bitcount < d->padding;
 }
 
 static unsigned long tinf_getbits_no_refill(struct tinf_data *d,
@@ -150,7 +358,7 @@ static unsigned long tinf_getbits_no_refill(struct tinf_data *d,
 	assert(num <= d->bitcount);
 
 	/* Get bits from tag */
-	bits = d->tag & ((1UL << num) - 1);
+	bits = (unsigned long) (d->tag & ((1ULL << num) - 1));
 
 	/* Remove bits from tag */
 	d->tag >>= num;
@@ -162,7 +370,12 @@ static unsigned long tinf_getbits_no_refill(struct tinf_data *d,
 /* Get num bits from source stream */
 static unsigned long tinf_getbits(struct tinf_data *d, unsigned char num)
 {
-	tinf_refill(d, num);
+	assert(num <= 32);
+
+	if (d->bitcount < num) {
+		tinf_refill(d);
+	}
+
 	return tinf_getbits_no_refill(d, num);
 }
 
@@ -176,9 +389,26 @@ static unsigned long tinf_getbits_base(struct tinf_data *d,
 /* Given a data stream and a tree, decode a symbol */
 static int tinf_decode_symbol(struct tinf_data *d, const struct tinf_tree *t)
 {
-	int base = 0, offs = 0;
+	Uint32 e;
+	int base, offs;
 	int len;
 
+	/* The longest code is 15 bits */
+	if (d->bitcount < 15) {
+		tinf_refill(d);
+	}
+
+	e = t->table[d->tag & (TINF_TABLE_SIZE - 1)];
+
+	if (!(e & TINF_ENTRY_LONG)) {
+		tinf_getbits_no_refill(d, e & 0xFF);
+		return (int) (e >> 8);
+	}
+
+	tinf_getbits_no_refill(d, TINF_TABLE_BITS);
+	base = (e >> 12) & 0x7FFF;
+	offs = e & 0xFFF;
+
 	/*
 	 * Get more bits while code index is above number of codes
 	 *
@@ -192,8 +422,8 @@ static int tinf_decode_symbol(struct tinf_data *d, const struct tinf_tree *t)
 	 * falls within the leaves we are done. Otherwise we adjust the range
 	 * of offs and add one more bit to it.
 	 */
-	for (len = 1; ; ++len) {
-		offs = 2 * offs + tinf_getbits(d, 1);
+	for (len = TINF_TABLE_BITS + 1; ; ++len) {
+		offs = 2 * offs + tinf_getbits_no_refill(d, 1);
 
 		assert(len <= 15);
 
@@ -216,12 +446,6 @@ static tinf_error_code tinf_decode_trees(struct tinf_data *d,
 {
 	unsigned char lengths[288 + 32];
 
-	/* Special ordering of code length codes */
-	static const unsigned char clcidx[19] = {
-		16, 17, 18, 0,  8, 7,  9, 6, 10, 5,
-		11,  4, 12, 3, 13, 2, 14, 1, 15
-	};
-
 	unsigned long hlit, hdist, hclen;
 	unsigned long i, num, length;
 	int res;
@@ -341,37 +565,21 @@ static tinf_error_code tinf_decode_trees(struct tinf_data *d,
 static tinf_error_code tinf_inflate_block_data(struct tinf_data *d,
 		struct tinf_tree *lt, struct tinf_tree *dt)
 {
-	/* Extra bits and base tables for length codes */
-	static const unsigned char length_bits[30] = {
-		0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
-		1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
-		4, 4, 4, 4, 5, 5, 5, 5, 0, 127
-	};
-
-	static const unsigned short length_base[30] = {
-		 3,  4,  5,   6,   7,   8,   9,  10,  11,  13,
-		15, 17, 19,  23,  27,  31,  35,  43,  51,  59,
-		67, 83, 99, 115, 131, 163, 195, 227, 258,   0
-	};
-
-	/* Extra bits and base tables for distance codes */
-	static const unsigned char dist_bits[30] = {
-		0, 0,  0,  0,  1,  1,  2,  2,  3,  3,
-		4, 4,  5,  5,  6,  6,  7,  7,  8,  8,
-		9, 9, 10, 10, 11, 11, 12, 12, 13, 13
-	};
-
-	static const unsigned short dist_base[30] = {
-		   1,    2,    3,    4,    5,    7,    9,    13,    17,    25,
-		  33,   49,   65,   97,  129,  193,  257,   385,   513,   769,
-		1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
-	};
-
 	for (;;) {
-		int sym = tinf_decode_symbol(d, lt);
+		int sym;
+
+		/*
+		 * A length and distance pair requires at most 48 bits, so a
+		 * single refill is enough for each symbol.
+		 */
+		if (d->bitcount < 48) {
+			tinf_refill(d);
+		}
+
+		sym = tinf_decode_symbol(d, lt);
 
 		/* Check for overflow in bit reader */
-		if (d->overflow) {
+		if (tinf_overflow(d)) {
 			return TINF_DATA_ERROR;
 		}
 
@@ -383,7 +591,8 @@ static tinf_error_code tinf_inflate_block_data(struct tinf_data *d,
 		}
 		else {
 			int length, dist, offs;
-			int i;
+			unsigned char *out;
+			const unsigned char *from;
 
 			/* Check for end of block */
 			if (sym == 256) {
@@ -420,14 +629,97 @@ static tinf_error_code tinf_inflate_block_data(struct tinf_data *d,
 				return TINF_BUF_ERROR;
 			}
 
+			out = d->dest;
+			from = out - offs;
+			d->dest += length;
+
 			/* Copy match */
-			for (i = 0; i < length; ++i) {
-				d->dest[i] = d->dest[i - offs];
+			if (offs == 1) {
+				/* Run of a single byte */
+				memset(out, *from, length);
 			}
+			else if (offs >= 8 && d->dest_end - out >= length + 8) {
+				/*
+				 * Copy whole words. The source of each word
+				 * is before its destination, and up to 7
+				 * bytes past the match are overwritten later.
+				 */
+				do {
+					memcpy(out, from, 8);
+					out += 8;
+					from += 8;
+					length -= 8;
+				} while (length > 0);
+			}
+			else {
+				while (length--) {
+					*out++ = *from++;
+				}
+			}
+		}
+	}
+}
 
-			d->dest += length;
+/* Inflate an uncompressed block of data */
+static tinf_error_code tinf_inflate_uncompressed_block(struct tinf_data *d)
+{
+	unsigned long length, invlength;
+
+	/* Skip to the next byte boundary */
+	tinf_getbits_no_refill(d, d->bitcount & 7);
+
+	/* Get length */
+	length = tinf_getbits(d, 16);
+
+	/* Get one's complement of length */
+	invlength = tinf_getbits(d, 16);
+
+	/* Check length */
+	if (length != (~invlength & 0x0000FFFF)) {
+		return TINF_DATA_ERROR;
+	}
+
+	if (tinf_overflow(d)) {
+		return TINF_DATA_ERROR;
+	}
+
+	if (d->dest_end - d->dest < (ptrdiff_t) length) {
+		return TINF_BUF_ERROR;
+	}
+
+	/* Whole bytes already read into tag are copied first */
+	while (length && d->bitcount >= 8) {
+		if (d->bitcount - 8 < d->padding) {
+			return TINF_DATA_ERROR;
 		}
+		*d->dest++ = (unsigned char) tinf_getbits_no_refill(d, 8);
+		length--;
+	}
+
+	if (d->source_end - d->source < (ptrdiff_t) length) {
+		return TINF_DATA_ERROR;
 	}
+
+	/*
+	 * Copy block. Tag may hold bytes beyond bitcount that are read
+	 * directly from the source here, so it must be cleared.
+	 */
+	memcpy(d->dest, d->source, length);
+	d->dest += length;
+	d->source += length;
+	d->tag &= ((Uint64) 1 << d->bitcount) - 1;
+
+	return TINF_OK;
+}
+
+/* Inflate a block of data compressed with fixed Huffman trees */
+static tinf_error_code tinf_inflate_fixed_block(struct tinf_data *d)
+{
+	/* Build fixed Huffman trees */
+	tinf_build_fixed_trees(&d->ltree, &d->dtree);
+
+	/* Decode block using fixed trees */
+	return tinf_inflate_block_data(d, &d->ltree, &d->dtree);
 }
 
 /* Inflate a block of data compressed with dynamic Huffman trees */
@@ -444,6 +736,486 @@ static tinf_error_code tinf_inflate_dynamic_block(struct tinf_data *d)
 	return tinf_inflate_block_data(d, &d->ltree, &d->dtree);
 }
 
+/* -- Streaming functions -- */
+
+/*
+ * Read whole bytes from the source into tag, until it holds at least 56 bits
+ * or the source is exhausted.
+ */
+static void tinf_stream_fill(struct tinf_stream *s,
+		const unsigned char **source, const unsigned char *source_end)
+{
+	if (source_end - *source >= 8) {
+		Uint64 v;
+
+		memcpy(&v, *source, sizeof(v));
+		s->tag |= SDL_SwapLE64(v) << s->bitcount;
+		*source += (63 - s->bitcount) >> 3;
+		s->bitcount |= 56;
+		return;
+	}
+
+	while (s->bitcount <= 56 && *source != source_end) {
+		s->tag |= (Uint64) *(*source)++ << s->bitcount;
+		s->bitcount += 8;
+	}
+}
+
+static void tinf_stream_drop(struct tinf_stream *s, int num)
+{
+	assert(num <= s->bitcount);
+
+	s->tag >>= num;
+	s->bitcount -= num;
+}
+
+/*
+ * Decode a symbol from the next avail bits in tag without removing them.
+ * Returns -1 if the code is longer than avail bits, otherwise the symbol with
+ * the length of its code stored in len.
+ */
+static int tinf_peek_symbol(const struct tinf_tree *t, Uint64 tag, int avail,
+		int *len)
+{
+	Uint32 e = t->table[tag & (TINF_TABLE_SIZE - 1)];
+	int base, offs;
+	int l;
+
+	if (!(e & TINF_ENTRY_LONG)) {
+		*len = e & 0xFF;
+		return *len <= avail ? (int) (e >> 8) : -1;
+	}
+
+	base = (e >> 12) & 0x7FFF;
+	offs = e & 0xFFF;
+
+	for (l = TINF_TABLE_BITS + 1; l <= 15 && l <= avail; ++l) {
+		offs = 2 * offs + (int) ((tag >> (l - 1)) & 1);
+
+		if (offs < t->counts[l]) {
+			*len = l;
+			return t->symbols[base + offs];
+		}
+
+		base += t->counts[l];
+		offs -= t->counts[l];
+	}
+
+	return -1;
+}
+
+/* Copy a match within the window */
+static void tinf_stream_match(struct tinf_stream *s, unsigned long offs,
+		unsigned long length)
+{
+	unsigned long from = (s->wpos - offs) & TINF_WINDOW_MASK;
+	unsigned long to = s->wpos;
+
+	s->wpos = (s->wpos + length) & TINF_WINDOW_MASK;
+	s->pending += length;
+	s->have += length;
+	if (s->have > TINF_WINDOW_SIZE) {
+		s->have = TINF_WINDOW_SIZE;
+	}
+
+	/* Copy at once if neither the source nor the destination wrap */
+	if (to + length <= TINF_WINDOW_SIZE
+	 && from + length <= TINF_WINDOW_SIZE) {
+		if (offs >= length) {
+			memmove(s->window + to, s->window + from, length);
+			return;
+		}
+
+		if (offs == 1) {
+			memset(s->window + to, s->window[from], length);
+			return;
+		}
+	}
+
+	while (length--) {
+		s->window[to] = s->window[from];
+		from = (from + 1) & TINF_WINDOW_MASK;
+		to = (to + 1) & TINF_WINDOW_MASK;
+	}
+}
+
+/*
+ * Decode until at least want bytes are pending in the window, the end of the
+ * stream is reached, or more input is required.
+ */
+static tinf_error_code tinf_stream_decode(struct tinf_stream *s,
+		const unsigned char **source, const unsigned char *source_end,
+		unsigned long want)
+{
+	const struct tinf_tree *lt = &s->ltree;
+	const struct tinf_tree *dt = &s->dtree;
+	tinf_error_code res;
+
+	assert(want <= TINF_WINDOW_SIZE - TINF_MAX_MATCH);
+
+	while (s->pending < want) {
+		/* Stored data is copied directly from the source */
+		if (s->mode != TINF_MODE_COPY) {
+			tinf_stream_fill(s, source, source_end);
+		}
+
+		switch (s->mode) {
+		case TINF_MODE_HEADER: {
+			unsigned long btype;
+
+			if (s->bitcount < 3) {
+				return TINF_OK;
+			}
+
+			s->bfinal = (int) (s->tag & 1);
+			btype = (s->tag >> 1) & 3;
+			tinf_stream_drop(s, 3);
+
+			if (btype == 0) {
+				/* Skip to the next byte boundary */
+				tinf_stream_drop(s, s->bitcount & 7);
+				s->mode = TINF_MODE_STORED;
+			}
+			else if (btype == 1) {
+				tinf_build_fixed_trees(&s->ltree, &s->dtree);
+				s->mode = TINF_MODE_CODES;
+			}
+			else if (btype == 2) {
+				s->mode = TINF_MODE_TREES;
+			}
+			else {
+				return TINF_DATA_ERROR;
+			}
+			break;
+		}
+
+		case TINF_MODE_STORED: {
+			unsigned long length, invlength;
+
+			if (s->bitcount < 32) {
+				return TINF_OK;
+			}
+
+			length = (unsigned long) (s->tag & 0xFFFF);
+			invlength = (unsigned long) ((s->tag >> 16) & 0xFFFF);
+			tinf_stream_drop(s, 32);
+
+			/* Check length */
+			if (length != (~invlength & 0x0000FFFF)) {
+				return TINF_DATA_ERROR;
+			}
+
+			s->stored_left = length;
+			s->mode = TINF_MODE_COPY;
+			break;
+		}
+
+		case TINF_MODE_COPY: {
+			unsigned long n;
+
+			if (s->stored_left == 0) {
+				s->mode = s->bfinal ? TINF_MODE_DONE
+				                    : TINF_MODE_HEADER;
+				break;
+			}
+
+			/* Bytes already read into tag are used first */
+			if (s->bitcount >= 8) {
+				s->window[s->wpos] = (unsigned char) s->tag;
+				s->wpos = (s->wpos + 1) & TINF_WINDOW_MASK;
+				s->pending++;
+				s->have += s->have < TINF_WINDOW_SIZE;
+				s->stored_left--;
+				tinf_stream_drop(s, 8);
+				break;
+			}
+
+			/*
+			 * Tag may hold bytes beyond bitcount that are about
+			 * to be copied directly from the source.
+			 */
+			s->tag = 0;
+
+			if (*source == source_end) {
+				return TINF_OK;
+			}
+
+			n = s->stored_left;
+			if (n > (unsigned long) (source_end - *source)) {
+				n = source_end - *source;
+			}
+			if (n > want - s->pending) {
+				n = want - s->pending;
+			}
+			if (n > TINF_WINDOW_SIZE - s->wpos) {
+				n = TINF_WINDOW_SIZE - s->wpos;
+			}
+
+			memcpy(s->window + s->wpos, *source, n);
+			*source += n;
+			s->wpos = (s->wpos + n) & TINF_WINDOW_MASK;
+			s->pending += n;
+			s->have += n;
+			if (s->have > TINF_WINDOW_SIZE) {
+				s->have = TINF_WINDOW_SIZE;
+			}
+			s->stored_left -= n;
+			break;
+		}
+
+		case TINF_MODE_TREES: {
+			unsigned i;
+
+			if (s->bitcount < 14) {
+				return TINF_OK;
+			}
+
+			/* Get 5 bits HLIT (257-286) */
+			s->hlit = 257 + (unsigned) (s->tag & 0x1F);
+
+			/* Get 5 bits HDIST (1-32) */
+			s->hdist = 1 + (unsigned) ((s->tag >> 5) & 0x1F);
+
+			/* Get 4 bits HCLEN (4-19) */
+			s->hclen = 4 + (unsigned) ((s->tag >> 10) & 0xF);
+
+			tinf_stream_drop(s, 14);
+
+			/* See tinf_decode_trees() */
+			if (s->hlit > 286 || s->hdist > 30) {
+				return TINF_DATA_ERROR;
+			}
+
+			for (i = 0; i < 19; ++i) {
+				s->lengths[i] = 0;
+			}
+
+			s->num = 0;
+			s->mode = TINF_MODE_CODELENS;
+			break;
+		}
+
+		case TINF_MODE_CODELENS:
+			/* Read code lengths for code length alphabet */
+			if (s->num < s->hclen) {
+				if (s->bitcount < 3) {
+					return TINF_OK;
+				}
+
+				s->lengths[clcidx[s->num++]] = s->tag & 7;
+				tinf_stream_drop(s, 3);
+				break;
+			}
+
+			/* Build code length tree in literal/length tree */
+			res = tinf_build_tree(&s->ltree, s->lengths, 19);
+
+			if (res != TINF_OK) {
+				return res;
+			}
+
+			if (lt->max_sym == -1) {
+				return TINF_DATA_ERROR;
+			}
+
+			s->num = 0;
+			s->mode = TINF_MODE_LENS;
+			break;
+
+		case TINF_MODE_LENS: {
+			unsigned total = s->hlit + s->hdist;
+			unsigned long length;
+			int sym, len, extra;
+
+			if (s->num == total) {
+				/* Check EOB symbol is present */
+				if (s->lengths[256] == 0) {
+					return TINF_DATA_ERROR;
+				}
+
+				/* Build dynamic trees */
+				res = tinf_build_tree(&s->ltree, s->lengths,
+				                      s->hlit);
+
+				if (res != TINF_OK) {
+					return res;
+				}
+
+				res = tinf_build_tree(&s->dtree,
+				                      s->lengths + s->hlit,
+				                      s->hdist);
+
+				if (res != TINF_OK) {
+					return res;
+				}
+
+				s->mode = TINF_MODE_CODES;
+				break;
+			}
+
+			sym = tinf_peek_symbol(lt, s->tag, s->bitcount, &len);
+
+			if (sym < 0) {
+				return TINF_OK;
+			}
+
+			if (sym > lt->max_sym) {
+				return TINF_DATA_ERROR;
+			}
+
+			extra = sym == 16 ? 2 : sym == 17 ? 3 : sym == 18 ? 7 : 0;
+
+			if (len + extra > s->bitcount) {
+				return TINF_OK;
+			}
+
+			length = (unsigned long) (s->tag >> len)
+			       & ((1UL << extra) - 1);
+			tinf_stream_drop(s, len + extra);
+
+			switch (sym) {
+			case 16:
+				/* Copy previous code length 3-6 times */
+				if (s->num == 0) {
+					return TINF_DATA_ERROR;
+				}
+				sym = s->lengths[s->num - 1];
+				length += 3;
+				break;
+			case 17:
+				/* Repeat code length 0 for 3-10 times */
+				sym = 0;
+				length += 3;
+				break;
+			case 18:
+				/* Repeat code length 0 for 11-138 times */
+				sym = 0;
+				length += 11;
+				break;
+			default:
+				length = 1;
+				break;
+			}
+
+			if (length > total - s->num) {
+				return TINF_DATA_ERROR;
+			}
+
+			while (length--) {
+				s->lengths[s->num++] = sym;
+			}
+			break;
+		}
+
+		case TINF_MODE_CODES: {
+			unsigned long length, offs;
+			int sym, len, dist, dlen, need;
+
+			sym = tinf_peek_symbol(lt, s->tag, s->bitcount, &len);
+
+			if (sym < 0) {
+				return TINF_OK;
+			}
+
+			if (sym < 256) {
+				tinf_stream_drop(s, len);
+				s->window[s->wpos] = sym;
+				s->wpos = (s->wpos + 1) & TINF_WINDOW_MASK;
+				s->pending++;
+				s->have += s->have < TINF_WINDOW_SIZE;
+				break;
+			}
+
+			/* Check for end of block */
+			if (sym == 256) {
+				tinf_stream_drop(s, len);
+				s->mode = s->bfinal ? TINF_MODE_DONE
+				                    : TINF_MODE_HEADER;
+				break;
+			}
+
+			/* Check sym is within range and distance tree is not empty */
+			if (sym > lt->max_sym || sym - 257 > 28 || dt->max_sym == -1) {
+				return TINF_DATA_ERROR;
+			}
+
+			/*
+			 * The whole match of at most 48 bits is decoded before
+			 * any bits are removed, so that it may be decoded
+			 * again once more input is available.
+			 */
+			sym -= 257;
+			need = len + length_bits[sym];
+
+			if (need > s->bitcount) {
+				return TINF_OK;
+			}
+
+			length = length_base[sym]
+			       + (unsigned long) ((s->tag >> len)
+			       & ((1UL << length_bits[sym]) - 1));
+
+			dist = tinf_peek_symbol(dt, s->tag >> need,
+			                        s->bitcount - need, &dlen);
+
+			if (dist < 0) {
+				return TINF_OK;
+			}
+
+			/* Check dist is within range */
+			if (dist > dt->max_sym || dist > 29) {
+				return TINF_DATA_ERROR;
+			}
+
+			need += dlen;
+
+			if (need + dist_bits[dist] > s->bitcount) {
+				return TINF_OK;
+			}
+
+			offs = dist_base[dist]
+			     + (unsigned long) ((s->tag >> need)
+			     & ((1UL << dist_bits[dist]) - 1));
+
+			if (offs > s->have) {
+				return TINF_DATA_ERROR;
+			}
+
+			tinf_stream_drop(s, need + dist_bits[dist]);
+			tinf_stream_match(s, offs, length);
+			break;
+		}
+
+		case TINF_MODE_DONE:
+			return TINF_OK;
+		}
+	}
+
+	return TINF_OK;
+}
+
+/* Copy pending bytes from the window to dest */
+static void tinf_stream_flush(struct tinf_stream *s, unsigned char **dest,
+		unsigned long *left)
+{
+	while (s->pending && *left) {
+		unsigned long start = (s->wpos - s->pending) & TINF_WINDOW_MASK;
+		unsigned long n = s->pending;
+
+		if (n > *left) {
+			n = *left;
+		}
+		if (n > TINF_WINDOW_SIZE - start) {
+			n = TINF_WINDOW_SIZE - start;
+		}
+
+		memcpy(*dest, s->window + start, n);
+		*dest += n;
+		*left -= n;
+		s->pending -= n;
+	}
+}
+
 /* -- Public functions -- */
 
 /* Inflate stream from source to dest */
@@ -459,7 +1231,7 @@ tinf_error_code tinf_uncompress(void *dest, unsigned long *destLen,
 	d.source_end = d.source + sourceLen;
 	d.tag = 0;
 	d.bitcount = 0;
-	d.overflow = 0;
+	d.padding = 0;
 
 	d.dest = dest;
 	d.dest_start = d.dest;
@@ -474,12 +1246,23 @@ tinf_error_code tinf_uncompress(void *dest, unsigned long *destLen,
 		/* Read block type (2 bits) */
 		btype = tinf_getbits(&d, 2);
 
-		if(btype == 2) {
+		/* Decompress block */
+		switch (btype) {
+		case 0:
+			/* Decompress uncompressed block */
+			res = tinf_inflate_uncompressed_block(&d);
+			break;
+		case 1:
+			/* Decompress block with fixed Huffman trees */
+			res = tinf_inflate_fixed_block(&d);
+			break;
+		case 2:
+			/* Decompress block with dynamic Huffman trees */
 			res = tinf_inflate_dynamic_block(&d);
-		}
-		else {
-			SDL_assert(0);
+			break;
+		default:
 			res = TINF_DATA_ERROR;
+			break;
 		}
 
 		if (res != TINF_OK) {
@@ -488,7 +1271,7 @@ tinf_error_code tinf_uncompress(void *dest, unsigned long *destLen,
 	} while (!bfinal);
 
 	/* Check for overflow in bit reader */
-	if (d.overflow) {
+	if (tinf_overflow(&d)) {
 		return TINF_DATA_ERROR;
 	}
 
@@ -497,3 +1280,100 @@ tinf_error_code tinf_uncompress(void *dest, unsigned long *destLen,
 out:
 	return res;
 }
+
+struct tinf_stream *tinf_stream_init(void)
+{
+	struct tinf_stream *s = SDL_malloc(sizeof(*s));
+
+	if (s != NULL) {
+		tinf_stream_reset(s);
+	}
+
+	return s;
+}
+
+void tinf_stream_reset(struct tinf_stream *s)
+{
+	s->tag = 0;
+	s->bitcount = 0;
+	s->mode = TINF_MODE_HEADER;
+	s->bfinal = 0;
+	s->wpos = 0;
+	s->pending = 0;
+	s->have = 0;
+}
+
+void tinf_stream_free(struct tinf_stream *s)
+{
+	SDL_free(s);
+}
+
+/* Inflate part of a stream from source to dest */
+tinf_error_code tinf_stream_uncompress(struct tinf_stream *s,
+		void *dest, unsigned long *destLen,
+		const void *source, unsigned long *sourceLen)
+{
+	const unsigned char *src = source;
+	const unsigned char *src_end = src + *sourceLen;
+	unsigned char *dst = dest;
+	unsigned long left = *destLen;
+	tinf_error_code res = TINF_OK;
+
+	for (;;) {
+		unsigned long want;
+
+		tinf_stream_flush(s, &dst, &left);
+
+		if ((left == 0 && s->pending) || s->mode == TINF_MODE_DONE) {
+			break;
+		}
+
+		/*
+		 * Decode no more than the space left for output. If there is
+		 * none, a single symbol is decoded, so that the end of the
+		 * stream is found when dest is exactly the size of the output.
+		 */
+		want = TINF_WINDOW_SIZE - TINF_MAX_MATCH;
+		if (want > left) {
+			want = left ? left : 1;
+		}
+
+		res = tinf_stream_decode(s, &src, src_end, want);
+
+		if (res != TINF_OK) {
+			goto out;
+		}
+
+		/* Stop if more input is required */
+		if (s->pending < want && s->mode != TINF_MODE_DONE) {
+			tinf_stream_flush(s, &dst, &left);
+			break;
+		}
+	}
+
+	/*
+	 * Return whole bytes in tag that were not used. Only bytes read
+	 * during this call may be returned, but bytes remaining from earlier
+	 * calls are always required to decode the next symbol.
+	 */
+	if (s->mode == TINF_MODE_DONE || left == 0) {
+		unsigned long unused = s->bitcount >> 3;
+
+		if (unused > (unsigned long) (src - (const unsigned char *) source)) {
+			unused = src - (const unsigned char *) source;
+		}
+
+		src -= unused;
+		s->bitcount -= unused * 8;
+		s->tag &= (1ULL << s->bitcount) - 1;
+	}
+
+	if (s->mode == TINF_MODE_DONE && s->pending == 0) {
+		res = TINF_DONE;
+	}
+
+out:
+	*sourceLen = src - (const unsigned char *) source;
+	*destLen = dst - (unsigned char *) dest;
+	return res;
+}
@@ -15,6 +15,7 @@
 #include <menu.h>
 #include <font.h>
 #include <ui.h>
+#include <wheel.h>
 #include <SDL.h>
 
 #define UI_OVERLAY_BG_ALPHA	0x40
@@ -24,12 +25,7 @@ struct ui_s {
 	SDL_Renderer *rend;
 };
 
-static SDL_SpinLock overlay_lock = { 0 };
-struct ui_overlay_tip {
-	ui_overlay_ctx **p;
-	ui_overlay_item_s *item;
-};
-static Uint32 ui_overlay_timeout(Uint32 interval, void *param);
+static void ui_overlay_timeout(void *param);
 
 struct ui_overlay_item {
 	struct ui_overlay_item *prev;
@@ -44,6 +40,12 @@ struct ui_overlay_item {
 	void *priv;
 
 	SDL_Texture *tex;
+
+	/* Deletes the overlay on expiry. The list is required to delete the
+	 * overlay from the timer callback. */
+	struct wheel_timer_s timeout;
+	ui_overlay_ctx **list;
+
 	struct ui_overlay_item *next;
 };
 
@@ -53,14 +55,12 @@ ui_overlay_item_s *ui_add_overlay(ui_overlay_ctx **ctx, SDL_Colour text_colour,
 		Uint8 free_text)
 {
 	ui_overlay_item_s *list;
-	ui_overlay_item_s *new = SDL_malloc(sizeof(ui_overlay_item_s));
-	struct ui_overlay_tip *tim = SDL_malloc(sizeof(struct ui_overlay_tip));
+	ui_overlay_item_s *new = SDL_calloc(1, sizeof(ui_overlay_item_s));
 
 	/* Allocate new item. */
-	if(new == NULL || tim == NULL)
+	if(new == NULL)
 		return NULL;
 
-	SDL_AtomicLock(&overlay_lock);
 	list = *ctx;
 
 	/* Obtain the last item in the linked list. */
@@ -71,9 +71,6 @@ ui_overlay_item_s *ui_add_overlay(ui_overlay_ctx **ctx, SDL_Colour text_colour,
 	{
 		/* Create a new overlay. */
 		list->next = new;
-		if(list->next == NULL)
-			goto err;
-
 		list->next->prev = list;
 		list = list->next;
 	}
@@ -83,9 +80,6 @@ ui_overlay_item_s *ui_add_overlay(ui_overlay_ctx **ctx, SDL_Colour text_colour,
 		 * the context to the first item. */
 		*ctx = new;
 		list = *ctx;
-		if(list == NULL)
-			goto err;
-
 		list->prev = NULL;
 	}
 
@@ -96,26 +90,19 @@ ui_overlay_item_s *ui_add_overlay(ui_overlay_ctx **ctx, SDL_Colour text_colour,
 	list->get_new_str = get_new_str;
 	list->priv = priv;
 	list->tex = NULL;
+	list->list = ctx;
 	list->next = NULL;
 
 	if(timeout_ms != 0)
-	{
-		tim->p = ctx;
-		tim->item = list;
-		SDL_AddTimer(timeout_ms, ui_overlay_timeout, tim);
-	}
+		wheel_add(&list->timeout, timeout_ms, ui_overlay_timeout, list);
 
-out:
-	SDL_AtomicUnlock(&overlay_lock);
 	return list;
-
-err:
-	list = NULL;
-	goto out;
 }
 
 void ui_overlay_delete(ui_overlay_ctx **p, ui_overlay_item_s *item)
 {
+	wheel_cancel(&item->timeout);
+
 	if(item->free_text)
 		SDL_free(item->text);
 
@@ -140,16 +127,10 @@ void ui_overlay_delete_all(ui_overlay_ctx **p)
 		ui_overlay_delete(p, *p);
 }
 
-Uint32 ui_overlay_timeout(Uint32 interval, void *param)
+static void ui_overlay_timeout(void *param)
 {
-	struct ui_overlay_tip *tim = param;
-	(void) interval;
-
-	SDL_AtomicLock(&overlay_lock);
-	ui_overlay_delete(tim->p, tim->item);
-	SDL_AtomicUnlock(&overlay_lock);
-	SDL_free(param);
-	return 0;
+	ui_overlay_item_s *item = param;
+	ui_overlay_delete(item->list, item);
 }
 
 int ui_overlay_render(ui_overlay_ctx **p, SDL_Renderer *rend, font_ctx *font)
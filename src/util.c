@@ -12,9 +12,23 @@
  * See the LICENSE file for more details.
  */
 
+#ifndef _WIN32
+/* Required for fileno() and fsync(). */
+#define _POSIX_C_SOURCE 200112L
+#endif
+
 #include <SDL.h>
+#include <stdio.h>
 #include <time.h>
 #include <util.h>
+#include <wheel.h>
+
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
 
 void gen_filename(char filename[atleast 64], const char *core_name,
 		  const char fmt[atleast 3])
@@ -38,36 +52,22 @@ void gen_filename(char filename[atleast 64], const char *core_name,
 }
 
 struct at_tim_s {
-	Uint32 timeout_ms;
+	struct wheel_timer_s tim;
 	SDL_atomic_t *atomic;
 	int setval;
 };
 
-static SDL_atomic_t util_exit_threads;
-
-static int util_timeout_thread(void *param)
+static void util_timeout_cb(void *param)
 {
 	struct at_tim_s *at = param;
 
-	SDL_SetThreadPriority(SDL_THREAD_PRIORITY_LOW);
-	SDL_Delay(at->timeout_ms);
-
-	if(SDL_AtomicGet(&util_exit_threads) == 0)
-		goto out;
-
 	SDL_AtomicSet(at->atomic, at->setval);
-
-out:
 	SDL_free(at);
-	return 0;
 }
 
-void set_atomic_timeout(Uint32 timeout_ms, SDL_atomic_t *atomic, int setval,
-			const char *name)
+void set_atomic_timeout(Uint32 timeout_ms, SDL_atomic_t *atomic, int setval)
 {
-	SDL_Thread *t;
-	struct at_tim_s *at = SDL_malloc(sizeof(struct at_tim_s));
-	const char *const placeholder = "Timeout";
+	struct at_tim_s *at = SDL_calloc(1, sizeof(struct at_tim_s));
 
 	SDL_assert_paranoid(timeout_ms > 0);
 	SDL_assert_paranoid(atomic != NULL);
@@ -78,41 +78,309 @@ void set_atomic_timeout(Uint32 timeout_ms, SDL_atomic_t *atomic, int setval,
 		return;
 	}
 
-	SDL_AtomicSet(&util_exit_threads, 1);
-	at->timeout_ms = timeout_ms;
 	at->atomic = atomic;
 	at->setval = setval;
+	wheel_add(&at->tim, timeout_ms, util_timeout_cb, at);
+}
 
-	if(name == NULL)
-		name = placeholder;
+#define HASH_PRIME1	0x9E3779B185EBCA87ULL
+#define HASH_PRIME2	0xC2B2AE3D27D4EB4FULL
+#define HASH_PRIME3	0x165667B19E3779F9ULL
 
-	t = SDL_CreateThread(util_timeout_thread, name, at);
-	SDL_DetachThread(t);
+static Uint64 hash_rotl(Uint64 x, unsigned r)
+{
+	return (x << r) | (x >> (64 - r));
 }
 
-void util_exit_all(void)
+static Uint64 hash_round(Uint64 acc, Uint64 in)
 {
-	SDL_AtomicSet(&util_exit_threads, 0);
-	return;
+	acc += in * HASH_PRIME2;
+	acc = hash_rotl(acc, 31);
+	return acc * HASH_PRIME1;
 }
 
-SDL_Surface *util_tex_to_surf(SDL_Renderer *rend, SDL_Texture *tex,
-			      const SDL_Rect *const src,
-			      const SDL_RendererFlip flip)
+/* Compilers combine this into a single unaligned load where supported. */
+static Uint64 hash_read64(const Uint8 *p)
+{
+	return (Uint64)p[0] | ((Uint64)p[1] << 8) | ((Uint64)p[2] << 16) |
+		((Uint64)p[3] << 24) | ((Uint64)p[4] << 32) |
+		((Uint64)p[5] << 40) | ((Uint64)p[6] << 48) |
+		((Uint64)p[7] << 56);
+}
+
+Uint64 util_hash(const void *data, size_t len, Uint64 seed)
+{
+	const Uint8 *p = data;
+	const Uint8 *const end = p + len;
+	Uint64 h;
+
+	/* Four independent lanes are used so that the multiplications may be
+	 * executed in parallel by the CPU. */
+	if(len >= 32)
+	{
+		Uint64 v1 = seed + HASH_PRIME1 + HASH_PRIME2;
+		Uint64 v2 = seed + HASH_PRIME2;
+		Uint64 v3 = seed;
+		Uint64 v4 = seed - HASH_PRIME1;
+
+		do {
+			v1 = hash_round(v1, hash_read64(p));
+			v2 = hash_round(v2, hash_read64(p + 8));
+			v3 = hash_round(v3, hash_read64(p + 16));
+			v4 = hash_round(v4, hash_read64(p + 24));
+			p += 32;
+		} while(end - p >= 32);
+
+		h = hash_rotl(v1, 1) + hash_rotl(v2, 7) + hash_rotl(v3, 12) +
+			hash_rotl(v4, 18);
+	}
+	else
+	{
+		h = seed + HASH_PRIME3;
+	}
+
+	h += (Uint64)len;
+
+	while(end - p >= 8)
+	{
+		h ^= hash_round(0, hash_read64(p));
+		h = hash_rotl(h, 27) * HASH_PRIME1 + HASH_PRIME3;
+		p += 8;
+	}
+
+	while(p < end)
+	{
+		h ^= (*p) * HASH_PRIME3;
+		h = hash_rotl(h, 11) * HASH_PRIME1;
+		p++;
+	}
+
+	/* Final mix so that all input bits affect all output bits. */
+	h ^= h >> 33;
+	h *= HASH_PRIME2;
+	h ^= h >> 29;
+	h *= HASH_PRIME3;
+	h ^= h >> 32;
+
+	return h;
+}
+
+/* Tables for calculating CRC-32 eight bytes at a time. crc_table[0] is the
+ * usual byte-wise table, and crc_table[k] advances a byte by k further zero
+ * bytes. */
+static Uint32 crc_table[8][256];
+static SDL_atomic_t crc_table_ready;
+static SDL_SpinLock crc_table_lock;
+
+static void crc_init(void)
+{
+	unsigned i, k;
+
+	if(SDL_AtomicGet(&crc_table_ready))
+		return;
+
+	SDL_AtomicLock(&crc_table_lock);
+	if(SDL_AtomicGet(&crc_table_ready))
+		goto out;
+
+	for(i = 0; i < 256; i++)
+	{
+		Uint32 c = i;
+
+		for(k = 0; k < 8; k++)
+			c = (c >> 1) ^ (0xEDB88320 & (0 - (c & 1)));
+
+		crc_table[0][i] = c;
+	}
+
+	for(i = 0; i < 256; i++)
+	{
+		for(k = 1; k < 8; k++)
+		{
+			Uint32 c = crc_table[k - 1][i];
+			crc_table[k][i] = (c >> 8) ^ crc_table[0][c & 0xFF];
+		}
+	}
+
+	SDL_AtomicSet(&crc_table_ready, 1);
+
+out:
+	SDL_AtomicUnlock(&crc_table_lock);
+}
+
+static Uint32 crc_read32(const Uint8 *p)
+{
+	return (Uint32)p[0] | ((Uint32)p[1] << 8) | ((Uint32)p[2] << 16) |
+		((Uint32)p[3] << 24);
+}
+
+Uint32 util_crc32(const void *data, size_t len, Uint32 crc)
+{
+	const Uint8 *p = data;
+
+	crc_init();
+	crc = ~crc;
+
+	/* Slice-by-8: each byte of a word is looked up in a separate table,
+	 * so that the lookups do not depend on each other. */
+	while(len >= 8)
+	{
+		Uint32 lo = crc ^ crc_read32(p);
+		Uint32 hi = crc_read32(p + 4);
+
+		crc = crc_table[7][lo & 0xFF] ^
+			crc_table[6][(lo >> 8) & 0xFF] ^
+			crc_table[5][(lo >> 16) & 0xFF] ^
+			crc_table[4][lo >> 24] ^
+			crc_table[3][hi & 0xFF] ^
+			crc_table[2][(hi >> 8) & 0xFF] ^
+			crc_table[1][(hi >> 16) & 0xFF] ^
+			crc_table[0][hi >> 24];
+		p += 8;
+		len -= 8;
+	}
+
+	while(len--)
+		crc = (crc >> 8) ^ crc_table[0][(crc ^ *p++) & 0xFF];
+
+	return ~crc;
+}
+
+SDL_bool util_has_ext(const char *filename, const char *exts)
+{
+	const char *ext;
+	size_t ext_len;
+
+	if(filename == NULL || exts == NULL)
+		return SDL_FALSE;
+
+	ext = SDL_strrchr(filename, '.');
+	if(ext == NULL || SDL_strchr(ext, '/') != NULL ||
+	   SDL_strchr(ext, '\\') != NULL)
+		return SDL_FALSE;
+
+	ext++;
+	ext_len = SDL_strlen(ext);
+
+	while(*exts != '\0')
+	{
+		const char *end = SDL_strchr(exts, '|');
+		size_t len = end != NULL ? (size_t)(end - exts) :
+			SDL_strlen(exts);
+
+		if(len == ext_len && SDL_strncasecmp(ext, exts, len) == 0)
+			return SDL_TRUE;
+
+		if(end == NULL)
+			break;
+
+		exts = end + 1;
+	}
+
+	return SDL_FALSE;
+}
+
+char *util_replace_ext(const char *filename, const char *ext)
+{
+	const char *dot = SDL_strrchr(filename, '.');
+	size_t base_len, ext_len;
+	char *path;
+
+	/* A dot within a directory name is not an extension. */
+	if(dot != NULL && (SDL_strchr(dot, '/') != NULL ||
+		SDL_strchr(dot, '\\') != NULL))
+		dot = NULL;
+
+	base_len = dot != NULL ? (size_t)(dot - filename) :
+		SDL_strlen(filename);
+	ext_len = SDL_strlen(ext) + 1;
+	path = SDL_malloc(base_len + ext_len);
+	if(path == NULL)
+	{
+		SDL_OutOfMemory();
+		return NULL;
+	}
+
+	SDL_memcpy(path, filename, base_len);
+	SDL_memcpy(path + base_len, ext, ext_len);
+	return path;
+}
+
+int util_write_file(const char *filename, const void *data, size_t len)
+{
+	FILE *f;
+	char *tmp;
+	size_t tmp_len = SDL_strlen(filename) + sizeof(".tmp");
+	int ret = -1;
+
+	tmp = SDL_malloc(tmp_len);
+	if(tmp == NULL)
+		return SDL_OutOfMemory();
+
+	SDL_snprintf(tmp, tmp_len, "%s.tmp", filename);
+
+	f = fopen(tmp, "wb");
+	if(f == NULL)
+	{
+		SDL_SetError("Unable to open %s", tmp);
+		goto out;
+	}
+
+	/* The data must reach the disk before the rename does, else the file
+	 * may be empty after a crash of the system. */
+	if((len != 0 && fwrite(data, len, 1, f) != 1) || fflush(f) != 0 ||
+#ifdef _WIN32
+	   _commit(_fileno(f)) != 0)
+#else
+	   fsync(fileno(f)) != 0)
+#endif
+	{
+		SDL_SetError("Unable to write %s", tmp);
+		fclose(f);
+		remove(tmp);
+		goto out;
+	}
+
+	if(fclose(f) != 0)
+	{
+		SDL_SetError("Unable to write %s", tmp);
+		remove(tmp);
+		goto out;
+	}
+
+#ifdef _WIN32
+	if(MoveFileExA(tmp, filename, MOVEFILE_REPLACE_EXISTING) == 0)
+#else
+	if(rename(tmp, filename) != 0)
+#endif
+	{
+		SDL_SetError("Unable to replace %s", filename);
+		remove(tmp);
+		goto out;
+	}
+
+	ret = 0;
+
+out:
+	SDL_free(tmp);
+	return ret;
+}
+
+int util_tex_read(SDL_Renderer *rend, SDL_Texture *tex,
+		  const SDL_Rect *const src, const SDL_RendererFlip flip,
+		  Uint32 fmt, void *pixels, int pitch)
 {
 	SDL_Texture *core_tex;
-	SDL_Surface *surf = NULL;
-	int fmt = SDL_PIXELFORMAT_RGB24;
-	/* TODO: Use native format of renderer. */
+	int ret = -1;
 
 	if(src->w <= 0 || src->h <= 0)
-		return NULL;
+		return SDL_SetError("Invalid texture area");
 
 	/* TODO: Can be optimised if no flipping is required. */
 	core_tex = SDL_CreateTexture(rend, fmt, SDL_TEXTUREACCESS_TARGET,
 				     src->w, src->h);
 	if(core_tex == NULL)
-		return NULL;
+		return -1;
 
 	if(SDL_SetRenderTarget(rend, core_tex) != 0)
 		goto err;
@@ -124,20 +392,37 @@ SDL_Surface *util_tex_to_surf(SDL_Renderer *rend, SDL_Texture *tex,
 	if(SDL_RenderCopyEx(rend, tex, src, src, 0.0, NULL, flip) != 0)
 		goto err;
 
+	ret = SDL_RenderReadPixels(rend, src, fmt, pixels, pitch);
+
+err:
+	SDL_SetRenderTarget(rend, NULL);
+	SDL_DestroyTexture(core_tex);
+	return ret;
+}
+
+SDL_Surface *util_tex_to_surf(SDL_Renderer *rend, SDL_Texture *tex,
+			      const SDL_Rect *const src,
+			      const SDL_RendererFlip flip)
+{
+	SDL_Surface *surf;
+	Uint32 fmt = SDL_PIXELFORMAT_RGB24;
+	/* TODO: Use native format of renderer. */
+
+	if(src->w <= 0 || src->h <= 0)
+		return NULL;
+
 	surf = SDL_CreateRGBSurfaceWithFormat(0, src->w, src->h,
 					      SDL_BITSPERPIXEL(fmt), fmt);
 	if(surf == NULL)
-		goto err;
+		return NULL;
 
 	/* TODO: Convert format (if required) in new thread. */
-	if(SDL_RenderReadPixels(rend, src, fmt, surf->pixels, surf->pitch) != 0)
+	if(util_tex_read(rend, tex, src, flip, fmt, surf->pixels,
+			 surf->pitch) != 0)
 	{
 		SDL_FreeSurface(surf);
-		goto err;
+		return NULL;
 	}
 
-err:
-	SDL_SetRenderTarget(rend, NULL);
-	SDL_DestroyTexture(core_tex);
 	return surf;
 }
@@ -0,0 +1,715 @@
+/**
+ * Libretro virtual file system interface.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#if defined(__linux__)
+#define _GNU_SOURCE
+#endif
+
+#ifndef _WIN32
+#define _FILE_OFFSET_BITS 64
+#endif
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#include <io.h>
+#include <windows.h>
+#define vfs_fseek(f, off)	_fseeki64(f, off, SEEK_SET)
+#define vfs_ftell(f)		_ftelli64(f)
+#else
+#include <dirent.h>
+#include <unistd.h>
+#define vfs_fseek(f, off)	fseeko(f, (off_t)(off), SEEK_SET)
+#define vfs_ftell(f)		((Sint64)ftello(f))
+#endif
+
+#include <SDL.h>
+#include <fmap.h>
+#include <libretro.h>
+#include <vfs.h>
+
+struct retro_vfs_file_handle
+{
+	/* Path exactly as given by the core. */
+	char *path;
+	unsigned mode;
+
+	/* Files that are only read are mapped into memory where possible. */
+	fmap_ctx *map;
+
+	/* Otherwise, reads are served from a cache of the file that is read
+	 * ahead of the current position. */
+	FILE *f;
+	Uint8 *cache;
+	Sint64 cache_off;
+	size_t cache_len;
+
+	/* Position of f after the last read, or -1 if it must be seeked
+	 * before reading. Files that cannot be seeked, such as pipes, are
+	 * then still read in order. */
+	Sint64 fpos;
+
+	Sint64 pos;
+	Sint64 size;
+
+	struct vfs_stats_s stats;
+};
+
+struct retro_vfs_dir_handle
+{
+	char *path;
+	bool include_hidden;
+
+	/* Name of the last entry read, or NULL if none has been read. */
+	const char *name;
+#ifdef _WIN32
+	HANDLE find;
+	WIN32_FIND_DATAA fd;
+	SDL_bool first;
+#else
+	DIR *d;
+#endif
+};
+
+/* Statistics of files that have been closed. Files may be closed by threads
+ * of the core. */
+static struct vfs_stats_s vfs_totals;
+static SDL_SpinLock vfs_totals_lock;
+
+static void vfs_add_stats(struct vfs_stats_s *dst,
+			  const struct vfs_stats_s *src)
+{
+	unsigned i;
+
+	dst->reads += src->reads;
+	dst->read_bytes += src->read_bytes;
+	dst->misses += src->misses;
+	dst->writes += src->writes;
+	dst->write_bytes += src->write_bytes;
+	dst->read_us += src->read_us;
+	dst->max_read_us = SDL_max(dst->max_read_us, src->max_read_us);
+	dst->slow_reads += src->slow_reads;
+
+	for(i = 0; i < VFS_LATENCY_BUCKETS; i++)
+		dst->latency[i] += src->latency[i];
+}
+
+static void vfs_add_latency(struct vfs_stats_s *st, Uint64 beg)
+{
+	Uint64 us = (SDL_GetPerformanceCounter() - beg) * 1000000 /
+		SDL_GetPerformanceFrequency();
+	unsigned bucket = 0;
+
+	while(bucket < VFS_LATENCY_BUCKETS - 1 && us >= (1ULL << bucket))
+		bucket++;
+
+	st->latency[bucket]++;
+	st->read_us += us;
+
+	if(us > st->max_read_us)
+		st->max_read_us = (Uint32)SDL_min(us, 0xFFFFFFFF);
+
+	if(us > VFS_SLOW_READ_US)
+		st->slow_reads++;
+}
+
+void vfs_log_stats(const char *name, const struct vfs_stats_s *st)
+{
+	char hist[VFS_LATENCY_BUCKETS * 16] = "";
+	unsigned i;
+
+	if(st->reads == 0 && st->writes == 0)
+		return;
+
+	for(i = 0; i < VFS_LATENCY_BUCKETS; i++)
+	{
+		size_t len = SDL_strlen(hist);
+
+		if(st->latency[i] == 0)
+			continue;
+
+		if(i < VFS_LATENCY_BUCKETS - 1)
+		{
+			SDL_snprintf(hist + len, sizeof(hist) - len,
+				     " <%luus:%u", 1UL << i, st->latency[i]);
+		}
+		else
+		{
+			SDL_snprintf(hist + len, sizeof(hist) - len,
+				     " >=%luus:%u", 1UL << (i - 1),
+				     st->latency[i]);
+		}
+	}
+
+	SDL_LogVerbose(SDL_LOG_CATEGORY_APPLICATION,
+		       "VFS %s: %lu reads of %lu KiB (%lu cache misses), "
+		       "%lu writes of %lu KiB, %lu us mean, %u us max",
+		       name, (unsigned long)st->reads,
+		       (unsigned long)(st->read_bytes / 1024),
+		       (unsigned long)st->misses, (unsigned long)st->writes,
+		       (unsigned long)(st->write_bytes / 1024),
+		       (unsigned long)(st->reads != 0 ?
+				       st->read_us / st->reads : 0),
+		       st->max_read_us);
+
+	if(hist[0] != '\0')
+	{
+		SDL_LogVerbose(SDL_LOG_CATEGORY_APPLICATION,
+			       "VFS %s read latency:%s", name, hist);
+	}
+
+	if(st->slow_reads != 0)
+	{
+		SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+			    "%u reads of %s took longer than %u us, and may "
+			    "have delayed frames", st->slow_reads, name,
+			    VFS_SLOW_READ_US);
+	}
+}
+
+void vfs_get_file_stats(const struct retro_vfs_file_handle *stream,
+			struct vfs_stats_s *st)
+{
+	*st = stream->stats;
+}
+
+void vfs_get_stats(struct vfs_stats_s *st)
+{
+	SDL_AtomicLock(&vfs_totals_lock);
+	*st = vfs_totals;
+	SDL_AtomicUnlock(&vfs_totals_lock);
+}
+
+static const char *RETRO_CALLCONV vfs_get_path(
+	struct retro_vfs_file_handle *stream)
+{
+	return stream->path;
+}
+
+static int RETRO_CALLCONV vfs_close(struct retro_vfs_file_handle *stream);
+
+/**
+ * Open a file with stdio. Files that are updated are created if they do not
+ * exist.
+ */
+static FILE *vfs_fopen(const char *path, unsigned mode)
+{
+	const char *mode_str;
+	FILE *f;
+
+	if((mode & RETRO_VFS_FILE_ACCESS_READ_WRITE) ==
+		RETRO_VFS_FILE_ACCESS_READ)
+		mode_str = "rb";
+	else if(mode & RETRO_VFS_FILE_ACCESS_UPDATE_EXISTING)
+		mode_str = "r+b";
+	else if(mode & RETRO_VFS_FILE_ACCESS_READ)
+		mode_str = "w+b";
+	else
+		mode_str = "wb";
+
+	f = fopen(path, mode_str);
+	if(f == NULL && (mode & RETRO_VFS_FILE_ACCESS_UPDATE_EXISTING))
+		f = fopen(path, "w+b");
+
+	return f;
+}
+
+static struct retro_vfs_file_handle *RETRO_CALLCONV vfs_open(
+	const char *path, unsigned mode, unsigned hints)
+{
+	struct retro_vfs_file_handle *h;
+
+	if(path == NULL || (mode & RETRO_VFS_FILE_ACCESS_READ_WRITE) == 0)
+		return NULL;
+
+	h = SDL_calloc(1, sizeof(*h));
+	if(h == NULL)
+		return NULL;
+
+	h->mode = mode;
+	h->path = SDL_strdup(path);
+	if(h->path == NULL)
+		goto err;
+
+	/* Files that are only read are mapped, so that reads are a copy from
+	 * the page cache. Only regular files that are not empty are mapped,
+	 * as devices, pipes and the files of procfs have no meaningful size
+	 * and are read with stdio instead. */
+	if((mode & RETRO_VFS_FILE_ACCESS_READ_WRITE) ==
+		RETRO_VFS_FILE_ACCESS_READ)
+	{
+		unsigned flags = FMAP_FLAG_MAP_ONLY;
+
+		if(hints & RETRO_VFS_FILE_ACCESS_HINT_FREQUENT_ACCESS)
+			flags |= FMAP_FLAG_WILLNEED;
+
+		h->map = fmap_open(path, flags);
+		if(h->map != NULL && fmap_size(h->map) != 0)
+		{
+			h->size = (Sint64)fmap_size(h->map);
+			return h;
+		}
+
+		fmap_close(h->map);
+		h->map = NULL;
+	}
+
+	h->f = vfs_fopen(path, mode);
+	if(h->f == NULL)
+		goto err;
+
+	/* The size of pipes is unknown, so they are treated as empty. */
+	if(fseek(h->f, 0, SEEK_END) == 0 && (h->size = vfs_ftell(h->f)) >= 0)
+		h->fpos = -1;
+	else if(errno == ESPIPE)
+		h->size = 0;
+	else
+		goto err;
+
+	if(mode & RETRO_VFS_FILE_ACCESS_READ)
+	{
+		h->cache = SDL_malloc(VFS_CACHE_SIZE);
+		if(h->cache == NULL)
+			goto err;
+	}
+
+	return h;
+
+err:
+	vfs_close(h);
+	return NULL;
+}
+
+static int RETRO_CALLCONV vfs_close(struct retro_vfs_file_handle *stream)
+{
+	int ret = 0;
+
+	if(stream == NULL)
+		return -1;
+
+	if(stream->path != NULL)
+		vfs_log_stats(stream->path, &stream->stats);
+
+	SDL_AtomicLock(&vfs_totals_lock);
+	vfs_add_stats(&vfs_totals, &stream->stats);
+	SDL_AtomicUnlock(&vfs_totals_lock);
+
+	fmap_close(stream->map);
+
+	if(stream->f != NULL && fclose(stream->f) != 0)
+		ret = -1;
+
+	SDL_free(stream->cache);
+	SDL_free(stream->path);
+	SDL_free(stream);
+
+	return ret;
+}
+
+static int64_t RETRO_CALLCONV vfs_size(struct retro_vfs_file_handle *stream)
+{
+	return stream->size;
+}
+
+static int64_t RETRO_CALLCONV vfs_tell(struct retro_vfs_file_handle *stream)
+{
+	return stream->pos;
+}
+
+static int64_t RETRO_CALLCONV vfs_seek(struct retro_vfs_file_handle *stream,
+				       int64_t offset, int seek_position)
+{
+	Sint64 pos;
+
+	switch(seek_position)
+	{
+	case RETRO_VFS_SEEK_POSITION_START:
+		pos = offset;
+		break;
+
+	case RETRO_VFS_SEEK_POSITION_CURRENT:
+		pos = stream->pos + offset;
+		break;
+
+	case RETRO_VFS_SEEK_POSITION_END:
+		pos = stream->size + offset;
+		break;
+
+	default:
+		return -1;
+	}
+
+	if(pos < 0)
+		return -1;
+
+	/* The file is only seeked once it is read or written. */
+	stream->pos = pos;
+	return pos;
+}
+
+/**
+ * Read from the read-ahead cache, filling it from the file when the position
+ * is outside of it. Reads larger than the cache bypass it.
+ */
+static Sint64 vfs_read_cached(struct retro_vfs_file_handle *stream,
+			      Uint8 *dst, Uint64 len)
+{
+	Uint64 done = 0;
+
+	while(done < len)
+	{
+		size_t n;
+
+		if(stream->pos >= stream->cache_off &&
+			stream->pos < stream->cache_off +
+				(Sint64)stream->cache_len)
+		{
+			size_t off = (size_t)(stream->pos - stream->cache_off);
+
+			n = (size_t)SDL_min(len - done,
+					    stream->cache_len - off);
+			SDL_memcpy(dst + done, stream->cache + off, n);
+			done += n;
+			stream->pos += n;
+			continue;
+		}
+
+		stream->stats.misses++;
+		if(stream->fpos != stream->pos &&
+			vfs_fseek(stream->f, stream->pos) != 0)
+			break;
+
+		if(len - done >= VFS_CACHE_SIZE)
+		{
+			n = fread(dst + done, 1, (size_t)(len - done),
+				  stream->f);
+			done += n;
+			stream->pos += n;
+			stream->fpos = stream->pos;
+			break;
+		}
+
+		n = fread(stream->cache, 1, VFS_CACHE_SIZE, stream->f);
+		stream->cache_off = stream->pos;
+		stream->cache_len = n;
+		stream->fpos = stream->pos + (Sint64)n;
+
+		/* End of file. */
+		if(n == 0)
+			break;
+	}
+
+	if(done == 0 && len != 0 && ferror(stream->f))
+	{
+		clearerr(stream->f);
+		return -1;
+	}
+
+	return (Sint64)done;
+}
+
+static int64_t RETRO_CALLCONV vfs_read(struct retro_vfs_file_handle *stream,
+				       void *s, uint64_t len)
+{
+	Uint64 beg = SDL_GetPerformanceCounter();
+	Sint64 ret;
+
+	if((stream->mode & RETRO_VFS_FILE_ACCESS_READ) == 0)
+		return -1;
+
+	if(stream->map != NULL)
+	{
+		Uint64 avail = stream->pos < stream->size ?
+			(Uint64)(stream->size - stream->pos) : 0;
+
+		ret = (Sint64)SDL_min(len, avail);
+		if(ret > 0)
+		{
+			SDL_memcpy(s, fmap_data(stream->map) + stream->pos,
+				   (size_t)ret);
+		}
+
+		stream->pos += ret;
+	}
+	else
+	{
+		ret = vfs_read_cached(stream, s, len);
+	}
+
+	if(ret < 0)
+		return ret;
+
+	stream->stats.reads++;
+	stream->stats.read_bytes += (Uint64)ret;
+	vfs_add_latency(&stream->stats, beg);
+
+	return ret;
+}
+
+static int64_t RETRO_CALLCONV vfs_write(struct retro_vfs_file_handle *stream,
+					const void *s, uint64_t len)
+{
+	size_t n;
+
+	if(stream->f == NULL ||
+		(stream->mode & RETRO_VFS_FILE_ACCESS_WRITE) == 0)
+		return -1;
+
+	/* The cache is simply dropped, as cores seldom read what they have
+	 * just written. */
+	stream->cache_len = 0;
+
+	/* A seek is required between writing and reading. */
+	stream->fpos = -1;
+	if(vfs_fseek(stream->f, stream->pos) != 0)
+		return -1;
+
+	n = fwrite(s, 1, (size_t)len, stream->f);
+	if(n == 0 && len != 0)
+		return -1;
+
+	stream->pos += n;
+	stream->size = SDL_max(stream->size, stream->pos);
+	stream->stats.writes++;
+	stream->stats.write_bytes += n;
+
+	return (Sint64)n;
+}
+
+static int RETRO_CALLCONV vfs_flush(struct retro_vfs_file_handle *stream)
+{
+	if(stream->f == NULL)
+		return 0;
+
+	return fflush(stream->f) == 0 ? 0 : -1;
+}
+
+static int64_t RETRO_CALLCONV vfs_truncate(
+	struct retro_vfs_file_handle *stream, int64_t length)
+{
+	int ret;
+
+	if(stream->f == NULL || length < 0 || fflush(stream->f) != 0)
+		return -1;
+
+#ifdef _WIN32
+	ret = _chsize_s(_fileno(stream->f), length);
+#else
+	ret = ftruncate(fileno(stream->f), (off_t)length);
+#endif
+	if(ret != 0)
+		return -1;
+
+	stream->size = length;
+	stream->cache_len = 0;
+	stream->fpos = -1;
+	return 0;
+}
+
+static int RETRO_CALLCONV vfs_remove(const char *path)
+{
+	return remove(path) == 0 ? 0 : -1;
+}
+
+static int RETRO_CALLCONV vfs_rename(const char *old_path,
+				     const char *new_path)
+{
+	return rename(old_path, new_path) == 0 ? 0 : -1;
+}
+
+static int RETRO_CALLCONV vfs_stat(const char *path, int32_t *size)
+{
+	struct stat st;
+	int flags = RETRO_VFS_STAT_IS_VALID;
+
+	if(stat(path, &st) != 0)
+		return 0;
+
+	if((st.st_mode & S_IFMT) == S_IFDIR)
+		flags |= RETRO_VFS_STAT_IS_DIRECTORY;
+	else if((st.st_mode & S_IFMT) == S_IFCHR)
+		flags |= RETRO_VFS_STAT_IS_CHARACTER_SPECIAL;
+
+	if(size != NULL)
+		*size = (int32_t)SDL_min(st.st_size, SDL_MAX_SINT32);
+
+	return flags;
+}
+
+static int RETRO_CALLCONV vfs_mkdir(const char *dir)
+{
+#ifdef _WIN32
+	if(_mkdir(dir) == 0)
+#else
+	if(mkdir(dir, 0755) == 0)
+#endif
+		return 0;
+
+	return errno == EEXIST ? -2 : -1;
+}
+
+static int RETRO_CALLCONV vfs_closedir(struct retro_vfs_dir_handle *dirstream)
+{
+	if(dirstream == NULL)
+		return -1;
+
+#ifdef _WIN32
+	if(dirstream->find != INVALID_HANDLE_VALUE)
+		FindClose(dirstream->find);
+#else
+	if(dirstream->d != NULL)
+		closedir(dirstream->d);
+#endif
+
+	SDL_free(dirstream->path);
+	SDL_free(dirstream);
+	return 0;
+}
+
+static struct retro_vfs_dir_handle *RETRO_CALLCONV vfs_opendir(
+	const char *dir, bool include_hidden)
+{
+	struct retro_vfs_dir_handle *h;
+#ifdef _WIN32
+	char pattern[MAX_PATH];
+#endif
+
+	h = SDL_calloc(1, sizeof(*h));
+	if(h == NULL)
+		return NULL;
+
+	h->include_hidden = include_hidden;
+	h->path = SDL_strdup(dir);
+	if(h->path == NULL)
+		goto err;
+
+#ifdef _WIN32
+	SDL_snprintf(pattern, sizeof(pattern), "%s\\*", dir);
+	h->find = FindFirstFileA(pattern, &h->fd);
+	h->first = SDL_TRUE;
+	if(h->find == INVALID_HANDLE_VALUE)
+		goto err;
+#else
+	h->d = opendir(dir);
+	if(h->d == NULL)
+		goto err;
+#endif
+
+	return h;
+
+err:
+	vfs_closedir(h);
+	return NULL;
+}
+
+static bool RETRO_CALLCONV vfs_readdir(struct retro_vfs_dir_handle *dirstream)
+{
+	for(;;)
+	{
+		const char *name;
+		SDL_bool hidden;
+
+#ifdef _WIN32
+		if(!dirstream->first && !FindNextFileA(dirstream->find,
+							&dirstream->fd))
+			return false;
+
+		dirstream->first = SDL_FALSE;
+		name = dirstream->fd.cFileName;
+		hidden = (dirstream->fd.dwFileAttributes &
+			  FILE_ATTRIBUTE_HIDDEN) != 0;
+#else
+		struct dirent *de = readdir(dirstream->d);
+
+		if(de == NULL)
+			return false;
+
+		name = de->d_name;
+		hidden = name[0] == '.';
+#endif
+
+		if(SDL_strcmp(name, ".") == 0 || SDL_strcmp(name, "..") == 0)
+			continue;
+
+		if(hidden && !dirstream->include_hidden)
+			continue;
+
+		dirstream->name = name;
+		return true;
+	}
+}
+
+static const char *RETRO_CALLCONV vfs_dirent_get_name(
+	struct retro_vfs_dir_handle *dirstream)
+{
+	return dirstream->name;
+}
+
+static bool RETRO_CALLCONV vfs_dirent_is_dir(
+	struct retro_vfs_dir_handle *dirstream)
+{
+#ifdef _WIN32
+	return dirstream->name != NULL &&
+		(dirstream->fd.dwFileAttributes &
+		 FILE_ATTRIBUTE_DIRECTORY) != 0;
+#else
+	char *path;
+	size_t len;
+	int flags;
+
+	if(dirstream->name == NULL)
+		return false;
+
+	len = SDL_strlen(dirstream->path) + SDL_strlen(dirstream->name) + 2;
+	path = SDL_malloc(len);
+	if(path == NULL)
+		return false;
+
+	SDL_snprintf(path, len, "%s/%s", dirstream->path, dirstream->name);
+	flags = vfs_stat(path, NULL);
+	SDL_free(path);
+
+	return (flags & RETRO_VFS_STAT_IS_DIRECTORY) != 0;
+#endif
+}
+
+int vfs_get_interface(struct retro_vfs_interface_info *info)
+{
+	static struct retro_vfs_interface iface = {
+		vfs_get_path, vfs_open, vfs_close, vfs_size, vfs_tell,
+		vfs_seek, vfs_read, vfs_write, vfs_flush, vfs_remove,
+		vfs_rename, vfs_truncate, vfs_stat, vfs_mkdir, vfs_opendir,
+		vfs_readdir, vfs_dirent_get_name, vfs_dirent_is_dir,
+		vfs_closedir
+	};
+
+	if(info->required_interface_version > VFS_INTERFACE_VERSION)
+	{
+		SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION,
+			    "Core requires VFS interface version %u, but only "
+			    "version %u is supported",
+			    info->required_interface_version,
+			    VFS_INTERFACE_VERSION);
+		return -1;
+	}
+
+	info->required_interface_version = VFS_INTERFACE_VERSION;
+	info->iface = &iface;
+	return 0;
+}
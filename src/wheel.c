@@ -0,0 +1,170 @@
+/**
+ * Hierarchical timer wheel.
+ * Copyright (C) 2020  Mahyar Koshkouei
+ *
+ * This is free software, and you are welcome to redistribute it under the terms
+ * of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.
+ *
+ * See the LICENSE file for more details.
+ */
+
+#include <SDL.h>
+#include <wheel.h>
+
+/* Each level holds 64 slots, with each slot of a level covering the whole
+ * range of the level below it. Four levels cover timeouts of up to 4.6 hours
+ * at millisecond resolution. Longer timeouts are cascaded again on each
+ * revolution of the last level. */
+#define WHEEL_BITS	6
+#define WHEEL_SLOTS	(1 << WHEEL_BITS)
+#define WHEEL_MASK	(WHEEL_SLOTS - 1)
+#define WHEEL_LEVELS	4
+#define WHEEL_MAX	((Uint64)1 << (WHEEL_BITS * WHEEL_LEVELS))
+
+static struct {
+	struct wheel_timer_s *slot[WHEEL_LEVELS][WHEEL_SLOTS];
+	Uint64 now;
+	Uint32 pending;
+} wheel;
+
+static void wheel_link(struct wheel_timer_s **head, struct wheel_timer_s *t)
+{
+	t->next = *head;
+	if(t->next != NULL)
+		t->next->pprev = &t->next;
+
+	*head = t;
+	t->pprev = head;
+}
+
+static void wheel_unlink(struct wheel_timer_s *t)
+{
+	*t->pprev = t->next;
+	if(t->next != NULL)
+		t->next->pprev = t->pprev;
+
+	t->next = NULL;
+	t->pprev = NULL;
+}
+
+/**
+ * Place the timer within the level that covers its expiry time.
+ */
+static void wheel_insert(struct wheel_timer_s *t)
+{
+	Uint64 delta;
+	unsigned lvl;
+
+	/* Timers further than the wheel can hold are placed in the last
+	 * level by their real expiry time. The slot is cascaded once every
+	 * WHEEL_MAX milliseconds, placing the timer back within the same
+	 * slot until it is within range. */
+	delta = t->expire - wheel.now;
+	for(lvl = 0; lvl < WHEEL_LEVELS - 1; lvl++)
+	{
+		if(delta < ((Uint64)1 << (WHEEL_BITS * (lvl + 1))))
+			break;
+	}
+
+	wheel_link(&wheel.slot[lvl][(t->expire >> (WHEEL_BITS * lvl)) &
+			WHEEL_MASK], t);
+}
+
+void wheel_add(struct wheel_timer_s *t, Uint32 timeout_ms, wheel_cb cb,
+	       void *priv)
+{
+	if(t->pprev != NULL)
+		wheel_cancel(t);
+
+	/* A timeout of zero expires on the next advance. */
+	t->expire = wheel.now + (timeout_ms > 0 ? timeout_ms : 1);
+	t->cb = cb;
+	t->priv = priv;
+	wheel_insert(t);
+	wheel.pending++;
+}
+
+void wheel_cancel(struct wheel_timer_s *t)
+{
+	if(t->pprev == NULL)
+		return;
+
+	wheel_unlink(t);
+	wheel.pending--;
+}
+
+SDL_bool wheel_pending(const struct wheel_timer_s *t)
+{
+	return t->pprev != NULL;
+}
+
+/**
+ * Move the timers of the current slot of a level down to lower levels.
+ * Returns SDL_TRUE if the next level must also be cascaded.
+ */
+static SDL_bool wheel_cascade(unsigned lvl)
+{
+	unsigned idx = (wheel.now >> (WHEEL_BITS * lvl)) & WHEEL_MASK;
+	struct wheel_timer_s *t = wheel.slot[lvl][idx];
+
+	wheel.slot[lvl][idx] = NULL;
+	while(t != NULL)
+	{
+		struct wheel_timer_s *next = t->next;
+
+		wheel_insert(t);
+		t = next;
+	}
+
+	return idx == 0;
+}
+
+void wheel_advance(Uint64 now_ms)
+{
+	SDL_assert(now_ms >= wheel.now);
+
+	while(wheel.now < now_ms)
+	{
+		struct wheel_timer_s *expired;
+		unsigned idx;
+
+		/* Nothing to do until the next timer is added. */
+		if(wheel.pending == 0)
+		{
+			wheel.now = now_ms;
+			break;
+		}
+
+		wheel.now++;
+		idx = wheel.now & WHEEL_MASK;
+
+		if(idx == 0)
+		{
+			unsigned lvl = 1;
+			while(lvl < WHEEL_LEVELS && wheel_cascade(lvl))
+				lvl++;
+		}
+
+		/* Move the expired timers to a local list, so that callbacks
+		 * may add or cancel any timer. */
+		expired = wheel.slot[0][idx];
+		if(expired == NULL)
+			continue;
+
+		wheel.slot[0][idx] = NULL;
+		expired->pprev = &expired;
+
+		while(expired != NULL)
+		{
+			struct wheel_timer_s *t = expired;
+
+			wheel_unlink(t);
+			wheel.pending--;
+			t->cb(t->priv);
+		}
+	}
+}
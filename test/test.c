@@ -17,12 +17,22 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <archive.h>
+#include <coreinfo.h>
+#include <disk.h>
 #include <font.h>
 #include <haiyajan.h>
 #include <load.h>
+#include <lz.h>
 #include <menu.h>
+#include <resample.h>
+#include <rewind.h>
 #include <timer.h>
 #include <ui.h>
+#include <tinf.h>
+#include <util.h>
+#include <vfs.h>
+#include <gcdb_bin_all.h>
 
 #include "minctest.h"
 
@@ -78,58 +88,837 @@ void test_retro_av(void)
 	struct timer_ctx_s tim;
 
 	{
-		/* Testing 10 FPS core with 10 Hz display. */
-		timer_init(&tim, 10.0);
-
-		/* Should be perfectly in sync. */
-		for(unsigned i = 10; i > 0; i--)
-			lequal(timer_get_delay(&tim, 100), 0);
-
+		/* Testing 10 FPS core. */
+		lequal(timer_init(&tim, 10.0), 0);
 		lfequal(tim.core_ms, 100.0);
 		lfequal(tim.timer_accumulator, 0.0);
+
+		/* A frame that takes no time is played on the next VSYNC. */
+		timer_profile_start(&tim);
+		lequal(timer_profile_end(&tim), 0);
+
+		/* The frame delay must leave time to run the core. */
+		timer_set_frame_delay(&tim, 50);
+		lequal(tim.frame_delay_ms, 50);
+		lequal(tim.frame_delay_auto, 0);
+		timer_set_frame_delay(&tim, 1000);
+		lequal(tim.frame_delay_ms, 99);
+		timer_set_frame_delay(&tim, -1);
+		lequal(tim.frame_delay_ms, 0);
+		lequal(tim.frame_delay_auto, 1);
 	}
 
 	{
-		/* Testing 50.00 FPS core with 100.00 Hz display. */
+		/* Testing 50.00 FPS core. */
 		int ret = timer_init(&tim, 50.00);
 		lequal(ret, 0);
+		lfequal(tim.core_ms, 20.0);
+		lequal(tim.delay_comp_ms, 42);
 
-		/* Our computer is really fast, so imagine that the time it
-		 * takes to render a single frame is less than a milisecond. */
-		lequal(timer_get_delay(&tim, 10), 0);
-		lequal(timer_get_delay(&tim, 10), 0);
-		lequal(timer_get_delay(&tim, 10), 0);
-		lequal(timer_get_delay(&tim, 10), 0);
+		timer_set_frame_delay(&tim, 20);
+		lequal(tim.frame_delay_ms, 19);
 	}
 }
 
+static char *test_ui_drawing_str(void *priv)
+{
+	(void) priv;
+	return NULL;
+}
+
+/**
+ * Tests that an overlay is drawn within its corner, and that overlays are
+ * deleted once their text is no longer available. The menu renderer is
+ * compiled out of ui.c, so only overlays are drawn.
+ */
 void test_ui_drawing(void)
 {
-	SDL_Surface *ref = SDL_LoadBMP("../meta/menu_320x240.bmp");
-	SDL_Surface *surf = SDL_CreateRGBSurfaceWithFormat(0, ref->w, ref->h,
-			ref->format->BytesPerPixel, ref->format->format);
-	SDL_Renderer *rend = SDL_CreateSoftwareRenderer(surf);
-	font_ctx *font = FontStartup(rend);
-	ui *ui = ui_init(font, rend);
-	long unsigned surfsz = surf->pitch * surf->h;
-	menu_ctx menu;
-	menu_item menu_items[] = {
-		{ "Continue", NULL, MENU_SUB_MENU, { .sub_menu = NULL }},
-		{ "Open", NULL, MENU_SUB_MENU, { .sub_menu = NULL }},
-		{ "Quit", NULL, MENU_SUB_MENU, { .sub_menu = NULL }}
-	};
+	const SDL_Colour c = { 0x00, 0xFF, 0x00, SDL_ALPHA_OPAQUE };
+	SDL_Surface *surf;
+	SDL_Renderer *rend;
+	font_ctx *font;
+	ui_overlay_ctx *ov = NULL;
+	const Uint32 *px;
+	int stride, x, y;
+	int text_found = 0;
+
+	surf = SDL_CreateRGBSurfaceWithFormat(0, 320, 240, 32,
+			SDL_PIXELFORMAT_ARGB8888);
+	lok(surf != NULL);
+	if(surf == NULL)
+		return;
+
+	rend = SDL_CreateSoftwareRenderer(surf);
+	font = rend != NULL ? FontStartup(rend) : NULL;
+	lok(font != NULL);
+	if(font == NULL)
+		goto out;
+
+	SDL_SetRenderDrawColor(rend, 0x00, 0x00, 0xFF, SDL_ALPHA_OPAQUE);
+	SDL_RenderClear(rend);
 
-	menu_init(&menu, NULL, NULL, NULL, SDL_arraysize(menu_items),
-			menu_items);
-	menu_instruct(&menu, MENU_INSTR_NEXT_ITEM);
-	draw_menu(ui, &menu);
+	lok(ui_add_overlay(&ov, c, ui_overlay_bot_right, "Haiyajan", 0,
+			NULL, NULL, 0) != NULL);
+	lequal(ui_overlay_render(&ov, rend, font), 0);
 
-	lequal(SDL_memcmp(surf->pixels, ref->pixels, surfsz), 0);
+	/* The opposite corner is left untouched. */
+	px = surf->pixels;
+	stride = surf->pitch / 4;
+	lok(px[0] == 0xFF0000FF);
+
+	/* The text is drawn within the bottom right quarter. */
+	for(y = surf->h / 2; y < surf->h; y++)
+	{
+		for(x = surf->w / 2; x < surf->w; x++)
+		{
+			if((px[(y * stride) + x] & 0x0000FF00) > 0x00008000)
+				text_found = 1;
+		}
+	}
+	lok(text_found);
+
+	ui_overlay_delete_all(&ov);
+	lok(ov == NULL);
+
+	/* An overlay whose text is unavailable is deleted when rendered. */
+	lok(ui_add_overlay(&ov, c, ui_overlay_top_left, NULL, 0,
+			test_ui_drawing_str, NULL, 0) != NULL);
+	lequal(ui_overlay_render(&ov, rend, font), 0);
+	lok(ov == NULL);
 
 	FontExit(font);
-	SDL_DestroyRenderer(rend);
+
+out:
+	if(rend != NULL)
+		SDL_DestroyRenderer(rend);
+
 	SDL_FreeSurface(surf);
-	SDL_FreeSurface(ref);
+}
+
+/**
+ * Convert one second of a sine wave and return the ratio of the RMS level of
+ * the output to that of the input, ignoring the start of the output that is
+ * filtered with initial silence.
+ */
+static double test_resample_tone(double in_rate, double out_rate,
+		resample_quality_e q, double freq)
+{
+	const Uint32 in_frames = (Uint32)in_rate;
+	const double amp = 8192.0;
+	Sint16 *in = SDL_malloc(in_frames * 2 * sizeof(Sint16));
+	Sint16 *out = NULL;
+	resample_ctx *rs = resample_init(in_rate, out_rate, q);
+	Uint32 produced = 0, i;
+	double sum = 0.0;
+	double ret = -1.0;
+
+	if(in == NULL || rs == NULL)
+		goto out;
+
+	out = SDL_malloc(resample_max_output(rs, in_frames) * 2 *
+			sizeof(Sint16));
+	if(out == NULL)
+		goto out;
+
+	for(i = 0; i < in_frames; i++)
+	{
+		double v = amp * SDL_sin(2.0 * M_PI * freq * i / in_rate);
+		in[i * 2] = (Sint16)v;
+		in[(i * 2) + 1] = (Sint16)-v;
+	}
+
+	produced = resample_process(rs, in, in_frames, out);
+	if(produced <= 256)
+		goto out;
+
+	for(i = 256; i < produced; i++)
+		sum += (double)out[i * 2] * out[i * 2];
+
+	ret = SDL_sqrt(sum / (produced - 256)) / (amp / SDL_sqrt(2.0));
+
+out:
+	resample_exit(rs);
+	SDL_free(in);
+	SDL_free(out);
+	return ret;
+}
+
+/**
+ * Tests that a constant signal passes through the resampler unchanged, that
+ * the level of a tone within the passband is kept, that a tone above the
+ * Nyquist frequency of the output is rejected instead of aliased, and
+ * reports the time taken to convert one second of audio at each quality.
+ */
+void test_resample(void)
+{
+	const double in_rate = 32040.5;
+	const double out_rate = 48000.0;
+	const Uint32 in_frames = 32040;
+	const Uint32 chunk = 534;
+	Sint16 *in = SDL_malloc(in_frames * 2 * sizeof(Sint16));
+	Sint16 *out = SDL_malloc(in_frames * 4 * sizeof(Sint16));
+	unsigned q;
+
+	for(Uint32 i = 0; i < in_frames * 2; i++)
+		in[i] = (i & 1) ? -8192 : 8192;
+
+	for(q = 0; q < RESAMPLE_QUALITY_MAX; q++)
+	{
+		resample_ctx *rs = resample_init(in_rate, out_rate, q);
+		Uint64 beg, end;
+		Uint32 produced = 0;
+		Uint32 i;
+		int dc_ok = 1;
+		double gain;
+
+		lok(rs != NULL);
+		if(rs == NULL)
+			continue;
+
+		beg = SDL_GetPerformanceCounter();
+		for(i = 0; i < in_frames; i += chunk)
+		{
+			Uint32 n = in_frames - i < chunk ? in_frames - i : chunk;
+			Uint32 got = resample_process(rs, in + (i * 2), n,
+					out + (produced * 2));
+
+			lok(got <= resample_max_output(rs, n));
+			produced += got;
+		}
+		end = SDL_GetPerformanceCounter();
+
+		/* Allow for the delay and the rate conversion. */
+		lok(produced > 47900 && produced <= 48002);
+
+		/* Skip the start, which is filtered with initial silence. */
+		for(i = 128; i < produced; i++)
+		{
+			if(SDL_abs(out[i * 2] - 8192) > 2 ||
+				SDL_abs(out[(i * 2) + 1] + 8192) > 2)
+			{
+				dc_ok = 0;
+			}
+		}
+		lok(dc_ok);
+
+		/* 1 kHz is well within the passband of every quality. */
+		gain = test_resample_tone(in_rate, out_rate, q, 1000.0);
+		lok(gain > 0.98 && gain < 1.02);
+
+		/* 20 kHz would alias to 12 kHz at 32 kHz. */
+		gain = test_resample_tone(48000.0, 32000.0, q, 20000.0);
+		lok(gain >= 0.0 && gain < 0.01);
+
+		printf("\tResample quality %u with %s: %.3f ms per second of "
+			"audio\n", q, resample_get_isa(rs),
+			(double)(end - beg) * 1000.0 /
+			(double)SDL_GetPerformanceFrequency());
+
+		resample_exit(rs);
+	}
+
+	SDL_free(in);
+	SDL_free(out);
+}
+
+/**
+ * Tests that every chunk of the embedded game controller database inflates to
+ * its expected size and starts with its GUID, and prints the throughput.
+ */
+void test_tinflate(void)
+{
+	const unsigned reps = 20;
+	unsigned long max_len = 0, total = 0;
+	unsigned char *out;
+	Uint64 beg, end;
+	unsigned i, r;
+	int ok = 1;
+
+	for(i = 0; i < SDL_arraysize(gcdb_chunks); i++)
+	{
+		if(gcdb_chunks[i].txt_len > max_len)
+			max_len = gcdb_chunks[i].txt_len;
+	}
+
+	out = SDL_malloc(max_len);
+	lok(out != NULL);
+	if(out == NULL)
+		return;
+
+	beg = SDL_GetPerformanceCounter();
+	for(r = 0; r < reps; r++)
+	{
+		for(i = 0; i < SDL_arraysize(gcdb_chunks); i++)
+		{
+			const struct gcdb_chunk_s *c = &gcdb_chunks[i];
+			unsigned long len = max_len;
+
+			if(tinf_uncompress(out, &len, gcdb_bin + c->offset,
+					c->len) != TINF_OK ||
+				len != c->txt_len ||
+				SDL_memcmp(out, c->first_guid, 32) != 0)
+			{
+				ok = 0;
+			}
+
+			total += len;
+		}
+	}
+	end = SDL_GetPerformanceCounter();
+
+	lok(ok);
+
+	/* Truncated input must be detected. */
+	{
+		unsigned long len = max_len;
+		lok(tinf_uncompress(out, &len, gcdb_bin + gcdb_chunks[0].offset,
+				gcdb_chunks[0].len / 2) != TINF_OK);
+	}
+
+	printf("\tInflated %lu KiB at %.1f MB/s\n", total / 1024,
+		(double)total * (double)SDL_GetPerformanceFrequency() /
+		((double)(end - beg) * 1000000.0));
+
+	SDL_free(out);
+}
+
+/* Inflate with the given number of bytes of input and output per call. */
+static tinf_error_code stream_inflate(struct tinf_stream *s,
+	const unsigned char *src, unsigned long src_len, unsigned char *dst,
+	unsigned long *dst_len, unsigned long in_step, unsigned long out_step)
+{
+	unsigned long in = 0, out = 0;
+	tinf_error_code res;
+
+	tinf_stream_reset(s);
+
+	do
+	{
+		unsigned long il = SDL_min(in_step, src_len - in);
+		unsigned long ol = SDL_min(out_step, *dst_len - out);
+
+		res = tinf_stream_uncompress(s, dst + out, &ol, src + in, &il);
+		in += il;
+		out += ol;
+
+		/* Stop if no progress can be made. */
+		if(il == 0 && ol == 0 && res == TINF_OK)
+			break;
+	} while(res == TINF_OK);
+
+	*dst_len = out;
+	return res;
+}
+
+void test_tinflate_stream(void)
+{
+	/* "Haiyajan Haiyajan Haiyajan" in a fixed and a stored block. */
+	static const unsigned char fixed[] = {
+		0xf3, 0x48, 0xcc, 0xac, 0x4c, 0xcc, 0x4a, 0xcc, 0x53, 0xf0,
+		0x40, 0x67, 0x00, 0x00
+	};
+	static const unsigned char stored[] = {
+		0x01, 0x1a, 0x00, 0xe5, 0xff, 0x48, 0x61, 0x69, 0x79, 0x61,
+		0x6a, 0x61, 0x6e, 0x20, 0x48, 0x61, 0x69, 0x79, 0x61, 0x6a,
+		0x61, 0x6e, 0x20, 0x48, 0x61, 0x69, 0x79, 0x61, 0x6a, 0x61,
+		0x6e
+	};
+	const char *txt = "Haiyajan Haiyajan Haiyajan";
+	unsigned char *whole, *part;
+	struct tinf_stream *s;
+	unsigned long max_len = 0, len;
+	unsigned i;
+	int ok = 1;
+
+	for(i = 0; i < SDL_arraysize(gcdb_chunks); i++)
+	{
+		if(gcdb_chunks[i].txt_len > max_len)
+			max_len = gcdb_chunks[i].txt_len;
+	}
+
+	s = tinf_stream_init();
+	whole = SDL_malloc(max_len);
+	part = SDL_malloc(max_len);
+	lok(s != NULL && whole != NULL && part != NULL);
+	if(s == NULL || whole == NULL || part == NULL)
+		goto out;
+
+	/* Output must match that of tinf_uncompress() regardless of the size
+	 * of input and output given to each call. */
+	for(i = 0; i < SDL_arraysize(gcdb_chunks); i++)
+	{
+		const struct gcdb_chunk_s *c = &gcdb_chunks[i];
+		unsigned long whole_len = max_len;
+
+		len = max_len;
+		if(tinf_uncompress(whole, &whole_len, gcdb_bin + c->offset,
+				c->len) != TINF_OK ||
+			stream_inflate(s, gcdb_bin + c->offset, c->len, part,
+				&len, 1 + i % 13, 1 + i % 7) != TINF_DONE ||
+			len != whole_len ||
+			SDL_memcmp(whole, part, len) != 0)
+		{
+			ok = 0;
+		}
+	}
+	lok(ok);
+
+	len = max_len;
+	lequal(stream_inflate(s, fixed, sizeof(fixed), part, &len, 3, 5),
+		TINF_DONE);
+	lok(len == SDL_strlen(txt) && SDL_memcmp(part, txt, len) == 0);
+
+	len = max_len;
+	lequal(stream_inflate(s, stored, sizeof(stored), part, &len, 4, 3),
+		TINF_DONE);
+	lok(len == SDL_strlen(txt) && SDL_memcmp(part, txt, len) == 0);
+
+	/* Truncated input must not be reported as complete. */
+	len = max_len;
+	lequal(stream_inflate(s, gcdb_bin + gcdb_chunks[0].offset,
+			gcdb_chunks[0].len / 2, part, &len, 64, 64), TINF_OK);
+
+out:
+	SDL_free(part);
+	SDL_free(whole);
+	tinf_stream_free(s);
+}
+
+void test_archive(void)
+{
+	/* Zip archive holding "readme.txt" stored, the directory "dir/", and
+	 * "dir/a.gb" and "dir/b.gb" compressed with deflate. */
+	static const Uint8 zip[] = {
+		0x50, 0x4b, 0x03, 0x04, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x21, 0x50, 0x65, 0x55, 0x94, 0x79, 0x08, 0x00,
+		0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+		0x72, 0x65, 0x61, 0x64, 0x6d, 0x65, 0x2e, 0x74, 0x78, 0x74,
+		0x48, 0x61, 0x69, 0x79, 0x61, 0x6a, 0x61, 0x6e, 0x50, 0x4b,
+		0x03, 0x04, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x21, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x64, 0x69,
+		0x72, 0x2f, 0x50, 0x4b, 0x03, 0x04, 0x14, 0x00, 0x00, 0x00,
+		0x08, 0x00, 0x00, 0x00, 0x21, 0x50, 0x4b, 0x51, 0xd8, 0x26,
+		0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x08, 0x00,
+		0x00, 0x00, 0x64, 0x69, 0x72, 0x2f, 0x61, 0x2e, 0x67, 0x62,
+		0x73, 0x74, 0x72, 0x76, 0x71, 0xa4, 0x00, 0x03, 0x00, 0x50,
+		0x4b, 0x03, 0x04, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+		0x00, 0x21, 0x50, 0x49, 0x3c, 0x46, 0xa6, 0x0f, 0x00, 0x00,
+		0x00, 0x28, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x64,
+		0x69, 0x72, 0x2f, 0x62, 0x2e, 0x67, 0x62, 0x33, 0x30, 0x34,
+		0x32, 0x36, 0x31, 0x35, 0x33, 0xb7, 0xb0, 0x34, 0xc0, 0xcb,
+		0x02, 0x00, 0x50, 0x4b, 0x01, 0x02, 0x14, 0x03, 0x14, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x50, 0x65, 0x55,
+		0x94, 0x79, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+		0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x72, 0x65,
+		0x61, 0x64, 0x6d, 0x65, 0x2e, 0x74, 0x78, 0x74, 0x50, 0x4b,
+		0x01, 0x02, 0x14, 0x03, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x21, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01,
+		0x30, 0x00, 0x00, 0x00, 0x64, 0x69, 0x72, 0x2f, 0x50, 0x4b,
+		0x01, 0x02, 0x14, 0x03, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00,
+		0x00, 0x00, 0x21, 0x50, 0x4b, 0x51, 0xd8, 0x26, 0x09, 0x00,
+		0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01,
+		0x52, 0x00, 0x00, 0x00, 0x64, 0x69, 0x72, 0x2f, 0x61, 0x2e,
+		0x67, 0x62, 0x50, 0x4b, 0x01, 0x02, 0x14, 0x03, 0x14, 0x00,
+		0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x21, 0x50, 0x49, 0x3c,
+		0x46, 0xa6, 0x0f, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+		0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x80, 0x01, 0x81, 0x00, 0x00, 0x00, 0x64, 0x69,
+		0x72, 0x2f, 0x62, 0x2e, 0x67, 0x62, 0x50, 0x4b, 0x05, 0x06,
+		0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0xd6, 0x00,
+		0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00
+	};
+	const char *zip_file = "test_archive.zip";
+	const char *check = "123456789";
+	unsigned entries[2];
+	void *dst[2] = { NULL, NULL };
+	archive_ctx *arc = NULL;
+	SDL_RWops *rw;
+	unsigned i;
+
+	lequal((int)util_crc32(check, SDL_strlen(check), 0), (int)0xCBF43926);
+	lequal((int)util_crc32(check + 4, 5, util_crc32(check, 4, 0)),
+		(int)0xCBF43926);
+
+	lok(util_has_ext("dir/game.GB", "gbc|gb"));
+	lok(!util_has_ext("dir.gb/game", "gb"));
+	lok(!util_has_ext("game.gb", NULL));
+
+	rw = SDL_RWFromFile(zip_file, "wb");
+	lok(rw != NULL);
+	if(rw == NULL)
+		return;
+
+	lequal((int)SDL_RWwrite(rw, zip, sizeof(zip), 1), 1);
+	SDL_RWclose(rw);
+
+	arc = archive_open(zip_file);
+	lok(arc != NULL);
+	if(arc == NULL)
+		goto out;
+
+	/* Directories are not entries. */
+	lequal((int)archive_count(arc), 3);
+	lequal(archive_find(arc, "gb"), 1);
+	lequal(archive_find(arc, "nes"), -1);
+	lok(SDL_strcmp(archive_name(arc, 2), "dir/b.gb") == 0);
+
+	for(i = 0; i < 2; i++)
+	{
+		entries[i] = i + 1;
+		dst[i] = SDL_malloc(archive_size(arc, i + 1));
+		lok(dst[i] != NULL);
+		if(dst[i] == NULL)
+			goto out;
+	}
+
+	lequal((int)archive_size(arc, 1), 64);
+	lequal((int)archive_size(arc, 2), 40);
+	lequal(archive_extract(arc, 2, entries, dst, NULL, NULL), 0);
+	lok(SDL_memcmp(dst[0], "ABCDABCD", 8) == 0);
+	lok(SDL_memcmp((Uint8 *)dst[1] + 30, "0123456789", 10) == 0);
+
+	entries[0] = 0;
+	lequal(archive_extract(arc, 1, entries, dst, NULL, NULL), 0);
+	lok(SDL_memcmp(dst[0], "Haiyajan", 8) == 0);
+
+out:
+	for(i = 0; i < 2; i++)
+		SDL_free(dst[i]);
+
+	archive_close(arc);
+	remove(zip_file);
+}
+
+void test_write_file(void)
+{
+	const char *file = "test_write.srm";
+	const char *a = "Haiyajan";
+	const char *b = "Save";
+	SDL_RWops *rw;
+	size_t len;
+	void *dat;
+
+	lequal(util_write_file(file, a, SDL_strlen(a)), 0);
+
+	/* An existing file is replaced. */
+	lequal(util_write_file(file, b, SDL_strlen(b)), 0);
+
+	dat = SDL_LoadFile(file, &len);
+	lok(dat != NULL);
+	lok(len == SDL_strlen(b) && SDL_memcmp(dat, b, len) == 0);
+	SDL_free(dat);
+
+	/* The temporary file is not left behind. */
+	rw = SDL_RWFromFile("test_write.srm.tmp", "rb");
+	lok(rw == NULL);
+	if(rw != NULL)
+		SDL_RWclose(rw);
+
+	remove(file);
+}
+
+void test_coreinfo(void)
+{
+	const char *cache = "test_coreinfo.txt";
+	const char *core = "test_core.so";
+	struct retro_system_info sys = {
+		"Test\tCore", "1.0", "gb|gbc", SDL_FALSE, SDL_FALSE
+	};
+	struct retro_system_av_info av = {
+		{ 160, 144, 256, 224, 1.5f }, { 59.7275, 32768.0 }
+	};
+	const struct coreinfo_entry_s *e;
+	coreinfo_ctx *ci;
+
+	lequal(util_write_file(core, "core", 4), 0);
+
+	ci = coreinfo_open(cache);
+	lok(ci != NULL);
+	if(ci == NULL)
+		goto out;
+
+	lok(coreinfo_find(ci, core) == NULL);
+	lequal(coreinfo_set(ci, core, &sys, &av, "MIT"), 0);
+	lequal(coreinfo_save(ci), 0);
+	coreinfo_close(ci);
+
+	/* Information is restored from the file. */
+	ci = coreinfo_open(cache);
+	lok(ci != NULL);
+	if(ci == NULL)
+		goto out;
+
+	e = coreinfo_find(ci, core);
+	lok(e != NULL);
+	if(e != NULL)
+	{
+		lok(SDL_strcmp(e->library_name, "Test Core") == 0);
+		lok(SDL_strcmp(e->valid_extensions, "gb|gbc") == 0);
+		lok(SDL_strcmp(e->license, "MIT") == 0);
+		lequal((int)e->av_info.geometry.max_width, 256);
+		lfequal(e->av_info.geometry.aspect_ratio, 1.5f);
+		lfequal(e->av_info.timing.fps, 59.7275);
+	}
+
+	lok(coreinfo_find_ext(ci, "dir/game.GBC") == e);
+	lok(coreinfo_find_ext(ci, "game.nes") == NULL);
+
+	/* Changed cores are not used. */
+	lequal(util_write_file(core, "new core", 8), 0);
+	lok(coreinfo_find(ci, core) == NULL);
+	coreinfo_close(ci);
+
+out:
+	remove(core);
+	remove(cache);
+}
+
+void test_disk_m3u(void)
+{
+	const char *m3u = "test_disk.m3u";
+	const char *txt = "#EXTM3U\r\n"
+		"Game (Disk 1).cue\r\n"
+		"\r\n"
+		"# Comment\n"
+		"/abs/Game (Disk 2).cue|Save Disk  \n"
+		"Game (Disk 3).cue";
+	disk_ctx *d;
+
+	lequal(util_write_file(m3u, txt, SDL_strlen(txt)), 0);
+
+	/* Images are relative to the directory of the playlist. */
+	d = disk_open_m3u("./test_disk.m3u");
+	lok(d != NULL);
+	if(d == NULL)
+		goto out;
+
+	lequal((int)disk_count(d), 3);
+	lok(SDL_strcmp(disk_path(d, 0), "./Game (Disk 1).cue") == 0);
+	lok(SDL_strcmp(disk_path(d, 1), "/abs/Game (Disk 2).cue") == 0);
+	lok(SDL_strcmp(disk_path(d, 2), "./Game (Disk 3).cue") == 0);
+	lok(disk_path(d, 3) == NULL);
+	disk_close(d);
+
+	/* Playlists without images are rejected. */
+	lequal(util_write_file("test_disk_empty.m3u", "#EXTM3U\n", 8), 0);
+	lok(disk_open_m3u("test_disk_empty.m3u") == NULL);
+	remove("test_disk_empty.m3u");
+
+out:
+	remove(m3u);
+}
+
+void test_vfs(void)
+{
+	const char *path = "./test_vfs.bin";
+	struct retro_vfs_interface_info info = { 1, NULL };
+	const struct retro_vfs_interface *vfs;
+	struct retro_vfs_file_handle *f;
+	struct vfs_stats_s st;
+	Uint8 buf[VFS_CACHE_SIZE + 16];
+	Uint8 b[4];
+	unsigned i;
+	int ok = 1;
+
+	lequal(vfs_get_interface(&info), 0);
+	lequal((int)info.required_interface_version, VFS_INTERFACE_VERSION);
+	vfs = info.iface;
+
+	for(i = 0; i < sizeof(buf); i++)
+		buf[i] = (Uint8)i;
+
+	f = vfs->open(path, RETRO_VFS_FILE_ACCESS_READ_WRITE, 0);
+	lok(f != NULL);
+	if(f == NULL)
+		return;
+
+	lok(SDL_strcmp(vfs->get_path(f), path) == 0);
+	lequal((int)vfs->write(f, buf, sizeof(buf)), (int)sizeof(buf));
+	lequal((int)vfs->size(f), (int)sizeof(buf));
+
+	/* Small reads are served from the read-ahead cache. */
+	lequal((int)vfs->seek(f, 3, RETRO_VFS_SEEK_POSITION_START), 3);
+	for(i = 0; i < 256; i++)
+	{
+		if(vfs->read(f, b, 1) != 1 || b[0] != (Uint8)(i + 3))
+			ok = 0;
+	}
+	lok(ok);
+
+	vfs_get_file_stats(f, &st);
+	lequal((int)st.reads, 256);
+	lequal((int)st.misses, 1);
+
+	/* Reads across the end of the cache and of the file. */
+	lequal((int)vfs->seek(f, -6, RETRO_VFS_SEEK_POSITION_END),
+		(int)sizeof(buf) - 6);
+	lequal((int)vfs->read(f, buf, 16), 6);
+	lequal((int)vfs->read(f, buf, 16), 0);
+	lequal((int)vfs->truncate(f, 8), 0);
+	lequal((int)vfs->size(f), 8);
+	lequal(vfs->close(f), 0);
+
+	/* Files that are only read are mapped where supported. */
+	f = vfs->open(path, RETRO_VFS_FILE_ACCESS_READ, 0);
+	lok(f != NULL);
+	if(f != NULL)
+	{
+		lequal((int)vfs->size(f), 8);
+		lequal((int)vfs->seek(f, 2,
+				RETRO_VFS_SEEK_POSITION_CURRENT), 2);
+		lequal((int)vfs->read(f, b, 4), 4);
+		lok(b[0] == 2 && b[3] == 5);
+		lequal((int)vfs->write(f, b, 4), -1);
+		lequal(vfs->close(f), 0);
+	}
+
+#ifdef __linux__
+	/* Files of procfs have a size of zero, but are not empty. */
+	f = vfs->open("/proc/self/stat", RETRO_VFS_FILE_ACCESS_READ, 0);
+	lok(f != NULL);
+	if(f != NULL)
+	{
+		lequal((int)vfs->read(f, b, sizeof(b)), (int)sizeof(b));
+		lequal(vfs->close(f), 0);
+	}
+#endif
+
+	lequal(vfs->stat(path, NULL), RETRO_VFS_STAT_IS_VALID);
+	lequal(vfs->remove(path), 0);
+	lequal(vfs->stat(path, NULL), 0);
+	lok(vfs->open(path, RETRO_VFS_FILE_ACCESS_READ, 0) == NULL);
+}
+
+void test_lz(void)
+{
+	static Uint8 src[8192], cmp[LZ_BOUND(sizeof(src))], out[sizeof(src)];
+	Uint32 seed = 1;
+	size_t len, out_len;
+	unsigned i;
+
+	/* Runs of repeated bytes, separated by noise. */
+	for(i = 0; i < sizeof(src); i++)
+	{
+		seed = seed * 1103515245 + 12345;
+		src[i] = (i % 512) < 384 ? (Uint8)(i / 512) :
+			(Uint8)(seed >> 16);
+	}
+
+	len = lz_compress(src, sizeof(src), cmp);
+	lok(len > 0 && len < sizeof(src));
+
+	out_len = sizeof(out);
+	lequal(lz_decompress(cmp, len, out, &out_len), 0);
+	lequal((int)out_len, (int)sizeof(src));
+	lok(SDL_memcmp(src, out, sizeof(src)) == 0);
+
+	/* Truncated data, and output that is too small, are rejected. */
+	out_len = sizeof(out);
+	lequal(lz_decompress(cmp, len - 1, out, &out_len), -1);
+	out_len = sizeof(out) - 1;
+	lequal(lz_decompress(cmp, len, out, &out_len), -1);
+
+	/* Input too short to contain a match is stored as literals. */
+	len = lz_compress("abc", 3, cmp);
+	out_len = sizeof(out);
+	lequal(lz_decompress(cmp, len, out, &out_len), 0);
+	lequal((int)out_len, 3);
+	lok(SDL_memcmp(out, "abc", 3) == 0);
+}
+
+/* State of a fake core that is rewound. The first bytes hold the frame
+ * number. The size is only reported once the core has run. */
+static Uint8 rewind_core_state[4099];
+static size_t rewind_core_len;
+
+static size_t rewind_serialize_size(void)
+{
+	return rewind_core_len;
+}
+
+static bool rewind_serialize(void *data, size_t size)
+{
+	SDL_memcpy(data, rewind_core_state, size);
+	return true;
+}
+
+static bool rewind_unserialize(const void *data, size_t size)
+{
+	SDL_memcpy(rewind_core_state, data, size);
+	return true;
+}
+
+void test_rewind(void)
+{
+	struct core_ctx_s core = { 0 };
+	struct rewind_stats_s st;
+	rewind_ctx *r;
+	Uint32 frame = 0, prev;
+	int ret, ok = 1;
+
+	core.fn.retro_serialize_size = rewind_serialize_size;
+	core.fn.retro_serialize = rewind_serialize;
+	core.fn.retro_unserialize = rewind_unserialize;
+	core.av_info.timing.fps = 60.0;
+
+	/* Small enough for the oldest states to be dropped. */
+	r = rewind_init(&core, 2048, 2);
+	lok(r != NULL);
+	if(r == NULL)
+		return;
+
+	lequal(rewind_step(r), 1);
+
+	/* Nothing is captured until the size of the state is reported. */
+	rewind_core_len = 0;
+	rewind_frame(r);
+	rewind_frame(r);
+	rewind_get_stats(r, &st);
+	lequal((int)st.captures, 0);
+	lequal(rewind_step(r), 1);
+	rewind_core_len = sizeof(rewind_core_state);
+
+	for(frame = 1; frame <= 400; frame++)
+	{
+		SDL_memcpy(rewind_core_state, &frame, sizeof(frame));
+		rewind_core_state[4 + frame] = (Uint8)frame;
+		rewind_frame(r);
+	}
+
+	rewind_get_stats(r, &st);
+	lok(st.states > 0 && st.states < 199);
+	lok(st.used <= st.size);
+	lequal((int)st.captures, 200);
+
+	/* Each step restores the state two frames before the last. */
+	prev = 400;
+	do
+	{
+		ret = rewind_step(r);
+		SDL_memcpy(&frame, rewind_core_state, sizeof(frame));
+		if(frame != prev - 2 || rewind_core_state[4 + frame] !=
+			(Uint8)frame)
+		{
+			ok = 0;
+		}
+
+		prev = frame;
+	} while(ret == 0);
+
+	lok(ok);
+	lequal(ret, 1);
+	lequal((int)frame, 400 - 2 * (int)st.states);
+
+	/* The oldest state remains. */
+	lequal(rewind_step(r), 1);
+	SDL_memcpy(&prev, rewind_core_state, sizeof(prev));
+	lequal((int)prev, (int)frame);
+	rewind_free(r);
 }
 
 int main(void)
@@ -145,6 +934,16 @@ int main(void)
 	lrun("Init", test_retro_init);
 	lrun("Frame Timing", test_retro_av);
 	lrun("UI Drawing", test_ui_drawing);
+	lrun("Resample", test_resample);
+	lrun("Inflate", test_tinflate);
+	lrun("Inflate Stream", test_tinflate_stream);
+	lrun("Archive", test_archive);
+	lrun("Write File", test_write_file);
+	lrun("Core Information", test_coreinfo);
+	lrun("Disk Playlist", test_disk_m3u);
+	lrun("VFS", test_vfs);
+	lrun("LZ Compression", test_lz);
+	lrun("Rewind", test_rewind);
 	SDL_Quit();
 	lresults();
 	return lfails != 0;
@@ -4,16 +4,24 @@
 # Copyright (c) 2020  Mahyar Koshkouei
 # Public Domain
 
+# Mappings are sorted by GUID and split into chunks that are compressed
+# separately, such that only the chunk holding the mapping of an attached
+# controller needs to be decompressed. Each chunk is indexed by the first GUID
+# within it. Mappings sharing a GUID are never split between chunks.
+
 # Check that the required applications for this script are installed.
 
 FILESRC="gamecontrollerdb"
 FILEDEF="gcdb_bin"
 URL="https://github.com/gabomdq/SDL_GameControllerDB/raw/master/gamecontrollerdb.txt"
 
+# Number of mappings in each chunk.
+CHUNK_LINES=32
+
 echo "Checking that required applications are available..."
 
 NOTFOUND=0
-for prog in "wget" "grep" "xxd" "cp" "rm" "zopfli" "stat"
+for prog in "wget" "grep" "xxd" "cp" "rm" "zopfli" "stat" "sort" "awk"
 do
 	if ! which $prog > /dev/null; then
 		echo "X  $prog not found"
@@ -43,17 +51,66 @@ mv ${FILESRC}.txt ${FILESRC}_all.txt
 echo "Compressing and creating headers"
 for os in "linux" "windows" "all"
 do
-	zopfli -i100 --deflate -c ${FILESRC}_${os}.txt > ${FILEDEF}
+	OUT=${FILEDEF}_${os}.h
+	rm -f ${FILEDEF}_chunk*
 
-	if ! xxd -i ${FILEDEF} > ${FILEDEF}_${os}.h; then
-		echo "xxd failed"
-		exit $?
-	fi
+	# Comments and blank lines are removed. The C locale is used so that
+	# the order matches that of SDL_strcmp().
+	grep -E '^[0-9a-f]{32},' ${FILESRC}_${os}.txt | \
+		LC_ALL=C sort -s -t, -k1,1 | \
+		awk -v n=$CHUNK_LINES -v pre=${FILEDEF}_chunk '
+		{
+			guid = substr($0, 1, 32);
+			if(NR == 1 || (lines >= n && guid != last))
+			{
+				c++;
+				lines = 0;
+			}
+			print > sprintf("%s%04d", pre, c);
+			lines++;
+			last = guid;
+		}'
+
+	cat > $OUT << EOF
+/* Generated by tools/gen_gcdb.sh. Do not edit. */
+#pragma once
+
+/* Separately compressed chunk of the game controller database. */
+struct gcdb_chunk_s
+{
+	char first_guid[33];
+	unsigned long offset;
+	unsigned long len;
+	unsigned long txt_len;
+};
+
+EOF
+	echo "static const unsigned char gcdb_bin[] = {" >> $OUT
+
+	OFFSET=0
+	INDEX=""
+	for chunk in ${FILEDEF}_chunk*
+	do
+		zopfli -i100 --deflate -c $chunk > ${chunk}.deflate
+
+		# Chunks are concatenated, so each must end with a comma.
+		if ! xxd -i < ${chunk}.deflate | sed 's/[^,]$/&,/' >> $OUT; then
+			echo "xxd failed"
+			exit $?
+		fi
+
+		BINSZ=$(stat -c %s ${chunk}.deflate)
+		TXTSZ=$(stat -c %s $chunk)
+		GUID=$(head -c 32 $chunk)
+		INDEX="${INDEX}\t{ \"${GUID}\", ${OFFSET}, ${BINSZ}, ${TXTSZ} },\n"
+		OFFSET=$((OFFSET + BINSZ))
+		rm -f $chunk ${chunk}.deflate
+	done
 
-	TXTSZ=$(stat -c %s ${FILESRC}_${os}.txt)
-	echo "const unsigned long gcdb_txt_len = $TXTSZ;" >> ${FILEDEF}_${os}.h
-	sed -i "1s/.*/const\ unsigned\ char\ gcdb_bin\[\]\ \=\ \{/" ${FILEDEF}_${os}.h
-	sed -i "s/unsigned\ int\ /const\ unsigned\ long\ /" ${FILEDEF}_${os}.h
+	echo "};" >> $OUT
+	echo "static const struct gcdb_chunk_s gcdb_chunks[] = {" >> $OUT
+	printf "$INDEX" >> $OUT
+	echo "};" >> $OUT
 done
 
-cp "${FILEOUT}"*.h ../inc/
+cp ${FILEDEF}_*.h ../inc/